@@ -1,4 +1,5 @@
 #include "data.h"
+#include "generate.h"
 #include "maps.h"
 
 #include <onut/Files.h>
@@ -162,6 +163,12 @@ void init_data()
 
         games[game.name] = game;
     }
+
+    // Maps are in their final place now, safe to hand out to workers.
+    // Headless never draws them, and exits while workers would still hold
+    // pointers into games.
+    if (!is_headless())
+        start_triangulation();
 }
 
 
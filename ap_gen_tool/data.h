@@ -8,6 +8,7 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <memory>
 #include "maps.h"
 
 
@@ -169,10 +170,62 @@ struct map_view_t
 };
 
 
+// A region as it was before/after an edit. Sectors are stored as what the
+// edit added and removed, painting one sector shouldn't copy the whole set.
+struct region_delta_t
+{
+    int index = -1;
+    bool before_exists = false;
+    bool after_exists = false;
+    region_t before; // Sectors left empty
+    region_t after; // Sectors left empty
+    std::vector<int> sectors_added;
+    std::vector<int> sectors_removed;
+};
+
+
+struct location_delta_t
+{
+    int index = -1;
+    bool before_exists = false;
+    bool after_exists = false;
+    location_t before;
+    location_t after;
+};
+
+
+// Only what one push_undo() changed, enough to go both ways
+struct map_delta_t
+{
+    Vector2 pos_before, pos_after;
+    float angle_before = 0.0f, angle_after = 0.0f;
+    int selected_bb_before = -1, selected_bb_after = -1;
+    int selected_region_before = -1, selected_region_after = -1;
+    int selected_location_before = -1, selected_location_after = -1;
+    int region_count_before = 0, region_count_after = 0;
+    std::vector<region_delta_t> regions;
+    bool bbs_changed = false;
+    std::vector<bb_t> bbs_before, bbs_after;
+    bool world_rules_changed = false;
+    rule_region_t world_rules_before, world_rules_after;
+    bool exit_rules_changed = false;
+    rule_region_t exit_rules_before, exit_rules_after;
+    std::vector<int> accesses_added;
+    std::vector<int> accesses_removed;
+    std::vector<location_delta_t> locations;
+    std::shared_ptr<map_state_t> keyframe; // State after this delta, every UNDO_KEYFRAME_INTERVAL
+    size_t memory = 0;
+};
+
+
 struct map_history_t
 {
-    std::vector<map_state_t> history;
-    int history_point = 0;
+    bool initialized = false;
+    map_state_t base; // State before deltas[0], a keyframe
+    map_state_t last; // State at history_point, what the next push diffs against
+    std::vector<map_delta_t> deltas;
+    int history_point = 0; // Deltas applied on top of base
+    size_t memory = 0;
 };
 
 
@@ -183,7 +236,7 @@ struct meta_t // Bad name, but everything about a level
     map_state_t state; // What we play with
     map_state_t state_new; // For diffing
     map_view_t view; // Camera zoom/position
-    map_history_t history; // History of map_state_t for undo/redo (It's infinite!)
+    map_history_t history; // Deltas of map_state_t for undo/redo, see history.h
 };
 
 
@@ -31,6 +31,7 @@
 #include "maps.h"
 #include "generate.h"
 #include "data.h"
+#include "parallel.h"
 
 #include <algorithm>
 
@@ -267,18 +268,121 @@ std::string convert_quoted_str(const std::string& str)
 }
 
 
+// Outputs are written next to their target first, and only replace it if the
+// content changed. Archipelago and CMake rebuild on timestamps, so rewriting
+// identical files costs everyone a rebuild.
+static bool read_file_hash(const std::string& filename, uint64_t* hash, long* size)
+{
+    FILE* f = fopen(filename.c_str(), "rb");
+    if (!f) return false;
+
+    uint64_t h = 0xcbf29ce484222325ULL; // FNV-1a
+    long total = 0;
+    uint8_t buf[16384];
+    size_t read;
+    while ((read = fread(buf, 1, sizeof(buf), f)) > 0)
+    {
+        for (size_t i = 0; i < read; ++i)
+        {
+            h ^= buf[i];
+            h *= 0x100000001b3ULL;
+        }
+        total += (long)read;
+    }
+    fclose(f);
+
+    *hash = h;
+    *size = total;
+    return true;
+}
+
+
+static FILE* open_output(const std::string& filename)
+{
+    FILE* f = fopen((filename + ".tmp").c_str(), "w");
+    if (!f) OLogE("Cannot open file for writing: " + filename);
+    return f;
+}
+
+
+static void close_output(FILE* f, const std::string& filename)
+{
+    if (!f) return;
+    fclose(f);
+
+    auto tmp_filename = filename + ".tmp";
+    uint64_t old_hash, new_hash;
+    long old_size, new_size;
+    if (read_file_hash(filename, &old_hash, &old_size) &&
+        read_file_hash(tmp_filename, &new_hash, &new_size) &&
+        old_size == new_size && old_hash == new_hash)
+    {
+        remove(tmp_filename.c_str());
+        OLog("Unchanged: " + filename);
+        return;
+    }
+
+    remove(filename.c_str()); // rename() won't replace on Windows
+    if (rename(tmp_filename.c_str(), filename.c_str()) != 0)
+        OLogE("Cannot write file: " + filename);
+    else
+        OLog("Written: " + filename);
+}
+
+
+// ap_gen_tool.exe python_py_out_dir cpp_py_out_dir poptracker_data_dir [-check] [-headless [codename ...]]
+static std::vector<std::string> get_out_dirs()
+{
+    std::vector<std::string> out_dirs;
+    for (const auto& arg : OArguments)
+    {
+        if (!arg.empty() && arg[0] == '-') break;
+        out_dirs.push_back(arg);
+    }
+    return out_dirs;
+}
+
+
+bool is_headless()
+{
+    return std::find(OArguments.begin(), OArguments.end(), "-headless") != OArguments.end();
+}
+
+
+int generate_headless()
+{
+    std::set<std::string> codenames;
+    auto it = std::find(OArguments.begin(), OArguments.end(), "-headless");
+    if (it != OArguments.end())
+        for (++it; it != OArguments.end() && !it->empty() && (*it)[0] != '-'; ++it)
+            codenames.insert(*it);
+
+    int ret = 0;
+    for (auto& kv : games)
+    {
+        auto game = &kv.second;
+        if (!codenames.empty() && codenames.find(game->codename) == codenames.end())
+            continue; // Not asked for
+        if (generate(game) != 0)
+            ret = 1;
+    }
+    return ret;
+}
+
+
 // This is a mess. Many refactors. Sorry...
 int generate(game_t* game)
 {
     OLog("AP Gen Tool");
 
-    if (OArguments.size() != 3) // Minimum effort validation
+    auto out_dirs = get_out_dirs();
+    if (out_dirs.size() != 3) // Minimum effort validation
     {
-        OLogE("Usage: ap_gen_tool.exe python_py_out_dir cpp_py_out_dir poptracker_data_dir\n  i.e: ap_gen_tool.exe C:\\github\\Archipelago\\worlds C:\\github\\apdoom\\src\\archipelago C:\\github\\apdoom\\data\\poptracker");
+        OLogE("Usage: ap_gen_tool.exe python_py_out_dir cpp_py_out_dir poptracker_data_dir [-check] [-headless [codename ...]]\n  i.e: ap_gen_tool.exe C:\\github\\Archipelago\\worlds C:\\github\\apdoom\\src\\archipelago C:\\github\\apdoom\\data\\poptracker");
         return 1;
     }
 
-    std::string py_out_dir = OArguments[0] + "\\" + game->world + "\\";
+    std::string py_out_dir = out_dirs[0] + "\\" + game->world + "\\";
     item_id_base = game->item_ids;
     item_next_id = item_id_base;
     location_next_id = game->loc_ids;
@@ -291,8 +395,8 @@ int generate(game_t* game)
     level_to_keycards.clear();
     item_map.clear();
 
-    std::string cpp_out_dir = OArguments[1] + std::string("\\");
-    std::string pop_tracker_data_dir = OArguments[2] + std::string("\\");
+    std::string cpp_out_dir = out_dirs[1] + std::string("\\");
+    std::string pop_tracker_data_dir = out_dirs[2] + std::string("\\");
 
     ap_locations.reserve(1000);
     ap_items.reserve(1000);
@@ -495,13 +599,21 @@ int generate(game_t* game)
         }
     }
 
-    // Fill in locations into level's sectors
+    // Fill in locations into level's sectors. The BSP walks are independent,
+    // the sector lists are filled after so location order stays stable.
+    std::vector<subsector_t*> loc_subsectors(ap_locations.size(), nullptr);
+    parallel_for((int)ap_locations.size(), [&loc_subsectors](int i)
+    {
+        const auto& loc = ap_locations[i];
+        if (loc.doom_thing_index < 0) return;
+        loc_subsectors[i] = point_in_subsector(loc.x, loc.y, get_map(loc.idx));
+    });
     for (int i = 0, len = (int)ap_locations.size(); i < len; ++i)
     {
         auto& loc = ap_locations[i];
         if (loc.doom_thing_index < 0) continue;
         auto level = get_level(loc.idx);
-        auto subsector = point_in_subsector(loc.x, loc.y, get_map(loc.idx));
+        auto subsector = loc_subsectors[i];
         if (subsector)
         {
             level->sectors[subsector->sector].locations.push_back(i);
@@ -518,7 +630,9 @@ int generate(game_t* game)
     //---------------------------------------------
     // Items
     {
-        FILE* fout = fopen((py_out_dir + "Items.py").c_str(), "w");
+        auto fout_filename = py_out_dir + "Items.py";
+        FILE* fout = open_output(fout_filename);
+        if (!fout) return 1;
         fprintf(fout, "# This file is auto generated. More info: https://github.com/Daivuk/apdoom\n\n");
         fprintf(fout, "from BaseClasses import ItemClassification\n\
 from typing import TypedDict, Dict, Set \n\
@@ -570,12 +684,14 @@ class ItemDict(TypedDict, total=False): \n\
         }
         fprintf(fout, "}\n");
 
-        fclose(fout);
+        close_output(fout, fout_filename);
     }
 
     // Generate Regions.py from regions.json (Manually entered data)
     {
-        FILE* fout = fopen((py_out_dir + "Regions.py").c_str(), "w");
+        auto fout_filename = py_out_dir + "Regions.py";
+        FILE* fout = open_output(fout_filename);
+        if (!fout) return 1;
         fprintf(fout, "# This file is auto generated. More info: https://github.com/Daivuk/apdoom\n\n");
         fprintf(fout, "from typing import List\n");
         fprintf(fout, "from BaseClasses import TypedDict\n\n");
@@ -671,12 +787,14 @@ class ItemDict(TypedDict, total=False): \n\
         }
         fprintf(fout, "]\n");
 
-        fclose(fout);
+        close_output(fout, fout_filename);
     }
     
     // Locations
     {
-        FILE* fout = fopen((py_out_dir + "Locations.py").c_str(), "w");
+        auto fout_filename = py_out_dir + "Locations.py";
+        FILE* fout = open_output(fout_filename);
+        if (!fout) return 1;
 
         fprintf(fout, "# This file is auto generated. More info: https://github.com/Daivuk/apdoom\n\n");
         fprintf(fout, "from typing import Dict, TypedDict, List, Set \n\
@@ -754,12 +872,14 @@ class LocationDict(TypedDict, total=False): \n\
         }
         fprintf(fout, "]\n");
 
-        fclose(fout);
+        close_output(fout, fout_filename);
     }
 
     // Maps
     {
-        FILE* fout = fopen((py_out_dir + "Maps.py").c_str(), "w");
+        auto fout_filename = py_out_dir + "Maps.py";
+        FILE* fout = open_output(fout_filename);
+        if (!fout) return 1;
 
         fprintf(fout, "# This file is auto generated. More info: https://github.com/Daivuk/apdoom\n\n");
         fprintf(fout, "from typing import List\n\n\n");
@@ -771,74 +891,59 @@ class LocationDict(TypedDict, total=False): \n\
         }
         fprintf(fout, "\n]\n");
 
-        fclose(fout);
+        close_output(fout, fout_filename);
     }
 
-    // Now generate apdoom_def.h so the game can map the IDs
+    // Now generate apdoom_def.h so the game can map the IDs.
+    // Everything is emitted as constant sorted arrays so the game doesn't
+    // have to build any container at startup.
     {
-        FILE* fout = fopen((cpp_out_dir + "ap" + game->codename + "_def.h").c_str(), "w");
+        auto fout_filename = cpp_out_dir + "ap" + game->codename + "_def.h";
+        FILE* fout = open_output(fout_filename);
+        if (!fout) return 1;
         
         fprintf(fout, "// This file is auto generated. More info: https://github.com/Daivuk/apdoom\n");
         fprintf(fout, "#pragma once\n\n");
         fprintf(fout, "#include \"apdoom.h\"\n");
-        fprintf(fout, "#include \"apdoom_def_types.h\"\n");
-        fprintf(fout, "#include <map>\n");
-        fprintf(fout, "#include <string>\n");
-        fprintf(fout, "#include <vector>\n\n\n");
+        fprintf(fout, "#include \"apdoom_def_types.h\"\n\n\n");
 
-        std::map<int /* ep */, std::map<int /* map */, std::map<int /* index */, int64_t /* loc id */>>> location_table;
+        // locations (ap_locations is already sorted by id)
+        fprintf(fout, "// Locations, sorted by id\n");
+        fprintf(fout, "constexpr ap_location_def_t ap_%s_locations[] = {\n", game->codename.c_str());
         for (const auto& loc : ap_locations)
         {
-            location_table[loc.idx.ep + 1][loc.idx.map + 1][loc.doom_thing_index] = loc.id;
-        }
-
-        // locations
-        fprintf(fout, "const std::map<int /* ep */, std::map<int /* map */, std::map<int /* index */, int64_t /* loc id */>>> ap_%s_location_table = {\n", game->codename.c_str());
-        for (const auto& kv1 : location_table)
-        {
-            fprintf(fout, "    {%i, {\n", kv1.first);
-            for (const auto& kv2 : kv1.second)
-            {
-                fprintf(fout, "        {%i, {\n", kv2.first);
-                for (const auto& kv3 : kv2.second)
-                {
-                    fprintf(fout, "            {%i, %lli},\n", kv3.first, kv3.second);
-                }
-                fprintf(fout, "        }},\n");
-            }
-            fprintf(fout, "    }},\n");
+            fprintf(fout, "    {%lli, {%i, %i, %i}},\n", loc.id, loc.idx.ep + 1, loc.idx.map + 1, loc.doom_thing_index);
         }
         fprintf(fout, "};\n\n\n");
 
         // items
-        fprintf(fout, "// Map item id\n");
-        fprintf(fout, "const std::map<int64_t, ap_item_t> ap_%s_item_table = {\n", game->codename.c_str());
+        std::vector<const ap_item_t*> sorted_items;
         for (const auto& item : ap_items)
+            sorted_items.push_back(&item);
+        std::sort(sorted_items.begin(), sorted_items.end(), [](const ap_item_t* a, const ap_item_t* b) { return a->id < b->id; });
+        fprintf(fout, "// Map item id, sorted by id\n");
+        fprintf(fout, "constexpr ap_item_def_t ap_%s_items[] = {\n", game->codename.c_str());
+        for (auto item : sorted_items)
         {
-            fprintf(fout, "    {%llu, {%i, %i, %i}},\n", item.id, item.doom_type, item.idx.ep + 1, item.idx.map + 1);
+            fprintf(fout, "    {%llu, {%i, %i, %i}},\n", item->id, item->doom_type, item->idx.ep + 1, item->idx.map + 1);
         }
         fprintf(fout, "};\n\n\n");
 
-        // Level infos
-        fprintf(fout, "std::vector<std::vector<ap_level_info_t>> ap_%s_level_infos = \n", game->codename.c_str());
-        fprintf(fout, "{\n");
+        // Thing infos for all levels, in one array. Each level info points to its span.
+        std::vector<int> thing_offsets;
+        std::vector<int> sanity_check_counts;
+        int thing_offset = 0;
+        fprintf(fout, "// Thing infos of every level. Levels below reference their span in it\n");
+        fprintf(fout, "constexpr ap_thing_info_t ap_%s_thing_infos[] = {\n", game->codename.c_str());
         for (int ep = 0; ep < game->ep_count; ++ep)
         {
-            fprintf(fout, "    {\n");
             int map = 0;
             for (const auto& meta : game->episodes[ep])
             {
                 auto level = get_level({game->name, ep, map});
-                fprintf(fout, "        {\"%s\", {%s, %s, %s}, {%i, %i, %i}, %i, %i, {\n", 
-                        level->name.c_str(),
-                        level->keys[0] ? "true" : "false", 
-                        level->keys[1] ? "true" : "false", 
-                        level->keys[2] ? "true" : "false", 
-                        level->use_skull[0] ? 1 : 0, 
-                        level->use_skull[1] ? 1 : 0, 
-                        level->use_skull[2] ? 1 : 0, 
-                        level->location_count,
-                        (int)level->map->things.size());
+                fprintf(fout, "    // %s\n", level->name.c_str());
+                thing_offsets.push_back(thing_offset);
+                int sanity_check_count = 0;
                 int idx = 0;
                 for (const auto& thing : level->map->things)
                 {
@@ -854,38 +959,85 @@ class LocationDict(TypedDict, total=False): \n\
                             break;
                         }
                     }
-                    fprintf(fout, "            {%i, %i, %i, %i},\n", thing.type, idx, check_sanity ? 1 : 0, unreachable ? 1 : 0);
+                    if (check_sanity) ++sanity_check_count;
+                    fprintf(fout, "    {%i, %i, %i, %i},\n", thing.type, idx, check_sanity ? 1 : 0, unreachable ? 1 : 0);
                     ++idx;
                 }
-                fprintf(fout, "        }},\n");
+                sanity_check_counts.push_back(sanity_check_count);
+                thing_offset += idx;
+                ++map;
+            }
+        }
+        fprintf(fout, "};\n\n\n");
+
+        // Level infos
+        fprintf(fout, "constexpr ap_level_info_t ap_%s_level_infos[] = {\n", game->codename.c_str());
+        int level_i = 0;
+        for (int ep = 0; ep < game->ep_count; ++ep)
+        {
+            int map = 0;
+            for (const auto& meta : game->episodes[ep])
+            {
+                auto level = get_level({game->name, ep, map});
+                fprintf(fout, "    {\"%s\", {%s, %s, %s}, {%i, %i, %i}, %i, %i, ap_%s_thing_infos + %i, %i},\n", 
+                        level->name.c_str(),
+                        level->keys[0] ? "true" : "false", 
+                        level->keys[1] ? "true" : "false", 
+                        level->keys[2] ? "true" : "false", 
+                        level->use_skull[0] ? 1 : 0, 
+                        level->use_skull[1] ? 1 : 0, 
+                        level->use_skull[2] ? 1 : 0, 
+                        level->location_count,
+                        (int)level->map->things.size(),
+                        game->codename.c_str(),
+                        thing_offsets[level_i],
+                        sanity_check_counts[level_i]);
+                ++level_i;
                 ++map;
             }
-            fprintf(fout, "    },\n");
         }
         fprintf(fout, "};\n\n\n");
 
-        // Item sprites (Used by notification icons)
-        fprintf(fout, "const std::map<int, std::string> ap_%s_type_sprites = {\n", game->codename.c_str());
+        // Episodes
+        fprintf(fout, "// First level and level count of each episode\n");
+        fprintf(fout, "constexpr ap_episode_def_t ap_%s_episodes[] = {\n", game->codename.c_str());
+        level_i = 0;
+        for (int ep = 0; ep < game->ep_count; ++ep)
+        {
+            int map_count = (int)game->episodes[ep].size();
+            fprintf(fout, "    {%i, %i},\n", level_i, map_count);
+            level_i += map_count;
+        }
+        fprintf(fout, "};\n\n\n");
+
+        // Item sprites (Used by notification icons). First one wins if a type is listed twice.
+        std::map<int, std::string> type_sprites;
         for (const auto& item : game->progressions)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.doom_type, item.sprite.c_str());
+            type_sprites.insert({item.doom_type, item.sprite});
         for (const auto& item : game->fillers)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.doom_type, item.sprite.c_str());
+            type_sprites.insert({item.doom_type, item.sprite});
         for (const auto& item : game->unique_progressions)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.doom_type, item.sprite.c_str());
+            type_sprites.insert({item.doom_type, item.sprite});
         for (const auto& item : game->unique_fillers)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.doom_type, item.sprite.c_str());
+            type_sprites.insert({item.doom_type, item.sprite});
         for (const auto& item : game->capacity_upgrades)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.doom_type, item.sprite.c_str());
+            type_sprites.insert({item.doom_type, item.sprite});
         for (const auto& item : game->keys)
-            fprintf(fout, "    {%i, \"%s\"},\n", item.item.doom_type, item.item.sprite.c_str());
+            type_sprites.insert({item.item.doom_type, item.item.sprite});
+        fprintf(fout, "// Item sprites (Used by notification icons), sorted by doom type\n");
+        fprintf(fout, "constexpr ap_type_sprite_t ap_%s_type_sprites[] = {\n", game->codename.c_str());
+        for (const auto& kv : type_sprites)
+            fprintf(fout, "    {%i, \"%s\"},\n", kv.first, kv.second.c_str());
         fprintf(fout, "};\n");
 
-        fclose(fout);
+        close_output(fout, fout_filename);
     }
 
     // We generate some stuff for doom also, C header.
     {
-        FILE* fout = fopen((cpp_out_dir + "ap" + game->codename + "_c_def.h").c_str(), "w");
+        auto fout_filename = cpp_out_dir + "ap" + game->codename + "_c_def.h";
+        FILE* fout = open_output(fout_filename);
+        if (!fout) return 1;
         
         fprintf(fout, "// This file is auto generated. More info: https://github.com/Daivuk/apdoom\n");
         fprintf(fout, "#ifndef _AP_%s_C_DEF_\n", game->codename.c_str());
@@ -907,12 +1059,14 @@ class LocationDict(TypedDict, total=False): \n\
         fprintf(fout, "}\n\n");
 
         fprintf(fout, "#endif\n");
-        fclose(fout);
+        close_output(fout, fout_filename);
     }
 
     // Generate Rules.py from regions.json (Manually entered data)
     {
-        FILE* fout = fopen((py_out_dir + "Rules.py").c_str(), "w");
+        auto fout_filename = py_out_dir + "Rules.py";
+        FILE* fout = open_output(fout_filename);
+        if (!fout) return 1;
         fprintf(fout, "# This file is auto generated. More info: https://github.com/Daivuk/apdoom\n\n");
         fprintf(fout, "from typing import TYPE_CHECKING\n");
         fprintf(fout, "from worlds.generic.Rules import set_rule\n\n");
@@ -1055,12 +1209,14 @@ class LocationDict(TypedDict, total=False): \n\
             fprintf(fout, "        set_episode%i_rules(player, multiworld, pro)\n", ep + 1);
         }
 
-        fclose(fout);
+        close_output(fout, fout_filename);
     }
 
     // Generate location CSV that will be used for names
     {
-        FILE* fout = fopen((pop_tracker_data_dir + game->codename + "_location_names.csv").c_str(), "w");
+        auto fout_filename = pop_tracker_data_dir + game->codename + "_location_names.csv";
+        FILE* fout = open_output(fout_filename);
+        if (!fout) return 1;
 
         fprintf(fout, "Map,Type,Index,Name,Description\n");
 
@@ -1082,7 +1238,7 @@ class LocationDict(TypedDict, total=False): \n\
                 fprintf(fout, "%s,\n", escape_csv(location.description).c_str());
             }
         }
-        fclose(fout);
+        close_output(fout, fout_filename);
     }
 
     // TODO: Pop tracker logic
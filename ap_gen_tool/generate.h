@@ -5,3 +5,5 @@ struct game_t;
 
 
 int generate(game_t* game);
+bool is_headless();
+int generate_headless(); // Generates the games listed after -headless (All if none)
@@ -0,0 +1,657 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+//
+// *Undo/redo history, stored as deltas between map_state_t*
+//
+
+#include "history.h"
+
+#include <onut/Json.h>
+
+#include <algorithm>
+#include <iterator>
+
+
+// In open_world.cpp
+Json::Value serialize_rules(const rule_region_t& rules);
+rule_region_t deserialize_rules(const Json::Value& json);
+
+
+//--- Memory estimates, only used to decide when to trim
+
+static size_t rules_memory(const rule_region_t& rules)
+{
+    size_t memory = rules.connections.size() * sizeof(rule_connection_t);
+    for (const auto& connection : rules.connections)
+        memory += (connection.requirements_or.size() + connection.requirements_and.size()) * sizeof(int);
+    return memory;
+}
+
+
+static size_t region_memory(const region_t& region)
+{
+    // std::set nodes are ~4 pointers + the value
+    return sizeof(region_t) + region.name.size() + region.sectors.size() * (sizeof(int) + 4 * sizeof(void*)) + rules_memory(region.rules);
+}
+
+
+static size_t location_memory(const location_t& location)
+{
+    return sizeof(location_t) + 4 * sizeof(void*) + location.name.size() + location.description.size();
+}
+
+
+static size_t state_memory(const map_state_t& state)
+{
+    size_t memory = sizeof(map_state_t) + state.bbs.size() * sizeof(bb_t) + state.accesses.size() * (sizeof(int) + 4 * sizeof(void*));
+    for (const auto& region : state.regions)
+        memory += region_memory(region);
+    for (const auto& kv : state.locations)
+        memory += location_memory(kv.second);
+    return memory + rules_memory(state.world_rules) + rules_memory(state.exit_rules);
+}
+
+
+static size_t delta_memory(const map_delta_t& delta)
+{
+    size_t memory = sizeof(map_delta_t);
+    for (const auto& region : delta.regions)
+        memory += region_memory(region.before) + region_memory(region.after) + (region.sectors_added.size() + region.sectors_removed.size()) * sizeof(int);
+    memory += (delta.bbs_before.size() + delta.bbs_after.size()) * sizeof(bb_t);
+    memory += rules_memory(delta.world_rules_before) + rules_memory(delta.world_rules_after);
+    memory += rules_memory(delta.exit_rules_before) + rules_memory(delta.exit_rules_after);
+    memory += (delta.accesses_added.size() + delta.accesses_removed.size()) * sizeof(int);
+    for (const auto& location : delta.locations)
+        memory += location_memory(location.before) + location_memory(location.after);
+    if (delta.keyframe)
+        memory += state_memory(*delta.keyframe);
+    return memory;
+}
+
+
+//--- Diff/apply
+
+static region_t without_sectors(const region_t& region)
+{
+    region_t ret;
+    ret.name = region.name;
+    ret.tint = region.tint;
+    ret.rules = region.rules;
+    return ret;
+}
+
+
+// Returns false if nothing changed
+static bool make_delta(const map_state_t& a, const map_state_t& b, map_delta_t* delta)
+{
+    bool changed = false;
+
+    delta->pos_before = a.pos; delta->pos_after = b.pos;
+    delta->angle_before = a.angle; delta->angle_after = b.angle;
+    delta->selected_bb_before = a.selected_bb; delta->selected_bb_after = b.selected_bb;
+    delta->selected_region_before = a.selected_region; delta->selected_region_after = b.selected_region;
+    delta->selected_location_before = a.selected_location; delta->selected_location_after = b.selected_location;
+    changed |= a.pos.x != b.pos.x || a.pos.y != b.pos.y || a.angle != b.angle ||
+               a.selected_bb != b.selected_bb ||
+               a.selected_region != b.selected_region ||
+               a.selected_location != b.selected_location;
+
+    static const std::set<int> no_sectors;
+    delta->region_count_before = (int)a.regions.size();
+    delta->region_count_after = (int)b.regions.size();
+    for (int i = 0, len = std::max(delta->region_count_before, delta->region_count_after); i < len; ++i)
+    {
+        region_delta_t region_delta;
+        region_delta.index = i;
+        region_delta.before_exists = i < delta->region_count_before;
+        region_delta.after_exists = i < delta->region_count_after;
+        if (region_delta.before_exists && region_delta.after_exists && a.regions[i] == b.regions[i])
+            continue;
+
+        const auto& sectors_before = region_delta.before_exists ? a.regions[i].sectors : no_sectors;
+        const auto& sectors_after = region_delta.after_exists ? b.regions[i].sectors : no_sectors;
+        if (region_delta.before_exists) region_delta.before = without_sectors(a.regions[i]);
+        if (region_delta.after_exists) region_delta.after = without_sectors(b.regions[i]);
+        std::set_difference(sectors_after.begin(), sectors_after.end(), sectors_before.begin(), sectors_before.end(), std::back_inserter(region_delta.sectors_added));
+        std::set_difference(sectors_before.begin(), sectors_before.end(), sectors_after.begin(), sectors_after.end(), std::back_inserter(region_delta.sectors_removed));
+        delta->regions.push_back(std::move(region_delta));
+        changed = true;
+    }
+
+    if (!(a.bbs == b.bbs))
+    {
+        delta->bbs_changed = true;
+        delta->bbs_before = a.bbs;
+        delta->bbs_after = b.bbs;
+        changed = true;
+    }
+
+    if (!(a.world_rules == b.world_rules))
+    {
+        delta->world_rules_changed = true;
+        delta->world_rules_before = a.world_rules;
+        delta->world_rules_after = b.world_rules;
+        changed = true;
+    }
+
+    if (!(a.exit_rules == b.exit_rules))
+    {
+        delta->exit_rules_changed = true;
+        delta->exit_rules_before = a.exit_rules;
+        delta->exit_rules_after = b.exit_rules;
+        changed = true;
+    }
+
+    std::set_difference(b.accesses.begin(), b.accesses.end(), a.accesses.begin(), a.accesses.end(), std::back_inserter(delta->accesses_added));
+    std::set_difference(a.accesses.begin(), a.accesses.end(), b.accesses.begin(), b.accesses.end(), std::back_inserter(delta->accesses_removed));
+    changed |= !delta->accesses_added.empty() || !delta->accesses_removed.empty();
+
+    // Both maps are sorted by thing index, walk them side by side
+    auto it_a = a.locations.begin();
+    auto it_b = b.locations.begin();
+    while (it_a != a.locations.end() || it_b != b.locations.end())
+    {
+        location_delta_t location_delta;
+        if (it_b == b.locations.end() || (it_a != a.locations.end() && it_a->first < it_b->first))
+        {
+            location_delta.index = it_a->first;
+            location_delta.before_exists = true;
+            location_delta.before = it_a->second;
+            ++it_a;
+        }
+        else if (it_a == a.locations.end() || it_b->first < it_a->first)
+        {
+            location_delta.index = it_b->first;
+            location_delta.after_exists = true;
+            location_delta.after = it_b->second;
+            ++it_b;
+        }
+        else
+        {
+            if (it_a->second == it_b->second && it_a->second.check_sanity == it_b->second.check_sanity)
+            {
+                ++it_a;
+                ++it_b;
+                continue;
+            }
+            location_delta.index = it_a->first;
+            location_delta.before_exists = true;
+            location_delta.after_exists = true;
+            location_delta.before = it_a->second;
+            location_delta.after = it_b->second;
+            ++it_a;
+            ++it_b;
+        }
+        delta->locations.push_back(std::move(location_delta));
+        changed = true;
+    }
+
+    return changed;
+}
+
+
+static void apply_delta(map_state_t* state, const map_delta_t& delta, bool forward)
+{
+    state->pos = forward ? delta.pos_after : delta.pos_before;
+    state->angle = forward ? delta.angle_after : delta.angle_before;
+    state->selected_bb = forward ? delta.selected_bb_after : delta.selected_bb_before;
+    state->selected_region = forward ? delta.selected_region_after : delta.selected_region_before;
+    state->selected_location = forward ? delta.selected_location_after : delta.selected_location_before;
+
+    state->regions.resize(forward ? delta.region_count_after : delta.region_count_before);
+    for (const auto& region_delta : delta.regions)
+    {
+        if (!(forward ? region_delta.after_exists : region_delta.before_exists)) continue;
+        auto& region = state->regions[region_delta.index];
+        const auto& src = forward ? region_delta.after : region_delta.before;
+        region.name = src.name;
+        region.tint = src.tint;
+        region.rules = src.rules;
+        for (auto sectori : forward ? region_delta.sectors_removed : region_delta.sectors_added)
+            region.sectors.erase(sectori);
+        for (auto sectori : forward ? region_delta.sectors_added : region_delta.sectors_removed)
+            region.sectors.insert(sectori);
+    }
+
+    if (delta.bbs_changed) state->bbs = forward ? delta.bbs_after : delta.bbs_before;
+    if (delta.world_rules_changed) state->world_rules = forward ? delta.world_rules_after : delta.world_rules_before;
+    if (delta.exit_rules_changed) state->exit_rules = forward ? delta.exit_rules_after : delta.exit_rules_before;
+
+    for (auto access : forward ? delta.accesses_removed : delta.accesses_added)
+        state->accesses.erase(access);
+    for (auto access : forward ? delta.accesses_added : delta.accesses_removed)
+        state->accesses.insert(access);
+
+    for (const auto& location_delta : delta.locations)
+    {
+        if (forward ? location_delta.after_exists : location_delta.before_exists)
+            state->locations[location_delta.index] = forward ? location_delta.after : location_delta.before;
+        else
+            state->locations.erase(location_delta.index);
+    }
+}
+
+
+//--- History
+
+void history_reset(map_history_t* history, const map_state_t& state)
+{
+    history->initialized = true;
+    history->base = state;
+    history->last = state;
+    history->deltas.clear();
+    history->history_point = 0;
+    history->memory = 2 * state_memory(state);
+}
+
+
+// Drops the oldest deltas up to a keyframe, which becomes the new base.
+// Never trims what undo can still reach from the current point if that's
+// all there is.
+static void trim(map_history_t* history)
+{
+    while (history->memory > UNDO_MEMORY_CAP)
+    {
+        int drop = -1;
+        for (int i = 0; i < history->history_point; ++i)
+        {
+            if (history->deltas[i].keyframe)
+            {
+                drop = i;
+                break;
+            }
+        }
+        if (drop == -1) return;
+
+        history->memory -= state_memory(history->base);
+        history->base = *history->deltas[drop].keyframe;
+        history->memory += state_memory(history->base);
+        for (int i = 0; i <= drop; ++i)
+            history->memory -= history->deltas[i].memory;
+        history->deltas.erase(history->deltas.begin(), history->deltas.begin() + (drop + 1));
+        history->history_point -= drop + 1;
+    }
+}
+
+
+static void add_delta(map_history_t* history, map_delta_t&& delta)
+{
+    apply_delta(&history->last, delta, true);
+    history->deltas.push_back(std::move(delta));
+    history->history_point = (int)history->deltas.size();
+
+    // Base counts as the keyframe before deltas[0]
+    int last_keyframe = -1;
+    for (int i = history->history_point - 2; i >= 0; --i)
+    {
+        if (history->deltas[i].keyframe)
+        {
+            last_keyframe = i;
+            break;
+        }
+    }
+    auto& added = history->deltas.back();
+    if (history->history_point - 1 - last_keyframe >= UNDO_KEYFRAME_INTERVAL)
+        added.keyframe = std::make_shared<map_state_t>(history->last);
+    added.memory = delta_memory(added);
+    history->memory += added.memory;
+}
+
+
+void history_push(map_history_t* history, const map_state_t& state)
+{
+    if (!history->initialized)
+    {
+        history_reset(history, state);
+        return;
+    }
+
+    map_delta_t delta;
+    if (!make_delta(history->last, state, &delta)) return;
+
+    // New edit, redo branch is gone
+    for (int i = history->history_point; i < (int)history->deltas.size(); ++i)
+        history->memory -= history->deltas[i].memory;
+    history->deltas.erase(history->deltas.begin() + history->history_point, history->deltas.end());
+
+    add_delta(history, std::move(delta));
+    trim(history);
+}
+
+
+// Edits that were never pushed aren't in any delta. Stepping over them
+// would leave them in, so they're dropped first, part by part.
+static void drop_unrecorded(const map_history_t* history, map_state_t* state)
+{
+    map_delta_t unrecorded;
+    if (make_delta(history->last, *state, &unrecorded))
+        apply_delta(state, unrecorded, false);
+}
+
+
+bool history_undo(map_history_t* history, map_state_t* state)
+{
+    if (history->history_point <= 0) return false;
+    drop_unrecorded(history, state);
+    const auto& delta = history->deltas[--history->history_point];
+    apply_delta(&history->last, delta, false);
+    apply_delta(state, delta, false);
+    return true;
+}
+
+
+bool history_redo(map_history_t* history, map_state_t* state)
+{
+    if (history->history_point >= (int)history->deltas.size()) return false;
+    drop_unrecorded(history, state);
+    const auto& delta = history->deltas[history->history_point++];
+    apply_delta(&history->last, delta, true);
+    apply_delta(state, delta, true);
+    return true;
+}
+
+
+//--- Persistence
+
+static Json::Value serialize_ints(const std::vector<int>& values)
+{
+    Json::Value json(Json::arrayValue);
+    for (auto value : values)
+        json.append(value);
+    return json;
+}
+
+
+static std::vector<int> deserialize_ints(const Json::Value& json)
+{
+    std::vector<int> values;
+    for (const auto& value_json : json)
+        values.push_back(value_json.asInt());
+    return values;
+}
+
+
+static Json::Value serialize_region(const region_t& region)
+{
+    Json::Value json;
+    json["name"] = region.name;
+    json["tint"] = onut::serializeFloat4(&region.tint.r);
+    json["sectors"] = serialize_ints(std::vector<int>(region.sectors.begin(), region.sectors.end()));
+    json["rules"] = serialize_rules(region.rules);
+    return json;
+}
+
+
+static region_t deserialize_region(const Json::Value& json)
+{
+    region_t region;
+    region.name = json.get("name", "BAD_NAME").asString();
+    onut::deserializeFloat4(&region.tint.r, json["tint"]);
+    for (auto sectori : deserialize_ints(json["sectors"]))
+        region.sectors.insert(sectori);
+    region.rules = deserialize_rules(json["rules"]);
+    return region;
+}
+
+
+static Json::Value serialize_location(const location_t& location)
+{
+    Json::Value json;
+    json["death_logic"] = location.death_logic;
+    json["unreachable"] = location.unreachable;
+    json["check_sanity"] = location.check_sanity;
+    json["name"] = location.name;
+    json["description"] = location.description;
+    return json;
+}
+
+
+static location_t deserialize_location(const Json::Value& json)
+{
+    location_t location;
+    location.death_logic = json["death_logic"].asBool();
+    location.unreachable = json["unreachable"].asBool();
+    location.check_sanity = json["check_sanity"].asBool();
+    location.name = json["name"].asString();
+    location.description = json["description"].asString();
+    return location;
+}
+
+
+static Json::Value serialize_bbs(const std::vector<bb_t>& bbs)
+{
+    Json::Value json(Json::arrayValue);
+    for (const auto& bb : bbs)
+        json.append(serialize_ints({bb.x1, bb.y1, bb.x2, bb.y2, bb.region}));
+    return json;
+}
+
+
+static std::vector<bb_t> deserialize_bbs(const Json::Value& json)
+{
+    std::vector<bb_t> bbs;
+    for (const auto& bb_json : json)
+        bbs.push_back({bb_json[0].asInt(), bb_json[1].asInt(), bb_json[2].asInt(), bb_json[3].asInt(), bb_json[4].asInt()});
+    return bbs;
+}
+
+
+static Json::Value serialize_state(const map_state_t& state)
+{
+    Json::Value json;
+    json["pos"] = serialize_ints({(int)state.pos.x, (int)state.pos.y});
+    json["angle"] = state.angle;
+    json["selected"] = serialize_ints({state.selected_bb, state.selected_region, state.selected_location});
+    json["bbs"] = serialize_bbs(state.bbs);
+
+    Json::Value regions_json(Json::arrayValue);
+    for (const auto& region : state.regions)
+        regions_json.append(serialize_region(region));
+    json["regions"] = regions_json;
+
+    json["world_rules"] = serialize_rules(state.world_rules);
+    json["exit_rules"] = serialize_rules(state.exit_rules);
+    json["accesses"] = serialize_ints(std::vector<int>(state.accesses.begin(), state.accesses.end()));
+
+    Json::Value locations_json(Json::arrayValue);
+    for (const auto& kv : state.locations)
+    {
+        auto location_json = serialize_location(kv.second);
+        location_json["index"] = kv.first;
+        locations_json.append(location_json);
+    }
+    json["locations"] = locations_json;
+    return json;
+}
+
+
+static map_state_t deserialize_state(const Json::Value& json)
+{
+    map_state_t state;
+    state.pos = Vector2((float)json["pos"][0].asInt(), (float)json["pos"][1].asInt());
+    state.angle = json["angle"].asFloat();
+    state.selected_bb = json["selected"][0].asInt();
+    state.selected_region = json["selected"][1].asInt();
+    state.selected_location = json["selected"][2].asInt();
+    state.bbs = deserialize_bbs(json["bbs"]);
+    for (const auto& region_json : json["regions"])
+        state.regions.push_back(deserialize_region(region_json));
+    state.world_rules = deserialize_rules(json["world_rules"]);
+    state.exit_rules = deserialize_rules(json["exit_rules"]);
+    for (auto access : deserialize_ints(json["accesses"]))
+        state.accesses.insert(access);
+    for (const auto& location_json : json["locations"])
+        state.locations[location_json["index"].asInt()] = deserialize_location(location_json);
+    return state;
+}
+
+
+static Json::Value serialize_delta(const map_delta_t& delta)
+{
+    Json::Value json;
+    json["pos"] = serialize_ints({(int)delta.pos_before.x, (int)delta.pos_before.y, (int)delta.pos_after.x, (int)delta.pos_after.y});
+    json["angle"].append(delta.angle_before);
+    json["angle"].append(delta.angle_after);
+    json["selected"] = serialize_ints({
+        delta.selected_bb_before, delta.selected_bb_after,
+        delta.selected_region_before, delta.selected_region_after,
+        delta.selected_location_before, delta.selected_location_after});
+    json["region_count"] = serialize_ints({delta.region_count_before, delta.region_count_after});
+
+    Json::Value regions_json(Json::arrayValue);
+    for (const auto& region_delta : delta.regions)
+    {
+        Json::Value region_json;
+        region_json["index"] = region_delta.index;
+        if (region_delta.before_exists) region_json["before"] = serialize_region(region_delta.before);
+        if (region_delta.after_exists) region_json["after"] = serialize_region(region_delta.after);
+        region_json["added"] = serialize_ints(region_delta.sectors_added);
+        region_json["removed"] = serialize_ints(region_delta.sectors_removed);
+        regions_json.append(region_json);
+    }
+    json["regions"] = regions_json;
+
+    if (delta.bbs_changed)
+    {
+        json["bbs_before"] = serialize_bbs(delta.bbs_before);
+        json["bbs_after"] = serialize_bbs(delta.bbs_after);
+    }
+    if (delta.world_rules_changed)
+    {
+        json["world_rules_before"] = serialize_rules(delta.world_rules_before);
+        json["world_rules_after"] = serialize_rules(delta.world_rules_after);
+    }
+    if (delta.exit_rules_changed)
+    {
+        json["exit_rules_before"] = serialize_rules(delta.exit_rules_before);
+        json["exit_rules_after"] = serialize_rules(delta.exit_rules_after);
+    }
+    json["accesses_added"] = serialize_ints(delta.accesses_added);
+    json["accesses_removed"] = serialize_ints(delta.accesses_removed);
+
+    Json::Value locations_json(Json::arrayValue);
+    for (const auto& location_delta : delta.locations)
+    {
+        Json::Value location_json;
+        location_json["index"] = location_delta.index;
+        if (location_delta.before_exists) location_json["before"] = serialize_location(location_delta.before);
+        if (location_delta.after_exists) location_json["after"] = serialize_location(location_delta.after);
+        locations_json.append(location_json);
+    }
+    json["locations"] = locations_json;
+    return json;
+}
+
+
+static map_delta_t deserialize_delta(const Json::Value& json)
+{
+    map_delta_t delta;
+    delta.pos_before = Vector2((float)json["pos"][0].asInt(), (float)json["pos"][1].asInt());
+    delta.pos_after = Vector2((float)json["pos"][2].asInt(), (float)json["pos"][3].asInt());
+    delta.angle_before = json["angle"][0].asFloat();
+    delta.angle_after = json["angle"][1].asFloat();
+    delta.selected_bb_before = json["selected"][0].asInt();
+    delta.selected_bb_after = json["selected"][1].asInt();
+    delta.selected_region_before = json["selected"][2].asInt();
+    delta.selected_region_after = json["selected"][3].asInt();
+    delta.selected_location_before = json["selected"][4].asInt();
+    delta.selected_location_after = json["selected"][5].asInt();
+    delta.region_count_before = json["region_count"][0].asInt();
+    delta.region_count_after = json["region_count"][1].asInt();
+
+    for (const auto& region_json : json["regions"])
+    {
+        region_delta_t region_delta;
+        region_delta.index = region_json["index"].asInt();
+        region_delta.before_exists = region_json.isMember("before");
+        region_delta.after_exists = region_json.isMember("after");
+        if (region_delta.before_exists) region_delta.before = deserialize_region(region_json["before"]);
+        if (region_delta.after_exists) region_delta.after = deserialize_region(region_json["after"]);
+        region_delta.sectors_added = deserialize_ints(region_json["added"]);
+        region_delta.sectors_removed = deserialize_ints(region_json["removed"]);
+        delta.regions.push_back(std::move(region_delta));
+    }
+
+    delta.bbs_changed = json.isMember("bbs_before");
+    if (delta.bbs_changed)
+    {
+        delta.bbs_before = deserialize_bbs(json["bbs_before"]);
+        delta.bbs_after = deserialize_bbs(json["bbs_after"]);
+    }
+    delta.world_rules_changed = json.isMember("world_rules_before");
+    if (delta.world_rules_changed)
+    {
+        delta.world_rules_before = deserialize_rules(json["world_rules_before"]);
+        delta.world_rules_after = deserialize_rules(json["world_rules_after"]);
+    }
+    delta.exit_rules_changed = json.isMember("exit_rules_before");
+    if (delta.exit_rules_changed)
+    {
+        delta.exit_rules_before = deserialize_rules(json["exit_rules_before"]);
+        delta.exit_rules_after = deserialize_rules(json["exit_rules_after"]);
+    }
+    delta.accesses_added = deserialize_ints(json["accesses_added"]);
+    delta.accesses_removed = deserialize_ints(json["accesses_removed"]);
+
+    for (const auto& location_json : json["locations"])
+    {
+        location_delta_t location_delta;
+        location_delta.index = location_json["index"].asInt();
+        location_delta.before_exists = location_json.isMember("before");
+        location_delta.after_exists = location_json.isMember("after");
+        if (location_delta.before_exists) location_delta.before = deserialize_location(location_json["before"]);
+        if (location_delta.after_exists) location_delta.after = deserialize_location(location_json["after"]);
+        delta.locations.push_back(std::move(location_delta));
+    }
+    return delta;
+}
+
+
+Json::Value serialize_history(const map_history_t& history)
+{
+    Json::Value json;
+    json["point"] = history.history_point;
+    json["base"] = serialize_state(history.base);
+    Json::Value deltas_json(Json::arrayValue);
+    for (const auto& delta : history.deltas)
+        deltas_json.append(serialize_delta(delta));
+    json["deltas"] = deltas_json;
+    return json;
+}
+
+
+bool deserialize_history(map_history_t* history, const Json::Value& json, const map_state_t& current)
+{
+    const auto& deltas_json = json["deltas"];
+    int point = json["point"].asInt();
+    if (point < 0 || point > (int)deltas_json.size()) return false;
+
+    history_reset(history, deserialize_state(json["base"]));
+    for (const auto& delta_json : deltas_json)
+        add_delta(history, deserialize_delta(delta_json));
+    while (history->history_point > point)
+    {
+        history->history_point--;
+        apply_delta(&history->last, history->deltas[history->history_point], false);
+    }
+
+    // The map file was edited outside the tool, this history is for another state
+    if (!(history->last == current))
+    {
+        history_reset(history, current);
+        return false;
+    }
+    trim(history);
+    return true;
+}
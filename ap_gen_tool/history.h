@@ -0,0 +1,20 @@
+#pragma once
+
+#include <json/json.h>
+
+#include "data.h"
+
+
+#define UNDO_KEYFRAME_INTERVAL 64 // Full state kept every N deltas, history is trimmed at keyframes
+#define UNDO_MEMORY_CAP (16 * 1024 * 1024) // Per map, oldest keyframe intervals are dropped past it
+
+
+void history_reset(map_history_t* history, const map_state_t& state);
+void history_push(map_history_t* history, const map_state_t& state); // Records what changed since the last push
+bool history_undo(map_history_t* history, map_state_t* state);
+bool history_redo(map_history_t* history, map_state_t* state);
+
+// Persisted as the base keyframe plus every delta. Deserializing replays the
+// deltas and gives up (Returns false) if they don't land on current.
+Json::Value serialize_history(const map_history_t& history);
+bool deserialize_history(map_history_t* history, const Json::Value& json, const map_state_t& current);
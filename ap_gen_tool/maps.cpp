@@ -8,9 +8,23 @@
 
 #include <stdio.h>
 #include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <thread>
+#include <unordered_map>
+
+#if defined(WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "data.h"
 #include "defs.h"
+#include "parallel.h"
 
 
 // For earcut to work
@@ -70,24 +84,98 @@ struct post_t
 };
 
 
+// The whole WAD mapped read-only. Lumps are copied straight out of it.
+class wad_file_t
+{
+public:
+    bool open(const char* filename)
+    {
+#if defined(WIN32)
+        m_file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(m_file, &size) || size.QuadPart == 0) return false;
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mapping) return false;
+        m_data = (const uint8_t*)MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+        m_size = (size_t)size.QuadPart;
+#else
+        int fd = ::open(filename, O_RDONLY);
+        if (fd == -1) return false;
+        struct stat st;
+        if (fstat(fd, &st) == -1 || st.st_size == 0)
+        {
+            close(fd);
+            return false;
+        }
+        void* data = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd); // The mapping keeps its own reference
+        if (data == MAP_FAILED) return false;
+        m_data = (const uint8_t*)data;
+        m_size = (size_t)st.st_size;
+#endif
+        return m_data != nullptr;
+    }
+
+    ~wad_file_t()
+    {
+#if defined(WIN32)
+        if (m_data) UnmapViewOfFile(m_data);
+        if (m_mapping) CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+#else
+        if (m_data) munmap((void*)m_data, m_size);
+#endif
+    }
+
+    // nullptr if the range is outside the file
+    const uint8_t* get(int32_t offset, int32_t size) const
+    {
+        if (offset < 0 || size < 0 || (size_t)offset + (size_t)size > m_size) return nullptr;
+        return m_data + offset;
+    }
+
+private:
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+#if defined(WIN32)
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#endif
+};
+
+
 template<typename T>
 static bool try_load_lump(const char *lump_name, 
-                          FILE *f, 
+                          const wad_file_t& wad, 
                           const map_directory_t &dir_entry, 
                           std::vector<T> &elements)
 {
     if (strncmp(dir_entry.name, lump_name, 8) == 0)
     {
         auto count = dir_entry.size / sizeof(T);
+        auto data = wad.get(dir_entry.offset, (int32_t)(count * sizeof(T)));
+        if (!data) count = 0;
         elements.resize(count);
-        fseek(f, dir_entry.offset, SEEK_SET);
-        fread(elements.data(), sizeof(T), count, f);
+        if (count) memcpy(elements.data(), data, count * sizeof(T));
         return true;
     }
     return false;
 }
 
 
+static uint64_t fnv1a(const void* data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    auto bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+
 int FixedMul(int a, int b)
 {
     return ((int64_t) a * (int64_t) b) >> 16;
@@ -167,13 +255,6 @@ subsector_t* point_in_subsector(int x, int y, map_t* map)
 }
 
 
-struct wall_t
-{
-    int v1, v2;
-    int sector;
-};
-
-
 static void create_wall(std::vector<wall_t>& map_walls, map_t* map, int16_t linedef_idx, int16_t sidedef_idx)
 {
     const auto &linedef = map->linedefs[linedef_idx];
@@ -203,33 +284,41 @@ static void create_wall(std::vector<wall_t>& map_walls, map_t* map, int16_t line
 static void triangulate_sector(const std::vector<wall_t>& map_walls, map_t* map, int sectori)
 {
     auto& sector = map->sectors[sectori];
-
-    std::vector<int> wall_idx_remaining(sector.walls.size());
-    for (int i = 0, len = (int)sector.walls.size(); i < len; ++i)
-        wall_idx_remaining[i] = i;
+    int wall_count = (int)sector.walls.size();
+
+    // Walls by end vertex. Each bucket is in wall order, so picking the first
+    // unused one gives the same loops as scanning all remaining walls did.
+    std::unordered_map<int, std::vector<int>> walls_by_v2;
+    walls_by_v2.reserve(wall_count);
+    for (int i = 0; i < wall_count; ++i)
+        walls_by_v2[map_walls[sector.walls[i]].v2].push_back(i);
+    std::vector<bool> used(wall_count, false);
+    int remaining = wall_count;
+    int next_unused = 0;
 
     // Build loops
     std::vector<std::vector<int>> loops;
-    while (wall_idx_remaining.size() >= 3)
+    while (remaining >= 3)
     {
         // Pick first line, and try to build a loop
-        std::vector<int> loop = { wall_idx_remaining[0] };
-        wall_idx_remaining.erase(wall_idx_remaining.begin());
+        while (used[next_unused]) ++next_unused;
+        std::vector<int> loop = { next_unused };
+        used[next_unused] = true;
+        --remaining;
         while (true)
         {
             auto previous = loop[(int)loop.size() - 1];
+            auto it = walls_by_v2.find(map_walls[sector.walls[previous]].v1);
+            if (it == walls_by_v2.end()) break;
             bool found = false;
-            for (int i = 0, len = (int)wall_idx_remaining.size(); i < len; ++i)
+            for (auto idx : it->second)
             {
-                auto idx = wall_idx_remaining[i];
-                const auto &wall = map_walls[sector.walls[idx]];
-                if (map_walls[sector.walls[previous]].v1 == wall.v2)
-                {
-                    loop.push_back(idx);
-                    wall_idx_remaining.erase(wall_idx_remaining.begin() + i);
-                    found = true;
-                    break;
-                }
+                if (used[idx]) continue;
+                loop.push_back(idx);
+                used[idx] = true;
+                --remaining;
+                found = true;
+                break;
             }
             if (!found) break;
         }
@@ -304,26 +393,24 @@ static void triangulate_sector(const std::vector<wall_t>& map_walls, map_t* map,
 }
 
 
-std::vector<uint8_t> load_lump(const std::vector<map_directory_t>& directory, const char* lump_name, FILE* f)
+std::vector<uint8_t> load_lump(const std::vector<map_directory_t>& directory, const char* lump_name, const wad_file_t& wad)
 {
     for (const auto& dir_entry : directory)
     {
         if (strncmp(dir_entry.name, lump_name, 8) == 0)
         {
-            std::vector<uint8_t> ret;
-            ret.resize(dir_entry.size);
-            fseek(f, dir_entry.offset, SEEK_SET);
-            fread(ret.data(), 1, dir_entry.size, f);
-            return ret;
+            auto data = wad.get(dir_entry.offset, dir_entry.size);
+            if (!data) return {};
+            return std::vector<uint8_t>(data, data + dir_entry.size);
         }
     }
     return {};
 }
 
 
-OTextureRef load_sprite(const std::vector<map_directory_t>& directory, const char* lump_name, FILE* f, const uint8_t* pal)
+OTextureRef load_sprite(const std::vector<map_directory_t>& directory, const char* lump_name, const wad_file_t& wad, const uint8_t* pal)
 {
-    auto raw_data = load_lump(directory, lump_name, f);
+    auto raw_data = load_lump(directory, lump_name, wad);
     if (raw_data.empty()) return nullptr;
 
     patch_header_t header;
@@ -512,11 +599,167 @@ Color get_color_for_line_type(int special)
 }
 
 
+// Built once per map, the reachability solver walks it for every check.
+static void build_sector_links(map_t* map)
+{
+    int sector_count = (int)map->map_sectors.size();
+    std::vector<std::vector<int>> neighbors(sector_count);
+    for (const auto& linedef : map->linedefs)
+    {
+        if (linedef.front_sidedef < 0 || linedef.back_sidedef < 0) continue; // One-sided
+        if (linedef.front_sidedef >= (int)map->sidedefs.size() || linedef.back_sidedef >= (int)map->sidedefs.size()) continue;
+        int front = map->sidedefs[linedef.front_sidedef].sector;
+        int back = map->sidedefs[linedef.back_sidedef].sector;
+        if (front == back) continue;
+        if (front < 0 || front >= sector_count || back < 0 || back >= sector_count) continue;
+        neighbors[front].push_back(back);
+        neighbors[back].push_back(front);
+    }
+
+    map->sector_link_offsets.resize(sector_count + 1);
+    map->sector_links.clear();
+    for (int i = 0; i < sector_count; ++i)
+    {
+        auto& list = neighbors[i];
+        std::sort(list.begin(), list.end());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+        map->sector_link_offsets[i] = (int)map->sector_links.size();
+        map->sector_links.insert(map->sector_links.end(), list.begin(), list.end());
+    }
+    map->sector_link_offsets[sector_count] = (int)map->sector_links.size();
+}
+
+
+// Everything past the raw lumps only touches this map, so maps can be built
+// concurrently.
+static void build_map(map_t* map)
+{
+    map->sectors.resize(map->map_sectors.size());
+    map->subsectors.resize(map->map_subsectors.size());
+    map->nodes.resize(map->map_nodes.size());
+    for (int j = 0, lenj = (int)map->map_nodes.size(); j < lenj; ++j)
+    {
+        map->nodes[j].x = (int16_t)map->map_nodes[j].x << 16;
+        map->nodes[j].y = (int16_t)map->map_nodes[j].y << 16;
+        map->nodes[j].dx = (int16_t)map->map_nodes[j].dx << 16;
+        map->nodes[j].dy = (int16_t)map->map_nodes[j].dy << 16;
+        for (int jj = 0; jj < 2; ++jj)
+        {
+            map->nodes[j].children[jj] = (uint16_t)(int16_t)map->map_nodes[j].children[jj];
+            if (map->nodes[j].children[jj] == NO_INDEX)
+                map->nodes[j].children[jj] = -1;
+            else if (map->nodes[j].children[jj] & NF_SUBSECTOR_VANILLA)
+            {
+                map->nodes[j].children[jj] &= ~NF_SUBSECTOR_VANILLA;
+                if (map->nodes[j].children[jj] >= (int)map->map_subsectors.size())
+                    map->nodes[j].children[jj] = 0;
+                map->nodes[j].children[jj] |= NF_SUBSECTOR;
+            }
+            for (int k = 0; k < 4; ++k)
+                map->nodes[j].bbox[jj][k] = (int16_t)map->map_nodes[j].bbox[jj][k] << 16;
+        }
+    }
+
+    map->segs.resize(map->map_segs.size());
+    for (int j = 0, lenj = (int)map->map_segs.size(); j < lenj; ++j)
+    {
+        const auto& map_seg = map->map_segs[j];
+        auto& seg = map->segs[j];
+        int side = map_seg.side;
+        seg.sidedef = (&(map->linedefs[map_seg.linedef].front_sidedef))[side];
+        seg.front_sector = map->sidedefs[seg.sidedef].sector;
+    }
+
+    build_sector_links(map);
+
+    // Assign sector to subsector
+    for (int j = 0, lenj = (int)map->map_subsectors.size(); j < lenj; ++j)
+    {
+        const auto& seg = map->segs[map->map_subsectors[j].firstseg];
+        //const auto& map_sidedef = map->sidedefs[seg.sidedef];
+        map->subsectors[j].sector = seg.front_sector;
+    }
+
+    map->bb[0] = map->vertexes[0].x;
+    map->bb[1] = map->vertexes[0].y;
+    map->bb[2] = map->vertexes[0].x;
+    map->bb[3] = map->vertexes[0].y;
+    for (int v = 1, vlen = (int)map->vertexes.size(); v < vlen; ++v)
+    {
+        map->bb[0] = std::min(map->bb[0], map->vertexes[v].x);
+        map->bb[1] = std::min(map->bb[1], map->vertexes[v].y);
+        map->bb[2] = std::max(map->bb[2], map->vertexes[v].x);
+        map->bb[3] = std::max(map->bb[3], map->vertexes[v].y);
+    }
+
+    // Create "walls" used in triangulation step
+    for (int j = 0; j < (int)map->linedefs.size(); ++j)
+    {
+        const auto &linedef = map->linedefs[j];
+
+        if (linedef.front_sidedef != -1)
+            create_wall(map->walls, map, j, linedef.front_sidedef);
+        if (linedef.back_sidedef != -1)
+            create_wall(map->walls, map, j, linedef.back_sidedef);
+    }
+
+    // Triangulation itself is deferred, see triangulate_map()
+    uint64_t hash = fnv1a(map->linedefs.data(), map->linedefs.size() * sizeof(map_linedefs_t));
+    hash = fnv1a(map->sidedefs.data(), map->sidedefs.size() * sizeof(map_sidedefs_t), hash);
+    hash = fnv1a(map->vertexes.data(), map->vertexes.size() * sizeof(map_vertex_t), hash);
+    map->geometry_hash = fnv1a(map->map_sectors.data(), map->map_sectors.size() * sizeof(map_sectors_t), hash);
+    map->triangulation = std::make_shared<triangulation_t>();
+
+    // Create arrows
+    for (int j = 0; j < (int)map->linedefs.size(); ++j)
+    {
+        const auto& line_def = map->linedefs[j];
+        if (line_def.special_type != 0 && line_def.sector_tag != 0)
+        {
+            arrow_t arrow;
+            arrow.color = get_color_for_line_type(line_def.special_type);
+            const auto& v1 = map->vertexes[line_def.start_vertex];
+            const auto& v2 = map->vertexes[line_def.end_vertex];
+            arrow.from = {
+                (float)(v1.x + v2.x) * 0.5f,
+                -(float)(v1.y + v2.y) * 0.5f
+            };
+            for (int k = 0; k < (int)map->map_sectors.size(); ++k)
+            {
+                const auto& map_sector = map->map_sectors[k];
+                if (map_sector.tag == line_def.sector_tag)
+                {
+                    // Outline bounds, triangles might not be built yet
+                    Vector2 bbmin, bbmax;
+                    const auto& sector = map->sectors[k];
+                    if (sector.walls.size() < 3) continue;
+                    bbmin = {
+                        (float)map->vertexes[map->walls[sector.walls[0]].v1].x,
+                        -(float)map->vertexes[map->walls[sector.walls[0]].v1].y
+                    };
+                    bbmax = bbmin;
+                    for (int l = 1; l < (int)sector.walls.size(); ++l)
+                    {
+                        Vector2 pt = {
+                            (float)map->vertexes[map->walls[sector.walls[l]].v1].x,
+                            -(float)map->vertexes[map->walls[sector.walls[l]].v1].y
+                        };
+                        bbmin = onut::min(bbmin, pt);
+                        bbmax = onut::max(bbmax, pt);
+                    }
+                    arrow.to = (bbmin + bbmax) * 0.5f;
+                    map->arrows.push_back(arrow);
+                }
+            }
+        }
+    }
+}
+
 void init_wad(const char* filename, game_t& game)
 {
     // Load DOOM.WAD
-    FILE* f = fopen(filename, "rb");
-    if (!f)
+    wad_file_t wad;
+    if (!wad.open(filename))
     {
         onut::showMessageBox("Error", std::string("Cannot open file: ") + filename);
         exit(1); // Hard kill
@@ -524,20 +767,29 @@ void init_wad(const char* filename, game_t& game)
     
     // Read header
     map_header_t header;
-    fread(&header, sizeof(header), 1, f);
-    if (strncmp(header.identification, "PWAD", 4) != 0 && strncmp(header.identification, "IWAD", 4) != 0)
+    auto header_data = wad.get(0, sizeof(header));
+    if (header_data) memcpy(&header, header_data, sizeof(header));
+    if (!header_data || (strncmp(header.identification, "PWAD", 4) != 0 && strncmp(header.identification, "IWAD", 4) != 0))
     {
         onut::showMessageBox("Error", std::string("Invalid IWAD or PWAD: ") + filename);
         exit(1); // Hard kill
     }
     
     // Read directory
+    auto directory_data = wad.get(header.directory_offset, header.num_lumps * (int32_t)sizeof(map_directory_t));
+    if (!directory_data)
+    {
+        onut::showMessageBox("Error", std::string("Invalid IWAD or PWAD: ") + filename);
+        exit(1); // Hard kill
+    }
     std::vector<map_directory_t> directory(header.num_lumps);
-    fseek(f, header.directory_offset, SEEK_SET);
-    fread(directory.data(), sizeof(map_directory_t), header.num_lumps, f);
+    memcpy(directory.data(), directory_data, header.num_lumps * sizeof(map_directory_t));
 
     bool is_doom2 = game.codename == "doom2";
 
+    // Lumps are only copied out of the mapping here, building is done after
+    std::vector<map_t*> loaded_maps;
+
     // loop directory and find levels, then load them all. YOLO
     for (int i = 0, len = (int)directory.size(); i < len; ++i)
     {
@@ -590,169 +842,59 @@ void init_wad(const char* filename, game_t& game)
             for (; i < len; ++i)
             {
                 const auto &dir_entry = directory[i];
-                try_load_lump("THINGS", f, dir_entry, map->things);
-                try_load_lump("LINEDEFS", f, dir_entry, map->linedefs);
-                try_load_lump("SIDEDEFS", f, dir_entry, map->sidedefs);
-                try_load_lump("VERTEXES", f, dir_entry, map->vertexes);
-                try_load_lump("SECTORS", f, dir_entry, map->map_sectors);
-                try_load_lump("SSECTORS", f, dir_entry, map->map_subsectors);
-                try_load_lump("NODES", f, dir_entry, map->map_nodes);
-                try_load_lump("SEGS", f, dir_entry, map->map_segs);
+                try_load_lump("THINGS", wad, dir_entry, map->things);
+                try_load_lump("LINEDEFS", wad, dir_entry, map->linedefs);
+                try_load_lump("SIDEDEFS", wad, dir_entry, map->sidedefs);
+                try_load_lump("VERTEXES", wad, dir_entry, map->vertexes);
+                try_load_lump("SECTORS", wad, dir_entry, map->map_sectors);
+                try_load_lump("SSECTORS", wad, dir_entry, map->map_subsectors);
+                try_load_lump("NODES", wad, dir_entry, map->map_nodes);
+                try_load_lump("SEGS", wad, dir_entry, map->map_segs);
                 if (strncmp(dir_entry.name, "BLOCKMAP", 8) == 0)
                 {
                     break;
                 }
             }
 
-            map->sectors.resize(map->map_sectors.size());
-            map->subsectors.resize(map->map_subsectors.size());
-            map->nodes.resize(map->map_nodes.size());
-            for (int j = 0, lenj = (int)map->map_nodes.size(); j < lenj; ++j)
-            {
-                map->nodes[j].x = (int16_t)map->map_nodes[j].x << 16;
-                map->nodes[j].y = (int16_t)map->map_nodes[j].y << 16;
-                map->nodes[j].dx = (int16_t)map->map_nodes[j].dx << 16;
-                map->nodes[j].dy = (int16_t)map->map_nodes[j].dy << 16;
-                for (int jj = 0; jj < 2; ++jj)
-                {
-                    map->nodes[j].children[jj] = (uint16_t)(int16_t)map->map_nodes[j].children[jj];
-                    if (map->nodes[j].children[jj] == NO_INDEX)
-                        map->nodes[j].children[jj] = -1;
-                    else if (map->nodes[j].children[jj] & NF_SUBSECTOR_VANILLA)
-                    {
-                        map->nodes[j].children[jj] &= ~NF_SUBSECTOR_VANILLA;
-                        if (map->nodes[j].children[jj] >= (int)map->map_subsectors.size())
-                            map->nodes[j].children[jj] = 0;
-                        map->nodes[j].children[jj] |= NF_SUBSECTOR;
-                    }
-                    for (int k = 0; k < 4; ++k)
-                        map->nodes[j].bbox[jj][k] = (int16_t)map->map_nodes[j].bbox[jj][k] << 16;
-                }
-            }
-
-            map->segs.resize(map->map_segs.size());
-            for (int j = 0, lenj = (int)map->map_segs.size(); j < lenj; ++j)
-            {
-                const auto& map_seg = map->map_segs[j];
-                auto& seg = map->segs[j];
-                int side = map_seg.side;
-                seg.sidedef = (&(map->linedefs[map_seg.linedef].front_sidedef))[side];
-                seg.front_sector = map->sidedefs[seg.sidedef].sector;
-            }
-
-            // Assign sector to subsector
-            for (int j = 0, lenj = (int)map->map_subsectors.size(); j < lenj; ++j)
-            {
-                const auto& seg = map->segs[map->map_subsectors[j].firstseg];
-                //const auto& map_sidedef = map->sidedefs[seg.sidedef];
-                map->subsectors[j].sector = seg.front_sector;
-            }
-
-            map->bb[0] = map->vertexes[0].x;
-            map->bb[1] = map->vertexes[0].y;
-            map->bb[2] = map->vertexes[0].x;
-            map->bb[3] = map->vertexes[0].y;
-            for (int v = 1, vlen = (int)map->vertexes.size(); v < vlen; ++v)
-            {
-                map->bb[0] = std::min(map->bb[0], map->vertexes[v].x);
-                map->bb[1] = std::min(map->bb[1], map->vertexes[v].y);
-                map->bb[2] = std::max(map->bb[2], map->vertexes[v].x);
-                map->bb[3] = std::max(map->bb[3], map->vertexes[v].y);
-            }
-
-            // Create "walls" used in triangulation step
-            std::vector<wall_t> map_walls;
-            for (int j = 0; j < (int)map->linedefs.size(); ++j)
-            {
-                const auto &linedef = map->linedefs[j];
-
-                if (linedef.front_sidedef != -1)
-                    create_wall(map_walls, map, j, linedef.front_sidedef);
-                if (linedef.back_sidedef != -1)
-                    create_wall(map_walls, map, j, linedef.back_sidedef);
-            }
+            if (std::find(loaded_maps.begin(), loaded_maps.end(), map) == loaded_maps.end())
+                loaded_maps.push_back(map);
+        }
+    }
 
-            // Triangulate
-            for (int j = 0; j < (int)map->sectors.size(); ++j)
-            {
-                triangulate_sector(map_walls, map, j);
-            }
+    // Nodes, segs, triangulation and arrows. That is most of the load time.
+    parallel_for((int)loaded_maps.size(), [&loaded_maps](int j) { build_map(loaded_maps[j]); });
 
-            // Create arrows
-            for (int j = 0; j < (int)map->linedefs.size(); ++j)
-            {
-                const auto& line_def = map->linedefs[j];
-                if (line_def.special_type != 0 && line_def.sector_tag != 0)
-                {
-                    arrow_t arrow;
-                    arrow.color = get_color_for_line_type(line_def.special_type);
-                    const auto& v1 = map->vertexes[line_def.start_vertex];
-                    const auto& v2 = map->vertexes[line_def.end_vertex];
-                    arrow.from = {
-                        (float)(v1.x + v2.x) * 0.5f,
-                        -(float)(v1.y + v2.y) * 0.5f
-                    };
-                    for (int k = 0; k < (int)map->map_sectors.size(); ++k)
-                    {
-                        const auto& map_sector = map->map_sectors[k];
-                        if (map_sector.tag == line_def.sector_tag)
-                        {
-                            Vector2 bbmin, bbmax;
-                            const auto& sector = map->sectors[k];
-                            if (sector.vertices.empty()) continue;
-                            bbmin = {
-                                (float)map->vertexes[sector.vertices[0]].x,
-                                -(float)map->vertexes[sector.vertices[0]].y
-                            };
-                            bbmax = bbmin;
-                            for (int l = 1; l < (int)sector.vertices.size(); ++l)
-                            {
-                                Vector2 pt = {
-                                    (float)map->vertexes[sector.vertices[l]].x,
-                                    -(float)map->vertexes[sector.vertices[l]].y
-                                };
-                                bbmin = onut::min(bbmin, pt);
-                                bbmax = onut::max(bbmax, pt);
-                            }
-                            arrow.to = (bbmin + bbmax) * 0.5f;
-                            map->arrows.push_back(arrow);
-                        }
-                    }
-                }
-            }
-
-            // Count checks
-            map->check_count = 0;
-            for (int j = 0, len = (int)map->things.size(); j < len; ++j)
-            {
-                const auto& thing = map->things[j];
+    for (auto map : loaded_maps)
+    {
+        // Count checks
+        map->check_count = 0;
+        for (int j = 0, len = (int)map->things.size(); j < len; ++j)
+        {
+            const auto& thing = map->things[j];
 
-                // Count total thing count (Consider UV difficulty)
-                if (thing.flags & 0x0004)
-                    game.total_doom_types[thing.type]++;
+            // Count total thing count (Consider UV difficulty)
+            if (thing.flags & 0x0004)
+                game.total_doom_types[thing.type]++;
 
-                if (thing.flags & 0x0010) continue; // Thing is not in single player
-                auto it = game.location_doom_types.find(thing.type);
-                if (it == game.location_doom_types.end()) continue;
-                map->check_count++;
-            }
+            if (thing.flags & 0x0010) continue; // Thing is not in single player
+            auto it = game.location_doom_types.find(thing.type);
+            if (it == game.location_doom_types.end()) continue;
+            map->check_count++;
+            map->location_grid.insert(j, (float)thing.x - 32.0f, (float)-thing.y - 32.0f, (float)thing.x + 32.0f, (float)-thing.y + 32.0f);
         }
     }
 
     // Load palette
-    auto pal = load_lump(directory, "PLAYPAL", f);
+    auto pal = load_lump(directory, "PLAYPAL", wad);
 
     // Load sprites for item requirements
     for (auto& item_requirement : game.item_requirements)
     {
         if (item_requirement.sprite != "")
         {
-            item_requirement.icon = load_sprite(directory, item_requirement.sprite.c_str(), f, pal.data());
+            item_requirement.icon = load_sprite(directory, item_requirement.sprite.c_str(), wad, pal.data());
         }
     }
-
-    // close file
-    fclose(f);
 }
 
 
@@ -762,6 +904,130 @@ void init_maps(game_t& game)
 }
 
 
+#define TRIANGULATION_CACHE_DIR "cache/triangulation/"
+#define TRIANGULATION_CACHE_MAGIC 0x31435441 // "ATC1"
+
+
+static std::string get_triangulation_cache_filename(const map_t* map)
+{
+    char name[32];
+    snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)map->geometry_hash);
+    return TRIANGULATION_CACHE_DIR + std::string(name);
+}
+
+
+static bool load_triangulation_cache(map_t* map)
+{
+    FILE* f = fopen(get_triangulation_cache_filename(map).c_str(), "rb");
+    if (!f) return false;
+
+    bool ok = true;
+    uint32_t magic = 0, sector_count = 0;
+    ok = ok && fread(&magic, sizeof(magic), 1, f) == 1 && magic == TRIANGULATION_CACHE_MAGIC;
+    ok = ok && fread(&sector_count, sizeof(sector_count), 1, f) == 1 && sector_count == map->sectors.size();
+    for (uint32_t i = 0; ok && i < sector_count; ++i)
+    {
+        uint32_t count = 0;
+        ok = fread(&count, sizeof(count), 1, f) == 1 && count % 3 == 0;
+        if (!ok) break;
+        auto& vertices = map->sectors[i].vertices;
+        vertices.resize(count);
+        ok = fread(vertices.data(), sizeof(int), count, f) == count;
+        for (uint32_t j = 0; ok && j < count; ++j)
+            ok = vertices[j] >= 0 && vertices[j] < (int)map->vertexes.size();
+    }
+    fclose(f);
+
+    if (!ok)
+    {
+        for (auto& sector : map->sectors)
+            sector.vertices.clear();
+    }
+    return ok;
+}
+
+
+static void save_triangulation_cache(const map_t* map)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(TRIANGULATION_CACHE_DIR, ec);
+
+    // Written aside then renamed, another worker or instance could be reading
+    auto filename = get_triangulation_cache_filename(map);
+    auto tmp_filename = filename + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+    FILE* f = fopen(tmp_filename.c_str(), "wb");
+    if (!f) return;
+
+    uint32_t magic = TRIANGULATION_CACHE_MAGIC;
+    uint32_t sector_count = (uint32_t)map->sectors.size();
+    fwrite(&magic, sizeof(magic), 1, f);
+    fwrite(&sector_count, sizeof(sector_count), 1, f);
+    for (const auto& sector : map->sectors)
+    {
+        uint32_t count = (uint32_t)sector.vertices.size();
+        fwrite(&count, sizeof(count), 1, f);
+        fwrite(sector.vertices.data(), sizeof(int), count, f);
+    }
+    fclose(f);
+
+    std::filesystem::rename(tmp_filename, filename, ec);
+    if (ec) std::filesystem::remove(tmp_filename, ec);
+}
+
+
+void triangulate_map(map_t* map)
+{
+    if (!map->triangulation) return; // Not loaded from a wad
+
+    std::lock_guard<std::mutex> lock(map->triangulation->mutex);
+    if (map->triangulation->done) return;
+
+    if (!load_triangulation_cache(map))
+    {
+        for (int j = 0; j < (int)map->sectors.size(); ++j)
+            triangulate_sector(map->walls, map, j);
+        save_triangulation_cache(map);
+    }
+    map->triangulation->done = true;
+}
+
+
+// The thread start_triangulation hands the maps to. Kept to join it on
+// shutdown, while games and the cache directory are still there.
+static std::thread triangulation_thread;
+static std::atomic<bool> triangulation_stopping{false};
+
+
+void start_triangulation()
+{
+    std::vector<map_t*> maps;
+    for (auto& kv : games)
+        for (auto& episode : kv.second.episodes)
+            for (auto& meta : episode)
+                maps.push_back(&meta.map);
+
+    // The editor opens right away. Whatever it draws first gets triangulated
+    // on the spot, the rest is picked up here.
+    triangulation_thread = std::thread([maps]()
+    {
+        parallel_for((int)maps.size(), [&maps](int i)
+        {
+            if (!triangulation_stopping)
+                triangulate_map(maps[i]);
+        });
+    });
+}
+
+
+void stop_triangulation()
+{
+    // Maps being triangulated finish, the others are left for next time
+    triangulation_stopping = true;
+    if (triangulation_thread.joinable())
+        triangulation_thread.join();
+}
+
+
 int sector_at(int x, int y, map_t* map)
 {
     x = (int)((int16_t)x << 16);
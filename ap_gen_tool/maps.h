@@ -1,9 +1,12 @@
 #pragma once
 
 #include <cinttypes>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <onut/Color.h>
 #include <onut/Vector2.h>
+#include "spatial.h"
 
 
 struct map_thing_t
@@ -125,6 +128,22 @@ struct subsector_t
 };
 
 
+struct wall_t
+{
+    int v1, v2;
+    int sector;
+};
+
+
+// Sector triangles are only needed to draw, they're built on first use or
+// in the background. Shared so map_t stays copyable.
+struct triangulation_t
+{
+    std::mutex mutex;
+    bool done = false;
+};
+
+
 struct arrow_t
 {
     Vector2 from;
@@ -147,14 +166,23 @@ struct map_t
     std::vector<subsector_t>        subsectors;
     std::vector<node_t>             nodes;
     std::vector<sector_t>           sectors;
+    std::vector<wall_t>             walls; // Sector outlines, what triangulation works from
+    std::vector<int>                sector_link_offsets; // Sector adjacency through two-sided linedefs.
+    std::vector<int>                sector_links;        // Neighbors of sector i are [offsets[i], offsets[i + 1])
     int16_t bb[4];
     std::vector<arrow_t>            arrows;
     int check_count;
+    spatial_grid_t location_grid; // Location things, by their 64x64 pick box (Y flipped, like on screen)
+    uint64_t geometry_hash = 0; // Of the lumps triangulation depends on, keys the disk cache
+    std::shared_ptr<triangulation_t> triangulation;
 };
 
 
 struct game_t;
 
 void init_maps(game_t& game);
+void start_triangulation(); // Triangulates every game's maps on worker threads
+void stop_triangulation(); // Waits for the maps being triangulated, skips the rest
+void triangulate_map(map_t* map); // Returns once map's sectors have vertices
 int sector_at(int x, int y, map_t* map);
 subsector_t* point_in_subsector(int x, int y, map_t* map);
@@ -11,14 +11,21 @@
 #include <onut/Random.h>
 #include <onut/Timing.h>
 #include <onut/Font.h>
+#include <onut/Log.h>
+#include <onut/VertexBuffer.h>
 
 #include <imgui/imgui.h>
 
+#include <algorithm>
+#include <climits>
+#include <map>
 #include <vector>
 #include <set>
 
 #include "maps.h"
 #include "generate.h"
+#include "solver.h"
+#include "history.h"
 #include "defs.h"
 #include "data.h"
 
@@ -114,6 +121,15 @@ static int set_rule_rule = -3;
 static int set_rule_connection = -1;
 static int mouse_hover_access = -1;
 static int mouse_hover_location = -1;
+static std::vector<int> spatial_candidates;
+
+// Hit-testing indices for the active level, see sync_spatial_index()
+static map_state_t* spatial_state = nullptr;
+static spatial_grid_t bb_grid(512.0f);
+static spatial_grid_t rule_grid(512.0f); // Ids are rule + 2 (0 = exit, 1 = world, 2+ = regions)
+static spatial_grid_t connection_grid(512.0f); // Ids are (rule + 2) << 16 | connection
+static std::vector<bb_t> indexed_bbs;
+static std::vector<rule_region_t> indexed_rules; // Same order as rule_grid ids
 
 
 map_view_t* get_view(const level_index_t& idx)
@@ -307,6 +323,29 @@ void save(game_t* game)
 
     std::string filename = "data/" + game->name + ".json";
     onut::saveJson(_json, filename, false);
+
+    // Undo history, so it survives restarting the tool
+    Json::Value histories_json(Json::arrayValue);
+    ep = 0;
+    for (const auto& episode : game->episodes)
+    {
+        int lvl = 0;
+        for (const auto& meta : episode)
+        {
+            if (meta.history.initialized && !meta.history.deltas.empty())
+            {
+                auto history_json = serialize_history(meta.history);
+                history_json["ep"] = ep;
+                history_json["map"] = lvl;
+                histories_json.append(history_json);
+            }
+            ++lvl;
+        }
+        ++ep;
+    }
+    Json::Value history_json;
+    history_json["maps"] = histories_json;
+    onut::saveJson(history_json, "data/" + game->name + ".history.json", false);
 }
 
 
@@ -414,6 +453,20 @@ void load(game_t* game)
 
         meta->view.cam_pos = Vector2((float)(map->bb[2] + map->bb[0]) / 2, -(float)(map->bb[3] + map->bb[1]) / 2);
     }
+
+    // Undo history from previous sessions. Optional, and dropped per map if
+    // it doesn't lead to what we just loaded.
+    Json::Value history_json;
+    if (onut::loadJson(history_json, "data/" + game->name + ".history.json"))
+    {
+        for (const auto& map_history_json : history_json["maps"])
+        {
+            auto meta = get_meta({game->name, map_history_json["ep"].asInt(), map_history_json["map"].asInt()});
+            if (!meta) continue;
+            if (!deserialize_history(&meta->history, map_history_json, meta->state))
+                OLogE("Undo history doesn't match " + meta->name + ", starting fresh");
+        }
+    }
 }
 
 
@@ -431,10 +484,7 @@ void update_window_title()
 // Undo/Redo shit
 void push_undo()
 {
-    if (map_history->history_point < (int)map_history->history.size() - 1)
-        map_history->history.erase(map_history->history.begin() + (map_history->history_point + 1), map_history->history.end());
-    map_history->history.push_back(*map_state);
-    map_history->history_point = (int)map_history->history.size() - 1;
+    history_push(map_history, *map_state);
 }
 
 
@@ -452,18 +502,15 @@ void select_map(game_t* game, int ep, int map)
     map_history = get_history(active_level);
 
     update_window_title();
-    if (map_history->history.empty())
-        push_undo();
+    if (!map_history->initialized)
+        history_reset(map_history, *map_state);
 }
 
 
 void undo()
 {
-    if (map_history->history_point > 0)
+    if (history_undo(map_history, map_state))
     {
-        map_history->history_point--;
-        *map_state = map_history->history[map_history->history_point];
-
         map_state->check_sanity_count = 0;
         for (const auto& loc : map_state->locations)
             map_state->check_sanity_count++;
@@ -473,11 +520,7 @@ void undo()
 
 void redo()
 {
-    if (map_history->history_point < (int)map_history->history.size() - 1)
-    {
-        map_history->history_point++;
-        *map_state = map_history->history[map_history->history_point];
-    }
+    history_redo(map_history, map_state);
 }
 
 
@@ -492,6 +535,12 @@ void initSettings()
     oSettings->setAntiAliasing(true);
     oSettings->setShowOnScreenLog(false);
     oSettings->setStartMaximized(true);
+
+    if (is_headless())
+    {
+        oSettings->setResolution({ 320, 200 });
+        oSettings->setStartMaximized(false);
+    }
 }
 
 
@@ -555,6 +604,14 @@ void init()
         auto game = &kv.second;
         load(game);
     }
+
+    // Command line generation, for build scripts. Skip the editor entirely.
+    if (is_headless())
+    {
+        if (std::find(OArguments.begin(), OArguments.end(), "-check") != OArguments.end() && check_reachability() != 0)
+            exit(1);
+        exit(generate_headless());
+    }
     //load("regions_new.json", &metas_new);
 
     // Mark dirty levels
@@ -574,6 +631,7 @@ void init()
 
 void shutdown() // lol
 {
+    stop_triangulation();
 }
 
 
@@ -772,7 +830,9 @@ int get_bb_at(const Vector2& pos, float zoom, int &edge)
         if (test_bb(map_state->bbs[map_state->selected_bb], pos, zoom, edge))
             return map_state->selected_bb;
     }
-    for (int i = 0; i < (int)map_state->bbs.size(); ++i)
+    float edge_size = 32.0f / zoom;
+    bb_grid.query(pos.x - edge_size, pos.y - edge_size, pos.x + edge_size, pos.y + edge_size, spatial_candidates);
+    for (auto i : spatial_candidates)
     {
         if (test_bb(map_state->bbs[i], pos, zoom, edge))
             return i;
@@ -784,25 +844,17 @@ int get_bb_at(const Vector2& pos, float zoom, int &edge)
 int get_loc_at(const Vector2& pos)
 {
     auto map = get_map(active_level);
-    auto game = get_game(active_level);
 
-    int index = 0;
-    for (const auto& thing : map->things)
+    // Only location things are in the grid
+    map->location_grid.query(pos.x, pos.y, spatial_candidates);
+    for (auto index : spatial_candidates)
     {
-        if (thing.flags & 0x0010)
+        const auto& thing = map->things[index];
+        Rect rect((float)thing.x - 32.0f, (float)-thing.y - 32.0f, 64.0f, 64.0f);
+        if (rect.Contains(pos))
         {
-            ++index;
-            continue; // Thing is not in single player
+            return index;
         }
-        if (game->location_doom_types.find(thing.type) != game->location_doom_types.end())
-        {
-            Rect rect((float)thing.x - 32.0f, (float)-thing.y - 32.0f, 64.0f, 64.0f);
-            if (rect.Contains(pos))
-            {
-                return index;
-            }
-        }
-        ++index;
     }
 
     return -1;
@@ -810,30 +862,31 @@ int get_loc_at(const Vector2& pos)
 
 
 // -1 = world, -2 = exit, -3 = not found
+static bool test_rule(const rule_region_t& rules, const Vector2& pos)
+{
+    return pos.x >= (float)rules.x - RULES_W * 0.5f &&
+           pos.x <= (float)rules.x + RULES_W * 0.5f &&
+           pos.y <= -(float)rules.y + RULES_H * 0.5f &&
+           pos.y >= -(float)rules.y - RULES_H * 0.5f;
+}
+
+
 int get_rule_at(const Vector2& pos)
 {
-    if (pos.x >= (float)map_state->world_rules.x - RULES_W * 0.5f &&
-        pos.x <= (float)map_state->world_rules.x + RULES_W * 0.5f &&
-        pos.y <= -(float)map_state->world_rules.y + RULES_H * 0.5f &&
-        pos.y >= -(float)map_state->world_rules.y - RULES_H * 0.5f)
-        return -1;
-
-    if (pos.x >= (float)map_state->exit_rules.x - RULES_W * 0.5f &&
-        pos.x <= (float)map_state->exit_rules.x + RULES_W * 0.5f &&
-        pos.y <= -(float)map_state->exit_rules.y + RULES_H * 0.5f &&
-        pos.y >= -(float)map_state->exit_rules.y - RULES_H * 0.5f)
-        return -2;
-
-    for (int i = (int)map_state->regions.size() - 1; i >= 0; --i)
-    {
-        const auto& region = map_state->regions[i];
-        if (pos.x >= (float)region.rules.x - RULES_W * 0.5f &&
-            pos.x <= (float)region.rules.x + RULES_W * 0.5f &&
-            pos.y <= -(float)region.rules.y + RULES_H * 0.5f &&
-            pos.y >= -(float)region.rules.y - RULES_H * 0.5f)
-            return i;
+    // World, exit, then regions from the top most
+    rule_grid.query(pos.x, pos.y, spatial_candidates);
+    std::sort(spatial_candidates.begin(), spatial_candidates.end(), [](int a, int b)
+    {
+        if (a == 1 || b == 1) return a == 1 && b != 1;
+        if (a == 0 || b == 0) return a == 0 && b != 0;
+        return a > b;
+    });
+    for (auto id : spatial_candidates)
+    {
+        int rule = id - 2;
+        if (test_rule(*get_rules(rule), pos))
+            return rule;
     }
-
     return -3;
 }
 
@@ -915,55 +968,132 @@ double segment_point_distance(const Vector2& p1, const Vector2& p2, const Vector
 }
 
 
-// -1 = not found
-int get_connection_at(const Vector2& pos, const rule_region_t& rules)
+static bool get_connection_segment(const rule_region_t& rules, const rule_connection_t& connection, Vector2& from, Vector2& to)
 {
+    auto other_rules = get_rules(connection.target_region);
+    if (!other_rules) return false;
+
     Vector2 center((float)rules.x, -(float)rules.y);
+    Vector2 other_center((float)other_rules->x, -(float)other_rules->y);
+    from = get_rect_edge_pos(center, other_center, RULE_CONNECTION_OFFSET, false);
+    to = get_rect_edge_pos(other_center, center, RULE_CONNECTION_OFFSET, true);
+    return true;
+}
 
-    int i = 0;
-    for (const auto& connection : rules.connections)
+
+void get_connection_at(const Vector2& pos, int& rule, int& connection)
+{
+    float tolerance = 24.0f / map_view->cam_zoom;
+    connection_grid.query(pos.x - tolerance, pos.y - tolerance, pos.x + tolerance, pos.y + tolerance, spatial_candidates);
+
+    // World rules first, then regions in order, exit last
+    auto rule_order = [](int id) { int rule = (id >> 16) - 2; return rule == -1 ? -1 : (rule == -2 ? INT_MAX : rule); };
+    std::sort(spatial_candidates.begin(), spatial_candidates.end(), [&rule_order](int a, int b)
     {
-        auto other_rules = get_rules(connection.target_region);
-        if (!other_rules) continue;
+        auto ra = rule_order(a), rb = rule_order(b);
+        if (ra != rb) return ra < rb;
+        return (a & 0xFFFF) < (b & 0xFFFF);
+    });
 
-        Vector2 other_center((float)other_rules->x, -(float)other_rules->y);
-        Vector2 from = get_rect_edge_pos(center, other_center, RULE_CONNECTION_OFFSET, false);
-        Vector2 to = get_rect_edge_pos(other_center, center, RULE_CONNECTION_OFFSET, true);
-        auto d = segment_point_distance(from, to, {pos.x, pos.y});
-        if (d <= 24.0f / map_view->cam_zoom) return i;
-        i++;
+    for (auto id : spatial_candidates)
+    {
+        int candidate_rule = (id >> 16) - 2;
+        int candidate_connection = id & 0xFFFF;
+        const auto& rules = *get_rules(candidate_rule);
+        Vector2 from, to;
+        if (!get_connection_segment(rules, rules.connections[candidate_connection], from, to)) continue;
+        if (segment_point_distance(from, to, {pos.x, pos.y}) <= tolerance)
+        {
+            rule = candidate_rule;
+            connection = candidate_connection;
+            return;
+        }
     }
-    return -1;
+
+    rule = -3;
+    connection = -1;
 }
 
-void get_connection_at(const Vector2& pos, int& rule, int& connection)
+
+// The editor changes map_state from all over, so rather than hooking every
+// edit, the indices are diffed against what they last saw each frame. Only
+// what moved or changed gets reinserted.
+static void sync_spatial_index()
 {
-    connection = get_connection_at(pos, map_state->world_rules);
-    if (connection != -1)
+    if (spatial_state != map_state)
     {
-        rule = -1;
-        return;
+        spatial_state = map_state;
+        bb_grid.clear();
+        rule_grid.clear();
+        connection_grid.clear();
+        indexed_bbs.clear();
+        indexed_rules.clear();
     }
 
-    for (int i = 0; i < (int)map_state->regions.size(); ++i)
+    // Bounding boxes
+    for (int i = 0, len = (int)map_state->bbs.size(); i < len; ++i)
     {
-        connection = get_connection_at(pos, map_state->regions[i].rules);
-        if (connection != -1)
+        const auto& bb = map_state->bbs[i];
+        if (i < (int)indexed_bbs.size() && indexed_bbs[i] == bb) continue;
+        bb_grid.update(i, (float)bb.x1, -(float)bb.y2, (float)bb.x2, -(float)bb.y1);
+    }
+    for (int i = (int)map_state->bbs.size(); i < (int)indexed_bbs.size(); ++i)
+        bb_grid.remove(i);
+    if (!(indexed_bbs == map_state->bbs))
+        indexed_bbs = map_state->bbs;
+
+    // Rule boxes
+    int rule_count = (int)map_state->regions.size() + 2;
+    int indexed_count = (int)indexed_rules.size();
+    std::vector<bool> dirty(std::max(rule_count, indexed_count), false);
+    bool any_dirty = false;
+    for (int id = 0; id < rule_count; ++id)
+    {
+        const auto& rules = *get_rules(id - 2);
+        bool moved = id >= indexed_count || indexed_rules[id].x != rules.x || indexed_rules[id].y != rules.y;
+        if (moved)
+            rule_grid.update(id, (float)rules.x - RULES_W * 0.5f, -(float)rules.y - RULES_H * 0.5f, (float)rules.x + RULES_W * 0.5f, -(float)rules.y + RULES_H * 0.5f);
+        if (moved || !(indexed_rules[id].connections == rules.connections))
         {
-            rule = i;
-            return;
+            dirty[id] = true;
+            any_dirty = true;
         }
     }
+    for (int id = rule_count; id < indexed_count; ++id)
+    {
+        rule_grid.remove(id);
+        dirty[id] = true;
+        any_dirty = true;
+    }
+    if (!any_dirty) return;
 
-    connection = get_connection_at(pos, map_state->exit_rules);
-    if (connection != -1)
+    // Connection segments. They move with either end.
+    for (int id = 0; id < std::max(rule_count, indexed_count); ++id)
     {
-        rule = -2;
-        return;
+        int old_count = id < indexed_count ? (int)indexed_rules[id].connections.size() : 0;
+        int new_count = id < rule_count ? (int)get_rules(id - 2)->connections.size() : 0;
+        for (int c = new_count; c < old_count; ++c)
+            connection_grid.remove((id << 16) | c);
+        for (int c = 0; c < new_count; ++c)
+        {
+            const auto& rules = *get_rules(id - 2);
+            const auto& connection = rules.connections[c];
+            int target_id = connection.target_region + 2;
+            if (!dirty[id] && (target_id < 0 || target_id >= (int)dirty.size() || !dirty[target_id])) continue;
+            Vector2 from, to;
+            if (target_id < 0 || target_id >= rule_count || !get_connection_segment(rules, connection, from, to))
+            {
+                connection_grid.remove((id << 16) | c);
+                continue;
+            }
+            connection_grid.update((id << 16) | c, std::min(from.x, to.x), std::min(from.y, to.y), std::max(from.x, to.x), std::max(from.y, to.y));
+        }
     }
 
-    rule = -3;
-    connection = -1;
+    indexed_rules.resize(rule_count);
+    for (int id = 0; id < rule_count; ++id)
+        if (dirty[id])
+            indexed_rules[id] = *get_rules(id - 2);
 }
 
 
@@ -1012,6 +1142,7 @@ void update()
     auto cam_matrix = Matrix::Create2DTranslationZoom(OScreenf, map_view->cam_pos, map_view->cam_zoom);
     auto inv_cam_matrix = cam_matrix.Invert();
     mouse_pos = Vector2::Transform(OGetMousePos(), inv_cam_matrix);
+    sync_spatial_index();
 
     // Update shortcuts
     switch (state)
@@ -1543,167 +1674,271 @@ void draw_rules()
 }
 
 
-void draw_level(const level_index_t& idx, const Vector2& pos, float angle, bool draw_tools)
+// Vertex layout of onut's 2D shaders, same as what oPrimitiveBatch streams
+struct level_vertex_t
 {
-    Color bound_color(1.0f);
-    Color step_color(0.35f);
-    Color bb_color(0.5f);
+    Vector2 position;
+    Vector2 tex_coord;
+    Color color;
+};
 
-    auto pb = oPrimitiveBatch.get();
-    auto sb = oSpriteBatch.get();
-    auto game = get_game(idx);
-    auto map = get_map(idx);
-    auto map_state = get_state(idx, active_source);
-    oRenderer->renderStates.backFaceCull = false;
 
-    auto transform = 
-              Matrix::CreateRotationZ(angle) *
-              Matrix::CreateTranslation(Vector2(pos.x, -pos.y)) *
-              Matrix::Create2DTranslationZoom(OScreenf, map_view->cam_pos, map_view->cam_zoom);
+// Sectors and linedefs don't change while editing, only the region tints on
+// top of them do. They're uploaded once per map and drawn with the camera
+// transform instead of being re-emitted every frame.
+struct level_buffers_t
+{
+    OVertexBufferRef sectors;
+    int sector_vertex_count = 0;
+    uint64_t sector_hash = 0; // Of the region tints and sectors the buffer was built from
+    const map_state_t* sector_state = nullptr;
+    OVertexBufferRef lines[2]; // Without, with tools colors
+    int line_vertex_counts[2] = {0, 0};
+};
 
-    // Sectors
-    if (draw_tools)
+
+static std::map<const map_t*, level_buffers_t> level_buffers;
+static OTextureRef white_texture;
+
+
+static uint64_t fnv1a(const void* data, size_t size, uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    auto bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < size; ++i)
     {
-        pb->begin(OPrimitiveTriangleList, nullptr, transform);
-        int i = 0;
-        for (const auto& sector : map->sectors)
-        {
-            region_t* region = get_region_for_sector(map_state, i);
-            if (region)
-            {
-                Color color = region->tint * 0.5f;
-                for (int i = 0, len = (int)sector.vertices.size(); i < len; i += 3)
-                {
-                    const auto& v1 = map->vertexes[sector.vertices[i + 0]];
-                    const auto& v2 = map->vertexes[sector.vertices[i + 1]];
-                    const auto& v3 = map->vertexes[sector.vertices[i + 2]];
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
 
-                    pb->draw(Vector2(v1.x, -v1.y), color);
-                    pb->draw(Vector2(v2.x, -v2.y), color);
-                    pb->draw(Vector2(v3.x, -v3.y), color);
-                }
-            }
-            ++i;
-        }
-        pb->end();
+
+static uint64_t get_tints_hash(const map_state_t* map_state)
+{
+    uint64_t hash = fnv1a(nullptr, 0);
+    for (const auto& region : map_state->regions)
+    {
+        int sector_count = (int)region.sectors.size();
+        hash = fnv1a(&region.tint, sizeof(Color), hash);
+        hash = fnv1a(&sector_count, sizeof(int), hash);
+        for (auto sectori : region.sectors)
+            hash = fnv1a(&sectori, sizeof(int), hash);
     }
+    return hash;
+}
 
-    // Geometry
-    pb->begin(OPrimitiveLineList, nullptr, transform);
 
-    // Bounding box
-    //pb->draw(Vector2(map->bb[0], -map->bb[1]), bb_color); pb->draw(Vector2(map->bb[0], -map->bb[3]), bb_color);
-    //pb->draw(Vector2(map->bb[0], -map->bb[3]), bb_color); pb->draw(Vector2(map->bb[2], -map->bb[3]), bb_color);
-    //pb->draw(Vector2(map->bb[2], -map->bb[3]), bb_color); pb->draw(Vector2(map->bb[2], -map->bb[1]), bb_color);
-    //pb->draw(Vector2(map->bb[2], -map->bb[1]), bb_color); pb->draw(Vector2(map->bb[0], -map->bb[1]), bb_color);
+static OVertexBufferRef create_buffer(const std::vector<level_vertex_t>& vertices)
+{
+    if (vertices.empty()) return nullptr;
+    return OVertexBuffer::createStatic(vertices.data(), (uint32_t)(vertices.size() * sizeof(level_vertex_t)));
+}
 
-    // Geometry
-    int i = 0;
-    bool is_heretic = game->codename == "heretic";
-    for (const auto& line : map->linedefs)
+
+static void draw_buffer(const OVertexBufferRef& buffer, int vertex_count, onut::PrimitiveMode mode, const Matrix& transform)
+{
+    if (!buffer || !vertex_count) return;
+
+    if (!white_texture)
     {
-        Color color = bound_color;
-        if (line.back_sidedef != -1) color = step_color;
+        uint32_t white = 0xFFFFFFFF;
+        white_texture = OTexture::createFromData((const uint8_t*)&white, Point(1, 1), false);
+    }
+
+    auto& render_states = oRenderer->renderStates;
+    oRenderer->setupFor2D(transform);
+    render_states.textures[0] = white_texture;
+    render_states.primitiveMode = mode;
+    render_states.vertexBuffer = buffer;
+    oRenderer->draw((uint32_t)vertex_count);
+}
+
+
+// Rebuilt only when a region's tint or sectors changed
+static void update_sector_buffer(map_t* map, map_state_t* map_state)
+{
+    auto& buffers = level_buffers[map];
+    auto hash = get_tints_hash(map_state);
+    if (buffers.sector_state == map_state && buffers.sector_hash == hash) return;
 
-        if (draw_tools)
+    triangulate_map(map);
+
+    std::vector<level_vertex_t> vertices;
+    int i = 0;
+    for (const auto& sector : map->sectors)
+    {
+        region_t* region = get_region_for_sector(map_state, i);
+        if (region)
         {
-            if (is_heretic)
-            {
-                if (line.special_type == LT_DR_DOOR_RED_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_RED_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_RED_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_RED_OPEN_STAY_FAST)
-                    color = game->key_colors[1];
-                else if (line.special_type == LT_DR_DOOR_YELLOW_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_YELLOW_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_YELLOW_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_YELLOW_OPEN_STAY_FAST)
-                    color = game->key_colors[0];
-                else if (line.special_type == LT_DR_DOOR_BLUE_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_BLUE_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_BLUE_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_BLUE_OPEN_STAY_FAST)
-                    color = game->key_colors[2];
-            }
-            else
+            Color color = region->tint * 0.5f;
+            for (auto vertexi : sector.vertices)
             {
-                if (line.special_type == LT_DR_DOOR_RED_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_RED_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_RED_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_RED_OPEN_STAY_FAST)
-                    color = game->key_colors[2];
-                else if (line.special_type == LT_DR_DOOR_YELLOW_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_YELLOW_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_YELLOW_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_YELLOW_OPEN_STAY_FAST)
-                    color = game->key_colors[1];
-                else if (line.special_type == LT_DR_DOOR_BLUE_OPEN_WAIT_CLOSE ||
-                    line.special_type == LT_D1_DOOR_BLUE_OPEN_STAY ||
-                    line.special_type == LT_SR_DOOR_BLUE_OPEN_STAY_FAST ||
-                    line.special_type == LT_S1_DOOR_BLUE_OPEN_STAY_FAST)
-                    color = game->key_colors[0];
+                const auto& v = map->vertexes[vertexi];
+                vertices.push_back({Vector2(v.x, -v.y), Vector2::Zero, color});
             }
-
-            if (line.special_type == LT_DR_DOOR_OPEN_WAIT_CLOSE_ALSO_MONSTERS ||
-                line.special_type == LT_DR_DOOR_OPEN_WAIT_CLOSE_FAST ||
-                line.special_type == LT_SR_DOOR_OPEN_WAIT_CLOSE ||
-                line.special_type == LT_SR_DOOR_OPEN_WAIT_CLOSE_FAST ||
-                line.special_type == LT_S1_DOOR_OPEN_WAIT_CLOSE ||
-                line.special_type == LT_S1_DOOR_OPEN_WAIT_CLOSE_FAST ||
-                line.special_type == LT_WR_DOOR_OPEN_WAIT_CLOSE ||
-                line.special_type == LT_WR_DOOR_OPEN_WAIT_CLOSE_FAST ||
-                line.special_type == LT_W1_DOOR_OPEN_WAIT_CLOSE_ALSO_MONSTERS ||
-                line.special_type == LT_W1_DOOR_OPEN_WAIT_CLOSE_FAST ||
-                line.special_type == LT_D1_DOOR_OPEN_STAY ||
-                line.special_type == LT_D1_DOOR_OPEN_STAY_FAST ||
-                line.special_type == LT_SR_DOOR_OPEN_STAY ||
-                line.special_type == LT_SR_DOOR_OPEN_STAY_FAST ||
-                line.special_type == LT_S1_DOOR_OPEN_STAY ||
-                line.special_type == LT_S1_DOOR_OPEN_STAY_FAST ||
-                line.special_type == LT_GR_DOOR_OPEN_STAY ||
-                line.special_type == LT_SR_DOOR_CLOSE_STAY ||
-                line.special_type == LT_SR_DOOR_CLOSE_STAY_FAST ||
-                line.special_type == LT_S1_DOOR_CLOSE_STAY ||
-                line.special_type == LT_S1_DOOR_CLOSE_STAY_FAST)
-                color = Color(0, 1, 1);
-            else if (line.special_type == LT_S1_EXIT_LEVEL ||
-                line.special_type == LT_W1_EXIT_LEVEL ||
-                line.special_type == LT_S1_EXIT_LEVEL_GOES_TO_SECRET_LEVEL ||
-                line.special_type == LT_W1_EXIT_LEVEL_GOES_TO_SECRET_LEVEL)
-                color = Color(0, 0.5f, 1);
         }
+        ++i;
+    }
+
+    buffers.sectors = create_buffer(vertices);
+    buffers.sector_vertex_count = (int)vertices.size();
+    buffers.sector_hash = hash;
+    buffers.sector_state = map_state;
+}
+
 
-        if (draw_tools && tool == tool_t::region)
+static Color get_line_color(const game_t* game, const map_linedefs_t& line, bool draw_tools)
+{
+    Color bound_color(1.0f);
+    Color step_color(0.35f);
+
+    Color color = bound_color;
+    if (line.back_sidedef != -1) color = step_color;
+
+    if (draw_tools)
+    {
+        bool is_heretic = game->codename == "heretic";
+        if (is_heretic)
         {
-            if (mouse_hover_sector != -1)
-            {
-                if ((line.back_sidedef != -1 && map->sidedefs[line.back_sidedef].sector == mouse_hover_sector) ||
-                    (line.front_sidedef != -1 && map->sidedefs[line.front_sidedef].sector == mouse_hover_sector))
-                {
-                    color = Color(0, 1, 1);
-                }
-            }
+            if (line.special_type == LT_DR_DOOR_RED_OPEN_WAIT_CLOSE ||
+                line.special_type == LT_D1_DOOR_RED_OPEN_STAY ||
+                line.special_type == LT_SR_DOOR_RED_OPEN_STAY_FAST ||
+                line.special_type == LT_S1_DOOR_RED_OPEN_STAY_FAST)
+                color = game->key_colors[1];
+            else if (line.special_type == LT_DR_DOOR_YELLOW_OPEN_WAIT_CLOSE ||
+                line.special_type == LT_D1_DOOR_YELLOW_OPEN_STAY ||
+                line.special_type == LT_SR_DOOR_YELLOW_OPEN_STAY_FAST ||
+                line.special_type == LT_S1_DOOR_YELLOW_OPEN_STAY_FAST)
+                color = game->key_colors[0];
+            else if (line.special_type == LT_DR_DOOR_BLUE_OPEN_WAIT_CLOSE ||
+                line.special_type == LT_D1_DOOR_BLUE_OPEN_STAY ||
+                line.special_type == LT_SR_DOOR_BLUE_OPEN_STAY_FAST ||
+                line.special_type == LT_S1_DOOR_BLUE_OPEN_STAY_FAST)
+                color = game->key_colors[2];
+        }
+        else
+        {
+            if (line.special_type == LT_DR_DOOR_RED_OPEN_WAIT_CLOSE ||
+                line.special_type == LT_D1_DOOR_RED_OPEN_STAY ||
+                line.special_type == LT_SR_DOOR_RED_OPEN_STAY_FAST ||
+                line.special_type == LT_S1_DOOR_RED_OPEN_STAY_FAST)
+                color = game->key_colors[2];
+            else if (line.special_type == LT_DR_DOOR_YELLOW_OPEN_WAIT_CLOSE ||
+                line.special_type == LT_D1_DOOR_YELLOW_OPEN_STAY ||
+                line.special_type == LT_SR_DOOR_YELLOW_OPEN_STAY_FAST ||
+                line.special_type == LT_S1_DOOR_YELLOW_OPEN_STAY_FAST)
+                color = game->key_colors[1];
+            else if (line.special_type == LT_DR_DOOR_BLUE_OPEN_WAIT_CLOSE ||
+                line.special_type == LT_D1_DOOR_BLUE_OPEN_STAY ||
+                line.special_type == LT_SR_DOOR_BLUE_OPEN_STAY_FAST ||
+                line.special_type == LT_S1_DOOR_BLUE_OPEN_STAY_FAST)
+                color = game->key_colors[0];
         }
-        
-        pb->draw(Vector2(map->vertexes[line.start_vertex].x, -map->vertexes[line.start_vertex].y), color);
-        pb->draw(Vector2(map->vertexes[line.end_vertex].x, -map->vertexes[line.end_vertex].y), color);
 
-        ++i;
+        if (line.special_type == LT_DR_DOOR_OPEN_WAIT_CLOSE_ALSO_MONSTERS ||
+            line.special_type == LT_DR_DOOR_OPEN_WAIT_CLOSE_FAST ||
+            line.special_type == LT_SR_DOOR_OPEN_WAIT_CLOSE ||
+            line.special_type == LT_SR_DOOR_OPEN_WAIT_CLOSE_FAST ||
+            line.special_type == LT_S1_DOOR_OPEN_WAIT_CLOSE ||
+            line.special_type == LT_S1_DOOR_OPEN_WAIT_CLOSE_FAST ||
+            line.special_type == LT_WR_DOOR_OPEN_WAIT_CLOSE ||
+            line.special_type == LT_WR_DOOR_OPEN_WAIT_CLOSE_FAST ||
+            line.special_type == LT_W1_DOOR_OPEN_WAIT_CLOSE_ALSO_MONSTERS ||
+            line.special_type == LT_W1_DOOR_OPEN_WAIT_CLOSE_FAST ||
+            line.special_type == LT_D1_DOOR_OPEN_STAY ||
+            line.special_type == LT_D1_DOOR_OPEN_STAY_FAST ||
+            line.special_type == LT_SR_DOOR_OPEN_STAY ||
+            line.special_type == LT_SR_DOOR_OPEN_STAY_FAST ||
+            line.special_type == LT_S1_DOOR_OPEN_STAY ||
+            line.special_type == LT_S1_DOOR_OPEN_STAY_FAST ||
+            line.special_type == LT_GR_DOOR_OPEN_STAY ||
+            line.special_type == LT_SR_DOOR_CLOSE_STAY ||
+            line.special_type == LT_SR_DOOR_CLOSE_STAY_FAST ||
+            line.special_type == LT_S1_DOOR_CLOSE_STAY ||
+            line.special_type == LT_S1_DOOR_CLOSE_STAY_FAST)
+            color = Color(0, 1, 1);
+        else if (line.special_type == LT_S1_EXIT_LEVEL ||
+            line.special_type == LT_W1_EXIT_LEVEL ||
+            line.special_type == LT_S1_EXIT_LEVEL_GOES_TO_SECRET_LEVEL ||
+            line.special_type == LT_W1_EXIT_LEVEL_GOES_TO_SECRET_LEVEL)
+            color = Color(0, 0.5f, 1);
     }
 
-    // Arrows
-    for (const auto& arrow : map->arrows)
+    return color;
+}
+
+
+// Linedefs and arrows, they never change once the map is loaded
+static void update_line_buffer(const game_t* game, map_t* map, bool draw_tools)
+{
+    auto& buffers = level_buffers[map];
+    int variant = draw_tools ? 1 : 0;
+    if (buffers.lines[variant]) return;
+
+    std::vector<level_vertex_t> vertices;
+    vertices.reserve(map->linedefs.size() * 2 + map->arrows.size() * 6);
+    for (const auto& line : map->linedefs)
     {
-        pb->draw(arrow.from, arrow.color);
-        pb->draw(arrow.to, arrow.color);
+        Color color = get_line_color(game, line, draw_tools);
+        vertices.push_back({Vector2(map->vertexes[line.start_vertex].x, -map->vertexes[line.start_vertex].y), Vector2::Zero, color});
+        vertices.push_back({Vector2(map->vertexes[line.end_vertex].x, -map->vertexes[line.end_vertex].y), Vector2::Zero, color});
+    }
 
+    for (const auto& arrow : map->arrows)
+    {
         Vector2 dir = arrow.to - arrow.from;
         dir.Normalize();
         Vector2 right(-dir.y, dir.x);
 
 #define ARROW_HEAD_SIZE 8.0f
-        pb->draw(arrow.to, arrow.color); pb->draw(arrow.to - dir * ARROW_HEAD_SIZE - right * ARROW_HEAD_SIZE, arrow.color);
-        pb->draw(arrow.to, arrow.color); pb->draw(arrow.to - dir * ARROW_HEAD_SIZE + right * ARROW_HEAD_SIZE, arrow.color);
+        vertices.push_back({arrow.from, Vector2::Zero, arrow.color}); vertices.push_back({arrow.to, Vector2::Zero, arrow.color});
+        vertices.push_back({arrow.to, Vector2::Zero, arrow.color}); vertices.push_back({arrow.to - dir * ARROW_HEAD_SIZE - right * ARROW_HEAD_SIZE, Vector2::Zero, arrow.color});
+        vertices.push_back({arrow.to, Vector2::Zero, arrow.color}); vertices.push_back({arrow.to - dir * ARROW_HEAD_SIZE + right * ARROW_HEAD_SIZE, Vector2::Zero, arrow.color});
+    }
+
+    buffers.lines[variant] = create_buffer(vertices);
+    buffers.line_vertex_counts[variant] = (int)vertices.size();
+}
+
+
+void draw_level(const level_index_t& idx, const Vector2& pos, float angle, bool draw_tools)
+{
+    Color bb_color(0.5f);
+
+    auto pb = oPrimitiveBatch.get();
+    auto sb = oSpriteBatch.get();
+    auto game = get_game(idx);
+    auto map = get_map(idx);
+    auto map_state = get_state(idx, active_source);
+    oRenderer->renderStates.backFaceCull = false;
+
+    auto transform = 
+              Matrix::CreateRotationZ(angle) *
+              Matrix::CreateTranslation(Vector2(pos.x, -pos.y)) *
+              Matrix::Create2DTranslationZoom(OScreenf, map_view->cam_pos, map_view->cam_zoom);
+
+    // Sectors and geometry, from the level's static buffers
+    if (draw_tools) update_sector_buffer(map, map_state);
+    update_line_buffer(game, map, draw_tools);
+    auto& buffers = level_buffers[map];
+    if (draw_tools) draw_buffer(buffers.sectors, buffers.sector_vertex_count, OPrimitiveTriangleList, transform);
+    draw_buffer(buffers.lines[draw_tools ? 1 : 0], buffers.line_vertex_counts[draw_tools ? 1 : 0], OPrimitiveLineList, transform);
+
+    // Overlays
+    pb->begin(OPrimitiveLineList, nullptr, transform);
+
+    // Hovered sector outline
+    if (draw_tools && tool == tool_t::region && mouse_hover_sector != -1)
+    {
+        for (const auto& line : map->linedefs)
+        {
+            if ((line.back_sidedef != -1 && map->sidedefs[line.back_sidedef].sector == mouse_hover_sector) ||
+                (line.front_sidedef != -1 && map->sidedefs[line.front_sidedef].sector == mouse_hover_sector))
+            {
+                pb->draw(Vector2(map->vertexes[line.start_vertex].x, -map->vertexes[line.start_vertex].y), Color(0, 1, 1));
+                pb->draw(Vector2(map->vertexes[line.end_vertex].x, -map->vertexes[line.end_vertex].y), Color(0, 1, 1));
+            }
+        }
     }
 
     // Bounding boxes
@@ -1767,7 +2002,7 @@ void draw_level(const level_index_t& idx, const Vector2& pos, float angle, bool
     // Items
     sb->begin(transform);
     oRenderer->renderStates.sampleFiltering = OFilterNearest;
-    i = -1;
+    int i = -1;
     for (const auto& thing : map->things)
     {
         ++i;
@@ -1883,6 +2118,8 @@ void renderUI()
             }
         }
         ImGui::Separator();
+        if (ImGui::MenuItem("Check Reachability")) check_reachability();
+        ImGui::Separator();
         if (ImGui::MenuItem("Exit")) OQuit();
         ImGui::EndMenu();
     }
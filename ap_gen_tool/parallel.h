@@ -0,0 +1,36 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+// Calls fn(i) for every i in [0, count), spread over the hardware threads.
+// Workers grab the next index as they finish, so uneven maps balance out.
+// fn must only write to data owned by index i.
+template<typename F>
+void parallel_for(int count, F&& fn)
+{
+    int thread_count = std::min(count, (int)std::max(1u, std::thread::hardware_concurrency()));
+    if (thread_count <= 1)
+    {
+        for (int i = 0; i < count; ++i)
+            fn(i);
+        return;
+    }
+
+    std::atomic<int> next{0};
+    auto worker = [&]()
+    {
+        for (int i = next++; i < count; i = next++)
+            fn(i);
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 1; t < thread_count; ++t)
+        threads.emplace_back(worker);
+    worker();
+    for (auto& thread : threads)
+        thread.join();
+}
@@ -0,0 +1,300 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+//
+// *Region reachability checks, run over the hand authored region rules*
+//
+
+#include "solver.h"
+
+#include <onut/Log.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <map>
+
+#include "data.h"
+#include "maps.h"
+#include "parallel.h"
+
+
+#define MAX_MASKS_PER_REGION 256 // Bail out of pathological rule graphs
+
+
+struct solver_state_t
+{
+    std::map<int, int> bits; // doom_type -> requirement bit
+    uint64_t missing = 0; // Requirements this level can never give
+    std::vector<std::vector<uint64_t>> masks; // Per region, minimal requirement sets. Last one is the exit.
+    std::deque<std::pair<int, uint64_t>> queue;
+};
+
+
+static bool is_requirement_available(const game_t* game, const map_t* map, int doom_type)
+{
+    if (doom_type < 0) return true; // Not an item, i.e. -2 is "pro" difficulty
+
+    for (const auto& key_def : game->keys)
+    {
+        if (key_def.item.doom_type != doom_type) continue;
+
+        // Keys are per level, they need to be in the map
+        for (const auto& thing : map->things)
+        {
+            if (thing.flags & 0x0010) continue; // Thing is not in single player
+            if (thing.type == doom_type) return true;
+        }
+        return false;
+    }
+
+    for (const auto& requirement : game->item_requirements)
+        if (requirement.doom_type == doom_type)
+            return true;
+
+    return false;
+}
+
+
+static std::string get_requirement_name(const game_t* game, int doom_type)
+{
+    for (const auto& requirement : game->item_requirements)
+        if (requirement.doom_type == doom_type)
+            return requirement.name;
+    return "doom type " + std::to_string(doom_type);
+}
+
+
+static bool add_bits(solver_state_t& state, const game_t* game, const map_t* map, const rule_region_t& rules)
+{
+    for (const auto& connection : rules.connections)
+    {
+        for (const auto* requirements : {&connection.requirements_and, &connection.requirements_or})
+        {
+            for (auto doom_type : *requirements)
+            {
+                if (state.bits.count(doom_type)) continue;
+                int bit = (int)state.bits.size();
+                if (bit >= 64) return false;
+                state.bits[doom_type] = bit;
+                if (!is_requirement_available(game, map, doom_type))
+                    state.missing |= 1ull << bit;
+            }
+        }
+    }
+    return true;
+}
+
+
+// Keeps only minimal masks: anything that is a superset of an existing one
+// is a strictly worse way to get there.
+static void reach(solver_state_t& state, int target, uint64_t mask)
+{
+    auto& masks = state.masks[target];
+    for (auto existing : masks)
+        if ((existing & mask) == existing)
+            return;
+    masks.erase(std::remove_if(masks.begin(), masks.end(), [mask](uint64_t existing) { return (mask & existing) == mask; }), masks.end());
+    if ((int)masks.size() >= MAX_MASKS_PER_REGION) return;
+    masks.push_back(mask);
+    state.queue.push_back({target, mask});
+}
+
+
+static void follow(solver_state_t& state, int region_count, uint64_t mask, const rule_connection_t& connection)
+{
+    int target = connection.target_region;
+    if (target == -1) return; // Back to hub, where we started
+    if (target == -2) target = region_count; // Exit
+    if (target < 0 || target > region_count) return;
+
+    for (auto doom_type : connection.requirements_and)
+        mask |= 1ull << state.bits[doom_type];
+
+    if (connection.requirements_or.empty())
+    {
+        reach(state, target, mask);
+        return;
+    }
+    for (auto doom_type : connection.requirements_or)
+        reach(state, target, mask | (1ull << state.bits[doom_type]));
+}
+
+
+// "" if the target can be reached, otherwise why not
+static std::string get_blocker(const solver_state_t& state, const game_t* game, int target)
+{
+    const auto& masks = state.masks[target];
+    if (masks.empty()) return "can't be reached from the hub";
+
+    uint64_t best_missing = ~0ull;
+    int best_count = 65;
+    for (auto mask : masks)
+    {
+        auto missing = mask & state.missing;
+        if (!missing) return "";
+        int count = 0;
+        for (auto m = missing; m; m &= m - 1) ++count;
+        if (count < best_count)
+        {
+            best_count = count;
+            best_missing = missing;
+        }
+    }
+
+    std::string names;
+    for (const auto& kv : state.bits)
+    {
+        if (!(best_missing & (1ull << kv.second))) continue;
+        if (!names.empty()) names += ", ";
+        names += get_requirement_name(game, kv.first);
+    }
+    return "is over-constrained, it needs " + names + " which this level doesn't have";
+}
+
+
+std::vector<std::string> solve_level(const game_t* game, meta_t* meta)
+{
+    std::vector<std::string> issues;
+    auto map = &meta->map;
+    const auto& map_state = meta->state;
+    int region_count = (int)map_state.regions.size();
+    std::string prefix = meta->name + ": ";
+
+    solver_state_t state;
+    bool fits = add_bits(state, game, map, map_state.world_rules);
+    for (const auto& region : map_state.regions)
+        fits = fits && add_bits(state, game, map, region.rules);
+    if (!fits)
+    {
+        issues.push_back(prefix + "more than 64 distinct requirements, not checked");
+        return issues;
+    }
+
+    // Bitmask BFS from the hub
+    state.masks.resize(region_count + 1);
+    for (const auto& connection : map_state.world_rules.connections)
+        follow(state, region_count, 0, connection);
+    while (!state.queue.empty())
+    {
+        auto from = state.queue.front();
+        state.queue.pop_front();
+        if (from.first == region_count) continue; // Exit leads nowhere
+        for (const auto& connection : map_state.regions[from.first].rules.connections)
+            follow(state, region_count, from.second, connection);
+    }
+
+    // Same rule as generate(): the last region listing a sector owns it
+    std::vector<int> sector_regions(map->sectors.size(), -1);
+    for (int i = 0; i < region_count; ++i)
+        for (auto sectori : map_state.regions[i].sectors)
+            if (sectori >= 0 && sectori < (int)sector_regions.size())
+                sector_regions[sectori] = i;
+
+    std::vector<int> region_location_counts(region_count, 0);
+    for (int i = 0, len = (int)map->things.size(); i < len; ++i)
+    {
+        const auto& thing = map->things[i];
+        if (thing.flags & 0x0010) continue; // Thing is not in single player
+        auto type_it = game->location_doom_types.find(thing.type);
+        if (type_it == game->location_doom_types.end()) continue; // Not a location
+        auto loc_it = map_state.locations.find(i);
+        if (loc_it != map_state.locations.end() && loc_it->second.unreachable) continue; // Known
+
+        int sectori = sector_at(thing.x, thing.y, map);
+        if (sectori < 0 || sectori >= (int)sector_regions.size())
+        {
+            issues.push_back(prefix + "thing " + std::to_string(i) + " is outside the map");
+            continue;
+        }
+        int regioni = sector_regions[sectori];
+        if (regioni != -1)
+        {
+            region_location_counts[regioni]++;
+            continue;
+        }
+
+        // Walk the sector graph to hint at where it probably belongs
+        std::string hint;
+        std::vector<bool> visited(sector_regions.size(), false);
+        std::deque<int> sectors = {sectori};
+        visited[sectori] = true;
+        while (!sectors.empty() && hint.empty())
+        {
+            int s = sectors.front();
+            sectors.pop_front();
+            for (int j = map->sector_link_offsets[s]; j < map->sector_link_offsets[s + 1]; ++j)
+            {
+                int neighbor = map->sector_links[j];
+                if (visited[neighbor]) continue;
+                visited[neighbor] = true;
+                if (sector_regions[neighbor] != -1)
+                {
+                    hint = ", nearest region is " + map_state.regions[sector_regions[neighbor]].name;
+                    break;
+                }
+                sectors.push_back(neighbor);
+            }
+        }
+
+        auto loc_name = (loc_it != map_state.locations.end() && !loc_it->second.name.empty()) ? loc_it->second.name : type_it->second;
+        issues.push_back(prefix + loc_name + " (thing " + std::to_string(i) + ", sector " + std::to_string(sectori) + ") is in no region" + hint);
+    }
+
+    for (int i = 0; i < region_count; ++i)
+    {
+        auto blocker = get_blocker(state, game, i);
+        if (blocker.empty()) continue;
+        issues.push_back(prefix + "region " + map_state.regions[i].name + " " + blocker +
+                         " (" + std::to_string(region_location_counts[i]) + " locations)");
+    }
+
+    auto exit_blocker = get_blocker(state, game, region_count);
+    if (!exit_blocker.empty())
+        issues.push_back(prefix + "exit " + exit_blocker);
+
+    return issues;
+}
+
+
+int check_reachability()
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::pair<const game_t*, meta_t*>> levels;
+    for (auto& kv : games)
+        for (auto& episode : kv.second.episodes)
+            for (auto& meta : episode)
+                levels.push_back({&kv.second, &meta});
+
+    std::vector<std::vector<std::string>> issues(levels.size());
+    parallel_for((int)levels.size(), [&levels, &issues](int i)
+    {
+        issues[i] = solve_level(levels[i].first, levels[i].second);
+    });
+
+    int issue_count = 0;
+    for (int i = 0, len = (int)levels.size(); i < len; ++i)
+    {
+        for (const auto& issue : issues[i])
+        {
+            OLogE(levels[i].first->name + " - " + issue);
+            ++issue_count;
+        }
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    OLog("Reachability: " + std::to_string(levels.size()) + " levels, " + std::to_string(issue_count) + " issues, " + std::to_string(elapsed.count()) + " ms");
+    return issue_count;
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+
+struct game_t;
+struct meta_t;
+
+
+// Checks one level's regions against its rules. Returns one line per issue:
+// locations no region can reach, regions that need an item the level
+// doesn't have, locations that sit in no region.
+std::vector<std::string> solve_level(const game_t* game, meta_t* meta);
+
+// Runs solve_level on every level of every game in parallel and logs the
+// issues. Returns the issue count.
+int check_reachability();
@@ -0,0 +1,110 @@
+#include "spatial.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+int spatial_grid_t::cell_coord(float v) const
+{
+    return (int)std::floor(v / m_cell_size);
+}
+
+
+void spatial_grid_t::clear()
+{
+    m_cells.clear();
+    m_boxes.clear();
+}
+
+
+void spatial_grid_t::insert(int id, float x1, float y1, float x2, float y2)
+{
+    if (x1 > x2) std::swap(x1, x2);
+    if (y1 > y2) std::swap(y1, y2);
+    m_boxes[id] = {x1, y1, x2, y2};
+    for (int cy = cell_coord(y1), cy2 = cell_coord(y2); cy <= cy2; ++cy)
+        for (int cx = cell_coord(x1), cx2 = cell_coord(x2); cx <= cx2; ++cx)
+            m_cells[cell_key(cx, cy)].push_back(id);
+}
+
+
+void spatial_grid_t::remove(int id)
+{
+    auto it = m_boxes.find(id);
+    if (it == m_boxes.end()) return;
+    const auto box = it->second;
+    m_boxes.erase(it);
+
+    for (int cy = cell_coord(box.y1), cy2 = cell_coord(box.y2); cy <= cy2; ++cy)
+    {
+        for (int cx = cell_coord(box.x1), cx2 = cell_coord(box.x2); cx <= cx2; ++cx)
+        {
+            auto cell_it = m_cells.find(cell_key(cx, cy));
+            if (cell_it == m_cells.end()) continue;
+            auto& ids = cell_it->second;
+            ids.erase(std::remove(ids.begin(), ids.end(), id), ids.end());
+            if (ids.empty()) m_cells.erase(cell_it);
+        }
+    }
+}
+
+
+void spatial_grid_t::update(int id, float x1, float y1, float x2, float y2)
+{
+    if (x1 > x2) std::swap(x1, x2);
+    if (y1 > y2) std::swap(y1, y2);
+    auto it = m_boxes.find(id);
+    if (it != m_boxes.end())
+    {
+        const auto& box = it->second;
+        if (box.x1 == x1 && box.y1 == y1 && box.x2 == x2 && box.y2 == y2) return;
+        remove(id);
+    }
+    insert(id, x1, y1, x2, y2);
+}
+
+
+void spatial_grid_t::query(float x1, float y1, float x2, float y2, std::vector<int>& out) const
+{
+    out.clear();
+    if (x1 > x2) std::swap(x1, x2);
+    if (y1 > y2) std::swap(y1, y2);
+
+    // Huge query, i.e. zoomed all the way out. Walking the boxes is cheaper.
+    if (((double)cell_coord(x2) - cell_coord(x1) + 1) * ((double)cell_coord(y2) - cell_coord(y1) + 1) > (double)m_boxes.size())
+    {
+        for (const auto& kv : m_boxes)
+        {
+            const auto& box = kv.second;
+            if (box.x2 < x1 || box.x1 > x2 || box.y2 < y1 || box.y1 > y2) continue;
+            out.push_back(kv.first);
+        }
+        std::sort(out.begin(), out.end());
+        return;
+    }
+
+    for (int cy = cell_coord(y1), cy2 = cell_coord(y2); cy <= cy2; ++cy)
+    {
+        for (int cx = cell_coord(x1), cx2 = cell_coord(x2); cx <= cx2; ++cx)
+        {
+            auto cell_it = m_cells.find(cell_key(cx, cy));
+            if (cell_it == m_cells.end()) continue;
+            for (auto id : cell_it->second)
+            {
+                const auto& box = m_boxes.at(id);
+                if (box.x2 < x1 || box.x1 > x2 || box.y2 < y1 || box.y1 > y2) continue;
+                out.push_back(id);
+            }
+        }
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
+
+
+void spatial_grid_t::get_ids(std::vector<int>& out) const
+{
+    out.clear();
+    for (const auto& kv : m_boxes)
+        out.push_back(kv.first);
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+
+// Uniform grid over unbounded space. Items are ids with a box, listed in
+// every cell the box touches. Queries only return candidates, callers still
+// do their exact test (And keep their own priority order).
+class spatial_grid_t
+{
+public:
+    explicit spatial_grid_t(float cell_size = 256.0f) : m_cell_size(cell_size) {}
+
+    void clear();
+    void insert(int id, float x1, float y1, float x2, float y2);
+    void remove(int id);
+    void update(int id, float x1, float y1, float x2, float y2); // No-op if the box didn't change
+    bool contains(int id) const { return m_boxes.count(id) != 0; }
+
+    // Ids whose box overlaps the query box, sorted, no duplicates
+    void query(float x1, float y1, float x2, float y2, std::vector<int>& out) const;
+    void query(float x, float y, std::vector<int>& out) const { query(x, y, x, y, out); }
+
+    // Ids currently indexed
+    void get_ids(std::vector<int>& out) const;
+
+private:
+    struct box_t
+    {
+        float x1, y1, x2, y2;
+    };
+
+    int cell_coord(float v) const;
+    static uint64_t cell_key(int cx, int cy) { return ((uint64_t)(uint32_t)cx << 32) | (uint32_t)cy; }
+
+    float m_cell_size;
+    std::unordered_map<uint64_t, std::vector<int>> m_cells;
+    std::unordered_map<int, box_t> m_boxes;
+};
@@ -0,0 +1,366 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+//
+// *In-process stand-in for the Archipelago server and APCpp transport*
+//
+
+#include "ap_mock.h"
+#include "Archipelago.h"
+#include <chrono>
+#include <deque>
+#include <memory>
+
+
+static AP_ConnectionStatus connection_status = AP_ConnectionStatus::Disconnected;
+static AP_RoomInfo room_info;
+static bool deathlink_supported = false;
+static bool deathlink_pending = false;
+static int received_item_count = 0;
+static int notified_item_count = 0;
+static std::deque<std::unique_ptr<AP_Message>> messages;
+
+static void (*itemclr_callback)() = nullptr;
+static void (*itemrecv_callback)(int64_t, int, bool) = nullptr;
+static void (*locrecv_callback)(int64_t) = nullptr;
+static void (*locinfo_callback)(std::vector<AP_NetworkItem>) = nullptr;
+static std::map<std::string, void (*)(int)> slot_data_callbacks;
+
+static std::map<std::string, mock_stats_t> callback_stats;
+static std::map<std::string, std::pair<int, int>> sent_packets;
+
+
+void mock_stats_t::add(double ms)
+{
+    ++count;
+    total_ms += ms;
+    if (ms > max_ms) max_ms = ms;
+}
+
+
+template<typename F>
+static void timed_callback(const char* name, F&& f)
+{
+    auto start = std::chrono::steady_clock::now();
+    f();
+    auto end = std::chrono::steady_clock::now();
+    callback_stats[name].add(std::chrono::duration<double, std::milli>(end - start).count());
+}
+
+
+static void on_sent(const char* cmd, int count)
+{
+    auto& sent = sent_packets[cmd];
+    sent.first++;
+    sent.second += count;
+}
+
+
+static void deliver_checked_locations(const Json::Value& loc_ids)
+{
+    if (!locrecv_callback) return;
+    for (const auto& loc_id : loc_ids)
+        timed_callback("f_locrecv", [&]() { locrecv_callback(loc_id.asInt64()); });
+}
+
+
+static AP_Message* make_message(const Json::Value& packet)
+{
+    std::string type = packet.get("type", "").asString();
+    if (type == "ItemSend")
+    {
+        auto msg = new AP_ItemSendMessage();
+        msg->type = AP_MessageType::ItemSend;
+        msg->item = packet["item"].asString();
+        msg->recvPlayer = packet["receiving"].asString();
+        msg->text = msg->item + " was sent to " + msg->recvPlayer;
+        return msg;
+    }
+    if (type == "ItemRecv")
+    {
+        auto msg = new AP_ItemRecvMessage();
+        msg->type = AP_MessageType::ItemRecv;
+        msg->item = packet["item"].asString();
+        msg->sendPlayer = packet["sending"].asString();
+        msg->text = "Received " + msg->item + " from " + msg->sendPlayer;
+        return msg;
+    }
+    if (type == "Hint")
+    {
+        auto msg = new AP_HintMessage();
+        msg->type = AP_MessageType::Hint;
+        msg->item = packet["item"].asString();
+        msg->sendPlayer = packet["sending"].asString();
+        msg->recvPlayer = packet["receiving"].asString();
+        msg->location = packet["location"].asString();
+        msg->checked = packet["found"].asBool();
+        msg->text = msg->item + " from " + msg->sendPlayer + " to " + msg->recvPlayer + " at " + msg->location;
+        return msg;
+    }
+    auto msg = new AP_Message();
+    msg->text = packet["text"].asString();
+    return msg;
+}
+
+
+bool mock_deliver(const Json::Value& packet)
+{
+    std::string cmd = packet["cmd"].asString();
+
+    if (cmd == "RoomInfo")
+    {
+        room_info.version.major = packet["version"]["major"].asInt();
+        room_info.version.minor = packet["version"]["minor"].asInt();
+        room_info.version.build = packet["version"]["build"].asInt();
+        room_info.tags.clear();
+        for (const auto& tag : packet["tags"])
+            room_info.tags.push_back(tag.asString());
+        room_info.password_required = packet["password"].asBool();
+        room_info.hint_cost = packet["hint_cost"].asInt();
+        room_info.location_check_points = packet["location_check_points"].asInt();
+        room_info.seed_name = packet["seed_name"].asString();
+        room_info.time = packet["time"].asDouble();
+        return true;
+    }
+
+    if (cmd == "Connected")
+    {
+        for (const auto& key : packet["slot_data"].getMemberNames())
+        {
+            auto it = slot_data_callbacks.find(key);
+            if (it == slot_data_callbacks.end() || !packet["slot_data"][key].isInt()) continue;
+            int value = packet["slot_data"][key].asInt();
+            timed_callback("slot_data", [&]() { it->second(value); });
+        }
+        deliver_checked_locations(packet["checked_locations"]);
+        connection_status = AP_ConnectionStatus::Authenticated;
+        return true;
+    }
+
+    if (cmd == "ConnectionRefused")
+    {
+        connection_status = AP_ConnectionStatus::ConnectionRefused;
+        return true;
+    }
+
+    if (cmd == "ReceivedItems")
+    {
+        int index = packet["index"].asInt();
+        if (index == 0)
+        {
+            received_item_count = 0;
+            if (itemclr_callback)
+                timed_callback("f_itemclr", [&]() { itemclr_callback(); });
+        }
+        for (const auto& item : packet["items"])
+        {
+            // Like APCpp, only items we didn't have yet are notified
+            bool notify = index >= received_item_count;
+            if (notify) ++notified_item_count;
+            if (itemrecv_callback)
+                timed_callback("f_itemrecv", [&]() { itemrecv_callback(item["item"].asInt64(), item["player"].asInt(), notify); });
+            ++index;
+        }
+        if (index > received_item_count) received_item_count = index;
+        return true;
+    }
+
+    if (cmd == "LocationInfo")
+    {
+        std::vector<AP_NetworkItem> loc_infos;
+        for (const auto& location : packet["locations"])
+        {
+            AP_NetworkItem loc_info;
+            loc_info.item = location["item"].asInt64();
+            loc_info.location = location["location"].asInt64();
+            loc_info.player = location["player"].asInt();
+            loc_info.flags = location["flags"].asInt();
+            loc_infos.push_back(loc_info);
+        }
+        if (locinfo_callback)
+            timed_callback("f_locinfo", [&]() { locinfo_callback(loc_infos); });
+        return true;
+    }
+
+    if (cmd == "RoomUpdate")
+    {
+        deliver_checked_locations(packet["checked_locations"]);
+        return true;
+    }
+
+    if (cmd == "Bounced")
+    {
+        for (const auto& tag : packet["tags"])
+            if (tag.asString() == "DeathLink" && deathlink_supported)
+                deathlink_pending = true;
+        return true;
+    }
+
+    if (cmd == "PrintJSON")
+    {
+        messages.emplace_back(make_message(packet));
+        return true;
+    }
+
+    if (cmd == "Disconnect")
+    {
+        connection_status = AP_ConnectionStatus::Disconnected;
+        return true;
+    }
+
+    if (cmd == "Reconnect")
+    {
+        connection_status = AP_ConnectionStatus::Authenticated;
+        return true;
+    }
+
+    return false;
+}
+
+
+const std::map<std::string, mock_stats_t>& mock_get_callback_stats()
+{
+    return callback_stats;
+}
+
+
+const std::map<std::string, std::pair<int, int>>& mock_get_sent_packets()
+{
+    return sent_packets;
+}
+
+
+int mock_get_notified_item_count()
+{
+    return notified_item_count;
+}
+
+
+//
+// APCpp API
+//
+
+void AP_Init(const char* ip, const char* game, const char* player_name, const char* passwd)
+{
+    printf("MOCK: AP_Init(%s, %s, %s)\n", ip, game, player_name);
+}
+
+void AP_Start()
+{
+    connection_status = AP_ConnectionStatus::Connected;
+}
+
+void AP_Shutdown()
+{
+    connection_status = AP_ConnectionStatus::Disconnected;
+}
+
+void AP_SetClientVersion(AP_NetworkVersion* version) {}
+
+void AP_SetDeathLinkSupported(bool supported)
+{
+    deathlink_supported = supported;
+}
+
+void AP_SetItemClearCallback(void (*f_itemclr)())
+{
+    itemclr_callback = f_itemclr;
+}
+
+void AP_SetItemRecvCallback(void (*f_itemrecv)(int64_t, int, bool))
+{
+    itemrecv_callback = f_itemrecv;
+}
+
+void AP_SetLocationCheckedCallback(void (*f_locrecv)(int64_t))
+{
+    locrecv_callback = f_locrecv;
+}
+
+void AP_SetLocationInfoCallback(void (*f_locinfo)(std::vector<AP_NetworkItem>))
+{
+    locinfo_callback = f_locinfo;
+}
+
+void AP_RegisterSlotDataIntCallback(std::string key, void (*f_slotdata)(int))
+{
+    slot_data_callbacks[key] = f_slotdata;
+}
+
+AP_ConnectionStatus AP_GetConnectionStatus()
+{
+    return connection_status;
+}
+
+int AP_GetRoomInfo(AP_RoomInfo* out_room_info)
+{
+    *out_room_info = room_info;
+    return 0;
+}
+
+void AP_SendItem(int64_t loc_id)
+{
+    on_sent("LocationChecks", 1);
+}
+
+void AP_SendItem(std::set<int64_t> const& loc_ids)
+{
+    on_sent("LocationChecks", (int)loc_ids.size());
+}
+
+void AP_SendLocationScouts(std::vector<int64_t> const& loc_ids, int create_as_hint)
+{
+    on_sent("LocationScouts", (int)loc_ids.size());
+}
+
+void AP_StoryComplete()
+{
+    on_sent("StatusUpdate", 1);
+}
+
+void AP_DeathLinkSend()
+{
+    on_sent("Bounce", 1);
+}
+
+void AP_DeathLinkClear()
+{
+    deathlink_pending = false;
+}
+
+bool AP_DeathLinkPending()
+{
+    return deathlink_pending;
+}
+
+bool AP_IsMessagePending()
+{
+    return !messages.empty();
+}
+
+AP_Message* AP_GetLatestMessage()
+{
+    return messages.front().get();
+}
+
+void AP_ClearLatestMessage()
+{
+    if (!messages.empty())
+        messages.pop_front();
+}
+
+// Not in Archipelago.h, apdoom declares it itself. Sends a raw packet
+void APSend(std::string msg)
+{
+    on_sent("Raw", 1);
+}
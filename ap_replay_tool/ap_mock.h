@@ -0,0 +1,48 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+//
+// *In-process stand-in for the Archipelago server and APCpp transport.
+// Trace packets are handed to apdoom's callbacks like APCpp would*
+//
+
+#pragma once
+
+#include <json/json.h>
+#include <map>
+#include <string>
+
+
+struct mock_stats_t
+{
+    int count = 0;
+    double total_ms = 0.0;
+    double max_ms = 0.0;
+
+    void add(double ms);
+};
+
+
+// Dispatches one server packet ("cmd" is the AP command, plus a few mock
+// only ones like "Disconnect" and "Reconnect"). Returns false if unknown.
+bool mock_deliver(const Json::Value& packet);
+
+// Latency of apdoom callbacks, by name
+const std::map<std::string, mock_stats_t>& mock_get_callback_stats();
+
+// Packets apdoom sent, by AP command. Values are the number of packets,
+// and the number of locations/ids they carried.
+const std::map<std::string, std::pair<int, int>>& mock_get_sent_packets();
+
+// Items handed to apdoom as new ones, which it has to give to the player
+int mock_get_notified_item_count();
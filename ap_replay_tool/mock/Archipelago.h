@@ -0,0 +1,124 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+//
+// *Stand-in for APCpp's Archipelago.h. Only what apdoom.cpp uses, backed
+// by the in-process mock server in ap_mock.cpp*
+//
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+
+struct AP_NetworkVersion
+{
+    int major;
+    int minor;
+    int build;
+};
+
+struct AP_NetworkItem
+{
+    int64_t item;
+    int64_t location;
+    int player;
+    int flags;
+    std::string itemName;
+    std::string locationName;
+    std::string playerName;
+};
+
+enum struct AP_ConnectionStatus
+{
+    Disconnected, Connected, Authenticated, ConnectionRefused
+};
+
+enum struct AP_MessageType
+{
+    Plaintext, ItemSend, ItemRecv, Hint, Countdown
+};
+
+struct AP_Message
+{
+    AP_MessageType type = AP_MessageType::Plaintext;
+    std::string text;
+    virtual ~AP_Message() {}
+};
+
+struct AP_ItemSendMessage : AP_Message
+{
+    std::string item;
+    std::string recvPlayer;
+};
+
+struct AP_ItemRecvMessage : AP_Message
+{
+    std::string item;
+    std::string sendPlayer;
+};
+
+struct AP_HintMessage : AP_Message
+{
+    std::string item;
+    std::string sendPlayer;
+    std::string recvPlayer;
+    std::string location;
+    bool checked;
+};
+
+struct AP_RoomInfo
+{
+    AP_NetworkVersion version;
+    std::vector<std::string> tags;
+    bool password_required;
+    std::map<std::string, int> permissions;
+    int hint_cost;
+    int location_check_points;
+    std::map<std::string, std::string> datapackage_checksums;
+    std::string seed_name;
+    double time;
+};
+
+
+void AP_Init(const char* ip, const char* game, const char* player_name, const char* passwd);
+void AP_Start();
+void AP_Shutdown();
+void AP_SetClientVersion(AP_NetworkVersion* version);
+void AP_SetDeathLinkSupported(bool supported);
+
+void AP_SetItemClearCallback(void (*f_itemclr)());
+void AP_SetItemRecvCallback(void (*f_itemrecv)(int64_t item_id, int player_id, bool notify_player));
+void AP_SetLocationCheckedCallback(void (*f_locrecv)(int64_t loc_id));
+void AP_SetLocationInfoCallback(void (*f_locinfo)(std::vector<AP_NetworkItem> loc_infos));
+void AP_RegisterSlotDataIntCallback(std::string key, void (*f_slotdata)(int));
+
+AP_ConnectionStatus AP_GetConnectionStatus();
+int AP_GetRoomInfo(AP_RoomInfo* room_info);
+
+void AP_SendItem(int64_t loc_id);
+void AP_SendItem(std::set<int64_t> const& loc_ids);
+void AP_SendLocationScouts(std::vector<int64_t> const& loc_ids, int create_as_hint);
+void AP_StoryComplete();
+
+void AP_DeathLinkSend();
+void AP_DeathLinkClear();
+bool AP_DeathLinkPending();
+
+bool AP_IsMessagePending();
+AP_Message* AP_GetLatestMessage();
+void AP_ClearLatestMessage();
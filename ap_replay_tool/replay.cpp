@@ -0,0 +1,516 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+//
+// *Replays recorded Archipelago packet traces through apdoom, without a
+// server or network. Reports the latency of every callback and the total
+// CPU time, to regression-test the AP layer's throughput*
+//
+// Usage:
+//   ap_replay_tool -game doom|doom2|heretic|hexen -trace file.jsonl
+//   ap_replay_tool -game doom|doom2|heretic|hexen -generate file.jsonl [-items 5000]
+//   ap_replay_tool -game doom|doom2|heretic|hexen -lookups 10000
+//
+// A trace has one server packet per line ({"cmd": "ReceivedItems", ...}),
+// see ap_mock.cpp. Two more commands drive the game side:
+//   {"cmd": "Tic", "count": 35}   Runs apdoom_update() as the game loop would
+//   {"cmd": "Check", "count": 10} Checks the next locations, all in one tic
+//
+// -lookups times find_location() over that many location ids, against a
+// scan of the location table like it was done before the index.
+//
+// A replay exits with 1 if any new item from the trace isn't given to the
+// player within 10 minutes of game time after it.
+//
+// State is saved in the working directory like the game does, run it from
+// an empty one.
+//
+
+#include "ap_mock.h"
+#include "apdoom.h"
+#include "apdoom_def.h"
+#include "apdoom2_def.h"
+#include "apheretic_def.h"
+#include "aphexen_def.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+
+struct replay_game_t
+{
+    const char* codename;
+    const char* ap_name;
+    const ap_location_def_t* locations;
+    int location_count;
+    const ap_item_def_t* items;
+    int item_count;
+};
+
+
+#define REPLAY_GAME(codename, ap_name) { \
+    #codename, ap_name, \
+    ap_##codename##_locations, (int)std::size(ap_##codename##_locations), \
+    ap_##codename##_items, (int)std::size(ap_##codename##_items) }
+
+static const replay_game_t replay_games[] = {
+    REPLAY_GAME(doom, "DOOM 1993"),
+    REPLAY_GAME(doom2, "DOOM II"),
+    REPLAY_GAME(heretic, "Heretic"),
+    REPLAY_GAME(hexen, "Hexen")
+};
+
+
+bool find_location(int64_t loc_id, int &ep, int &map, int &index); // apdoom.cpp
+
+
+static int given_item_count = 0;
+static int message_count = 0;
+static int death_count = 0;
+static bool victory = false;
+static mock_stats_t update_stats;
+static int next_check = 0;
+
+
+static void on_message(const char* text)
+{
+    ++message_count;
+}
+
+
+static void on_give_item(int doom_type, int ep, int map)
+{
+    ++given_item_count;
+}
+
+
+static void on_victory()
+{
+    victory = true;
+}
+
+
+static void run_tic()
+{
+    auto start = std::chrono::steady_clock::now();
+    apdoom_update();
+    auto end = std::chrono::steady_clock::now();
+    update_stats.add(std::chrono::duration<double, std::milli>(end - start).count());
+
+    if (apdoom_get_init_state() == AP_INIT_STATE_READY)
+        ap_is_in_game = 1;
+
+    // Die like a player would
+    if (apdoom_should_die())
+    {
+        ++death_count;
+        apdoom_clear_death();
+    }
+}
+
+
+static void check_locations(const replay_game_t& game, int count)
+{
+    for (int i = 0; i < count && next_check < game.location_count; ++next_check)
+    {
+        const auto& key = game.locations[next_check].key;
+        if (key.index < 0) continue; // Level exits, these come from the game itself
+        apdoom_check_location(ap_make_level_index(key.ep, key.map), key.index);
+        ++i;
+    }
+}
+
+
+static void write_packet(std::ofstream& f, const Json::Value& packet)
+{
+    Json::StreamWriterBuilder builder;
+    builder["indentation"] = "";
+    f << Json::writeString(builder, packet) << "\n";
+}
+
+
+static Json::Value make_tic(int count)
+{
+    Json::Value packet;
+    packet["cmd"] = "Tic";
+    packet["count"] = count;
+    return packet;
+}
+
+
+// Connect, slot data, a LocationInfo flood answering the scouts, a big
+// ReceivedItems burst, checks, chat and DeathLink bursts, and a reconnect
+static bool generate_trace(const replay_game_t& game, const char* filename, int item_count)
+{
+    std::ofstream f(filename);
+    if (!f.is_open())
+    {
+        printf("Failed to write %s\n", filename);
+        return false;
+    }
+
+    Json::Value room_info;
+    room_info["cmd"] = "RoomInfo";
+    room_info["version"]["major"] = 0;
+    room_info["version"]["minor"] = 4;
+    room_info["version"]["build"] = 4;
+    room_info["tags"].append("AP");
+    room_info["seed_name"] = std::string("replay_") + game.codename;
+    write_packet(f, room_info);
+
+    Json::Value connected;
+    connected["cmd"] = "Connected";
+    bool hexen = strcmp(game.codename, "hexen") == 0;
+    for (int i = 1; i <= 5; ++i)
+        connected["slot_data"][(hexen ? "hub" : "episode") + std::to_string(i)] = 1;
+    connected["slot_data"]["goal"] = 1;
+    connected["checked_locations"] = Json::Value(Json::arrayValue);
+    write_packet(f, connected);
+    write_packet(f, make_tic(1));
+
+    Json::Value location_info;
+    location_info["cmd"] = "LocationInfo";
+    for (int i = 0; i < game.location_count; ++i)
+    {
+        Json::Value location;
+        location["item"] = (Json::Int64)game.items[i % game.item_count].id;
+        location["location"] = (Json::Int64)game.locations[i].id;
+        location["player"] = 1;
+        location["flags"] = (i % 3 == 0) ? 1 : 0;
+        location_info["locations"].append(location);
+    }
+    write_packet(f, location_info);
+    write_packet(f, make_tic(1));
+
+    Json::Value received_items;
+    received_items["cmd"] = "ReceivedItems";
+    received_items["index"] = 0;
+    received_items["items"] = Json::Value(Json::arrayValue);
+    for (int i = 0; i < item_count; ++i)
+    {
+        Json::Value item;
+        item["item"] = (Json::Int64)game.items[i % game.item_count].id;
+        item["location"] = (Json::Int64)game.locations[i % game.location_count].id;
+        item["player"] = 2;
+        item["flags"] = 0;
+        received_items["items"].append(item);
+    }
+    write_packet(f, received_items);
+    write_packet(f, make_tic(35));
+
+    // Clearing item rooms
+    for (int i = 0; i < 20; ++i)
+    {
+        Json::Value check;
+        check["cmd"] = "Check";
+        check["count"] = 8;
+        write_packet(f, check);
+        write_packet(f, make_tic(1));
+    }
+
+    // Server confirms some of them, while the chat is busy
+    Json::Value room_update;
+    room_update["cmd"] = "RoomUpdate";
+    for (int i = 0; i < 80 && i < game.location_count; ++i)
+        room_update["checked_locations"].append((Json::Int64)game.locations[i].id);
+    write_packet(f, room_update);
+    for (int i = 0; i < 500; ++i)
+    {
+        Json::Value message;
+        message["cmd"] = "PrintJSON";
+        message["type"] = "ItemSend";
+        message["item"] = "Replay item " + std::to_string(i);
+        message["receiving"] = "Player" + std::to_string(i % 8);
+        write_packet(f, message);
+    }
+    write_packet(f, make_tic(35));
+
+    // DeathLink bursts
+    for (int burst = 0; burst < 10; ++burst)
+    {
+        for (int i = 0; i < 20; ++i)
+        {
+            Json::Value bounced;
+            bounced["cmd"] = "Bounced";
+            bounced["tags"].append("DeathLink");
+            bounced["data"]["source"] = "Player" + std::to_string(i % 8);
+            write_packet(f, bounced);
+        }
+        write_packet(f, make_tic(5));
+    }
+
+    // Drop, keep checking offline, come back
+    Json::Value disconnect;
+    disconnect["cmd"] = "Disconnect";
+    write_packet(f, disconnect);
+    Json::Value check;
+    check["cmd"] = "Check";
+    check["count"] = 16;
+    write_packet(f, check);
+    write_packet(f, make_tic(35));
+    Json::Value reconnect;
+    reconnect["cmd"] = "Reconnect";
+    write_packet(f, reconnect);
+    write_packet(f, make_tic(35));
+
+    printf("Wrote %s\n", filename);
+    return true;
+}
+
+
+static void print_stats(const char* name, const mock_stats_t& stats)
+{
+    printf("  %-16s %8i %12.3f %12.3f %12.3f\n", name, stats.count, stats.total_ms,
+           stats.count ? stats.total_ms * 1000.0 / stats.count : 0.0, stats.max_ms * 1000.0);
+}
+
+
+static void init_settings(const replay_game_t& game, ap_settings_t& ap_settings)
+{
+    memset(&ap_settings, 0, sizeof(ap_settings));
+    ap_settings.ip = "mock";
+    ap_settings.game = game.ap_name;
+    ap_settings.player_name = "Replay";
+    ap_settings.passwd = "";
+    ap_settings.message_callback = on_message;
+    ap_settings.give_item_callback = on_give_item;
+    ap_settings.victory_callback = on_victory;
+}
+
+
+static bool scan_location(const replay_game_t& game, int64_t loc_id, int& ep, int& map, int& index)
+{
+    for (int i = 0; i < game.location_count; ++i)
+    {
+        if (game.locations[i].id == loc_id)
+        {
+            ep = game.locations[i].key.ep;
+            map = game.locations[i].key.map;
+            index = game.locations[i].key.index;
+            return ep > 0;
+        }
+    }
+    ep = -1;
+    map = -1;
+    index = -1;
+    return false;
+}
+
+
+static int run_lookups(const replay_game_t& game, int count)
+{
+    ap_settings_t ap_settings;
+    init_settings(game, ap_settings);
+
+    auto index_start = std::chrono::steady_clock::now();
+    if (!apdoom_init(&ap_settings))
+    {
+        printf("apdoom_init failed\n");
+        return 1;
+    }
+    double init_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - index_start).count();
+
+    // Spread over the whole table, with one id in 16 that isn't in it
+    std::vector<int64_t> loc_ids;
+    loc_ids.reserve(count);
+    uint32_t seed = 1;
+    for (int i = 0; i < count; ++i)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        if (i % 16 == 15)
+            loc_ids.push_back(-(int64_t)seed - 1);
+        else
+            loc_ids.push_back(game.locations[(seed >> 8) % game.location_count].id);
+    }
+
+    int ep, map, index;
+    int64_t scan_sum = 0, index_sum = 0;
+
+    auto scan_start = std::chrono::steady_clock::now();
+    for (auto loc_id : loc_ids)
+    {
+        scan_location(game, loc_id, ep, map, index);
+        scan_sum += ep * 1000000 + map * 1000 + index;
+    }
+    auto scan_end = std::chrono::steady_clock::now();
+    for (auto loc_id : loc_ids)
+    {
+        find_location(loc_id, ep, map, index);
+        index_sum += ep * 1000000 + map * 1000 + index;
+    }
+    auto index_end = std::chrono::steady_clock::now();
+
+    int mismatches = 0;
+    for (auto loc_id : loc_ids)
+    {
+        int ep2, map2, index2;
+        bool found = find_location(loc_id, ep, map, index);
+        bool scanned = scan_location(game, loc_id, ep2, map2, index2);
+        if (found != scanned || ep != ep2 || map != map2 || index != index2)
+            ++mismatches;
+    }
+
+    apdoom_shutdown();
+
+    printf("\n%i location lookups (%s, %i locations)\n", count, game.ap_name, game.location_count);
+    printf("  Table scan: %12.3f ms\n", std::chrono::duration<double, std::milli>(scan_end - scan_start).count());
+    printf("  Index:      %12.3f ms\n", std::chrono::duration<double, std::milli>(index_end - scan_end).count());
+    printf("  apdoom_init, index included: %.3f ms\n", init_ms);
+    printf("  Mismatches: %i%s\n", mismatches, scan_sum == index_sum ? "" : " (sums differ)");
+    return mismatches ? 1 : 0;
+}
+
+
+static int replay_trace(const replay_game_t& game, const char* filename)
+{
+    std::ifstream f(filename);
+    if (!f.is_open())
+    {
+        printf("Failed to open %s\n", filename);
+        return 1;
+    }
+
+    std::vector<Json::Value> packets;
+    Json::CharReaderBuilder builder;
+    std::string line;
+    while (std::getline(f, line))
+    {
+        if (line.empty()) continue;
+        Json::Value packet;
+        std::string errors;
+        std::unique_ptr<Json::CharReader> reader(builder.newCharReader());
+        if (!reader->parse(line.data(), line.data() + line.size(), &packet, &errors))
+        {
+            printf("Bad packet in %s: %s\n", filename, errors.c_str());
+            return 1;
+        }
+        packets.push_back(packet);
+    }
+
+    ap_settings_t ap_settings;
+    init_settings(game, ap_settings);
+
+    std::clock_t cpu_start = std::clock();
+    auto wall_start = std::chrono::steady_clock::now();
+
+    if (!apdoom_init(&ap_settings))
+    {
+        printf("apdoom_init failed\n");
+        return 1;
+    }
+
+    for (const auto& packet : packets)
+    {
+        std::string cmd = packet["cmd"].asString();
+        if (cmd == "Tic")
+        {
+            int count = packet.get("count", 1).asInt();
+            for (int i = 0; i < count; ++i)
+                run_tic();
+        }
+        else if (cmd == "Check")
+        {
+            check_locations(game, packet.get("count", 1).asInt());
+        }
+        else if (!mock_deliver(packet))
+        {
+            printf("Unknown packet: %s\n", cmd.c_str());
+        }
+    }
+
+    // Let the queues drain, until nothing happens for 2 seconds. Past 10
+    // minutes the items aren't coming, and the replay fails.
+    const int drain_cap = 35 * 60 * 10;
+    int idle_tics = 0;
+    int drain_tics = 0;
+    while (idle_tics < 70 && drain_tics < drain_cap)
+    {
+        int previous_count = given_item_count + message_count;
+        run_tic();
+        ++drain_tics;
+        idle_tics = (given_item_count + message_count == previous_count) ? idle_tics + 1 : 0;
+    }
+
+    apdoom_shutdown();
+
+    double cpu_ms = (double)(std::clock() - cpu_start) * 1000.0 / CLOCKS_PER_SEC;
+    double wall_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall_start).count();
+
+    printf("\nReplayed %i packets (%s)\n", (int)packets.size(), game.ap_name);
+    printf("  Init: %s\n", apdoom_get_init_state() == AP_INIT_STATE_READY ? "ready" : apdoom_get_init_status_text());
+    printf("  Items given: %i, messages: %i, deaths: %i, victory: %s\n",
+           given_item_count, message_count, death_count, victory ? "yes" : "no");
+    printf("  Tics to drain after the trace: %i\n", drain_tics - idle_tics);
+
+    printf("\n  %-16s %8s %12s %12s %12s\n", "Callback", "Count", "Total ms", "Avg us", "Max us");
+    for (const auto& kv : mock_get_callback_stats())
+        print_stats(kv.first.c_str(), kv.second);
+    print_stats("apdoom_update", update_stats);
+
+    printf("\n  %-16s %8s %12s\n", "Sent", "Packets", "Ids");
+    for (const auto& kv : mock_get_sent_packets())
+        printf("  %-16s %8i %12i\n", kv.first.c_str(), kv.second.first, kv.second.second);
+
+    printf("\n  CPU time: %.3f ms, wall time: %.3f ms\n", cpu_ms, wall_ms);
+
+    // Loaded state can give more, the new ones all have to make it
+    int notified_count = mock_get_notified_item_count();
+    if (idle_tics < 70 || given_item_count < notified_count)
+    {
+        printf("\nFAILED: %i new items, %i given, %s\n", notified_count, given_item_count,
+               idle_tics < 70 ? "still draining at the cap" : "drained");
+        return 1;
+    }
+    return 0;
+}
+
+
+int main(int argc, char** argv)
+{
+    const char* game_name = nullptr;
+    const char* trace_filename = nullptr;
+    const char* generate_filename = nullptr;
+    int item_count = 5000;
+    int lookup_count = 0;
+
+    for (int i = 1; i < argc - 1; ++i)
+    {
+        if (strcmp(argv[i], "-game") == 0) game_name = argv[++i];
+        else if (strcmp(argv[i], "-trace") == 0) trace_filename = argv[++i];
+        else if (strcmp(argv[i], "-generate") == 0) generate_filename = argv[++i];
+        else if (strcmp(argv[i], "-items") == 0) item_count = atoi(argv[++i]);
+        else if (strcmp(argv[i], "-lookups") == 0) lookup_count = atoi(argv[++i]);
+    }
+
+    const replay_game_t* game = nullptr;
+    for (const auto& replay_game : replay_games)
+        if (game_name && strcmp(game_name, replay_game.codename) == 0)
+            game = &replay_game;
+
+    if (!game || (!trace_filename && !generate_filename && lookup_count <= 0))
+    {
+        printf("Usage: %s -game doom|doom2|heretic|hexen (-trace file.jsonl | -generate file.jsonl [-items 5000] | -lookups 10000)\n", argv[0]);
+        return 1;
+    }
+
+    if (lookup_count > 0)
+        return run_lookups(*game, lookup_count);
+    if (generate_filename)
+        return generate_trace(*game, generate_filename, item_count) ? 0 : 1;
+    return replay_trace(*game, trace_filename);
+}
@@ -0,0 +1,189 @@
+#include "ap_notif_icons.h"
+#include "apdoom.h"
+#include "crispy.h"
+#include "doomtype.h"
+#include "i_swap.h"
+#include "i_video.h"
+#include "v_patch.h"
+#include "v_video.h"
+#include "w_wad.h"
+#include "z_zone.h"
+#include <string.h>
+
+
+#define ICON_BLOCK_SIZE (AP_NOTIF_SIZE - 4)
+#define ICON_CELL_PIXELS (AP_NOTIF_SIZE * AP_NOTIF_SIZE)
+
+
+// One AP_NOTIF_SIZE x AP_NOTIF_SIZE cell per unique sprite, in palette
+// indices like the patches, so truecolor maps them when drawing
+static pixel_t* atlas_pixels = NULL;
+static byte* atlas_mask = NULL;
+static int* sprite_cells = NULL; // Type sprite index -> cell, or -1
+static int sprite_count = 0;
+
+
+// Unpack patch columns into a width x height block
+static void rasterize_patch(patch_t* patch, pixel_t* pixels, byte* mask)
+{
+    int width = SHORT(patch->width);
+
+    for (int x = 0; x < width; ++x)
+    {
+        column_t* column = (column_t *)((byte *)patch + LONG(patch->columnofs[x]));
+
+        // step through the posts in a column
+        while (column->topdelta != 0xff)
+        {
+            byte* source = (byte *)column + 3;
+
+            for (int y = 0; y < column->length; ++y)
+            {
+                int k = (y + column->topdelta) * width + x;
+                pixels[k] = *source++;
+                mask[k] = 1;
+            }
+
+            column = (column_t *)((byte *)column + column->length + 4);
+        }
+    }
+}
+
+
+static void build_cell(pixel_t* cell_pixels, byte* cell_mask, patch_t* bg, patch_t* patch)
+{
+    int bg_width = SHORT(bg->width);
+    int bg_height = SHORT(bg->height);
+    int width = SHORT(patch->width);
+    int height = SHORT(patch->height);
+
+    memset(cell_pixels, 0, ICON_CELL_PIXELS * sizeof(pixel_t));
+    memset(cell_mask, 0, ICON_CELL_PIXELS);
+
+    // Background, at the same place V_DrawPatch would put it
+    pixel_t* raw = Z_Malloc(MAX(bg_width * bg_height, width * height) * sizeof(pixel_t), PU_STATIC, NULL);
+    byte* raw_mask = Z_Malloc(MAX(bg_width * bg_height, width * height), PU_STATIC, NULL);
+    memset(raw_mask, 0, bg_width * bg_height);
+    rasterize_patch(bg, raw, raw_mask);
+    for (int y = 0; y < bg_height; ++y)
+    {
+        int celly = y - SHORT(bg->topoffset);
+        if (celly < 0 || celly >= AP_NOTIF_SIZE) continue;
+        for (int x = 0; x < bg_width; ++x)
+        {
+            int cellx = x - SHORT(bg->leftoffset);
+            if (cellx < 0 || cellx >= AP_NOTIF_SIZE) continue;
+            if (!raw_mask[y * bg_width + x]) continue;
+            cell_pixels[celly * AP_NOTIF_SIZE + cellx] = raw[y * bg_width + x];
+            cell_mask[celly * AP_NOTIF_SIZE + cellx] = 1;
+        }
+    }
+
+    // Sprite, scaled down to fit and centered over it
+    memset(raw_mask, 0, width * height);
+    rasterize_patch(patch, raw, raw_mask);
+    int span = MAX(MAX(width, height), ICON_BLOCK_SIZE);
+    int offsetx = (width - span) / 2;
+    int offsety = (height - span) / 2;
+    int block_offset = (AP_NOTIF_SIZE - ICON_BLOCK_SIZE) / 2;
+    for (int celly = 0; celly < ICON_BLOCK_SIZE; ++celly)
+    {
+        int y = celly * span / ICON_BLOCK_SIZE + offsety;
+        if (y < 0 || y >= height) continue;
+        for (int cellx = 0; cellx < ICON_BLOCK_SIZE; ++cellx)
+        {
+            int x = cellx * span / ICON_BLOCK_SIZE + offsetx;
+            if (x < 0 || x >= width) continue;
+            int k = y * width + x;
+            if (!raw_mask[k] || !raw[k]) continue; // Index 0 was always see-through on icons
+            int cellk = (celly + block_offset) * AP_NOTIF_SIZE + cellx + block_offset;
+            cell_pixels[cellk] = raw[k];
+            cell_mask[cellk] = 1;
+        }
+    }
+
+    Z_Free(raw);
+    Z_Free(raw_mask);
+}
+
+
+void ap_notif_icons_init(void)
+{
+    if (atlas_pixels) return; // Already built
+
+    sprite_count = ap_get_type_sprite_count();
+    if (sprite_count <= 0) return;
+
+    // Sprites can be shared by several doom types, keep one cell per lump
+    lumpindex_t* lumps = Z_Malloc(sprite_count * sizeof(lumpindex_t), PU_STATIC, NULL);
+    sprite_cells = Z_Malloc(sprite_count * sizeof(int), PU_STATIC, NULL);
+    int cell_count = 0;
+    for (int i = 0; i < sprite_count; ++i)
+    {
+        lumps[i] = W_CheckNumForName(ap_get_type_sprite_name(i));
+        sprite_cells[i] = -1;
+        if (lumps[i] < 0) continue;
+        for (int j = 0; j < i; ++j)
+        {
+            if (lumps[j] == lumps[i])
+            {
+                sprite_cells[i] = sprite_cells[j];
+                break;
+            }
+        }
+        if (sprite_cells[i] == -1)
+            sprite_cells[i] = cell_count++;
+    }
+
+    atlas_pixels = Z_Malloc(MAX(cell_count, 1) * ICON_CELL_PIXELS * sizeof(pixel_t), PU_STATIC, NULL);
+    atlas_mask = Z_Malloc(MAX(cell_count, 1) * ICON_CELL_PIXELS, PU_STATIC, NULL);
+
+    lumpindex_t bg_lump = W_GetNumForName("NOTIFBG");
+    patch_t* bg = W_CacheLumpNum(bg_lump, PU_STATIC);
+    int built_count = 0;
+    for (int i = 0; i < sprite_count; ++i)
+    {
+        if (sprite_cells[i] != built_count) continue; // Missing, or shares an earlier cell
+        patch_t* patch = W_CacheLumpNum(lumps[i], PU_STATIC);
+        build_cell(atlas_pixels + built_count * ICON_CELL_PIXELS,
+                   atlas_mask + built_count * ICON_CELL_PIXELS,
+                   bg, patch);
+        W_ReleaseLumpNum(lumps[i]);
+        ++built_count;
+    }
+    W_ReleaseLumpNum(bg_lump);
+    Z_Free(lumps);
+}
+
+
+void ap_notif_icons_draw(ap_notif_draw_text_t draw_text)
+{
+    int notif_count;
+    const ap_notification_icon_t* notifs = ap_get_notification_icons(&notif_count);
+
+    if (!atlas_pixels) return;
+
+    for (int i = 0; i < notif_count; ++i)
+    {
+        const ap_notification_icon_t* notif = notifs + i;
+        if (notif->state == AP_NOTIF_STATE_PENDING) continue;
+        if (notif->icon < 0 || notif->icon >= sprite_count) continue;
+
+        int cell = sprite_cells[notif->icon];
+        if (cell == -1) continue;
+
+        int center_y = 172 + notif->y;
+
+        V_DrawScaledBlockMasked(
+            notif->x - AP_NOTIF_SIZE / 2 - WIDESCREENDELTA,
+            center_y - AP_NOTIF_SIZE / 2,
+            AP_NOTIF_SIZE, AP_NOTIF_SIZE,
+            atlas_pixels + cell * ICON_CELL_PIXELS,
+            atlas_mask + cell * ICON_CELL_PIXELS);
+
+        if (notif->text[0])
+            draw_text(notif->text,
+                      notif->x + AP_NOTIF_SIZE / 2 + 3 - WIDESCREENDELTA,
+                      center_y - 5);
+    }
+}
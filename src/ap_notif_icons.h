@@ -0,0 +1,12 @@
+#ifndef __AP_NOTIF_ICONS_H__
+#define __AP_NOTIF_ICONS_H__
+
+// Notification icons, shared by all games. Each item sprite is scaled down
+// and composited over NOTIFBG once, then drawn with a single blit.
+
+typedef void (*ap_notif_draw_text_t)(const char* text, int x, int y);
+
+void ap_notif_icons_init(void); // Once the WADs are loaded and apdoom_init() was called
+void ap_notif_icons_draw(ap_notif_draw_text_t draw_text);
+
+#endif
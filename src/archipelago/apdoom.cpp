@@ -36,14 +36,22 @@
 #include "apheretic_def.h"
 #include "aphexen_def.h"
 #include "Archipelago.h"
+#include "apdoom_ring.h"
 #include <json/json.h>
 #include <memory.h>
+#include <atomic>
 #include <chrono>
 #include <thread>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <string>
 #include <vector>
 #include <fstream>
 #include <sstream>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 
 #if defined(_WIN32)
@@ -147,6 +155,29 @@ static FILE *AP_fopen(const char *filename, const char *mode)
 }
 
 
+// Replaces newname if it exists
+static bool AP_RenameFile(const char *oldname, const char *newname)
+{
+#ifdef _WIN32
+    wchar_t *wold = AP_ConvertUtf8ToWide(oldname);
+    wchar_t *wnew = AP_ConvertUtf8ToWide(newname);
+    bool result = false;
+
+    if (wold && wnew)
+    {
+        result = MoveFileExW(wold, wnew, MOVEFILE_REPLACE_EXISTING) != 0;
+    }
+
+    free(wold);
+    free(wnew);
+
+    return result;
+#else
+    return rename(oldname, newname) == 0;
+#endif
+}
+
+
 static int AP_FileExists(const char *filename)
 {
     FILE *fstream;
@@ -189,14 +220,51 @@ static int ap_inventory_count = -1;
 static int max_map_count = -1;
 static ap_settings_t ap_settings;
 static AP_RoomInfo ap_room_info;
-static std::vector<int64_t> ap_item_queue; // We queue when we're in the menu.
 static bool ap_was_connected = false; // Got connected at least once. That means the state is valid
-static std::set<int64_t> ap_progressive_locations;
+static std::unordered_set<int64_t> ap_progressive_locations;
+static std::vector<unsigned int> ap_thing_bitsets; // Storage for every level's checked_things and progression_things
 static bool ap_initialized = false;
-static std::vector<std::string> ap_cached_messages;
+static int ap_init_state = AP_INIT_STATE_CONNECTING;
+static std::chrono::steady_clock::time_point ap_init_start_time;
+static std::string ap_init_status_text;
 static std::string ap_save_dir_name;
-static std::vector<ap_notification_icon_t> ap_notification_icons;
+static ap_notification_icon_t ap_notification_icons[AP_NOTIF_MAX];
+static int ap_notification_icon_count = 0;
 static bool ap_check_sanity = false;
+static std::unordered_map<int64_t, ap_location_key_t> ap_location_id_to_key; // loc id -> (ep, map, index)
+static std::unordered_map<uint64_t, int64_t> ap_location_key_to_id; // (ep, map, index) -> loc id
+
+
+// Received items, waiting to be given to the player in game. f_itemrecv
+// (APCpp's thread) produces, apdoom_update consumes a few per tic. Items that
+// don't fit in the ring spill into the locked overflow, which is rare.
+#define AP_ITEM_QUEUE_SIZE 4096
+#define AP_ITEMS_PER_TIC 8
+static ap_spsc_ring_t<int64_t, AP_ITEM_QUEUE_SIZE> ap_item_queue;
+static std::vector<int64_t> ap_item_backlog; // Consumer only. Restored from save, or drained overflow. Given first
+static size_t ap_item_backlog_pos = 0;
+static std::mutex ap_item_overflow_mutex;
+static std::vector<int64_t> ap_item_overflow;
+static std::atomic<bool> ap_item_overflowed{false};
+
+// Formatted messages, held until we're initialized
+#define AP_MESSAGE_QUEUE_SIZE 256
+#define AP_MESSAGE_MAX 512
+#define AP_MESSAGES_PER_TIC 16
+struct ap_message_slot_t
+{
+	char text[AP_MESSAGE_MAX];
+};
+static ap_spsc_ring_t<ap_message_slot_t, AP_MESSAGE_QUEUE_SIZE> ap_message_queue;
+
+// Location checks raised during a tic are sent together from apdoom_update().
+// They stay in apchecks.spool until the server confirms them (f_locrecv, on
+// APCpp's thread), so they survive disconnects and restarts.
+static std::set<int64_t> ap_pending_checks; // Game thread only
+static std::set<int64_t> ap_spooled_checks;
+static std::mutex ap_spool_mutex;
+static bool ap_spool_dirty = false;
+static bool ap_was_authenticated = false;
 
 
 void f_itemclr();
@@ -232,9 +300,84 @@ void f_ammo5add(int);
 void f_ammo6add(int);
 void load_state();
 void save_state();
+static void load_check_spool();
+static void write_check_spool();
+static void confirm_check(int64_t loc_id);
+static void add_progressive_location(int64_t loc_id);
+static void export_state_json();
 void APSend(std::string msg);
 
 
+// Producer side of the item queue
+static void queue_item(int64_t item_id)
+{
+	// Once overflowed, keep going there until drained so order is kept
+	if (!ap_item_overflowed.load(std::memory_order_acquire) && ap_item_queue.push(item_id))
+		return;
+
+	std::lock_guard<std::mutex> lock(ap_item_overflow_mutex);
+	ap_item_overflow.push_back(item_id);
+	ap_item_overflowed.store(true, std::memory_order_release);
+}
+
+
+// Consumer side of the item queue
+static bool dequeue_item(int64_t& item_id)
+{
+	if (ap_item_backlog_pos < ap_item_backlog.size())
+	{
+		item_id = ap_item_backlog[ap_item_backlog_pos++];
+		if (ap_item_backlog_pos == ap_item_backlog.size())
+		{
+			ap_item_backlog.clear();
+			ap_item_backlog_pos = 0;
+		}
+		return true;
+	}
+
+	if (auto queued_item_id = ap_item_queue.front())
+	{
+		item_id = *queued_item_id;
+		ap_item_queue.pop();
+		return true;
+	}
+
+	// Ring is empty, everything left in the overflow came after it
+	if (ap_item_overflowed.load(std::memory_order_acquire))
+	{
+		{
+			std::lock_guard<std::mutex> lock(ap_item_overflow_mutex);
+			ap_item_backlog.swap(ap_item_overflow);
+			ap_item_overflowed.store(false, std::memory_order_release);
+		}
+		return dequeue_item(item_id);
+	}
+
+	return false;
+}
+
+
+// Consumer side. Everything not given yet, oldest first (For saving)
+static std::vector<int64_t> get_queued_items()
+{
+	std::vector<int64_t> item_ids(ap_item_backlog.begin() + ap_item_backlog_pos, ap_item_backlog.end());
+	ap_item_queue.for_each([&](int64_t item_id) { item_ids.push_back(item_id); });
+
+	std::lock_guard<std::mutex> lock(ap_item_overflow_mutex);
+	item_ids.insert(item_ids.end(), ap_item_overflow.begin(), ap_item_overflow.end());
+	return item_ids;
+}
+
+
+// Consumer side. Saved items go before anything received since
+static void restore_queued_items(const std::vector<int64_t>& item_ids)
+{
+	ap_item_backlog.erase(ap_item_backlog.begin(), ap_item_backlog.begin() + ap_item_backlog_pos);
+	ap_item_backlog.insert(ap_item_backlog.begin(), item_ids.begin(), item_ids.end());
+	ap_item_backlog_pos = 0;
+}
+
+
 static int get_original_music_for_level(int ep, int map)
 {
 	switch (ap_game)
@@ -273,14 +416,43 @@ static int get_original_music_for_level(int ep, int map)
 }
 
 
-static std::vector<std::vector<ap_level_info_t>>& get_level_info_table()
+// Generated definition tables of a game. They are all constant data, nothing
+// is built at startup.
+struct ap_game_defs_t
+{
+	const ap_location_def_t* locations;
+	int location_count;
+	const ap_item_def_t* items;
+	int item_count;
+	const ap_level_info_t* level_infos;
+	const ap_episode_def_t* episodes;
+	int episode_count;
+	const ap_type_sprite_t* type_sprites;
+	int type_sprite_count;
+};
+
+
+#define AP_GAME_DEFS(codename) { \
+	ap_##codename##_locations, (int)std::size(ap_##codename##_locations), \
+	ap_##codename##_items, (int)std::size(ap_##codename##_items), \
+	ap_##codename##_level_infos, \
+	ap_##codename##_episodes, (int)std::size(ap_##codename##_episodes), \
+	ap_##codename##_type_sprites, (int)std::size(ap_##codename##_type_sprites) }
+
+static constexpr ap_game_defs_t ap_doom_defs = AP_GAME_DEFS(doom);
+static constexpr ap_game_defs_t ap_doom2_defs = AP_GAME_DEFS(doom2);
+static constexpr ap_game_defs_t ap_heretic_defs = AP_GAME_DEFS(heretic);
+static constexpr ap_game_defs_t ap_hexen_defs = AP_GAME_DEFS(hexen);
+
+
+static const ap_game_defs_t& get_game_defs()
 {
 	switch (ap_game)
 	{
-		case ap_game_t::doom: return ap_doom_level_infos;
-		case ap_game_t::doom2: return ap_doom2_level_infos;
-		case ap_game_t::heretic: return ap_heretic_level_infos;
-		case ap_game_t::hexen: return ap_hexen_level_infos;
+		case ap_game_t::doom: return ap_doom_defs;
+		case ap_game_t::doom2: return ap_doom2_defs;
+		case ap_game_t::heretic: return ap_heretic_defs;
+		case ap_game_t::hexen: return ap_hexen_defs;
 	}
 }
 
@@ -288,18 +460,18 @@ static std::vector<std::vector<ap_level_info_t>>& get_level_info_table()
 int ap_get_map_count(int ep)
 {
 	--ep;
-	auto& level_info_table = get_level_info_table();
-	if (ep < 0 || ep >= (int)level_info_table.size()) return -1;
-	return (int)level_info_table[ep].size();
+	const auto& defs = get_game_defs();
+	if (ep < 0 || ep >= defs.episode_count) return -1;
+	return defs.episodes[ep].level_count;
 }
 
 
-ap_level_info_t* ap_get_level_info(ap_level_index_t idx)
+const ap_level_info_t* ap_get_level_info(ap_level_index_t idx)
 {
-	auto& level_info_table = get_level_info_table();
-	if (idx.ep < 0 || idx.ep >= (int)level_info_table.size()) return nullptr;
-	if (idx.map < 0 || idx.map >= (int)level_info_table[idx.ep].size()) return nullptr;
-	return &level_info_table[idx.ep][idx.map];
+	const auto& defs = get_game_defs();
+	if (idx.ep < 0 || idx.ep >= defs.episode_count) return nullptr;
+	if (idx.map < 0 || idx.map >= defs.episodes[idx.ep].level_count) return nullptr;
+	return &defs.level_infos[defs.episodes[idx.ep].first_level + idx.map];
 }
 
 
@@ -309,30 +481,47 @@ ap_level_state_t* ap_get_level_state(ap_level_index_t idx)
 }
 
 
-static const std::map<int64_t, ap_item_t>& get_item_type_table()
+static const ap_item_t* find_item_type(int64_t item_id)
 {
-	switch (ap_game)
-	{
-		case ap_game_t::doom: return ap_doom_item_table;
-		case ap_game_t::doom2: return ap_doom2_item_table;
-		case ap_game_t::heretic: return ap_heretic_item_table;
-		case ap_game_t::hexen: return ap_hexen_item_table;
-	}
+	const auto& defs = get_game_defs();
+	return ap_find_item_def(defs.items, defs.item_count, item_id);
 }
 
 
-static const std::map<int /* ep */, std::map<int /* map */, std::map<int /* index */, int64_t /* loc id */>>>& get_location_table()
+static uint64_t pack_location_key(int ep, int map, int index)
 {
-	switch (ap_game)
+	return ((uint64_t)(uint16_t)ep << 48) | ((uint64_t)(uint16_t)map << 32) | (uint64_t)(uint32_t)index;
+}
+
+
+// Index the location table both ways once, so lookups from the network
+// callbacks don't have to walk the whole table.
+static void build_location_index()
+{
+	ap_location_id_to_key.clear();
+	ap_location_key_to_id.clear();
+
+	const auto& defs = get_game_defs();
+	ap_location_id_to_key.reserve(defs.location_count);
+	ap_location_key_to_id.reserve(defs.location_count);
+	for (int i = 0; i < defs.location_count; ++i)
 	{
-		case ap_game_t::doom: return ap_doom_location_table;
-		case ap_game_t::doom2: return ap_doom2_location_table;
-		case ap_game_t::heretic: return ap_heretic_location_table;
-		case ap_game_t::hexen: return ap_hexen_location_table;
+		const auto& loc = defs.locations[i];
+		ap_location_id_to_key[loc.id] = loc.key;
+		ap_location_key_to_id[pack_location_key(loc.key.ep, loc.key.map, loc.key.index)] = loc.id;
 	}
 }
 
 
+// Returns -1 if there is no location at that index
+static int64_t get_location_id(ap_level_index_t idx, int index)
+{
+	auto it = ap_location_key_to_id.find(pack_location_key(idx.ep + 1, idx.map + 1, index));
+	if (it == ap_location_key_to_id.end()) return -1;
+	return it->second;
+}
+
+
 std::string string_to_hex(const char* str)
 {
     static const char hex_digits[] = "0123456789ABCDEF";
@@ -393,7 +582,7 @@ void recalc_max_ammo()
 
 int validate_doom_location(ap_level_index_t idx, int index)
 {
-    ap_level_info_t* level_info = ap_get_level_info(idx);
+    const ap_level_info_t* level_info = ap_get_level_info(idx);
     if (index >= level_info->thing_count) return 0;
 	if (level_info->thing_infos[index].unreachable) return 0;
     return level_info->thing_infos[index].check_sanity == 0 || ap_state.check_sanity == 1;
@@ -404,7 +593,6 @@ int apdoom_init(ap_settings_t* settings)
 {
 	printf("%s\n", APDOOM_VERSION_FULL_TEXT);
 
-	ap_notification_icons.reserve(4096); // 1MB. A bit exessive, but I got a crash with invalid strings and I cannot figure out why. Let's not take any chances...
 	memset(&ap_state, 0, sizeof(ap_state));
 
 	if (strcmp(settings->game, "DOOM 1993") == 0)
@@ -445,12 +633,13 @@ int apdoom_init(ap_settings_t* settings)
 		return 0;
 	}
 
-	const auto& level_info_table = get_level_info_table();
-	ap_episode_count = (int)level_info_table.size();
+	const auto& defs = get_game_defs();
+	build_location_index();
+	ap_episode_count = defs.episode_count;
 	max_map_count = 0; // That's really the map count
-	for (const auto& episode_level_info : level_info_table)
+	for (int ep = 0; ep < defs.episode_count; ++ep)
 	{
-		max_map_count = std::max(max_map_count, (int)episode_level_info.size());
+		max_map_count = std::max(max_map_count, defs.episodes[ep].level_count);
 	}
 
 	printf("APDOOM: Initializing Game: \"%s\", Server: %s, Slot: %s\n", settings->game, settings->ip, settings->player_name);
@@ -492,22 +681,27 @@ int apdoom_init(ap_settings_t* settings)
 	}
 	memset(ap_state.player_state.capacity_upgrades, 0, sizeof(int) * ap_ammo_count);
 
+	// Checked and progression bitsets, one bit per thing
+	size_t bitset_word_count = 0;
+	for (int ep = 0; ep < ap_episode_count; ++ep)
+	{
+		int map_count = ap_get_map_count(ep + 1);
+		for (int map = 0; map < map_count; ++map)
+			bitset_word_count += AP_BITSET_WORDS(ap_get_level_info({ep, map})->thing_count) * 2;
+	}
+	ap_thing_bitsets.assign(bitset_word_count, 0);
+	unsigned int* bitset_words = ap_thing_bitsets.data();
 	for (int ep = 0; ep < ap_episode_count; ++ep)
 	{
 		int map_count = ap_get_map_count(ep + 1);
 		for (int map = 0; map < map_count; ++map)
 		{
-			for (int k = 0; k < AP_CHECK_MAX; ++k)
-			{
-				ap_state.level_states[ep * max_map_count + map].checks[k] = -1;
-			}
-			auto level_info = ap_get_level_info(ap_level_index_t{ep, map});
-			level_info->sanity_check_count = 0;
-			for (int k = 0; k < level_info->thing_count; ++k)
-			{
-				if (level_info->thing_infos[k].check_sanity)
-					level_info->sanity_check_count++;
-			}
+			auto level_state = ap_get_level_state({ep, map});
+			int word_count = AP_BITSET_WORDS(ap_get_level_info({ep, map})->thing_count);
+			level_state->checked_things = bitset_words;
+			bitset_words += word_count;
+			level_state->progression_things = bitset_words;
+			bitset_words += word_count;
 		}
 	}
 
@@ -571,66 +765,65 @@ int apdoom_init(ap_settings_t* settings)
 	AP_RegisterSlotDataIntCallback("two_ways_keydoors", f_two_ways_keydoors);
     AP_Start();
 
-	// Block DOOM until connection succeeded or failed
-	auto start_time = std::chrono::steady_clock::now();
-	while (true)
-	{
-		bool should_break = false;
-		switch (AP_GetConnectionStatus())
-		{
-			case AP_ConnectionStatus::Authenticated:
-			{
-				printf("APDOOM: Authenticated\n");
-				AP_GetRoomInfo(&ap_room_info);
-
-				printf("APDOOM: Room Info:\n");
-				printf("  Network Version: %i.%i.%i\n", ap_room_info.version.major, ap_room_info.version.minor, ap_room_info.version.build);
-				printf("  Tags:\n");
-				for (const auto& tag : ap_room_info.tags)
-					printf("    %s\n", tag.c_str());
-				printf("  Password required: %s\n", ap_room_info.password_required ? "true" : "false");
-				printf("  Permissions:\n");
-				for (const auto& permission : ap_room_info.permissions)
-					printf("    %s = %i:\n", permission.first.c_str(), permission.second);
-				printf("  Hint cost: %i\n", ap_room_info.hint_cost);
-				printf("  Location check points: %i\n", ap_room_info.location_check_points);
-				printf("  Data package checksums:\n");
-				for (const auto& kv : ap_room_info.datapackage_checksums)
-					printf("    %s = %s:\n", kv.first.c_str(), kv.second.c_str());
-				printf("  Seed name: %s\n", ap_room_info.seed_name.c_str());
-				printf("  Time: %f\n", ap_room_info.time);
-				
-				ap_was_connected = true;
-				ap_save_dir_name = "AP_" + ap_room_info.seed_name + "_" + string_to_hex(ap_settings.player_name);
-
-				// Create a directory where saves will go for this AP seed.
-				printf("APDOOM: Save directory: %s\n", ap_save_dir_name.c_str());
-				if (!AP_FileExists(ap_save_dir_name.c_str()))
-				{
-					printf("  Doesn't exist, creating...\n");
-					AP_MakeDirectory(ap_save_dir_name.c_str());
-				}
+	// Connection and scouting continue in the background, driven by apdoom_update()
+	ap_init_state = AP_INIT_STATE_CONNECTING;
+	ap_init_start_time = std::chrono::steady_clock::now();
+	ap_init_status_text = std::string("Connecting to ") + ap_settings.ip + "...";
+	return 1;
+}
 
-				// Make sure that ammo starts at correct base values no matter what
-				recalc_max_ammo();
 
-				load_state();
-				should_break = true;
-				break;
-			}
-			case AP_ConnectionStatus::ConnectionRefused:
-				printf("APDOOM: Failed to connect, connection refused\n");
-				return 0;
-		}
-		if (should_break) break;
-		std::this_thread::sleep_for(std::chrono::milliseconds(100));
-		if (std::chrono::steady_clock::now() - start_time > std::chrono::seconds(10))
-		{
-			printf("APDOOM: Failed to connect, timeout 10s\n");
-			return 0;
-		}
+static void fail_init(const char* reason)
+{
+	printf("APDOOM: %s\n", reason);
+	ap_init_status_text = reason;
+	ap_init_state = AP_INIT_STATE_FAILED;
+}
+
+
+static void on_authenticated()
+{
+	printf("APDOOM: Authenticated\n");
+	AP_GetRoomInfo(&ap_room_info);
+
+	printf("APDOOM: Room Info:\n");
+	printf("  Network Version: %i.%i.%i\n", ap_room_info.version.major, ap_room_info.version.minor, ap_room_info.version.build);
+	printf("  Tags:\n");
+	for (const auto& tag : ap_room_info.tags)
+		printf("    %s\n", tag.c_str());
+	printf("  Password required: %s\n", ap_room_info.password_required ? "true" : "false");
+	printf("  Permissions:\n");
+	for (const auto& permission : ap_room_info.permissions)
+		printf("    %s = %i:\n", permission.first.c_str(), permission.second);
+	printf("  Hint cost: %i\n", ap_room_info.hint_cost);
+	printf("  Location check points: %i\n", ap_room_info.location_check_points);
+	printf("  Data package checksums:\n");
+	for (const auto& kv : ap_room_info.datapackage_checksums)
+		printf("    %s = %s:\n", kv.first.c_str(), kv.second.c_str());
+	printf("  Seed name: %s\n", ap_room_info.seed_name.c_str());
+	printf("  Time: %f\n", ap_room_info.time);
+	
+	ap_was_connected = true;
+	ap_save_dir_name = "AP_" + ap_room_info.seed_name + "_" + string_to_hex(ap_settings.player_name);
+
+	// Create a directory where saves will go for this AP seed.
+	printf("APDOOM: Save directory: %s\n", ap_save_dir_name.c_str());
+	if (!AP_FileExists(ap_save_dir_name.c_str()))
+	{
+		printf("  Doesn't exist, creating...\n");
+		AP_MakeDirectory(ap_save_dir_name.c_str());
 	}
 
+	// Make sure that ammo starts at correct base values no matter what
+	recalc_max_ammo();
+
+	load_state();
+	load_check_spool();
+}
+
+
+static void setup_from_slot_data()
+{
 	// If none episode is selected, select the first one.
 	int ep_count = 0;
 	for (int i = 0; i < ap_episode_count; ++i)
@@ -725,78 +918,212 @@ int apdoom_init(ap_settings_t* settings)
 			}
 		}
 	}
+}
+
 
+static void start_scouting()
+{
 	// Scout locations to see which are progressive
-	if (ap_progressive_locations.empty())
+	bool cached;
+	{
+		std::lock_guard<std::mutex> lock(ap_spool_mutex);
+		cached = !ap_progressive_locations.empty();
+	}
+	if (cached)
 	{
-		std::vector<int64_t> location_scouts;
+		printf("APDOOM: Scout locations cached loaded\n");
+		return;
+	}
+
+	std::vector<int64_t> location_scouts;
+
+	const auto& defs = get_game_defs();
+	for (int i = 0; i < defs.location_count; ++i)
+	{
+		const auto& loc = defs.locations[i];
+		if (!ap_state.episodes[loc.key.ep - 1])
+			continue;
+		if (loc.key.index == -1) continue;
+		if (validate_doom_location({loc.key.ep - 1, loc.key.map - 1}, loc.key.index))
+		{
+			location_scouts.push_back(loc.id);
+		}
+	}
+
+	printf("APDOOM: Scouting for %i locations...\n", (int)location_scouts.size());
+	AP_SendLocationScouts(location_scouts, 0);
+
+	ap_init_state = AP_INIT_STATE_SCOUTING;
+	ap_init_start_time = std::chrono::steady_clock::now();
+	ap_init_status_text = "Scouting " + std::to_string(location_scouts.size()) + " locations...";
+}
+
+
+static void finish_init()
+{
+	printf("APDOOM: Initialized\n");
+	ap_init_status_text = "";
+	ap_init_state = AP_INIT_STATE_READY;
+	ap_initialized = true;
+	if (ap_settings.ready_callback)
+		ap_settings.ready_callback();
+}
+
+
+// Called every update until we're ready. This replaces the blocking loops
+// apdoom_init used to have, so the game can render while we connect.
+static void update_init()
+{
+	auto elapsed = std::chrono::steady_clock::now() - ap_init_start_time;
 
-		const auto& loc_table = get_location_table();
-		for (const auto& kv1 : loc_table)
+	switch (ap_init_state)
+	{
+		case AP_INIT_STATE_CONNECTING:
 		{
-			if (!ap_state.episodes[kv1.first - 1])
-				continue;
-			for (const auto& kv2 : kv1.second)
+			switch (AP_GetConnectionStatus())
 			{
-				for (const auto& kv3 : kv2.second)
-				{
-					if (kv3.first == -1) continue;
-					if (kv3.second == 371349)
-					{
-						int tmp;
-						tmp = 5;
-					}
-					if (validate_doom_location({kv1.first - 1, kv2.first - 1}, kv3.first))
-					{
-						location_scouts.push_back(kv3.second);
-					}
-				}
+				case AP_ConnectionStatus::Authenticated:
+					on_authenticated();
+					setup_from_slot_data();
+					start_scouting();
+					if (ap_init_state != AP_INIT_STATE_SCOUTING)
+						finish_init();
+					return;
+				case AP_ConnectionStatus::ConnectionRefused:
+					fail_init("Failed to connect, connection refused");
+					return;
+				default:
+					break;
 			}
+			if (elapsed > std::chrono::seconds(10))
+				fail_init("Failed to connect, timeout 10s");
+			break;
 		}
-		
-		printf("APDOOM: Scouting for %i locations...\n", (int)location_scouts.size());
-		AP_SendLocationScouts(location_scouts, 0);
-
-		// Wait for location infos
-		start_time = std::chrono::steady_clock::now();
-		while (ap_progressive_locations.empty())
+		case AP_INIT_STATE_SCOUTING:
 		{
-			apdoom_update();
-		
-			std::this_thread::sleep_for(std::chrono::milliseconds(100));
-			if (std::chrono::steady_clock::now() - start_time > std::chrono::seconds(10))
+			bool scouted;
+			{
+				std::lock_guard<std::mutex> lock(ap_spool_mutex);
+				scouted = !ap_progressive_locations.empty();
+			}
+			if (scouted)
+			{
+				finish_init();
+			}
+			else if (elapsed > std::chrono::seconds(10))
 			{
 				printf("APDOOM: Timeout waiting for LocationScouts. 10s\n  Do you have a VPN active?\n  Checks will all look non-progression.");
-				break;
+				finish_init();
 			}
+			break;
 		}
 	}
-	else
+}
+
+
+int apdoom_get_init_state()
+{
+	return ap_init_state;
+}
+
+
+const char* apdoom_get_init_status_text()
+{
+	return ap_init_status_text.c_str();
+}
+
+
+// Blocks until init is done. Only for the command line paths that start a
+// game before the main loop (-warp, -loadgame, demos), which need the slot
+// data and the save path right away.
+int apdoom_wait_for_init()
+{
+	while (ap_init_state == AP_INIT_STATE_CONNECTING ||
+		   ap_init_state == AP_INIT_STATE_SCOUTING)
 	{
-		printf("APDOOM: Scout locations cached loaded\n");
+		update_init();
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
 	}
-	
-	printf("APDOOM: Initialized\n");
-	ap_initialized = true;
-	return 1;
+	return ap_init_state;
+}
+
+
+// Negative indices (Hexen's special locations) go in the specials mask
+#define AP_MAX_SPECIAL_INDEX 31
+
+
+static bool test_thing_bit(const unsigned int* bits, unsigned int specials, int thing_count, int index)
+{
+	if (index < 0)
+		return index >= -AP_MAX_SPECIAL_INDEX && (specials & (1u << -index));
+	if (index >= thing_count)
+		return false;
+	return (bits[index / AP_BITSET_WORD_BITS] >> (index % AP_BITSET_WORD_BITS)) & 1;
+}
+
+
+// Returns false if it was already set, or out of range
+static bool set_thing_bit(unsigned int* bits, unsigned int* specials, int thing_count, int index)
+{
+	if (index < -AP_MAX_SPECIAL_INDEX || index >= thing_count)
+	{
+		printf("APDOOM: Thing index out of range: %i\n", index);
+		return false;
+	}
+	if (test_thing_bit(bits, *specials, thing_count, index))
+		return false;
+	if (index < 0)
+		*specials |= 1u << -index;
+	else
+		bits[index / AP_BITSET_WORD_BITS] |= 1u << (index % AP_BITSET_WORD_BITS);
+	return true;
+}
+
+
+// f_locrecv and f_locinfo set the bits from APCpp's thread
+int ap_is_location_checked(ap_level_index_t idx, int index)
+{
+	std::lock_guard<std::mutex> lock(ap_spool_mutex);
+	auto level_state = ap_get_level_state(idx);
+	return test_thing_bit(level_state->checked_things, level_state->checked_specials, ap_get_level_info(idx)->thing_count, index) ? 1 : 0;
 }
 
 
 static bool is_loc_checked(ap_level_index_t idx, int index)
+{
+	return ap_is_location_checked(idx, index) != 0;
+}
+
+
+// Visits the level's checked indices, specials first. Hold ap_spool_mutex
+template<typename F>
+static void for_each_level_check(ap_level_index_t idx, F&& f)
 {
 	auto level_state = ap_get_level_state(idx);
-	for (int i = 0; i < level_state->check_count; ++i)
+	for (int index = -AP_MAX_SPECIAL_INDEX; index < 0; ++index)
+		if (level_state->checked_specials & (1u << -index))
+			f(index);
+
+	int word_count = AP_BITSET_WORDS(ap_get_level_info(idx)->thing_count);
+	for (int i = 0; i < word_count; ++i)
 	{
-		if (level_state->checks[i] == index) return true;
+		unsigned int word = level_state->checked_things[i];
+		for (int bit = 0; word; ++bit, word >>= 1)
+			if (word & 1)
+				f(i * AP_BITSET_WORD_BITS + bit);
 	}
-	return false;
 }
 
 
 void apdoom_shutdown()
 {
 	if (ap_was_connected)
+	{
 		save_state();
+		write_check_spool();
+		if (ap_settings.export_json_state)
+			export_state_json();
+	}
 }
 
 
@@ -867,10 +1194,9 @@ const char* get_ammo_name(int weapon)
 }
 
 
-void load_state()
+// Saves from before the journal
+static void load_state_json()
 {
-	printf("APDOOM: Load state\n");
-
 	std::string filename = ap_save_dir_name + "/apstate.json";
 	std::ifstream f(filename);
 	if (!f.is_open())
@@ -956,10 +1282,12 @@ void load_state()
 	}
 
 	// Item queue
+	std::vector<int64_t> item_ids;
 	for (const auto& item_id_json : json["item_queue"])
 	{
-		ap_item_queue.push_back(item_id_json.asInt64());
+		item_ids.push_back(item_id_json.asInt64());
 	}
+	restore_queued_items(item_ids);
 
 	json_get_int(json["ep"], ap_state.ep);
 	printf("  Enabled episodes: ");
@@ -981,7 +1309,7 @@ void load_state()
 
 	for (const auto& prog_json : json["progressive_locations"])
 	{
-		ap_progressive_locations.insert(prog_json.asInt64());
+		add_progressive_location(prog_json.asInt64());
 	}
 	
 	json_get_bool_or(json["victory"], ap_state.victory);
@@ -1005,12 +1333,7 @@ static Json::Value serialize_level(int ep, int map)
 	json_level["special"] = level_state->special;
 
 	Json::Value json_checks(Json::arrayValue);
-	for (int k = 0; k < AP_CHECK_MAX; ++k)
-	{
-		if (level_state->checks[k] == -1)
-			continue;
-		json_checks.append(level_state->checks[k]);
-	}
+	for_each_level_check(ap_level_index_t{ep - 1, map - 1}, [&](int index) { json_checks.append(index); });
 	json_level["checks"] = json_checks;
 
 	return json_level;
@@ -1034,17 +1357,15 @@ std::vector<ap_level_index_t> get_level_indices()
 }
 
 
-void save_state()
+// Human readable dump of the state, for debugging (-apjsonstate)
+static void export_state_json()
 {
 	std::string filename = ap_save_dir_name + "/apstate.json";
 	std::ofstream f(filename);
 	if (!f.is_open())
 	{
-		printf("Failed to save AP state.\n");
-#if WIN32
-		MessageBoxA(nullptr, "Failed to save player state. That's bad.", "Error", MB_OK);
-#endif
-		return; // Ok that's bad. we won't save player state
+		printf("APDOOM: Failed to export AP state to %s.\n", filename.c_str());
+		return;
 	}
 
 	// Player state
@@ -1092,8 +1413,9 @@ void save_state()
 
 	json["player"] = json_player;
 
-	// Level states
+	// Level states, with the checks f_locrecv adds
 	Json::Value json_episodes(Json::arrayValue);
+	std::unique_lock<std::mutex> levels_lock(ap_spool_mutex);
 	for (int i = 0; i < ap_episode_count; ++i)
 	{
 		Json::Value json_levels(Json::arrayValue);
@@ -1104,11 +1426,12 @@ void save_state()
 		}
 		json_episodes.append(json_levels);
 	}
+	levels_lock.unlock();
 	json["episodes"] = json_episodes;
 
 	// Item queue
 	Json::Value json_item_queue(Json::arrayValue);
-	for (auto item_id : ap_item_queue)
+	for (auto item_id : get_queued_items())
 	{
 		json_item_queue.append(item_id);
 	}
@@ -1120,9 +1443,12 @@ void save_state()
 	json["map"] = ap_state.map;
 
 	// Progression items (So we don't scout everytime we connect)
-	for (auto loc_id : ap_progressive_locations)
 	{
-		json["progressive_locations"].append(loc_id);
+		std::lock_guard<std::mutex> lock(ap_spool_mutex);
+		for (auto loc_id : ap_progressive_locations)
+		{
+			json["progressive_locations"].append(loc_id);
+		}
 	}
 
 	json["victory"] = ap_state.victory;
@@ -1133,6 +1459,530 @@ void save_state()
 }
 
 
+//
+// State journal
+//
+// apstate.journal is a header followed by checksummed records. Saving only
+// appends what changed since the last save (Player, levels, new checks...),
+// so it costs O(delta). A torn record at the end of the file, from a crash
+// mid-write, fails its checksum and is dropped on the next load. The journal
+// is compacted back into a snapshot (One record per piece of state) on load
+// and when it grows too big.
+//
+
+#define AP_JOURNAL_MAGIC 0x314A5041 // "APJ1"
+#define AP_JOURNAL_VERSION 1
+#define AP_JOURNAL_COMPACT_THRESHOLD 4096 // Records
+
+
+enum class ap_journal_record_t : uint16_t
+{
+	player = 1,
+	level = 2,
+	check = 3,
+	item_queue = 4,
+	progressive_locations = 5,
+	game = 6
+};
+
+
+struct ap_journal_record_header_t
+{
+	uint16_t type;
+	uint16_t reserved;
+	uint32_t value_count;
+	uint32_t crc;
+};
+
+
+static std::vector<int64_t> ap_journaled_player;
+static std::vector<int64_t> ap_journaled_game;
+static std::vector<std::vector<int64_t>> ap_journaled_levels;
+static std::vector<int64_t> ap_unjournaled_checks; // ep, map, index triplets, under ap_spool_mutex
+static std::vector<int64_t> ap_journaled_item_queue;
+static std::vector<int64_t> ap_unjournaled_progressive_locations; // Under ap_spool_mutex, f_locinfo adds to it
+static int ap_journal_record_count = 0;
+
+
+static uint32_t journal_crc32(const void* data, size_t size, uint32_t crc)
+{
+	const uint8_t* bytes = (const uint8_t*)data;
+	crc = ~crc;
+	for (size_t i = 0; i < size; ++i)
+	{
+		crc ^= bytes[i];
+		for (int k = 0; k < 8; ++k)
+			crc = (crc >> 1) ^ (0xEDB88320 & (0 - (crc & 1)));
+	}
+	return ~crc;
+}
+
+
+static uint32_t journal_record_crc(const ap_journal_record_header_t& header, const int64_t* values)
+{
+	uint32_t crc = journal_crc32(&header.type, sizeof(header.type), 0);
+	crc = journal_crc32(&header.value_count, sizeof(header.value_count), crc);
+	return journal_crc32(values, sizeof(int64_t) * header.value_count, crc);
+}
+
+
+static void journal_append_record(std::vector<uint8_t>& out, ap_journal_record_t type, const std::vector<int64_t>& values)
+{
+	ap_journal_record_header_t header;
+	header.type = (uint16_t)type;
+	header.reserved = 0;
+	header.value_count = (uint32_t)values.size();
+	header.crc = journal_record_crc(header, values.data());
+
+	const uint8_t* header_bytes = (const uint8_t*)&header;
+	const uint8_t* value_bytes = (const uint8_t*)values.data();
+	out.insert(out.end(), header_bytes, header_bytes + sizeof(header));
+	out.insert(out.end(), value_bytes, value_bytes + sizeof(int64_t) * values.size());
+}
+
+
+static std::string get_journal_filename()
+{
+	return ap_save_dir_name + "/apstate.journal";
+}
+
+
+static std::vector<int64_t> serialize_player_record()
+{
+	const auto& player_state = ap_state.player_state;
+	std::vector<int64_t> values = {
+		player_state.health,
+		player_state.armor_points,
+		player_state.armor_type,
+		player_state.ready_weapon,
+		player_state.kill_count,
+		player_state.item_count,
+		player_state.secret_count
+	};
+	for (int i = 0; i < ap_powerup_count; ++i)
+		values.push_back(player_state.powers[i]);
+	for (int i = 0; i < ap_weapon_count; ++i)
+		values.push_back(player_state.weapon_owned[i]);
+	for (int i = 0; i < ap_ammo_count; ++i)
+		values.push_back(player_state.ammo[i]);
+	for (int i = 0; i < ap_ammo_count; ++i)
+		values.push_back(player_state.max_ammo[i]);
+	for (int i = 0; i < ap_inventory_count; ++i)
+	{
+		if (player_state.inventory[i].type == 9) // Don't include wings to player inventory, they are per level
+			continue;
+		values.push_back(player_state.inventory[i].type);
+		values.push_back(player_state.inventory[i].count);
+	}
+	return values;
+}
+
+
+static void deserialize_player_record(const int64_t* values, int count)
+{
+	auto& player_state = ap_state.player_state;
+	int fixed_count = 7 + ap_powerup_count + ap_weapon_count + ap_ammo_count * 2;
+	if (count < fixed_count) return;
+
+	int k = 0;
+	player_state.health = (int)values[k++];
+	player_state.armor_points = (int)values[k++];
+	player_state.armor_type = (int)values[k++];
+	player_state.ready_weapon = (int)values[k++];
+	player_state.kill_count = (int)values[k++];
+	player_state.item_count = (int)values[k++];
+	player_state.secret_count = (int)values[k++];
+	for (int i = 0; i < ap_powerup_count; ++i)
+		player_state.powers[i] = (int)values[k++];
+	for (int i = 0; i < ap_weapon_count; ++i)
+		player_state.weapon_owned[i] = (int)values[k++];
+	for (int i = 0; i < ap_ammo_count; ++i)
+		player_state.ammo[i] = (int)values[k++];
+	for (int i = 0; i < ap_ammo_count; ++i)
+		player_state.max_ammo[i] = (int)values[k++];
+	for (int i = 0; i < ap_inventory_count; ++i)
+	{
+		player_state.inventory[i].type = 0;
+		player_state.inventory[i].count = 0;
+		if (k + 1 < count)
+		{
+			player_state.inventory[i].type = (int)values[k++];
+			player_state.inventory[i].count = (int)values[k++];
+		}
+	}
+}
+
+
+static std::vector<int64_t> serialize_level_record(ap_level_index_t idx)
+{
+	auto level_state = ap_get_level_state(idx);
+	return {
+		idx.ep,
+		idx.map,
+		level_state->completed,
+		level_state->keys[0],
+		level_state->keys[1],
+		level_state->keys[2],
+		level_state->has_map,
+		level_state->unlocked,
+		level_state->special
+	};
+}
+
+
+static void deserialize_level_record(const int64_t* values, int count)
+{
+	if (count < 9) return;
+	ap_level_index_t idx = {(int)values[0], (int)values[1]};
+	if (idx.ep < 0 || idx.ep >= ap_episode_count) return;
+	if (idx.map < 0 || idx.map >= ap_get_map_count(idx.ep + 1)) return;
+
+	auto level_state = ap_get_level_state(idx);
+	level_state->completed = (int)values[2];
+	level_state->keys[0] = (int)values[3];
+	level_state->keys[1] = (int)values[4];
+	level_state->keys[2] = (int)values[5];
+	level_state->has_map = (int)values[6];
+	level_state->unlocked = (int)values[7];
+	level_state->special = (int)values[8];
+}
+
+
+static std::vector<int64_t> serialize_game_record()
+{
+	std::vector<int64_t> values = {ap_state.ep, ap_state.map, ap_state.victory};
+	for (int i = 0; i < ap_episode_count; ++i)
+		values.push_back(ap_state.episodes[i]);
+	return values;
+}
+
+
+static void deserialize_game_record(const int64_t* values, int count)
+{
+	if (count < 3) return;
+	ap_state.ep = (int)values[0];
+	ap_state.map = (int)values[1];
+	ap_state.victory = (int)values[2];
+	for (int i = 0; i < ap_episode_count && 3 + i < count; ++i)
+		ap_state.episodes[i] = (int)values[3 + i];
+}
+
+
+// Appends records for everything that differs from what the journal already has.
+// With force, everything is written (That's a snapshot).
+static void journal_collect_records(std::vector<uint8_t>& out, bool force)
+{
+	auto journal_if_changed = [&](std::vector<int64_t>& journaled, ap_journal_record_t type, std::vector<int64_t> values)
+	{
+		if (!force && values == journaled) return;
+		journal_append_record(out, type, values);
+		journaled = std::move(values);
+		ap_journal_record_count++;
+	};
+
+	journal_if_changed(ap_journaled_player, ap_journal_record_t::player, serialize_player_record());
+	journal_if_changed(ap_journaled_game, ap_journal_record_t::game, serialize_game_record());
+
+	// f_locrecv adds checks from APCpp's thread, hold it off until the
+	// checks seen here and the unjournaled list agree
+	{
+		std::lock_guard<std::mutex> lock(ap_spool_mutex);
+		int level_count = ap_episode_count * max_map_count;
+		ap_journaled_levels.resize(level_count);
+		for (int ep = 0; ep < ap_episode_count; ++ep)
+		{
+			int map_count = ap_get_map_count(ep + 1);
+			for (int map = 0; map < map_count; ++map)
+			{
+				ap_level_index_t idx = {ep, map};
+				int level_i = ep * max_map_count + map;
+				journal_if_changed(ap_journaled_levels[level_i], ap_journal_record_t::level, serialize_level_record(idx));
+
+				if (force)
+				{
+					for_each_level_check(idx, [&](int index)
+					{
+						journal_append_record(out, ap_journal_record_t::check, {ep, map, index});
+						ap_journal_record_count++;
+					});
+				}
+			}
+		}
+
+		// Checks are only ever added, journal the new ones
+		if (!force)
+		{
+			for (size_t i = 0; i + 2 < ap_unjournaled_checks.size(); i += 3)
+			{
+				journal_append_record(out, ap_journal_record_t::check, {ap_unjournaled_checks[i], ap_unjournaled_checks[i + 1], ap_unjournaled_checks[i + 2]});
+				ap_journal_record_count++;
+			}
+		}
+		ap_unjournaled_checks.clear();
+	}
+
+	journal_if_changed(ap_journaled_item_queue, ap_journal_record_t::item_queue, get_queued_items());
+
+	std::vector<int64_t> progressive_locations;
+	{
+		std::lock_guard<std::mutex> lock(ap_spool_mutex);
+		if (force)
+			progressive_locations.assign(ap_progressive_locations.begin(), ap_progressive_locations.end());
+		else
+			progressive_locations.swap(ap_unjournaled_progressive_locations);
+		ap_unjournaled_progressive_locations.clear();
+	}
+	if (!progressive_locations.empty())
+	{
+		journal_append_record(out, ap_journal_record_t::progressive_locations, progressive_locations);
+		ap_journal_record_count++;
+	}
+}
+
+
+static bool journal_write_snapshot()
+{
+	std::vector<uint8_t> out;
+	uint32_t header[2] = {AP_JOURNAL_MAGIC, AP_JOURNAL_VERSION};
+	out.insert(out.end(), (const uint8_t*)header, (const uint8_t*)header + sizeof(header));
+	ap_journal_record_count = 0;
+	journal_collect_records(out, true);
+
+	// Write aside then swap, so there is always a valid journal on disk
+	std::string filename = get_journal_filename();
+	std::string tmp_filename = filename + ".tmp";
+	FILE* f = AP_fopen(tmp_filename.c_str(), "wb");
+	if (!f) return false;
+	bool written = fwrite(out.data(), 1, out.size(), f) == out.size();
+	written = (fflush(f) == 0) && written;
+	fclose(f);
+	if (!written) return false;
+	return AP_RenameFile(tmp_filename.c_str(), filename.c_str());
+}
+
+
+static bool journal_append_deltas()
+{
+	std::vector<uint8_t> out;
+	journal_collect_records(out, false);
+	if (out.empty()) return true; // Nothing changed
+
+	FILE* f = AP_fopen(get_journal_filename().c_str(), "ab");
+	if (!f) return false;
+	bool written = fwrite(out.data(), 1, out.size(), f) == out.size();
+	written = (fflush(f) == 0) && written;
+	fclose(f);
+	return written;
+}
+
+
+static void add_level_check(ap_level_index_t idx, int index);
+
+
+// Replays the journal on top of the current state. Returns false if there is none.
+static bool load_state_journal()
+{
+	FILE* f = AP_fopen(get_journal_filename().c_str(), "rb");
+	if (!f) return false;
+
+	std::vector<uint8_t> data;
+	uint8_t buffer[4096];
+	size_t read_size;
+	while ((read_size = fread(buffer, 1, sizeof(buffer), f)) > 0)
+		data.insert(data.end(), buffer, buffer + read_size);
+	fclose(f);
+
+	uint32_t header[2];
+	if (data.size() < sizeof(header)) return false;
+	memcpy(header, data.data(), sizeof(header));
+	if (header[0] != AP_JOURNAL_MAGIC || header[1] != AP_JOURNAL_VERSION)
+	{
+		printf("  Unknown journal format, ignoring it.\n");
+		return false;
+	}
+
+	size_t pos = sizeof(header);
+	int record_count = 0;
+	std::vector<int64_t> values;
+	while (pos + sizeof(ap_journal_record_header_t) <= data.size())
+	{
+		ap_journal_record_header_t record;
+		memcpy(&record, data.data() + pos, sizeof(record));
+		size_t values_size = sizeof(int64_t) * (size_t)record.value_count;
+		if (pos + sizeof(record) + values_size > data.size()) break; // Torn write
+		values.resize(record.value_count);
+		memcpy(values.data(), data.data() + pos + sizeof(record), values_size);
+		if (journal_record_crc(record, values.data()) != record.crc) break; // Torn write
+		pos += sizeof(record) + values_size;
+		++record_count;
+
+		int count = (int)values.size();
+		switch ((ap_journal_record_t)record.type)
+		{
+			case ap_journal_record_t::player:
+				deserialize_player_record(values.data(), count);
+				break;
+			case ap_journal_record_t::level:
+				deserialize_level_record(values.data(), count);
+				break;
+			case ap_journal_record_t::check:
+				if (count >= 3 && values[0] >= 0 && values[0] < ap_episode_count &&
+					values[1] >= 0 && values[1] < ap_get_map_count((int)values[0] + 1))
+				{
+					add_level_check({(int)values[0], (int)values[1]}, (int)values[2]);
+				}
+				break;
+			case ap_journal_record_t::item_queue:
+				ap_item_backlog.clear();
+				ap_item_backlog_pos = 0;
+				restore_queued_items(values);
+				break;
+			case ap_journal_record_t::progressive_locations:
+				for (auto loc_id : values)
+					add_progressive_location(loc_id);
+				break;
+			case ap_journal_record_t::game:
+				deserialize_game_record(values.data(), count);
+				break;
+		}
+	}
+
+	if (pos != data.size())
+		printf("  Dropped %i corrupted bytes at the end of the journal.\n", (int)(data.size() - pos));
+	printf("  Replayed %i journal records.\n", record_count);
+	return true;
+}
+
+
+void load_state()
+{
+	printf("APDOOM: Load state\n");
+
+	if (!load_state_journal())
+		load_state_json(); // Older saves, or no state yet
+
+	// Start from a fresh snapshot, this also drops a torn tail
+	if (!journal_write_snapshot())
+		printf("APDOOM: Failed to write state journal.\n");
+}
+
+
+void save_state()
+{
+	bool saved = (ap_journal_record_count > AP_JOURNAL_COMPACT_THRESHOLD) ?
+		journal_write_snapshot() :
+		journal_append_deltas();
+
+	if (!saved)
+	{
+		printf("Failed to save AP state.\n");
+#if WIN32
+		MessageBoxA(nullptr, "Failed to save player state. That's bad.", "Error", MB_OK);
+#endif
+	}
+}
+
+
+//
+// Check spool
+//
+
+static std::string get_check_spool_filename()
+{
+	return ap_save_dir_name + "/apchecks.spool";
+}
+
+
+static void load_check_spool()
+{
+	FILE* f = AP_fopen(get_check_spool_filename().c_str(), "rb");
+	if (!f) return; // Nothing unconfirmed
+
+	int64_t loc_id;
+	int count = 0;
+	{
+		std::lock_guard<std::mutex> lock(ap_spool_mutex);
+		while (fread(&loc_id, sizeof(loc_id), 1, f) == 1)
+		{
+			ap_spooled_checks.insert(loc_id);
+			++count;
+		}
+	}
+	fclose(f);
+
+	printf("APDOOM: %i unconfirmed location checks spooled, they will be resent.\n", count);
+}
+
+
+static void write_check_spool()
+{
+	std::vector<int64_t> loc_ids;
+	{
+		std::lock_guard<std::mutex> lock(ap_spool_mutex);
+		if (!ap_spool_dirty) return;
+		ap_spool_dirty = false;
+		loc_ids.assign(ap_spooled_checks.begin(), ap_spooled_checks.end());
+	}
+
+	std::string filename = get_check_spool_filename();
+	if (loc_ids.empty())
+	{
+		remove(filename.c_str());
+		return;
+	}
+
+	// Write aside then swap, so a crash can't leave a half written spool
+	std::string tmp_filename = filename + ".tmp";
+	FILE* f = AP_fopen(tmp_filename.c_str(), "wb");
+	if (!f)
+	{
+		printf("APDOOM: Failed to write check spool.\n");
+		return;
+	}
+	bool written = fwrite(loc_ids.data(), sizeof(int64_t), loc_ids.size(), f) == loc_ids.size();
+	fclose(f);
+	if (!written || !AP_RenameFile(tmp_filename.c_str(), filename.c_str()))
+		printf("APDOOM: Failed to write check spool.\n");
+}
+
+
+static void confirm_check(int64_t loc_id)
+{
+	std::lock_guard<std::mutex> lock(ap_spool_mutex);
+	if (ap_spooled_checks.erase(loc_id))
+		ap_spool_dirty = true;
+}
+
+
+// Spools and sends this tic's checks in one LocationChecks packet.
+// After a (re)connection, everything still unconfirmed is resent.
+static void flush_checks()
+{
+	bool authenticated = AP_GetConnectionStatus() == AP_ConnectionStatus::Authenticated;
+	bool reconnected = authenticated && !ap_was_authenticated;
+	ap_was_authenticated = authenticated;
+
+	if (ap_pending_checks.empty() && !reconnected) return;
+
+	std::set<int64_t> loc_ids;
+	{
+		std::lock_guard<std::mutex> lock(ap_spool_mutex);
+		if (!ap_pending_checks.empty())
+		{
+			ap_spooled_checks.insert(ap_pending_checks.begin(), ap_pending_checks.end());
+			ap_spool_dirty = true;
+		}
+		loc_ids = reconnected ? ap_spooled_checks : ap_pending_checks;
+	}
+	ap_pending_checks.clear();
+
+	write_check_spool();
+
+	if (authenticated && !loc_ids.empty())
+		AP_SendItem(loc_ids);
+}
+
+
 void f_itemclr()
 {
 	// This gets called when (re)connecting to the server.
@@ -1190,15 +2040,10 @@ const std::map<int, int>& get_weapons_map()
 }
 
 
-const std::map<int, std::string>& get_sprites()
+static int get_sprite_index(int doom_type)
 {
-	switch (ap_game)
-	{
-		case ap_game_t::doom: return ap_doom_type_sprites;
-		case ap_game_t::doom2: return ap_doom2_type_sprites;
-		case ap_game_t::heretic: return ap_heretic_type_sprites;
-		case ap_game_t::hexen: return ap_hexen_type_sprites;
-	}
+	const auto& defs = get_game_defs();
+	return ap_find_type_sprite(defs.type_sprites, defs.type_sprite_count, doom_type);
 }
 
 
@@ -1214,19 +2059,18 @@ std::string get_exmx_name(const std::string& name)
 // This handles everything that requires us be in game, notification icons included
 static void process_received_item(int64_t item_id)
 {
-	const auto& item_type_table = get_item_type_table();
-	auto it = item_type_table.find(item_id);
-	if (it == item_type_table.end())
+	const ap_item_t* item_type = find_item_type(item_id);
+	if (!item_type)
 		return; // Skip -- This is probably redundant, but whatever
 
-	ap_item_t item = it->second;
+	ap_item_t item = *item_type;
 	std::string notif_text;
 
 	// If the item has an associated episode/map, note that
 	if (item.ep != -1)
 	{
 		ap_level_index_t idx = {item.ep - 1, item.map - 1};
-		ap_level_info_t* level_info = ap_get_level_info(idx);
+		const ap_level_info_t* level_info = ap_get_level_info(idx);
 
 		notif_text = get_exmx_name(level_info->name);
 	}
@@ -1234,13 +2078,14 @@ static void process_received_item(int64_t item_id)
 	// Give item to in-game player
 	ap_settings.give_item_callback(item.doom_type == -3 ? item_id : item.doom_type, item.ep, item.map);
 
-	// Add notification icon
-	const auto& sprite_map = get_sprites();
-	auto sprite_it = sprite_map.find(item.doom_type);
-	if (sprite_it != sprite_map.end())
+	// Add notification icon. With the pool full the item still counts, only
+	// its icon is skipped
+	int sprite_index = get_sprite_index(item.doom_type);
+	if (sprite_index != -1 && ap_notification_icon_count < AP_NOTIF_MAX)
 	{
-		ap_notification_icon_t notif;
-		snprintf(notif.sprite, 9, "%s", sprite_it->second.c_str());
+		ap_notification_icon_t& notif = ap_notification_icons[ap_notification_icon_count++];
+		snprintf(notif.sprite, 9, "%s", ap_get_type_sprite_name(sprite_index));
+		notif.icon = sprite_index;
 		notif.t = 0;
 		notif.text[0] = '\0'; // For now
 		if (notif_text != "")
@@ -1254,17 +2099,15 @@ static void process_received_item(int64_t item_id)
 		notif.vely = 0.0f;
 		notif.x = (int)notif.xf;
 		notif.y = (int)notif.yf;
-		ap_notification_icons.push_back(notif);
 	}
 }
 
 void f_itemrecv(int64_t item_id, int player_id, bool notify_player)
 {
-	const auto& item_type_table = get_item_type_table();
-	auto it = item_type_table.find(item_id);
-	if (it == item_type_table.end())
+	const ap_item_t* item_type = find_item_type(item_id);
+	if (!item_type)
 		return; // Skip
-	ap_item_t item = it->second;
+	ap_item_t item = *item_type;
 
 	ap_level_index_t idx = {item.ep - 1, item.map - 1};
 	auto level_state = ap_get_level_state(idx);
@@ -1314,44 +2157,66 @@ void f_itemrecv(int64_t item_id, int player_id, bool notify_player)
 
 	if (!notify_player) return;
 
-	if (!ap_is_in_game)
-		ap_item_queue.push_back(item_id);
-	else
-		process_received_item(item_id);
+	// Given in apdoom_update(), from the game's thread, once we're in game
+	queue_item(item_id);
 }
 
 
 bool find_location(int64_t loc_id, int &ep, int &map, int &index)
 {
-	ep = -1;
-	map = -1;
-	index = -1;
-
-	const auto& loc_table = get_location_table();
-	for (const auto& loc_map_table : loc_table)
+	auto it = ap_location_id_to_key.find(loc_id);
+	if (it == ap_location_id_to_key.end())
 	{
-		for (const auto& loc_index_table : loc_map_table.second)
-		{
-			for (const auto& loc_index : loc_index_table.second)
-			{
-				if (loc_index.second == loc_id)
-				{
-					ep = loc_map_table.first;
-					map = loc_index_table.first;
-					index = loc_index.first;
-					break;
-				}
-			}
-			if (ep != -1) break;
-		}
-		if (ep != -1) break;
+		ep = -1;
+		map = -1;
+		index = -1;
+		return false;
 	}
+
+	ep = it->second.ep;
+	map = it->second.map;
+	index = it->second.index;
 	return (ep > 0);
 }
 
 
+// Called from APCpp's thread by f_locrecv, and from the game thread on load
+static void add_level_check(ap_level_index_t idx, int index)
+{
+	if (index == -1 || index == -2) return;
+
+	std::lock_guard<std::mutex> lock(ap_spool_mutex);
+
+	// Make sure we didn't already check it
+	auto level_state = ap_get_level_state(idx);
+	if (!set_thing_bit(level_state->checked_things, &level_state->checked_specials, ap_get_level_info(idx)->thing_count, index))
+		return;
+	level_state->check_count++;
+	ap_unjournaled_checks.insert(ap_unjournaled_checks.end(), {idx.ep, idx.map, index});
+}
+
+
+// Called from APCpp's thread by f_locinfo, and from the game thread on load
+static void add_progressive_location(int64_t loc_id)
+{
+	std::lock_guard<std::mutex> lock(ap_spool_mutex);
+	if (!ap_progressive_locations.insert(loc_id).second)
+		return;
+	ap_unjournaled_progressive_locations.push_back(loc_id);
+
+	int ep, map, index;
+	if (!find_location(loc_id, ep, map, index))
+		return;
+	ap_level_index_t idx = {ep - 1, map - 1};
+	auto level_state = ap_get_level_state(idx);
+	set_thing_bit(level_state->progression_things, &level_state->progression_specials, ap_get_level_info(idx)->thing_count, index);
+}
+
+
 void f_locrecv(int64_t loc_id)
 {
+	confirm_check(loc_id);
+
 	// Find where this location is
 	int ep = -1;
 	int map = -1;
@@ -1364,13 +2229,7 @@ void f_locrecv(int64_t loc_id)
 
 	ap_level_index_t idx = {ep - 1, map - 1};
 
-	// Make sure we didn't already check it
-	if (is_loc_checked(idx, index)) return;
-	if (index == -1 || index == -2) return;
-
-	auto level_state = ap_get_level_state(idx);
-	level_state->checks[level_state->check_count] = index;
-	level_state->check_count++;
+	add_level_check(idx, index);
 }
 
 
@@ -1379,7 +2238,7 @@ void f_locinfo(std::vector<AP_NetworkItem> loc_infos)
 	for (const auto& loc_info : loc_infos)
 	{
 		if (loc_info.flags & 1)
-			ap_progressive_locations.insert(loc_info.location);
+			add_progressive_location(loc_info.location);
 	}
 }
 
@@ -1584,19 +2443,8 @@ const char* apdoom_get_seed()
 
 void apdoom_check_location(ap_level_index_t idx, int index)
 {
-	int64_t id = 0;
-	const auto& loc_table = get_location_table();
-
-	auto it1 = loc_table.find(idx.ep + 1);
-	if (it1 == loc_table.end()) return;
-
-	auto it2 = it1->second.find(idx.map + 1);
-	if (it2 == it1->second.end()) return;
-
-	auto it3 = it2->second.find(index);
-	if (it3 == it2->second.end()) return;
-
-	id = it3->second;
+	int64_t id = get_location_id(idx, index);
+	if (id == -1) return;
 
 	if (index >= 0)
 	{
@@ -1611,30 +2459,19 @@ void apdoom_check_location(ap_level_index_t idx, int index)
 			//level_state->check_count++;
 		}
 	}
-	AP_SendItem(id);
+	ap_pending_checks.insert(id); // Sent at the end of the tic
 }
 
 void apdoom_send_item(int id) {
-        AP_SendItem(id);
+        ap_pending_checks.insert(id);
 }
 
 
 int apdoom_is_location_progression(ap_level_index_t idx, int index)
 {
-	const auto& loc_table = get_location_table();
-
-	auto it1 = loc_table.find(idx.ep + 1);
-	if (it1 == loc_table.end()) return 0;
-
-	auto it2 = it1->second.find(idx.map + 1);
-	if (it2 == it1->second.end()) return 0;
-
-	auto it3 = it2->second.find(index);
-	if (it3 == it2->second.end()) return 0;
-
-	int64_t id = it3->second;
-
-	return (ap_progressive_locations.find(id) != ap_progressive_locations.end()) ? 1 : 0;
+	std::lock_guard<std::mutex> lock(ap_spool_mutex);
+	auto level_state = ap_get_level_state(idx);
+	return test_thing_bit(level_state->progression_things, level_state->progression_specials, ap_get_level_info(idx)->thing_count, index) ? 1 : 0;
 }
 
 void apdoom_complete_level(ap_level_index_t idx)
@@ -1676,10 +2513,9 @@ ap_level_index_t ap_make_level_index(int ep /* 1-based */, int map /* 1-based */
 
 	// In Doom2, every map is ep = 1
 	ap_level_index_t ret = { 0, map - 1 };
-	const auto& table = get_level_info_table();
-	while (ret.map >= (int)table[ret.ep].size())
+	while (ret.ep + 1 < get_game_defs().episode_count && ret.map >= ap_get_map_count(ret.ep + 1))
 	{
-		ret.map -= (int)table[ret.ep].size();
+		ret.map -= ap_get_map_count(ret.ep + 1);
 		ret.ep++;
 	}
 
@@ -1698,10 +2534,9 @@ int ap_index_to_map(ap_level_index_t idx)
 {
 	if (ap_game != ap_game_t::doom2 && ap_game != ap_game_t::hexen) return idx.map + 1;
 
-	const auto& table = get_level_info_table();
 	for (int ep = 0; ep < idx.ep; ++ep)
 	{
-		idx.map += (int)table[ep].size();
+		idx.map += ap_get_map_count(ep + 1);
 	}
 	return idx.map + 1;
 }
@@ -1760,7 +2595,7 @@ void apdoom_send_message(const char* msg)
 		// Find an E#M# in the text
 		for (size_t i = 6; i < smsg.size() - 4; ++i)
 		{
-			ap_level_info_t* level_info = nullptr;
+			const ap_level_info_t* level_info = nullptr;
 
 			if (toupper(smsg[i]) == 'E' &&
 				toupper(smsg[i + 2]) == 'M' &&
@@ -1885,10 +2720,24 @@ int apdoom_should_die()
 }
 
 
+int ap_get_type_sprite_count()
+{
+	return get_game_defs().type_sprite_count;
+}
+
+
+const char* ap_get_type_sprite_name(int index)
+{
+	const auto& defs = get_game_defs();
+	if (index < 0 || index >= defs.type_sprite_count) return nullptr;
+	return defs.type_sprites[index].sprite;
+}
+
+
 const ap_notification_icon_t* ap_get_notification_icons(int* count)
 {
-	*count = (int)ap_notification_icons.size();
-	return ap_notification_icons.data();
+	*count = ap_notification_icon_count;
+	return ap_notification_icons;
 }
 
 
@@ -1904,7 +2753,7 @@ int ap_get_highest_episode()
 
 int ap_validate_doom_location(ap_level_index_t idx, int doom_type, int index)
 {
-	ap_level_info_t* level_info = ap_get_level_info(idx);
+	const ap_level_info_t* level_info = ap_get_level_info(idx);
     if (index >= level_info->thing_count) return -1;
 	if (level_info->thing_infos[index].doom_type != doom_type) return -1;
 	if (level_info->thing_infos[index].unreachable) return 0;
@@ -1937,18 +2786,19 @@ int ap_validate_doom_location(ap_level_index_t idx, int doom_type, int index)
 */
 void apdoom_update()
 {
-	if (ap_initialized)
+	if (ap_init_state == AP_INIT_STATE_CONNECTING ||
+		ap_init_state == AP_INIT_STATE_SCOUTING)
 	{
-		if (!ap_cached_messages.empty())
-		{
-			for (const auto& cached_msg : ap_cached_messages)
-				ap_settings.message_callback(cached_msg.c_str());
-			ap_cached_messages.clear();
-		}
+		update_init();
 	}
 
 	while (AP_IsMessagePending())
 	{
+		// If full, leave the rest in APCpp until there is room
+		ap_message_slot_t* message_slot = ap_message_queue.prepare();
+		if (!message_slot)
+			break;
+
 		AP_Message* msg = AP_GetLatestMessage();
 
 		std::string colored_msg;
@@ -1982,52 +2832,60 @@ void apdoom_update()
 
 		printf("APDOOM: %s\n", msg->text.c_str());
 
-		if (ap_initialized)
-			ap_settings.message_callback(colored_msg.c_str());
-		else
-			ap_cached_messages.push_back(colored_msg);
+		snprintf(message_slot->text, AP_MESSAGE_MAX, "%s", colored_msg.c_str());
+		ap_message_queue.commit();
 
 		AP_ClearLatestMessage();
 	}
 
-	// Check if we're in game, then dequeue the items
-	if (ap_is_in_game)
+	if (ap_initialized)
 	{
-		while (!ap_item_queue.empty())
+		for (int i = 0; i < AP_MESSAGES_PER_TIC; ++i)
 		{
-			auto item_id = ap_item_queue.front();
-			ap_item_queue.erase(ap_item_queue.begin());
-			process_received_item(item_id);
+			const ap_message_slot_t* message_slot = ap_message_queue.front();
+			if (!message_slot)
+				break;
+			ap_settings.message_callback(message_slot->text);
+			ap_message_queue.pop();
 		}
 	}
 
-	// Update notification icons
+	if (ap_initialized)
+		flush_checks();
+
+	// Check if we're in game, then dequeue the items. A few per tic, so a
+	// big burst after a reconnect doesn't hitch a frame
+	if (ap_is_in_game)
+	{
+		int64_t item_id;
+		for (int i = 0; i < AP_ITEMS_PER_TIC && dequeue_item(item_id); ++i)
+			process_received_item(item_id);
+	}
+
+	// Update notification icons. Finished ones are compacted out in the same pass
 	float previous_y = 2.0f;
-	for (auto it = ap_notification_icons.begin(); it != ap_notification_icons.end();)
+	int speedup = ap_notification_icon_count / 4; // Faster the more we have queued (4 can display on screen)
+	int kept_count = 0;
+	for (int i = 0; i < ap_notification_icon_count; ++i)
 	{
-		auto& notification_icon = *it;
+		auto& notification_icon = ap_notification_icons[i];
 
 		if (notification_icon.state == AP_NOTIF_STATE_PENDING && previous_y > -100.0f)
 		{
 			notification_icon.state = AP_NOTIF_STATE_DROPPING;
 		}
-		if (notification_icon.state == AP_NOTIF_STATE_PENDING)
-		{
-			++it;
-			continue;
-		}
 
 		if (notification_icon.state == AP_NOTIF_STATE_DROPPING)
 		{
-			notification_icon.vely += 0.15f + (float)(ap_notification_icons.size() / 4) * 0.25f;
+			notification_icon.vely += 0.15f + (float)speedup * 0.25f;
 			if (notification_icon.vely > 8.0f) notification_icon.vely = 8.0f;
 			notification_icon.yf += notification_icon.vely;
 			if (notification_icon.yf >= previous_y - AP_NOTIF_SIZE - AP_NOTIF_PADDING)
 			{
 				notification_icon.yf = previous_y - AP_NOTIF_SIZE - AP_NOTIF_PADDING;
-				notification_icon.vely *= -0.3f / ((float)(ap_notification_icons.size() / 4) * 0.05f + 1.0f);
+				notification_icon.vely *= -0.3f / ((float)speedup * 0.05f + 1.0f);
 
-				notification_icon.t += ap_notification_icons.size() / 4 + 1; // Faster the more we have queued (4 can display on screen)
+				notification_icon.t += speedup + 1;
 				if (notification_icon.t > 350 * 3 / 4) // ~7.5sec
 				{
 					notification_icon.state = AP_NOTIF_STATE_HIDING;
@@ -2037,19 +2895,22 @@ void apdoom_update()
 
 		if (notification_icon.state == AP_NOTIF_STATE_HIDING)
 		{
-			notification_icon.velx -= 0.14f + (float)(ap_notification_icons.size() / 4) * 0.1f;
+			notification_icon.velx -= 0.14f + (float)speedup * 0.1f;
 			notification_icon.xf += notification_icon.velx;
 			if (notification_icon.xf < -AP_NOTIF_SIZE / 2)
-			{
-				it = ap_notification_icons.erase(it);
-				continue;
-			}
+				continue; // Done, drop it
 		}
 
-		notification_icon.x = (int)notification_icon.xf;
-		notification_icon.y = (int)notification_icon.yf;
-		previous_y = notification_icon.yf;
+		if (notification_icon.state != AP_NOTIF_STATE_PENDING)
+		{
+			notification_icon.x = (int)notification_icon.xf;
+			notification_icon.y = (int)notification_icon.yf;
+			previous_y = notification_icon.yf;
+		}
 
-		++it;
+		if (kept_count != i)
+			ap_notification_icons[kept_count] = notification_icon;
+		++kept_count;
 	}
+	ap_notification_icon_count = kept_count;
 }
@@ -36,8 +36,8 @@ extern "C"
 #define APDOOM_VERSION_FULL_TEXT "APDOOM " APDOOM_VERSION_TEXT
 
 
-#define AP_CHECK_MAX 64 // Arbitrary number
-#define AP_MAX_THING 1024 // Twice more than current max for every level
+#define AP_BITSET_WORD_BITS 32
+#define AP_BITSET_WORDS(bit_count) (((bit_count) + AP_BITSET_WORD_BITS - 1) / AP_BITSET_WORD_BITS)
 
 
 typedef struct
@@ -56,7 +56,7 @@ typedef struct
     int use_skull[3];
     int check_count;
     int thing_count;
-    ap_thing_info_t thing_infos[AP_MAX_THING];
+    const ap_thing_info_t* thing_infos; // thing_count entries
     int sanity_check_count;
 
 } ap_level_info_t;
@@ -69,7 +69,10 @@ typedef struct
     int check_count;
     int has_map;
     int unlocked;
-    int checks[AP_CHECK_MAX];
+    unsigned int* checked_things; // Bitset by thing index, use ap_is_location_checked()
+    unsigned int* progression_things; // Same, use apdoom_is_location_progression()
+    unsigned int checked_specials; // Bit n is the negative index -n (Hexen)
+    unsigned int progression_specials;
     int special; // Berzerk or Wings
     int flipped;
     int music;
@@ -135,6 +138,7 @@ typedef struct
     void (*message_callback)(const char*);
     void (*give_item_callback)(int doom_type, int ep, int map);
     void (*victory_callback)();
+    void (*ready_callback)(); // Connected, slot data and scouts received. Can be NULL
 
     int override_skill; int skill;
     int override_monster_rando; int monster_rando;
@@ -143,19 +147,29 @@ typedef struct
     int override_flip_levels; int flip_levels;
     int force_deathlink_off;
     int override_reset_level_on_death; int reset_level_on_death;
+    int export_json_state; // Write apstate.json next to the state journal on shutdown
 } ap_settings_t;
 
 
+// apdoom_init() returns right away, the rest happens in apdoom_update()
+#define AP_INIT_STATE_CONNECTING 0
+#define AP_INIT_STATE_SCOUTING 1
+#define AP_INIT_STATE_READY 2
+#define AP_INIT_STATE_FAILED 3
+
+
 #define AP_NOTIF_STATE_PENDING 0
 #define AP_NOTIF_STATE_DROPPING 1
 #define AP_NOTIF_STATE_HIDING 2
 #define AP_NOTIF_SIZE 30
 #define AP_NOTIF_PADDING 2
+#define AP_NOTIF_MAX 256 // Items received while the pool is full get no icon
 
 
 typedef struct
 {
     char sprite[9];
+    int icon; // Index of the sprite, see ap_get_type_sprite_name()
     int x, y;
     float xf, yf;
     float velx, vely;
@@ -184,14 +198,20 @@ void apdoom_save_state();
 void apdoom_check_location(ap_level_index_t idx, int index);
 void apdoom_send_item(int index);
 int apdoom_is_location_progression(ap_level_index_t idx, int index);
+int ap_is_location_checked(ap_level_index_t idx, int index);
 void apdoom_check_victory();
 void apdoom_update();
+int apdoom_get_init_state();
+const char* apdoom_get_init_status_text(); // Progress, or reason of failure
+int apdoom_wait_for_init(); // Blocks until ready or failed, returns the state
 const char* apdoom_get_seed();
 void apdoom_send_message(const char* msg);
 void apdoom_complete_level(ap_level_index_t idx);
 ap_level_state_t* ap_get_level_state(ap_level_index_t idx); // 1-based
-ap_level_info_t* ap_get_level_info(ap_level_index_t idx); // 1-based
+const ap_level_info_t* ap_get_level_info(ap_level_index_t idx); // 1-based
 const ap_notification_icon_t* ap_get_notification_icons(int* count);
+int ap_get_type_sprite_count();
+const char* ap_get_type_sprite_name(int index); // Sprites of the notification icons, for building their atlas
 int ap_get_highest_episode();
 int ap_validate_doom_location(ap_level_index_t idx, int doom_type, int index);
 int ap_get_map_count(int ep);
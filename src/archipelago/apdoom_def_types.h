@@ -1,5 +1,8 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+
 
 // Map item id
 struct ap_item_t
@@ -8,3 +11,64 @@ struct ap_item_t
     int ep; // If doom_type is a keycard
     int map; // If doom_type is a keycard
 };
+
+
+// Location key, as used by the generated location tables
+struct ap_location_key_t
+{
+    int ep; // 1-based
+    int map; // 1-based
+    int index; // Thing index. -1 is level complete location
+};
+
+
+// Generated location table entry
+struct ap_location_def_t
+{
+    int64_t id;
+    ap_location_key_t key;
+};
+
+
+// Generated item table entry
+struct ap_item_def_t
+{
+    int64_t id;
+    ap_item_t item;
+};
+
+
+// Span of an episode's levels in the generated level infos
+struct ap_episode_def_t
+{
+    int first_level;
+    int level_count;
+};
+
+
+// Generated sprite for item doom types (Used by notification icons)
+struct ap_type_sprite_t
+{
+    int doom_type;
+    const char* sprite;
+};
+
+
+// Generated tables are sorted by key, lookups are binary searches.
+inline const ap_item_t* ap_find_item_def(const ap_item_def_t* items, int count, int64_t id)
+{
+    auto end = items + count;
+    auto it = std::lower_bound(items, end, id, [](const ap_item_def_t& def, int64_t id) { return def.id < id; });
+    if (it == end || it->id != id) return nullptr;
+    return &it->item;
+}
+
+
+// Returns the index in sprites, or -1
+inline int ap_find_type_sprite(const ap_type_sprite_t* sprites, int count, int doom_type)
+{
+    auto end = sprites + count;
+    auto it = std::lower_bound(sprites, end, doom_type, [](const ap_type_sprite_t& def, int doom_type) { return def.doom_type < doom_type; });
+    if (it == end || it->doom_type != doom_type) return -1;
+    return (int)(it - sprites);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+
+// Bounded single-producer/single-consumer queue. The producer only writes
+// head, the consumer only writes tail, so neither side needs a lock.
+// Capacity must be a power of two. Slots are preallocated, push/pop copy.
+template<typename T, size_t Capacity>
+class ap_spsc_ring_t
+{
+    static_assert(Capacity && !(Capacity & (Capacity - 1)), "Capacity must be a power of two");
+
+public:
+    // Producer side. Returns false if full.
+    bool push(const T& value)
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == Capacity)
+            return false;
+        m_slots[head & (Capacity - 1)] = value;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Producer side, for big slots: fill the slot in place then commit().
+    // Returns nullptr if full.
+    T* prepare()
+    {
+        size_t head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) == Capacity)
+            return nullptr;
+        return &m_slots[head & (Capacity - 1)];
+    }
+
+    void commit()
+    {
+        m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Consumer side. Returns nullptr if empty. The slot stays valid until pop().
+    const T* front() const
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        if (tail == m_head.load(std::memory_order_acquire))
+            return nullptr;
+        return &m_slots[tail & (Capacity - 1)];
+    }
+
+    void pop()
+    {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    // Consumer side. Visits queued values, oldest first, without popping them.
+    template<typename F>
+    void for_each(F&& f) const
+    {
+        size_t tail = m_tail.load(std::memory_order_relaxed);
+        size_t head = m_head.load(std::memory_order_acquire);
+        for (size_t i = tail; i != head; ++i)
+            f(m_slots[i & (Capacity - 1)]);
+    }
+
+    bool empty() const
+    {
+        return m_tail.load(std::memory_order_relaxed) == m_head.load(std::memory_order_acquire);
+    }
+
+private:
+    T m_slots[Capacity];
+    alignas(64) std::atomic<size_t> m_head{0};
+    alignas(64) std::atomic<size_t> m_tail{0};
+};
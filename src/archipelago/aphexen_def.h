@@ -1,12843 +1,12775 @@
+// This file is auto generated. More info: https://github.com/Daivuk/apdoom
 #pragma once
 
 #include "apdoom.h"
 #include "apdoom_def_types.h"
-#include <map>
-#include <string>
-#include <vector>
 
 
-const std::map<int /* ep */, std::map<int /* map */, std::map<int /* index */, int64_t /* loc id */>>> ap_hexen_location_table = {
-    {1, {
-        {1, {
-            {-1, 391236},
-            {110, 391000},
-            {121, 391001},
-            {219, 391002},
-        }},
-        {2, {
-            {-7, 391212},
-            {-6, 391211},
-            {-5, 391210},
-            {-4, 391209},
-            {-3, 391208},
-            {301, 391003},
-            {302, 391004},
-            {303, 391005},
-            {304, 391006},
-            {644, 391007},
-            {645, 391008},
-            {646, 391009},
-        }},
-        {3, {
-            {-3, 391213},
-            {52, 391010},
-            {156, 391011},
-            {157, 391012},
-            {158, 391013},
-            {159, 391014},
-            {160, 391015},
-            {303, 391016},
-        }},
-        {4, {
-            {-3, 391205},
-            {-4, 391214},
-            {-5, 391216},
-            {74, 391017},
-            {105, 391018},
-            {106, 391019},
-            {107, 391020},
-        }},
-        {5, {
-            {-6, 391217},
-            {-5, 391215},
-            {-4, 391207},
-            {-3, 391206},
-            {7, 391021},
-            {22, 391022},
-            {25, 391023},
-            {268, 391024},
-            {396, 391025},
-        }},
-        {6, {
-            {-3, 391218},
-            {19, 391026},
-            {95, 391027},
-            {96, 391028},
-            {97, 391029},
-            {98, 391030},
-            {193, 391031},
-        }},
-    }},
-    {2, {
-        {1, {
-            {-4, 391220},
-            {-3, 391219},
-            {-1, 391237},
-            {115, 391032},
-            {209, 391033},
-            {254, 391034},
-            {255, 391035},
-            {257, 391037},
-            {258, 391038},
-            {259, 391039},
-            {260, 391040},
-            {262, 391042},
-            {263, 391043},
-        }},
-        {2, {
-            {-4, 391222},
-            {-3, 391221},
-            {115, 391044},
-            {116, 391045},
-            {131, 391046},
-            {132, 391047},
-            {209, 391048},
-        }},
-        {3, {
-            {-4, 391224},
-            {-3, 391223},
-            {73, 391050},
-            {150, 391051},
-            {151, 391052},
-            {152, 391053},
-            {153, 391054},
-            {154, 391055},
-            {155, 391056},
-            {156, 391057},
-        }},
-        {4, {
-            {-3, 391225},
-            {62, 391058},
-            {63, 391059},
-            {64, 391060},
-        }},
-        {5, {
-            {63, 391061},
-            {79, 391062},
-            {80, 391063},
-            {81, 391064},
-        }},
-        {6, {
-            {209, 391065},
-            {210, 391066},
-            {211, 391067},
-            {212, 391068},
-            {213, 391069},
-            {214, 391070},
-            {215, 391071},
-            {330, 391072},
-        }},
-    }},
-    {4, {
-        {1, {
-            {-3, 391235},
-            {-1, 391239},
-            {135, 391073},
-            {148, 391074},
-            {149, 391075},
-            {150, 391076},
-            {151, 391077},
-            {152, 391078},
-            {153, 391079},
-        }},
-        {2, {
-            {153, 391080},
-            {154, 391081},
-            {155, 391082},
-            {256, 391083},
-            {257, 391084},
-            {258, 391085},
-            {259, 391086},
-        }},
-        {3, {
-            {54, 391087},
-            {89, 391088},
-            {103, 391089},
-            {203, 391090},
-            {311, 391091},
-            {312, 391092},
-            {313, 391093},
-            {470, 391094},
-        }},
-        {4, {
-            {104, 391095},
-            {105, 391096},
-            {106, 391097},
-            {120, 391098},
-            {121, 391099},
-            {183, 391100},
-            {233, 391101},
-            {268, 391102},
-        }},
-        {5, {
-            {247, 391103},
-            {248, 391104},
-            {265, 391105},
-        }},
-        {6, {
-            {65, 391106},
-            {66, 391107},
-            {67, 391108},
-            {68, 391109},
-            {69, 391110},
-            {70, 391111},
-            {71, 391112},
-            {72, 391113},
-            {73, 391114},
-            {74, 391115},
-            {75, 391116},
-            {76, 391117},
-            {77, 391118},
-            {78, 391119},
-            {79, 391120},
-            {80, 391121},
-        }},
-    }},
-    {3, {
-        {1, {
-            {-1, 391238},
-            {75, 391122},
-            {108, 391123},
-            {109, 391124},
-            {110, 391125},
-            {344, 391126},
-            {345, 391127},
-        }},
-        {2, {
-            {-5, 391228},
-            {-4, 391227},
-            {-3, 391226},
-            {104, 391128},
-        }},
-        {3, {
-            {-5, 391234},
-            {-4, 391233},
-            {-3, 391232},
-            {60, 391129},
-            {119, 391130},
-            {193, 391131},
-            {195, 391132},
-            {217, 391133},
-        }},
-        {4, {
-            {73, 391134},
-            {74, 391135},
-            {83, 391136},
-            {84, 391137},
-            {85, 391138},
-            {86, 391139},
-            {87, 391140},
-            {88, 391141},
-        }},
-        {5, {
-            {5, 391142},
-            {6, 391143},
-            {62, 391144},
-            {63, 391145},
-            {134, 391146},
-            {135, 391147},
-            {136, 391148},
-        }},
-        {6, {
-            {19, 391149},
-            {20, 391150},
-            {21, 391151},
-            {70, 391152},
-            {71, 391153},
-            {72, 391154},
-            {73, 391155},
-            {74, 391156},
-            {131, 391157},
-            {156, 391158},
-        }},
-        {7, {
-            {-5, 391231},
-            {-4, 391230},
-            {-3, 391229},
-            {42, 391159},
-            {43, 391160},
-            {44, 391161},
-            {174, 391162},
-            {276, 391163},
-        }},
-    }},
-    {5, {
-        {1, {
-            {-1, 391240},
-            {76, 391164},
-            {77, 391165},
-            {78, 391166},
-        }},
-        {2, {
-            {87, 391167},
-            {88, 391168},
-            {89, 391169},
-            {90, 391170},
-            {91, 391171},
-            {92, 391172},
-            {242, 391173},
-        }},
-        {3, {
-            {58, 391174},
-            {59, 391175},
-            {60, 391176},
-            {61, 391177},
-            {62, 391178},
-            {203, 391179},
-        }},
-        {4, {
-            {6, 391180},
-            {7, 391181},
-            {8, 391182},
-            {9, 391183},
-            {10, 391184},
-            {134, 391185},
-        }},
-        {5, {
-            {103, 391186},
-            {104, 391187},
-            {109, 391188},
-            {110, 391189},
-            {111, 391190},
-            {112, 391191},
-            {113, 391192},
-            {163, 391193},
-            {164, 391194},
-            {165, 391195},
-            {179, 391196},
-        }},
-        {6, {
-            {472, 391197},
-            {473, 391198},
-            {474, 391199},
-            {475, 391200},
-            {476, 391201},
-            {477, 391202},
-            {478, 391203},
-            {479, 391204},
-        }},
-    }},
+// Locations, sorted by id
+constexpr ap_location_def_t ap_hexen_locations[] = {
+    {391000, {1, 1, 110}},
+    {391001, {1, 1, 121}},
+    {391002, {1, 1, 219}},
+    {391003, {1, 2, 301}},
+    {391004, {1, 2, 302}},
+    {391005, {1, 2, 303}},
+    {391006, {1, 2, 304}},
+    {391007, {1, 2, 644}},
+    {391008, {1, 2, 645}},
+    {391009, {1, 2, 646}},
+    {391010, {1, 3, 52}},
+    {391011, {1, 3, 156}},
+    {391012, {1, 3, 157}},
+    {391013, {1, 3, 158}},
+    {391014, {1, 3, 159}},
+    {391015, {1, 3, 160}},
+    {391016, {1, 3, 303}},
+    {391017, {1, 4, 74}},
+    {391018, {1, 4, 105}},
+    {391019, {1, 4, 106}},
+    {391020, {1, 4, 107}},
+    {391021, {1, 5, 7}},
+    {391022, {1, 5, 22}},
+    {391023, {1, 5, 25}},
+    {391024, {1, 5, 268}},
+    {391025, {1, 5, 396}},
+    {391026, {1, 6, 19}},
+    {391027, {1, 6, 95}},
+    {391028, {1, 6, 96}},
+    {391029, {1, 6, 97}},
+    {391030, {1, 6, 98}},
+    {391031, {1, 6, 193}},
+    {391032, {2, 1, 115}},
+    {391033, {2, 1, 209}},
+    {391034, {2, 1, 254}},
+    {391035, {2, 1, 255}},
+    {391037, {2, 1, 257}},
+    {391038, {2, 1, 258}},
+    {391039, {2, 1, 259}},
+    {391040, {2, 1, 260}},
+    {391042, {2, 1, 262}},
+    {391043, {2, 1, 263}},
+    {391044, {2, 2, 115}},
+    {391045, {2, 2, 116}},
+    {391046, {2, 2, 131}},
+    {391047, {2, 2, 132}},
+    {391048, {2, 2, 209}},
+    {391050, {2, 3, 73}},
+    {391051, {2, 3, 150}},
+    {391052, {2, 3, 151}},
+    {391053, {2, 3, 152}},
+    {391054, {2, 3, 153}},
+    {391055, {2, 3, 154}},
+    {391056, {2, 3, 155}},
+    {391057, {2, 3, 156}},
+    {391058, {2, 4, 62}},
+    {391059, {2, 4, 63}},
+    {391060, {2, 4, 64}},
+    {391061, {2, 5, 63}},
+    {391062, {2, 5, 79}},
+    {391063, {2, 5, 80}},
+    {391064, {2, 5, 81}},
+    {391065, {2, 6, 209}},
+    {391066, {2, 6, 210}},
+    {391067, {2, 6, 211}},
+    {391068, {2, 6, 212}},
+    {391069, {2, 6, 213}},
+    {391070, {2, 6, 214}},
+    {391071, {2, 6, 215}},
+    {391072, {2, 6, 330}},
+    {391073, {4, 1, 135}},
+    {391074, {4, 1, 148}},
+    {391075, {4, 1, 149}},
+    {391076, {4, 1, 150}},
+    {391077, {4, 1, 151}},
+    {391078, {4, 1, 152}},
+    {391079, {4, 1, 153}},
+    {391080, {4, 2, 153}},
+    {391081, {4, 2, 154}},
+    {391082, {4, 2, 155}},
+    {391083, {4, 2, 256}},
+    {391084, {4, 2, 257}},
+    {391085, {4, 2, 258}},
+    {391086, {4, 2, 259}},
+    {391087, {4, 3, 54}},
+    {391088, {4, 3, 89}},
+    {391089, {4, 3, 103}},
+    {391090, {4, 3, 203}},
+    {391091, {4, 3, 311}},
+    {391092, {4, 3, 312}},
+    {391093, {4, 3, 313}},
+    {391094, {4, 3, 470}},
+    {391095, {4, 4, 104}},
+    {391096, {4, 4, 105}},
+    {391097, {4, 4, 106}},
+    {391098, {4, 4, 120}},
+    {391099, {4, 4, 121}},
+    {391100, {4, 4, 183}},
+    {391101, {4, 4, 233}},
+    {391102, {4, 4, 268}},
+    {391103, {4, 5, 247}},
+    {391104, {4, 5, 248}},
+    {391105, {4, 5, 265}},
+    {391106, {4, 6, 65}},
+    {391107, {4, 6, 66}},
+    {391108, {4, 6, 67}},
+    {391109, {4, 6, 68}},
+    {391110, {4, 6, 69}},
+    {391111, {4, 6, 70}},
+    {391112, {4, 6, 71}},
+    {391113, {4, 6, 72}},
+    {391114, {4, 6, 73}},
+    {391115, {4, 6, 74}},
+    {391116, {4, 6, 75}},
+    {391117, {4, 6, 76}},
+    {391118, {4, 6, 77}},
+    {391119, {4, 6, 78}},
+    {391120, {4, 6, 79}},
+    {391121, {4, 6, 80}},
+    {391122, {3, 1, 75}},
+    {391123, {3, 1, 108}},
+    {391124, {3, 1, 109}},
+    {391125, {3, 1, 110}},
+    {391126, {3, 1, 344}},
+    {391127, {3, 1, 345}},
+    {391128, {3, 2, 104}},
+    {391129, {3, 3, 60}},
+    {391130, {3, 3, 119}},
+    {391131, {3, 3, 193}},
+    {391132, {3, 3, 195}},
+    {391133, {3, 3, 217}},
+    {391134, {3, 4, 73}},
+    {391135, {3, 4, 74}},
+    {391136, {3, 4, 83}},
+    {391137, {3, 4, 84}},
+    {391138, {3, 4, 85}},
+    {391139, {3, 4, 86}},
+    {391140, {3, 4, 87}},
+    {391141, {3, 4, 88}},
+    {391142, {3, 5, 5}},
+    {391143, {3, 5, 6}},
+    {391144, {3, 5, 62}},
+    {391145, {3, 5, 63}},
+    {391146, {3, 5, 134}},
+    {391147, {3, 5, 135}},
+    {391148, {3, 5, 136}},
+    {391149, {3, 6, 19}},
+    {391150, {3, 6, 20}},
+    {391151, {3, 6, 21}},
+    {391152, {3, 6, 70}},
+    {391153, {3, 6, 71}},
+    {391154, {3, 6, 72}},
+    {391155, {3, 6, 73}},
+    {391156, {3, 6, 74}},
+    {391157, {3, 6, 131}},
+    {391158, {3, 6, 156}},
+    {391159, {3, 7, 42}},
+    {391160, {3, 7, 43}},
+    {391161, {3, 7, 44}},
+    {391162, {3, 7, 174}},
+    {391163, {3, 7, 276}},
+    {391164, {5, 1, 76}},
+    {391165, {5, 1, 77}},
+    {391166, {5, 1, 78}},
+    {391167, {5, 2, 87}},
+    {391168, {5, 2, 88}},
+    {391169, {5, 2, 89}},
+    {391170, {5, 2, 90}},
+    {391171, {5, 2, 91}},
+    {391172, {5, 2, 92}},
+    {391173, {5, 2, 242}},
+    {391174, {5, 3, 58}},
+    {391175, {5, 3, 59}},
+    {391176, {5, 3, 60}},
+    {391177, {5, 3, 61}},
+    {391178, {5, 3, 62}},
+    {391179, {5, 3, 203}},
+    {391180, {5, 4, 6}},
+    {391181, {5, 4, 7}},
+    {391182, {5, 4, 8}},
+    {391183, {5, 4, 9}},
+    {391184, {5, 4, 10}},
+    {391185, {5, 4, 134}},
+    {391186, {5, 5, 103}},
+    {391187, {5, 5, 104}},
+    {391188, {5, 5, 109}},
+    {391189, {5, 5, 110}},
+    {391190, {5, 5, 111}},
+    {391191, {5, 5, 112}},
+    {391192, {5, 5, 113}},
+    {391193, {5, 5, 163}},
+    {391194, {5, 5, 164}},
+    {391195, {5, 5, 165}},
+    {391196, {5, 5, 179}},
+    {391197, {5, 6, 472}},
+    {391198, {5, 6, 473}},
+    {391199, {5, 6, 474}},
+    {391200, {5, 6, 475}},
+    {391201, {5, 6, 476}},
+    {391202, {5, 6, 477}},
+    {391203, {5, 6, 478}},
+    {391204, {5, 6, 479}},
+    {391205, {1, 4, -3}},
+    {391206, {1, 5, -3}},
+    {391207, {1, 5, -4}},
+    {391208, {1, 2, -3}},
+    {391209, {1, 2, -4}},
+    {391210, {1, 2, -5}},
+    {391211, {1, 2, -6}},
+    {391212, {1, 2, -7}},
+    {391213, {1, 3, -3}},
+    {391214, {1, 4, -4}},
+    {391215, {1, 5, -5}},
+    {391216, {1, 4, -5}},
+    {391217, {1, 5, -6}},
+    {391218, {1, 6, -3}},
+    {391219, {2, 1, -3}},
+    {391220, {2, 1, -4}},
+    {391221, {2, 2, -3}},
+    {391222, {2, 2, -4}},
+    {391223, {2, 3, -3}},
+    {391224, {2, 3, -4}},
+    {391225, {2, 4, -3}},
+    {391226, {3, 2, -3}},
+    {391227, {3, 2, -4}},
+    {391228, {3, 2, -5}},
+    {391229, {3, 7, -3}},
+    {391230, {3, 7, -4}},
+    {391231, {3, 7, -5}},
+    {391232, {3, 3, -3}},
+    {391233, {3, 3, -4}},
+    {391234, {3, 3, -5}},
+    {391235, {4, 1, -3}},
+    {391236, {1, 1, -1}},
+    {391237, {2, 1, -1}},
+    {391238, {3, 1, -1}},
+    {391239, {4, 1, -1}},
+    {391240, {5, 1, -1}},
 };
 
 
-// Map item id
-const std::map<int64_t, ap_item_t> ap_hexen_item_table = {
-    {390000, { 8010, -1, -1 }},
-    {390001, { 123, -1, -1 }},
-    {390002, { 12, -1, -1 }},
-    {390003, { 13, -1, -1 }},
-    {390004, { 16, -1, -1 }},
-    {390005, { 10, -1, -1 }},
-    {390006, { 8009, -1, -1 }},
-    {390007, { 18, -1, -1 }},
-    {390008, { 19, -1, -1 }},
-    {390009, { 20, -1, -1 }},
-    {390010, { 53, -1, -1 }},
-    {390011, { 8040, -1, -1 }},
-    {390012, { 21, -1, -1 }},
-    {390013, { 22, -1, -1 }},
-    {390014, { 23, -1, -1 }},
-    {390015, { 8034, -1, -1 }},
-    {390016, { 8036, -1, -1 }},
-    {390017, { 8030, -1, -1 }},
-    {390018, { 8033, -1, -1 }},
-    {390019, { 8038, -1, -1 }},
-    {390020, { 8031, -1, -1 }},
-    {390021, { 8039, -1, -1 }},
-    {390022, { 8200, -1, -1 }},
-    {390023, { 8037, -1, -1 }},
-    {390024, { 8035, -1, -1 }},
-    {390025, { 8032, -1, -1 }},
-    {390026, { 9014, -1, -1 }},
-    {390027, { 9003, -1, -1 }},
-    {390028, { 9004, -1, -1 }},
-    {390029, { 9005, -1, -1 }},
-    {390030, { 9009, -1, -1 }},
-    {390031, { 9006, -1, -1 }},
-    {390032, { 9010, -1, -1 }},
-    {390033, { 9007, -1, -1 }},
-    {390034, { 9008, -1, -1 }},
-    {390035, { 9018, -1, -1 }},
-    {390036, { 9019, -1, -1 }},
-    {390037, { 9020, -1, -1 }},
-    {390038, { 9021, -1, -1 }},
-    {390039, { 9002, -1, -1 }},
-    {390040, { 9015, -1, -1 }},
-    {390041, { 9016, -1, -1 }},
-    {390042, { 9017, -1, -1 }},
-    {390043, { -1, 1, 1 }},
-    {390044, { -2, 1, 1 }},
-    {390045, { -1, 2, 1 }},
-    {390046, { -2, 2, 1 }},
-    {390047, { -1, 3, 1 }},
-    {390048, { -2, 3, 1 }},
-    {390049, { -1, 4, 1 }},
-    {390050, { -2, 4, 1 }},
-    {390051, { -1, 5, 1 }},
-    {390052, { -2, 5, 1 }},
-    {390053, { -3, -1, -1 }},
-    {390054, { -3, -1, -1 }},
-    {390055, { -3, -1, -1 }},
-    {390056, { -3, -1, -1 }},
-    {390057, { -3, -1, -1 }},
-    {390058, { -3, -1, -1 }},
-    {390059, { -3, -1, -1 }},
-    {390060, { -3, -1, -1 }},
-    {390061, { -3, -1, -1 }},
-    {390062, { -3, -1, -1 }},
-    {390063, { -3, -1, -1 }},
-    {390064, { -3, -1, -1 }},
-    {390065, { -3, -1, -1 }},
-    {390066, { -3, -1, -1 }},
-    {390067, { -3, -1, -1 }},
-    {390068, { -3, -1, -1 }},
-    {390069, { -3, -1, -1 }},
-    {390070, { -3, -1, -1 }},
-    {390071, { -3, -1, -1 }},
-    {390072, { -3, -1, -1 }},
-    {390073, { -3, -1, -1 }},
-    {390074, { -3, -1, -1 }},
-    {390075, { -3, -1, -1 }},
-    {390076, { -3, -1, -1 }},
-    {390077, { -3, -1, -1 }},
-    {390078, { -3, -1, -1 }},
-    {390079, { 122, -1, -1 }},
-    {390080, { 124, -1, -1 }},
-    {390081, { 8004, -1, -1 }},
-    {390082, { 8008, -1, -1 }},
-    {390083, { 8006, -1, -1 }},
-    {390084, { 8005, -1, -1 }},
-    {390085, { 8007, -1, -1 }},
-    {390086, { 8041, -1, -1 }},
-    {390087, { 32, -1, -1 }},
-    {390088, { 10040, -1, -1 }},
-    {390089, { 8002, -1, -1 }},
-    {390090, { 36, -1, -1 }},
-    {390091, { 86, -1, -1 }},
-    {390092, { 84, -1, -1 }},
-    {390093, { 8003, -1, -1 }},
-    {390094, { 30, -1, -1 }},
-    {390095, { 33, -1, -1 }},
-    {390096, { 10110, -1, -1 }},
-    {390097, { 8000, -1, -1 }},
-    {390098, { 82, -1, -1 }},
+// Map item id, sorted by id
+constexpr ap_item_def_t ap_hexen_items[] = {
+    {390000, {8010, -1, -1}},
+    {390001, {123, -1, -1}},
+    {390002, {12, -1, -1}},
+    {390003, {13, -1, -1}},
+    {390004, {16, -1, -1}},
+    {390005, {10, -1, -1}},
+    {390006, {8009, -1, -1}},
+    {390007, {18, -1, -1}},
+    {390008, {19, -1, -1}},
+    {390009, {20, -1, -1}},
+    {390010, {53, -1, -1}},
+    {390011, {8040, -1, -1}},
+    {390012, {21, -1, -1}},
+    {390013, {22, -1, -1}},
+    {390014, {23, -1, -1}},
+    {390015, {8034, -1, -1}},
+    {390016, {8036, -1, -1}},
+    {390017, {8030, -1, -1}},
+    {390018, {8033, -1, -1}},
+    {390019, {8038, -1, -1}},
+    {390020, {8031, -1, -1}},
+    {390021, {8039, -1, -1}},
+    {390022, {8200, -1, -1}},
+    {390023, {8037, -1, -1}},
+    {390024, {8035, -1, -1}},
+    {390025, {8032, -1, -1}},
+    {390026, {9014, -1, -1}},
+    {390027, {9003, -1, -1}},
+    {390028, {9004, -1, -1}},
+    {390029, {9005, -1, -1}},
+    {390030, {9009, -1, -1}},
+    {390031, {9006, -1, -1}},
+    {390032, {9010, -1, -1}},
+    {390033, {9007, -1, -1}},
+    {390034, {9008, -1, -1}},
+    {390035, {9018, -1, -1}},
+    {390036, {9019, -1, -1}},
+    {390037, {9020, -1, -1}},
+    {390038, {9021, -1, -1}},
+    {390039, {9002, -1, -1}},
+    {390040, {9015, -1, -1}},
+    {390041, {9016, -1, -1}},
+    {390042, {9017, -1, -1}},
+    {390043, {-1, 1, 1}},
+    {390044, {-2, 1, 1}},
+    {390045, {-1, 2, 1}},
+    {390046, {-2, 2, 1}},
+    {390047, {-1, 3, 1}},
+    {390048, {-2, 3, 1}},
+    {390049, {-1, 4, 1}},
+    {390050, {-2, 4, 1}},
+    {390051, {-1, 5, 1}},
+    {390052, {-2, 5, 1}},
+    {390053, {-3, -1, -1}},
+    {390054, {-3, -1, -1}},
+    {390055, {-3, -1, -1}},
+    {390056, {-3, -1, -1}},
+    {390057, {-3, -1, -1}},
+    {390058, {-3, -1, -1}},
+    {390059, {-3, -1, -1}},
+    {390060, {-3, -1, -1}},
+    {390061, {-3, -1, -1}},
+    {390062, {-3, -1, -1}},
+    {390063, {-3, -1, -1}},
+    {390064, {-3, -1, -1}},
+    {390065, {-3, -1, -1}},
+    {390066, {-3, -1, -1}},
+    {390067, {-3, -1, -1}},
+    {390068, {-3, -1, -1}},
+    {390069, {-3, -1, -1}},
+    {390070, {-3, -1, -1}},
+    {390071, {-3, -1, -1}},
+    {390072, {-3, -1, -1}},
+    {390073, {-3, -1, -1}},
+    {390074, {-3, -1, -1}},
+    {390075, {-3, -1, -1}},
+    {390076, {-3, -1, -1}},
+    {390077, {-3, -1, -1}},
+    {390078, {-3, -1, -1}},
+    {390079, {122, -1, -1}},
+    {390080, {124, -1, -1}},
+    {390081, {8004, -1, -1}},
+    {390082, {8008, -1, -1}},
+    {390083, {8006, -1, -1}},
+    {390084, {8005, -1, -1}},
+    {390085, {8007, -1, -1}},
+    {390086, {8041, -1, -1}},
+    {390087, {32, -1, -1}},
+    {390088, {10040, -1, -1}},
+    {390089, {8002, -1, -1}},
+    {390090, {36, -1, -1}},
+    {390091, {86, -1, -1}},
+    {390092, {84, -1, -1}},
+    {390093, {8003, -1, -1}},
+    {390094, {30, -1, -1}},
+    {390095, {33, -1, -1}},
+    {390096, {10110, -1, -1}},
+    {390097, {8000, -1, -1}},
+    {390098, {82, -1, -1}},
 };
 
 
-std::vector<std::vector<ap_level_info_t>> ap_hexen_level_infos = 
-{
-    {
-        {"Winnowing Hall", {false, false, false}, {0, 0, 0}, 3, 350, {
-            {78, 0, 0},
-            {79, 1, 0},
-            {79, 2, 0},
-            {2, 3, 0},
-            {1, 4, 0},
-            {116, 5, 0},
-            {116, 6, 0},
-            {17, 7, 0},
-            {116, 8, 0},
-            {116, 9, 0},
-            {17, 10, 0},
-            {116, 11, 0},
-            {116, 12, 0},
-            {17, 13, 0},
-            {54, 14, 0},
-            {54, 15, 0},
-            {54, 16, 0},
-            {54, 17, 0},
-            {1404, 18, 0},
-            {1404, 19, 0},
-            {1404, 20, 0},
-            {1404, 21, 0},
-            {1404, 22, 0},
-            {1404, 23, 0},
-            {1404, 24, 0},
-            {1404, 25, 0},
-            {1404, 26, 0},
-            {1404, 27, 0},
-            {71, 28, 0},
-            {72, 29, 0},
-            {72, 30, 0},
-            {72, 31, 0},
-            {72, 32, 0},
-            {72, 33, 0},
-            {1404, 34, 0},
-            {72, 35, 0},
-            {1404, 36, 0},
-            {1404, 37, 0},
-            {3000, 38, 0},
-            {3000, 39, 0},
-            {3002, 40, 0},
-            {3002, 41, 0},
-            {8061, 42, 0},
-            {8061, 43, 0},
-            {8061, 44, 0},
-            {8061, 45, 0},
-            {8061, 46, 0},
-            {3000, 47, 0},
-            {3002, 48, 0},
-            {3002, 49, 0},
-            {3000, 50, 0},
-            {9001, 51, 0},
-            {9001, 52, 0},
-            {1410, 53, 0},
-            {8061, 54, 0},
-            {8061, 55, 0},
-            {102, 56, 0},
-            {102, 57, 0},
-            {104, 58, 0},
-            {104, 59, 0},
-            {106, 60, 0},
-            {97, 61, 0},
-            {8044, 62, 0},
-            {8044, 63, 0},
-            {8044, 64, 0},
-            {8044, 65, 0},
-            {78, 66, 0},
-            {78, 67, 0},
-            {78, 68, 0},
-            {78, 69, 0},
-            {78, 70, 0},
-            {78, 71, 0},
-            {79, 72, 0},
-            {79, 73, 0},
-            {79, 74, 0},
-            {8061, 75, 0},
-            {8061, 76, 0},
-            {10030, 77, 0},
-            {10030, 78, 0},
-            {10030, 79, 0},
-            {10030, 80, 0},
-            {3000, 81, 0},
-            {3000, 82, 0},
-            {3000, 83, 0},
-            {3000, 84, 0},
-            {3000, 85, 0},
-            {3000, 86, 0},
-            {3000, 87, 0},
-            {3000, 88, 0},
-            {3002, 89, 0},
-            {3002, 90, 0},
-            {3002, 91, 0},
-            {3002, 92, 0},
-            {3002, 93, 0},
-            {3002, 94, 0},
-            {3002, 95, 0},
-            {3002, 96, 0},
-            {54, 97, 0},
-            {54, 98, 0},
-            {54, 99, 0},
-            {54, 100, 0},
-            {1404, 101, 0},
-            {50, 102, 0},
-            {1410, 103, 0},
-            {1410, 104, 0},
-            {1410, 105, 0},
-            {48, 106, 0},
-            {48, 107, 0},
-            {48, 108, 0},
-            {48, 109, 0},
-            {8036, 110, 0},
-            {57, 111, 0},
-            {48, 112, 0},
-            {48, 113, 0},
-            {48, 114, 0},
-            {48, 115, 0},
-            {48, 116, 0},
-            {99, 117, 0},
-            {8065, 118, 0},
-            {50, 119, 0},
-            {140, 120, 0},
-            {8034, 121, 0},
-            {9001, 122, 0},
-            {9001, 123, 0},
-            {9001, 124, 0},
-            {9001, 125, 0},
-            {9001, 126, 0},
-            {9001, 127, 0},
-            {9001, 128, 0},
-            {9001, 129, 0},
-            {9001, 130, 0},
-            {9001, 131, 0},
-            {9001, 132, 0},
-            {9001, 133, 0},
-            {9001, 134, 0},
-            {9001, 135, 0},
-            {9001, 136, 0},
-            {9001, 137, 0},
-            {9001, 138, 0},
-            {9001, 139, 0},
-            {9001, 140, 0},
-            {9001, 141, 0},
-            {9001, 142, 0},
-            {9001, 143, 0},
-            {9001, 144, 0},
-            {9001, 145, 0},
-            {9001, 146, 0},
-            {9001, 147, 0},
-            {9001, 148, 0},
-            {9001, 149, 0},
-            {9001, 150, 0},
-            {9001, 151, 0},
-            {9001, 152, 0},
-            {9001, 153, 0},
-            {9001, 154, 0},
-            {9001, 155, 0},
-            {9001, 156, 0},
-            {9001, 157, 0},
-            {9001, 158, 0},
-            {9001, 159, 0},
-            {9001, 160, 0},
-            {9001, 161, 0},
-            {9001, 162, 0},
-            {9001, 163, 0},
-            {14, 164, 0},
-            {10030, 165, 0},
-            {10030, 166, 0},
-            {10030, 167, 0},
-            {10030, 168, 0},
-            {10030, 169, 0},
-            {10030, 170, 0},
-            {10030, 171, 0},
-            {10030, 172, 0},
-            {10030, 173, 0},
-            {10030, 174, 0},
-            {10030, 175, 0},
-            {10030, 176, 0},
-            {10030, 177, 0},
-            {11, 178, 0},
-            {11, 179, 0},
-            {8000, 180, 0},
-            {8000, 181, 0},
-            {8000, 182, 0},
-            {8000, 183, 0},
-            {8000, 184, 0},
-            {106, 185, 0},
-            {8000, 186, 0},
-            {8068, 187, 0},
-            {8068, 188, 0},
-            {8068, 189, 0},
-            {8068, 190, 0},
-            {8068, 191, 0},
-            {8068, 192, 0},
-            {8068, 193, 0},
-            {8068, 194, 0},
-            {8068, 195, 0},
-            {8068, 196, 0},
-            {59, 197, 0},
-            {59, 198, 0},
-            {59, 199, 0},
-            {59, 200, 0},
-            {58, 201, 0},
-            {58, 202, 0},
-            {58, 203, 0},
-            {58, 204, 0},
-            {8068, 205, 0},
-            {8068, 206, 0},
-            {8068, 207, 0},
-            {79, 208, 0},
-            {48, 209, 0},
-            {8062, 210, 0},
-            {8062, 211, 0},
-            {113, 212, 0},
-            {79, 213, 0},
-            {82, 214, 0},
-            {81, 215, 0},
-            {82, 216, 0},
-            {81, 217, 0},
-            {82, 218, 0},
-            {8007, 219, 0},
-            {81, 220, 0},
-            {81, 221, 0},
-            {81, 222, 0},
-            {81, 223, 0},
-            {82, 224, 0},
-            {1410, 225, 0},
-            {1410, 226, 0},
-            {10060, 227, 0},
-            {10030, 228, 0},
-            {10030, 229, 0},
-            {10030, 230, 0},
-            {10030, 231, 0},
-            {10030, 232, 0},
-            {10030, 233, 0},
-            {10030, 234, 0},
-            {82, 235, 0},
-            {82, 236, 0},
-            {82, 237, 0},
-            {10030, 238, 0},
-            {10030, 239, 0},
-            {10030, 240, 0},
-            {81, 241, 0},
-            {81, 242, 0},
-            {81, 243, 0},
-            {82, 244, 0},
-            {71, 245, 0},
-            {10030, 246, 0},
-            {10030, 247, 0},
-            {10030, 248, 0},
-            {10030, 249, 0},
-            {10030, 250, 0},
-            {10030, 251, 0},
-            {10030, 252, 0},
-            {10030, 253, 0},
-            {10030, 254, 0},
-            {10030, 255, 0},
-            {10030, 256, 0},
-            {81, 257, 0},
-            {81, 258, 0},
-            {81, 259, 0},
-            {82, 260, 0},
-            {81, 261, 0},
-            {81, 262, 0},
-            {81, 263, 0},
-            {81, 264, 0},
-            {81, 265, 0},
-            {81, 266, 0},
-            {81, 267, 0},
-            {10, 268, 0},
-            {53, 269, 0},
-            {8010, 270, 0},
-            {8009, 271, 0},
-            {123, 272, 0},
-            {8040, 273, 0},
-            {20, 274, 0},
-            {19, 275, 0},
-            {18, 276, 0},
-            {16, 277, 0},
-            {13, 278, 0},
-            {12, 279, 0},
-            {23, 280, 0},
-            {22, 281, 0},
-            {21, 282, 0},
-            {8008, 283, 0},
-            {8002, 284, 0},
-            {10110, 285, 0},
-            {8003, 286, 0},
-            {8003, 287, 0},
-            {84, 288, 0},
-            {30, 289, 0},
-            {83, 290, 0},
-            {32, 291, 0},
-            {86, 292, 0},
-            {36, 293, 0},
-            {33, 294, 0},
-            {10040, 295, 0},
-            {3, 296, 0},
-            {4, 297, 0},
-            {11, 298, 0},
-            {11, 299, 0},
-            {11, 300, 0},
-            {11, 301, 0},
-            {11, 302, 0},
-            {11, 303, 0},
-            {8000, 304, 0},
-            {8000, 305, 0},
-            {140, 306, 0},
-            {10110, 307, 0},
-            {10110, 308, 0},
-            {10110, 309, 0},
-            {10110, 310, 0},
-            {14, 311, 0},
-            {10060, 312, 0},
-            {10060, 313, 0},
-            {9001, 314, 0},
-            {9001, 315, 0},
-            {9001, 316, 0},
-            {9001, 317, 0},
-            {122, 318, 0},
-            {122, 319, 0},
-            {122, 320, 0},
-            {122, 321, 0},
-            {122, 322, 0},
-            {122, 323, 0},
-            {122, 324, 0},
-            {122, 325, 0},
-            {122, 326, 0},
-            {124, 327, 0},
-            {124, 328, 0},
-            {124, 329, 0},
-            {124, 330, 0},
-            {124, 331, 0},
-            {124, 332, 0},
-            {124, 333, 0},
-            {124, 334, 0},
-            {124, 335, 0},
-            {124, 336, 0},
-            {124, 337, 0},
-            {8004, 338, 0},
-            {9001, 339, 0},
-            {9001, 340, 0},
-            {81, 341, 0},
-            {81, 342, 0},
-            {84, 343, 0},
-            {10120, 344, 0},
-            {10120, 345, 0},
-            {9100, 346, 0},
-            {9101, 347, 0},
-            {9102, 348, 0},
-            {9103, 349, 0},
-	}},
-        {"Seven Portals", {false, false, false}, {0, 0, 0}, 12, 712, {
-            {3001, 0, 0},
-            {3000, 1, 0},
-            {3000, 2, 0},
-            {3001, 3, 0},
-            {1, 4, 0},
-            {3000, 5, 0},
-            {3000, 6, 0},
-            {3001, 7, 0},
-            {3001, 8, 0},
-            {3000, 9, 0},
-            {3000, 10, 0},
-            {3000, 11, 0},
-            {3000, 12, 0},
-            {3001, 13, 0},
-            {3001, 14, 0},
-            {3001, 15, 0},
-            {3001, 16, 0},
-            {3000, 17, 0},
-            {3000, 18, 0},
-            {3001, 19, 0},
-            {3001, 20, 0},
-            {3000, 21, 0},
-            {3000, 22, 0},
-            {3001, 23, 0},
-            {3001, 24, 0},
-            {3000, 25, 0},
-            {3000, 26, 0},
-            {3001, 27, 0},
-            {3001, 28, 0},
-            {3001, 29, 0},
-            {3001, 30, 0},
-            {3001, 31, 0},
-            {3001, 32, 0},
-            {3001, 33, 0},
-            {3001, 34, 0},
-            {3001, 35, 0},
-            {3000, 36, 0},
-            {3000, 37, 0},
-            {3000, 38, 0},
-            {3001, 39, 0},
-            {3001, 40, 0},
-            {3001, 41, 0},
-            {3000, 42, 0},
-            {3000, 43, 0},
-            {3000, 44, 0},
-            {3000, 45, 0},
-            {3000, 46, 0},
-            {3000, 47, 0},
-            {3000, 48, 0},
-            {2, 49, 0},
-            {3, 50, 0},
-            {4, 51, 0},
-            {31, 52, 0},
-            {10030, 53, 0},
-            {31, 54, 0},
-            {31, 55, 0},
-            {31, 56, 0},
-            {31, 57, 0},
-            {31, 58, 0},
-            {31, 59, 0},
-            {107, 60, 0},
-            {1410, 61, 0},
-            {1410, 62, 0},
-            {1410, 63, 0},
-            {1410, 64, 0},
-            {1410, 65, 0},
-            {117, 66, 0},
-            {117, 67, 0},
-            {117, 68, 0},
-            {117, 69, 0},
-            {117, 70, 0},
-            {117, 71, 0},
-            {54, 72, 0},
-            {54, 73, 0},
-            {54, 74, 0},
-            {54, 75, 0},
-            {117, 76, 0},
-            {117, 77, 0},
-            {54, 78, 0},
-            {54, 79, 0},
-            {54, 80, 0},
-            {54, 81, 0},
-            {7, 82, 0},
-            {9, 83, 0},
-            {15, 84, 0},
-            {6, 85, 0},
-            {29, 86, 0},
-            {79, 87, 0},
-            {78, 88, 0},
-            {78, 89, 0},
-            {93, 90, 0},
-            {95, 91, 0},
-            {94, 92, 0},
-            {89, 93, 0},
-            {90, 94, 0},
-            {90, 95, 0},
-            {91, 96, 0},
-            {90, 97, 0},
-            {90, 98, 0},
-            {89, 99, 0},
-            {91, 100, 0},
-            {90, 101, 0},
-            {91, 102, 0},
-            {90, 103, 0},
-            {89, 104, 0},
-            {74, 105, 0},
-            {74, 106, 0},
-            {74, 107, 0},
-            {74, 108, 0},
-            {72, 109, 0},
-            {72, 110, 0},
-            {74, 111, 0},
-            {74, 112, 0},
-            {74, 113, 0},
-            {74, 114, 0},
-            {72, 115, 0},
-            {72, 116, 0},
-            {74, 117, 0},
-            {74, 118, 0},
-            {74, 119, 0},
-            {74, 120, 0},
-            {72, 121, 0},
-            {72, 122, 0},
-            {74, 123, 0},
-            {74, 124, 0},
-            {8047, 125, 0},
-            {8047, 126, 0},
-            {8051, 127, 0},
-            {8051, 128, 0},
-            {8051, 129, 0},
-            {8051, 130, 0},
-            {77, 131, 0},
-            {77, 132, 0},
-            {73, 133, 0},
-            {73, 134, 0},
-            {76, 135, 0},
-            {76, 136, 0},
-            {76, 137, 0},
-            {76, 138, 0},
-            {73, 139, 0},
-            {73, 140, 0},
-            {91, 141, 0},
-            {91, 142, 0},
-            {90, 143, 0},
-            {90, 144, 0},
-            {90, 145, 0},
-            {89, 146, 0},
-            {89, 147, 0},
-            {89, 148, 0},
-            {89, 149, 0},
-            {89, 150, 0},
-            {95, 151, 0},
-            {94, 152, 0},
-            {93, 153, 0},
-            {113, 154, 0},
-            {113, 155, 0},
-            {77, 156, 0},
-            {77, 157, 0},
-            {77, 158, 0},
-            {77, 159, 0},
-            {61, 160, 0},
-            {61, 161, 0},
-            {61, 162, 0},
-            {61, 163, 0},
-            {61, 164, 0},
-            {61, 165, 0},
-            {61, 166, 0},
-            {61, 167, 0},
-            {61, 168, 0},
-            {61, 169, 0},
-            {61, 170, 0},
-            {116, 171, 0},
-            {116, 172, 0},
-            {116, 173, 0},
-            {116, 174, 0},
-            {116, 175, 0},
-            {116, 176, 0},
-            {28, 177, 0},
-            {28, 178, 0},
-            {28, 179, 0},
-            {28, 180, 0},
-            {28, 181, 0},
-            {28, 182, 0},
-            {28, 183, 0},
-            {28, 184, 0},
-            {28, 185, 0},
-            {28, 186, 0},
-            {49, 187, 0},
-            {49, 188, 0},
-            {111, 189, 0},
-            {111, 190, 0},
-            {111, 191, 0},
-            {111, 192, 0},
-            {111, 193, 0},
-            {111, 194, 0},
-            {111, 195, 0},
-            {111, 196, 0},
-            {111, 197, 0},
-            {111, 198, 0},
-            {117, 199, 0},
-            {117, 200, 0},
-            {117, 201, 0},
-            {117, 202, 0},
-            {54, 203, 0},
-            {54, 204, 0},
-            {54, 205, 0},
-            {54, 206, 0},
-            {54, 207, 0},
-            {54, 208, 0},
-            {54, 209, 0},
-            {54, 210, 0},
-            {9001, 211, 0},
-            {9001, 212, 0},
-            {9001, 213, 0},
-            {9001, 214, 0},
-            {9001, 215, 0},
-            {9001, 216, 0},
-            {9001, 217, 0},
-            {31, 218, 0},
-            {31, 219, 0},
-            {1407, 220, 0},
-            {1407, 221, 0},
-            {1407, 222, 0},
-            {1407, 223, 0},
-            {1407, 224, 0},
-            {1407, 225, 0},
-            {1407, 226, 0},
-            {1407, 227, 0},
-            {1407, 228, 0},
-            {1407, 229, 0},
-            {1407, 230, 0},
-            {1407, 231, 0},
-            {1407, 232, 0},
-            {1407, 233, 0},
-            {1407, 234, 0},
-            {1407, 235, 0},
-            {1407, 236, 0},
-            {1409, 237, 0},
-            {1409, 238, 0},
-            {1409, 239, 0},
-            {1409, 240, 0},
-            {1409, 241, 0},
-            {1409, 242, 0},
-            {1409, 243, 0},
-            {1409, 244, 0},
-            {1409, 245, 0},
-            {1409, 246, 0},
-            {1409, 247, 0},
-            {1409, 248, 0},
-            {1409, 249, 0},
-            {1409, 250, 0},
-            {1409, 251, 0},
-            {1409, 252, 0},
-            {1409, 253, 0},
-            {1409, 254, 0},
-            {1409, 255, 0},
-            {1409, 256, 0},
-            {1409, 257, 0},
-            {1409, 258, 0},
-            {1409, 259, 0},
-            {1409, 260, 0},
-            {1409, 261, 0},
-            {1409, 262, 0},
-            {1409, 263, 0},
-            {1409, 264, 0},
-            {1409, 265, 0},
-            {1409, 266, 0},
-            {1409, 267, 0},
-            {1409, 268, 0},
-            {1409, 269, 0},
-            {1409, 270, 0},
-            {1409, 271, 0},
-            {1402, 272, 0},
-            {1402, 273, 0},
-            {10030, 274, 0},
-            {10030, 275, 0},
-            {107, 276, 0},
-            {107, 277, 0},
-            {31, 278, 0},
-            {31, 279, 0},
-            {31, 280, 0},
-            {31, 281, 0},
-            {31, 282, 0},
-            {31, 283, 0},
-            {31, 284, 0},
-            {8048, 285, 0},
-            {8048, 286, 0},
-            {8045, 287, 0},
-            {8045, 288, 0},
-            {8045, 289, 0},
-            {8045, 290, 0},
-            {8048, 291, 0},
-            {8048, 292, 0},
-            {8044, 293, 0},
-            {8044, 294, 0},
-            {8044, 295, 0},
-            {8044, 296, 0},
-            {8044, 297, 0},
-            {8044, 298, 0},
-            {8044, 299, 0},
-            {8044, 300, 0},
-            {20, 301, 0},
-            {16, 302, 0},
-            {23, 303, 0},
-            {8041, 304, 0},
-            {9001, 305, 0},
-            {9001, 306, 0},
-            {8000, 307, 0},
-            {8000, 308, 0},
-            {8000, 309, 0},
-            {8000, 310, 0},
-            {8000, 311, 0},
-            {8000, 312, 0},
-            {8000, 313, 0},
-            {8000, 314, 0},
-            {8000, 315, 0},
-            {8000, 316, 0},
-            {8000, 317, 0},
-            {8000, 318, 0},
-            {8000, 319, 0},
-            {8000, 320, 0},
-            {8000, 321, 0},
-            {8000, 322, 0},
-            {8000, 323, 0},
-            {8000, 324, 0},
-            {8000, 325, 0},
-            {8000, 326, 0},
-            {8000, 327, 0},
-            {8000, 328, 0},
-            {8000, 329, 0},
-            {8000, 330, 0},
-            {8000, 331, 0},
-            {8000, 332, 0},
-            {10030, 333, 0},
-            {10030, 334, 0},
-            {10030, 335, 0},
-            {10030, 336, 0},
-            {10030, 337, 0},
-            {10030, 338, 0},
-            {10030, 339, 0},
-            {10030, 340, 0},
-            {8020, 341, 0},
-            {8020, 342, 0},
-            {8020, 343, 0},
-            {8020, 344, 0},
-            {10060, 345, 0},
-            {10060, 346, 0},
-            {107, 347, 0},
-            {107, 348, 0},
-            {10060, 349, 0},
-            {10060, 350, 0},
-            {31, 351, 0},
-            {31, 352, 0},
-            {11, 353, 0},
-            {11, 354, 0},
-            {11, 355, 0},
-            {11, 356, 0},
-            {81, 357, 0},
-            {81, 358, 0},
-            {81, 359, 0},
-            {81, 360, 0},
-            {81, 361, 0},
-            {81, 362, 0},
-            {81, 363, 0},
-            {81, 364, 0},
-            {81, 365, 0},
-            {81, 366, 0},
-            {81, 367, 0},
-            {81, 368, 0},
-            {81, 369, 0},
-            {81, 370, 0},
-            {81, 371, 0},
-            {81, 372, 0},
-            {81, 373, 0},
-            {83, 374, 0},
-            {81, 375, 0},
-            {81, 376, 0},
-            {81, 377, 0},
-            {81, 378, 0},
-            {81, 379, 0},
-            {81, 380, 0},
-            {81, 381, 0},
-            {81, 382, 0},
-            {81, 383, 0},
-            {81, 384, 0},
-            {8000, 385, 0},
-            {8000, 386, 0},
-            {8000, 387, 0},
-            {122, 388, 0},
-            {122, 389, 0},
-            {122, 390, 0},
-            {122, 391, 0},
-            {122, 392, 0},
-            {122, 393, 0},
-            {122, 394, 0},
-            {122, 395, 0},
-            {122, 396, 0},
-            {122, 397, 0},
-            {122, 398, 0},
-            {122, 399, 0},
-            {122, 400, 0},
-            {122, 401, 0},
-            {122, 402, 0},
-            {122, 403, 0},
-            {122, 404, 0},
-            {122, 405, 0},
-            {122, 406, 0},
-            {122, 407, 0},
-            {122, 408, 0},
-            {122, 409, 0},
-            {122, 410, 0},
-            {122, 411, 0},
-            {82, 412, 0},
-            {82, 413, 0},
-            {82, 414, 0},
-            {82, 415, 0},
-            {82, 416, 0},
-            {82, 417, 0},
-            {82, 418, 0},
-            {82, 419, 0},
-            {82, 420, 0},
-            {82, 421, 0},
-            {82, 422, 0},
-            {82, 423, 0},
-            {82, 424, 0},
-            {82, 425, 0},
-            {82, 426, 0},
-            {82, 427, 0},
-            {82, 428, 0},
-            {82, 429, 0},
-            {82, 430, 0},
-            {82, 431, 0},
-            {82, 432, 0},
-            {82, 433, 0},
-            {122, 434, 0},
-            {122, 435, 0},
-            {122, 436, 0},
-            {122, 437, 0},
-            {122, 438, 0},
-            {122, 439, 0},
-            {122, 440, 0},
-            {122, 441, 0},
-            {81, 442, 0},
-            {81, 443, 0},
-            {81, 444, 0},
-            {8004, 445, 0},
-            {1, 446, 0},
-            {2, 447, 0},
-            {3, 448, 0},
-            {4, 449, 0},
-            {1, 450, 0},
-            {2, 451, 0},
-            {3, 452, 0},
-            {4, 453, 0},
-            {1, 454, 0},
-            {2, 455, 0},
-            {3, 456, 0},
-            {4, 457, 0},
-            {1, 458, 0},
-            {2, 459, 0},
-            {4, 460, 0},
-            {3, 461, 0},
-            {1, 462, 0},
-            {2, 463, 0},
-            {3, 464, 0},
-            {4, 465, 0},
-            {10030, 466, 0},
-            {10030, 467, 0},
-            {10030, 468, 0},
-            {10030, 469, 0},
-            {10030, 470, 0},
-            {10030, 471, 0},
-            {10030, 472, 0},
-            {31, 473, 0},
-            {31, 474, 0},
-            {31, 475, 0},
-            {31, 476, 0},
-            {31, 477, 0},
-            {31, 478, 0},
-            {31, 479, 0},
-            {31, 480, 0},
-            {31, 481, 0},
-            {31, 482, 0},
-            {31, 483, 0},
-            {31, 484, 0},
-            {31, 485, 0},
-            {31, 486, 0},
-            {31, 487, 0},
-            {31, 488, 0},
-            {107, 489, 0},
-            {107, 490, 0},
-            {107, 491, 0},
-            {10, 492, 0},
-            {8009, 493, 0},
-            {8010, 494, 0},
-            {123, 495, 0},
-            {8040, 496, 0},
-            {53, 497, 0},
-            {13, 498, 0},
-            {12, 499, 0},
-            {19, 500, 0},
-            {18, 501, 0},
-            {22, 502, 0},
-            {21, 503, 0},
-            {8006, 504, 0},
-            {8007, 505, 0},
-            {8005, 506, 0},
-            {8008, 507, 0},
-            {10030, 508, 0},
-            {10030, 509, 0},
-            {10060, 510, 0},
-            {31, 511, 0},
-            {10030, 512, 0},
-            {10030, 513, 0},
-            {10060, 514, 0},
-            {10060, 515, 0},
-            {10060, 516, 0},
-            {10060, 517, 0},
-            {10030, 518, 0},
-            {10030, 519, 0},
-            {10060, 520, 0},
-            {10060, 521, 0},
-            {10060, 522, 0},
-            {10060, 523, 0},
-            {10060, 524, 0},
-            {10060, 525, 0},
-            {10060, 526, 0},
-            {10030, 527, 0},
-            {10030, 528, 0},
-            {10060, 529, 0},
-            {10060, 530, 0},
-            {107, 531, 0},
-            {10060, 532, 0},
-            {10060, 533, 0},
-            {10060, 534, 0},
-            {10030, 535, 0},
-            {10030, 536, 0},
-            {10060, 537, 0},
-            {10060, 538, 0},
-            {10030, 539, 0},
-            {8020, 540, 0},
-            {8020, 541, 0},
-            {8020, 542, 0},
-            {8020, 543, 0},
-            {10060, 544, 0},
-            {10060, 545, 0},
-            {10060, 546, 0},
-            {10060, 547, 0},
-            {10060, 548, 0},
-            {10060, 549, 0},
-            {10060, 550, 0},
-            {10060, 551, 0},
-            {10060, 552, 0},
-            {10060, 553, 0},
-            {10060, 554, 0},
-            {10060, 555, 0},
-            {10030, 556, 0},
-            {10030, 557, 0},
-            {10030, 558, 0},
-            {10030, 559, 0},
-            {31, 560, 0},
-            {31, 561, 0},
-            {31, 562, 0},
-            {8020, 563, 0},
-            {8020, 564, 0},
-            {8020, 565, 0},
-            {122, 566, 0},
-            {122, 567, 0},
-            {122, 568, 0},
-            {122, 569, 0},
-            {122, 570, 0},
-            {82, 571, 0},
-            {82, 572, 0},
-            {82, 573, 0},
-            {122, 574, 0},
-            {122, 575, 0},
-            {122, 576, 0},
-            {122, 577, 0},
-            {122, 578, 0},
-            {122, 579, 0},
-            {122, 580, 0},
-            {122, 581, 0},
-            {122, 582, 0},
-            {122, 583, 0},
-            {122, 584, 0},
-            {81, 585, 0},
-            {81, 586, 0},
-            {81, 587, 0},
-            {81, 588, 0},
-            {81, 589, 0},
-            {81, 590, 0},
-            {81, 591, 0},
-            {81, 592, 0},
-            {81, 593, 0},
-            {81, 594, 0},
-            {81, 595, 0},
-            {81, 596, 0},
-            {81, 597, 0},
-            {81, 598, 0},
-            {9001, 599, 0},
-            {9001, 600, 0},
-            {9001, 601, 0},
-            {9001, 602, 0},
-            {9001, 603, 0},
-            {9001, 604, 0},
-            {9001, 605, 0},
-            {9001, 606, 0},
-            {9001, 607, 0},
-            {9001, 608, 0},
-            {9001, 609, 0},
-            {124, 610, 0},
-            {124, 611, 0},
-            {124, 612, 0},
-            {124, 613, 0},
-            {124, 614, 0},
-            {124, 615, 0},
-            {124, 616, 0},
-            {124, 617, 0},
-            {124, 618, 0},
-            {124, 619, 0},
-            {124, 620, 0},
-            {124, 621, 0},
-            {124, 622, 0},
-            {124, 623, 0},
-            {124, 624, 0},
-            {124, 625, 0},
-            {124, 626, 0},
-            {124, 627, 0},
-            {124, 628, 0},
-            {124, 629, 0},
-            {8004, 630, 0},
-            {8004, 631, 0},
-            {8004, 632, 0},
-            {8004, 633, 0},
-            {122, 634, 0},
-            {122, 635, 0},
-            {122, 636, 0},
-            {122, 637, 0},
-            {122, 638, 0},
-            {122, 639, 0},
-            {122, 640, 0},
-            {122, 641, 0},
-            {122, 642, 0},
-            {122, 643, 0},
-            {53, 644, 0},
-            {8010, 645, 0},
-            {10, 646, 0},
-            {30, 647, 0},
-            {82, 648, 0},
-            {82, 649, 0},
-            {82, 650, 0},
-            {84, 651, 0},
-            {84, 652, 0},
-            {10120, 653, 0},
-            {10120, 654, 0},
-            {10120, 655, 0},
-            {8004, 656, 0},
-            {8004, 657, 0},
-            {8004, 658, 0},
-            {8004, 659, 0},
-            {8004, 660, 0},
-            {8004, 661, 0},
-            {8004, 662, 0},
-            {8004, 663, 0},
-            {8004, 664, 0},
-            {8004, 665, 0},
-            {8004, 666, 0},
-            {8004, 667, 0},
-            {8004, 668, 0},
-            {8004, 669, 0},
-            {8004, 670, 0},
-            {8004, 671, 0},
-            {8004, 672, 0},
-            {8004, 673, 0},
-            {8004, 674, 0},
-            {8004, 675, 0},
-            {8004, 676, 0},
-            {8004, 677, 0},
-            {8004, 678, 0},
-            {8004, 679, 0},
-            {8004, 680, 0},
-            {8004, 681, 0},
-            {8004, 682, 0},
-            {8004, 683, 0},
-            {11, 684, 0},
-            {11, 685, 0},
-            {11, 686, 0},
-            {11, 687, 0},
-            {9100, 688, 0},
-            {9101, 689, 0},
-            {9102, 690, 0},
-            {9103, 691, 0},
-            {9100, 692, 0},
-            {9101, 693, 0},
-            {9102, 694, 0},
-            {9103, 695, 0},
-            {9100, 696, 0},
-            {9101, 697, 0},
-            {9102, 698, 0},
-            {9103, 699, 0},
-            {9100, 700, 0},
-            {9101, 701, 0},
-            {9102, 702, 0},
-            {9103, 703, 0},
-            {9100, 704, 0},
-            {9101, 705, 0},
-            {9102, 706, 0},
-            {9103, 707, 0},
-            {9100, 708, 0},
-            {9101, 709, 0},
-            {9102, 710, 0},
-            {9103, 711, 0},
-	}},
-        {"Guardian of Ice", {false, false, false}, {0, 0, 0}, 8, 399, {
-            {1, 0, 0},
-            {73, 1, 0},
-            {73, 2, 0},
-            {72, 3, 0},
-            {72, 4, 0},
-            {94, 5, 0},
-            {94, 6, 0},
-            {95, 7, 0},
-            {94, 8, 0},
-            {95, 9, 0},
-            {89, 10, 0},
-            {90, 11, 0},
-            {90, 12, 0},
-            {90, 13, 0},
-            {89, 14, 0},
-            {117, 15, 0},
-            {117, 16, 0},
-            {9001, 17, 0},
-            {9001, 18, 0},
-            {54, 19, 0},
-            {54, 20, 0},
-            {55, 21, 0},
-            {55, 22, 0},
-            {54, 23, 0},
-            {54, 24, 0},
-            {54, 25, 0},
-            {54, 26, 0},
-            {54, 27, 0},
-            {54, 28, 0},
-            {54, 29, 0},
-            {54, 30, 0},
-            {55, 31, 0},
-            {55, 32, 0},
-            {55, 33, 0},
-            {55, 34, 0},
-            {55, 35, 0},
-            {55, 36, 0},
-            {117, 37, 0},
-            {117, 38, 0},
-            {9001, 39, 0},
-            {54, 40, 0},
-            {54, 41, 0},
-            {9001, 42, 0},
-            {9001, 43, 0},
-            {55, 44, 0},
-            {55, 45, 0},
-            {55, 46, 0},
-            {55, 47, 0},
-            {9013, 48, 0},
-            {9013, 49, 0},
-            {9013, 50, 0},
-            {9013, 51, 0},
-            {8008, 52, 0},
-            {9001, 53, 0},
-            {9001, 54, 0},
-            {9001, 55, 0},
-            {9001, 56, 0},
-            {9001, 57, 0},
-            {9001, 58, 0},
-            {9001, 59, 0},
-            {9001, 60, 0},
-            {9001, 61, 0},
-            {9001, 62, 0},
-            {9001, 63, 0},
-            {107, 64, 0},
-            {9001, 65, 0},
-            {9001, 66, 0},
-            {9001, 67, 0},
-            {9001, 68, 0},
-            {9001, 69, 0},
-            {9001, 70, 0},
-            {9001, 71, 0},
-            {9001, 72, 0},
-            {9001, 73, 0},
-            {9001, 74, 0},
-            {9001, 75, 0},
-            {9001, 76, 0},
-            {82, 77, 0},
-            {82, 78, 0},
-            {81, 79, 0},
-            {81, 80, 0},
-            {81, 81, 0},
-            {81, 82, 0},
-            {1407, 83, 0},
-            {1407, 84, 0},
-            {1407, 85, 0},
-            {1407, 86, 0},
-            {1407, 87, 0},
-            {1407, 88, 0},
-            {1407, 89, 0},
-            {1407, 90, 0},
-            {1407, 91, 0},
-            {1407, 92, 0},
-            {1407, 93, 0},
-            {1407, 94, 0},
-            {1407, 95, 0},
-            {1407, 96, 0},
-            {1407, 97, 0},
-            {1407, 98, 0},
-            {1407, 99, 0},
-            {1407, 100, 0},
-            {1407, 101, 0},
-            {1407, 102, 0},
-            {1407, 103, 0},
-            {1407, 104, 0},
-            {1407, 105, 0},
-            {1407, 106, 0},
-            {1407, 107, 0},
-            {1407, 108, 0},
-            {1407, 109, 0},
-            {1407, 110, 0},
-            {1407, 111, 0},
-            {1407, 112, 0},
-            {1407, 113, 0},
-            {1407, 114, 0},
-            {1407, 115, 0},
-            {1407, 116, 0},
-            {1407, 117, 0},
-            {1407, 118, 0},
-            {1407, 119, 0},
-            {1407, 120, 0},
-            {1407, 121, 0},
-            {1407, 122, 0},
-            {1407, 123, 0},
-            {1407, 124, 0},
-            {1407, 125, 0},
-            {1407, 126, 0},
-            {1407, 127, 0},
-            {1407, 128, 0},
-            {1407, 129, 0},
-            {1407, 130, 0},
-            {1407, 131, 0},
-            {1407, 132, 0},
-            {1407, 133, 0},
-            {1407, 134, 0},
-            {1407, 135, 0},
-            {1407, 136, 0},
-            {1407, 137, 0},
-            {1407, 138, 0},
-            {1407, 139, 0},
-            {1407, 140, 0},
-            {1407, 141, 0},
-            {1407, 142, 0},
-            {1407, 143, 0},
-            {1407, 144, 0},
-            {1407, 145, 0},
-            {1407, 146, 0},
-            {1407, 147, 0},
-            {1407, 148, 0},
-            {1407, 149, 0},
-            {1407, 150, 0},
-            {1407, 151, 0},
-            {1407, 152, 0},
-            {1407, 153, 0},
-            {1407, 154, 0},
-            {1407, 155, 0},
-            {8033, 156, 0},
-            {8030, 157, 0},
-            {8008, 158, 0},
-            {8010, 159, 0},
-            {32, 160, 0},
-            {8000, 161, 0},
-            {8000, 162, 0},
-            {8000, 163, 0},
-            {8000, 164, 0},
-            {8000, 165, 0},
-            {8000, 166, 0},
-            {8000, 167, 0},
-            {8000, 168, 0},
-            {82, 169, 0},
-            {81, 170, 0},
-            {81, 171, 0},
-            {81, 172, 0},
-            {81, 173, 0},
-            {81, 174, 0},
-            {81, 175, 0},
-            {81, 176, 0},
-            {81, 177, 0},
-            {81, 178, 0},
-            {81, 179, 0},
-            {82, 180, 0},
-            {82, 181, 0},
-            {81, 182, 0},
-            {81, 183, 0},
-            {81, 184, 0},
-            {81, 185, 0},
-            {81, 186, 0},
-            {81, 187, 0},
-            {81, 188, 0},
-            {8000, 189, 0},
-            {8000, 190, 0},
-            {8000, 191, 0},
-            {8000, 192, 0},
-            {8000, 193, 0},
-            {8000, 194, 0},
-            {8000, 195, 0},
-            {8000, 196, 0},
-            {81, 197, 0},
-            {81, 198, 0},
-            {81, 199, 0},
-            {81, 200, 0},
-            {81, 201, 0},
-            {81, 202, 0},
-            {10030, 203, 0},
-            {10030, 204, 0},
-            {10030, 205, 0},
-            {10030, 206, 0},
-            {10030, 207, 0},
-            {10030, 208, 0},
-            {10060, 209, 0},
-            {10060, 210, 0},
-            {10060, 211, 0},
-            {107, 212, 0},
-            {10030, 213, 0},
-            {10030, 214, 0},
-            {10030, 215, 0},
-            {10030, 216, 0},
-            {8020, 217, 0},
-            {8020, 218, 0},
-            {10030, 219, 0},
-            {10030, 220, 0},
-            {10030, 221, 0},
-            {10030, 222, 0},
-            {10030, 223, 0},
-            {10030, 224, 0},
-            {10030, 225, 0},
-            {10030, 226, 0},
-            {10030, 227, 0},
-            {10060, 228, 0},
-            {10060, 229, 0},
-            {10030, 230, 0},
-            {10030, 231, 0},
-            {10030, 232, 0},
-            {10030, 233, 0},
-            {10030, 234, 0},
-            {10030, 235, 0},
-            {10030, 236, 0},
-            {10060, 237, 0},
-            {10060, 238, 0},
-            {81, 239, 0},
-            {81, 240, 0},
-            {81, 241, 0},
-            {81, 242, 0},
-            {81, 243, 0},
-            {81, 244, 0},
-            {82, 245, 0},
-            {122, 246, 0},
-            {122, 247, 0},
-            {122, 248, 0},
-            {122, 249, 0},
-            {122, 250, 0},
-            {122, 251, 0},
-            {122, 252, 0},
-            {122, 253, 0},
-            {81, 254, 0},
-            {81, 255, 0},
-            {81, 256, 0},
-            {81, 257, 0},
-            {81, 258, 0},
-            {81, 259, 0},
-            {122, 260, 0},
-            {122, 261, 0},
-            {122, 262, 0},
-            {122, 263, 0},
-            {122, 264, 0},
-            {122, 265, 0},
-            {122, 266, 0},
-            {122, 267, 0},
-            {122, 268, 0},
-            {122, 269, 0},
-            {122, 270, 0},
-            {122, 271, 0},
-            {122, 272, 0},
-            {122, 273, 0},
-            {122, 274, 0},
-            {122, 275, 0},
-            {81, 276, 0},
-            {81, 277, 0},
-            {81, 278, 0},
-            {122, 279, 0},
-            {122, 280, 0},
-            {122, 281, 0},
-            {122, 282, 0},
-            {122, 283, 0},
-            {81, 284, 0},
-            {81, 285, 0},
-            {81, 286, 0},
-            {81, 287, 0},
-            {81, 288, 0},
-            {82, 289, 0},
-            {82, 290, 0},
-            {82, 291, 0},
-            {2, 292, 0},
-            {3, 293, 0},
-            {4, 294, 0},
-            {2, 295, 0},
-            {3, 296, 0},
-            {4, 297, 0},
-            {11, 298, 0},
-            {11, 299, 0},
-            {11, 300, 0},
-            {1, 301, 0},
-            {11, 302, 0},
-            {33, 303, 0},
-            {10, 304, 0},
-            {53, 305, 0},
-            {8009, 306, 0},
-            {123, 307, 0},
-            {8040, 308, 0},
-            {20, 309, 0},
-            {16, 310, 0},
-            {23, 311, 0},
-            {19, 312, 0},
-            {13, 313, 0},
-            {22, 314, 0},
-            {18, 315, 0},
-            {12, 316, 0},
-            {21, 317, 0},
-            {84, 318, 0},
-            {84, 319, 0},
-            {8041, 320, 0},
-            {30, 321, 0},
-            {10040, 322, 0},
-            {8006, 323, 0},
-            {8041, 324, 0},
-            {8020, 325, 0},
-            {8020, 326, 0},
-            {8020, 327, 0},
-            {8020, 328, 0},
-            {10060, 329, 0},
-            {10060, 330, 0},
-            {10030, 331, 0},
-            {10030, 332, 0},
-            {10060, 333, 0},
-            {10060, 334, 0},
-            {10030, 335, 0},
-            {9001, 336, 0},
-            {9001, 337, 0},
-            {10030, 338, 0},
-            {10030, 339, 0},
-            {10060, 340, 0},
-            {10060, 341, 0},
-            {10060, 342, 0},
-            {10060, 343, 0},
-            {10060, 344, 0},
-            {10060, 345, 0},
-            {10060, 346, 0},
-            {10060, 347, 0},
-            {10060, 348, 0},
-            {10060, 349, 0},
-            {8020, 350, 0},
-            {8020, 351, 0},
-            {8020, 352, 0},
-            {9001, 353, 0},
-            {9001, 354, 0},
-            {9001, 355, 0},
-            {9001, 356, 0},
-            {9001, 357, 0},
-            {9001, 358, 0},
-            {9001, 359, 0},
-            {9001, 360, 0},
-            {9001, 361, 0},
-            {9001, 362, 0},
-            {9001, 363, 0},
-            {9001, 364, 0},
-            {124, 365, 0},
-            {124, 366, 0},
-            {124, 367, 0},
-            {124, 368, 0},
-            {124, 369, 0},
-            {124, 370, 0},
-            {124, 371, 0},
-            {8004, 372, 0},
-            {8004, 373, 0},
-            {124, 374, 0},
-            {124, 375, 0},
-            {124, 376, 0},
-            {124, 377, 0},
-            {1406, 378, 0},
-            {1404, 379, 0},
-            {10030, 380, 0},
-            {10030, 381, 0},
-            {8010, 382, 0},
-            {82, 383, 0},
-            {10120, 384, 0},
-            {10120, 385, 0},
-            {10120, 386, 0},
-            {11, 387, 0},
-            {11, 388, 0},
-            {11, 389, 0},
-            {11, 390, 0},
-            {9100, 391, 0},
-            {9101, 392, 0},
-            {9102, 393, 0},
-            {9103, 394, 0},
-            {9100, 395, 0},
-            {9101, 396, 0},
-            {9102, 397, 0},
-            {9103, 398, 0},
-	}},
-        {"Guardian of Fire", {false, false, false}, {0, 0, 0}, 7, 296, {
-            {1, 0, 0},
-            {3000, 1, 0},
-            {3000, 2, 0},
-            {3001, 3, 0},
-            {3001, 4, 0},
-            {3002, 5, 0},
-            {3000, 6, 0},
-            {14, 7, 0},
-            {9001, 8, 0},
-            {9001, 9, 0},
-            {9001, 10, 0},
-            {9001, 11, 0},
-            {9001, 12, 0},
-            {9001, 13, 0},
-            {9001, 14, 0},
-            {9001, 15, 0},
-            {9001, 16, 0},
-            {9001, 17, 0},
-            {9001, 18, 0},
-            {9001, 19, 0},
-            {9001, 20, 0},
-            {9001, 21, 0},
-            {9001, 22, 0},
-            {9001, 23, 0},
-            {9001, 24, 0},
-            {9001, 25, 0},
-            {9001, 26, 0},
-            {9001, 27, 0},
-            {9001, 28, 0},
-            {9001, 29, 0},
-            {9001, 30, 0},
-            {9001, 31, 0},
-            {9001, 32, 0},
-            {9001, 33, 0},
-            {9001, 34, 0},
-            {9001, 35, 0},
-            {9001, 36, 0},
-            {9001, 37, 0},
-            {54, 38, 0},
-            {54, 39, 0},
-            {54, 40, 0},
-            {54, 41, 0},
-            {54, 42, 0},
-            {54, 43, 0},
-            {54, 44, 0},
-            {54, 45, 0},
-            {9001, 46, 0},
-            {9001, 47, 0},
-            {9001, 48, 0},
-            {82, 49, 0},
-            {82, 50, 0},
-            {82, 51, 0},
-            {82, 52, 0},
-            {9001, 53, 0},
-            {9001, 54, 0},
-            {9001, 55, 0},
-            {9001, 56, 0},
-            {117, 57, 0},
-            {117, 58, 0},
-            {117, 59, 0},
-            {117, 60, 0},
-            {117, 61, 0},
-            {117, 62, 0},
-            {55, 63, 0},
-            {55, 64, 0},
-            {55, 65, 0},
-            {55, 66, 0},
-            {116, 67, 0},
-            {116, 68, 0},
-            {9001, 69, 0},
-            {9001, 70, 0},
-            {9001, 71, 0},
-            {9001, 72, 0},
-            {140, 73, 0},
-            {9014, 74, 0},
-            {1405, 75, 0},
-            {117, 76, 0},
-            {117, 77, 0},
-            {117, 78, 0},
-            {117, 79, 0},
-            {117, 80, 0},
-            {117, 81, 0},
-            {117, 82, 0},
-            {117, 83, 0},
-            {9001, 84, 0},
-            {9001, 85, 0},
-            {9001, 86, 0},
-            {9001, 87, 0},
-            {9001, 88, 0},
-            {9001, 89, 0},
-            {9001, 90, 0},
-            {9001, 91, 0},
-            {9001, 92, 0},
-            {8050, 93, 0},
-            {8050, 94, 0},
-            {8045, 95, 0},
-            {8045, 96, 0},
-            {8049, 97, 0},
-            {8049, 98, 0},
-            {8045, 99, 0},
-            {8045, 100, 0},
-            {8049, 101, 0},
-            {8049, 102, 0},
-            {8046, 103, 0},
-            {8046, 104, 0},
-            {53, 105, 0},
-            {36, 106, 0},
-            {8006, 107, 0},
-            {8000, 108, 0},
-            {8000, 109, 0},
-            {8000, 110, 0},
-            {8000, 111, 0},
-            {8000, 112, 0},
-            {8000, 113, 0},
-            {8000, 114, 0},
-            {10060, 115, 0},
-            {10060, 116, 0},
-            {10060, 117, 0},
-            {10060, 118, 0},
-            {10060, 119, 0},
-            {10060, 120, 0},
-            {10030, 121, 0},
-            {10030, 122, 0},
-            {10030, 123, 0},
-            {10030, 124, 0},
-            {10060, 125, 0},
-            {10060, 126, 0},
-            {10060, 127, 0},
-            {10060, 128, 0},
-            {10060, 129, 0},
-            {10060, 130, 0},
-            {10060, 131, 0},
-            {10030, 132, 0},
-            {10030, 133, 0},
-            {10030, 134, 0},
-            {10030, 135, 0},
-            {10030, 136, 0},
-            {10030, 137, 0},
-            {81, 138, 0},
-            {81, 139, 0},
-            {81, 140, 0},
-            {81, 141, 0},
-            {81, 142, 0},
-            {81, 143, 0},
-            {81, 144, 0},
-            {81, 145, 0},
-            {122, 146, 0},
-            {122, 147, 0},
-            {122, 148, 0},
-            {122, 149, 0},
-            {122, 150, 0},
-            {122, 151, 0},
-            {122, 152, 0},
-            {122, 153, 0},
-            {82, 154, 0},
-            {82, 155, 0},
-            {10030, 156, 0},
-            {10030, 157, 0},
-            {10030, 158, 0},
-            {10030, 159, 0},
-            {10030, 160, 0},
-            {10030, 161, 0},
-            {122, 162, 0},
-            {122, 163, 0},
-            {122, 164, 0},
-            {81, 165, 0},
-            {81, 166, 0},
-            {81, 167, 0},
-            {81, 168, 0},
-            {81, 169, 0},
-            {8000, 170, 0},
-            {8000, 171, 0},
-            {8000, 172, 0},
-            {8000, 173, 0},
-            {81, 174, 0},
-            {81, 175, 0},
-            {81, 176, 0},
-            {81, 177, 0},
-            {122, 178, 0},
-            {81, 179, 0},
-            {81, 180, 0},
-            {8000, 181, 0},
-            {10060, 182, 0},
-            {10060, 183, 0},
-            {10030, 184, 0},
-            {10030, 185, 0},
-            {10030, 186, 0},
-            {10030, 187, 0},
-            {10060, 188, 0},
-            {10060, 189, 0},
-            {2, 190, 0},
-            {3, 191, 0},
-            {4, 192, 0},
-            {1, 193, 0},
-            {2, 194, 0},
-            {3, 195, 0},
-            {4, 196, 0},
-            {11, 197, 0},
-            {11, 198, 0},
-            {11, 199, 0},
-            {11, 200, 0},
-            {10, 201, 0},
-            {8010, 202, 0},
-            {8009, 203, 0},
-            {123, 204, 0},
-            {8040, 205, 0},
-            {20, 206, 0},
-            {19, 207, 0},
-            {18, 208, 0},
-            {16, 209, 0},
-            {13, 210, 0},
-            {12, 211, 0},
-            {23, 212, 0},
-            {22, 213, 0},
-            {21, 214, 0},
-            {8005, 215, 0},
-            {10110, 216, 0},
-            {10110, 217, 0},
-            {10110, 218, 0},
-            {10110, 219, 0},
-            {8002, 220, 0},
-            {8041, 221, 0},
-            {84, 222, 0},
-            {30, 223, 0},
-            {11, 224, 0},
-            {4, 225, 0},
-            {3, 226, 0},
-            {2, 227, 0},
-            {1, 228, 0},
-            {32, 229, 0},
-            {84, 230, 0},
-            {10060, 231, 0},
-            {10060, 232, 0},
-            {10060, 233, 0},
-            {10030, 234, 0},
-            {10030, 235, 0},
-            {10030, 236, 0},
-            {10030, 237, 0},
-            {10060, 238, 0},
-            {10060, 239, 0},
-            {10060, 240, 0},
-            {10060, 241, 0},
-            {10030, 242, 0},
-            {10030, 243, 0},
-            {10030, 244, 0},
-            {10030, 245, 0},
-            {10060, 246, 0},
-            {10060, 247, 0},
-            {10060, 248, 0},
-            {10060, 249, 0},
-            {10060, 250, 0},
-            {10060, 251, 0},
-            {10060, 252, 0},
-            {10060, 253, 0},
-            {10060, 254, 0},
-            {10060, 255, 0},
-            {10060, 256, 0},
-            {9001, 257, 0},
-            {9001, 258, 0},
-            {9001, 259, 0},
-            {9001, 260, 0},
-            {9001, 261, 0},
-            {124, 262, 0},
-            {124, 263, 0},
-            {124, 264, 0},
-            {124, 265, 0},
-            {124, 266, 0},
-            {124, 267, 0},
-            {124, 268, 0},
-            {8004, 269, 0},
-            {8004, 270, 0},
-            {8004, 271, 0},
-            {124, 272, 0},
-            {124, 273, 0},
-            {124, 274, 0},
-            {124, 275, 0},
-            {53, 276, 0},
-            {82, 277, 0},
-            {10120, 278, 0},
-            {10120, 279, 0},
-            {10120, 280, 0},
-            {11, 281, 0},
-            {11, 282, 0},
-            {11, 283, 0},
-            {9100, 284, 0},
-            {9101, 285, 0},
-            {9102, 286, 0},
-            {9103, 287, 0},
-            {9100, 288, 0},
-            {9101, 289, 0},
-            {9102, 290, 0},
-            {9103, 291, 0},
-            {9100, 292, 0},
-            {9101, 293, 0},
-            {9102, 294, 0},
-            {9103, 295, 0},
-	}},
-        {"Guardian of Steel", {false, false, false}, {0, 0, 0}, 9, 495, {
-            {1, 0, 0},
-            {3002, 1, 0},
-            {3002, 2, 0},
-            {3002, 3, 0},
-            {3002, 4, 0},
-            {3002, 5, 0},
-            {3002, 6, 0},
-            {10, 7, 0},
-            {116, 8, 0},
-            {116, 9, 0},
-            {116, 10, 0},
-            {116, 11, 0},
-            {54, 12, 0},
-            {54, 13, 0},
-            {54, 14, 0},
-            {54, 15, 0},
-            {1407, 16, 0},
-            {1407, 17, 0},
-            {1407, 18, 0},
-            {8020, 19, 0},
-            {8020, 20, 0},
-            {8020, 21, 0},
-            {8005, 22, 0},
-            {122, 23, 0},
-            {122, 24, 0},
-            {10040, 25, 0},
-            {82, 26, 0},
-            {82, 27, 0},
-            {82, 28, 0},
-            {1402, 29, 0},
-            {1402, 30, 0},
-            {1409, 31, 0},
-            {1409, 32, 0},
-            {1409, 33, 0},
-            {1409, 34, 0},
-            {1402, 35, 0},
-            {1402, 36, 0},
-            {1402, 37, 0},
-            {1402, 38, 0},
-            {1409, 39, 0},
-            {1409, 40, 0},
-            {1409, 41, 0},
-            {1409, 42, 0},
-            {1402, 43, 0},
-            {1402, 44, 0},
-            {1409, 45, 0},
-            {1409, 46, 0},
-            {1409, 47, 0},
-            {1409, 48, 0},
-            {1409, 49, 0},
-            {1409, 50, 0},
-            {1409, 51, 0},
-            {1409, 52, 0},
-            {1409, 53, 0},
-            {1409, 54, 0},
-            {1404, 55, 0},
-            {1404, 56, 0},
-            {1404, 57, 0},
-            {1404, 58, 0},
-            {1404, 59, 0},
-            {1404, 60, 0},
-            {1404, 61, 0},
-            {1404, 62, 0},
-            {1404, 63, 0},
-            {1404, 64, 0},
-            {1404, 65, 0},
-            {1404, 66, 0},
-            {1409, 67, 0},
-            {1404, 68, 0},
-            {1404, 69, 0},
-            {1404, 70, 0},
-            {1404, 71, 0},
-            {1404, 72, 0},
-            {1404, 73, 0},
-            {1404, 74, 0},
-            {1404, 75, 0},
-            {1404, 76, 0},
-            {1404, 77, 0},
-            {1404, 78, 0},
-            {1404, 79, 0},
-            {1404, 80, 0},
-            {1404, 81, 0},
-            {1404, 82, 0},
-            {1404, 83, 0},
-            {8051, 84, 0},
-            {8051, 85, 0},
-            {8051, 86, 0},
-            {8051, 87, 0},
-            {8042, 88, 0},
-            {8042, 89, 0},
-            {8042, 90, 0},
-            {8042, 91, 0},
-            {8048, 92, 0},
-            {8048, 93, 0},
-            {8048, 94, 0},
-            {8048, 95, 0},
-            {8048, 96, 0},
-            {8048, 97, 0},
-            {8048, 98, 0},
-            {8048, 99, 0},
-            {8052, 100, 0},
-            {8052, 101, 0},
-            {8052, 102, 0},
-            {8052, 103, 0},
-            {8052, 104, 0},
-            {8052, 105, 0},
-            {8052, 106, 0},
-            {8052, 107, 0},
-            {8060, 108, 0},
-            {8060, 109, 0},
-            {8060, 110, 0},
-            {8060, 111, 0},
-            {8060, 112, 0},
-            {8060, 113, 0},
-            {8060, 114, 0},
-            {8060, 115, 0},
-            {93, 116, 0},
-            {93, 117, 0},
-            {93, 118, 0},
-            {94, 119, 0},
-            {94, 120, 0},
-            {94, 121, 0},
-            {95, 122, 0},
-            {95, 123, 0},
-            {95, 124, 0},
-            {95, 125, 0},
-            {95, 126, 0},
-            {89, 127, 0},
-            {89, 128, 0},
-            {89, 129, 0},
-            {89, 130, 0},
-            {89, 131, 0},
-            {90, 132, 0},
-            {90, 133, 0},
-            {90, 134, 0},
-            {90, 135, 0},
-            {90, 136, 0},
-            {90, 137, 0},
-            {91, 138, 0},
-            {91, 139, 0},
-            {91, 140, 0},
-            {91, 141, 0},
-            {91, 142, 0},
-            {91, 143, 0},
-            {91, 144, 0},
-            {90, 145, 0},
-            {8052, 146, 0},
-            {8052, 147, 0},
-            {8052, 148, 0},
-            {8052, 149, 0},
-            {54, 150, 0},
-            {54, 151, 0},
-            {54, 152, 0},
-            {54, 153, 0},
-            {54, 154, 0},
-            {54, 155, 0},
-            {54, 156, 0},
-            {54, 157, 0},
-            {8060, 158, 0},
-            {8060, 159, 0},
-            {8060, 160, 0},
-            {8060, 161, 0},
-            {9001, 162, 0},
-            {8000, 163, 0},
-            {8000, 164, 0},
-            {8000, 165, 0},
-            {8000, 166, 0},
-            {8000, 167, 0},
-            {8000, 168, 0},
-            {8000, 169, 0},
-            {8000, 170, 0},
-            {8000, 171, 0},
-            {8000, 172, 0},
-            {8000, 173, 0},
-            {8000, 174, 0},
-            {8000, 175, 0},
-            {8000, 176, 0},
-            {8000, 177, 0},
-            {8000, 178, 0},
-            {8000, 179, 0},
-            {8000, 180, 0},
-            {8000, 181, 0},
-            {8000, 182, 0},
-            {8000, 183, 0},
-            {8000, 184, 0},
-            {8000, 185, 0},
-            {8020, 186, 0},
-            {8020, 187, 0},
-            {8020, 188, 0},
-            {8020, 189, 0},
-            {8020, 190, 0},
-            {107, 191, 0},
-            {107, 192, 0},
-            {107, 193, 0},
-            {107, 194, 0},
-            {107, 195, 0},
-            {107, 196, 0},
-            {10030, 197, 0},
-            {10030, 198, 0},
-            {10030, 199, 0},
-            {10030, 200, 0},
-            {10030, 201, 0},
-            {10030, 202, 0},
-            {107, 203, 0},
-            {107, 204, 0},
-            {107, 205, 0},
-            {31, 206, 0},
-            {31, 207, 0},
-            {31, 208, 0},
-            {31, 209, 0},
-            {31, 210, 0},
-            {31, 211, 0},
-            {107, 212, 0},
-            {107, 213, 0},
-            {107, 214, 0},
-            {107, 215, 0},
-            {10030, 216, 0},
-            {10030, 217, 0},
-            {107, 218, 0},
-            {107, 219, 0},
-            {107, 220, 0},
-            {107, 221, 0},
-            {107, 222, 0},
-            {107, 223, 0},
-            {107, 224, 0},
-            {107, 225, 0},
-            {10030, 226, 0},
-            {10030, 227, 0},
-            {10030, 228, 0},
-            {10030, 229, 0},
-            {10030, 230, 0},
-            {10030, 231, 0},
-            {31, 232, 0},
-            {31, 233, 0},
-            {31, 234, 0},
-            {31, 235, 0},
-            {31, 236, 0},
-            {31, 237, 0},
-            {10030, 238, 0},
-            {10030, 239, 0},
-            {10030, 240, 0},
-            {10030, 241, 0},
-            {10030, 242, 0},
-            {10030, 243, 0},
-            {10030, 244, 0},
-            {10030, 245, 0},
-            {10030, 246, 0},
-            {3000, 247, 0},
-            {3000, 248, 0},
-            {3000, 249, 0},
-            {3000, 250, 0},
-            {3000, 251, 0},
-            {3000, 252, 0},
-            {11, 253, 0},
-            {11, 254, 0},
-            {11, 255, 0},
-            {11, 256, 0},
-            {2, 257, 0},
-            {3, 258, 0},
-            {4, 259, 0},
-            {4, 260, 0},
-            {3, 261, 0},
-            {2, 262, 0},
-            {1, 263, 0},
-            {1, 264, 0},
-            {2, 265, 0},
-            {3, 266, 0},
-            {4, 267, 0},
-            {33, 268, 0},
-            {8010, 269, 0},
-            {123, 270, 0},
-            {16, 271, 0},
-            {13, 272, 0},
-            {12, 273, 0},
-            {8009, 274, 0},
-            {20, 275, 0},
-            {19, 276, 0},
-            {18, 277, 0},
-            {53, 278, 0},
-            {8040, 279, 0},
-            {23, 280, 0},
-            {22, 281, 0},
-            {21, 282, 0},
-            {8020, 283, 0},
-            {8020, 284, 0},
-            {8020, 285, 0},
-            {82, 286, 0},
-            {82, 287, 0},
-            {82, 288, 0},
-            {82, 289, 0},
-            {82, 290, 0},
-            {82, 291, 0},
-            {82, 292, 0},
-            {82, 293, 0},
-            {122, 294, 0},
-            {122, 295, 0},
-            {122, 296, 0},
-            {122, 297, 0},
-            {122, 298, 0},
-            {122, 299, 0},
-            {122, 300, 0},
-            {122, 301, 0},
-            {81, 302, 0},
-            {81, 303, 0},
-            {81, 304, 0},
-            {81, 305, 0},
-            {81, 306, 0},
-            {81, 307, 0},
-            {81, 308, 0},
-            {81, 309, 0},
-            {8020, 310, 0},
-            {8020, 311, 0},
-            {8020, 312, 0},
-            {8020, 313, 0},
-            {8020, 314, 0},
-            {8020, 315, 0},
-            {10060, 316, 0},
-            {10060, 317, 0},
-            {10060, 318, 0},
-            {10060, 319, 0},
-            {10060, 320, 0},
-            {10060, 321, 0},
-            {10060, 322, 0},
-            {10060, 323, 0},
-            {10030, 324, 0},
-            {10030, 325, 0},
-            {10030, 326, 0},
-            {10030, 327, 0},
-            {10060, 328, 0},
-            {10060, 329, 0},
-            {10060, 330, 0},
-            {10060, 331, 0},
-            {10030, 332, 0},
-            {10030, 333, 0},
-            {10030, 334, 0},
-            {10030, 335, 0},
-            {10060, 336, 0},
-            {10060, 337, 0},
-            {10030, 338, 0},
-            {10030, 339, 0},
-            {10030, 340, 0},
-            {10030, 341, 0},
-            {10060, 342, 0},
-            {10060, 343, 0},
-            {10060, 344, 0},
-            {10030, 345, 0},
-            {10030, 346, 0},
-            {10060, 347, 0},
-            {10060, 348, 0},
-            {31, 349, 0},
-            {31, 350, 0},
-            {107, 351, 0},
-            {107, 352, 0},
-            {10030, 353, 0},
-            {10030, 354, 0},
-            {10030, 355, 0},
-            {10030, 356, 0},
-            {107, 357, 0},
-            {10030, 358, 0},
-            {10060, 359, 0},
-            {10060, 360, 0},
-            {10060, 361, 0},
-            {10060, 362, 0},
-            {10060, 363, 0},
-            {10060, 364, 0},
-            {10060, 365, 0},
-            {9001, 366, 0},
-            {9001, 367, 0},
-            {9001, 368, 0},
-            {9001, 369, 0},
-            {9001, 370, 0},
-            {124, 371, 0},
-            {124, 372, 0},
-            {124, 373, 0},
-            {124, 374, 0},
-            {124, 375, 0},
-            {124, 376, 0},
-            {8004, 377, 0},
-            {8004, 378, 0},
-            {8004, 379, 0},
-            {124, 380, 0},
-            {124, 381, 0},
-            {124, 382, 0},
-            {124, 383, 0},
-            {124, 384, 0},
-            {124, 385, 0},
-            {8004, 386, 0},
-            {124, 387, 0},
-            {124, 388, 0},
-            {124, 389, 0},
-            {124, 390, 0},
-            {124, 391, 0},
-            {124, 392, 0},
-            {124, 393, 0},
-            {124, 394, 0},
-            {84, 395, 0},
-            {32, 396, 0},
-            {10, 397, 0},
-            {82, 398, 0},
-            {84, 399, 0},
-            {122, 400, 0},
-            {122, 401, 0},
-            {122, 402, 0},
-            {122, 403, 0},
-            {122, 404, 0},
-            {122, 405, 0},
-            {122, 406, 0},
-            {122, 407, 0},
-            {122, 408, 0},
-            {122, 409, 0},
-            {122, 410, 0},
-            {122, 411, 0},
-            {122, 412, 0},
-            {122, 413, 0},
-            {122, 414, 0},
-            {122, 415, 0},
-            {122, 416, 0},
-            {122, 417, 0},
-            {122, 418, 0},
-            {122, 419, 0},
-            {122, 420, 0},
-            {122, 421, 0},
-            {122, 422, 0},
-            {122, 423, 0},
-            {122, 424, 0},
-            {122, 425, 0},
-            {122, 426, 0},
-            {122, 427, 0},
-            {122, 428, 0},
-            {122, 429, 0},
-            {122, 430, 0},
-            {122, 431, 0},
-            {122, 432, 0},
-            {122, 433, 0},
-            {122, 434, 0},
-            {122, 435, 0},
-            {122, 436, 0},
-            {122, 437, 0},
-            {122, 438, 0},
-            {122, 439, 0},
-            {122, 440, 0},
-            {122, 441, 0},
-            {81, 442, 0},
-            {81, 443, 0},
-            {81, 444, 0},
-            {81, 445, 0},
-            {81, 446, 0},
-            {81, 447, 0},
-            {81, 448, 0},
-            {81, 449, 0},
-            {81, 450, 0},
-            {81, 451, 0},
-            {81, 452, 0},
-            {81, 453, 0},
-            {81, 454, 0},
-            {81, 455, 0},
-            {81, 456, 0},
-            {81, 457, 0},
-            {81, 458, 0},
-            {81, 459, 0},
-            {81, 460, 0},
-            {81, 461, 0},
-            {81, 462, 0},
-            {81, 463, 0},
-            {81, 464, 0},
-            {81, 465, 0},
-            {81, 466, 0},
-            {81, 467, 0},
-            {81, 468, 0},
-            {81, 469, 0},
-            {81, 470, 0},
-            {81, 471, 0},
-            {81, 472, 0},
-            {81, 473, 0},
-            {81, 474, 0},
-            {10120, 475, 0},
-            {10120, 476, 0},
-            {10120, 477, 0},
-            {10120, 478, 0},
-            {9100, 479, 0},
-            {9101, 480, 0},
-            {9102, 481, 0},
-            {9103, 482, 0},
-            {9100, 483, 0},
-            {9101, 484, 0},
-            {9102, 485, 0},
-            {9103, 486, 0},
-            {9100, 487, 0},
-            {9101, 488, 0},
-            {9102, 489, 0},
-            {9103, 490, 0},
-            {11, 491, 0},
-            {11, 492, 0},
-            {11, 493, 0},
-            {11, 494, 0},
-	}},
-        {"Bright Crucible", {false, false, false}, {0, 0, 0}, 7, 386, {
-            {1, 0, 0},
-            {118, 1, 0},
-            {118, 2, 0},
-            {118, 3, 0},
-            {118, 4, 0},
-            {74, 5, 0},
-            {74, 6, 0},
-            {74, 7, 0},
-            {74, 8, 0},
-            {9001, 9, 0},
-            {9001, 10, 0},
-            {9001, 11, 0},
-            {9001, 12, 0},
-            {107, 13, 0},
-            {107, 14, 0},
-            {107, 15, 0},
-            {107, 16, 0},
-            {107, 17, 0},
-            {107, 18, 0},
-            {9003, 19, 0},
-            {9012, 20, 0},
-            {74, 21, 0},
-            {74, 22, 0},
-            {74, 23, 0},
-            {74, 24, 0},
-            {9001, 25, 0},
-            {9001, 26, 0},
-            {9001, 27, 0},
-            {9001, 28, 0},
-            {10030, 29, 0},
-            {10030, 30, 0},
-            {10030, 31, 0},
-            {10030, 32, 0},
-            {10030, 33, 0},
-            {10030, 34, 0},
-            {10030, 35, 0},
-            {10030, 36, 0},
-            {10030, 37, 0},
-            {10030, 38, 0},
-            {10030, 39, 0},
-            {10030, 40, 0},
-            {10030, 41, 0},
-            {10030, 42, 0},
-            {10030, 43, 0},
-            {10030, 44, 0},
-            {10030, 45, 0},
-            {10030, 46, 0},
-            {10030, 47, 0},
-            {10030, 48, 0},
-            {116, 49, 0},
-            {116, 50, 0},
-            {116, 51, 0},
-            {116, 52, 0},
-            {116, 53, 0},
-            {116, 54, 0},
-            {116, 55, 0},
-            {116, 56, 0},
-            {116, 57, 0},
-            {116, 58, 0},
-            {116, 59, 0},
-            {116, 60, 0},
-            {8061, 61, 0},
-            {8061, 62, 0},
-            {8061, 63, 0},
-            {54, 64, 0},
-            {54, 65, 0},
-            {54, 66, 0},
-            {54, 67, 0},
-            {116, 68, 0},
-            {116, 69, 0},
-            {116, 70, 0},
-            {116, 71, 0},
-            {77, 72, 0},
-            {77, 73, 0},
-            {116, 74, 0},
-            {116, 75, 0},
-            {54, 76, 0},
-            {54, 77, 0},
-            {9, 78, 0},
-            {7, 79, 0},
-            {9, 80, 0},
-            {9, 81, 0},
-            {7, 82, 0},
-            {15, 83, 0},
-            {15, 84, 0},
-            {7, 85, 0},
-            {9, 86, 0},
-            {15, 87, 0},
-            {80, 88, 0},
-            {87, 89, 0},
-            {87, 90, 0},
-            {87, 91, 0},
-            {113, 92, 0},
-            {113, 93, 0},
-            {9001, 94, 0},
-            {8008, 95, 0},
-            {8005, 96, 0},
-            {8006, 97, 0},
-            {8007, 98, 0},
-            {10110, 99, 0},
-            {8000, 100, 0},
-            {8000, 101, 0},
-            {8000, 102, 0},
-            {8000, 103, 0},
-            {8000, 104, 0},
-            {8000, 105, 0},
-            {8000, 106, 0},
-            {8000, 107, 0},
-            {8000, 108, 0},
-            {8000, 109, 0},
-            {8000, 110, 0},
-            {8000, 111, 0},
-            {8000, 112, 0},
-            {8000, 113, 0},
-            {8000, 114, 0},
-            {8000, 115, 0},
-            {8000, 116, 0},
-            {8000, 117, 0},
-            {9001, 118, 0},
-            {9001, 119, 0},
-            {9001, 120, 0},
-            {9001, 121, 0},
-            {121, 122, 0},
-            {121, 123, 0},
-            {121, 124, 0},
-            {121, 125, 0},
-            {121, 126, 0},
-            {121, 127, 0},
-            {121, 128, 0},
-            {10060, 129, 0},
-            {10060, 130, 0},
-            {10060, 131, 0},
-            {10060, 132, 0},
-            {8080, 133, 0},
-            {8080, 134, 0},
-            {8080, 135, 0},
-            {8080, 136, 0},
-            {8080, 137, 0},
-            {8080, 138, 0},
-            {8080, 139, 0},
-            {8080, 140, 0},
-            {8080, 141, 0},
-            {11, 142, 0},
-            {11, 143, 0},
-            {11, 144, 0},
-            {11, 145, 0},
-            {8061, 146, 0},
-            {80, 147, 0},
-            {80, 148, 0},
-            {80, 149, 0},
-            {80, 150, 0},
-            {80, 151, 0},
-            {80, 152, 0},
-            {87, 153, 0},
-            {87, 154, 0},
-            {37, 155, 0},
-            {37, 156, 0},
-            {37, 157, 0},
-            {38, 158, 0},
-            {38, 159, 0},
-            {60, 160, 0},
-            {60, 161, 0},
-            {2, 162, 0},
-            {3, 163, 0},
-            {4, 164, 0},
-            {107, 165, 0},
-            {107, 166, 0},
-            {107, 167, 0},
-            {107, 168, 0},
-            {107, 169, 0},
-            {107, 170, 0},
-            {31, 171, 0},
-            {31, 172, 0},
-            {31, 173, 0},
-            {31, 174, 0},
-            {31, 175, 0},
-            {31, 176, 0},
-            {31, 177, 0},
-            {31, 178, 0},
-            {31, 179, 0},
-            {31, 180, 0},
-            {31, 181, 0},
-            {31, 182, 0},
-            {31, 183, 0},
-            {31, 184, 0},
-            {31, 185, 0},
-            {31, 186, 0},
-            {31, 187, 0},
-            {31, 188, 0},
-            {10030, 189, 0},
-            {10030, 190, 0},
-            {10030, 191, 0},
-            {10030, 192, 0},
-            {84, 193, 0},
-            {84, 194, 0},
-            {83, 195, 0},
-            {8010, 196, 0},
-            {123, 197, 0},
-            {16, 198, 0},
-            {13, 199, 0},
-            {12, 200, 0},
-            {18, 201, 0},
-            {19, 202, 0},
-            {20, 203, 0},
-            {8009, 204, 0},
-            {10, 205, 0},
-            {53, 206, 0},
-            {8040, 207, 0},
-            {23, 208, 0},
-            {22, 209, 0},
-            {21, 210, 0},
-            {121, 211, 0},
-            {121, 212, 0},
-            {10030, 213, 0},
-            {10030, 214, 0},
-            {10030, 215, 0},
-            {10030, 216, 0},
-            {10030, 217, 0},
-            {10030, 218, 0},
-            {10030, 219, 0},
-            {10030, 220, 0},
-            {10030, 221, 0},
-            {10060, 222, 0},
-            {10060, 223, 0},
-            {10060, 224, 0},
-            {10060, 225, 0},
-            {8080, 226, 0},
-            {8080, 227, 0},
-            {8080, 228, 0},
-            {8080, 229, 0},
-            {8080, 230, 0},
-            {31, 231, 0},
-            {31, 232, 0},
-            {9001, 233, 0},
-            {9001, 234, 0},
-            {9001, 235, 0},
-            {9001, 236, 0},
-            {9001, 237, 0},
-            {9001, 238, 0},
-            {122, 239, 0},
-            {122, 240, 0},
-            {122, 241, 0},
-            {122, 242, 0},
-            {122, 243, 0},
-            {122, 244, 0},
-            {122, 245, 0},
-            {122, 246, 0},
-            {122, 247, 0},
-            {122, 248, 0},
-            {122, 249, 0},
-            {122, 250, 0},
-            {122, 251, 0},
-            {122, 252, 0},
-            {122, 253, 0},
-            {122, 254, 0},
-            {122, 255, 0},
-            {122, 256, 0},
-            {122, 257, 0},
-            {122, 258, 0},
-            {122, 259, 0},
-            {122, 260, 0},
-            {122, 261, 0},
-            {122, 262, 0},
-            {122, 263, 0},
-            {122, 264, 0},
-            {122, 265, 0},
-            {122, 266, 0},
-            {122, 267, 0},
-            {122, 268, 0},
-            {122, 269, 0},
-            {122, 270, 0},
-            {122, 271, 0},
-            {122, 272, 0},
-            {122, 273, 0},
-            {122, 274, 0},
-            {122, 275, 0},
-            {122, 276, 0},
-            {122, 277, 0},
-            {122, 278, 0},
-            {122, 279, 0},
-            {122, 280, 0},
-            {122, 281, 0},
-            {124, 282, 0},
-            {124, 283, 0},
-            {124, 284, 0},
-            {124, 285, 0},
-            {124, 286, 0},
-            {124, 287, 0},
-            {124, 288, 0},
-            {124, 289, 0},
-            {124, 290, 0},
-            {124, 291, 0},
-            {124, 292, 0},
-            {124, 293, 0},
-            {124, 294, 0},
-            {124, 295, 0},
-            {124, 296, 0},
-            {124, 297, 0},
-            {124, 298, 0},
-            {124, 299, 0},
-            {124, 300, 0},
-            {124, 301, 0},
-            {124, 302, 0},
-            {124, 303, 0},
-            {8004, 304, 0},
-            {8004, 305, 0},
-            {8004, 306, 0},
-            {8004, 307, 0},
-            {81, 308, 0},
-            {81, 309, 0},
-            {81, 310, 0},
-            {81, 311, 0},
-            {81, 312, 0},
-            {81, 313, 0},
-            {81, 314, 0},
-            {81, 315, 0},
-            {81, 316, 0},
-            {81, 317, 0},
-            {81, 318, 0},
-            {81, 319, 0},
-            {81, 320, 0},
-            {81, 321, 0},
-            {81, 322, 0},
-            {81, 323, 0},
-            {81, 324, 0},
-            {81, 325, 0},
-            {81, 326, 0},
-            {82, 327, 0},
-            {82, 328, 0},
-            {82, 329, 0},
-            {82, 330, 0},
-            {81, 331, 0},
-            {81, 332, 0},
-            {81, 333, 0},
-            {81, 334, 0},
-            {81, 335, 0},
-            {81, 336, 0},
-            {81, 337, 0},
-            {81, 338, 0},
-            {81, 339, 0},
-            {81, 340, 0},
-            {81, 341, 0},
-            {81, 342, 0},
-            {81, 343, 0},
-            {81, 344, 0},
-            {81, 345, 0},
-            {81, 346, 0},
-            {81, 347, 0},
-            {81, 348, 0},
-            {81, 349, 0},
-            {81, 350, 0},
-            {81, 351, 0},
-            {81, 352, 0},
-            {81, 353, 0},
-            {81, 354, 0},
-            {81, 355, 0},
-            {82, 356, 0},
-            {82, 357, 0},
-            {82, 358, 0},
-            {82, 359, 0},
-            {82, 360, 0},
-            {82, 361, 0},
-            {82, 362, 0},
-            {82, 363, 0},
-            {82, 364, 0},
-            {82, 365, 0},
-            {82, 366, 0},
-            {82, 367, 0},
-            {82, 368, 0},
-            {82, 369, 0},
-            {82, 370, 0},
-            {82, 371, 0},
-            {82, 372, 0},
-            {82, 373, 0},
-            {10120, 374, 0},
-            {10120, 375, 0},
-            {10120, 376, 0},
-            {10120, 377, 0},
-            {9100, 378, 0},
-            {9101, 379, 0},
-            {9102, 380, 0},
-            {9103, 381, 0},
-            {11, 382, 0},
-            {11, 383, 0},
-            {11, 384, 0},
-            {11, 385, 0},
-	}},
-    },
-    {
-        {"Darkmere", {false, false, false}, {0, 0, 0}, 12, 593, {
-            {1, 0, 0},
-            {1402, 1, 0},
-            {2, 2, 0},
-            {3, 3, 0},
-            {4, 4, 0},
-            {105, 5, 0},
-            {10000, 6, 0},
-            {10000, 7, 0},
-            {10000, 8, 0},
-            {88, 9, 0},
-            {59, 10, 0},
-            {59, 11, 0},
-            {58, 12, 0},
-            {58, 13, 0},
-            {27, 14, 0},
-            {60, 15, 0},
-            {3000, 16, 0},
-            {3002, 17, 0},
-            {99, 18, 0},
-            {99, 19, 0},
-            {99, 20, 0},
-            {97, 21, 0},
-            {97, 22, 0},
-            {97, 23, 0},
-            {97, 24, 0},
-            {98, 25, 0},
-            {98, 26, 0},
-            {98, 27, 0},
-            {98, 28, 0},
-            {61, 29, 0},
-            {61, 30, 0},
-            {41, 31, 0},
-            {42, 32, 0},
-            {44, 33, 0},
-            {45, 34, 0},
-            {45, 35, 0},
-            {45, 36, 0},
-            {45, 37, 0},
-            {45, 38, 0},
-            {45, 39, 0},
-            {52, 40, 0},
-            {52, 41, 0},
-            {52, 42, 0},
-            {56, 43, 0},
-            {56, 44, 0},
-            {56, 45, 0},
-            {56, 46, 0},
-            {56, 47, 0},
-            {56, 48, 0},
-            {57, 49, 0},
-            {57, 50, 0},
-            {57, 51, 0},
-            {57, 52, 0},
-            {48, 53, 0},
-            {48, 54, 0},
-            {49, 55, 0},
-            {50, 56, 0},
-            {50, 57, 0},
-            {50, 58, 0},
-            {51, 59, 0},
-            {51, 60, 0},
-            {51, 61, 0},
-            {57, 62, 0},
-            {57, 63, 0},
-            {56, 64, 0},
-            {5, 65, 0},
-            {5, 66, 0},
-            {8062, 67, 0},
-            {8062, 68, 0},
-            {8062, 69, 0},
-            {8062, 70, 0},
-            {8000, 71, 0},
-            {8000, 72, 0},
-            {8000, 73, 0},
-            {8000, 74, 0},
-            {8000, 75, 0},
-            {8000, 76, 0},
-            {8000, 77, 0},
-            {8000, 78, 0},
-            {8000, 79, 0},
-            {11, 80, 0},
-            {11, 81, 0},
-            {27, 82, 0},
-            {27, 83, 0},
-            {27, 84, 0},
-            {27, 85, 0},
-            {27, 86, 0},
-            {26, 87, 0},
-            {26, 88, 0},
-            {26, 89, 0},
-            {26, 90, 0},
-            {26, 91, 0},
-            {26, 92, 0},
-            {59, 93, 0},
-            {59, 94, 0},
-            {59, 95, 0},
-            {59, 96, 0},
-            {59, 97, 0},
-            {59, 98, 0},
-            {59, 99, 0},
-            {58, 100, 0},
-            {58, 101, 0},
-            {58, 102, 0},
-            {58, 103, 0},
-            {27, 104, 0},
-            {27, 105, 0},
-            {27, 106, 0},
-            {27, 107, 0},
-            {27, 108, 0},
-            {27, 109, 0},
-            {8069, 110, 0},
-            {59, 111, 0},
-            {122, 112, 0},
-            {81, 113, 0},
-            {81, 114, 0},
-            {10, 115, 0},
-            {27, 116, 0},
-            {27, 117, 0},
-            {27, 118, 0},
-            {27, 119, 0},
-            {27, 120, 0},
-            {27, 121, 0},
-            {27, 122, 0},
-            {27, 123, 0},
-            {60, 124, 0},
-            {27, 125, 0},
-            {37, 126, 0},
-            {37, 127, 0},
-            {37, 128, 0},
-            {37, 129, 0},
-            {37, 130, 0},
-            {37, 131, 0},
-            {38, 132, 0},
-            {99, 133, 0},
-            {105, 134, 0},
-            {105, 135, 0},
-            {105, 136, 0},
-            {105, 137, 0},
-            {8042, 138, 0},
-            {8042, 139, 0},
-            {8042, 140, 0},
-            {8042, 141, 0},
-            {8042, 142, 0},
-            {8042, 143, 0},
-            {71, 144, 0},
-            {71, 145, 0},
-            {108, 146, 0},
-            {111, 147, 0},
-            {111, 148, 0},
-            {111, 149, 0},
-            {10503, 150, 0},
-            {10503, 151, 0},
-            {104, 152, 0},
-            {111, 153, 0},
-            {54, 154, 0},
-            {54, 155, 0},
-            {54, 156, 0},
-            {17, 157, 0},
-            {77, 158, 0},
-            {8069, 159, 0},
-            {10503, 160, 0},
-            {10503, 161, 0},
-            {8069, 162, 0},
-            {10503, 163, 0},
-            {10503, 164, 0},
-            {77, 165, 0},
-            {10503, 166, 0},
-            {10503, 167, 0},
-            {104, 168, 0},
-            {1402, 169, 0},
-            {3000, 170, 0},
-            {3002, 171, 0},
-            {54, 172, 0},
-            {54, 173, 0},
-            {116, 174, 0},
-            {116, 175, 0},
-            {116, 176, 0},
-            {116, 177, 0},
-            {116, 178, 0},
-            {116, 179, 0},
-            {116, 180, 0},
-            {8100, 181, 0},
-            {8100, 182, 0},
-            {8100, 183, 0},
-            {8100, 184, 0},
-            {8100, 185, 0},
-            {8100, 186, 0},
-            {8100, 187, 0},
-            {8100, 188, 0},
-            {8100, 189, 0},
-            {8064, 190, 0},
-            {8064, 191, 0},
-            {77, 192, 0},
-            {77, 193, 0},
-            {1410, 194, 0},
-            {1410, 195, 0},
-            {1410, 196, 0},
-            {1410, 197, 0},
-            {60, 198, 0},
-            {38, 199, 0},
-            {27, 200, 0},
-            {27, 201, 0},
-            {27, 202, 0},
-            {27, 203, 0},
-            {60, 204, 0},
-            {60, 205, 0},
-            {59, 206, 0},
-            {59, 207, 0},
-            {59, 208, 0},
-            {8039, 209, 0},
-            {8072, 210, 0},
-            {8073, 211, 0},
-            {71, 212, 0},
-            {71, 213, 0},
-            {71, 214, 0},
-            {71, 215, 0},
-            {108, 216, 0},
-            {108, 217, 0},
-            {108, 218, 0},
-            {108, 219, 0},
-            {26, 220, 0},
-            {26, 221, 0},
-            {26, 222, 0},
-            {26, 223, 0},
-            {26, 224, 0},
-            {8071, 225, 0},
-            {8103, 226, 0},
-            {9001, 227, 0},
-            {9001, 228, 0},
-            {9001, 229, 0},
-            {9001, 230, 0},
-            {9001, 231, 0},
-            {9001, 232, 0},
-            {9001, 233, 0},
-            {9001, 234, 0},
-            {9001, 235, 0},
-            {9001, 236, 0},
-            {9001, 237, 0},
-            {9001, 238, 0},
-            {9001, 239, 0},
-            {8042, 240, 0},
-            {8042, 241, 0},
-            {8042, 242, 0},
-            {8042, 243, 0},
-            {38, 244, 0},
-            {38, 245, 0},
-            {9001, 246, 0},
-            {9001, 247, 0},
-            {9001, 248, 0},
-            {9001, 249, 0},
-            {9001, 250, 0},
-            {9001, 251, 0},
-            {9001, 252, 0},
-            {9001, 253, 0},
-            {8200, 254, 0},
-            {8008, 255, 0},
-            {8008, 256, 0, 1},
-            {8008, 257, 0},
-            {30, 258, 0},
-            {30, 259, 0},
-            {30, 260, 0},
-            {84, 261, 0, 1},
-            {84, 262, 0},
-            {84, 263, 0},
-            {81, 264, 0},
-            {81, 265, 0},
-            {81, 266, 0},
-            {81, 267, 0},
-            {81, 268, 0},
-            {81, 269, 0},
-            {82, 270, 0},
-            {82, 271, 0},
-            {81, 272, 0},
-            {81, 273, 0},
-            {81, 274, 0},
-            {81, 275, 0},
-            {82, 276, 0},
-            {82, 277, 0},
-            {82, 278, 0},
-            {81, 279, 0},
-            {81, 280, 0},
-            {81, 281, 0},
-            {81, 282, 0},
-            {81, 283, 0},
-            {81, 284, 0},
-            {81, 285, 0},
-            {81, 286, 0},
-            {81, 287, 0},
-            {81, 288, 0},
-            {81, 289, 0},
-            {81, 290, 0},
-            {81, 291, 0},
-            {81, 292, 0},
-            {81, 293, 0},
-            {81, 294, 0},
-            {81, 295, 0},
-            {81, 296, 0},
-            {82, 297, 0},
-            {82, 298, 0},
-            {82, 299, 0},
-            {82, 300, 0},
-            {82, 301, 0},
-            {82, 302, 0},
-            {81, 303, 0},
-            {81, 304, 0},
-            {81, 305, 0},
-            {8000, 306, 0},
-            {8000, 307, 0},
-            {8000, 308, 0},
-            {8000, 309, 0},
-            {8000, 310, 0},
-            {8000, 311, 0},
-            {8000, 312, 0},
-            {8000, 313, 0},
-            {8000, 314, 0},
-            {8000, 315, 0},
-            {8000, 316, 0},
-            {122, 317, 0},
-            {122, 318, 0},
-            {124, 319, 0},
-            {124, 320, 0},
-            {124, 321, 0},
-            {122, 322, 0},
-            {122, 323, 0},
-            {122, 324, 0},
-            {122, 325, 0},
-            {124, 326, 0},
-            {124, 327, 0},
-            {124, 328, 0},
-            {8004, 329, 0},
-            {8004, 330, 0},
-            {8010, 331, 0},
-            {53, 332, 0},
-            {8009, 333, 0},
-            {123, 334, 0},
-            {8040, 335, 0},
-            {20, 336, 0},
-            {19, 337, 0},
-            {18, 338, 0},
-            {16, 339, 0},
-            {13, 340, 0},
-            {12, 341, 0},
-            {23, 342, 0},
-            {22, 343, 0},
-            {21, 344, 0},
-            {8008, 345, 0},
-            {8005, 346, 0},
-            {10110, 347, 0},
-            {10110, 348, 0},
-            {10110, 349, 0},
-            {10110, 350, 0},
-            {10110, 351, 0},
-            {8003, 352, 0},
-            {8003, 353, 0},
-            {8002, 354, 0},
-            {8041, 355, 0},
-            {84, 356, 0},
-            {84, 357, 0},
-            {30, 358, 0},
-            {83, 359, 0},
-            {32, 360, 0},
-            {82, 361, 0},
-            {82, 362, 0},
-            {82, 363, 0},
-            {81, 364, 0},
-            {81, 365, 0},
-            {81, 366, 0},
-            {81, 367, 0},
-            {81, 368, 0},
-            {8007, 369, 0},
-            {8000, 370, 0},
-            {8000, 371, 0},
-            {8000, 372, 0},
-            {8000, 373, 0},
-            {8000, 374, 0},
-            {8000, 375, 0},
-            {8006, 376, 0},
-            {86, 377, 0},
-            {36, 378, 0},
-            {33, 379, 0},
-            {10110, 380, 0},
-            {10040, 381, 0},
-            {11, 382, 0},
-            {11, 383, 0},
-            {121, 384, 0},
-            {121, 385, 0},
-            {121, 386, 0},
-            {121, 387, 0},
-            {121, 388, 0},
-            {121, 389, 0},
-            {10030, 390, 0},
-            {10030, 391, 0},
-            {10030, 392, 0},
-            {10030, 393, 0},
-            {121, 394, 0},
-            {121, 395, 0},
-            {121, 396, 0},
-            {121, 397, 0},
-            {121, 398, 0},
-            {121, 399, 0},
-            {10060, 400, 0},
-            {10060, 401, 0},
-            {31, 402, 0},
-            {10030, 403, 0},
-            {10030, 404, 0},
-            {10030, 405, 0},
-            {10030, 406, 0},
-            {10030, 407, 0},
-            {10060, 408, 0},
-            {10060, 409, 0},
-            {10060, 410, 0},
-            {10060, 411, 0},
-            {121, 412, 0},
-            {121, 413, 0},
-            {120, 414, 0},
-            {120, 415, 0},
-            {120, 416, 0},
-            {120, 417, 0},
-            {120, 418, 0},
-            {10060, 419, 0},
-            {10060, 420, 0},
-            {10060, 421, 0},
-            {10060, 422, 0},
-            {10060, 423, 0},
-            {9001, 424, 0},
-            {9001, 425, 0},
-            {9001, 426, 0},
-            {9001, 427, 0},
-            {9001, 428, 0},
-            {10060, 429, 0},
-            {10060, 430, 0},
-            {10060, 431, 0},
-            {10060, 432, 0},
-            {10060, 433, 0},
-            {10060, 434, 0},
-            {10060, 435, 0},
-            {10060, 436, 0},
-            {10060, 437, 0},
-            {10060, 438, 0},
-            {10060, 439, 0},
-            {10060, 440, 0},
-            {10060, 441, 0},
-            {10060, 442, 0},
-            {107, 443, 0},
-            {107, 444, 0},
-            {107, 445, 0},
-            {107, 446, 0},
-            {31, 447, 0},
-            {31, 448, 0},
-            {107, 449, 0},
-            {8080, 450, 0},
-            {8080, 451, 0},
-            {107, 452, 0},
-            {107, 453, 0},
-            {10060, 454, 0},
-            {10060, 455, 0},
-            {10060, 456, 0},
-            {10060, 457, 0},
-            {10030, 458, 0},
-            {10030, 459, 0},
-            {10030, 460, 0},
-            {10030, 461, 0},
-            {107, 462, 0},
-            {10060, 463, 0},
-            {10060, 464, 0},
-            {10030, 465, 0},
-            {10030, 466, 0},
-            {31, 467, 0},
-            {31, 468, 0},
-            {31, 469, 0},
-            {31, 470, 0},
-            {31, 471, 0},
-            {31, 472, 0},
-            {31, 473, 0},
-            {107, 474, 0},
-            {10060, 475, 0},
-            {10030, 476, 0},
-            {10030, 477, 0},
-            {10030, 478, 0},
-            {10030, 479, 0},
-            {10030, 480, 0},
-            {10030, 481, 0},
-            {10030, 482, 0},
-            {10030, 483, 0},
-            {10030, 484, 0},
-            {10030, 485, 0},
-            {10030, 486, 0},
-            {10030, 487, 0},
-            {10030, 488, 0},
-            {10030, 489, 0},
-            {10030, 490, 0},
-            {10030, 491, 0},
-            {10030, 492, 0},
-            {107, 493, 0},
-            {107, 494, 0},
-            {107, 495, 0},
-            {107, 496, 0},
-            {107, 497, 0},
-            {107, 498, 0},
-            {31, 499, 0},
-            {10030, 500, 0},
-            {10030, 501, 0},
-            {10060, 502, 0},
-            {10060, 503, 0},
-            {10060, 504, 0},
-            {10060, 505, 0},
-            {10060, 506, 0},
-            {10060, 507, 0},
-            {10030, 508, 0},
-            {10030, 509, 0},
-            {10030, 510, 0},
-            {10030, 511, 0},
-            {10030, 512, 0},
-            {10030, 513, 0},
-            {10030, 514, 0},
-            {10030, 515, 0},
-            {10030, 516, 0},
-            {10030, 517, 0},
-            {10030, 518, 0},
-            {10030, 519, 0},
-            {11, 520, 0},
-            {11, 521, 0},
-            {8505, 522, 0},
-            {8500, 523, 0},
-            {8506, 524, 0},
-            {8500, 525, 0},
-            {8508, 526, 0},
-            {1406, 527, 0},
-            {1406, 528, 0},
-            {1406, 529, 0},
-            {8042, 530, 0},
-            {8042, 531, 0},
-            {8042, 532, 0},
-            {8042, 533, 0},
-            {8042, 534, 0},
-            {8042, 535, 0},
-            {8042, 536, 0},
-            {8042, 537, 0},
-            {8042, 538, 0},
-            {8043, 539, 0},
-            {116, 540, 0},
-            {116, 541, 0},
-            {10110, 542, 0},
-            {10110, 543, 0},
-            {10110, 544, 0},
-            {10110, 545, 0},
-            {8002, 546, 0},
-            {115, 547, 0},
-            {107, 548, 0},
-            {107, 549, 0},
-            {10030, 550, 0},
-            {10030, 551, 0},
-            {10030, 552, 0},
-            {10030, 553, 0},
-            {10030, 554, 0},
-            {10030, 555, 0},
-            {10030, 556, 0},
-            {10030, 557, 0},
-            {10030, 558, 0},
-            {10060, 559, 0},
-            {10060, 560, 0},
-            {10060, 561, 0},
-            {10060, 562, 0},
-            {10060, 563, 0},
-            {10060, 564, 0},
-            {10060, 565, 0},
-            {10060, 566, 0},
-            {9001, 567, 0},
-            {9001, 568, 0},
-            {9001, 569, 0},
-            {9001, 570, 0},
-            {9001, 571, 0},
-            {9001, 572, 0},
-            {9001, 573, 0},
-            {9001, 574, 0},
-            {9001, 575, 0},
-            {9001, 576, 0},
-            {9001, 577, 0},
-            {9001, 578, 0},
-            {9001, 579, 0},
-            {9001, 580, 0},
-            {9001, 581, 0},
-            {9001, 582, 0},
-            {11, 583, 0},
-            {10120, 584, 0},
-            {10120, 585, 0},
-            {10120, 586, 0},
-            {10120, 587, 0},
-            {11, 588, 0},
-            {9100, 589, 0},
-            {9101, 590, 0},
-            {9102, 591, 0},
-            {9103, 592, 0},
-	}},
-        {"Caves of Circe", {false, false, false}, {0, 0, 0}, 7, 379, {
-            {1, 0, 0},
-            {3002, 1, 0},
-            {3000, 2, 0},
-            {3000, 3, 0},
-            {3002, 4, 0},
-            {48, 5, 0},
-            {48, 6, 0},
-            {48, 7, 0},
-            {15, 8, 0},
-            {7, 9, 0},
-            {9, 10, 0},
-            {6, 11, 0},
-            {79, 12, 0},
-            {24, 13, 0},
-            {24, 14, 0},
-            {52, 15, 0},
-            {45, 16, 0},
-            {44, 17, 0},
-            {42, 18, 0},
-            {42, 19, 0},
-            {52, 20, 0},
-            {52, 21, 0},
-            {52, 22, 0},
-            {56, 23, 0},
-            {56, 24, 0},
-            {57, 25, 0},
-            {49, 26, 0},
-            {50, 27, 0},
-            {50, 28, 0},
-            {51, 29, 0},
-            {51, 30, 0},
-            {41, 31, 0},
-            {42, 32, 0},
-            {44, 33, 0},
-            {45, 34, 0},
-            {48, 35, 0},
-            {48, 36, 0},
-            {48, 37, 0},
-            {50, 38, 0},
-            {57, 39, 0},
-            {56, 40, 0},
-            {49, 41, 0},
-            {48, 42, 0},
-            {48, 43, 0},
-            {48, 44, 0},
-            {48, 45, 0},
-            {48, 46, 0},
-            {48, 47, 0},
-            {49, 48, 0},
-            {52, 49, 0},
-            {56, 50, 0},
-            {50, 51, 0},
-            {51, 52, 0},
-            {57, 53, 0},
-            {42, 54, 0},
-            {44, 55, 0},
-            {45, 56, 0},
-            {41, 57, 0},
-            {48, 58, 0},
-            {48, 59, 0},
-            {48, 60, 0},
-            {57, 61, 0},
-            {57, 62, 0},
-            {50, 63, 0},
-            {50, 64, 0},
-            {49, 65, 0},
-            {52, 66, 0},
-            {49, 67, 0},
-            {49, 68, 0},
-            {49, 69, 0},
-            {50, 70, 0},
-            {50, 71, 0},
-            {50, 72, 0},
-            {51, 73, 0},
-            {51, 74, 0},
-            {51, 75, 0},
-            {48, 76, 0},
-            {48, 77, 0},
-            {48, 78, 0},
-            {9, 79, 0},
-            {9, 80, 0},
-            {9, 81, 0},
-            {9, 82, 0},
-            {9, 83, 0},
-            {7, 84, 0},
-            {7, 85, 0},
-            {7, 86, 0},
-            {7, 87, 0},
-            {7, 88, 0},
-            {15, 89, 0},
-            {15, 90, 0},
-            {6, 91, 0},
-            {6, 92, 0},
-            {41, 93, 0},
-            {41, 94, 0},
-            {42, 95, 0},
-            {42, 96, 0},
-            {44, 97, 0},
-            {44, 98, 0},
-            {44, 99, 0},
-            {42, 100, 0},
-            {42, 101, 0},
-            {45, 102, 0},
-            {45, 103, 0},
-            {41, 104, 0},
-            {41, 105, 0},
-            {52, 106, 0},
-            {52, 107, 0},
-            {52, 108, 0},
-            {52, 109, 0},
-            {56, 110, 0},
-            {56, 111, 0},
-            {57, 112, 0},
-            {57, 113, 0},
-            {8080, 114, 0},
-            {8005, 115, 0},
-            {36, 116, 0},
-            {81, 117, 0},
-            {81, 118, 0},
-            {81, 119, 0},
-            {81, 120, 0},
-            {81, 121, 0},
-            {81, 122, 0},
-            {8000, 123, 0},
-            {8000, 124, 0},
-            {8000, 125, 0},
-            {8000, 126, 0},
-            {8000, 127, 0},
-            {8000, 128, 0},
-            {8000, 129, 0},
-            {8000, 130, 0},
-            {53, 131, 0},
-            {8031, 132, 0},
-            {8080, 133, 0},
-            {8080, 134, 0},
-            {8080, 135, 0},
-            {8080, 136, 0},
-            {8080, 137, 0},
-            {10030, 138, 0},
-            {10030, 139, 0},
-            {10030, 140, 0},
-            {10030, 141, 0},
-            {8080, 142, 0},
-            {10030, 143, 0},
-            {10030, 144, 0},
-            {10030, 145, 0},
-            {10030, 146, 0},
-            {8080, 147, 0},
-            {8080, 148, 0},
-            {8080, 149, 0},
-            {8080, 150, 0},
-            {8080, 151, 0},
-            {10030, 152, 0},
-            {10030, 153, 0},
-            {10030, 154, 0},
-            {8080, 155, 0},
-            {8080, 156, 0},
-            {8080, 157, 0},
-            {8080, 158, 0},
-            {8080, 159, 0},
-            {8080, 160, 0},
-            {8080, 161, 0},
-            {10030, 162, 0},
-            {10030, 163, 0},
-            {10030, 164, 0},
-            {10030, 165, 0},
-            {10030, 166, 0},
-            {10030, 167, 0},
-            {10030, 168, 0},
-            {10030, 169, 0},
-            {10030, 170, 0},
-            {8080, 171, 0},
-            {8080, 172, 0},
-            {10030, 173, 0},
-            {10030, 174, 0},
-            {8080, 175, 0},
-            {10030, 176, 0},
-            {10030, 177, 0},
-            {10030, 178, 0},
-            {81, 179, 0},
-            {81, 180, 0},
-            {81, 181, 0},
-            {81, 182, 0},
-            {8066, 183, 0},
-            {8066, 184, 0},
-            {81, 185, 0},
-            {81, 186, 0},
-            {81, 187, 0},
-            {81, 188, 0},
-            {81, 189, 0},
-            {81, 190, 0},
-            {8000, 191, 0},
-            {8000, 192, 0},
-            {8000, 193, 0},
-            {8000, 194, 0},
-            {8000, 195, 0},
-            {8000, 196, 0},
-            {82, 197, 0},
-            {82, 198, 0},
-            {82, 199, 0},
-            {124, 200, 0},
-            {124, 201, 0},
-            {122, 202, 0},
-            {122, 203, 0},
-            {8004, 204, 0},
-            {117, 205, 0},
-            {117, 206, 0},
-            {117, 207, 0},
-            {117, 208, 0},
-            {30, 209, 0},
-            {8004, 210, 0},
-            {8004, 211, 0},
-            {8004, 212, 0},
-            {124, 213, 0},
-            {124, 214, 0},
-            {124, 215, 0},
-            {124, 216, 0},
-            {122, 217, 0},
-            {122, 218, 0},
-            {122, 219, 0},
-            {122, 220, 0},
-            {124, 221, 0},
-            {124, 222, 0},
-            {81, 223, 0},
-            {81, 224, 0},
-            {81, 225, 0},
-            {81, 226, 0},
-            {8000, 227, 0},
-            {8000, 228, 0},
-            {8000, 229, 0},
-            {8000, 230, 0},
-            {8000, 231, 0},
-            {8000, 232, 0},
-            {81, 233, 0},
-            {81, 234, 0},
-            {81, 235, 0},
-            {81, 236, 0},
-            {81, 237, 0},
-            {81, 238, 0},
-            {8007, 239, 0, 1},
-            {82, 240, 0},
-            {82, 241, 0},
-            {124, 242, 0},
-            {124, 243, 0},
-            {122, 244, 0},
-            {122, 245, 0},
-            {122, 246, 0},
-            {122, 247, 0},
-            {124, 248, 0},
-            {124, 249, 0},
-            {122, 250, 0},
-            {122, 251, 0},
-            {122, 252, 0},
-            {122, 253, 0},
-            {124, 254, 0},
-            {124, 255, 0},
-            {124, 256, 0},
-            {124, 257, 0},
-            {81, 258, 0},
-            {81, 259, 0},
-            {81, 260, 0},
-            {81, 261, 0},
-            {81, 262, 0},
-            {81, 263, 0},
-            {81, 264, 0},
-            {81, 265, 0},
-            {57, 266, 0},
-            {56, 267, 0},
-            {9001, 268, 0},
-            {9001, 269, 0},
-            {57, 270, 0},
-            {9001, 271, 0},
-            {56, 272, 0},
-            {9001, 273, 0},
-            {9001, 274, 0},
-            {9001, 275, 0},
-            {56, 276, 0},
-            {9001, 277, 0},
-            {57, 278, 0},
-            {9001, 279, 0},
-            {2, 280, 0},
-            {3, 281, 0},
-            {4, 282, 0},
-            {10225, 283, 0},
-            {10225, 284, 0},
-            {10225, 285, 0},
-            {140, 286, 0},
-            {14, 287, 0},
-            {10, 288, 0},
-            {8010, 289, 0},
-            {53, 290, 0},
-            {8009, 291, 0},
-            {123, 292, 0},
-            {8040, 293, 0},
-            {20, 294, 0},
-            {19, 295, 0},
-            {18, 296, 0},
-            {16, 297, 0},
-            {13, 298, 0},
-            {12, 299, 0},
-            {23, 300, 0},
-            {22, 301, 0},
-            {21, 302, 0},
-            {8008, 303, 0},
-            {8005, 304, 0},
-            {10110, 305, 0},
-            {10110, 306, 0},
-            {10110, 307, 0},
-            {10110, 308, 0},
-            {10110, 309, 0},
-            {10110, 310, 0},
-            {10110, 311, 0},
-            {10110, 312, 0},
-            {8003, 313, 0},
-            {8002, 314, 0},
-            {8041, 315, 0},
-            {8041, 316, 0},
-            {8041, 317, 0},
-            {84, 318, 0},
-            {84, 319, 0},
-            {83, 320, 0},
-            {32, 321, 0},
-            {8007, 322, 0},
-            {8006, 323, 0},
-            {36, 324, 0},
-            {10040, 325, 0},
-            {84, 326, 0},
-            {11, 327, 0},
-            {11, 328, 0},
-            {11, 329, 0},
-            {11, 330, 0},
-            {9001, 331, 0},
-            {9001, 332, 0},
-            {9001, 333, 0},
-            {9001, 334, 0},
-            {9001, 335, 0},
-            {10060, 336, 0},
-            {10060, 337, 0},
-            {10060, 338, 0},
-            {10060, 339, 0},
-            {10060, 340, 0},
-            {10060, 341, 0},
-            {10060, 342, 0},
-            {10060, 343, 0},
-            {10060, 344, 0},
-            {10060, 345, 0},
-            {10060, 346, 0},
-            {10060, 347, 0},
-            {10060, 348, 0},
-            {10060, 349, 0},
-            {10060, 350, 0},
-            {10060, 351, 0},
-            {10060, 352, 0},
-            {10060, 353, 0},
-            {10030, 354, 0},
-            {10030, 355, 0},
-            {10030, 356, 0},
-            {10030, 357, 0},
-            {10030, 358, 0},
-            {10030, 359, 0},
-            {10030, 360, 0},
-            {10030, 361, 0},
-            {10030, 362, 0},
-            {10030, 363, 0},
-            {10030, 364, 0},
-            {10030, 365, 0},
-            {10030, 366, 0},
-            {10030, 367, 0},
-            {10120, 368, 0},
-            {10120, 369, 0},
-            {10120, 370, 0},
-            {11, 371, 0},
-            {11, 372, 0},
-            {11, 373, 0},
-            {11, 374, 0},
-            {9100, 375, 0},
-            {9101, 376, 0},
-            {9102, 377, 0},
-            {9103, 378, 0},
-	}},
-        {"Wastelands", {false, false, false}, {0, 0, 0}, 10, 450, {
-            {1, 0, 0},
-            {3000, 1, 0},
-            {3002, 2, 0},
-            {3000, 3, 0},
-            {3002, 4, 0},
-            {3000, 5, 0},
-            {3002, 6, 0},
-            {3000, 7, 0},
-            {3002, 8, 0},
-            {3000, 9, 0},
-            {3001, 10, 0},
-            {3000, 11, 0},
-            {3001, 12, 0},
-            {3001, 13, 0},
-            {3000, 14, 0},
-            {10030, 15, 0},
-            {10030, 16, 0},
-            {10030, 17, 0},
-            {10030, 18, 0},
-            {10030, 19, 0},
-            {10030, 20, 0},
-            {10030, 21, 0},
-            {10030, 22, 0},
-            {10030, 23, 0},
-            {10030, 24, 0},
-            {107, 25, 0},
-            {107, 26, 0},
-            {107, 27, 0},
-            {107, 28, 0},
-            {107, 29, 0},
-            {9001, 30, 0},
-            {9001, 31, 0},
-            {9001, 32, 0},
-            {9001, 33, 0},
-            {9001, 34, 0},
-            {9001, 35, 0},
-            {9001, 36, 0},
-            {9001, 37, 0},
-            {10060, 38, 0},
-            {9001, 39, 0},
-            {10060, 40, 0},
-            {10060, 41, 0},
-            {10060, 42, 0},
-            {10060, 43, 0},
-            {9001, 44, 0},
-            {10000, 45, 0},
-            {10000, 46, 0},
-            {77, 47, 0},
-            {77, 48, 0},
-            {77, 49, 0},
-            {77, 50, 0},
-            {77, 51, 0},
-            {77, 52, 0},
-            {117, 53, 0},
-            {117, 54, 0},
-            {117, 55, 0},
-            {117, 56, 0},
-            {117, 57, 0},
-            {117, 58, 0},
-            {119, 59, 0},
-            {119, 60, 0},
-            {119, 61, 0},
-            {119, 62, 0},
-            {119, 63, 0},
-            {119, 64, 0},
-            {5, 65, 0},
-            {5, 66, 0},
-            {55, 67, 0},
-            {55, 68, 0},
-            {55, 69, 0},
-            {55, 70, 0},
-            {55, 71, 0},
-            {55, 72, 0},
-            {8003, 73, 0},
-            {9001, 74, 0},
-            {9001, 75, 0},
-            {9001, 76, 0},
-            {9001, 77, 0},
-            {9001, 78, 0},
-            {9001, 79, 0},
-            {9001, 80, 0},
-            {9001, 81, 0},
-            {99, 82, 0},
-            {97, 83, 0},
-            {98, 84, 0},
-            {98, 85, 0},
-            {98, 86, 0},
-            {97, 87, 0},
-            {97, 88, 0},
-            {99, 89, 0},
-            {98, 90, 0},
-            {98, 91, 0},
-            {97, 92, 0},
-            {99, 93, 0},
-            {99, 94, 0},
-            {97, 95, 0},
-            {99, 96, 0},
-            {99, 97, 0},
-            {97, 98, 0},
-            {98, 99, 0},
-            {99, 100, 0},
-            {97, 101, 0},
-            {98, 102, 0},
-            {98, 103, 0},
-            {98, 104, 0},
-            {99, 105, 0},
-            {97, 106, 0},
-            {98, 107, 0},
-            {99, 108, 0},
-            {99, 109, 0},
-            {97, 110, 0},
-            {98, 111, 0},
-            {97, 112, 0},
-            {99, 113, 0},
-            {99, 114, 0},
-            {97, 115, 0},
-            {60, 116, 0},
-            {26, 117, 0},
-            {27, 118, 0},
-            {38, 119, 0},
-            {38, 120, 0},
-            {38, 121, 0},
-            {26, 122, 0},
-            {27, 123, 0},
-            {61, 124, 0},
-            {61, 125, 0},
-            {61, 126, 0},
-            {61, 127, 0},
-            {61, 128, 0},
-            {61, 129, 0},
-            {61, 130, 0},
-            {61, 131, 0},
-            {78, 132, 0},
-            {87, 133, 0},
-            {80, 134, 0},
-            {28, 135, 0},
-            {56, 136, 0},
-            {56, 137, 0},
-            {56, 138, 0},
-            {52, 139, 0},
-            {52, 140, 0},
-            {52, 141, 0},
-            {52, 142, 0},
-            {6, 143, 0},
-            {6, 144, 0},
-            {7, 145, 0},
-            {9, 146, 0},
-            {9, 147, 0},
-            {15, 148, 0},
-            {15, 149, 0},
-            {8010, 150, 0},
-            {8002, 151, 0},
-            {8003, 152, 0},
-            {30, 153, 0},
-            {8006, 154, 0},
-            {8038, 155, 0},
-            {32, 156, 0},
-            {8000, 157, 0},
-            {8000, 158, 0},
-            {8000, 159, 0},
-            {8000, 160, 0},
-            {8000, 161, 0},
-            {8000, 162, 0},
-            {8000, 163, 0},
-            {8000, 164, 0},
-            {8000, 165, 0},
-            {8000, 166, 0},
-            {8000, 167, 0},
-            {8000, 168, 0},
-            {8000, 169, 0},
-            {8000, 170, 0},
-            {8000, 171, 0},
-            {120, 172, 0},
-            {120, 173, 0},
-            {121, 174, 0},
-            {121, 175, 0},
-            {107, 176, 0},
-            {107, 177, 0},
-            {107, 178, 0},
-            {107, 179, 0},
-            {107, 180, 0},
-            {107, 181, 0},
-            {8080, 182, 0},
-            {8080, 183, 0},
-            {8080, 184, 0},
-            {8080, 185, 0},
-            {8080, 186, 0},
-            {8080, 187, 0},
-            {8080, 188, 0},
-            {8080, 189, 0},
-            {10030, 190, 0},
-            {10030, 191, 0},
-            {10030, 192, 0},
-            {10030, 193, 0},
-            {10030, 194, 0},
-            {10030, 195, 0},
-            {10030, 196, 0},
-            {8080, 197, 0},
-            {107, 198, 0},
-            {107, 199, 0},
-            {107, 200, 0},
-            {107, 201, 0},
-            {107, 202, 0},
-            {107, 203, 0},
-            {107, 204, 0},
-            {8080, 205, 0},
-            {8080, 206, 0},
-            {8080, 207, 0},
-            {10060, 208, 0},
-            {10060, 209, 0},
-            {10060, 210, 0},
-            {10060, 211, 0},
-            {10060, 212, 0},
-            {10060, 213, 0},
-            {10060, 214, 0},
-            {10060, 215, 0},
-            {10060, 216, 0},
-            {10060, 217, 0},
-            {10060, 218, 0},
-            {10060, 219, 0},
-            {10060, 220, 0},
-            {10060, 221, 0},
-            {10060, 222, 0},
-            {10060, 223, 0},
-            {10060, 224, 0},
-            {8080, 225, 0},
-            {8080, 226, 0},
-            {8080, 227, 0},
-            {10090, 228, 0},
-            {10090, 229, 0},
-            {10090, 230, 0},
-            {10090, 231, 0},
-            {10090, 232, 0},
-            {10090, 233, 0},
-            {10090, 234, 0},
-            {10090, 235, 0},
-            {10090, 236, 0},
-            {10090, 237, 0},
-            {10090, 238, 0},
-            {10090, 239, 0},
-            {10090, 240, 0},
-            {10090, 241, 0},
-            {10090, 242, 0},
-            {10090, 243, 0},
-            {10090, 244, 0},
-            {10090, 245, 0},
-            {10090, 246, 0},
-            {10090, 247, 0},
-            {10090, 248, 0},
-            {10090, 249, 0},
-            {11, 250, 0},
-            {11, 251, 0},
-            {11, 252, 0},
-            {11, 253, 0},
-            {8004, 254, 0},
-            {8004, 255, 0},
-            {8004, 256, 0},
-            {81, 257, 0},
-            {81, 258, 0},
-            {81, 259, 0},
-            {81, 260, 0},
-            {81, 261, 0},
-            {81, 262, 0},
-            {81, 263, 0},
-            {81, 264, 0},
-            {81, 265, 0},
-            {81, 266, 0},
-            {81, 267, 0},
-            {82, 268, 0},
-            {124, 269, 0},
-            {124, 270, 0},
-            {124, 271, 0},
-            {124, 272, 0},
-            {124, 273, 0},
-            {124, 274, 0},
-            {124, 275, 0},
-            {122, 276, 0},
-            {122, 277, 0},
-            {122, 278, 0},
-            {122, 279, 0},
-            {122, 280, 0},
-            {122, 281, 0},
-            {124, 282, 0},
-            {124, 283, 0},
-            {124, 284, 0},
-            {81, 285, 0},
-            {81, 286, 0},
-            {81, 287, 0},
-            {81, 288, 0},
-            {81, 289, 0},
-            {81, 290, 0},
-            {8000, 291, 0},
-            {8000, 292, 0},
-            {8000, 293, 0},
-            {8000, 294, 0},
-            {8000, 295, 0},
-            {8000, 296, 0},
-            {8000, 297, 0},
-            {8000, 298, 0},
-            {8000, 299, 0},
-            {8000, 300, 0},
-            {8000, 301, 0},
-            {8000, 302, 0},
-            {81, 303, 0},
-            {81, 304, 0},
-            {81, 305, 0},
-            {122, 306, 0},
-            {122, 307, 0},
-            {122, 308, 0},
-            {124, 309, 0},
-            {124, 310, 0},
-            {124, 311, 0},
-            {2, 312, 0},
-            {3, 313, 0},
-            {4, 314, 0},
-            {107, 315, 0},
-            {107, 316, 0},
-            {107, 317, 0},
-            {107, 318, 0},
-            {107, 319, 0},
-            {107, 320, 0},
-            {107, 321, 0},
-            {107, 322, 0},
-            {107, 323, 0},
-            {107, 324, 0},
-            {107, 325, 0},
-            {10030, 326, 0},
-            {10030, 327, 0},
-            {10030, 328, 0},
-            {10030, 329, 0},
-            {10030, 330, 0},
-            {10030, 331, 0},
-            {10030, 332, 0},
-            {10030, 333, 0},
-            {10030, 334, 0},
-            {10030, 335, 0},
-            {10060, 336, 0},
-            {10060, 337, 0},
-            {10060, 338, 0},
-            {10060, 339, 0},
-            {123, 340, 0},
-            {16, 341, 0},
-            {13, 342, 0},
-            {12, 343, 0},
-            {10, 344, 0},
-            {8009, 345, 0},
-            {20, 346, 0},
-            {19, 347, 0},
-            {18, 348, 0},
-            {53, 349, 0},
-            {8040, 350, 0},
-            {23, 351, 0},
-            {22, 352, 0},
-            {21, 353, 0},
-            {83, 354, 0},
-            {8007, 355, 0},
-            {8008, 356, 0},
-            {8005, 357, 0},
-            {9001, 358, 0},
-            {9001, 359, 0},
-            {9001, 360, 0},
-            {9001, 361, 0},
-            {9001, 362, 0},
-            {10030, 363, 0},
-            {10030, 364, 0},
-            {10030, 365, 0},
-            {10030, 366, 0},
-            {107, 367, 0},
-            {107, 368, 0},
-            {107, 369, 0},
-            {107, 370, 0},
-            {107, 371, 0},
-            {8080, 372, 0},
-            {8080, 373, 0},
-            {10060, 374, 0},
-            {10060, 375, 0},
-            {10060, 376, 0},
-            {10060, 377, 0},
-            {10060, 378, 0},
-            {10060, 379, 0},
-            {10060, 380, 0},
-            {10060, 381, 0},
-            {10030, 382, 0},
-            {10030, 383, 0},
-            {8080, 384, 0},
-            {8080, 385, 0},
-            {8080, 386, 0},
-            {8080, 387, 0},
-            {8080, 388, 0},
-            {121, 389, 0},
-            {121, 390, 0},
-            {10060, 391, 0},
-            {10030, 392, 0},
-            {10060, 393, 0},
-            {10060, 394, 0},
-            {10060, 395, 0},
-            {10060, 396, 0},
-            {10030, 397, 0},
-            {10030, 398, 0},
-            {10030, 399, 0},
-            {107, 400, 0},
-            {107, 401, 0},
-            {121, 402, 0},
-            {121, 403, 0},
-            {8080, 404, 0},
-            {8080, 405, 0},
-            {10030, 406, 0},
-            {10030, 407, 0},
-            {84, 408, 0},
-            {84, 409, 0},
-            {82, 410, 0},
-            {82, 411, 0},
-            {82, 412, 0},
-            {82, 413, 0},
-            {82, 414, 0},
-            {82, 415, 0},
-            {82, 416, 0},
-            {82, 417, 0},
-            {82, 418, 0},
-            {82, 419, 0},
-            {81, 420, 0},
-            {81, 421, 0},
-            {81, 422, 0},
-            {81, 423, 0},
-            {81, 424, 0},
-            {81, 425, 0},
-            {81, 426, 0},
-            {81, 427, 0},
-            {81, 428, 0},
-            {81, 429, 0},
-            {81, 430, 0},
-            {81, 431, 0},
-            {81, 432, 0},
-            {81, 433, 0},
-            {81, 434, 0},
-            {81, 435, 0},
-            {81, 436, 0},
-            {10120, 437, 0},
-            {10120, 438, 0},
-            {10120, 439, 0},
-            {10120, 440, 0},
-            {140, 441, 0},
-            {11, 442, 0},
-            {11, 443, 0},
-            {11, 444, 0},
-            {11, 445, 0},
-            {9100, 446, 0},
-            {9101, 447, 0},
-            {9102, 448, 0},
-            {9103, 449, 0},
-	}},
-        {"Sacred Grove", {false, false, false}, {0, 0, 0}, 4, 116, {
-            {1, 0, 0},
-            {9001, 1, 0},
-            {9001, 2, 0},
-            {9001, 3, 0},
-            {9001, 4, 0},
-            {10030, 5, 0},
-            {10030, 6, 0},
-            {10030, 7, 0},
-            {10030, 8, 0},
-            {9001, 9, 0},
-            {9001, 10, 0},
-            {9001, 11, 0},
-            {9001, 12, 0},
-            {78, 13, 0},
-            {78, 14, 0},
-            {78, 15, 0},
-            {78, 16, 0},
-            {79, 17, 0},
-            {79, 18, 0},
-            {79, 19, 0},
-            {79, 20, 0},
-            {10030, 21, 0},
-            {10030, 22, 0},
-            {10030, 23, 0},
-            {11, 24, 0},
-            {11, 25, 0},
-            {11, 26, 0},
-            {11, 27, 0},
-            {10030, 28, 0},
-            {8004, 29, 0},
-            {8004, 30, 0},
-            {8004, 31, 0},
-            {8004, 32, 0},
-            {8004, 33, 0},
-            {8004, 34, 0},
-            {8004, 35, 0},
-            {8004, 36, 0},
-            {81, 37, 0},
-            {81, 38, 0},
-            {81, 39, 0},
-            {81, 40, 0},
-            {81, 41, 0},
-            {81, 42, 0},
-            {81, 43, 0},
-            {81, 44, 0},
-            {82, 45, 0},
-            {82, 46, 0},
-            {82, 47, 0},
-            {82, 48, 0},
-            {10030, 49, 0},
-            {10030, 50, 0},
-            {10030, 51, 0},
-            {10030, 52, 0},
-            {10030, 53, 0},
-            {81, 54, 0},
-            {81, 55, 0},
-            {81, 56, 0},
-            {81, 57, 0},
-            {81, 58, 0},
-            {81, 59, 0},
-            {81, 60, 0},
-            {81, 61, 0},
-            {32, 62, 0},
-            {32, 63, 0},
-            {32, 64, 0},
-            {82, 65, 0},
-            {82, 66, 0},
-            {82, 67, 0},
-            {82, 68, 0},
-            {122, 69, 0},
-            {122, 70, 0},
-            {122, 71, 0},
-            {122, 72, 0},
-            {122, 73, 0},
-            {122, 74, 0},
-            {122, 75, 0},
-            {122, 76, 0},
-            {124, 77, 0},
-            {124, 78, 0},
-            {124, 79, 0},
-            {124, 80, 0},
-            {124, 81, 0},
-            {124, 82, 0},
-            {124, 83, 0},
-            {124, 84, 0},
-            {10030, 85, 0},
-            {10030, 86, 0},
-            {10030, 87, 0},
-            {2, 88, 0},
-            {3, 89, 0},
-            {4, 90, 0},
-            {8010, 91, 0},
-            {123, 92, 0},
-            {10, 93, 0},
-            {8009, 94, 0},
-            {53, 95, 0},
-            {8040, 96, 0},
-            {9001, 97, 0},
-            {9001, 98, 0},
-            {9001, 99, 0},
-            {9001, 100, 0},
-            {9001, 101, 0},
-            {10030, 102, 0},
-            {10030, 103, 0},
-            {10030, 104, 0},
-            {10030, 105, 0},
-            {10120, 106, 0},
-            {10120, 107, 0},
-            {9100, 108, 0},
-            {9101, 109, 0},
-            {9102, 110, 0},
-            {9103, 111, 0},
-            {11, 112, 0},
-            {11, 113, 0},
-            {11, 114, 0},
-            {11, 115, 0},
-	}},
-        {"Hypostyle", {false, false, false}, {0, 0, 0}, 4, 278, {
-            {1, 0, 0},
-            {10030, 1, 0},
-            {107, 2, 0},
-            {10030, 3, 0},
-            {9, 4, 0},
-            {9, 5, 0},
-            {9, 6, 0},
-            {9, 7, 0},
-            {9, 8, 0},
-            {9, 9, 0},
-            {9, 10, 0},
-            {9, 11, 0},
-            {7, 12, 0},
-            {7, 13, 0},
-            {7, 14, 0},
-            {7, 15, 0},
-            {6, 16, 0},
-            {6, 17, 0},
-            {6, 18, 0},
-            {6, 19, 0},
-            {9, 20, 0},
-            {15, 21, 0},
-            {15, 22, 0},
-            {52, 23, 0},
-            {57, 24, 0},
-            {51, 25, 0},
-            {51, 26, 0},
-            {51, 27, 0},
-            {42, 28, 0},
-            {42, 29, 0},
-            {45, 30, 0},
-            {45, 31, 0},
-            {44, 32, 0},
-            {44, 33, 0},
-            {44, 34, 0},
-            {14, 35, 0},
-            {9001, 36, 0},
-            {9001, 37, 0},
-            {9001, 38, 0},
-            {9001, 39, 0},
-            {9001, 40, 0},
-            {9001, 41, 0},
-            {9001, 42, 0},
-            {9001, 43, 0},
-            {140, 44, 0},
-            {140, 45, 0},
-            {10030, 46, 0},
-            {15, 47, 0},
-            {6, 48, 0},
-            {7, 49, 0},
-            {15, 50, 0},
-            {44, 51, 0},
-            {42, 52, 0},
-            {41, 53, 0},
-            {41, 54, 0},
-            {42, 55, 0},
-            {44, 56, 0},
-            {45, 57, 0},
-            {254, 58, 0},
-            {9001, 59, 0},
-            {9001, 60, 0},
-            {9001, 61, 0},
-            {9001, 62, 0},
-            {32, 63, 0},
-            {82, 64, 0},
-            {82, 65, 0},
-            {82, 66, 0},
-            {82, 67, 0},
-            {82, 68, 0},
-            {82, 69, 0},
-            {82, 70, 0},
-            {8000, 71, 0},
-            {8000, 72, 0},
-            {8000, 73, 0},
-            {8000, 74, 0},
-            {8000, 75, 0},
-            {8000, 76, 0},
-            {8000, 77, 0},
-            {8000, 78, 0},
-            {19, 79, 0},
-            {22, 80, 0},
-            {13, 81, 0},
-            {107, 82, 0},
-            {107, 83, 0},
-            {107, 84, 0},
-            {107, 85, 0},
-            {107, 86, 0},
-            {107, 87, 0},
-            {107, 88, 0},
-            {10060, 89, 0},
-            {10060, 90, 0},
-            {10060, 91, 0},
-            {10060, 92, 0},
-            {10060, 93, 0},
-            {10060, 94, 0},
-            {10030, 95, 0},
-            {10060, 96, 0},
-            {10060, 97, 0},
-            {10030, 98, 0},
-            {10030, 99, 0},
-            {10030, 100, 0},
-            {10030, 101, 0},
-            {10030, 102, 0},
-            {10030, 103, 0},
-            {31, 104, 0},
-            {31, 105, 0},
-            {31, 106, 0},
-            {31, 107, 0},
-            {31, 108, 0},
-            {10060, 109, 0},
-            {10060, 110, 0},
-            {10060, 111, 0},
-            {10060, 112, 0},
-            {10060, 113, 0},
-            {10060, 114, 0},
-            {10030, 115, 0},
-            {10030, 116, 0},
-            {10030, 117, 0},
-            {8080, 118, 0},
-            {8080, 119, 0},
-            {8080, 120, 0},
-            {8080, 121, 0},
-            {8080, 122, 0},
-            {8080, 123, 0},
-            {8080, 124, 0},
-            {10030, 125, 0},
-            {10030, 126, 0},
-            {10030, 127, 0},
-            {10030, 128, 0},
-            {10030, 129, 0},
-            {10030, 130, 0},
-            {10030, 131, 0},
-            {10030, 132, 0},
-            {10030, 133, 0},
-            {10030, 134, 0},
-            {10030, 135, 0},
-            {10030, 136, 0},
-            {10030, 137, 0},
-            {10030, 138, 0},
-            {10030, 139, 0},
-            {8080, 140, 0},
-            {8080, 141, 0},
-            {10030, 142, 0},
-            {10030, 143, 0},
-            {10030, 144, 0},
-            {10030, 145, 0},
-            {82, 146, 0},
-            {82, 147, 0},
-            {82, 148, 0},
-            {82, 149, 0},
-            {82, 150, 0},
-            {82, 151, 0},
-            {81, 152, 0},
-            {81, 153, 0},
-            {81, 154, 0},
-            {81, 155, 0},
-            {81, 156, 0},
-            {81, 157, 0},
-            {81, 158, 0},
-            {81, 159, 0},
-            {10030, 160, 0},
-            {10030, 161, 0},
-            {10030, 162, 0},
-            {9001, 163, 0},
-            {9001, 164, 0},
-            {9001, 165, 0},
-            {9001, 166, 0},
-            {81, 167, 0},
-            {81, 168, 0},
-            {81, 169, 0},
-            {81, 170, 0},
-            {81, 171, 0},
-            {81, 172, 0},
-            {81, 173, 0},
-            {81, 174, 0},
-            {81, 175, 0},
-            {81, 176, 0},
-            {81, 177, 0},
-            {81, 178, 0},
-            {122, 179, 0},
-            {122, 180, 0},
-            {122, 181, 0},
-            {124, 182, 0},
-            {124, 183, 0},
-            {124, 184, 0},
-            {124, 185, 0},
-            {122, 186, 0},
-            {8004, 187, 0},
-            {122, 188, 0},
-            {122, 189, 0},
-            {122, 190, 0},
-            {124, 191, 0},
-            {124, 192, 0},
-            {124, 193, 0},
-            {81, 194, 0},
-            {81, 195, 0},
-            {81, 196, 0},
-            {81, 197, 0},
-            {81, 198, 0},
-            {81, 199, 0},
-            {8004, 200, 0},
-            {8004, 201, 0},
-            {124, 202, 0},
-            {124, 203, 0},
-            {124, 204, 0},
-            {122, 205, 0},
-            {122, 206, 0},
-            {122, 207, 0},
-            {81, 208, 0},
-            {81, 209, 0},
-            {81, 210, 0},
-            {81, 211, 0},
-            {8004, 212, 0},
-            {124, 213, 0},
-            {124, 214, 0},
-            {124, 215, 0},
-            {122, 216, 0},
-            {122, 217, 0},
-            {122, 218, 0},
-            {2, 219, 0},
-            {3, 220, 0},
-            {4, 221, 0},
-            {8007, 222, 0},
-            {8006, 223, 0},
-            {8041, 224, 0},
-            {8008, 225, 0},
-            {8005, 226, 0},
-            {10040, 227, 0},
-            {36, 228, 0},
-            {10, 229, 0},
-            {20, 230, 0},
-            {16, 231, 0},
-            {23, 232, 0},
-            {19, 233, 0},
-            {13, 234, 0},
-            {22, 235, 0},
-            {8010, 236, 0},
-            {123, 237, 0},
-            {18, 238, 0},
-            {12, 239, 0},
-            {21, 240, 0},
-            {53, 241, 0},
-            {8040, 242, 0},
-            {11, 243, 0},
-            {11, 244, 0},
-            {11, 245, 0},
-            {11, 246, 0},
-            {84, 247, 0},
-            {83, 248, 0},
-            {9001, 249, 0},
-            {9001, 250, 0},
-            {9001, 251, 0},
-            {9001, 252, 0},
-            {9001, 253, 0},
-            {83, 254, 0},
-            {8080, 255, 0},
-            {8080, 256, 0},
-            {10060, 257, 0},
-            {10060, 258, 0},
-            {10060, 259, 0},
-            {10060, 260, 0},
-            {31, 261, 0},
-            {31, 262, 0},
-            {8009, 263, 0},
-            {84, 264, 0},
-            {10120, 265, 0},
-            {10120, 266, 0},
-            {10120, 267, 0},
-            {10120, 268, 0},
-            {10120, 269, 0},
-            {9100, 270, 0},
-            {9101, 271, 0},
-            {9102, 272, 0},
-            {9103, 273, 0},
-            {11, 274, 0},
-            {11, 275, 0},
-            {11, 276, 0},
-            {11, 277, 0},
-	}},
-        {"Shadow Wood", {false, false, false}, {0, 0, 0}, 8, 521, {
-            {1, 0, 0},
-            {79, 1, 0},
-            {78, 2, 0},
-            {79, 3, 0},
-            {3002, 4, 0},
-            {3002, 5, 0},
-            {3000, 6, 0},
-            {3000, 7, 0},
-            {1410, 8, 0},
-            {1410, 9, 0},
-            {122, 10, 0},
-            {122, 11, 0},
-            {122, 12, 0},
-            {122, 13, 0},
-            {82, 14, 0},
-            {82, 15, 0},
-            {122, 16, 0},
-            {101, 17, 0},
-            {101, 18, 0},
-            {102, 19, 0},
-            {102, 20, 0},
-            {78, 21, 0},
-            {79, 22, 0},
-            {79, 23, 0},
-            {79, 24, 0},
-            {79, 25, 0},
-            {79, 26, 0},
-            {79, 27, 0},
-            {79, 28, 0},
-            {79, 29, 0},
-            {79, 30, 0},
-            {8044, 31, 0},
-            {8044, 32, 0},
-            {8044, 33, 0},
-            {8044, 34, 0},
-            {99, 35, 0},
-            {100, 36, 0},
-            {100, 37, 0},
-            {102, 38, 0},
-            {102, 39, 0},
-            {101, 40, 0},
-            {101, 41, 0},
-            {106, 42, 0},
-            {106, 43, 0},
-            {9, 44, 0},
-            {97, 45, 0},
-            {97, 46, 0},
-            {42, 47, 0},
-            {42, 48, 0},
-            {8068, 49, 0},
-            {8068, 50, 0},
-            {8068, 51, 0},
-            {8068, 52, 0},
-            {8068, 53, 0},
-            {8068, 54, 0},
-            {8068, 55, 0},
-            {8068, 56, 0},
-            {101, 57, 0},
-            {102, 58, 0},
-            {8101, 59, 0},
-            {8101, 60, 0},
-            {8101, 61, 0},
-            {8101, 62, 0},
-            {8101, 63, 0},
-            {8102, 64, 0},
-            {97, 65, 0},
-            {59, 66, 0},
-            {59, 67, 0},
-            {59, 68, 0},
-            {59, 69, 0},
-            {58, 70, 0},
-            {58, 71, 0},
-            {58, 72, 0},
-            {57, 73, 0},
-            {57, 74, 0},
-            {98, 75, 0},
-            {8101, 76, 0},
-            {8101, 77, 0},
-            {8101, 78, 0},
-            {8101, 79, 0},
-            {8101, 80, 0},
-            {8102, 81, 0},
-            {46, 82, 0},
-            {46, 83, 0},
-            {46, 84, 0},
-            {46, 85, 0},
-            {46, 86, 0},
-            {71, 87, 0},
-            {71, 88, 0},
-            {71, 89, 0},
-            {8047, 90, 0},
-            {8047, 91, 0},
-            {111, 92, 0},
-            {111, 93, 0},
-            {111, 94, 0},
-            {54, 95, 0},
-            {119, 96, 0},
-            {8072, 97, 0},
-            {8072, 98, 0},
-            {8072, 99, 0},
-            {8073, 100, 0},
-            {8072, 101, 0},
-            {8072, 102, 0},
-            {8072, 103, 0},
-            {8072, 104, 0},
-            {8072, 105, 0},
-            {8072, 106, 0},
-            {8072, 107, 0},
-            {8072, 108, 0},
-            {8072, 109, 0},
-            {8072, 110, 0},
-            {8072, 111, 0},
-            {8072, 112, 0},
-            {8072, 113, 0},
-            {8072, 114, 0},
-            {8077, 115, 0},
-            {8076, 116, 0},
-            {8075, 117, 0},
-            {8076, 118, 0},
-            {8076, 119, 0},
-            {8072, 120, 0},
-            {8072, 121, 0},
-            {8077, 122, 0},
-            {8072, 123, 0},
-            {8072, 124, 0},
-            {8077, 125, 0},
-            {8072, 126, 0},
-            {8072, 127, 0},
-            {8077, 128, 0},
-            {8061, 129, 0},
-            {105, 130, 0},
-            {8061, 131, 0},
-            {8072, 132, 0},
-            {8072, 133, 0},
-            {8073, 134, 0},
-            {8074, 135, 0},
-            {54, 136, 0},
-            {54, 137, 0},
-            {54, 138, 0},
-            {111, 139, 0},
-            {8047, 140, 0},
-            {8047, 141, 0},
-            {105, 142, 0},
-            {105, 143, 0},
-            {110, 144, 0},
-            {110, 145, 0},
-            {119, 146, 0},
-            {3002, 147, 0},
-            {3002, 148, 0},
-            {3000, 149, 0},
-            {3000, 150, 0},
-            {9001, 151, 0},
-            {9001, 152, 0},
-            {9001, 153, 0},
-            {9001, 154, 0},
-            {9001, 155, 0},
-            {9001, 156, 0},
-            {9001, 157, 0},
-            {9001, 158, 0},
-            {9001, 159, 0},
-            {9001, 160, 0},
-            {9001, 161, 0},
-            {9001, 162, 0},
-            {9001, 163, 0},
-            {9001, 164, 0},
-            {9001, 165, 0},
-            {9001, 166, 0},
-            {9001, 167, 0},
-            {9001, 168, 0},
-            {107, 169, 0},
-            {107, 170, 0},
-            {107, 171, 0},
-            {107, 172, 0},
-            {107, 173, 0},
-            {10060, 174, 0},
-            {10060, 175, 0},
-            {10060, 176, 0},
-            {10060, 177, 0},
-            {31, 178, 0},
-            {121, 179, 0},
-            {121, 180, 0},
-            {121, 181, 0},
-            {121, 182, 0},
-            {10060, 183, 0},
-            {10060, 184, 0},
-            {10030, 185, 0},
-            {10030, 186, 0},
-            {10030, 187, 0},
-            {10030, 188, 0},
-            {10030, 189, 0},
-            {31, 190, 0},
-            {31, 191, 0},
-            {31, 192, 0},
-            {31, 193, 0},
-            {31, 194, 0},
-            {10060, 195, 0},
-            {107, 196, 0},
-            {10060, 197, 0},
-            {107, 198, 0},
-            {10060, 199, 0},
-            {10060, 200, 0},
-            {10030, 201, 0},
-            {10030, 202, 0},
-            {10030, 203, 0},
-            {31, 204, 0},
-            {31, 205, 0},
-            {107, 206, 0},
-            {107, 207, 0},
-            {107, 208, 0},
-            {8007, 209, 0},
-            {86, 210, 0},
-            {36, 211, 0},
-            {8041, 212, 0},
-            {8009, 213, 0},
-            {123, 214, 0},
-            {8040, 215, 0},
-            {81, 216, 0},
-            {81, 217, 0},
-            {81, 218, 0},
-            {81, 219, 0},
-            {81, 220, 0},
-            {81, 221, 0},
-            {81, 222, 0},
-            {81, 223, 0},
-            {81, 224, 0},
-            {81, 225, 0},
-            {81, 226, 0},
-            {81, 227, 0},
-            {81, 228, 0},
-            {81, 229, 0},
-            {81, 230, 0},
-            {81, 231, 0},
-            {81, 232, 0},
-            {81, 233, 0},
-            {81, 234, 0},
-            {81, 235, 0},
-            {81, 236, 0},
-            {81, 237, 0},
-            {81, 238, 0},
-            {81, 239, 0},
-            {81, 240, 0},
-            {81, 241, 0},
-            {81, 242, 0},
-            {81, 243, 0},
-            {81, 244, 0},
-            {81, 245, 0},
-            {81, 246, 0},
-            {81, 247, 0},
-            {82, 248, 0},
-            {82, 249, 0},
-            {82, 250, 0},
-            {82, 251, 0},
-            {82, 252, 0},
-            {82, 253, 0},
-            {82, 254, 0},
-            {82, 255, 0},
-            {82, 256, 0},
-            {82, 257, 0},
-            {82, 258, 0},
-            {82, 259, 0},
-            {82, 260, 0},
-            {82, 261, 0},
-            {82, 262, 0},
-            {82, 263, 0},
-            {82, 264, 0},
-            {82, 265, 0},
-            {82, 266, 0},
-            {82, 267, 0},
-            {124, 268, 0},
-            {124, 269, 0},
-            {124, 270, 0},
-            {122, 271, 0},
-            {122, 272, 0},
-            {122, 273, 0},
-            {122, 274, 0},
-            {122, 275, 0},
-            {122, 276, 0},
-            {122, 277, 0},
-            {124, 278, 0},
-            {124, 279, 0},
-            {124, 280, 0},
-            {124, 281, 0},
-            {122, 282, 0},
-            {122, 283, 0},
-            {122, 284, 0},
-            {124, 285, 0},
-            {124, 286, 0},
-            {122, 287, 0},
-            {122, 288, 0},
-            {124, 289, 0},
-            {124, 290, 0},
-            {124, 291, 0},
-            {122, 292, 0},
-            {122, 293, 0},
-            {122, 294, 0},
-            {124, 295, 0},
-            {124, 296, 0},
-            {8004, 297, 0},
-            {8004, 298, 0},
-            {8004, 299, 0},
-            {8004, 300, 0},
-            {8004, 301, 0},
-            {8004, 302, 0},
-            {8004, 303, 0},
-            {8004, 304, 0},
-            {8004, 305, 0},
-            {8004, 306, 0},
-            {107, 307, 0},
-            {107, 308, 0},
-            {107, 309, 0},
-            {107, 310, 0},
-            {10060, 311, 0},
-            {10060, 312, 0},
-            {122, 313, 0},
-            {122, 314, 0},
-            {122, 315, 0},
-            {124, 316, 0},
-            {124, 317, 0},
-            {124, 318, 0},
-            {8004, 319, 0},
-            {82, 320, 0},
-            {82, 321, 0},
-            {82, 322, 0},
-            {82, 323, 0},
-            {31, 324, 0},
-            {82, 325, 0},
-            {82, 326, 0},
-            {82, 327, 0},
-            {82, 328, 0},
-            {10060, 329, 0},
-            {32, 330, 0},
-            {107, 331, 0},
-            {121, 332, 0},
-            {121, 333, 0},
-            {10060, 334, 0},
-            {10060, 335, 0},
-            {10060, 336, 0},
-            {10060, 337, 0},
-            {10060, 338, 0},
-            {10060, 339, 0},
-            {121, 340, 0},
-            {1, 341, 0},
-            {2, 342, 0},
-            {3, 343, 0},
-            {4, 344, 0},
-            {3, 345, 0},
-            {4, 346, 0},
-            {1, 347, 0},
-            {2, 348, 0},
-            {4, 349, 0},
-            {3, 350, 0},
-            {2, 351, 0},
-            {1, 352, 0},
-            {3, 353, 0},
-            {4, 354, 0},
-            {1, 355, 0},
-            {2, 356, 0},
-            {4, 357, 0},
-            {3, 358, 0},
-            {2, 359, 0},
-            {1, 360, 0},
-            {9001, 361, 0},
-            {9001, 362, 0},
-            {9001, 363, 0},
-            {9001, 364, 0},
-            {9001, 365, 0},
-            {31, 366, 0},
-            {31, 367, 0},
-            {31, 368, 0},
-            {10060, 369, 0},
-            {10060, 370, 0},
-            {10060, 371, 0},
-            {10030, 372, 0},
-            {10030, 373, 0},
-            {10030, 374, 0},
-            {10030, 375, 0},
-            {10030, 376, 0},
-            {10030, 377, 0},
-            {10030, 378, 0},
-            {10030, 379, 0},
-            {10030, 380, 0},
-            {10060, 381, 0},
-            {10060, 382, 0},
-            {10030, 383, 0},
-            {10030, 384, 0},
-            {107, 385, 0},
-            {107, 386, 0},
-            {10060, 387, 0},
-            {10060, 388, 0},
-            {10060, 389, 0},
-            {10060, 390, 0},
-            {10060, 391, 0},
-            {10060, 392, 0},
-            {10060, 393, 0},
-            {10060, 394, 0},
-            {10060, 395, 0},
-            {10060, 396, 0},
-            {10060, 397, 0},
-            {10030, 398, 0},
-            {10030, 399, 0},
-            {10030, 400, 0},
-            {10030, 401, 0},
-            {10030, 402, 0},
-            {10030, 403, 0},
-            {10030, 404, 0},
-            {11, 405, 0},
-            {11, 406, 0},
-            {11, 407, 0},
-            {10060, 408, 0},
-            {10060, 409, 0},
-            {10060, 410, 0},
-            {10060, 411, 0},
-            {10060, 412, 0},
-            {32, 413, 0},
-            {2, 414, 0},
-            {3, 415, 0},
-            {4, 416, 0},
-            {11, 417, 0},
-            {10, 418, 0},
-            {8010, 419, 0},
-            {53, 420, 0},
-            {20, 421, 0},
-            {19, 422, 0},
-            {18, 423, 0},
-            {16, 424, 0},
-            {13, 425, 0},
-            {12, 426, 0},
-            {23, 427, 0},
-            {22, 428, 0},
-            {21, 429, 0},
-            {83, 430, 0},
-            {84, 431, 0},
-            {84, 432, 0},
-            {10120, 433, 0},
-            {10120, 434, 0},
-            {10120, 435, 0},
-            {10120, 436, 0},
-            {8004, 437, 0},
-            {8004, 438, 0},
-            {8004, 439, 0},
-            {8004, 440, 0},
-            {8004, 441, 0},
-            {8004, 442, 0},
-            {8004, 443, 0},
-            {8004, 444, 0},
-            {8004, 445, 0},
-            {8004, 446, 0},
-            {8004, 447, 0},
-            {8004, 448, 0},
-            {8004, 449, 0},
-            {8004, 450, 0},
-            {8004, 451, 0},
-            {8004, 452, 0},
-            {8004, 453, 0},
-            {8004, 454, 0},
-            {8004, 455, 0},
-            {8004, 456, 0},
-            {8004, 457, 0},
-            {8004, 458, 0},
-            {8004, 459, 0},
-            {8004, 460, 0},
-            {8004, 461, 0},
-            {8004, 462, 0},
-            {8004, 463, 0},
-            {8004, 464, 0},
-            {8004, 465, 0},
-            {8004, 466, 0},
-            {8004, 467, 0},
-            {8004, 468, 0},
-            {10, 469, 0},
-            {8010, 470, 0},
-            {53, 471, 0},
-            {10110, 472, 0},
-            {10110, 473, 0},
-            {10110, 474, 0},
-            {10110, 475, 0},
-            {10110, 476, 0},
-            {10110, 477, 0},
-            {10110, 478, 0},
-            {10110, 479, 0},
-            {10110, 480, 0},
-            {10110, 481, 0},
-            {10110, 482, 0},
-            {10110, 483, 0},
-            {10110, 484, 0},
-            {118, 485, 0},
-            {118, 486, 0},
-            {118, 487, 0},
-            {118, 488, 0},
-            {118, 489, 0},
-            {118, 490, 0},
-            {118, 491, 0},
-            {118, 492, 0},
-            {11, 493, 0},
-            {11, 494, 0},
-            {11, 495, 0},
-            {11, 496, 0},
-            {9100, 497, 0},
-            {9101, 498, 0},
-            {9102, 499, 0},
-            {9103, 500, 0},
-            {9100, 501, 0},
-            {9101, 502, 0},
-            {9102, 503, 0},
-            {9103, 504, 0},
-            {9100, 505, 0},
-            {9101, 506, 0},
-            {9102, 507, 0},
-            {9103, 508, 0},
-            {9100, 509, 0},
-            {9101, 510, 0},
-            {9102, 511, 0},
-            {9103, 512, 0},
-            {9100, 513, 0},
-            {9101, 514, 0},
-            {9102, 515, 0},
-            {9103, 516, 0},
-            {9100, 517, 0},
-            {9101, 518, 0},
-            {9102, 519, 0},
-            {9103, 520, 0},
-	}},
-    },
-    {
-        {"Heresiarch's Seminary", {false, false, false}, {0, 0, 0}, 6, 853, {
-            {1, 0, 0},
-            {3000, 1, 0},
-            {3000, 2, 0},
-            {3001, 3, 0},
-            {3001, 4, 0},
-            {3000, 5, 0},
-            {3002, 6, 0},
-            {3000, 7, 0},
-            {3000, 8, 0},
-            {3002, 9, 0},
-            {3002, 10, 0},
-            {3000, 11, 0},
-            {3001, 12, 0},
-            {3001, 13, 0},
-            {3001, 14, 0},
-            {3001, 15, 0},
-            {3000, 16, 0},
-            {3000, 17, 0},
-            {3000, 18, 0},
-            {115, 19, 0},
-            {107, 20, 0},
-            {107, 21, 0},
-            {107, 22, 0},
-            {107, 23, 0},
-            {107, 24, 0},
-            {1404, 25, 0},
-            {1404, 26, 0},
-            {1404, 27, 0},
-            {1404, 28, 0},
-            {1404, 29, 0},
-            {1404, 30, 0},
-            {9001, 31, 0},
-            {9001, 32, 0},
-            {9001, 33, 0},
-            {9001, 34, 0},
-            {9001, 35, 0},
-            {9001, 36, 0},
-            {9001, 37, 0},
-            {9001, 38, 0},
-            {9001, 39, 0},
-            {9001, 40, 0},
-            {9001, 41, 0},
-            {9001, 42, 0},
-            {14, 43, 0},
-            {14, 44, 0},
-            {9001, 45, 0},
-            {9001, 46, 0},
-            {9001, 47, 0},
-            {9001, 48, 0},
-            {9001, 49, 0},
-            {9001, 50, 0},
-            {9001, 51, 0},
-            {9001, 52, 0},
-            {9001, 53, 0},
-            {9001, 54, 0},
-            {9001, 55, 0},
-            {9001, 56, 0},
-            {9001, 57, 0},
-            {9001, 58, 0},
-            {9001, 59, 0},
-            {9001, 60, 0},
-            {9001, 61, 0},
-            {9001, 62, 0},
-            {9001, 63, 0},
-            {14, 64, 0},
-            {10080, 65, 0},
-            {77, 66, 0},
-            {9001, 67, 0},
-            {9001, 68, 0},
-            {9001, 69, 0},
-            {9001, 70, 0},
-            {31, 71, 0},
-            {31, 72, 0},
-            {31, 73, 0},
-            {31, 74, 0},
-            {84, 75, 0},
-            {117, 76, 0},
-            {117, 77, 0},
-            {117, 78, 0},
-            {117, 79, 0},
-            {117, 80, 0},
-            {117, 81, 0},
-            {117, 82, 0},
-            {117, 83, 0},
-            {117, 84, 0},
-            {117, 85, 0},
-            {117, 86, 0},
-            {117, 87, 0},
-            {117, 88, 0},
-            {117, 89, 0},
-            {117, 90, 0},
-            {117, 91, 0},
-            {117, 92, 0},
-            {117, 93, 0},
-            {117, 94, 0},
-            {117, 95, 0},
-            {117, 96, 0},
-            {117, 97, 0},
-            {117, 98, 0},
-            {117, 99, 0},
-            {117, 100, 0},
-            {117, 101, 0},
-            {117, 102, 0},
-            {117, 103, 0},
-            {117, 104, 0},
-            {117, 105, 0},
-            {117, 106, 0},
-            {117, 107, 0},
-            {18, 108, 0},
-            {12, 109, 0},
-            {21, 110, 0},
-            {77, 111, 0},
-            {77, 112, 0},
-            {77, 113, 0},
-            {77, 114, 0},
-            {77, 115, 0},
-            {77, 116, 0},
-            {87, 117, 0},
-            {87, 118, 0},
-            {80, 119, 0},
-            {80, 120, 0},
-            {80, 121, 0},
-            {8104, 122, 0},
-            {8104, 123, 0},
-            {8104, 124, 0},
-            {8104, 125, 0},
-            {8104, 126, 0},
-            {8104, 127, 0},
-            {101, 128, 0},
-            {101, 129, 0},
-            {101, 130, 0},
-            {102, 131, 0},
-            {102, 132, 0},
-            {103, 133, 0},
-            {103, 134, 0},
-            {77, 135, 0},
-            {77, 136, 0},
-            {116, 137, 0},
-            {116, 138, 0},
-            {54, 139, 0},
-            {54, 140, 0},
-            {54, 141, 0},
-            {54, 142, 0},
-            {54, 143, 0},
-            {54, 144, 0},
-            {54, 145, 0},
-            {54, 146, 0},
-            {54, 147, 0},
-            {54, 148, 0},
-            {54, 149, 0},
-            {54, 150, 0},
-            {54, 151, 0},
-            {54, 152, 0},
-            {109, 153, 0},
-            {108, 154, 0},
-            {77, 155, 0},
-            {77, 156, 0},
-            {77, 157, 0},
-            {77, 158, 0},
-            {77, 159, 0},
-            {77, 160, 0},
-            {77, 161, 0},
-            {103, 162, 0},
-            {103, 163, 0},
-            {116, 164, 0},
-            {116, 165, 0},
-            {116, 166, 0},
-            {116, 167, 0},
-            {103, 168, 0},
-            {103, 169, 0},
-            {103, 170, 0},
-            {103, 171, 0},
-            {119, 172, 0},
-            {119, 173, 0},
-            {119, 174, 0},
-            {119, 175, 0},
-            {119, 176, 0},
-            {119, 177, 0},
-            {119, 178, 0},
-            {119, 179, 0},
-            {119, 180, 0},
-            {119, 181, 0},
-            {77, 182, 0},
-            {77, 183, 0},
-            {54, 184, 0},
-            {54, 185, 0},
-            {54, 186, 0},
-            {54, 187, 0},
-            {103, 188, 0},
-            {103, 189, 0},
-            {77, 190, 0},
-            {77, 191, 0},
-            {77, 192, 0},
-            {77, 193, 0},
-            {77, 194, 0},
-            {77, 195, 0},
-            {77, 196, 0},
-            {77, 197, 0},
-            {116, 198, 0},
-            {116, 199, 0},
-            {103, 200, 0},
-            {103, 201, 0},
-            {77, 202, 0},
-            {77, 203, 0},
-            {54, 204, 0},
-            {54, 205, 0},
-            {54, 206, 0},
-            {54, 207, 0},
-            {54, 208, 0},
-            {54, 209, 0},
-            {54, 210, 0},
-            {54, 211, 0},
-            {54, 212, 0},
-            {8100, 213, 0},
-            {8100, 214, 0},
-            {8100, 215, 0},
-            {8100, 216, 0},
-            {8100, 217, 0},
-            {8100, 218, 0},
-            {8100, 219, 0},
-            {8100, 220, 0},
-            {8100, 221, 0},
-            {8100, 222, 0},
-            {29, 223, 0},
-            {28, 224, 0},
-            {28, 225, 0},
-            {80, 226, 0},
-            {80, 227, 0},
-            {80, 228, 0},
-            {80, 229, 0},
-            {8062, 230, 0},
-            {8062, 231, 0},
-            {104, 232, 0},
-            {104, 233, 0},
-            {104, 234, 0},
-            {104, 235, 0},
-            {104, 236, 0},
-            {105, 237, 0},
-            {105, 238, 0},
-            {105, 239, 0},
-            {105, 240, 0},
-            {105, 241, 0},
-            {105, 242, 0},
-            {105, 243, 0},
-            {105, 244, 0},
-            {105, 245, 0},
-            {105, 246, 0},
-            {104, 247, 0},
-            {104, 248, 0},
-            {104, 249, 0},
-            {104, 250, 0},
-            {104, 251, 0},
-            {104, 252, 0},
-            {105, 253, 0},
-            {105, 254, 0},
-            {106, 255, 0},
-            {106, 256, 0},
-            {106, 257, 0},
-            {106, 258, 0},
-            {106, 259, 0},
-            {106, 260, 0},
-            {106, 261, 0},
-            {116, 262, 0},
-            {116, 263, 0},
-            {116, 264, 0},
-            {116, 265, 0},
-            {116, 266, 0},
-            {116, 267, 0},
-            {116, 268, 0},
-            {116, 269, 0},
-            {5, 270, 0},
-            {5, 271, 0},
-            {54, 272, 0},
-            {54, 273, 0},
-            {54, 274, 0},
-            {54, 275, 0},
-            {54, 276, 0},
-            {54, 277, 0},
-            {103, 278, 0},
-            {103, 279, 0},
-            {71, 280, 0},
-            {108, 281, 0},
-            {109, 282, 0},
-            {62, 283, 0},
-            {62, 284, 0},
-            {62, 285, 0},
-            {110, 286, 0},
-            {77, 287, 0},
-            {103, 288, 0},
-            {103, 289, 0},
-            {108, 290, 0},
-            {109, 291, 0},
-            {71, 292, 0},
-            {71, 293, 0},
-            {111, 294, 0},
-            {111, 295, 0},
-            {111, 296, 0},
-            {110, 297, 0},
-            {110, 298, 0},
-            {62, 299, 0},
-            {62, 300, 0},
-            {62, 301, 0},
-            {62, 302, 0},
-            {110, 303, 0},
-            {110, 304, 0},
-            {71, 305, 0},
-            {17, 306, 0},
-            {8100, 307, 0},
-            {8100, 308, 0},
-            {8100, 309, 0},
-            {8100, 310, 0},
-            {8100, 311, 0},
-            {8100, 312, 0},
-            {8100, 313, 0},
-            {8100, 314, 0},
-            {54, 315, 0},
-            {54, 316, 0},
-            {54, 317, 0},
-            {54, 318, 0},
-            {54, 319, 0},
-            {54, 320, 0},
-            {54, 321, 0},
-            {5, 322, 0},
-            {5, 323, 0},
-            {5, 324, 0},
-            {5, 325, 0},
-            {103, 326, 0},
-            {103, 327, 0},
-            {110, 328, 0},
-            {110, 329, 0},
-            {110, 330, 0},
-            {110, 331, 0},
-            {62, 332, 0},
-            {62, 333, 0},
-            {62, 334, 0},
-            {100, 335, 0},
-            {102, 336, 0},
-            {71, 337, 0},
-            {71, 338, 0},
-            {71, 339, 0},
-            {71, 340, 0},
-            {71, 341, 0},
-            {116, 342, 0},
-            {116, 343, 0},
-            {8006, 344, 0},
-            {8002, 345, 0},
-            {83, 346, 0},
-            {10110, 347, 0},
-            {10110, 348, 0},
-            {10110, 349, 0},
-            {8000, 350, 0},
-            {8000, 351, 0},
-            {8000, 352, 0},
-            {8000, 353, 0},
-            {8000, 354, 0},
-            {8000, 355, 0},
-            {8000, 356, 0},
-            {8000, 357, 0},
-            {8000, 358, 0},
-            {8000, 359, 0},
-            {8000, 360, 0},
-            {8000, 361, 0},
-            {8000, 362, 0},
-            {8000, 363, 0},
-            {8000, 364, 0},
-            {8000, 365, 0},
-            {8000, 366, 0},
-            {8000, 367, 0},
-            {8000, 368, 0},
-            {8000, 369, 0},
-            {8000, 370, 0},
-            {8000, 371, 0},
-            {8000, 372, 0},
-            {10030, 373, 0},
-            {10030, 374, 0},
-            {10030, 375, 0},
-            {10030, 376, 0},
-            {10030, 377, 0},
-            {10030, 378, 0},
-            {8000, 379, 0},
-            {8000, 380, 0},
-            {8000, 381, 0},
-            {8000, 382, 0},
-            {8000, 383, 0},
-            {8000, 384, 0},
-            {8000, 385, 0},
-            {8000, 386, 0},
-            {31, 387, 0},
-            {31, 388, 0},
-            {31, 389, 0},
-            {31, 390, 0},
-            {10030, 391, 0},
-            {10030, 392, 0},
-            {10030, 393, 0},
-            {10030, 394, 0},
-            {31, 395, 0},
-            {114, 396, 0},
-            {114, 397, 0},
-            {114, 398, 0},
-            {114, 399, 0},
-            {114, 400, 0},
-            {114, 401, 0},
-            {114, 402, 0},
-            {114, 403, 0},
-            {114, 404, 0},
-            {114, 405, 0},
-            {114, 406, 0},
-            {114, 407, 0},
-            {114, 408, 0},
-            {114, 409, 0},
-            {114, 410, 0},
-            {114, 411, 0},
-            {114, 412, 0},
-            {114, 413, 0},
-            {114, 414, 0},
-            {114, 415, 0},
-            {114, 416, 0},
-            {114, 417, 0},
-            {114, 418, 0},
-            {115, 419, 0},
-            {115, 420, 0},
-            {107, 421, 0},
-            {107, 422, 0},
-            {107, 423, 0},
-            {107, 424, 0},
-            {31, 425, 0},
-            {31, 426, 0},
-            {31, 427, 0},
-            {10060, 428, 0},
-            {10060, 429, 0},
-            {10060, 430, 0},
-            {10060, 431, 0},
-            {10060, 432, 0},
-            {10060, 433, 0},
-            {114, 434, 0},
-            {114, 435, 0},
-            {114, 436, 0},
-            {114, 437, 0},
-            {10030, 438, 0},
-            {10030, 439, 0},
-            {10030, 440, 0},
-            {10030, 441, 0},
-            {10060, 442, 0},
-            {10060, 443, 0},
-            {10060, 444, 0},
-            {10060, 445, 0},
-            {31, 446, 0},
-            {31, 447, 0},
-            {31, 448, 0},
-            {114, 449, 0},
-            {114, 450, 0},
-            {114, 451, 0},
-            {114, 452, 0},
-            {114, 453, 0},
-            {114, 454, 0},
-            {114, 455, 0},
-            {114, 456, 0},
-            {31, 457, 0},
-            {31, 458, 0},
-            {10060, 459, 0},
-            {10060, 460, 0},
-            {10060, 461, 0},
-            {10060, 462, 0},
-            {10030, 463, 0},
-            {10030, 464, 0},
-            {10030, 465, 0},
-            {31, 466, 0},
-            {31, 467, 0},
-            {31, 468, 0},
-            {31, 469, 0},
-            {11, 470, 0},
-            {11, 471, 0},
-            {11, 472, 0},
-            {11, 473, 0},
-            {124, 474, 0},
-            {124, 475, 0},
-            {124, 476, 0},
-            {124, 477, 0},
-            {124, 478, 0},
-            {124, 479, 0},
-            {8004, 480, 0},
-            {81, 481, 0},
-            {81, 482, 0},
-            {81, 483, 0},
-            {81, 484, 0},
-            {81, 485, 0},
-            {81, 486, 0},
-            {10110, 487, 0},
-            {10110, 488, 0},
-            {10110, 489, 0},
-            {10110, 490, 0},
-            {10110, 491, 0},
-            {10110, 492, 0},
-            {10110, 493, 0},
-            {10110, 494, 0},
-            {10110, 495, 0},
-            {10110, 496, 0},
-            {81, 497, 0},
-            {81, 498, 0},
-            {81, 499, 0},
-            {81, 500, 0},
-            {124, 501, 0},
-            {124, 502, 0},
-            {124, 503, 0},
-            {124, 504, 0},
-            {81, 505, 0},
-            {81, 506, 0},
-            {81, 507, 0},
-            {81, 508, 0},
-            {122, 509, 0},
-            {122, 510, 0},
-            {122, 511, 0},
-            {8004, 512, 0},
-            {81, 513, 0},
-            {81, 514, 0},
-            {81, 515, 0},
-            {81, 516, 0},
-            {81, 517, 0},
-            {81, 518, 0},
-            {81, 519, 0},
-            {124, 520, 0},
-            {124, 521, 0},
-            {124, 522, 0},
-            {124, 523, 0},
-            {122, 524, 0},
-            {122, 525, 0},
-            {122, 526, 0},
-            {122, 527, 0},
-            {82, 528, 0},
-            {82, 529, 0},
-            {82, 530, 0},
-            {82, 531, 0},
-            {10110, 532, 0},
-            {10110, 533, 0},
-            {8004, 534, 0},
-            {122, 535, 0},
-            {122, 536, 0},
-            {122, 537, 0},
-            {124, 538, 0},
-            {124, 539, 0},
-            {124, 540, 0},
-            {81, 541, 0},
-            {81, 542, 0},
-            {81, 543, 0},
-            {81, 544, 0},
-            {81, 545, 0},
-            {81, 546, 0},
-            {10110, 547, 0},
-            {10110, 548, 0},
-            {10110, 549, 0},
-            {122, 550, 0},
-            {122, 551, 0},
-            {122, 552, 0},
-            {122, 553, 0},
-            {124, 554, 0},
-            {124, 555, 0},
-            {124, 556, 0},
-            {124, 557, 0},
-            {124, 558, 0},
-            {124, 559, 0},
-            {124, 560, 0},
-            {124, 561, 0},
-            {87, 562, 0},
-            {80, 563, 0},
-            {80, 564, 0},
-            {87, 565, 0},
-            {7, 566, 0},
-            {7, 567, 0},
-            {6, 568, 0},
-            {9, 569, 0},
-            {15, 570, 0},
-            {15, 571, 0},
-            {2, 572, 0},
-            {3, 573, 0},
-            {4, 574, 0},
-            {1, 575, 0},
-            {2, 576, 0},
-            {3, 577, 0},
-            {4, 578, 0},
-            {1, 579, 0},
-            {2, 580, 0},
-            {4, 581, 0},
-            {3, 582, 0},
-            {1, 583, 0},
-            {2, 584, 0},
-            {3, 585, 0},
-            {4, 586, 0},
-            {1, 587, 0},
-            {2, 588, 0},
-            {3, 589, 0},
-            {4, 590, 0},
-            {82, 591, 0},
-            {82, 592, 0},
-            {82, 593, 0},
-            {82, 594, 0},
-            {82, 595, 0},
-            {82, 596, 0},
-            {82, 597, 0},
-            {82, 598, 0},
-            {82, 599, 0},
-            {82, 600, 0},
-            {82, 601, 0},
-            {82, 602, 0},
-            {82, 603, 0},
-            {82, 604, 0},
-            {81, 605, 0},
-            {81, 606, 0},
-            {81, 607, 0},
-            {81, 608, 0},
-            {81, 609, 0},
-            {81, 610, 0},
-            {81, 611, 0},
-            {81, 612, 0},
-            {81, 613, 0},
-            {81, 614, 0},
-            {81, 615, 0},
-            {81, 616, 0},
-            {81, 617, 0},
-            {81, 618, 0},
-            {81, 619, 0},
-            {81, 620, 0},
-            {81, 621, 0},
-            {81, 622, 0},
-            {81, 623, 0},
-            {81, 624, 0},
-            {84, 625, 0},
-            {31, 626, 0},
-            {31, 627, 0},
-            {31, 628, 0},
-            {31, 629, 0},
-            {31, 630, 0},
-            {31, 631, 0},
-            {31, 632, 0},
-            {31, 633, 0},
-            {107, 634, 0},
-            {107, 635, 0},
-            {107, 636, 0},
-            {107, 637, 0},
-            {107, 638, 0},
-            {10080, 639, 0},
-            {8007, 640, 0},
-            {8041, 641, 0},
-            {8005, 642, 0},
-            {8008, 643, 0},
-            {10, 644, 0},
-            {8010, 645, 0},
-            {53, 646, 0},
-            {9001, 647, 0},
-            {9001, 648, 0},
-            {9001, 649, 0},
-            {9001, 650, 0},
-            {107, 651, 0},
-            {107, 652, 0},
-            {31, 653, 0},
-            {31, 654, 0},
-            {31, 655, 0},
-            {31, 656, 0},
-            {31, 657, 0},
-            {31, 658, 0},
-            {114, 659, 0},
-            {10060, 660, 0},
-            {10060, 661, 0},
-            {10060, 662, 0},
-            {31, 663, 0},
-            {31, 664, 0},
-            {31, 665, 0},
-            {10030, 666, 0},
-            {107, 667, 0},
-            {115, 668, 0},
-            {31, 669, 0},
-            {31, 670, 0},
-            {31, 671, 0},
-            {10060, 672, 0},
-            {10060, 673, 0},
-            {10060, 674, 0},
-            {10030, 675, 0},
-            {10030, 676, 0},
-            {10030, 677, 0},
-            {10030, 678, 0},
-            {10030, 679, 0},
-            {10030, 680, 0},
-            {10060, 681, 0},
-            {10060, 682, 0},
-            {10060, 683, 0},
-            {10060, 684, 0},
-            {10060, 685, 0},
-            {10060, 686, 0},
-            {114, 687, 0},
-            {114, 688, 0},
-            {114, 689, 0},
-            {114, 690, 0},
-            {114, 691, 0},
-            {114, 692, 0},
-            {107, 693, 0},
-            {107, 694, 0},
-            {10060, 695, 0},
-            {10060, 696, 0},
-            {10060, 697, 0},
-            {10060, 698, 0},
-            {10030, 699, 0},
-            {10030, 700, 0},
-            {114, 701, 0},
-            {114, 702, 0},
-            {114, 703, 0},
-            {114, 704, 0},
-            {114, 705, 0},
-            {10030, 706, 0},
-            {10030, 707, 0},
-            {10030, 708, 0},
-            {10030, 709, 0},
-            {10030, 710, 0},
-            {10120, 711, 0},
-            {10120, 712, 0},
-            {10120, 713, 0},
-            {10120, 714, 0},
-            {10120, 715, 0},
-            {122, 716, 0},
-            {122, 717, 0},
-            {122, 718, 0},
-            {122, 719, 0},
-            {124, 720, 0},
-            {124, 721, 0},
-            {124, 722, 0},
-            {124, 723, 0},
-            {124, 724, 0},
-            {124, 725, 0},
-            {124, 726, 0},
-            {124, 727, 0},
-            {124, 728, 0},
-            {124, 729, 0},
-            {122, 730, 0},
-            {122, 731, 0},
-            {122, 732, 0},
-            {122, 733, 0},
-            {122, 734, 0},
-            {122, 735, 0},
-            {122, 736, 0},
-            {122, 737, 0},
-            {122, 738, 0},
-            {122, 739, 0},
-            {122, 740, 0},
-            {122, 741, 0},
-            {8004, 742, 0},
-            {8004, 743, 0},
-            {8004, 744, 0},
-            {8004, 745, 0},
-            {8004, 746, 0},
-            {8004, 747, 0},
-            {8004, 748, 0},
-            {8004, 749, 0},
-            {8004, 750, 0},
-            {8004, 751, 0},
-            {8004, 752, 0},
-            {122, 753, 0},
-            {122, 754, 0},
-            {122, 755, 0},
-            {122, 756, 0},
-            {122, 757, 0},
-            {122, 758, 0},
-            {122, 759, 0},
-            {122, 760, 0},
-            {122, 761, 0},
-            {122, 762, 0},
-            {122, 763, 0},
-            {122, 764, 0},
-            {124, 765, 0},
-            {124, 766, 0},
-            {124, 767, 0},
-            {124, 768, 0},
-            {124, 769, 0},
-            {124, 770, 0},
-            {124, 771, 0},
-            {124, 772, 0},
-            {124, 773, 0},
-            {124, 774, 0},
-            {124, 775, 0},
-            {124, 776, 0},
-            {9001, 777, 0},
-            {8004, 778, 0},
-            {8004, 779, 0},
-            {8004, 780, 0},
-            {8004, 781, 0},
-            {8004, 782, 0},
-            {8004, 783, 0},
-            {8004, 784, 0},
-            {8004, 785, 0},
-            {8004, 786, 0},
-            {8004, 787, 0},
-            {8004, 788, 0},
-            {8004, 789, 0},
-            {8004, 790, 0},
-            {8004, 791, 0},
-            {8004, 792, 0},
-            {8004, 793, 0},
-            {8004, 794, 0},
-            {8004, 795, 0},
-            {8004, 796, 0},
-            {8004, 797, 0},
-            {8004, 798, 0},
-            {8004, 799, 0},
-            {8004, 800, 0},
-            {8004, 801, 0},
-            {8004, 802, 0},
-            {8004, 803, 0},
-            {8004, 804, 0},
-            {8004, 805, 0},
-            {8004, 806, 0},
-            {8004, 807, 0},
-            {8004, 808, 0},
-            {8004, 809, 0},
-            {8004, 810, 0},
-            {8004, 811, 0},
-            {8004, 812, 0},
-            {8004, 813, 0},
-            {8004, 814, 0},
-            {8004, 815, 0},
-            {8004, 816, 0},
-            {8004, 817, 0},
-            {10, 818, 0},
-            {8010, 819, 0},
-            {53, 820, 0},
-            {8009, 821, 0},
-            {123, 822, 0},
-            {8040, 823, 0},
-            {8009, 824, 0},
-            {123, 825, 0},
-            {8040, 826, 0},
-            {20, 827, 0},
-            {23, 828, 0},
-            {16, 829, 0},
-            {19, 830, 0},
-            {13, 831, 0},
-            {22, 832, 0},
-            {11, 833, 0},
-            {11, 834, 0},
-            {11, 835, 0},
-            {11, 836, 0},
-            {9100, 837, 0},
-            {9101, 838, 0},
-            {9102, 839, 0},
-            {9103, 840, 0},
-            {9100, 841, 0},
-            {9101, 842, 0},
-            {9102, 843, 0},
-            {9103, 844, 0},
-            {9100, 845, 0},
-            {9101, 846, 0},
-            {9102, 847, 0},
-            {9103, 848, 0},
-            {9100, 849, 0},
-            {9101, 850, 0},
-            {9102, 851, 0},
-            {9103, 852, 0},
-	}},
-        {"Dragon Chapel", {false, false, false}, {0, 0, 0}, 4, 331, {
-            {3002, 0, 0},
-            {3002, 1, 0},
-            {3002, 2, 0},
-            {3002, 3, 0},
-            {3000, 4, 0},
-            {3000, 5, 0},
-            {3000, 6, 0},
-            {3000, 7, 0},
-            {3000, 8, 0},
-            {3000, 9, 0},
-            {3000, 10, 0},
-            {3000, 11, 0},
-            {3001, 12, 0},
-            {3001, 13, 0},
-            {3001, 14, 0},
-            {3001, 15, 0},
-            {1, 16, 0},
-            {1406, 17, 0},
-            {10060, 18, 0},
-            {10060, 19, 0},
-            {116, 20, 0},
-            {116, 21, 0},
-            {116, 22, 0},
-            {116, 23, 0},
-            {81, 24, 0},
-            {81, 25, 0},
-            {81, 26, 0},
-            {81, 27, 0},
-            {77, 28, 0},
-            {77, 29, 0},
-            {77, 30, 0},
-            {77, 31, 0},
-            {116, 32, 0},
-            {116, 33, 0},
-            {116, 34, 0},
-            {116, 35, 0},
-            {116, 36, 0},
-            {116, 37, 0},
-            {116, 38, 0},
-            {54, 39, 0},
-            {54, 40, 0},
-            {54, 41, 0},
-            {54, 42, 0},
-            {54, 43, 0},
-            {54, 44, 0},
-            {54, 45, 0},
-            {54, 46, 0},
-            {54, 47, 0},
-            {54, 48, 0},
-            {116, 49, 0},
-            {116, 50, 0},
-            {116, 51, 0},
-            {116, 52, 0},
-            {116, 53, 0},
-            {116, 54, 0},
-            {9001, 55, 0},
-            {110, 56, 0},
-            {110, 57, 0},
-            {110, 58, 0},
-            {110, 59, 0},
-            {8060, 60, 0},
-            {8060, 61, 0},
-            {8060, 62, 0},
-            {8060, 63, 0},
-            {8060, 64, 0},
-            {8060, 65, 0},
-            {8060, 66, 0},
-            {8060, 67, 0},
-            {8060, 68, 0},
-            {8060, 69, 0},
-            {8060, 70, 0},
-            {8060, 71, 0},
-            {8060, 72, 0},
-            {8060, 73, 0},
-            {8060, 74, 0},
-            {8060, 75, 0},
-            {119, 76, 0},
-            {119, 77, 0},
-            {119, 78, 0},
-            {119, 79, 0},
-            {119, 80, 0},
-            {119, 81, 0},
-            {119, 82, 0},
-            {119, 83, 0},
-            {119, 84, 0},
-            {119, 85, 0},
-            {117, 86, 0},
-            {117, 87, 0},
-            {117, 88, 0},
-            {117, 89, 0},
-            {117, 90, 0},
-            {117, 91, 0},
-            {117, 92, 0},
-            {117, 93, 0},
-            {119, 94, 0},
-            {119, 95, 0},
-            {119, 96, 0},
-            {119, 97, 0},
-            {119, 98, 0},
-            {119, 99, 0},
-            {116, 100, 0},
-            {116, 101, 0},
-            {116, 102, 0},
-            {116, 103, 0},
-            {32, 104, 0},
-            {10110, 105, 0},
-            {8000, 106, 0},
-            {8000, 107, 0},
-            {8000, 108, 0},
-            {8000, 109, 0},
-            {8000, 110, 0},
-            {8000, 111, 0},
-            {8000, 112, 0},
-            {8000, 113, 0},
-            {8000, 114, 0},
-            {115, 115, 0},
-            {115, 116, 0},
-            {115, 117, 0},
-            {115, 118, 0},
-            {120, 119, 0},
-            {120, 120, 0},
-            {121, 121, 0},
-            {10060, 122, 0},
-            {10060, 123, 0},
-            {10060, 124, 0},
-            {10060, 125, 0},
-            {10060, 126, 0},
-            {10060, 127, 0},
-            {10030, 128, 0},
-            {10030, 129, 0},
-            {10030, 130, 0},
-            {10030, 131, 0},
-            {10030, 132, 0},
-            {10030, 133, 0},
-            {31, 134, 0},
-            {31, 135, 0},
-            {114, 136, 0},
-            {114, 137, 0},
-            {114, 138, 0},
-            {114, 139, 0},
-            {114, 140, 0},
-            {114, 141, 0},
-            {114, 142, 0},
-            {114, 143, 0},
-            {114, 144, 0},
-            {114, 145, 0},
-            {10030, 146, 0},
-            {10030, 147, 0},
-            {10030, 148, 0},
-            {10030, 149, 0},
-            {10030, 150, 0},
-            {115, 151, 0},
-            {115, 152, 0},
-            {115, 153, 0},
-            {115, 154, 0},
-            {114, 155, 0},
-            {114, 156, 0},
-            {114, 157, 0},
-            {114, 158, 0},
-            {10030, 159, 0},
-            {10030, 160, 0},
-            {10030, 161, 0},
-            {10030, 162, 0},
-            {10030, 163, 0},
-            {10030, 164, 0},
-            {10030, 165, 0},
-            {114, 166, 0},
-            {114, 167, 0},
-            {11, 168, 0},
-            {11, 169, 0},
-            {11, 170, 0},
-            {11, 171, 0},
-            {11, 172, 0},
-            {11, 173, 0},
-            {10110, 174, 0},
-            {10110, 175, 0},
-            {10110, 176, 0},
-            {10110, 177, 0},
-            {10110, 178, 0},
-            {10110, 179, 0},
-            {10110, 180, 0},
-            {10110, 181, 0},
-            {8000, 182, 0},
-            {8000, 183, 0},
-            {8000, 184, 0},
-            {8000, 185, 0},
-            {8000, 186, 0},
-            {8000, 187, 0},
-            {8000, 188, 0},
-            {8000, 189, 0},
-            {81, 190, 0},
-            {81, 191, 0},
-            {81, 192, 0},
-            {81, 193, 0},
-            {124, 194, 0},
-            {124, 195, 0},
-            {124, 196, 0},
-            {124, 197, 0},
-            {122, 198, 0},
-            {122, 199, 0},
-            {122, 200, 0},
-            {122, 201, 0},
-            {8004, 202, 0},
-            {82, 203, 0},
-            {82, 204, 0},
-            {82, 205, 0},
-            {82, 206, 0},
-            {124, 207, 0},
-            {124, 208, 0},
-            {122, 209, 0},
-            {122, 210, 0},
-            {122, 211, 0},
-            {122, 212, 0},
-            {122, 213, 0},
-            {122, 214, 0},
-            {122, 215, 0},
-            {122, 216, 0},
-            {124, 217, 0},
-            {124, 218, 0},
-            {124, 219, 0},
-            {124, 220, 0},
-            {124, 221, 0},
-            {124, 222, 0},
-            {82, 223, 0},
-            {82, 224, 0},
-            {82, 225, 0},
-            {82, 226, 0},
-            {81, 227, 0},
-            {81, 228, 0},
-            {81, 229, 0},
-            {81, 230, 0},
-            {81, 231, 0},
-            {81, 232, 0},
-            {81, 233, 0},
-            {81, 234, 0},
-            {122, 235, 0},
-            {122, 236, 0},
-            {122, 237, 0},
-            {122, 238, 0},
-            {122, 239, 0},
-            {124, 240, 0},
-            {124, 241, 0},
-            {124, 242, 0},
-            {124, 243, 0},
-            {124, 244, 0},
-            {82, 245, 0},
-            {82, 246, 0},
-            {82, 247, 0},
-            {82, 248, 0},
-            {82, 249, 0},
-            {2, 250, 0},
-            {3, 251, 0},
-            {4, 252, 0},
-            {8010, 253, 0},
-            {10, 254, 0},
-            {53, 255, 0},
-            {8009, 256, 0},
-            {123, 257, 0},
-            {8040, 258, 0},
-            {20, 259, 0},
-            {19, 260, 0},
-            {18, 261, 0},
-            {16, 262, 0},
-            {13, 263, 0},
-            {12, 264, 0},
-            {23, 265, 0},
-            {22, 266, 0},
-            {21, 267, 0},
-            {9001, 268, 0},
-            {9001, 269, 0},
-            {9001, 270, 0},
-            {9001, 271, 0},
-            {9001, 272, 0},
-            {10060, 273, 0},
-            {10060, 274, 0},
-            {10060, 275, 0},
-            {10060, 276, 0},
-            {120, 277, 0},
-            {114, 278, 0},
-            {114, 279, 0},
-            {114, 280, 0},
-            {114, 281, 0},
-            {115, 282, 0},
-            {115, 283, 0},
-            {115, 284, 0},
-            {115, 285, 0},
-            {114, 286, 0},
-            {114, 287, 0},
-            {114, 288, 0},
-            {10030, 289, 0},
-            {10030, 290, 0},
-            {10030, 291, 0},
-            {10030, 292, 0},
-            {10030, 293, 0},
-            {10030, 294, 0},
-            {107, 295, 0},
-            {107, 296, 0},
-            {107, 297, 0},
-            {10060, 298, 0},
-            {10060, 299, 0},
-            {10060, 300, 0},
-            {114, 301, 0},
-            {114, 302, 0},
-            {114, 303, 0},
-            {114, 304, 0},
-            {114, 305, 0},
-            {114, 306, 0},
-            {114, 307, 0},
-            {10030, 308, 0},
-            {10030, 309, 0},
-            {10030, 310, 0},
-            {10030, 311, 0},
-            {10030, 312, 0},
-            {84, 313, 0},
-            {84, 314, 0},
-            {10120, 315, 0},
-            {10120, 316, 0},
-            {10120, 317, 0},
-            {10120, 318, 0},
-            {124, 319, 0},
-            {124, 320, 0},
-            {122, 321, 0},
-            {122, 322, 0},
-            {122, 323, 0},
-            {122, 324, 0},
-            {9100, 325, 0},
-            {9101, 326, 0},
-            {9102, 327, 0},
-            {9103, 328, 0},
-            {11, 329, 0},
-            {11, 330, 0},
-	}},
-        {"Griffin Chapel", {false, false, false}, {0, 0, 0}, 8, 300, {
-            {3000, 0, 0},
-            {3000, 1, 0},
-            {3000, 2, 0},
-            {3000, 3, 0},
-            {3000, 4, 0},
-            {3000, 5, 0},
-            {3000, 6, 0},
-            {3000, 7, 0},
-            {3000, 8, 0},
-            {3000, 9, 0},
-            {3000, 10, 0},
-            {3000, 11, 0},
-            {3002, 12, 0},
-            {3002, 13, 0},
-            {3002, 14, 0},
-            {3002, 15, 0},
-            {3002, 16, 0},
-            {3002, 17, 0},
-            {3002, 18, 0},
-            {3002, 19, 0},
-            {3002, 20, 0},
-            {3002, 21, 0},
-            {3002, 22, 0},
-            {3002, 23, 0},
-            {1, 24, 0},
-            {77, 25, 0},
-            {9001, 26, 0},
-            {9001, 27, 0},
-            {9001, 28, 0},
-            {9001, 29, 0},
-            {9001, 30, 0},
-            {9001, 31, 0},
-            {9001, 32, 0},
-            {9001, 33, 0},
-            {9001, 34, 0},
-            {9001, 35, 0},
-            {9001, 36, 0},
-            {9001, 37, 0},
-            {9001, 38, 0},
-            {9001, 39, 0},
-            {9001, 40, 0},
-            {9001, 41, 0},
-            {9001, 42, 0},
-            {9001, 43, 0},
-            {9001, 44, 0},
-            {9001, 45, 0},
-            {9001, 46, 0},
-            {9001, 47, 0},
-            {9001, 48, 0},
-            {31, 49, 0},
-            {14, 50, 0},
-            {140, 51, 0},
-            {14, 52, 0},
-            {140, 53, 0},
-            {31, 54, 0},
-            {31, 55, 0},
-            {114, 56, 0},
-            {114, 57, 0},
-            {114, 58, 0},
-            {114, 59, 0},
-            {8006, 60, 0},
-            {31, 61, 0},
-            {115, 62, 0},
-            {116, 63, 0},
-            {116, 64, 0},
-            {54, 65, 0},
-            {54, 66, 0},
-            {103, 67, 0},
-            {103, 68, 0},
-            {103, 69, 0},
-            {103, 70, 0},
-            {54, 71, 0},
-            {54, 72, 0},
-            {54, 73, 0},
-            {54, 74, 0},
-            {54, 75, 0},
-            {54, 76, 0},
-            {77, 77, 0},
-            {77, 78, 0},
-            {77, 79, 0},
-            {77, 80, 0},
-            {103, 81, 0},
-            {103, 82, 0},
-            {103, 83, 0},
-            {54, 84, 0},
-            {54, 85, 0},
-            {5, 86, 0},
-            {111, 87, 0},
-            {111, 88, 0},
-            {111, 89, 0},
-            {111, 90, 0},
-            {71, 91, 0},
-            {71, 92, 0},
-            {71, 93, 0},
-            {71, 94, 0},
-            {71, 95, 0},
-            {61, 96, 0},
-            {61, 97, 0},
-            {108, 98, 0},
-            {108, 99, 0},
-            {108, 100, 0},
-            {108, 101, 0},
-            {109, 102, 0},
-            {109, 103, 0},
-            {109, 104, 0},
-            {109, 105, 0},
-            {109, 106, 0},
-            {110, 107, 0},
-            {110, 108, 0},
-            {110, 109, 0},
-            {62, 110, 0},
-            {104, 111, 0},
-            {106, 112, 0},
-            {105, 113, 0},
-            {105, 114, 0},
-            {104, 115, 0},
-            {103, 116, 0},
-            {103, 117, 0},
-            {10110, 118, 0},
-            {36, 119, 0},
-            {8000, 120, 0},
-            {8000, 121, 0},
-            {8000, 122, 0},
-            {8000, 123, 0},
-            {8000, 124, 0},
-            {8000, 125, 0},
-            {8000, 126, 0},
-            {8000, 127, 0},
-            {31, 128, 0},
-            {10030, 129, 0},
-            {10030, 130, 0},
-            {10030, 131, 0},
-            {10030, 132, 0},
-            {31, 133, 0},
-            {31, 134, 0},
-            {31, 135, 0},
-            {31, 136, 0},
-            {10060, 137, 0},
-            {10060, 138, 0},
-            {10060, 139, 0},
-            {10060, 140, 0},
-            {10060, 141, 0},
-            {10060, 142, 0},
-            {10060, 143, 0},
-            {10060, 144, 0},
-            {10030, 145, 0},
-            {10030, 146, 0},
-            {10030, 147, 0},
-            {10030, 148, 0},
-            {10030, 149, 0},
-            {10030, 150, 0},
-            {10030, 151, 0},
-            {10030, 152, 0},
-            {10030, 153, 0},
-            {10030, 154, 0},
-            {10030, 155, 0},
-            {10030, 156, 0},
-            {114, 157, 0},
-            {114, 158, 0},
-            {114, 159, 0},
-            {115, 160, 0},
-            {115, 161, 0},
-            {31, 162, 0},
-            {10030, 163, 0},
-            {10030, 164, 0},
-            {10030, 165, 0},
-            {10030, 166, 0},
-            {10030, 167, 0},
-            {11, 168, 0},
-            {11, 169, 0},
-            {11, 170, 0},
-            {11, 171, 0},
-            {10110, 172, 0},
-            {10110, 173, 0},
-            {10110, 174, 0},
-            {10110, 175, 0},
-            {8000, 176, 0},
-            {8000, 177, 0},
-            {8000, 178, 0},
-            {8000, 179, 0},
-            {8000, 180, 0},
-            {81, 181, 0},
-            {81, 182, 0},
-            {81, 183, 0},
-            {81, 184, 0},
-            {81, 185, 0},
-            {81, 186, 0},
-            {124, 187, 0},
-            {124, 188, 0},
-            {124, 189, 0},
-            {122, 190, 0},
-            {122, 191, 0},
-            {122, 192, 0},
-            {33, 193, 0},
-            {82, 194, 0},
-            {21, 195, 0},
-            {81, 196, 0},
-            {81, 197, 0},
-            {81, 198, 0},
-            {81, 199, 0},
-            {81, 200, 0},
-            {81, 201, 0},
-            {81, 202, 0},
-            {81, 203, 0},
-            {81, 204, 0},
-            {81, 205, 0},
-            {81, 206, 0},
-            {81, 207, 0},
-            {82, 208, 0},
-            {122, 209, 0},
-            {122, 210, 0},
-            {124, 211, 0},
-            {124, 212, 0},
-            {124, 213, 0},
-            {124, 214, 0},
-            {122, 215, 0},
-            {122, 216, 0},
-            {30, 217, 0},
-            {81, 218, 0},
-            {81, 219, 0},
-            {81, 220, 0},
-            {8004, 221, 0},
-            {10060, 222, 0},
-            {10060, 223, 0},
-            {10060, 224, 0},
-            {10060, 225, 0},
-            {2, 226, 0},
-            {3, 227, 0},
-            {4, 228, 0},
-            {8007, 229, 0},
-            {8005, 230, 0},
-            {8008, 231, 0},
-            {83, 232, 0},
-            {123, 233, 0},
-            {8010, 234, 0},
-            {10, 235, 0},
-            {53, 236, 0},
-            {8009, 237, 0},
-            {8040, 238, 0},
-            {9001, 239, 0},
-            {9001, 240, 0},
-            {9001, 241, 0},
-            {9001, 242, 0},
-            {9001, 243, 0},
-            {10060, 244, 0},
-            {10060, 245, 0},
-            {10060, 246, 0},
-            {10060, 247, 0},
-            {31, 248, 0},
-            {31, 249, 0},
-            {10030, 250, 0},
-            {10030, 251, 0},
-            {10030, 252, 0},
-            {10030, 253, 0},
-            {31, 254, 0},
-            {31, 255, 0},
-            {31, 256, 0},
-            {10060, 257, 0},
-            {10060, 258, 0},
-            {10060, 259, 0},
-            {10060, 260, 0},
-            {10060, 261, 0},
-            {10060, 262, 0},
-            {10060, 263, 0},
-            {10060, 264, 0},
-            {82, 265, 0},
-            {84, 266, 0},
-            {84, 267, 0},
-            {10120, 268, 0},
-            {10120, 269, 0},
-            {10120, 270, 0},
-            {122, 271, 0},
-            {122, 272, 0},
-            {122, 273, 0},
-            {122, 274, 0},
-            {122, 275, 0},
-            {122, 276, 0},
-            {122, 277, 0},
-            {122, 278, 0},
-            {122, 279, 0},
-            {122, 280, 0},
-            {122, 281, 0},
-            {124, 282, 0},
-            {124, 283, 0},
-            {124, 284, 0},
-            {124, 285, 0},
-            {124, 286, 0},
-            {124, 287, 0},
-            {124, 288, 0},
-            {124, 289, 0},
-            {124, 290, 0},
-            {124, 291, 0},
-            {11, 292, 0},
-            {11, 293, 0},
-            {11, 294, 0},
-            {11, 295, 0},
-            {9100, 296, 0},
-            {9101, 297, 0},
-            {9102, 298, 0},
-            {9103, 299, 0},
-	}},
-        {"Deathwind Chapel", {false, false, false}, {0, 0, 0}, 8, 284, {
-            {1, 0, 0},
-            {14, 1, 0},
-            {117, 2, 0},
-            {117, 3, 0},
-            {117, 4, 0},
-            {117, 5, 0},
-            {55, 6, 0},
-            {55, 7, 0},
-            {55, 8, 0},
-            {55, 9, 0},
-            {54, 10, 0},
-            {54, 11, 0},
-            {54, 12, 0},
-            {54, 13, 0},
-            {54, 14, 0},
-            {54, 15, 0},
-            {54, 16, 0},
-            {54, 17, 0},
-            {54, 18, 0},
-            {54, 19, 0},
-            {54, 20, 0},
-            {54, 21, 0},
-            {54, 22, 0},
-            {54, 23, 0},
-            {54, 24, 0},
-            {54, 25, 0},
-            {9001, 26, 0},
-            {9001, 27, 0},
-            {9001, 28, 0},
-            {9001, 29, 0},
-            {9001, 30, 0},
-            {9001, 31, 0},
-            {140, 32, 0},
-            {140, 33, 0},
-            {5, 34, 0},
-            {140, 35, 0},
-            {14, 36, 0},
-            {140, 37, 0},
-            {9001, 38, 0},
-            {3002, 39, 0},
-            {3002, 40, 0},
-            {3002, 41, 0},
-            {3002, 42, 0},
-            {3002, 43, 0},
-            {3002, 44, 0},
-            {3002, 45, 0},
-            {3002, 46, 0},
-            {3000, 47, 0},
-            {3000, 48, 0},
-            {3000, 49, 0},
-            {3000, 50, 0},
-            {3000, 51, 0},
-            {3000, 52, 0},
-            {3000, 53, 0},
-            {3000, 54, 0},
-            {55, 55, 0},
-            {55, 56, 0},
-            {55, 57, 0},
-            {55, 58, 0},
-            {55, 59, 0},
-            {55, 60, 0},
-            {106, 61, 0},
-            {106, 62, 0},
-            {105, 63, 0},
-            {105, 64, 0},
-            {106, 65, 0},
-            {104, 66, 0},
-            {105, 67, 0},
-            {100, 68, 0},
-            {101, 69, 0},
-            {102, 70, 0},
-            {14, 71, 0},
-            {14, 72, 0},
-            {8003, 73, 0},
-            {8007, 74, 0},
-            {8000, 75, 0},
-            {8000, 76, 0},
-            {8000, 77, 0},
-            {8000, 78, 0},
-            {8000, 79, 0},
-            {8000, 80, 0},
-            {8000, 81, 0},
-            {8000, 82, 0},
-            {10, 83, 0},
-            {8009, 84, 0},
-            {8010, 85, 0},
-            {123, 86, 0},
-            {53, 87, 0},
-            {8040, 88, 0},
-            {107, 89, 0},
-            {107, 90, 0},
-            {107, 91, 0},
-            {107, 92, 0},
-            {107, 93, 0},
-            {107, 94, 0},
-            {107, 95, 0},
-            {107, 96, 0},
-            {107, 97, 0},
-            {115, 98, 0},
-            {115, 99, 0},
-            {115, 100, 0},
-            {114, 101, 0},
-            {114, 102, 0},
-            {114, 103, 0},
-            {114, 104, 0},
-            {10060, 105, 0},
-            {10060, 106, 0},
-            {10060, 107, 0},
-            {10060, 108, 0},
-            {10060, 109, 0},
-            {10060, 110, 0},
-            {10060, 111, 0},
-            {10060, 112, 0},
-            {10060, 113, 0},
-            {10060, 114, 0},
-            {10060, 115, 0},
-            {10060, 116, 0},
-            {115, 117, 0},
-            {115, 118, 0},
-            {114, 119, 0},
-            {114, 120, 0},
-            {114, 121, 0},
-            {114, 122, 0},
-            {114, 123, 0},
-            {114, 124, 0},
-            {114, 125, 0},
-            {114, 126, 0},
-            {114, 127, 0},
-            {107, 128, 0},
-            {10030, 129, 0},
-            {10030, 130, 0},
-            {10030, 131, 0},
-            {10030, 132, 0},
-            {10030, 133, 0},
-            {10030, 134, 0},
-            {114, 135, 0},
-            {114, 136, 0},
-            {114, 137, 0},
-            {114, 138, 0},
-            {114, 139, 0},
-            {114, 140, 0},
-            {114, 141, 0},
-            {114, 142, 0},
-            {114, 143, 0},
-            {114, 144, 0},
-            {114, 145, 0},
-            {114, 146, 0},
-            {114, 147, 0},
-            {114, 148, 0},
-            {114, 149, 0},
-            {81, 150, 0},
-            {81, 151, 0},
-            {81, 152, 0},
-            {81, 153, 0},
-            {81, 154, 0},
-            {81, 155, 0},
-            {122, 156, 0},
-            {122, 157, 0},
-            {122, 158, 0},
-            {122, 159, 0},
-            {124, 160, 0},
-            {124, 161, 0},
-            {124, 162, 0},
-            {124, 163, 0},
-            {8004, 164, 0},
-            {81, 165, 0},
-            {81, 166, 0},
-            {82, 167, 0},
-            {82, 168, 0},
-            {81, 169, 0},
-            {81, 170, 0},
-            {81, 171, 0},
-            {81, 172, 0},
-            {8004, 173, 0},
-            {82, 174, 0},
-            {82, 175, 0},
-            {122, 176, 0},
-            {124, 177, 0},
-            {124, 178, 0},
-            {124, 179, 0},
-            {122, 180, 0},
-            {122, 181, 0},
-            {81, 182, 0},
-            {81, 183, 0},
-            {81, 184, 0},
-            {81, 185, 0},
-            {81, 186, 0},
-            {81, 187, 0},
-            {81, 188, 0},
-            {81, 189, 0},
-            {122, 190, 0},
-            {122, 191, 0},
-            {124, 192, 0},
-            {124, 193, 0},
-            {10110, 194, 0},
-            {10110, 195, 0},
-            {10110, 196, 0},
-            {10110, 197, 0},
-            {10110, 198, 0},
-            {10110, 199, 0},
-            {10110, 200, 0},
-            {10110, 201, 0},
-            {81, 202, 0},
-            {81, 203, 0},
-            {2, 204, 0},
-            {3, 205, 0},
-            {4, 206, 0},
-            {11, 207, 0},
-            {11, 208, 0},
-            {11, 209, 0},
-            {11, 210, 0},
-            {10, 211, 0},
-            {8010, 212, 0},
-            {53, 213, 0},
-            {8009, 214, 0},
-            {123, 215, 0},
-            {8040, 216, 0},
-            {20, 217, 0},
-            {16, 218, 0},
-            {23, 219, 0},
-            {19, 220, 0},
-            {13, 221, 0},
-            {22, 222, 0},
-            {12, 223, 0},
-            {18, 224, 0},
-            {21, 225, 0},
-            {8008, 226, 0},
-            {8005, 227, 0},
-            {8003, 228, 0},
-            {8002, 229, 0},
-            {8041, 230, 0},
-            {30, 231, 0},
-            {32, 232, 0},
-            {36, 233, 0},
-            {86, 234, 0},
-            {10040, 235, 0},
-            {9001, 236, 0},
-            {9001, 237, 0},
-            {9001, 238, 0},
-            {9001, 239, 0},
-            {9001, 240, 0},
-            {114, 241, 0},
-            {114, 242, 0},
-            {114, 243, 0},
-            {10030, 244, 0},
-            {10030, 245, 0},
-            {10030, 246, 0},
-            {10030, 247, 0},
-            {114, 248, 0},
-            {114, 249, 0},
-            {114, 250, 0},
-            {114, 251, 0},
-            {10060, 252, 0},
-            {10060, 253, 0},
-            {114, 254, 0},
-            {10060, 255, 0},
-            {107, 256, 0},
-            {107, 257, 0},
-            {84, 258, 0},
-            {84, 259, 0},
-            {10120, 260, 0},
-            {10120, 261, 0},
-            {10120, 262, 0},
-            {10120, 263, 0},
-            {122, 264, 0},
-            {122, 265, 0},
-            {122, 266, 0},
-            {122, 267, 0},
-            {122, 268, 0},
-            {122, 269, 0},
-            {122, 270, 0},
-            {122, 271, 0},
-            {122, 272, 0},
-            {122, 273, 0},
-            {122, 274, 0},
-            {122, 275, 0},
-            {11, 276, 0},
-            {11, 277, 0},
-            {11, 278, 0},
-            {11, 279, 0},
-            {9100, 280, 0},
-            {9101, 281, 0},
-            {9102, 282, 0},
-            {9103, 283, 0},
-	}},
-        {"Orchard of Lamentations", {false, false, false}, {0, 0, 0}, 7, 266, {
-            {1, 0, 0},
-            {14, 1, 0},
-            {14, 2, 0},
-            {14, 3, 0},
-            {14, 4, 0},
-            {9010, 5, 0},
-            {9009, 6, 0},
-            {8100, 7, 0},
-            {8100, 8, 0},
-            {8100, 9, 0},
-            {8100, 10, 0},
-            {8100, 11, 0},
-            {8100, 12, 0},
-            {8100, 13, 0},
-            {8100, 14, 0},
-            {8100, 15, 0},
-            {8100, 16, 0},
-            {8100, 17, 0},
-            {8100, 18, 0},
-            {8100, 19, 0},
-            {8100, 20, 0},
-            {6, 21, 0},
-            {6, 22, 0},
-            {6, 23, 0},
-            {7, 24, 0},
-            {7, 25, 0},
-            {7, 26, 0},
-            {9, 27, 0},
-            {9, 28, 0},
-            {9, 29, 0},
-            {15, 30, 0},
-            {15, 31, 0},
-            {8104, 32, 0},
-            {8104, 33, 0},
-            {8104, 34, 0},
-            {8104, 35, 0},
-            {8104, 36, 0},
-            {8104, 37, 0},
-            {39, 38, 0},
-            {39, 39, 0},
-            {39, 40, 0},
-            {39, 41, 0},
-            {39, 42, 0},
-            {40, 43, 0},
-            {40, 44, 0},
-            {46, 45, 0},
-            {29, 46, 0},
-            {29, 47, 0},
-            {29, 48, 0},
-            {29, 49, 0},
-            {28, 50, 0},
-            {28, 51, 0},
-            {28, 52, 0},
-            {29, 53, 0},
-            {29, 54, 0},
-            {29, 55, 0},
-            {29, 56, 0},
-            {29, 57, 0},
-            {28, 58, 0},
-            {28, 59, 0},
-            {80, 60, 0},
-            {87, 61, 0},
-            {8008, 62, 0},
-            {30, 63, 0},
-            {10110, 64, 0},
-            {8000, 65, 0},
-            {8000, 66, 0},
-            {8000, 67, 0},
-            {8000, 68, 0},
-            {8000, 69, 0},
-            {8000, 70, 0},
-            {8000, 71, 0},
-            {8000, 72, 0},
-            {8000, 73, 0},
-            {8000, 74, 0},
-            {8000, 75, 0},
-            {8000, 76, 0},
-            {8000, 77, 0},
-            {8000, 78, 0},
-            {8000, 79, 0},
-            {8000, 80, 0},
-            {8000, 81, 0},
-            {10030, 82, 0},
-            {10030, 83, 0},
-            {10030, 84, 0},
-            {10030, 85, 0},
-            {10030, 86, 0},
-            {10030, 87, 0},
-            {10030, 88, 0},
-            {10030, 89, 0},
-            {10030, 90, 0},
-            {10030, 91, 0},
-            {114, 92, 0},
-            {114, 93, 0},
-            {114, 94, 0},
-            {114, 95, 0},
-            {107, 96, 0},
-            {107, 97, 0},
-            {107, 98, 0},
-            {107, 99, 0},
-            {115, 100, 0},
-            {115, 101, 0},
-            {10030, 102, 0},
-            {10030, 103, 0},
-            {10030, 104, 0},
-            {10030, 105, 0},
-            {10030, 106, 0},
-            {10030, 107, 0},
-            {115, 108, 0},
-            {115, 109, 0},
-            {115, 110, 0},
-            {115, 111, 0},
-            {120, 112, 0},
-            {120, 113, 0},
-            {10030, 114, 0},
-            {10030, 115, 0},
-            {10030, 116, 0},
-            {10030, 117, 0},
-            {10030, 118, 0},
-            {10030, 119, 0},
-            {10030, 120, 0},
-            {10030, 121, 0},
-            {10030, 122, 0},
-            {10030, 123, 0},
-            {107, 124, 0},
-            {107, 125, 0},
-            {107, 126, 0},
-            {107, 127, 0},
-            {107, 128, 0},
-            {121, 129, 0},
-            {10030, 130, 0},
-            {10030, 131, 0},
-            {10030, 132, 0},
-            {10030, 133, 0},
-            {8010, 134, 0},
-            {10, 135, 0},
-            {53, 136, 0},
-            {11, 137, 0},
-            {11, 138, 0},
-            {11, 139, 0},
-            {11, 140, 0},
-            {8004, 141, 0},
-            {122, 142, 0},
-            {122, 143, 0},
-            {122, 144, 0},
-            {122, 145, 0},
-            {124, 146, 0},
-            {124, 147, 0},
-            {124, 148, 0},
-            {124, 149, 0},
-            {81, 150, 0},
-            {81, 151, 0},
-            {81, 152, 0},
-            {81, 153, 0},
-            {81, 154, 0},
-            {81, 155, 0},
-            {81, 156, 0},
-            {81, 157, 0},
-            {81, 158, 0},
-            {81, 159, 0},
-            {81, 160, 0},
-            {81, 161, 0},
-            {10110, 162, 0},
-            {10110, 163, 0},
-            {10110, 164, 0},
-            {10110, 165, 0},
-            {10110, 166, 0},
-            {10110, 167, 0},
-            {10110, 168, 0},
-            {10110, 169, 0},
-            {10110, 170, 0},
-            {10110, 171, 0},
-            {10110, 172, 0},
-            {10110, 173, 0},
-            {10110, 174, 0},
-            {10110, 175, 0},
-            {82, 176, 0},
-            {82, 177, 0},
-            {82, 178, 0},
-            {82, 179, 0},
-            {2, 180, 0},
-            {3, 181, 0},
-            {4, 182, 0},
-            {8005, 183, 0},
-            {8041, 184, 0},
-            {8007, 185, 0},
-            {8006, 186, 0},
-            {8009, 187, 0},
-            {123, 188, 0},
-            {8040, 189, 0},
-            {83, 190, 0},
-            {9001, 191, 0},
-            {9001, 192, 0},
-            {9001, 193, 0},
-            {9001, 194, 0},
-            {9001, 195, 0},
-            {114, 196, 0},
-            {114, 197, 0},
-            {114, 198, 0},
-            {114, 199, 0},
-            {10030, 200, 0},
-            {10030, 201, 0},
-            {10030, 202, 0},
-            {10030, 203, 0},
-            {107, 204, 0},
-            {107, 205, 0},
-            {10030, 206, 0},
-            {10030, 207, 0},
-            {10030, 208, 0},
-            {10030, 209, 0},
-            {10030, 210, 0},
-            {10030, 211, 0},
-            {10030, 212, 0},
-            {10030, 213, 0},
-            {10030, 214, 0},
-            {10030, 215, 0},
-            {10030, 216, 0},
-            {10030, 217, 0},
-            {10030, 218, 0},
-            {10030, 219, 0},
-            {107, 220, 0},
-            {107, 221, 0},
-            {10030, 222, 0},
-            {10060, 223, 0},
-            {10060, 224, 0},
-            {10060, 225, 0},
-            {10060, 226, 0},
-            {10060, 227, 0},
-            {10060, 228, 0},
-            {31, 229, 0},
-            {31, 230, 0},
-            {84, 231, 0},
-            {84, 232, 0},
-            {10120, 233, 0},
-            {10120, 234, 0},
-            {122, 235, 0},
-            {122, 236, 0},
-            {122, 237, 0},
-            {122, 238, 0},
-            {122, 239, 0},
-            {122, 240, 0},
-            {122, 241, 0},
-            {122, 242, 0},
-            {122, 243, 0},
-            {124, 244, 0},
-            {124, 245, 0},
-            {124, 246, 0},
-            {124, 247, 0},
-            {124, 248, 0},
-            {124, 249, 0},
-            {124, 250, 0},
-            {124, 251, 0},
-            {124, 252, 0},
-            {124, 253, 0},
-            {124, 254, 0},
-            {122, 255, 0},
-            {122, 256, 0},
-            {122, 257, 0},
-            {9100, 258, 0},
-            {9101, 259, 0},
-            {9102, 260, 0},
-            {9103, 261, 0},
-            {11, 262, 0},
-            {11, 263, 0},
-            {11, 264, 0},
-            {11, 265, 0},
-	}},
-        {"Silent Refectory", {false, false, false}, {0, 0, 0}, 10, 292, {
-            {1, 0, 0},
-            {14, 1, 0},
-            {3001, 2, 0},
-            {3000, 3, 0},
-            {3001, 4, 0},
-            {3000, 5, 0},
-            {3001, 6, 0},
-            {3000, 7, 0},
-            {55, 8, 0},
-            {55, 9, 0},
-            {55, 10, 0},
-            {55, 11, 0},
-            {55, 12, 0},
-            {55, 13, 0},
-            {55, 14, 0},
-            {55, 15, 0},
-            {55, 16, 0},
-            {55, 17, 0},
-            {55, 18, 0},
-            {9006, 19, 0},
-            {9005, 20, 0},
-            {9004, 21, 0},
-            {8100, 22, 0},
-            {8100, 23, 0},
-            {8100, 24, 0},
-            {8100, 25, 0},
-            {8100, 26, 0},
-            {8100, 27, 0},
-            {8100, 28, 0},
-            {100, 29, 0},
-            {101, 30, 0},
-            {102, 31, 0},
-            {101, 32, 0},
-            {100, 33, 0},
-            {101, 34, 0},
-            {101, 35, 0},
-            {101, 36, 0},
-            {100, 37, 0},
-            {100, 38, 0},
-            {102, 39, 0},
-            {102, 40, 0},
-            {106, 41, 0},
-            {106, 42, 0},
-            {105, 43, 0},
-            {105, 44, 0},
-            {104, 45, 0},
-            {104, 46, 0},
-            {104, 47, 0},
-            {105, 48, 0},
-            {106, 49, 0},
-            {55, 50, 0},
-            {55, 51, 0},
-            {55, 52, 0},
-            {55, 53, 0},
-            {55, 54, 0},
-            {55, 55, 0},
-            {55, 56, 0},
-            {55, 57, 0},
-            {9001, 58, 0},
-            {9001, 59, 0},
-            {9001, 60, 0},
-            {9001, 61, 0},
-            {17, 62, 0},
-            {17, 63, 0},
-            {8063, 64, 0},
-            {8063, 65, 0},
-            {8063, 66, 0},
-            {8063, 67, 0},
-            {8063, 68, 0},
-            {8063, 69, 0},
-            {30, 70, 0},
-            {8005, 71, 0},
-            {123, 72, 0},
-            {8009, 73, 0},
-            {8040, 74, 0},
-            {114, 75, 0},
-            {114, 76, 0},
-            {114, 77, 0},
-            {114, 78, 0},
-            {114, 79, 0},
-            {114, 80, 0},
-            {114, 81, 0},
-            {114, 82, 0},
-            {114, 83, 0},
-            {114, 84, 0},
-            {114, 85, 0},
-            {114, 86, 0},
-            {114, 87, 0},
-            {115, 88, 0},
-            {107, 89, 0},
-            {107, 90, 0},
-            {114, 91, 0},
-            {114, 92, 0},
-            {114, 93, 0},
-            {114, 94, 0},
-            {114, 95, 0},
-            {114, 96, 0},
-            {114, 97, 0},
-            {114, 98, 0},
-            {114, 99, 0},
-            {114, 100, 0},
-            {114, 101, 0},
-            {114, 102, 0},
-            {114, 103, 0},
-            {114, 104, 0},
-            {114, 105, 0},
-            {114, 106, 0},
-            {114, 107, 0},
-            {114, 108, 0},
-            {114, 109, 0},
-            {114, 110, 0},
-            {114, 111, 0},
-            {114, 112, 0},
-            {114, 113, 0},
-            {114, 114, 0},
-            {114, 115, 0},
-            {114, 116, 0},
-            {114, 117, 0},
-            {114, 118, 0},
-            {114, 119, 0},
-            {10030, 120, 0},
-            {10030, 121, 0},
-            {10030, 122, 0},
-            {10030, 123, 0},
-            {10030, 124, 0},
-            {10110, 125, 0},
-            {10110, 126, 0},
-            {10110, 127, 0},
-            {10110, 128, 0},
-            {10110, 129, 0},
-            {10110, 130, 0},
-            {33, 131, 0},
-            {8000, 132, 0},
-            {8000, 133, 0},
-            {8000, 134, 0},
-            {8000, 135, 0},
-            {8000, 136, 0},
-            {8000, 137, 0},
-            {81, 138, 0},
-            {81, 139, 0},
-            {81, 140, 0},
-            {81, 141, 0},
-            {81, 142, 0},
-            {81, 143, 0},
-            {81, 144, 0},
-            {81, 145, 0},
-            {124, 146, 0},
-            {124, 147, 0},
-            {124, 148, 0},
-            {124, 149, 0},
-            {122, 150, 0},
-            {122, 151, 0},
-            {122, 152, 0},
-            {122, 153, 0},
-            {122, 154, 0},
-            {122, 155, 0},
-            {10040, 156, 0},
-            {81, 157, 0},
-            {81, 158, 0},
-            {81, 159, 0},
-            {81, 160, 0},
-            {81, 161, 0},
-            {82, 162, 0},
-            {82, 163, 0},
-            {2, 164, 0},
-            {3, 165, 0},
-            {4, 166, 0},
-            {8502, 167, 0},
-            {8502, 168, 0},
-            {8509, 169, 0},
-            {8508, 170, 0},
-            {8508, 171, 0},
-            {8508, 172, 0},
-            {8507, 173, 0},
-            {8507, 174, 0},
-            {8507, 175, 0},
-            {8505, 176, 0},
-            {8506, 177, 0},
-            {8505, 178, 0},
-            {8505, 179, 0},
-            {8506, 180, 0},
-            {8500, 181, 0},
-            {8501, 182, 0},
-            {9001, 183, 0},
-            {9001, 184, 0},
-            {9001, 185, 0},
-            {9001, 186, 0},
-            {9001, 187, 0},
-            {11, 188, 0},
-            {11, 189, 0},
-            {11, 190, 0},
-            {11, 191, 0},
-            {10, 192, 0},
-            {8010, 193, 0},
-            {53, 194, 0},
-            {8009, 195, 0},
-            {123, 196, 0},
-            {8040, 197, 0},
-            {20, 198, 0},
-            {16, 199, 0},
-            {23, 200, 0},
-            {19, 201, 0},
-            {22, 202, 0},
-            {13, 203, 0},
-            {12, 204, 0},
-            {21, 205, 0},
-            {18, 206, 0},
-            {8003, 207, 0},
-            {8002, 208, 0},
-            {8041, 209, 0},
-            {32, 210, 0},
-            {36, 211, 0},
-            {10040, 212, 0},
-            {8008, 213, 0},
-            {8005, 214, 0},
-            {8007, 215, 0},
-            {8006, 216, 0},
-            {114, 217, 0},
-            {114, 218, 0},
-            {114, 219, 0},
-            {114, 220, 0},
-            {114, 221, 0},
-            {114, 222, 0},
-            {114, 223, 0},
-            {115, 224, 0},
-            {114, 225, 0},
-            {114, 226, 0},
-            {114, 227, 0},
-            {114, 228, 0},
-            {114, 229, 0},
-            {114, 230, 0},
-            {114, 231, 0},
-            {114, 232, 0},
-            {114, 233, 0},
-            {114, 234, 0},
-            {114, 235, 0},
-            {114, 236, 0},
-            {114, 237, 0},
-            {114, 238, 0},
-            {114, 239, 0},
-            {114, 240, 0},
-            {10030, 241, 0},
-            {10030, 242, 0},
-            {10030, 243, 0},
-            {10030, 244, 0},
-            {81, 245, 0},
-            {81, 246, 0},
-            {81, 247, 0},
-            {81, 248, 0},
-            {81, 249, 0},
-            {81, 250, 0},
-            {8000, 251, 0},
-            {8000, 252, 0},
-            {8000, 253, 0},
-            {8000, 254, 0},
-            {8000, 255, 0},
-            {8000, 256, 0},
-            {8000, 257, 0},
-            {122, 258, 0},
-            {122, 259, 0},
-            {122, 260, 0},
-            {124, 261, 0},
-            {124, 262, 0},
-            {8004, 263, 0},
-            {84, 264, 0},
-            {84, 265, 0},
-            {10120, 266, 0},
-            {10120, 267, 0},
-            {10120, 268, 0},
-            {10120, 269, 0},
-            {122, 270, 0},
-            {122, 271, 0},
-            {122, 272, 0},
-            {122, 273, 0},
-            {122, 274, 0},
-            {122, 275, 0},
-            {122, 276, 0},
-            {124, 277, 0},
-            {124, 278, 0},
-            {124, 279, 0},
-            {124, 280, 0},
-            {124, 281, 0},
-            {124, 282, 0},
-            {124, 283, 0},
-            {11, 284, 0},
-            {11, 285, 0},
-            {11, 286, 0},
-            {11, 287, 0},
-            {9100, 288, 0},
-            {9101, 289, 0},
-            {9102, 290, 0},
-            {9103, 291, 0},
-	}},
-        {"Wolf Chapel", {false, false, false}, {0, 0, 0}, 8, 383, {
-            {1, 0, 0},
-            {9001, 1, 0},
-            {9001, 2, 0},
-            {9001, 3, 0},
-            {9001, 4, 0},
-            {9001, 5, 0},
-            {9001, 6, 0},
-            {9001, 7, 0},
-            {9001, 8, 0},
-            {9001, 9, 0},
-            {9001, 10, 0},
-            {9001, 11, 0},
-            {9001, 12, 0},
-            {9001, 13, 0},
-            {9001, 14, 0},
-            {9001, 15, 0},
-            {9001, 16, 0},
-            {55, 17, 0},
-            {55, 18, 0},
-            {55, 19, 0},
-            {55, 20, 0},
-            {8100, 21, 0},
-            {8100, 22, 0},
-            {8100, 23, 0},
-            {8100, 24, 0},
-            {8100, 25, 0},
-            {8100, 26, 0},
-            {8100, 27, 0},
-            {8100, 28, 0},
-            {8100, 29, 0},
-            {8100, 30, 0},
-            {8100, 31, 0},
-            {8100, 32, 0},
-            {8100, 33, 0},
-            {8100, 34, 0},
-            {8100, 35, 0},
-            {8100, 36, 0},
-            {8100, 37, 0},
-            {9001, 38, 0},
-            {9001, 39, 0},
-            {9001, 40, 0},
-            {9001, 41, 0},
-            {18, 42, 0},
-            {10040, 43, 0},
-            {8041, 44, 0},
-            {10110, 45, 0},
-            {10110, 46, 0},
-            {10110, 47, 0},
-            {117, 48, 0},
-            {117, 49, 0},
-            {117, 50, 0},
-            {117, 51, 0},
-            {31, 52, 0},
-            {31, 53, 0},
-            {31, 54, 0},
-            {31, 55, 0},
-            {31, 56, 0},
-            {31, 57, 0},
-            {31, 58, 0},
-            {31, 59, 0},
-            {114, 60, 0},
-            {114, 61, 0},
-            {114, 62, 0},
-            {114, 63, 0},
-            {10030, 64, 0},
-            {10030, 65, 0},
-            {10030, 66, 0},
-            {10030, 67, 0},
-            {10030, 68, 0},
-            {10030, 69, 0},
-            {114, 70, 0},
-            {114, 71, 0},
-            {114, 72, 0},
-            {114, 73, 0},
-            {10030, 74, 0},
-            {10030, 75, 0},
-            {10030, 76, 0},
-            {114, 77, 0},
-            {114, 78, 0},
-            {114, 79, 0},
-            {114, 80, 0},
-            {114, 81, 0},
-            {114, 82, 0},
-            {114, 83, 0},
-            {114, 84, 0},
-            {114, 85, 0},
-            {114, 86, 0},
-            {114, 87, 0},
-            {10030, 88, 0},
-            {10030, 89, 0},
-            {10030, 90, 0},
-            {10030, 91, 0},
-            {23, 92, 0},
-            {81, 93, 0},
-            {81, 94, 0},
-            {81, 95, 0},
-            {81, 96, 0},
-            {81, 97, 0},
-            {81, 98, 0},
-            {82, 99, 0},
-            {82, 100, 0},
-            {8004, 101, 0},
-            {122, 102, 0},
-            {122, 103, 0},
-            {124, 104, 0},
-            {124, 105, 0},
-            {10030, 106, 0},
-            {10030, 107, 0},
-            {10030, 108, 0},
-            {10030, 109, 0},
-            {10030, 110, 0},
-            {10030, 111, 0},
-            {9001, 112, 0},
-            {9001, 113, 0},
-            {9001, 114, 0},
-            {9001, 115, 0},
-            {9001, 116, 0},
-            {9001, 117, 0},
-            {9001, 118, 0},
-            {9001, 119, 0},
-            {9001, 120, 0},
-            {9001, 121, 0},
-            {9001, 122, 0},
-            {9001, 123, 0},
-            {122, 124, 0},
-            {107, 125, 0},
-            {107, 126, 0},
-            {115, 127, 0},
-            {115, 128, 0},
-            {114, 129, 0},
-            {114, 130, 0},
-            {114, 131, 0},
-            {114, 132, 0},
-            {114, 133, 0},
-            {115, 134, 0},
-            {115, 135, 0},
-            {107, 136, 0},
-            {107, 137, 0},
-            {107, 138, 0},
-            {107, 139, 0},
-            {107, 140, 0},
-            {107, 141, 0},
-            {115, 142, 0},
-            {107, 143, 0},
-            {107, 144, 0},
-            {107, 145, 0},
-            {107, 146, 0},
-            {115, 147, 0},
-            {8004, 148, 0},
-            {81, 149, 0},
-            {81, 150, 0},
-            {81, 151, 0},
-            {81, 152, 0},
-            {81, 153, 0},
-            {81, 154, 0},
-            {122, 155, 0},
-            {122, 156, 0},
-            {122, 157, 0},
-            {122, 158, 0},
-            {124, 159, 0},
-            {124, 160, 0},
-            {124, 161, 0},
-            {124, 162, 0},
-            {81, 163, 0},
-            {81, 164, 0},
-            {81, 165, 0},
-            {81, 166, 0},
-            {10501, 167, 0},
-            {10501, 168, 0},
-            {10503, 169, 0},
-            {10503, 170, 0},
-            {10503, 171, 0},
-            {10503, 172, 0},
-            {10503, 173, 0},
-            {84, 174, 0},
-            {122, 175, 0},
-            {122, 176, 0},
-            {122, 177, 0},
-            {122, 178, 0},
-            {82, 179, 0},
-            {82, 180, 0},
-            {8071, 181, 0},
-            {8071, 182, 0},
-            {8071, 183, 0},
-            {8077, 184, 0},
-            {8073, 185, 0},
-            {8075, 186, 0},
-            {8076, 187, 0},
-            {8074, 188, 0},
-            {8073, 189, 0},
-            {8072, 190, 0},
-            {122, 191, 0},
-            {122, 192, 0},
-            {122, 193, 0},
-            {124, 194, 0},
-            {124, 195, 0},
-            {124, 196, 0},
-            {81, 197, 0},
-            {81, 198, 0},
-            {81, 199, 0},
-            {81, 200, 0},
-            {81, 201, 0},
-            {81, 202, 0},
-            {10110, 203, 0},
-            {10110, 204, 0},
-            {10110, 205, 0},
-            {10110, 206, 0},
-            {10110, 207, 0},
-            {10110, 208, 0},
-            {10110, 209, 0},
-            {10110, 210, 0},
-            {122, 211, 0},
-            {122, 212, 0},
-            {122, 213, 0},
-            {124, 214, 0},
-            {124, 215, 0},
-            {124, 216, 0},
-            {8000, 217, 0},
-            {8000, 218, 0},
-            {8000, 219, 0},
-            {8000, 220, 0},
-            {8000, 221, 0},
-            {8000, 222, 0},
-            {8000, 223, 0},
-            {8000, 224, 0},
-            {8061, 225, 0},
-            {8061, 226, 0},
-            {116, 227, 0},
-            {116, 228, 0},
-            {116, 229, 0},
-            {116, 230, 0},
-            {116, 231, 0},
-            {116, 232, 0},
-            {116, 233, 0},
-            {116, 234, 0},
-            {116, 235, 0},
-            {116, 236, 0},
-            {116, 237, 0},
-            {116, 238, 0},
-            {9001, 239, 0},
-            {9001, 240, 0},
-            {9001, 241, 0},
-            {9001, 242, 0},
-            {9001, 243, 0},
-            {9001, 244, 0},
-            {9001, 245, 0},
-            {9001, 246, 0},
-            {9001, 247, 0},
-            {9001, 248, 0},
-            {9001, 249, 0},
-            {9001, 250, 0},
-            {2, 251, 0},
-            {3, 252, 0},
-            {4, 253, 0},
-            {11, 254, 0},
-            {11, 255, 0},
-            {11, 256, 0},
-            {11, 257, 0},
-            {10, 258, 0},
-            {8010, 259, 0},
-            {53, 260, 0},
-            {8009, 261, 0},
-            {123, 262, 0},
-            {8040, 263, 0},
-            {20, 264, 0},
-            {19, 265, 0},
-            {13, 266, 0},
-            {22, 267, 0},
-            {23, 268, 0},
-            {16, 269, 0},
-            {18, 270, 0},
-            {12, 271, 0},
-            {21, 272, 0},
-            {8008, 273, 0},
-            {8005, 274, 0},
-            {83, 275, 0},
-            {8003, 276, 0},
-            {8007, 277, 0},
-            {30, 278, 0},
-            {8006, 279, 0},
-            {36, 280, 0},
-            {10040, 281, 0},
-            {33, 282, 0},
-            {9001, 283, 0},
-            {9001, 284, 0},
-            {9001, 285, 0},
-            {9001, 286, 0},
-            {9001, 287, 0},
-            {107, 288, 0},
-            {107, 289, 0},
-            {107, 290, 0},
-            {107, 291, 0},
-            {115, 292, 0},
-            {114, 293, 0},
-            {114, 294, 0},
-            {114, 295, 0},
-            {114, 296, 0},
-            {114, 297, 0},
-            {114, 298, 0},
-            {114, 299, 0},
-            {114, 300, 0},
-            {10030, 301, 0},
-            {10030, 302, 0},
-            {107, 303, 0},
-            {10030, 304, 0},
-            {10030, 305, 0},
-            {10030, 306, 0},
-            {10030, 307, 0},
-            {114, 308, 0},
-            {115, 309, 0},
-            {115, 310, 0},
-            {115, 311, 0},
-            {31, 312, 0},
-            {31, 313, 0},
-            {82, 314, 0},
-            {82, 315, 0},
-            {82, 316, 0},
-            {82, 317, 0},
-            {82, 318, 0},
-            {82, 319, 0},
-            {82, 320, 0},
-            {82, 321, 0},
-            {82, 322, 0},
-            {82, 323, 0},
-            {82, 324, 0},
-            {124, 325, 0},
-            {124, 326, 0},
-            {124, 327, 0},
-            {124, 328, 0},
-            {8004, 329, 0},
-            {8004, 330, 0},
-            {122, 331, 0},
-            {122, 332, 0},
-            {122, 333, 0},
-            {122, 334, 0},
-            {122, 335, 0},
-            {122, 336, 0},
-            {124, 337, 0},
-            {124, 338, 0},
-            {84, 339, 0},
-            {10120, 340, 0},
-            {10120, 341, 0},
-            {10120, 342, 0},
-            {10120, 343, 0},
-            {124, 344, 0},
-            {124, 345, 0},
-            {124, 346, 0},
-            {124, 347, 0},
-            {124, 348, 0},
-            {124, 349, 0},
-            {124, 350, 0},
-            {124, 351, 0},
-            {124, 352, 0},
-            {124, 353, 0},
-            {124, 354, 0},
-            {124, 355, 0},
-            {124, 356, 0},
-            {124, 357, 0},
-            {122, 358, 0},
-            {122, 359, 0},
-            {122, 360, 0},
-            {122, 361, 0},
-            {122, 362, 0},
-            {124, 363, 0},
-            {124, 364, 0},
-            {124, 365, 0},
-            {124, 366, 0},
-            {122, 367, 0},
-            {122, 368, 0},
-            {122, 369, 0},
-            {122, 370, 0},
-            {122, 371, 0},
-            {122, 372, 0},
-            {122, 373, 0},
-            {122, 374, 0},
-            {9100, 375, 0},
-            {9101, 376, 0},
-            {9102, 377, 0},
-            {9103, 378, 0},
-            {11, 379, 0},
-            {11, 380, 0},
-            {11, 381, 0},
-            {11, 382, 0},
-	}},
-    },
-    {
-        {"Forsaken Outpost", {false, false, false}, {0, 0, 0}, 8, 415, {
-            {1, 0, 0},
-            {3000, 1, 0},
-            {3001, 2, 0},
-            {14, 3, 0},
-            {14, 4, 0},
-            {3002, 5, 0},
-            {3002, 6, 0},
-            {3000, 7, 0},
-            {3000, 8, 0},
-            {3000, 9, 0},
-            {3000, 10, 0},
-            {3001, 11, 0},
-            {3001, 12, 0},
-            {15, 13, 0},
-            {15, 14, 0},
-            {9, 15, 0},
-            {9, 16, 0},
-            {52, 17, 0},
-            {7, 18, 0},
-            {6, 19, 0},
-            {6, 20, 0},
-            {52, 21, 0},
-            {52, 22, 0},
-            {56, 23, 0},
-            {57, 24, 0},
-            {49, 25, 0},
-            {50, 26, 0},
-            {50, 27, 0},
-            {51, 28, 0},
-            {51, 29, 0},
-            {52, 30, 0},
-            {5, 31, 0},
-            {54, 32, 0},
-            {54, 33, 0},
-            {54, 34, 0},
-            {54, 35, 0},
-            {54, 36, 0},
-            {54, 37, 0},
-            {55, 38, 0},
-            {55, 39, 0},
-            {55, 40, 0},
-            {55, 41, 0},
-            {55, 42, 0},
-            {55, 43, 0},
-            {77, 44, 0},
-            {77, 45, 0},
-            {109, 46, 0},
-            {109, 47, 0},
-            {71, 48, 0},
-            {108, 49, 0},
-            {116, 50, 0},
-            {116, 51, 0},
-            {116, 52, 0},
-            {116, 53, 0},
-            {116, 54, 0},
-            {116, 55, 0},
-            {116, 56, 0},
-            {116, 57, 0},
-            {116, 58, 0},
-            {116, 59, 0},
-            {116, 60, 0},
-            {116, 61, 0},
-            {109, 62, 0},
-            {6, 63, 0},
-            {6, 64, 0},
-            {6, 65, 0},
-            {7, 66, 0},
-            {7, 67, 0},
-            {7, 68, 0},
-            {9, 69, 0},
-            {9, 70, 0},
-            {15, 71, 0},
-            {54, 72, 0},
-            {54, 73, 0},
-            {117, 74, 0},
-            {117, 75, 0},
-            {55, 76, 0},
-            {114, 77, 0},
-            {9001, 78, 0},
-            {6, 79, 0},
-            {9, 80, 0},
-            {42, 81, 0},
-            {44, 82, 0},
-            {45, 83, 0},
-            {41, 84, 0},
-            {52, 85, 0},
-            {56, 86, 0},
-            {52, 87, 0},
-            {9, 88, 0},
-            {10060, 89, 0},
-            {117, 90, 0},
-            {117, 91, 0},
-            {117, 92, 0},
-            {117, 93, 0},
-            {117, 94, 0},
-            {117, 95, 0},
-            {117, 96, 0},
-            {117, 97, 0},
-            {54, 98, 0},
-            {55, 99, 0},
-            {55, 100, 0},
-            {55, 101, 0},
-            {55, 102, 0},
-            {10030, 103, 0},
-            {10030, 104, 0},
-            {10030, 105, 0},
-            {10030, 106, 0},
-            {9001, 107, 0},
-            {9001, 108, 0},
-            {9001, 109, 0},
-            {9001, 110, 0},
-            {9001, 111, 0},
-            {9001, 112, 0},
-            {81, 113, 0},
-            {81, 114, 0},
-            {81, 115, 0},
-            {81, 116, 0},
-            {81, 117, 0},
-            {81, 118, 0},
-            {81, 119, 0},
-            {81, 120, 0},
-            {81, 121, 0},
-            {81, 122, 0},
-            {81, 123, 0},
-            {81, 124, 0},
-            {82, 125, 0},
-            {82, 126, 0},
-            {82, 127, 0},
-            {82, 128, 0},
-            {82, 129, 0},
-            {82, 130, 0},
-            {82, 131, 0},
-            {82, 132, 0},
-            {11, 133, 0},
-            {11, 134, 0},
-            {8037, 135, 0},
-            {9001, 136, 0},
-            {9001, 137, 0},
-            {9001, 138, 0},
-            {9001, 139, 0},
-            {9001, 140, 0},
-            {9001, 141, 0},
-            {9001, 142, 0},
-            {9001, 143, 0},
-            {9001, 144, 0},
-            {9001, 145, 0},
-            {9001, 146, 0},
-            {9001, 147, 0},
-            {8010, 148, 0},
-            {30, 149, 0},
-            {8002, 150, 0},
-            {8007, 151, 0},
-            {9007, 152, 0},
-            {9008, 153, 0},
-            {114, 154, 0},
-            {114, 155, 0},
-            {114, 156, 0},
-            {114, 157, 0},
-            {114, 158, 0},
-            {114, 159, 0},
-            {114, 160, 0},
-            {114, 161, 0},
-            {114, 162, 0},
-            {114, 163, 0},
-            {114, 164, 0},
-            {107, 165, 0},
-            {107, 166, 0},
-            {107, 167, 0},
-            {107, 168, 0},
-            {107, 169, 0},
-            {115, 170, 0},
-            {115, 171, 0},
-            {10030, 172, 0},
-            {10030, 173, 0},
-            {31, 174, 0},
-            {31, 175, 0},
-            {31, 176, 0},
-            {31, 177, 0},
-            {107, 178, 0},
-            {107, 179, 0},
-            {115, 180, 0},
-            {115, 181, 0},
-            {107, 182, 0},
-            {107, 183, 0},
-            {107, 184, 0},
-            {107, 185, 0},
-            {107, 186, 0},
-            {107, 187, 0},
-            {10030, 188, 0},
-            {10030, 189, 0},
-            {10030, 190, 0},
-            {10030, 191, 0},
-            {10030, 192, 0},
-            {10030, 193, 0},
-            {10030, 194, 0},
-            {10030, 195, 0},
-            {10030, 196, 0},
-            {114, 197, 0},
-            {114, 198, 0},
-            {114, 199, 0},
-            {114, 200, 0},
-            {114, 201, 0},
-            {10030, 202, 0},
-            {10030, 203, 0},
-            {10030, 204, 0},
-            {81, 205, 0},
-            {81, 206, 0},
-            {81, 207, 0},
-            {81, 208, 0},
-            {81, 209, 0},
-            {81, 210, 0},
-            {81, 211, 0},
-            {81, 212, 0},
-            {114, 213, 0},
-            {114, 214, 0},
-            {114, 215, 0},
-            {114, 216, 0},
-            {114, 217, 0},
-            {114, 218, 0},
-            {114, 219, 0},
-            {114, 220, 0},
-            {81, 221, 0},
-            {81, 222, 0},
-            {81, 223, 0},
-            {81, 224, 0},
-            {81, 225, 0},
-            {8000, 226, 0},
-            {8000, 227, 0},
-            {8000, 228, 0},
-            {10110, 229, 0},
-            {10110, 230, 0},
-            {10110, 231, 0},
-            {10110, 232, 0},
-            {82, 233, 0},
-            {81, 234, 0},
-            {81, 235, 0},
-            {81, 236, 0},
-            {81, 237, 0},
-            {10030, 238, 0},
-            {10030, 239, 0},
-            {83, 240, 0},
-            {82, 241, 0},
-            {10110, 242, 0},
-            {10110, 243, 0},
-            {10110, 244, 0},
-            {10110, 245, 0},
-            {10110, 246, 0},
-            {10110, 247, 0},
-            {10110, 248, 0},
-            {10110, 249, 0},
-            {10110, 250, 0},
-            {10110, 251, 0},
-            {10110, 252, 0},
-            {10110, 253, 0},
-            {10110, 254, 0},
-            {10110, 255, 0},
-            {10110, 256, 0},
-            {10110, 257, 0},
-            {10110, 258, 0},
-            {10110, 259, 0},
-            {10110, 260, 0},
-            {10110, 261, 0},
-            {10110, 262, 0},
-            {8000, 263, 0},
-            {8000, 264, 0},
-            {8000, 265, 0},
-            {8000, 266, 0},
-            {8000, 267, 0},
-            {8000, 268, 0},
-            {122, 269, 0},
-            {122, 270, 0},
-            {122, 271, 0},
-            {122, 272, 0},
-            {122, 273, 0},
-            {122, 274, 0},
-            {124, 275, 0},
-            {124, 276, 0},
-            {124, 277, 0},
-            {124, 278, 0},
-            {124, 279, 0},
-            {124, 280, 0},
-            {124, 281, 0},
-            {124, 282, 0},
-            {124, 283, 0},
-            {122, 284, 0},
-            {122, 285, 0},
-            {122, 286, 0},
-            {122, 287, 0},
-            {122, 288, 0},
-            {122, 289, 0},
-            {122, 290, 0},
-            {122, 291, 0},
-            {124, 292, 0},
-            {124, 293, 0},
-            {124, 294, 0},
-            {124, 295, 0},
-            {124, 296, 0},
-            {124, 297, 0},
-            {122, 298, 0},
-            {122, 299, 0},
-            {122, 300, 0},
-            {122, 301, 0},
-            {122, 302, 0},
-            {122, 303, 0},
-            {124, 304, 0},
-            {124, 305, 0},
-            {124, 306, 0},
-            {124, 307, 0},
-            {124, 308, 0},
-            {124, 309, 0},
-            {124, 310, 0},
-            {124, 311, 0},
-            {8004, 312, 0},
-            {122, 313, 0},
-            {122, 314, 0},
-            {9001, 315, 0},
-            {124, 316, 0},
-            {124, 317, 0},
-            {122, 318, 0},
-            {122, 319, 0},
-            {122, 320, 0},
-            {2, 321, 0},
-            {3, 322, 0},
-            {4, 323, 0},
-            {1, 324, 0},
-            {2, 325, 0},
-            {3, 326, 0},
-            {4, 327, 0},
-            {1, 328, 0},
-            {2, 329, 0},
-            {3, 330, 0},
-            {4, 331, 0},
-            {11, 332, 0},
-            {11, 333, 0},
-            {11, 334, 0},
-            {10, 335, 0},
-            {8010, 336, 0},
-            {53, 337, 0},
-            {8009, 338, 0},
-            {123, 339, 0},
-            {8040, 340, 0},
-            {20, 341, 0},
-            {19, 342, 0},
-            {18, 343, 0},
-            {16, 344, 0},
-            {23, 345, 0},
-            {13, 346, 0},
-            {12, 347, 0},
-            {21, 348, 0},
-            {22, 349, 0},
-            {8008, 350, 0},
-            {8005, 351, 0},
-            {8003, 352, 0},
-            {8002, 353, 0},
-            {8041, 354, 0},
-            {30, 355, 0},
-            {83, 356, 0},
-            {32, 357, 0},
-            {8007, 358, 0},
-            {8006, 359, 0},
-            {86, 360, 0},
-            {36, 361, 0},
-            {10040, 362, 0},
-            {9001, 363, 0},
-            {9001, 364, 0},
-            {9001, 365, 0},
-            {9001, 366, 0},
-            {9001, 367, 0},
-            {107, 368, 0},
-            {107, 369, 0},
-            {10030, 370, 0},
-            {10030, 371, 0},
-            {31, 372, 0},
-            {10060, 373, 0},
-            {10060, 374, 0},
-            {10060, 375, 0},
-            {10060, 376, 0},
-            {10060, 377, 0},
-            {10060, 378, 0},
-            {10030, 379, 0},
-            {10030, 380, 0},
-            {10030, 381, 0},
-            {10030, 382, 0},
-            {31, 383, 0},
-            {31, 384, 0},
-            {10030, 385, 0},
-            {10030, 386, 0},
-            {10030, 387, 0},
-            {10030, 388, 0},
-            {10030, 389, 0},
-            {10030, 390, 0},
-            {10030, 391, 0},
-            {10030, 392, 0},
-            {10030, 393, 0},
-            {31, 394, 0},
-            {9001, 395, 0},
-            {9001, 396, 0},
-            {10120, 397, 0},
-            {10120, 398, 0},
-            {10120, 399, 0},
-            {11, 400, 0},
-            {11, 401, 0},
-            {11, 402, 0},
-            {9100, 403, 0},
-            {9101, 404, 0},
-            {9102, 405, 0},
-            {9103, 406, 0},
-            {9100, 407, 0},
-            {9101, 408, 0},
-            {9102, 409, 0},
-            {9103, 410, 0},
-            {9100, 411, 0},
-            {9101, 412, 0},
-            {9102, 413, 0},
-            {9103, 414, 0},
-	}},
-        {"Castle of Grief", {false, false, false}, {0, 0, 0}, 7, 523, {
-            {1, 0, 0},
-            {121, 1, 0},
-            {121, 2, 0},
-            {121, 3, 0},
-            {121, 4, 0},
-            {114, 5, 0},
-            {114, 6, 0},
-            {114, 7, 0},
-            {114, 8, 0},
-            {9001, 9, 0},
-            {9001, 10, 0},
-            {9001, 11, 0},
-            {9001, 12, 0},
-            {9001, 13, 0},
-            {9001, 14, 0},
-            {9001, 15, 0},
-            {9001, 16, 0},
-            {114, 17, 0},
-            {114, 18, 0},
-            {114, 19, 0},
-            {114, 20, 0},
-            {114, 21, 0},
-            {9001, 22, 0},
-            {9001, 23, 0},
-            {9001, 24, 0},
-            {9001, 25, 0},
-            {9001, 26, 0},
-            {10060, 27, 0},
-            {10060, 28, 0},
-            {10060, 29, 0},
-            {10060, 30, 0},
-            {10090, 31, 0},
-            {10090, 32, 0},
-            {10090, 33, 0},
-            {10090, 34, 0},
-            {10090, 35, 0},
-            {10090, 36, 0},
-            {10090, 37, 0},
-            {10090, 38, 0},
-            {10090, 39, 0},
-            {10090, 40, 0},
-            {10090, 41, 0},
-            {10090, 42, 0},
-            {10090, 43, 0},
-            {10090, 44, 0},
-            {10090, 45, 0},
-            {10090, 46, 0},
-            {10090, 47, 0},
-            {116, 48, 0},
-            {116, 49, 0},
-            {116, 50, 0},
-            {116, 51, 0},
-            {116, 52, 0},
-            {116, 53, 0},
-            {116, 54, 0},
-            {116, 55, 0},
-            {116, 56, 0},
-            {116, 57, 0},
-            {116, 58, 0},
-            {116, 59, 0},
-            {116, 60, 0},
-            {116, 61, 0},
-            {116, 62, 0},
-            {116, 63, 0},
-            {116, 64, 0},
-            {116, 65, 0},
-            {116, 66, 0},
-            {116, 67, 0},
-            {54, 68, 0},
-            {54, 69, 0},
-            {54, 70, 0},
-            {54, 71, 0},
-            {54, 72, 0},
-            {54, 73, 0},
-            {119, 74, 0},
-            {119, 75, 0},
-            {119, 76, 0},
-            {119, 77, 0},
-            {119, 78, 0},
-            {24, 79, 0},
-            {24, 80, 0},
-            {24, 81, 0},
-            {24, 82, 0},
-            {24, 83, 0},
-            {24, 84, 0},
-            {6, 85, 0},
-            {9, 86, 0},
-            {7, 87, 0},
-            {15, 88, 0},
-            {55, 89, 0},
-            {55, 90, 0},
-            {55, 91, 0},
-            {55, 92, 0},
-            {55, 93, 0},
-            {55, 94, 0},
-            {55, 95, 0},
-            {55, 96, 0},
-            {8064, 97, 0},
-            {8064, 98, 0},
-            {62, 99, 0},
-            {62, 100, 0},
-            {100, 101, 0},
-            {100, 102, 0},
-            {101, 103, 0},
-            {101, 104, 0},
-            {102, 105, 0},
-            {77, 106, 0},
-            {77, 107, 0},
-            {77, 108, 0},
-            {77, 109, 0},
-            {77, 110, 0},
-            {77, 111, 0},
-            {108, 112, 0},
-            {109, 113, 0},
-            {71, 114, 0},
-            {110, 115, 0},
-            {109, 116, 0},
-            {61, 117, 0},
-            {109, 118, 0},
-            {62, 119, 0},
-            {62, 120, 0},
-            {61, 121, 0},
-            {109, 122, 0},
-            {8102, 123, 0},
-            {8102, 124, 0},
-            {8102, 125, 0},
-            {8102, 126, 0},
-            {8102, 127, 0},
-            {8102, 128, 0},
-            {29, 129, 0},
-            {29, 130, 0},
-            {29, 131, 0},
-            {29, 132, 0},
-            {29, 133, 0},
-            {29, 134, 0},
-            {116, 135, 0},
-            {116, 136, 0},
-            {116, 137, 0},
-            {116, 138, 0},
-            {116, 139, 0},
-            {116, 140, 0},
-            {116, 141, 0},
-            {116, 142, 0},
-            {116, 143, 0},
-            {54, 144, 0},
-            {54, 145, 0},
-            {54, 146, 0},
-            {54, 147, 0},
-            {54, 148, 0},
-            {54, 149, 0},
-            {54, 150, 0},
-            {54, 151, 0},
-            {54, 152, 0},
-            {8008, 153, 0},
-            {8003, 154, 0},
-            {86, 155, 0},
-            {10110, 156, 0},
-            {8064, 157, 0},
-            {8064, 158, 0},
-            {8064, 159, 0},
-            {8064, 160, 0},
-            {8000, 161, 0},
-            {8000, 162, 0},
-            {8000, 163, 0},
-            {8000, 164, 0},
-            {8000, 165, 0},
-            {8000, 166, 0},
-            {8000, 167, 0},
-            {8000, 168, 0},
-            {8000, 169, 0},
-            {8000, 170, 0},
-            {8000, 171, 0},
-            {8000, 172, 0},
-            {8000, 173, 0},
-            {8000, 174, 0},
-            {8000, 175, 0},
-            {8000, 176, 0},
-            {8000, 177, 0},
-            {8000, 178, 0},
-            {8000, 179, 0},
-            {8000, 180, 0},
-            {8000, 181, 0},
-            {8000, 182, 0},
-            {8000, 183, 0},
-            {8000, 184, 0},
-            {10030, 185, 0},
-            {10030, 186, 0},
-            {10030, 187, 0},
-            {10030, 188, 0},
-            {10030, 189, 0},
-            {10030, 190, 0},
-            {10030, 191, 0},
-            {10030, 192, 0},
-            {10030, 193, 0},
-            {10030, 194, 0},
-            {10030, 195, 0},
-            {10030, 196, 0},
-            {31, 197, 0},
-            {31, 198, 0},
-            {31, 199, 0},
-            {31, 200, 0},
-            {31, 201, 0},
-            {31, 202, 0},
-            {31, 203, 0},
-            {31, 204, 0},
-            {31, 205, 0},
-            {31, 206, 0},
-            {107, 207, 0},
-            {107, 208, 0},
-            {107, 209, 0},
-            {107, 210, 0},
-            {107, 211, 0},
-            {107, 212, 0},
-            {107, 213, 0},
-            {107, 214, 0},
-            {107, 215, 0},
-            {107, 216, 0},
-            {115, 217, 0},
-            {115, 218, 0},
-            {115, 219, 0},
-            {115, 220, 0},
-            {115, 221, 0},
-            {115, 222, 0},
-            {114, 223, 0},
-            {114, 224, 0},
-            {114, 225, 0},
-            {114, 226, 0},
-            {114, 227, 0},
-            {114, 228, 0},
-            {10030, 229, 0},
-            {10030, 230, 0},
-            {10030, 231, 0},
-            {10030, 232, 0},
-            {10030, 233, 0},
-            {10030, 234, 0},
-            {10030, 235, 0},
-            {10030, 236, 0},
-            {10030, 237, 0},
-            {10030, 238, 0},
-            {10030, 239, 0},
-            {10030, 240, 0},
-            {10030, 241, 0},
-            {10030, 242, 0},
-            {10030, 243, 0},
-            {10030, 244, 0},
-            {10030, 245, 0},
-            {31, 246, 0},
-            {31, 247, 0},
-            {31, 248, 0},
-            {31, 249, 0},
-            {31, 250, 0},
-            {31, 251, 0},
-            {58, 252, 0},
-            {58, 253, 0},
-            {59, 254, 0},
-            {59, 255, 0},
-            {9021, 256, 0},
-            {9018, 257, 0},
-            {9020, 258, 0},
-            {9019, 259, 0},
-            {11, 260, 0},
-            {11, 261, 0},
-            {11, 262, 0},
-            {11, 263, 0},
-            {124, 264, 0},
-            {124, 265, 0},
-            {124, 266, 0},
-            {124, 267, 0},
-            {122, 268, 0},
-            {122, 269, 0},
-            {122, 270, 0},
-            {122, 271, 0},
-            {8004, 272, 0},
-            {8004, 273, 0},
-            {81, 274, 0},
-            {81, 275, 0},
-            {81, 276, 0},
-            {81, 277, 0},
-            {81, 278, 0},
-            {81, 279, 0},
-            {81, 280, 0},
-            {81, 281, 0},
-            {81, 282, 0},
-            {81, 283, 0},
-            {81, 284, 0},
-            {81, 285, 0},
-            {81, 286, 0},
-            {81, 287, 0},
-            {81, 288, 0},
-            {81, 289, 0},
-            {81, 290, 0},
-            {81, 291, 0},
-            {81, 292, 0},
-            {81, 293, 0},
-            {81, 294, 0},
-            {81, 295, 0},
-            {81, 296, 0},
-            {81, 297, 0},
-            {122, 298, 0},
-            {122, 299, 0},
-            {122, 300, 0},
-            {122, 301, 0},
-            {122, 302, 0},
-            {122, 303, 0},
-            {122, 304, 0},
-            {122, 305, 0},
-            {122, 306, 0},
-            {122, 307, 0},
-            {122, 308, 0},
-            {122, 309, 0},
-            {124, 310, 0},
-            {124, 311, 0},
-            {124, 312, 0},
-            {124, 313, 0},
-            {124, 314, 0},
-            {124, 315, 0},
-            {124, 316, 0},
-            {124, 317, 0},
-            {124, 318, 0},
-            {124, 319, 0},
-            {124, 320, 0},
-            {124, 321, 0},
-            {8000, 322, 0},
-            {8000, 323, 0},
-            {8000, 324, 0},
-            {8000, 325, 0},
-            {8000, 326, 0},
-            {8000, 327, 0},
-            {8000, 328, 0},
-            {8000, 329, 0},
-            {8000, 330, 0},
-            {8000, 331, 0},
-            {8000, 332, 0},
-            {8000, 333, 0},
-            {81, 334, 0},
-            {81, 335, 0},
-            {122, 336, 0},
-            {122, 337, 0},
-            {124, 338, 0},
-            {124, 339, 0},
-            {122, 340, 0},
-            {122, 341, 0},
-            {8000, 342, 0},
-            {8000, 343, 0},
-            {8000, 344, 0},
-            {8000, 345, 0},
-            {8000, 346, 0},
-            {8000, 347, 0},
-            {10110, 348, 0},
-            {10110, 349, 0},
-            {10110, 350, 0},
-            {10110, 351, 0},
-            {10110, 352, 0},
-            {10110, 353, 0},
-            {10110, 354, 0},
-            {10110, 355, 0},
-            {10110, 356, 0},
-            {10110, 357, 0},
-            {10110, 358, 0},
-            {10110, 359, 0},
-            {10110, 360, 0},
-            {10110, 361, 0},
-            {2, 362, 0},
-            {3, 363, 0},
-            {4, 364, 0},
-            {1, 365, 0},
-            {2, 366, 0},
-            {3, 367, 0},
-            {4, 368, 0},
-            {1, 369, 0},
-            {2, 370, 0},
-            {3, 371, 0},
-            {4, 372, 0},
-            {1, 373, 0},
-            {2, 374, 0},
-            {3, 375, 0},
-            {4, 376, 0},
-            {10060, 377, 0},
-            {10060, 378, 0},
-            {10060, 379, 0},
-            {10060, 380, 0},
-            {114, 381, 0},
-            {114, 382, 0},
-            {114, 383, 0},
-            {114, 384, 0},
-            {114, 385, 0},
-            {83, 386, 0},
-            {10, 387, 0},
-            {8010, 388, 0},
-            {53, 389, 0},
-            {30, 390, 0},
-            {84, 391, 0},
-            {84, 392, 0},
-            {8040, 393, 0},
-            {123, 394, 0},
-            {8009, 395, 0},
-            {20, 396, 0},
-            {19, 397, 0},
-            {18, 398, 0},
-            {16, 399, 0},
-            {13, 400, 0},
-            {12, 401, 0},
-            {23, 402, 0},
-            {22, 403, 0},
-            {21, 404, 0},
-            {8005, 405, 0},
-            {8007, 406, 0},
-            {8006, 407, 0},
-            {9001, 408, 0},
-            {9001, 409, 0},
-            {9001, 410, 0},
-            {9001, 411, 0},
-            {9001, 412, 0},
-            {120, 413, 0},
-            {120, 414, 0},
-            {10030, 415, 0},
-            {10030, 416, 0},
-            {10030, 417, 0},
-            {10030, 418, 0},
-            {107, 419, 0},
-            {107, 420, 0},
-            {10030, 421, 0},
-            {10030, 422, 0},
-            {10030, 423, 0},
-            {10030, 424, 0},
-            {115, 425, 0},
-            {115, 426, 0},
-            {115, 427, 0},
-            {115, 428, 0},
-            {115, 429, 0},
-            {115, 430, 0},
-            {10030, 431, 0},
-            {10030, 432, 0},
-            {10030, 433, 0},
-            {10030, 434, 0},
-            {10060, 435, 0},
-            {10060, 436, 0},
-            {10060, 437, 0},
-            {10060, 438, 0},
-            {31, 439, 0},
-            {9001, 440, 0},
-            {122, 441, 0},
-            {122, 442, 0},
-            {122, 443, 0},
-            {122, 444, 0},
-            {124, 445, 0},
-            {124, 446, 0},
-            {124, 447, 0},
-            {124, 448, 0},
-            {124, 449, 0},
-            {122, 450, 0},
-            {8004, 451, 0},
-            {8004, 452, 0},
-            {10120, 453, 0},
-            {10120, 454, 0},
-            {10120, 455, 0},
-            {10120, 456, 0},
-            {8004, 457, 0},
-            {8004, 458, 0},
-            {8004, 459, 0},
-            {8004, 460, 0},
-            {8004, 461, 0},
-            {8004, 462, 0},
-            {8004, 463, 0},
-            {8004, 464, 0},
-            {8004, 465, 0},
-            {8004, 466, 0},
-            {8004, 467, 0},
-            {8004, 468, 0},
-            {8004, 469, 0},
-            {8004, 470, 0},
-            {8004, 471, 0},
-            {8004, 472, 0},
-            {8004, 473, 0},
-            {8004, 474, 0},
-            {8004, 475, 0},
-            {8004, 476, 0},
-            {8004, 477, 0},
-            {8004, 478, 0},
-            {8004, 479, 0},
-            {8004, 480, 0},
-            {8004, 481, 0},
-            {8004, 482, 0},
-            {8004, 483, 0},
-            {8004, 484, 0},
-            {8004, 485, 0},
-            {8004, 486, 0},
-            {8004, 487, 0},
-            {8004, 488, 0},
-            {8004, 489, 0},
-            {8004, 490, 0},
-            {8004, 491, 0},
-            {8004, 492, 0},
-            {8004, 493, 0},
-            {8004, 494, 0},
-            {8004, 495, 0},
-            {8004, 496, 0},
-            {10, 497, 0},
-            {8010, 498, 0},
-            {53, 499, 0},
-            {8040, 500, 0},
-            {8009, 501, 0},
-            {123, 502, 0},
-            {11, 503, 0},
-            {11, 504, 0},
-            {11, 505, 0},
-            {11, 506, 0},
-            {9100, 507, 0},
-            {9101, 508, 0},
-            {9102, 509, 0},
-            {9103, 510, 0},
-            {9100, 511, 0},
-            {9101, 512, 0},
-            {9102, 513, 0},
-            {9103, 514, 0},
-            {9100, 515, 0},
-            {9101, 516, 0},
-            {9102, 517, 0},
-            {9103, 518, 0},
-            {9100, 519, 0},
-            {9101, 520, 0},
-            {9102, 521, 0},
-            {9103, 522, 0},
-	}},
-        {"Gibbet", {false, false, false}, {0, 0, 0}, 8, 496, {
-            {1, 0, 0},
-            {3000, 1, 0},
-            {3000, 2, 0},
-            {3002, 3, 0},
-            {3002, 4, 0},
-            {3000, 5, 0},
-            {3000, 6, 0},
-            {3002, 7, 0},
-            {3002, 8, 0},
-            {3000, 9, 0},
-            {3000, 10, 0},
-            {3002, 11, 0},
-            {3002, 12, 0},
-            {9001, 13, 0},
-            {9001, 14, 0},
-            {9001, 15, 0},
-            {9001, 16, 0},
-            {116, 17, 0},
-            {116, 18, 0},
-            {116, 19, 0},
-            {116, 20, 0},
-            {116, 21, 0},
-            {116, 22, 0},
-            {116, 23, 0},
-            {116, 24, 0},
-            {116, 25, 0},
-            {116, 26, 0},
-            {116, 27, 0},
-            {116, 28, 0},
-            {116, 29, 0},
-            {116, 30, 0},
-            {116, 31, 0},
-            {55, 32, 0},
-            {55, 33, 0},
-            {55, 34, 0},
-            {55, 35, 0},
-            {55, 36, 0},
-            {55, 37, 0},
-            {55, 38, 0},
-            {55, 39, 0},
-            {55, 40, 0},
-            {55, 41, 0},
-            {55, 42, 0},
-            {55, 43, 0},
-            {55, 44, 0},
-            {55, 45, 0},
-            {55, 46, 0},
-            {55, 47, 0},
-            {55, 48, 0},
-            {55, 49, 0},
-            {55, 50, 0},
-            {14, 51, 0},
-            {9001, 52, 0},
-            {9001, 53, 0},
-            {9002, 54, 0},
-            {17, 55, 0},
-            {17, 56, 0},
-            {17, 57, 0},
-            {17, 58, 0},
-            {17, 59, 0},
-            {17, 60, 0},
-            {17, 61, 0},
-            {17, 62, 0},
-            {17, 63, 0},
-            {54, 64, 0},
-            {54, 65, 0},
-            {54, 66, 0},
-            {54, 67, 0},
-            {54, 68, 0},
-            {54, 69, 0},
-            {54, 70, 0},
-            {62, 71, 0},
-            {62, 72, 0},
-            {117, 73, 0},
-            {117, 74, 0},
-            {117, 75, 0},
-            {117, 76, 0},
-            {117, 77, 0},
-            {117, 78, 0},
-            {117, 79, 0},
-            {9011, 80, 0},
-            {71, 81, 0},
-            {71, 82, 0},
-            {109, 83, 0},
-            {108, 84, 0},
-            {71, 85, 0},
-            {108, 86, 0},
-            {71, 87, 0},
-            {109, 88, 0},
-            {8032, 89, 0},
-            {71, 90, 0},
-            {71, 91, 0},
-            {9001, 92, 0},
-            {10060, 93, 0},
-            {10060, 94, 0},
-            {10060, 95, 0},
-            {10060, 96, 0},
-            {10060, 97, 0},
-            {10060, 98, 0},
-            {10060, 99, 0},
-            {10060, 100, 0},
-            {10060, 101, 0},
-            {10060, 102, 0},
-            {84, 103, 0},
-            {114, 104, 0},
-            {114, 105, 0},
-            {114, 106, 0},
-            {114, 107, 0},
-            {114, 108, 0},
-            {114, 109, 0},
-            {117, 110, 0},
-            {117, 111, 0},
-            {117, 112, 0},
-            {117, 113, 0},
-            {117, 114, 0},
-            {117, 115, 0},
-            {117, 116, 0},
-            {117, 117, 0},
-            {108, 118, 0},
-            {108, 119, 0},
-            {108, 120, 0},
-            {109, 121, 0},
-            {109, 122, 0},
-            {109, 123, 0},
-            {71, 124, 0},
-            {71, 125, 0},
-            {71, 126, 0},
-            {9001, 127, 0},
-            {9001, 128, 0},
-            {61, 129, 0},
-            {61, 130, 0},
-            {61, 131, 0},
-            {61, 132, 0},
-            {77, 133, 0},
-            {77, 134, 0},
-            {117, 135, 0},
-            {117, 136, 0},
-            {117, 137, 0},
-            {117, 138, 0},
-            {117, 139, 0},
-            {117, 140, 0},
-            {117, 141, 0},
-            {117, 142, 0},
-            {117, 143, 0},
-            {117, 144, 0},
-            {117, 145, 0},
-            {9001, 146, 0},
-            {9001, 147, 0},
-            {9001, 148, 0},
-            {9001, 149, 0},
-            {9001, 150, 0},
-            {9001, 151, 0},
-            {9001, 152, 0},
-            {115, 153, 0},
-            {8064, 154, 0},
-            {8064, 155, 0},
-            {17, 156, 0},
-            {17, 157, 0},
-            {103, 158, 0},
-            {103, 159, 0},
-            {103, 160, 0},
-            {103, 161, 0},
-            {103, 162, 0},
-            {103, 163, 0},
-            {103, 164, 0},
-            {103, 165, 0},
-            {104, 166, 0},
-            {105, 167, 0},
-            {81, 168, 0},
-            {71, 169, 0},
-            {62, 170, 0},
-            {62, 171, 0},
-            {110, 172, 0},
-            {62, 173, 0},
-            {10030, 174, 0},
-            {10030, 175, 0},
-            {8100, 176, 0},
-            {8100, 177, 0},
-            {8100, 178, 0},
-            {8100, 179, 0},
-            {8100, 180, 0},
-            {8100, 181, 0},
-            {8100, 182, 0},
-            {8100, 183, 0},
-            {8100, 184, 0},
-            {8100, 185, 0},
-            {8100, 186, 0},
-            {8100, 187, 0},
-            {8100, 188, 0},
-            {8100, 189, 0},
-            {8000, 190, 0},
-            {8100, 191, 0},
-            {8100, 192, 0},
-            {8100, 193, 0},
-            {8100, 194, 0},
-            {82, 195, 0},
-            {114, 196, 0},
-            {114, 197, 0},
-            {114, 198, 0},
-            {114, 199, 0},
-            {114, 200, 0},
-            {114, 201, 0},
-            {1406, 202, 0},
-            {8041, 203, 0},
-            {8000, 204, 0},
-            {8000, 205, 0},
-            {8000, 206, 0},
-            {10110, 207, 0},
-            {83, 208, 0},
-            {10080, 209, 0},
-            {8064, 210, 0},
-            {8064, 211, 0},
-            {8064, 212, 0},
-            {8064, 213, 0},
-            {8064, 214, 0},
-            {8064, 215, 0},
-            {8064, 216, 0},
-            {8064, 217, 0},
-            {8000, 218, 0},
-            {8000, 219, 0},
-            {8000, 220, 0},
-            {8000, 221, 0},
-            {8000, 222, 0},
-            {82, 223, 0},
-            {82, 224, 0},
-            {82, 225, 0},
-            {82, 226, 0},
-            {82, 227, 0},
-            {8000, 228, 0},
-            {8000, 229, 0},
-            {8000, 230, 0},
-            {8000, 231, 0},
-            {8000, 232, 0},
-            {8000, 233, 0},
-            {8000, 234, 0},
-            {8000, 235, 0},
-            {9001, 236, 0},
-            {9001, 237, 0},
-            {9001, 238, 0},
-            {9001, 239, 0},
-            {9001, 240, 0},
-            {9001, 241, 0},
-            {9001, 242, 0},
-            {9001, 243, 0},
-            {9001, 244, 0},
-            {9001, 245, 0},
-            {9001, 246, 0},
-            {9001, 247, 0},
-            {9001, 248, 0},
-            {9001, 249, 0},
-            {9001, 250, 0},
-            {9001, 251, 0},
-            {82, 252, 0},
-            {82, 253, 0},
-            {82, 254, 0},
-            {8004, 255, 0},
-            {115, 256, 0},
-            {115, 257, 0},
-            {10030, 258, 0},
-            {10030, 259, 0},
-            {10030, 260, 0},
-            {10030, 261, 0},
-            {10030, 262, 0},
-            {10030, 263, 0},
-            {10030, 264, 0},
-            {10030, 265, 0},
-            {107, 266, 0},
-            {107, 267, 0},
-            {107, 268, 0},
-            {107, 269, 0},
-            {114, 270, 0},
-            {114, 271, 0},
-            {107, 272, 0},
-            {107, 273, 0},
-            {107, 274, 0},
-            {10030, 275, 0},
-            {114, 276, 0},
-            {10060, 277, 0},
-            {10060, 278, 0},
-            {10060, 279, 0},
-            {10060, 280, 0},
-            {10060, 281, 0},
-            {10060, 282, 0},
-            {10060, 283, 0},
-            {10060, 284, 0},
-            {10060, 285, 0},
-            {10060, 286, 0},
-            {10060, 287, 0},
-            {107, 288, 0},
-            {107, 289, 0},
-            {107, 290, 0},
-            {107, 291, 0},
-            {107, 292, 0},
-            {107, 293, 0},
-            {107, 294, 0},
-            {107, 295, 0},
-            {107, 296, 0},
-            {107, 297, 0},
-            {107, 298, 0},
-            {107, 299, 0},
-            {10030, 300, 0},
-            {10030, 301, 0},
-            {10030, 302, 0},
-            {10030, 303, 0},
-            {10030, 304, 0},
-            {10030, 305, 0},
-            {10030, 306, 0},
-            {10030, 307, 0},
-            {10030, 308, 0},
-            {10030, 309, 0},
-            {10030, 310, 0},
-            {8009, 311, 0},
-            {123, 312, 0},
-            {8040, 313, 0},
-            {8067, 314, 0},
-            {8067, 315, 0},
-            {8067, 316, 0},
-            {8067, 317, 0},
-            {11, 318, 0},
-            {11, 319, 0},
-            {11, 320, 0},
-            {11, 321, 0},
-            {10110, 322, 0},
-            {10110, 323, 0},
-            {10110, 324, 0},
-            {10110, 325, 0},
-            {10110, 326, 0},
-            {10110, 327, 0},
-            {10110, 328, 0},
-            {10110, 329, 0},
-            {8000, 330, 0},
-            {8000, 331, 0},
-            {8000, 332, 0},
-            {8000, 333, 0},
-            {8000, 334, 0},
-            {8000, 335, 0},
-            {8000, 336, 0},
-            {8000, 337, 0},
-            {82, 338, 0},
-            {82, 339, 0},
-            {82, 340, 0},
-            {82, 341, 0},
-            {82, 342, 0},
-            {82, 343, 0},
-            {82, 344, 0},
-            {82, 345, 0},
-            {81, 346, 0},
-            {81, 347, 0},
-            {81, 348, 0},
-            {81, 349, 0},
-            {81, 350, 0},
-            {81, 351, 0},
-            {81, 352, 0},
-            {81, 353, 0},
-            {81, 354, 0},
-            {81, 355, 0},
-            {81, 356, 0},
-            {81, 357, 0},
-            {81, 358, 0},
-            {81, 359, 0},
-            {124, 360, 0},
-            {124, 361, 0},
-            {124, 362, 0},
-            {124, 363, 0},
-            {124, 364, 0},
-            {124, 365, 0},
-            {124, 366, 0},
-            {124, 367, 0},
-            {122, 368, 0},
-            {122, 369, 0},
-            {122, 370, 0},
-            {122, 371, 0},
-            {122, 372, 0},
-            {122, 373, 0},
-            {122, 374, 0},
-            {122, 375, 0},
-            {2, 376, 0},
-            {3, 377, 0},
-            {4, 378, 0},
-            {1, 379, 0},
-            {2, 380, 0},
-            {3, 381, 0},
-            {4, 382, 0},
-            {1, 383, 0},
-            {2, 384, 0},
-            {3, 385, 0},
-            {4, 386, 0},
-            {114, 387, 0},
-            {114, 388, 0},
-            {114, 389, 0},
-            {114, 390, 0},
-            {8006, 391, 0},
-            {8008, 392, 0},
-            {114, 393, 0},
-            {114, 394, 0},
-            {114, 395, 0},
-            {114, 396, 0},
-            {114, 397, 0},
-            {114, 398, 0},
-            {8005, 399, 0},
-            {8007, 400, 0},
-            {84, 401, 0},
-            {10, 402, 0},
-            {8010, 403, 0},
-            {53, 404, 0},
-            {20, 405, 0},
-            {19, 406, 0},
-            {18, 407, 0},
-            {16, 408, 0},
-            {23, 409, 0},
-            {13, 410, 0},
-            {12, 411, 0},
-            {22, 412, 0},
-            {21, 413, 0},
-            {10060, 414, 0},
-            {10060, 415, 0},
-            {10060, 416, 0},
-            {10060, 417, 0},
-            {10060, 418, 0},
-            {10060, 419, 0},
-            {10060, 420, 0},
-            {10060, 421, 0},
-            {10060, 422, 0},
-            {10060, 423, 0},
-            {10080, 424, 0},
-            {114, 425, 0},
-            {114, 426, 0},
-            {114, 427, 0},
-            {114, 428, 0},
-            {114, 429, 0},
-            {114, 430, 0},
-            {9001, 431, 0},
-            {9001, 432, 0},
-            {9001, 433, 0},
-            {9001, 434, 0},
-            {9001, 435, 0},
-            {114, 436, 0},
-            {114, 437, 0},
-            {114, 438, 0},
-            {114, 439, 0},
-            {114, 440, 0},
-            {114, 441, 0},
-            {10060, 442, 0},
-            {10060, 443, 0},
-            {10060, 444, 0},
-            {10060, 445, 0},
-            {10060, 446, 0},
-            {10060, 447, 0},
-            {115, 448, 0},
-            {115, 449, 0},
-            {115, 450, 0},
-            {10030, 451, 0},
-            {10030, 452, 0},
-            {10030, 453, 0},
-            {10030, 454, 0},
-            {9001, 455, 0},
-            {10060, 456, 0},
-            {10060, 457, 0},
-            {10060, 458, 0},
-            {10060, 459, 0},
-            {114, 460, 0},
-            {114, 461, 0},
-            {114, 462, 0},
-            {114, 463, 0},
-            {114, 464, 0},
-            {114, 465, 0},
-            {10030, 466, 0},
-            {10030, 467, 0},
-            {120, 468, 0},
-            {121, 469, 0},
-            {30, 470, 0},
-            {10120, 471, 0},
-            {10120, 472, 0},
-            {10120, 473, 0},
-            {10120, 474, 0},
-            {81, 475, 0},
-            {81, 476, 0},
-            {81, 477, 0},
-            {81, 478, 0},
-            {82, 479, 0},
-            {11, 480, 0},
-            {11, 481, 0},
-            {11, 482, 0},
-            {11, 483, 0},
-            {9100, 484, 0},
-            {9101, 485, 0},
-            {9102, 486, 0},
-            {9103, 487, 0},
-            {9100, 488, 0},
-            {9101, 489, 0},
-            {9102, 490, 0},
-            {9103, 491, 0},
-            {9100, 492, 0},
-            {9101, 493, 0},
-            {9102, 494, 0},
-            {9103, 495, 0},
-	}},
-        {"Effluvium", {false, false, false}, {0, 0, 0}, 8, 306, {
-            {3002, 0, 0},
-            {3000, 1, 0},
-            {14, 2, 0},
-            {14, 3, 0},
-            {1, 4, 0},
-            {10000, 5, 0},
-            {10000, 6, 0},
-            {10000, 7, 0},
-            {1406, 8, 0},
-            {1406, 9, 0},
-            {1406, 10, 0},
-            {1406, 11, 0},
-            {1406, 12, 0},
-            {1406, 13, 0},
-            {1406, 14, 0},
-            {1406, 15, 0},
-            {1406, 16, 0},
-            {1406, 17, 0},
-            {1406, 18, 0},
-            {1406, 19, 0},
-            {1406, 20, 0},
-            {1406, 21, 0},
-            {1406, 22, 0},
-            {1406, 23, 0},
-            {1406, 24, 0},
-            {1406, 25, 0},
-            {1406, 26, 0},
-            {8104, 27, 0},
-            {8104, 28, 0},
-            {8104, 29, 0},
-            {8104, 30, 0},
-            {8104, 31, 0},
-            {80, 32, 0},
-            {80, 33, 0},
-            {87, 34, 0},
-            {87, 35, 0},
-            {80, 36, 0},
-            {87, 37, 0},
-            {37, 38, 0},
-            {38, 39, 0},
-            {28, 40, 0},
-            {87, 41, 0},
-            {80, 42, 0},
-            {87, 43, 0},
-            {87, 44, 0},
-            {87, 45, 0},
-            {80, 46, 0},
-            {80, 47, 0},
-            {80, 48, 0},
-            {71, 49, 0},
-            {71, 50, 0},
-            {108, 51, 0},
-            {108, 52, 0},
-            {58, 53, 0},
-            {58, 54, 0},
-            {58, 55, 0},
-            {58, 56, 0},
-            {58, 57, 0},
-            {58, 58, 0},
-            {58, 59, 0},
-            {58, 60, 0},
-            {58, 61, 0},
-            {58, 62, 0},
-            {58, 63, 0},
-            {58, 64, 0},
-            {58, 65, 0},
-            {59, 66, 0},
-            {59, 67, 0},
-            {59, 68, 0},
-            {59, 69, 0},
-            {58, 70, 0},
-            {58, 71, 0},
-            {59, 72, 0},
-            {59, 73, 0},
-            {59, 74, 0},
-            {59, 75, 0},
-            {59, 76, 0},
-            {59, 77, 0},
-            {59, 78, 0},
-            {59, 79, 0},
-            {59, 80, 0},
-            {59, 81, 0},
-            {59, 82, 0},
-            {59, 83, 0},
-            {59, 84, 0},
-            {59, 85, 0},
-            {59, 86, 0},
-            {59, 87, 0},
-            {58, 88, 0},
-            {58, 89, 0},
-            {58, 90, 0},
-            {58, 91, 0},
-            {58, 92, 0},
-            {58, 93, 0},
-            {58, 94, 0},
-            {59, 95, 0},
-            {59, 96, 0},
-            {59, 97, 0},
-            {59, 98, 0},
-            {58, 99, 0},
-            {58, 100, 0},
-            {58, 101, 0},
-            {58, 102, 0},
-            {1406, 103, 0},
-            {8006, 104, 0},
-            {32, 105, 0},
-            {30, 106, 0},
-            {8000, 107, 0},
-            {8000, 108, 0},
-            {8000, 109, 0},
-            {8000, 110, 0},
-            {8000, 111, 0},
-            {8000, 112, 0},
-            {81, 113, 0},
-            {81, 114, 0},
-            {81, 115, 0},
-            {81, 116, 0},
-            {82, 117, 0},
-            {82, 118, 0},
-            {82, 119, 0},
-            {10, 120, 0},
-            {8041, 121, 0},
-            {121, 122, 0},
-            {121, 123, 0},
-            {121, 124, 0},
-            {120, 125, 0},
-            {120, 126, 0},
-            {120, 127, 0},
-            {120, 128, 0},
-            {121, 129, 0},
-            {121, 130, 0},
-            {8080, 131, 0},
-            {10030, 132, 0},
-            {10030, 133, 0},
-            {10030, 134, 0},
-            {10030, 135, 0},
-            {121, 136, 0},
-            {121, 137, 0},
-            {10030, 138, 0},
-            {10030, 139, 0},
-            {10030, 140, 0},
-            {10030, 141, 0},
-            {10030, 142, 0},
-            {10030, 143, 0},
-            {121, 144, 0},
-            {121, 145, 0},
-            {121, 146, 0},
-            {121, 147, 0},
-            {107, 148, 0},
-            {107, 149, 0},
-            {107, 150, 0},
-            {107, 151, 0},
-            {8080, 152, 0},
-            {8080, 153, 0},
-            {8080, 154, 0},
-            {8080, 155, 0},
-            {8080, 156, 0},
-            {115, 157, 0},
-            {115, 158, 0},
-            {10030, 159, 0},
-            {10030, 160, 0},
-            {122, 161, 0},
-            {122, 162, 0},
-            {122, 163, 0},
-            {122, 164, 0},
-            {122, 165, 0},
-            {122, 166, 0},
-            {124, 167, 0},
-            {124, 168, 0},
-            {124, 169, 0},
-            {124, 170, 0},
-            {10110, 171, 0},
-            {10110, 172, 0},
-            {10110, 173, 0},
-            {10110, 174, 0},
-            {10110, 175, 0},
-            {10110, 176, 0},
-            {81, 177, 0},
-            {81, 178, 0},
-            {81, 179, 0},
-            {81, 180, 0},
-            {81, 181, 0},
-            {81, 182, 0},
-            {8003, 183, 0},
-            {8000, 184, 0},
-            {8000, 185, 0},
-            {8000, 186, 0},
-            {8000, 187, 0},
-            {124, 188, 0},
-            {124, 189, 0},
-            {122, 190, 0},
-            {122, 191, 0},
-            {124, 192, 0},
-            {124, 193, 0},
-            {124, 194, 0},
-            {122, 195, 0},
-            {122, 196, 0},
-            {122, 197, 0},
-            {10110, 198, 0},
-            {10110, 199, 0},
-            {10110, 200, 0},
-            {10110, 201, 0},
-            {10110, 202, 0},
-            {10110, 203, 0},
-            {124, 204, 0},
-            {124, 205, 0},
-            {81, 206, 0},
-            {81, 207, 0},
-            {81, 208, 0},
-            {81, 209, 0},
-            {81, 210, 0},
-            {81, 211, 0},
-            {81, 212, 0},
-            {81, 213, 0},
-            {81, 214, 0},
-            {81, 215, 0},
-            {81, 216, 0},
-            {81, 217, 0},
-            {2, 218, 0},
-            {3, 219, 0},
-            {4, 220, 0},
-            {1, 221, 0},
-            {2, 222, 0},
-            {3, 223, 0},
-            {4, 224, 0},
-            {1, 225, 0},
-            {2, 226, 0},
-            {3, 227, 0},
-            {4, 228, 0},
-            {4, 229, 0},
-            {3, 230, 0},
-            {2, 231, 0},
-            {1, 232, 0},
-            {8035, 233, 0},
-            {11, 234, 0},
-            {11, 235, 0},
-            {11, 236, 0},
-            {11, 237, 0},
-            {10, 238, 0},
-            {8010, 239, 0},
-            {53, 240, 0},
-            {8009, 241, 0},
-            {123, 242, 0},
-            {8040, 243, 0},
-            {20, 244, 0},
-            {16, 245, 0},
-            {23, 246, 0},
-            {22, 247, 0},
-            {13, 248, 0},
-            {19, 249, 0},
-            {18, 250, 0},
-            {12, 251, 0},
-            {21, 252, 0},
-            {8008, 253, 0},
-            {8005, 254, 0},
-            {8002, 255, 0},
-            {8041, 256, 0},
-            {30, 257, 0},
-            {8007, 258, 0},
-            {32, 259, 0},
-            {36, 260, 0},
-            {33, 261, 0},
-            {10040, 262, 0},
-            {9001, 263, 0},
-            {9001, 264, 0},
-            {9001, 265, 0},
-            {9001, 266, 0},
-            {9001, 267, 0},
-            {33, 268, 0},
-            {120, 269, 0},
-            {107, 270, 0},
-            {107, 271, 0},
-            {10030, 272, 0},
-            {10030, 273, 0},
-            {10060, 274, 0},
-            {121, 275, 0},
-            {120, 276, 0},
-            {120, 277, 0},
-            {8080, 278, 0},
-            {121, 279, 0},
-            {84, 280, 0},
-            {84, 281, 0},
-            {10120, 282, 0},
-            {10120, 283, 0},
-            {10120, 284, 0},
-            {10120, 285, 0},
-            {11, 286, 0},
-            {11, 287, 0},
-            {11, 288, 0},
-            {11, 289, 0},
-            {9100, 290, 0},
-            {9101, 291, 0},
-            {9102, 292, 0},
-            {9103, 293, 0},
-            {9100, 294, 0},
-            {9101, 295, 0},
-            {9102, 296, 0},
-            {9103, 297, 0},
-            {9100, 298, 0},
-            {9101, 299, 0},
-            {9102, 300, 0},
-            {9103, 301, 0},
-            {9100, 302, 0},
-            {9101, 303, 0},
-            {9102, 304, 0},
-            {9103, 305, 0},
-	}},
-        {"Dungeons", {false, false, false}, {0, 0, 0}, 3, 537, {
-            {1, 0, 0},
-            {3000, 1, 0},
-            {3001, 2, 0},
-            {3002, 3, 0},
-            {3000, 4, 0},
-            {9001, 5, 0},
-            {9001, 6, 0},
-            {9001, 7, 0},
-            {9001, 8, 0},
-            {9001, 9, 0},
-            {9001, 10, 0},
-            {9001, 11, 0},
-            {55, 12, 0},
-            {55, 13, 0},
-            {55, 14, 0},
-            {55, 15, 0},
-            {55, 16, 0},
-            {55, 17, 0},
-            {55, 18, 0},
-            {55, 19, 0},
-            {55, 20, 0},
-            {55, 21, 0},
-            {55, 22, 0},
-            {55, 23, 0},
-            {55, 24, 0},
-            {55, 25, 0},
-            {55, 26, 0},
-            {55, 27, 0},
-            {55, 28, 0},
-            {110, 29, 0},
-            {110, 30, 0},
-            {109, 31, 0},
-            {62, 32, 0},
-            {62, 33, 0},
-            {71, 34, 0},
-            {111, 35, 0},
-            {111, 36, 0},
-            {111, 37, 0},
-            {111, 38, 0},
-            {111, 39, 0},
-            {111, 40, 0},
-            {111, 41, 0},
-            {111, 42, 0},
-            {111, 43, 0},
-            {111, 44, 0},
-            {111, 45, 0},
-            {71, 46, 0},
-            {110, 47, 0},
-            {62, 48, 0},
-            {62, 49, 0},
-            {62, 50, 0},
-            {110, 51, 0},
-            {108, 52, 0},
-            {109, 53, 0},
-            {109, 54, 0},
-            {71, 55, 0},
-            {62, 56, 0},
-            {62, 57, 0},
-            {62, 58, 0},
-            {110, 59, 0},
-            {110, 60, 0},
-            {108, 61, 0},
-            {108, 62, 0},
-            {108, 63, 0},
-            {109, 64, 0},
-            {108, 65, 0},
-            {108, 66, 0},
-            {109, 67, 0},
-            {108, 68, 0},
-            {110, 69, 0},
-            {110, 70, 0},
-            {110, 71, 0},
-            {110, 72, 0},
-            {110, 73, 0},
-            {110, 74, 0},
-            {110, 75, 0},
-            {110, 76, 0},
-            {110, 77, 0},
-            {110, 78, 0},
-            {110, 79, 0},
-            {62, 80, 0},
-            {62, 81, 0},
-            {62, 82, 0},
-            {62, 83, 0},
-            {62, 84, 0},
-            {62, 85, 0},
-            {62, 86, 0},
-            {62, 87, 0},
-            {62, 88, 0},
-            {62, 89, 0},
-            {62, 90, 0},
-            {110, 91, 0},
-            {110, 92, 0},
-            {108, 93, 0},
-            {108, 94, 0},
-            {109, 95, 0},
-            {109, 96, 0},
-            {71, 97, 0},
-            {71, 98, 0},
-            {71, 99, 0},
-            {61, 100, 0},
-            {55, 101, 0},
-            {55, 102, 0},
-            {55, 103, 0},
-            {55, 104, 0},
-            {54, 105, 0},
-            {54, 106, 0},
-            {54, 107, 0},
-            {54, 108, 0},
-            {54, 109, 0},
-            {54, 110, 0},
-            {8100, 111, 0},
-            {8100, 112, 0},
-            {8100, 113, 0},
-            {8100, 114, 0},
-            {100, 115, 0},
-            {101, 116, 0},
-            {102, 117, 0},
-            {108, 118, 0},
-            {108, 119, 0},
-            {109, 120, 0},
-            {71, 121, 0},
-            {71, 122, 0},
-            {8100, 123, 0},
-            {8100, 124, 0},
-            {8100, 125, 0},
-            {8100, 126, 0},
-            {110, 127, 0},
-            {110, 128, 0},
-            {110, 129, 0},
-            {110, 130, 0},
-            {110, 131, 0},
-            {110, 132, 0},
-            {110, 133, 0},
-            {110, 134, 0},
-            {62, 135, 0},
-            {62, 136, 0},
-            {62, 137, 0},
-            {62, 138, 0},
-            {71, 139, 0},
-            {109, 140, 0},
-            {110, 141, 0},
-            {110, 142, 0},
-            {110, 143, 0},
-            {8100, 144, 0},
-            {8100, 145, 0},
-            {8100, 146, 0},
-            {8100, 147, 0},
-            {8100, 148, 0},
-            {110, 149, 0},
-            {110, 150, 0},
-            {110, 151, 0},
-            {110, 152, 0},
-            {9001, 153, 0},
-            {31, 154, 0},
-            {31, 155, 0},
-            {31, 156, 0},
-            {31, 157, 0},
-            {55, 158, 0},
-            {55, 159, 0},
-            {55, 160, 0},
-            {55, 161, 0},
-            {55, 162, 0},
-            {55, 163, 0},
-            {55, 164, 0},
-            {55, 165, 0},
-            {55, 166, 0},
-            {55, 167, 0},
-            {55, 168, 0},
-            {55, 169, 0},
-            {55, 170, 0},
-            {55, 171, 0},
-            {55, 172, 0},
-            {55, 173, 0},
-            {55, 174, 0},
-            {55, 175, 0},
-            {55, 176, 0},
-            {55, 177, 0},
-            {55, 178, 0},
-            {55, 179, 0},
-            {55, 180, 0},
-            {55, 181, 0},
-            {55, 182, 0},
-            {55, 183, 0},
-            {10030, 184, 0},
-            {10030, 185, 0},
-            {10030, 186, 0},
-            {10030, 187, 0},
-            {10030, 188, 0},
-            {10030, 189, 0},
-            {10030, 190, 0},
-            {10030, 191, 0},
-            {10030, 192, 0},
-            {52, 193, 0},
-            {52, 194, 0},
-            {52, 195, 0},
-            {56, 196, 0},
-            {56, 197, 0},
-            {57, 198, 0},
-            {57, 199, 0},
-            {57, 200, 0},
-            {57, 201, 0},
-            {57, 202, 0},
-            {57, 203, 0},
-            {57, 204, 0},
-            {56, 205, 0},
-            {52, 206, 0},
-            {50, 207, 0},
-            {50, 208, 0},
-            {50, 209, 0},
-            {51, 210, 0},
-            {51, 211, 0},
-            {51, 212, 0},
-            {10060, 213, 0},
-            {10060, 214, 0},
-            {8100, 215, 0},
-            {8100, 216, 0},
-            {8100, 217, 0},
-            {8100, 218, 0},
-            {54, 219, 0},
-            {116, 220, 0},
-            {116, 221, 0},
-            {116, 222, 0},
-            {116, 223, 0},
-            {62, 224, 0},
-            {62, 225, 0},
-            {62, 226, 0},
-            {108, 227, 0},
-            {108, 228, 0},
-            {109, 229, 0},
-            {109, 230, 0},
-            {109, 231, 0},
-            {61, 232, 0},
-            {61, 233, 0},
-            {61, 234, 0},
-            {61, 235, 0},
-            {71, 236, 0},
-            {71, 237, 0},
-            {71, 238, 0},
-            {10060, 239, 0},
-            {10060, 240, 0},
-            {10060, 241, 0},
-            {116, 242, 0},
-            {116, 243, 0},
-            {116, 244, 0},
-            {116, 245, 0},
-            {116, 246, 0},
-            {8005, 247, 0},
-            {30, 248, 0},
-            {10110, 249, 0},
-            {10110, 250, 0},
-            {8004, 251, 0},
-            {8000, 252, 0},
-            {8000, 253, 0},
-            {8000, 254, 0},
-            {8000, 255, 0},
-            {8000, 256, 0},
-            {8000, 257, 0},
-            {8000, 258, 0},
-            {8000, 259, 0},
-            {8000, 260, 0},
-            {8000, 261, 0},
-            {8000, 262, 0},
-            {8000, 263, 0},
-            {8000, 264, 0},
-            {53, 265, 0},
-            {10060, 266, 0},
-            {10060, 267, 0},
-            {10060, 268, 0},
-            {8070, 269, 0},
-            {8069, 270, 0},
-            {8070, 271, 0},
-            {8067, 272, 0},
-            {8067, 273, 0},
-            {8067, 274, 0},
-            {8067, 275, 0},
-            {8067, 276, 0},
-            {8067, 277, 0},
-            {8067, 278, 0},
-            {115, 279, 0},
-            {115, 280, 0},
-            {115, 281, 0},
-            {115, 282, 0},
-            {10030, 283, 0},
-            {10030, 284, 0},
-            {10030, 285, 0},
-            {10030, 286, 0},
-            {10030, 287, 0},
-            {10030, 288, 0},
-            {10030, 289, 0},
-            {10030, 290, 0},
-            {121, 291, 0},
-            {121, 292, 0},
-            {10060, 293, 0},
-            {10060, 294, 0},
-            {10060, 295, 0},
-            {10060, 296, 0},
-            {10030, 297, 0},
-            {10030, 298, 0},
-            {10030, 299, 0},
-            {10030, 300, 0},
-            {107, 301, 0},
-            {115, 302, 0},
-            {115, 303, 0},
-            {10030, 304, 0},
-            {10030, 305, 0},
-            {10030, 306, 0},
-            {10030, 307, 0},
-            {10030, 308, 0},
-            {10030, 309, 0},
-            {31, 310, 0},
-            {31, 311, 0},
-            {114, 312, 0},
-            {114, 313, 0},
-            {114, 314, 0},
-            {109, 315, 0},
-            {109, 316, 0},
-            {8067, 317, 0},
-            {8067, 318, 0},
-            {8067, 319, 0},
-            {8004, 320, 0},
-            {8004, 321, 0},
-            {8067, 322, 0},
-            {8067, 323, 0},
-            {8067, 324, 0},
-            {8067, 325, 0},
-            {11, 326, 0},
-            {11, 327, 0},
-            {11, 328, 0},
-            {11, 329, 0},
-            {124, 330, 0},
-            {124, 331, 0},
-            {124, 332, 0},
-            {124, 333, 0},
-            {124, 334, 0},
-            {8000, 335, 0},
-            {8000, 336, 0},
-            {8000, 337, 0},
-            {8000, 338, 0},
-            {8000, 339, 0},
-            {8000, 340, 0},
-            {10110, 341, 0},
-            {10110, 342, 0},
-            {10110, 343, 0},
-            {10110, 344, 0},
-            {10110, 345, 0},
-            {10110, 346, 0},
-            {8000, 347, 0},
-            {8000, 348, 0},
-            {8000, 349, 0},
-            {8000, 350, 0},
-            {8000, 351, 0},
-            {8000, 352, 0},
-            {8004, 353, 0},
-            {124, 354, 0},
-            {124, 355, 0},
-            {124, 356, 0},
-            {124, 357, 0},
-            {122, 358, 0},
-            {122, 359, 0},
-            {122, 360, 0},
-            {122, 361, 0},
-            {81, 362, 0},
-            {81, 363, 0},
-            {81, 364, 0},
-            {81, 365, 0},
-            {81, 366, 0},
-            {81, 367, 0},
-            {8000, 368, 0},
-            {8000, 369, 0},
-            {8000, 370, 0},
-            {8000, 371, 0},
-            {8000, 372, 0},
-            {8000, 373, 0},
-            {8000, 374, 0},
-            {8000, 375, 0},
-            {8000, 376, 0},
-            {124, 377, 0},
-            {124, 378, 0},
-            {124, 379, 0},
-            {124, 380, 0},
-            {122, 381, 0},
-            {122, 382, 0},
-            {122, 383, 0},
-            {122, 384, 0},
-            {8004, 385, 0},
-            {10110, 386, 0},
-            {10110, 387, 0},
-            {10110, 388, 0},
-            {10110, 389, 0},
-            {10110, 390, 0},
-            {10110, 391, 0},
-            {10110, 392, 0},
-            {10110, 393, 0},
-            {82, 394, 0},
-            {82, 395, 0},
-            {82, 396, 0},
-            {124, 397, 0},
-            {124, 398, 0},
-            {124, 399, 0},
-            {124, 400, 0},
-            {122, 401, 0},
-            {122, 402, 0},
-            {122, 403, 0},
-            {122, 404, 0},
-            {10110, 405, 0},
-            {10110, 406, 0},
-            {10110, 407, 0},
-            {10110, 408, 0},
-            {10110, 409, 0},
-            {10110, 410, 0},
-            {8004, 411, 0},
-            {124, 412, 0},
-            {122, 413, 0},
-            {122, 414, 0},
-            {124, 415, 0},
-            {8004, 416, 0},
-            {82, 417, 0},
-            {82, 418, 0},
-            {82, 419, 0},
-            {82, 420, 0},
-            {81, 421, 0},
-            {81, 422, 0},
-            {81, 423, 0},
-            {81, 424, 0},
-            {81, 425, 0},
-            {81, 426, 0},
-            {81, 427, 0},
-            {81, 428, 0},
-            {81, 429, 0},
-            {81, 430, 0},
-            {81, 431, 0},
-            {81, 432, 0},
-            {81, 433, 0},
-            {81, 434, 0},
-            {81, 435, 0},
-            {81, 436, 0},
-            {81, 437, 0},
-            {81, 438, 0},
-            {81, 439, 0},
-            {81, 440, 0},
-            {81, 441, 0},
-            {81, 442, 0},
-            {81, 443, 0},
-            {82, 444, 0},
-            {82, 445, 0},
-            {2, 446, 0},
-            {3, 447, 0},
-            {4, 448, 0},
-            {1, 449, 0},
-            {2, 450, 0},
-            {3, 451, 0},
-            {4, 452, 0},
-            {71, 453, 0},
-            {108, 454, 0},
-            {109, 455, 0},
-            {71, 456, 0},
-            {31, 457, 0},
-            {31, 458, 0},
-            {31, 459, 0},
-            {31, 460, 0},
-            {31, 461, 0},
-            {31, 462, 0},
-            {10030, 463, 0},
-            {10030, 464, 0},
-            {10030, 465, 0},
-            {10030, 466, 0},
-            {10030, 467, 0},
-            {10030, 468, 0},
-            {10030, 469, 0},
-            {10030, 470, 0},
-            {10030, 471, 0},
-            {8006, 472, 0},
-            {8007, 473, 0},
-            {8008, 474, 0},
-            {8041, 475, 0},
-            {8010, 476, 0},
-            {123, 477, 0},
-            {16, 478, 0},
-            {13, 479, 0},
-            {12, 480, 0},
-            {10, 481, 0},
-            {8009, 482, 0},
-            {20, 483, 0},
-            {19, 484, 0},
-            {18, 485, 0},
-            {8040, 486, 0},
-            {23, 487, 0},
-            {22, 488, 0},
-            {21, 489, 0},
-            {9001, 490, 0},
-            {9001, 491, 0},
-            {9001, 492, 0},
-            {9001, 493, 0},
-            {9001, 494, 0},
-            {10030, 495, 0},
-            {10030, 496, 0},
-            {10030, 497, 0},
-            {10060, 498, 0},
-            {10060, 499, 0},
-            {10060, 500, 0},
-            {10060, 501, 0},
-            {10060, 502, 0},
-            {10060, 503, 0},
-            {31, 504, 0},
-            {31, 505, 0},
-            {10030, 506, 0},
-            {10030, 507, 0},
-            {10030, 508, 0},
-            {10030, 509, 0},
-            {10030, 510, 0},
-            {10030, 511, 0},
-            {115, 512, 0},
-            {115, 513, 0},
-            {115, 514, 0},
-            {31, 515, 0},
-            {31, 516, 0},
-            {107, 517, 0},
-            {107, 518, 0},
-            {84, 519, 0},
-            {84, 520, 0},
-            {10120, 521, 0},
-            {10120, 522, 0},
-            {10120, 523, 0},
-            {10120, 524, 0},
-            {11, 525, 0},
-            {11, 526, 0},
-            {11, 527, 0},
-            {11, 528, 0},
-            {9100, 529, 0},
-            {9101, 530, 0},
-            {9102, 531, 0},
-            {9103, 532, 0},
-            {9100, 533, 0},
-            {9101, 534, 0},
-            {9102, 535, 0},
-            {9103, 536, 0},
-	}},
-        {"Desolate Garden", {false, false, false}, {0, 0, 0}, 16, 230, {
-            {1406, 0, 0},
-            {1406, 1, 0},
-            {1406, 2, 0},
-            {1406, 3, 0},
-            {1406, 4, 0},
-            {1, 5, 0},
-            {78, 6, 0},
-            {78, 7, 0},
-            {78, 8, 0},
-            {78, 9, 0},
-            {113, 10, 0},
-            {113, 11, 0},
-            {9001, 12, 0},
-            {9001, 13, 0},
-            {9001, 14, 0},
-            {9001, 15, 0},
-            {9001, 16, 0},
-            {9001, 17, 0},
-            {9001, 18, 0},
-            {9001, 19, 0},
-            {9001, 20, 0},
-            {9001, 21, 0},
-            {9001, 22, 0},
-            {9001, 23, 0},
-            {9001, 24, 0},
-            {77, 25, 0},
-            {77, 26, 0},
-            {77, 27, 0},
-            {77, 28, 0},
-            {77, 29, 0},
-            {77, 30, 0},
-            {54, 31, 0},
-            {54, 32, 0},
-            {54, 33, 0},
-            {54, 34, 0},
-            {54, 35, 0},
-            {54, 36, 0},
-            {116, 37, 0},
-            {116, 38, 0},
-            {103, 39, 0},
-            {103, 40, 0},
-            {116, 41, 0},
-            {116, 42, 0},
-            {77, 43, 0},
-            {77, 44, 0},
-            {77, 45, 0},
-            {77, 46, 0},
-            {77, 47, 0},
-            {77, 48, 0},
-            {77, 49, 0},
-            {8100, 50, 0},
-            {8100, 51, 0},
-            {8100, 52, 0},
-            {8100, 53, 0},
-            {8100, 54, 0},
-            {8100, 55, 0},
-            {8100, 56, 0},
-            {1406, 57, 0},
-            {59, 58, 0},
-            {59, 59, 0},
-            {59, 60, 0},
-            {58, 61, 0},
-            {58, 62, 0},
-            {58, 63, 0},
-            {59, 64, 0},
-            {8003, 65, 0},
-            {8010, 66, 0},
-            {10, 67, 0},
-            {53, 68, 0},
-            {8040, 69, 0},
-            {8009, 70, 0},
-            {123, 71, 0},
-            {16, 72, 0},
-            {13, 73, 0},
-            {12, 74, 0},
-            {20, 75, 0},
-            {19, 76, 0},
-            {18, 77, 0},
-            {23, 78, 0},
-            {22, 79, 0},
-            {21, 80, 0},
-            {10110, 81, 0},
-            {10110, 82, 0},
-            {8000, 83, 0},
-            {8000, 84, 0},
-            {8000, 85, 0},
-            {8000, 86, 0},
-            {8000, 87, 0},
-            {8000, 88, 0},
-            {8000, 89, 0},
-            {8000, 90, 0},
-            {114, 91, 0},
-            {114, 92, 0},
-            {114, 93, 0},
-            {114, 94, 0},
-            {107, 95, 0},
-            {107, 96, 0},
-            {107, 97, 0},
-            {115, 98, 0},
-            {10030, 99, 0},
-            {10030, 100, 0},
-            {10030, 101, 0},
-            {10030, 102, 0},
-            {10060, 103, 0},
-            {10060, 104, 0},
-            {10060, 105, 0},
-            {10060, 106, 0},
-            {10060, 107, 0},
-            {10060, 108, 0},
-            {10060, 109, 0},
-            {10060, 110, 0},
-            {10060, 111, 0},
-            {10060, 112, 0},
-            {10060, 113, 0},
-            {10060, 114, 0},
-            {10030, 115, 0},
-            {10030, 116, 0},
-            {10030, 117, 0},
-            {10030, 118, 0},
-            {10030, 119, 0},
-            {10030, 120, 0},
-            {31, 121, 0},
-            {31, 122, 0},
-            {31, 123, 0},
-            {31, 124, 0},
-            {31, 125, 0},
-            {31, 126, 0},
-            {31, 127, 0},
-            {11, 128, 0},
-            {11, 129, 0},
-            {10110, 130, 0},
-            {10110, 131, 0},
-            {10110, 132, 0},
-            {10110, 133, 0},
-            {10110, 134, 0},
-            {10110, 135, 0},
-            {10110, 136, 0},
-            {10110, 137, 0},
-            {122, 138, 0},
-            {122, 139, 0},
-            {122, 140, 0},
-            {122, 141, 0},
-            {124, 142, 0},
-            {124, 143, 0},
-            {124, 144, 0},
-            {124, 145, 0},
-            {82, 146, 0},
-            {82, 147, 0},
-            {81, 148, 0},
-            {81, 149, 0},
-            {81, 150, 0},
-            {81, 151, 0},
-            {81, 152, 0},
-            {81, 153, 0},
-            {81, 154, 0},
-            {81, 155, 0},
-            {81, 156, 0},
-            {81, 157, 0},
-            {81, 158, 0},
-            {81, 159, 0},
-            {8004, 160, 0},
-            {8004, 161, 0},
-            {8004, 162, 0},
-            {8004, 163, 0},
-            {8000, 164, 0},
-            {8000, 165, 0},
-            {8000, 166, 0},
-            {8000, 167, 0},
-            {8000, 168, 0},
-            {8000, 169, 0},
-            {10110, 170, 0},
-            {10110, 171, 0},
-            {10110, 172, 0},
-            {10110, 173, 0},
-            {10110, 174, 0},
-            {10110, 175, 0},
-            {81, 176, 0},
-            {81, 177, 0},
-            {81, 178, 0},
-            {81, 179, 0},
-            {81, 180, 0},
-            {81, 181, 0},
-            {122, 182, 0},
-            {122, 183, 0},
-            {124, 184, 0},
-            {124, 185, 0},
-            {124, 186, 0},
-            {124, 187, 0},
-            {122, 188, 0},
-            {122, 189, 0},
-            {2, 190, 0},
-            {3, 191, 0},
-            {4, 192, 0},
-            {11, 193, 0},
-            {11, 194, 0},
-            {8010, 195, 0},
-            {123, 196, 0},
-            {10, 197, 0},
-            {8009, 198, 0},
-            {53, 199, 0},
-            {8040, 200, 0},
-            {8008, 201, 0},
-            {8005, 202, 0},
-            {8007, 203, 0},
-            {8006, 204, 0},
-            {9001, 205, 0},
-            {9001, 206, 0},
-            {9001, 207, 0},
-            {9001, 208, 0},
-            {9001, 209, 0},
-            {10030, 210, 0},
-            {10030, 211, 0},
-            {31, 212, 0},
-            {31, 213, 0},
-            {114, 214, 0},
-            {31, 215, 0},
-            {8080, 216, 0},
-            {115, 217, 0},
-            {84, 218, 0},
-            {84, 219, 0},
-            {10120, 220, 0},
-            {10120, 221, 0},
-            {9100, 222, 0},
-            {9101, 223, 0},
-            {9102, 224, 0},
-            {9103, 225, 0},
-            {11, 226, 0},
-            {11, 227, 0},
-            {11, 228, 0},
-            {11, 229, 0},
-	}},
-    },
-    {
-        {"Necropolis", {false, false, false}, {0, 0, 0}, 3, 508, {
-            {3002, 0, 0},
-            {3002, 1, 0},
-            {3000, 2, 0},
-            {3000, 3, 0},
-            {14, 4, 0},
-            {1, 5, 0},
-            {65, 6, 0},
-            {65, 7, 0},
-            {65, 8, 0},
-            {65, 9, 0},
-            {65, 10, 0},
-            {65, 11, 0},
-            {67, 12, 0},
-            {67, 13, 0},
-            {67, 14, 0},
-            {67, 15, 0},
-            {67, 16, 0},
-            {67, 17, 0},
-            {63, 18, 0},
-            {63, 19, 0},
-            {63, 20, 0},
-            {63, 21, 0},
-            {63, 22, 0},
-            {68, 23, 0},
-            {68, 24, 0},
-            {68, 25, 0},
-            {68, 26, 0},
-            {68, 27, 0},
-            {69, 28, 0},
-            {66, 29, 0},
-            {64, 30, 0},
-            {78, 31, 0},
-            {78, 32, 0},
-            {78, 33, 0},
-            {79, 34, 0},
-            {79, 35, 0},
-            {79, 36, 0},
-            {79, 37, 0},
-            {15, 38, 0},
-            {15, 39, 0},
-            {15, 40, 0},
-            {9, 41, 0},
-            {9, 42, 0},
-            {9, 43, 0},
-            {7, 44, 0},
-            {7, 45, 0},
-            {7, 46, 0},
-            {6, 47, 0},
-            {6, 48, 0},
-            {6, 49, 0},
-            {6, 50, 0},
-            {6, 51, 0},
-            {7, 52, 0},
-            {42, 53, 0},
-            {44, 54, 0},
-            {45, 55, 0},
-            {15, 56, 0},
-            {9, 57, 0},
-            {7, 58, 0},
-            {6, 59, 0},
-            {8104, 60, 0},
-            {8104, 61, 0},
-            {8104, 62, 0},
-            {8104, 63, 0},
-            {8104, 64, 0},
-            {8060, 65, 0},
-            {8060, 66, 0},
-            {8060, 67, 0},
-            {8060, 68, 0},
-            {8060, 69, 0},
-            {8060, 70, 0},
-            {8060, 71, 0},
-            {8060, 72, 0},
-            {8060, 73, 0},
-            {8060, 74, 0},
-            {107, 75, 0},
-            {8003, 76, 0},
-            {8002, 77, 0},
-            {8007, 78, 0},
-            {34, 79, 0},
-            {34, 80, 0},
-            {34, 81, 0},
-            {34, 82, 0},
-            {34, 83, 0},
-            {34, 84, 0},
-            {34, 85, 0},
-            {34, 86, 0},
-            {34, 87, 0},
-            {34, 88, 0},
-            {34, 89, 0},
-            {34, 90, 0},
-            {34, 91, 0},
-            {34, 92, 0},
-            {34, 93, 0},
-            {34, 94, 0},
-            {34, 95, 0},
-            {10011, 96, 0},
-            {10011, 97, 0},
-            {10011, 98, 0},
-            {10011, 99, 0},
-            {10011, 100, 0},
-            {10011, 101, 0},
-            {10011, 102, 0},
-            {10011, 103, 0},
-            {10011, 104, 0},
-            {10011, 105, 0},
-            {10011, 106, 0},
-            {10011, 107, 0},
-            {10011, 108, 0},
-            {10011, 109, 0},
-            {10011, 110, 0},
-            {10011, 111, 0},
-            {10011, 112, 0},
-            {10011, 113, 0},
-            {10011, 114, 0},
-            {10011, 115, 0},
-            {10011, 116, 0},
-            {10011, 117, 0},
-            {10011, 118, 0},
-            {10011, 119, 0},
-            {10011, 120, 0},
-            {10011, 121, 0},
-            {10011, 122, 0},
-            {10011, 123, 0},
-            {10011, 124, 0},
-            {10011, 125, 0},
-            {10011, 126, 0},
-            {10011, 127, 0},
-            {10011, 128, 0},
-            {10011, 129, 0},
-            {10011, 130, 0},
-            {10011, 131, 0},
-            {10011, 132, 0},
-            {10011, 133, 0},
-            {10011, 134, 0},
-            {10011, 135, 0},
-            {10011, 136, 0},
-            {10011, 137, 0},
-            {10011, 138, 0},
-            {10011, 139, 0},
-            {10011, 140, 0},
-            {10011, 141, 0},
-            {10011, 142, 0},
-            {10011, 143, 0},
-            {10011, 144, 0},
-            {107, 145, 0},
-            {107, 146, 0},
-            {107, 147, 0},
-            {107, 148, 0},
-            {107, 149, 0},
-            {107, 150, 0},
-            {107, 151, 0},
-            {107, 152, 0},
-            {107, 153, 0},
-            {107, 154, 0},
-            {107, 155, 0},
-            {107, 156, 0},
-            {107, 157, 0},
-            {107, 158, 0},
-            {107, 159, 0},
-            {107, 160, 0},
-            {107, 161, 0},
-            {107, 162, 0},
-            {107, 163, 0},
-            {107, 164, 0},
-            {107, 165, 0},
-            {114, 166, 0},
-            {114, 167, 0},
-            {114, 168, 0},
-            {114, 169, 0},
-            {114, 170, 0},
-            {114, 171, 0},
-            {114, 172, 0},
-            {114, 173, 0},
-            {114, 174, 0},
-            {114, 175, 0},
-            {114, 176, 0},
-            {114, 177, 0},
-            {114, 178, 0},
-            {114, 179, 0},
-            {114, 180, 0},
-            {114, 181, 0},
-            {114, 182, 0},
-            {114, 183, 0},
-            {114, 184, 0},
-            {114, 185, 0},
-            {114, 186, 0},
-            {114, 187, 0},
-            {114, 188, 0},
-            {8080, 189, 0},
-            {8080, 190, 0},
-            {8080, 191, 0},
-            {8080, 192, 0},
-            {8080, 193, 0},
-            {10030, 194, 0},
-            {10030, 195, 0},
-            {10030, 196, 0},
-            {10030, 197, 0},
-            {82, 198, 0},
-            {82, 199, 0},
-            {82, 200, 0},
-            {82, 201, 0},
-            {82, 202, 0},
-            {82, 203, 0},
-            {8000, 204, 0},
-            {8000, 205, 0},
-            {8000, 206, 0},
-            {8000, 207, 0},
-            {8000, 208, 0},
-            {8000, 209, 0},
-            {10110, 210, 0},
-            {10110, 211, 0},
-            {10110, 212, 0},
-            {10110, 213, 0},
-            {10110, 214, 0},
-            {10110, 215, 0},
-            {82, 216, 0},
-            {82, 217, 0},
-            {82, 218, 0},
-            {82, 219, 0},
-            {82, 220, 0},
-            {82, 221, 0},
-            {10110, 222, 0},
-            {10110, 223, 0},
-            {10110, 224, 0},
-            {10110, 225, 0},
-            {10110, 226, 0},
-            {10110, 227, 0},
-            {8000, 228, 0},
-            {8000, 229, 0},
-            {8000, 230, 0},
-            {8000, 231, 0},
-            {8000, 232, 0},
-            {8000, 233, 0},
-            {8000, 234, 0},
-            {8000, 235, 0},
-            {8000, 236, 0},
-            {8000, 237, 0},
-            {8000, 238, 0},
-            {8000, 239, 0},
-            {82, 240, 0},
-            {82, 241, 0},
-            {82, 242, 0},
-            {82, 243, 0},
-            {82, 244, 0},
-            {82, 245, 0},
-            {10110, 246, 0},
-            {10110, 247, 0},
-            {10110, 248, 0},
-            {10110, 249, 0},
-            {10110, 250, 0},
-            {10110, 251, 0},
-            {8004, 252, 0},
-            {8004, 253, 0},
-            {8004, 254, 0},
-            {8004, 255, 0},
-            {8004, 256, 0},
-            {8004, 257, 0},
-            {8004, 258, 0},
-            {8004, 259, 0},
-            {8004, 260, 0},
-            {8004, 261, 0},
-            {8004, 262, 0},
-            {8004, 263, 0},
-            {8004, 264, 0},
-            {8004, 265, 0},
-            {122, 266, 0},
-            {122, 267, 0},
-            {122, 268, 0},
-            {122, 269, 0},
-            {122, 270, 0},
-            {122, 271, 0},
-            {122, 272, 0},
-            {122, 273, 0},
-            {124, 274, 0},
-            {124, 275, 0},
-            {124, 276, 0},
-            {124, 277, 0},
-            {124, 278, 0},
-            {124, 279, 0},
-            {124, 280, 0},
-            {124, 281, 0},
-            {124, 282, 0},
-            {124, 283, 0},
-            {124, 284, 0},
-            {124, 285, 0},
-            {122, 286, 0},
-            {122, 287, 0},
-            {122, 288, 0},
-            {122, 289, 0},
-            {81, 290, 0},
-            {81, 291, 0},
-            {81, 292, 0},
-            {81, 293, 0},
-            {81, 294, 0},
-            {81, 295, 0},
-            {81, 296, 0},
-            {81, 297, 0},
-            {81, 298, 0},
-            {81, 299, 0},
-            {81, 300, 0},
-            {81, 301, 0},
-            {81, 302, 0},
-            {81, 303, 0},
-            {81, 304, 0},
-            {81, 305, 0},
-            {81, 306, 0},
-            {81, 307, 0},
-            {81, 308, 0},
-            {81, 309, 0},
-            {81, 310, 0},
-            {81, 311, 0},
-            {81, 312, 0},
-            {81, 313, 0},
-            {81, 314, 0},
-            {81, 315, 0},
-            {81, 316, 0},
-            {81, 317, 0},
-            {81, 318, 0},
-            {81, 319, 0},
-            {81, 320, 0},
-            {81, 321, 0},
-            {81, 322, 0},
-            {81, 323, 0},
-            {81, 324, 0},
-            {81, 325, 0},
-            {81, 326, 0},
-            {81, 327, 0},
-            {81, 328, 0},
-            {81, 329, 0},
-            {81, 330, 0},
-            {81, 331, 0},
-            {4, 332, 0},
-            {3, 333, 0},
-            {2, 334, 0},
-            {1, 335, 0},
-            {1, 336, 0},
-            {2, 337, 0},
-            {3, 338, 0},
-            {4, 339, 0},
-            {1, 340, 0},
-            {2, 341, 0},
-            {3, 342, 0},
-            {4, 343, 0},
-            {1, 344, 0},
-            {2, 345, 0},
-            {3, 346, 0},
-            {4, 347, 0},
-            {11, 348, 0},
-            {11, 349, 0},
-            {11, 350, 0},
-            {11, 351, 0},
-            {10, 352, 0},
-            {8010, 353, 0},
-            {53, 354, 0},
-            {8009, 355, 0},
-            {123, 356, 0},
-            {8040, 357, 0},
-            {22, 358, 0},
-            {23, 359, 0},
-            {21, 360, 0},
-            {16, 361, 0},
-            {13, 362, 0},
-            {12, 363, 0},
-            {20, 364, 0},
-            {19, 365, 0},
-            {18, 366, 0},
-            {8008, 367, 0},
-            {8005, 368, 0},
-            {8003, 369, 0},
-            {8002, 370, 0},
-            {8041, 371, 0},
-            {84, 372, 0},
-            {84, 373, 0},
-            {30, 374, 0},
-            {83, 375, 0},
-            {32, 376, 0},
-            {8007, 377, 0},
-            {8006, 378, 0},
-            {86, 379, 0},
-            {36, 380, 0},
-            {33, 381, 0},
-            {10040, 382, 0},
-            {9001, 383, 0},
-            {9001, 384, 0},
-            {9001, 385, 0},
-            {9001, 386, 0},
-            {9001, 387, 0},
-            {10011, 388, 0},
-            {10011, 389, 0},
-            {10011, 390, 0},
-            {10011, 391, 0},
-            {10011, 392, 0},
-            {10011, 393, 0},
-            {10011, 394, 0},
-            {10011, 395, 0},
-            {10011, 396, 0},
-            {10011, 397, 0},
-            {10011, 398, 0},
-            {114, 399, 0},
-            {114, 400, 0},
-            {8080, 401, 0},
-            {107, 402, 0},
-            {115, 403, 0},
-            {115, 404, 0},
-            {115, 405, 0},
-            {114, 406, 0},
-            {114, 407, 0},
-            {114, 408, 0},
-            {31, 409, 0},
-            {31, 410, 0},
-            {31, 411, 0},
-            {10120, 412, 0},
-            {10120, 413, 0},
-            {10120, 414, 0},
-            {10120, 415, 0},
-            {122, 416, 0},
-            {122, 417, 0},
-            {122, 418, 0},
-            {122, 419, 0},
-            {122, 420, 0},
-            {122, 421, 0},
-            {122, 422, 0},
-            {122, 423, 0},
-            {122, 424, 0},
-            {124, 425, 0},
-            {124, 426, 0},
-            {124, 427, 0},
-            {124, 428, 0},
-            {124, 429, 0},
-            {124, 430, 0},
-            {124, 431, 0},
-            {124, 432, 0},
-            {124, 433, 0},
-            {124, 434, 0},
-            {124, 435, 0},
-            {124, 436, 0},
-            {124, 437, 0},
-            {122, 438, 0},
-            {122, 439, 0},
-            {122, 440, 0},
-            {122, 441, 0},
-            {2, 442, 0},
-            {3, 443, 0},
-            {4, 444, 0},
-            {8004, 445, 0},
-            {8004, 446, 0},
-            {8004, 447, 0},
-            {8004, 448, 0},
-            {8004, 449, 0},
-            {8004, 450, 0},
-            {8004, 451, 0},
-            {8004, 452, 0},
-            {8004, 453, 0},
-            {8004, 454, 0},
-            {8004, 455, 0},
-            {8004, 456, 0},
-            {8004, 457, 0},
-            {8004, 458, 0},
-            {8004, 459, 0},
-            {8004, 460, 0},
-            {8004, 461, 0},
-            {8004, 462, 0},
-            {8004, 463, 0},
-            {8004, 464, 0},
-            {8004, 465, 0},
-            {8004, 466, 0},
-            {8004, 467, 0},
-            {8004, 468, 0},
-            {8004, 469, 0},
-            {8004, 470, 0},
-            {8004, 471, 0},
-            {8004, 472, 0},
-            {8004, 473, 0},
-            {8004, 474, 0},
-            {8004, 475, 0},
-            {8004, 476, 0},
-            {8004, 477, 0},
-            {10, 478, 0},
-            {8010, 479, 0},
-            {53, 480, 0},
-            {8040, 481, 0},
-            {123, 482, 0},
-            {8009, 483, 0},
-            {11, 484, 0},
-            {11, 485, 0},
-            {11, 486, 0},
-            {11, 487, 0},
-            {9100, 488, 0},
-            {9101, 489, 0},
-            {9102, 490, 0},
-            {9103, 491, 0},
-            {9100, 492, 0},
-            {9101, 493, 0},
-            {9102, 494, 0},
-            {9103, 495, 0},
-            {9100, 496, 0},
-            {9101, 497, 0},
-            {9102, 498, 0},
-            {9103, 499, 0},
-            {9100, 500, 0},
-            {9101, 501, 0},
-            {9102, 502, 0},
-            {9103, 503, 0},
-            {9100, 504, 0},
-            {9101, 505, 0},
-            {9102, 506, 0},
-            {9103, 507, 0},
-	}},
-        {"Zedek's Tomb", {false, false, false}, {0, 0, 0}, 7, 294, {
-            {1, 0, 0},
-            {3002, 1, 0},
-            {3002, 2, 0},
-            {3002, 3, 0},
-            {3002, 4, 0},
-            {3002, 5, 0},
-            {3002, 6, 0},
-            {3002, 7, 0},
-            {3002, 8, 0},
-            {3002, 9, 0},
-            {3002, 10, 0},
-            {3000, 11, 0},
-            {3000, 12, 0},
-            {3000, 13, 0},
-            {3000, 14, 0},
-            {3000, 15, 0},
-            {3000, 16, 0},
-            {3000, 17, 0},
-            {3000, 18, 0},
-            {3000, 19, 0},
-            {3000, 20, 0},
-            {3002, 21, 0},
-            {3000, 22, 0},
-            {14, 23, 0},
-            {3000, 24, 0},
-            {3000, 25, 0},
-            {3000, 26, 0},
-            {3002, 27, 0},
-            {3002, 28, 0},
-            {3002, 29, 0},
-            {3001, 30, 0},
-            {3001, 31, 0},
-            {3001, 32, 0},
-            {3000, 33, 0},
-            {3000, 34, 0},
-            {3000, 35, 0},
-            {10100, 36, 0},
-            {54, 37, 0},
-            {54, 38, 0},
-            {54, 39, 0},
-            {54, 40, 0},
-            {54, 41, 0},
-            {54, 42, 0},
-            {54, 43, 0},
-            {54, 44, 0},
-            {54, 45, 0},
-            {54, 46, 0},
-            {54, 47, 0},
-            {54, 48, 0},
-            {54, 49, 0},
-            {54, 50, 0},
-            {54, 51, 0},
-            {54, 52, 0},
-            {54, 53, 0},
-            {54, 54, 0},
-            {54, 55, 0},
-            {54, 56, 0},
-            {54, 57, 0},
-            {54, 58, 0},
-            {54, 59, 0},
-            {54, 60, 0},
-            {54, 61, 0},
-            {54, 62, 0},
-            {54, 63, 0},
-            {54, 64, 0},
-            {54, 65, 0},
-            {54, 66, 0},
-            {54, 67, 0},
-            {54, 68, 0},
-            {54, 69, 0},
-            {54, 70, 0},
-            {54, 71, 0},
-            {54, 72, 0},
-            {54, 73, 0},
-            {54, 74, 0},
-            {54, 75, 0},
-            {54, 76, 0},
-            {54, 77, 0},
-            {54, 78, 0},
-            {54, 79, 0},
-            {54, 80, 0},
-            {54, 81, 0},
-            {54, 82, 0},
-            {54, 83, 0},
-            {54, 84, 0},
-            {54, 85, 0},
-            {54, 86, 0},
-            {8005, 87, 0},
-            {30, 88, 0},
-            {10040, 89, 0},
-            {16, 90, 0},
-            {13, 91, 0},
-            {12, 92, 0},
-            {107, 93, 0},
-            {107, 94, 0},
-            {115, 95, 0},
-            {115, 96, 0},
-            {115, 97, 0},
-            {107, 98, 0},
-            {107, 99, 0},
-            {107, 100, 0},
-            {107, 101, 0},
-            {107, 102, 0},
-            {107, 103, 0},
-            {107, 104, 0},
-            {107, 105, 0},
-            {107, 106, 0},
-            {107, 107, 0},
-            {107, 108, 0},
-            {107, 109, 0},
-            {115, 110, 0},
-            {115, 111, 0},
-            {115, 112, 0},
-            {115, 113, 0},
-            {107, 114, 0},
-            {107, 115, 0},
-            {107, 116, 0},
-            {107, 117, 0},
-            {107, 118, 0},
-            {107, 119, 0},
-            {107, 120, 0},
-            {107, 121, 0},
-            {107, 122, 0},
-            {107, 123, 0},
-            {107, 124, 0},
-            {107, 125, 0},
-            {107, 126, 0},
-            {107, 127, 0},
-            {107, 128, 0},
-            {107, 129, 0},
-            {107, 130, 0},
-            {107, 131, 0},
-            {107, 132, 0},
-            {107, 133, 0},
-            {107, 134, 0},
-            {107, 135, 0},
-            {107, 136, 0},
-            {107, 137, 0},
-            {107, 138, 0},
-            {107, 139, 0},
-            {115, 140, 0},
-            {115, 141, 0},
-            {115, 142, 0},
-            {115, 143, 0},
-            {107, 144, 0},
-            {107, 145, 0},
-            {107, 146, 0},
-            {107, 147, 0},
-            {107, 148, 0},
-            {107, 149, 0},
-            {107, 150, 0},
-            {107, 151, 0},
-            {107, 152, 0},
-            {107, 153, 0},
-            {107, 154, 0},
-            {107, 155, 0},
-            {107, 156, 0},
-            {122, 157, 0},
-            {122, 158, 0},
-            {122, 159, 0},
-            {124, 160, 0},
-            {124, 161, 0},
-            {124, 162, 0},
-            {124, 163, 0},
-            {124, 164, 0},
-            {124, 165, 0},
-            {124, 166, 0},
-            {124, 167, 0},
-            {124, 168, 0},
-            {124, 169, 0},
-            {124, 170, 0},
-            {122, 171, 0},
-            {122, 172, 0},
-            {122, 173, 0},
-            {122, 174, 0},
-            {122, 175, 0},
-            {122, 176, 0},
-            {122, 177, 0},
-            {122, 178, 0},
-            {122, 179, 0},
-            {122, 180, 0},
-            {122, 181, 0},
-            {122, 182, 0},
-            {122, 183, 0},
-            {122, 184, 0},
-            {122, 185, 0},
-            {122, 186, 0},
-            {8000, 187, 0},
-            {8000, 188, 0},
-            {8000, 189, 0},
-            {8000, 190, 0},
-            {8000, 191, 0},
-            {8000, 192, 0},
-            {81, 193, 0},
-            {81, 194, 0},
-            {81, 195, 0},
-            {81, 196, 0},
-            {81, 197, 0},
-            {81, 198, 0},
-            {81, 199, 0},
-            {81, 200, 0},
-            {10110, 201, 0},
-            {10110, 202, 0},
-            {10110, 203, 0},
-            {10110, 204, 0},
-            {10110, 205, 0},
-            {10110, 206, 0},
-            {10110, 207, 0},
-            {10110, 208, 0},
-            {10110, 209, 0},
-            {10110, 210, 0},
-            {10110, 211, 0},
-            {10110, 212, 0},
-            {8000, 213, 0},
-            {8000, 214, 0},
-            {8000, 215, 0},
-            {8000, 216, 0},
-            {8000, 217, 0},
-            {8000, 218, 0},
-            {8000, 219, 0},
-            {8000, 220, 0},
-            {81, 221, 0},
-            {81, 222, 0},
-            {81, 223, 0},
-            {81, 224, 0},
-            {81, 225, 0},
-            {81, 226, 0},
-            {81, 227, 0},
-            {81, 228, 0},
-            {81, 229, 0},
-            {81, 230, 0},
-            {124, 231, 0},
-            {124, 232, 0},
-            {124, 233, 0},
-            {124, 234, 0},
-            {124, 235, 0},
-            {124, 236, 0},
-            {124, 237, 0},
-            {124, 238, 0},
-            {2, 239, 0},
-            {3, 240, 0},
-            {4, 241, 0},
-            {9015, 242, 0},
-            {11, 243, 0},
-            {11, 244, 0},
-            {11, 245, 0},
-            {11, 246, 0},
-            {10, 247, 0},
-            {8010, 248, 0},
-            {53, 249, 0},
-            {8009, 250, 0},
-            {123, 251, 0},
-            {8040, 252, 0},
-            {20, 253, 0},
-            {16, 254, 0},
-            {23, 255, 0},
-            {13, 256, 0},
-            {12, 257, 0},
-            {22, 258, 0},
-            {21, 259, 0},
-            {19, 260, 0},
-            {18, 261, 0},
-            {8008, 262, 0},
-            {8005, 263, 0},
-            {8041, 264, 0},
-            {8006, 265, 0},
-            {86, 266, 0},
-            {36, 267, 0},
-            {10040, 268, 0},
-            {9001, 269, 0},
-            {9001, 270, 0},
-            {9001, 271, 0},
-            {9001, 272, 0},
-            {9001, 273, 0},
-            {115, 274, 0},
-            {115, 275, 0},
-            {115, 276, 0},
-            {115, 277, 0},
-            {115, 278, 0},
-            {115, 279, 0},
-            {107, 280, 0},
-            {84, 281, 0},
-            {84, 282, 0},
-            {10120, 283, 0},
-            {10120, 284, 0},
-            {10120, 285, 0},
-            {11, 286, 0},
-            {11, 287, 0},
-            {11, 288, 0},
-            {11, 289, 0},
-            {9100, 290, 0},
-            {9101, 291, 0},
-            {9102, 292, 0},
-            {9103, 293, 0},
-	}},
-        {"Melenkir's Tomb", {false, false, false}, {0, 0, 0}, 6, 253, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {11, 4, 0},
-            {11, 5, 0},
-            {11, 6, 0},
-            {11, 7, 0},
-            {118, 8, 0},
-            {118, 9, 0},
-            {118, 10, 0},
-            {118, 11, 0},
-            {118, 12, 0},
-            {118, 13, 0},
-            {118, 14, 0},
-            {118, 15, 0},
-            {118, 16, 0},
-            {118, 17, 0},
-            {118, 18, 0},
-            {118, 19, 0},
-            {118, 20, 0},
-            {10102, 21, 0},
-            {9001, 22, 0},
-            {9001, 23, 0},
-            {9001, 24, 0},
-            {9001, 25, 0},
-            {9001, 26, 0},
-            {9001, 27, 0},
-            {9001, 28, 0},
-            {9001, 29, 0},
-            {9001, 30, 0},
-            {9001, 31, 0},
-            {9001, 32, 0},
-            {9001, 33, 0},
-            {9001, 34, 0},
-            {9001, 35, 0},
-            {9001, 36, 0},
-            {9001, 37, 0},
-            {9001, 38, 0},
-            {9001, 39, 0},
-            {9001, 40, 0},
-            {9001, 41, 0},
-            {9001, 42, 0},
-            {9001, 43, 0},
-            {9001, 44, 0},
-            {9001, 45, 0},
-            {9001, 46, 0},
-            {9001, 47, 0},
-            {9001, 48, 0},
-            {9001, 49, 0},
-            {9001, 50, 0},
-            {9001, 51, 0},
-            {9001, 52, 0},
-            {9001, 53, 0},
-            {9001, 54, 0},
-            {9001, 55, 0},
-            {9001, 56, 0},
-            {9001, 57, 0},
-            {23, 58, 0},
-            {22, 59, 0},
-            {21, 60, 0},
-            {32, 61, 0},
-            {8041, 62, 0},
-            {121, 63, 0},
-            {121, 64, 0},
-            {121, 65, 0},
-            {121, 66, 0},
-            {120, 67, 0},
-            {120, 68, 0},
-            {114, 69, 0},
-            {114, 70, 0},
-            {114, 71, 0},
-            {114, 72, 0},
-            {114, 73, 0},
-            {114, 74, 0},
-            {114, 75, 0},
-            {114, 76, 0},
-            {114, 77, 0},
-            {114, 78, 0},
-            {114, 79, 0},
-            {114, 80, 0},
-            {8080, 81, 0},
-            {8080, 82, 0},
-            {8080, 83, 0},
-            {8080, 84, 0},
-            {8080, 85, 0},
-            {8080, 86, 0},
-            {8080, 87, 0},
-            {8080, 88, 0},
-            {10060, 89, 0},
-            {10060, 90, 0},
-            {10060, 91, 0},
-            {10060, 92, 0},
-            {10060, 93, 0},
-            {10060, 94, 0},
-            {10060, 95, 0},
-            {10060, 96, 0},
-            {8000, 97, 0},
-            {8000, 98, 0},
-            {8000, 99, 0},
-            {8000, 100, 0},
-            {8000, 101, 0},
-            {8000, 102, 0},
-            {8000, 103, 0},
-            {8000, 104, 0},
-            {8000, 105, 0},
-            {8000, 106, 0},
-            {8000, 107, 0},
-            {8000, 108, 0},
-            {10030, 109, 0},
-            {10030, 110, 0},
-            {10030, 111, 0},
-            {10030, 112, 0},
-            {10030, 113, 0},
-            {10030, 114, 0},
-            {10030, 115, 0},
-            {10030, 116, 0},
-            {10030, 117, 0},
-            {10030, 118, 0},
-            {10030, 119, 0},
-            {10030, 120, 0},
-            {10110, 121, 0},
-            {10110, 122, 0},
-            {10110, 123, 0},
-            {10110, 124, 0},
-            {10110, 125, 0},
-            {10110, 126, 0},
-            {122, 127, 0},
-            {122, 128, 0},
-            {122, 129, 0},
-            {122, 130, 0},
-            {122, 131, 0},
-            {122, 132, 0},
-            {122, 133, 0},
-            {122, 134, 0},
-            {81, 135, 0},
-            {81, 136, 0},
-            {81, 137, 0},
-            {81, 138, 0},
-            {81, 139, 0},
-            {81, 140, 0},
-            {82, 141, 0},
-            {82, 142, 0},
-            {82, 143, 0},
-            {82, 144, 0},
-            {81, 145, 0},
-            {81, 146, 0},
-            {81, 147, 0},
-            {81, 148, 0},
-            {81, 149, 0},
-            {81, 150, 0},
-            {82, 151, 0},
-            {82, 152, 0},
-            {82, 153, 0},
-            {82, 154, 0},
-            {82, 155, 0},
-            {82, 156, 0},
-            {82, 157, 0},
-            {82, 158, 0},
-            {10110, 159, 0},
-            {10110, 160, 0},
-            {10110, 161, 0},
-            {10110, 162, 0},
-            {10110, 163, 0},
-            {10110, 164, 0},
-            {10110, 165, 0},
-            {10110, 166, 0},
-            {8000, 167, 0},
-            {8000, 168, 0},
-            {8000, 169, 0},
-            {8000, 170, 0},
-            {8000, 171, 0},
-            {8000, 172, 0},
-            {8000, 173, 0},
-            {8000, 174, 0},
-            {8000, 175, 0},
-            {8000, 176, 0},
-            {8000, 177, 0},
-            {8000, 178, 0},
-            {81, 179, 0},
-            {81, 180, 0},
-            {81, 181, 0},
-            {81, 182, 0},
-            {81, 183, 0},
-            {81, 184, 0},
-            {81, 185, 0},
-            {81, 186, 0},
-            {81, 187, 0},
-            {81, 188, 0},
-            {81, 189, 0},
-            {81, 190, 0},
-            {81, 191, 0},
-            {81, 192, 0},
-            {81, 193, 0},
-            {81, 194, 0},
-            {81, 195, 0},
-            {81, 196, 0},
-            {81, 197, 0},
-            {81, 198, 0},
-            {81, 199, 0},
-            {81, 200, 0},
-            {81, 201, 0},
-            {81, 202, 0},
-            {9017, 203, 0},
-            {20, 204, 0},
-            {19, 205, 0},
-            {18, 206, 0},
-            {16, 207, 0},
-            {13, 208, 0},
-            {12, 209, 0},
-            {23, 210, 0},
-            {22, 211, 0},
-            {21, 212, 0},
-            {8008, 213, 0},
-            {8005, 214, 0},
-            {8006, 215, 0},
-            {8007, 216, 0},
-            {10040, 217, 0},
-            {10, 218, 0},
-            {8010, 219, 0},
-            {53, 220, 0},
-            {8009, 221, 0},
-            {123, 222, 0},
-            {8040, 223, 0},
-            {20, 224, 0},
-            {9001, 225, 0},
-            {9001, 226, 0},
-            {9001, 227, 0},
-            {9001, 228, 0},
-            {9001, 229, 0},
-            {120, 230, 0},
-            {120, 231, 0},
-            {114, 232, 0},
-            {114, 233, 0},
-            {114, 234, 0},
-            {114, 235, 0},
-            {114, 236, 0},
-            {114, 237, 0},
-            {10060, 238, 0},
-            {10060, 239, 0},
-            {84, 240, 0},
-            {84, 241, 0},
-            {10120, 242, 0},
-            {10120, 243, 0},
-            {10120, 244, 0},
-            {9100, 245, 0},
-            {9101, 246, 0},
-            {9102, 247, 0},
-            {9103, 248, 0},
-            {11, 249, 0},
-            {11, 250, 0},
-            {11, 251, 0},
-            {11, 252, 0},
-	}},
-        {"Traductus' Tomb", {false, false, false}, {0, 0, 0}, 6, 180, {
-            {1, 0, 0},
-            {14, 1, 0},
-            {10101, 2, 0},
-            {10030, 3, 0},
-            {10030, 4, 0},
-            {10030, 5, 0},
-            {8006, 6, 0},
-            {84, 7, 0},
-            {20, 8, 0},
-            {19, 9, 0},
-            {18, 10, 0},
-            {114, 11, 0},
-            {114, 12, 0},
-            {114, 13, 0},
-            {114, 14, 0},
-            {114, 15, 0},
-            {114, 16, 0},
-            {114, 17, 0},
-            {114, 18, 0},
-            {114, 19, 0},
-            {114, 20, 0},
-            {114, 21, 0},
-            {10030, 22, 0},
-            {10030, 23, 0},
-            {10030, 24, 0},
-            {10030, 25, 0},
-            {114, 26, 0},
-            {114, 27, 0},
-            {114, 28, 0},
-            {114, 29, 0},
-            {114, 30, 0},
-            {114, 31, 0},
-            {114, 32, 0},
-            {114, 33, 0},
-            {114, 34, 0},
-            {114, 35, 0},
-            {114, 36, 0},
-            {114, 37, 0},
-            {114, 38, 0},
-            {114, 39, 0},
-            {114, 40, 0},
-            {114, 41, 0},
-            {114, 42, 0},
-            {114, 43, 0},
-            {114, 44, 0},
-            {114, 45, 0},
-            {114, 46, 0},
-            {114, 47, 0},
-            {114, 48, 0},
-            {114, 49, 0},
-            {114, 50, 0},
-            {114, 51, 0},
-            {114, 52, 0},
-            {114, 53, 0},
-            {114, 54, 0},
-            {114, 55, 0},
-            {114, 56, 0},
-            {8080, 57, 0},
-            {8080, 58, 0},
-            {8080, 59, 0},
-            {8080, 60, 0},
-            {8080, 61, 0},
-            {8080, 62, 0},
-            {114, 63, 0},
-            {114, 64, 0},
-            {114, 65, 0},
-            {114, 66, 0},
-            {81, 67, 0},
-            {81, 68, 0},
-            {81, 69, 0},
-            {81, 70, 0},
-            {81, 71, 0},
-            {81, 72, 0},
-            {81, 73, 0},
-            {81, 74, 0},
-            {81, 75, 0},
-            {81, 76, 0},
-            {81, 77, 0},
-            {82, 78, 0},
-            {82, 79, 0},
-            {82, 80, 0},
-            {82, 81, 0},
-            {10110, 82, 0},
-            {10110, 83, 0},
-            {10110, 84, 0},
-            {10110, 85, 0},
-            {10110, 86, 0},
-            {10110, 87, 0},
-            {10110, 88, 0},
-            {10110, 89, 0},
-            {10110, 90, 0},
-            {10110, 91, 0},
-            {10110, 92, 0},
-            {10110, 93, 0},
-            {10110, 94, 0},
-            {10110, 95, 0},
-            {8000, 96, 0},
-            {8000, 97, 0},
-            {8000, 98, 0},
-            {8000, 99, 0},
-            {8000, 100, 0},
-            {114, 101, 0},
-            {114, 102, 0},
-            {114, 103, 0},
-            {114, 104, 0},
-            {82, 105, 0},
-            {82, 106, 0},
-            {82, 107, 0},
-            {82, 108, 0},
-            {82, 109, 0},
-            {82, 110, 0},
-            {81, 111, 0},
-            {81, 112, 0},
-            {81, 113, 0},
-            {81, 114, 0},
-            {81, 115, 0},
-            {81, 116, 0},
-            {8000, 117, 0},
-            {8000, 118, 0},
-            {8000, 119, 0},
-            {8000, 120, 0},
-            {8000, 121, 0},
-            {8000, 122, 0},
-            {10110, 123, 0},
-            {10110, 124, 0},
-            {10110, 125, 0},
-            {10110, 126, 0},
-            {10110, 127, 0},
-            {10110, 128, 0},
-            {10110, 129, 0},
-            {10110, 130, 0},
-            {4, 131, 0},
-            {3, 132, 0},
-            {2, 133, 0},
-            {9016, 134, 0},
-            {11, 135, 0},
-            {11, 136, 0},
-            {11, 137, 0},
-            {11, 138, 0},
-            {10, 139, 0},
-            {8010, 140, 0},
-            {53, 141, 0},
-            {8009, 142, 0},
-            {123, 143, 0},
-            {8040, 144, 0},
-            {20, 145, 0},
-            {19, 146, 0},
-            {18, 147, 0},
-            {16, 148, 0},
-            {13, 149, 0},
-            {12, 150, 0},
-            {23, 151, 0},
-            {22, 152, 0},
-            {21, 153, 0},
-            {9001, 154, 0},
-            {9001, 155, 0},
-            {9001, 156, 0},
-            {9001, 157, 0},
-            {9001, 158, 0},
-            {114, 159, 0},
-            {114, 160, 0},
-            {8080, 161, 0},
-            {8080, 162, 0},
-            {114, 163, 0},
-            {114, 164, 0},
-            {114, 165, 0},
-            {114, 166, 0},
-            {84, 167, 0},
-            {84, 168, 0},
-            {10120, 169, 0},
-            {10120, 170, 0},
-            {10120, 171, 0},
-            {11, 172, 0},
-            {11, 173, 0},
-            {11, 174, 0},
-            {11, 175, 0},
-            {9100, 176, 0},
-            {9101, 177, 0},
-            {9102, 178, 0},
-            {9103, 179, 0},
-	}},
-        {"Vivarium", {false, false, false}, {0, 0, 0}, 11, 360, {
-            {1, 0, 0},
-            {3001, 1, 0},
-            {3000, 2, 0},
-            {3000, 3, 0},
-            {3002, 4, 0},
-            {3001, 5, 0},
-            {9001, 6, 0},
-            {9001, 7, 0},
-            {9001, 8, 0},
-            {9001, 9, 0},
-            {11, 10, 0},
-            {11, 11, 0},
-            {11, 12, 0},
-            {11, 13, 0},
-            {10090, 14, 0},
-            {10090, 15, 0},
-            {10090, 16, 0},
-            {10090, 17, 0},
-            {10090, 18, 0},
-            {10090, 19, 0},
-            {1402, 20, 0},
-            {1402, 21, 0},
-            {1402, 22, 0},
-            {1402, 23, 0},
-            {1400, 24, 0},
-            {8060, 25, 0},
-            {8060, 26, 0},
-            {8060, 27, 0},
-            {8060, 28, 0},
-            {8060, 29, 0},
-            {8060, 30, 0},
-            {8060, 31, 0},
-            {8060, 32, 0},
-            {8061, 33, 0},
-            {8061, 34, 0},
-            {8061, 35, 0},
-            {8061, 36, 0},
-            {8061, 37, 0},
-            {8061, 38, 0},
-            {8061, 39, 0},
-            {8061, 40, 0},
-            {8043, 41, 0},
-            {1404, 42, 0},
-            {55, 43, 0},
-            {55, 44, 0},
-            {55, 45, 0},
-            {55, 46, 0},
-            {55, 47, 0},
-            {55, 48, 0},
-            {55, 49, 0},
-            {55, 50, 0},
-            {8060, 51, 0},
-            {8060, 52, 0},
-            {8060, 53, 0},
-            {8060, 54, 0},
-            {8060, 55, 0},
-            {8060, 56, 0},
-            {8060, 57, 0},
-            {8060, 58, 0},
-            {8061, 59, 0},
-            {8061, 60, 0},
-            {8061, 61, 0},
-            {8061, 62, 0},
-            {8061, 63, 0},
-            {8061, 64, 0},
-            {8061, 65, 0},
-            {8061, 66, 0},
-            {8061, 67, 0},
-            {8061, 68, 0},
-            {8061, 69, 0},
-            {8061, 70, 0},
-            {8047, 71, 0},
-            {8047, 72, 0},
-            {8047, 73, 0},
-            {8047, 74, 0},
-            {8047, 75, 0},
-            {8051, 76, 0},
-            {8051, 77, 0},
-            {8051, 78, 0},
-            {8051, 79, 0},
-            {8047, 80, 0},
-            {8047, 81, 0},
-            {8047, 82, 0},
-            {8047, 83, 0},
-            {8047, 84, 0},
-            {8051, 85, 0},
-            {8047, 86, 0},
-            {8051, 87, 0},
-            {8047, 88, 0},
-            {8047, 89, 0},
-            {3000, 90, 0},
-            {116, 91, 0},
-            {116, 92, 0},
-            {116, 93, 0},
-            {116, 94, 0},
-            {116, 95, 0},
-            {116, 96, 0},
-            {116, 97, 0},
-            {116, 98, 0},
-            {116, 99, 0},
-            {116, 100, 0},
-            {116, 101, 0},
-            {116, 102, 0},
-            {8041, 103, 0},
-            {32, 104, 0},
-            {10110, 105, 0},
-            {10110, 106, 0},
-            {10110, 107, 0},
-            {10110, 108, 0},
-            {8008, 109, 0},
-            {8005, 110, 0},
-            {8007, 111, 0},
-            {8006, 112, 0},
-            {10040, 113, 0},
-            {81, 114, 0},
-            {81, 115, 0},
-            {81, 116, 0},
-            {81, 117, 0},
-            {81, 118, 0},
-            {81, 119, 0},
-            {81, 120, 0},
-            {81, 121, 0},
-            {81, 122, 0},
-            {81, 123, 0},
-            {81, 124, 0},
-            {81, 125, 0},
-            {81, 126, 0},
-            {81, 127, 0},
-            {81, 128, 0},
-            {81, 129, 0},
-            {8004, 130, 0},
-            {8004, 131, 0},
-            {8004, 132, 0},
-            {8004, 133, 0},
-            {8004, 134, 0},
-            {8004, 135, 0},
-            {8004, 136, 0},
-            {8004, 137, 0},
-            {8000, 138, 0},
-            {8000, 139, 0},
-            {8000, 140, 0},
-            {8000, 141, 0},
-            {8000, 142, 0},
-            {8000, 143, 0},
-            {8000, 144, 0},
-            {8000, 145, 0},
-            {8000, 146, 0},
-            {8000, 147, 0},
-            {8000, 148, 0},
-            {8000, 149, 0},
-            {8000, 150, 0},
-            {8000, 151, 0},
-            {8000, 152, 0},
-            {8000, 153, 0},
-            {8000, 154, 0},
-            {8000, 155, 0},
-            {8000, 156, 0},
-            {8000, 157, 0},
-            {8000, 158, 0},
-            {8000, 159, 0},
-            {8000, 160, 0},
-            {8000, 161, 0},
-            {8000, 162, 0},
-            {10, 163, 0},
-            {8010, 164, 0},
-            {53, 165, 0},
-            {8009, 166, 0},
-            {123, 167, 0},
-            {8040, 168, 0},
-            {20, 169, 0},
-            {19, 170, 0},
-            {18, 171, 0},
-            {21, 172, 0},
-            {22, 173, 0},
-            {23, 174, 0},
-            {16, 175, 0},
-            {13, 176, 0},
-            {12, 177, 0},
-            {86, 178, 0},
-            {30, 179, 0},
-            {8047, 180, 0},
-            {9001, 181, 0},
-            {9001, 182, 0},
-            {9001, 183, 0},
-            {9001, 184, 0},
-            {9001, 185, 0},
-            {107, 186, 0},
-            {107, 187, 0},
-            {107, 188, 0},
-            {107, 189, 0},
-            {115, 190, 0},
-            {115, 191, 0},
-            {115, 192, 0},
-            {107, 193, 0},
-            {107, 194, 0},
-            {107, 195, 0},
-            {107, 196, 0},
-            {115, 197, 0},
-            {31, 198, 0},
-            {31, 199, 0},
-            {31, 200, 0},
-            {31, 201, 0},
-            {31, 202, 0},
-            {31, 203, 0},
-            {31, 204, 0},
-            {31, 205, 0},
-            {31, 206, 0},
-            {31, 207, 0},
-            {31, 208, 0},
-            {31, 209, 0},
-            {31, 210, 0},
-            {31, 211, 0},
-            {115, 212, 0},
-            {115, 213, 0},
-            {107, 214, 0},
-            {107, 215, 0},
-            {107, 216, 0},
-            {107, 217, 0},
-            {107, 218, 0},
-            {107, 219, 0},
-            {31, 220, 0},
-            {31, 221, 0},
-            {31, 222, 0},
-            {31, 223, 0},
-            {107, 224, 0},
-            {107, 225, 0},
-            {107, 226, 0},
-            {115, 227, 0},
-            {115, 228, 0},
-            {114, 229, 0},
-            {114, 230, 0},
-            {114, 231, 0},
-            {114, 232, 0},
-            {114, 233, 0},
-            {114, 234, 0},
-            {114, 235, 0},
-            {114, 236, 0},
-            {114, 237, 0},
-            {114, 238, 0},
-            {8080, 239, 0},
-            {8080, 240, 0},
-            {8080, 241, 0},
-            {8080, 242, 0},
-            {8080, 243, 0},
-            {8080, 244, 0},
-            {8080, 245, 0},
-            {8080, 246, 0},
-            {8080, 247, 0},
-            {8080, 248, 0},
-            {8080, 249, 0},
-            {10030, 250, 0},
-            {10030, 251, 0},
-            {10030, 252, 0},
-            {10030, 253, 0},
-            {10030, 254, 0},
-            {10030, 255, 0},
-            {10030, 256, 0},
-            {10030, 257, 0},
-            {10030, 258, 0},
-            {10030, 259, 0},
-            {10030, 260, 0},
-            {10030, 261, 0},
-            {10030, 262, 0},
-            {10030, 263, 0},
-            {10030, 264, 0},
-            {8080, 265, 0},
-            {8080, 266, 0},
-            {8080, 267, 0},
-            {10030, 268, 0},
-            {10030, 269, 0},
-            {10030, 270, 0},
-            {10030, 271, 0},
-            {8080, 272, 0},
-            {8080, 273, 0},
-            {8080, 274, 0},
-            {8080, 275, 0},
-            {8080, 276, 0},
-            {8080, 277, 0},
-            {34, 278, 0},
-            {34, 279, 0},
-            {34, 280, 0},
-            {34, 281, 0},
-            {34, 282, 0},
-            {34, 283, 0},
-            {34, 284, 0},
-            {34, 285, 0},
-            {34, 286, 0},
-            {34, 287, 0},
-            {34, 288, 0},
-            {34, 289, 0},
-            {34, 290, 0},
-            {10060, 291, 0},
-            {10060, 292, 0},
-            {10060, 293, 0},
-            {10060, 294, 0},
-            {10060, 295, 0},
-            {10060, 296, 0},
-            {10060, 297, 0},
-            {10060, 298, 0},
-            {10060, 299, 0},
-            {10060, 300, 0},
-            {10060, 301, 0},
-            {10060, 302, 0},
-            {10060, 303, 0},
-            {10060, 304, 0},
-            {10060, 305, 0},
-            {10060, 306, 0},
-            {10060, 307, 0},
-            {10060, 308, 0},
-            {10060, 309, 0},
-            {10060, 310, 0},
-            {10060, 311, 0},
-            {10060, 312, 0},
-            {10060, 313, 0},
-            {10060, 314, 0},
-            {10060, 315, 0},
-            {10060, 316, 0},
-            {10060, 317, 0},
-            {10060, 318, 0},
-            {10060, 319, 0},
-            {10060, 320, 0},
-            {8020, 321, 0},
-            {8020, 322, 0},
-            {8020, 323, 0},
-            {8020, 324, 0},
-            {8020, 325, 0},
-            {8020, 326, 0},
-            {8020, 327, 0},
-            {84, 328, 0},
-            {84, 329, 0},
-            {10120, 330, 0},
-            {10120, 331, 0},
-            {10120, 332, 0},
-            {10120, 333, 0},
-            {122, 334, 0},
-            {122, 335, 0},
-            {122, 336, 0},
-            {122, 337, 0},
-            {122, 338, 0},
-            {124, 339, 0},
-            {124, 340, 0},
-            {124, 341, 0},
-            {124, 342, 0},
-            {124, 343, 0},
-            {8004, 344, 0},
-            {8004, 345, 0},
-            {8004, 346, 0},
-            {8004, 347, 0},
-            {8004, 348, 0},
-            {2, 349, 0},
-            {3, 350, 0},
-            {4, 351, 0},
-            {11, 352, 0},
-            {11, 353, 0},
-            {11, 354, 0},
-            {11, 355, 0},
-            {9100, 356, 0},
-            {9101, 357, 0},
-            {9102, 358, 0},
-            {9103, 359, 0},
-	}},
-        {"Dark Crucible", {false, false, false}, {0, 0, 0}, 8, 488, {
-            {1, 0, 0},
-            {2, 1, 0},
-            {3, 2, 0},
-            {4, 3, 0},
-            {8060, 4, 0},
-            {8060, 5, 0},
-            {8060, 6, 0},
-            {8060, 7, 0},
-            {8060, 8, 0},
-            {8060, 9, 0},
-            {8060, 10, 0},
-            {8060, 11, 0},
-            {10503, 12, 0},
-            {10503, 13, 0},
-            {10503, 14, 0},
-            {10503, 15, 0},
-            {10503, 16, 0},
-            {10503, 17, 0},
-            {10503, 18, 0},
-            {10503, 19, 0},
-            {10503, 20, 0},
-            {10503, 21, 0},
-            {10503, 22, 0},
-            {10503, 23, 0},
-            {10503, 24, 0},
-            {10503, 25, 0},
-            {10503, 26, 0},
-            {10503, 27, 0},
-            {10503, 28, 0},
-            {10503, 29, 0},
-            {10503, 30, 0},
-            {10503, 31, 0},
-            {10503, 32, 0},
-            {10503, 33, 0},
-            {10503, 34, 0},
-            {10503, 35, 0},
-            {10503, 36, 0},
-            {10503, 37, 0},
-            {10503, 38, 0},
-            {10503, 39, 0},
-            {10503, 40, 0},
-            {10503, 41, 0},
-            {10503, 42, 0},
-            {10503, 43, 0},
-            {10503, 44, 0},
-            {10503, 45, 0},
-            {10503, 46, 0},
-            {10503, 47, 0},
-            {10503, 48, 0},
-            {10503, 49, 0},
-            {10503, 50, 0},
-            {10503, 51, 0},
-            {10503, 52, 0},
-            {10503, 53, 0},
-            {10503, 54, 0},
-            {10503, 55, 0},
-            {10503, 56, 0},
-            {10503, 57, 0},
-            {10503, 58, 0},
-            {10503, 59, 0},
-            {10503, 60, 0},
-            {10503, 61, 0},
-            {10503, 62, 0},
-            {10503, 63, 0},
-            {10503, 64, 0},
-            {10503, 65, 0},
-            {10503, 66, 0},
-            {10503, 67, 0},
-            {10503, 68, 0},
-            {10503, 69, 0},
-            {10503, 70, 0},
-            {10503, 71, 0},
-            {10503, 72, 0},
-            {10503, 73, 0},
-            {10503, 74, 0},
-            {10503, 75, 0},
-            {10503, 76, 0},
-            {9001, 77, 0},
-            {9001, 78, 0},
-            {9001, 79, 0},
-            {9001, 80, 0},
-            {9001, 81, 0},
-            {9001, 82, 0},
-            {9001, 83, 0},
-            {9001, 84, 0},
-            {9001, 85, 0},
-            {9001, 86, 0},
-            {9001, 87, 0},
-            {9001, 88, 0},
-            {9001, 89, 0},
-            {9001, 90, 0},
-            {9001, 91, 0},
-            {9001, 92, 0},
-            {8060, 93, 0},
-            {8060, 94, 0},
-            {9001, 95, 0},
-            {9001, 96, 0},
-            {9001, 97, 0},
-            {9001, 98, 0},
-            {9001, 99, 0},
-            {9001, 100, 0},
-            {9001, 101, 0},
-            {9001, 102, 0},
-            {9001, 103, 0},
-            {9001, 104, 0},
-            {9001, 105, 0},
-            {9001, 106, 0},
-            {9001, 107, 0},
-            {9001, 108, 0},
-            {9001, 109, 0},
-            {9001, 110, 0},
-            {9001, 111, 0},
-            {9001, 112, 0},
-            {9001, 113, 0},
-            {9001, 114, 0},
-            {9001, 115, 0},
-            {9001, 116, 0},
-            {9001, 117, 0},
-            {9001, 118, 0},
-            {9001, 119, 0},
-            {9001, 120, 0},
-            {9001, 121, 0},
-            {9001, 122, 0},
-            {9001, 123, 0},
-            {9001, 124, 0},
-            {10090, 125, 0},
-            {10090, 126, 0},
-            {10090, 127, 0},
-            {10090, 128, 0},
-            {10090, 129, 0},
-            {10090, 130, 0},
-            {10090, 131, 0},
-            {10090, 132, 0},
-            {10090, 133, 0},
-            {10090, 134, 0},
-            {10090, 135, 0},
-            {10090, 136, 0},
-            {10090, 137, 0},
-            {10090, 138, 0},
-            {10090, 139, 0},
-            {10090, 140, 0},
-            {10090, 141, 0},
-            {10030, 142, 0},
-            {10200, 143, 0},
-            {9001, 144, 0},
-            {9001, 145, 0},
-            {9013, 146, 0},
-            {9013, 147, 0},
-            {9013, 148, 0},
-            {9013, 149, 0},
-            {9013, 150, 0},
-            {9013, 151, 0},
-            {9013, 152, 0},
-            {9013, 153, 0},
-            {9013, 154, 0},
-            {9013, 155, 0},
-            {9013, 156, 0},
-            {9013, 157, 0},
-            {9013, 158, 0},
-            {9013, 159, 0},
-            {9013, 160, 0},
-            {9013, 161, 0},
-            {9013, 162, 0},
-            {9013, 163, 0},
-            {61, 164, 0},
-            {61, 165, 0},
-            {116, 166, 0},
-            {116, 167, 0},
-            {61, 168, 0},
-            {61, 169, 0},
-            {61, 170, 0},
-            {61, 171, 0},
-            {61, 172, 0},
-            {61, 173, 0},
-            {61, 174, 0},
-            {61, 175, 0},
-            {116, 176, 0},
-            {116, 177, 0},
-            {3002, 178, 0},
-            {3002, 179, 0},
-            {3000, 180, 0},
-            {3000, 181, 0},
-            {54, 182, 0},
-            {54, 183, 0},
-            {54, 184, 0},
-            {54, 185, 0},
-            {9001, 186, 0},
-            {9001, 187, 0},
-            {9001, 188, 0},
-            {9001, 189, 0},
-            {9001, 190, 0},
-            {9001, 191, 0},
-            {9001, 192, 0},
-            {10030, 193, 0},
-            {10030, 194, 0},
-            {10030, 195, 0},
-            {10030, 196, 0},
-            {10030, 197, 0},
-            {10030, 198, 0},
-            {10030, 199, 0},
-            {10030, 200, 0},
-            {10030, 201, 0},
-            {10030, 202, 0},
-            {10030, 203, 0},
-            {10030, 204, 0},
-            {10030, 205, 0},
-            {10030, 206, 0},
-            {10030, 207, 0},
-            {10030, 208, 0},
-            {10030, 209, 0},
-            {10030, 210, 0},
-            {10030, 211, 0},
-            {10030, 212, 0},
-            {10030, 213, 0},
-            {10030, 214, 0},
-            {10030, 215, 0},
-            {10030, 216, 0},
-            {10030, 217, 0},
-            {10030, 218, 0},
-            {10030, 219, 0},
-            {10030, 220, 0},
-            {10030, 221, 0},
-            {10030, 222, 0},
-            {10030, 223, 0},
-            {107, 224, 0},
-            {107, 225, 0},
-            {107, 226, 0},
-            {107, 227, 0},
-            {107, 228, 0},
-            {107, 229, 0},
-            {107, 230, 0},
-            {107, 231, 0},
-            {107, 232, 0},
-            {107, 233, 0},
-            {107, 234, 0},
-            {107, 235, 0},
-            {107, 236, 0},
-            {107, 237, 0},
-            {107, 238, 0},
-            {107, 239, 0},
-            {107, 240, 0},
-            {107, 241, 0},
-            {107, 242, 0},
-            {107, 243, 0},
-            {107, 244, 0},
-            {107, 245, 0},
-            {107, 246, 0},
-            {107, 247, 0},
-            {107, 248, 0},
-            {107, 249, 0},
-            {107, 250, 0},
-            {107, 251, 0},
-            {107, 252, 0},
-            {107, 253, 0},
-            {107, 254, 0},
-            {107, 255, 0},
-            {114, 256, 0},
-            {114, 257, 0},
-            {114, 258, 0},
-            {114, 259, 0},
-            {114, 260, 0},
-            {114, 261, 0},
-            {114, 262, 0},
-            {114, 263, 0},
-            {114, 264, 0},
-            {114, 265, 0},
-            {114, 266, 0},
-            {114, 267, 0},
-            {114, 268, 0},
-            {114, 269, 0},
-            {114, 270, 0},
-            {114, 271, 0},
-            {31, 272, 0},
-            {31, 273, 0},
-            {31, 274, 0},
-            {31, 275, 0},
-            {31, 276, 0},
-            {31, 277, 0},
-            {31, 278, 0},
-            {31, 279, 0},
-            {31, 280, 0},
-            {31, 281, 0},
-            {31, 282, 0},
-            {31, 283, 0},
-            {31, 284, 0},
-            {31, 285, 0},
-            {31, 286, 0},
-            {31, 287, 0},
-            {31, 288, 0},
-            {31, 289, 0},
-            {31, 290, 0},
-            {31, 291, 0},
-            {31, 292, 0},
-            {31, 293, 0},
-            {31, 294, 0},
-            {31, 295, 0},
-            {31, 296, 0},
-            {31, 297, 0},
-            {31, 298, 0},
-            {31, 299, 0},
-            {31, 300, 0},
-            {31, 301, 0},
-            {31, 302, 0},
-            {31, 303, 0},
-            {114, 304, 0},
-            {114, 305, 0},
-            {114, 306, 0},
-            {114, 307, 0},
-            {114, 308, 0},
-            {114, 309, 0},
-            {114, 310, 0},
-            {114, 311, 0},
-            {114, 312, 0},
-            {114, 313, 0},
-            {114, 314, 0},
-            {114, 315, 0},
-            {114, 316, 0},
-            {114, 317, 0},
-            {114, 318, 0},
-            {114, 319, 0},
-            {82, 320, 0},
-            {82, 321, 0},
-            {82, 322, 0},
-            {82, 323, 0},
-            {82, 324, 0},
-            {82, 325, 0},
-            {82, 326, 0},
-            {10110, 327, 0},
-            {10110, 328, 0},
-            {10110, 329, 0},
-            {10110, 330, 0},
-            {10110, 331, 0},
-            {10110, 332, 0},
-            {10110, 333, 0},
-            {10110, 334, 0},
-            {10110, 335, 0},
-            {10110, 336, 0},
-            {10110, 337, 0},
-            {10110, 338, 0},
-            {81, 339, 0},
-            {81, 340, 0},
-            {81, 341, 0},
-            {81, 342, 0},
-            {81, 343, 0},
-            {81, 344, 0},
-            {81, 345, 0},
-            {81, 346, 0},
-            {8000, 347, 0},
-            {8000, 348, 0},
-            {8000, 349, 0},
-            {8000, 350, 0},
-            {8000, 351, 0},
-            {8000, 352, 0},
-            {8000, 353, 0},
-            {8000, 354, 0},
-            {8000, 355, 0},
-            {8000, 356, 0},
-            {8000, 357, 0},
-            {8000, 358, 0},
-            {81, 359, 0},
-            {81, 360, 0},
-            {81, 361, 0},
-            {81, 362, 0},
-            {81, 363, 0},
-            {81, 364, 0},
-            {81, 365, 0},
-            {81, 366, 0},
-            {81, 367, 0},
-            {81, 368, 0},
-            {81, 369, 0},
-            {81, 370, 0},
-            {81, 371, 0},
-            {81, 372, 0},
-            {81, 373, 0},
-            {81, 374, 0},
-            {8000, 375, 0},
-            {8000, 376, 0},
-            {8000, 377, 0},
-            {8000, 378, 0},
-            {8000, 379, 0},
-            {8000, 380, 0},
-            {8000, 381, 0},
-            {8000, 382, 0},
-            {8000, 383, 0},
-            {8000, 384, 0},
-            {8000, 385, 0},
-            {8000, 386, 0},
-            {8004, 387, 0},
-            {8004, 388, 0},
-            {8004, 389, 0},
-            {8004, 390, 0},
-            {8004, 391, 0},
-            {8004, 392, 0},
-            {8004, 393, 0},
-            {8004, 394, 0},
-            {8004, 395, 0},
-            {8004, 396, 0},
-            {8004, 397, 0},
-            {8004, 398, 0},
-            {8004, 399, 0},
-            {8004, 400, 0},
-            {8004, 401, 0},
-            {8004, 402, 0},
-            {8004, 403, 0},
-            {8004, 404, 0},
-            {84, 405, 0},
-            {84, 406, 0},
-            {11, 407, 0},
-            {11, 408, 0},
-            {11, 409, 0},
-            {11, 410, 0},
-            {84, 411, 0},
-            {30, 412, 0},
-            {83, 413, 0},
-            {86, 414, 0},
-            {10040, 415, 0},
-            {33, 416, 0},
-            {10040, 417, 0},
-            {8008, 418, 0},
-            {8005, 419, 0},
-            {8007, 420, 0},
-            {8006, 421, 0},
-            {8004, 422, 0},
-            {8004, 423, 0},
-            {8004, 424, 0},
-            {8004, 425, 0},
-            {8040, 426, 0},
-            {10, 427, 0},
-            {8010, 428, 0},
-            {53, 429, 0},
-            {8009, 430, 0},
-            {123, 431, 0},
-            {20, 432, 0},
-            {19, 433, 0},
-            {18, 434, 0},
-            {16, 435, 0},
-            {13, 436, 0},
-            {12, 437, 0},
-            {23, 438, 0},
-            {22, 439, 0},
-            {21, 440, 0},
-            {10120, 441, 0},
-            {10120, 442, 0},
-            {10120, 443, 0},
-            {8004, 444, 0},
-            {8004, 445, 0},
-            {8004, 446, 0},
-            {8004, 447, 0},
-            {8004, 448, 0},
-            {8004, 449, 0},
-            {8004, 450, 0},
-            {8004, 451, 0},
-            {8004, 452, 0},
-            {8004, 453, 0},
-            {8004, 454, 0},
-            {8004, 455, 0},
-            {8004, 456, 0},
-            {8004, 457, 0},
-            {8004, 458, 0},
-            {8004, 459, 0},
-            {8004, 460, 0},
-            {8004, 461, 0},
-            {8004, 462, 0},
-            {8004, 463, 0},
-            {8004, 464, 0},
-            {8004, 465, 0},
-            {8004, 466, 0},
-            {8004, 467, 0},
-            {8004, 468, 0},
-            {8004, 469, 0},
-            {8004, 470, 0},
-            {8004, 471, 0},
-            {32, 472, 0},
-            {32, 473, 0},
-            {8003, 474, 0},
-            {8003, 475, 0},
-            {8003, 476, 0},
-            {8003, 477, 0},
-            {8003, 478, 0},
-            {8003, 479, 0},
-            {9100, 480, 0},
-            {9101, 481, 0},
-            {9102, 482, 0},
-            {9103, 483, 0},
-            {11, 484, 0},
-            {11, 485, 0},
-            {11, 486, 0},
-            {11, 487, 0},
-	}},
-    },
+// Thing infos of every level. Levels below reference their span in it
+constexpr ap_thing_info_t ap_hexen_thing_infos[] = {
+    // Winnowing Hall
+    {78, 0, 0, 0},
+    {79, 1, 0, 0},
+    {79, 2, 0, 0},
+    {2, 3, 0, 0},
+    {1, 4, 0, 0},
+    {116, 5, 0, 0},
+    {116, 6, 0, 0},
+    {17, 7, 0, 0},
+    {116, 8, 0, 0},
+    {116, 9, 0, 0},
+    {17, 10, 0, 0},
+    {116, 11, 0, 0},
+    {116, 12, 0, 0},
+    {17, 13, 0, 0},
+    {54, 14, 0, 0},
+    {54, 15, 0, 0},
+    {54, 16, 0, 0},
+    {54, 17, 0, 0},
+    {1404, 18, 0, 0},
+    {1404, 19, 0, 0},
+    {1404, 20, 0, 0},
+    {1404, 21, 0, 0},
+    {1404, 22, 0, 0},
+    {1404, 23, 0, 0},
+    {1404, 24, 0, 0},
+    {1404, 25, 0, 0},
+    {1404, 26, 0, 0},
+    {1404, 27, 0, 0},
+    {71, 28, 0, 0},
+    {72, 29, 0, 0},
+    {72, 30, 0, 0},
+    {72, 31, 0, 0},
+    {72, 32, 0, 0},
+    {72, 33, 0, 0},
+    {1404, 34, 0, 0},
+    {72, 35, 0, 0},
+    {1404, 36, 0, 0},
+    {1404, 37, 0, 0},
+    {3000, 38, 0, 0},
+    {3000, 39, 0, 0},
+    {3002, 40, 0, 0},
+    {3002, 41, 0, 0},
+    {8061, 42, 0, 0},
+    {8061, 43, 0, 0},
+    {8061, 44, 0, 0},
+    {8061, 45, 0, 0},
+    {8061, 46, 0, 0},
+    {3000, 47, 0, 0},
+    {3002, 48, 0, 0},
+    {3002, 49, 0, 0},
+    {3000, 50, 0, 0},
+    {9001, 51, 0, 0},
+    {9001, 52, 0, 0},
+    {1410, 53, 0, 0},
+    {8061, 54, 0, 0},
+    {8061, 55, 0, 0},
+    {102, 56, 0, 0},
+    {102, 57, 0, 0},
+    {104, 58, 0, 0},
+    {104, 59, 0, 0},
+    {106, 60, 0, 0},
+    {97, 61, 0, 0},
+    {8044, 62, 0, 0},
+    {8044, 63, 0, 0},
+    {8044, 64, 0, 0},
+    {8044, 65, 0, 0},
+    {78, 66, 0, 0},
+    {78, 67, 0, 0},
+    {78, 68, 0, 0},
+    {78, 69, 0, 0},
+    {78, 70, 0, 0},
+    {78, 71, 0, 0},
+    {79, 72, 0, 0},
+    {79, 73, 0, 0},
+    {79, 74, 0, 0},
+    {8061, 75, 0, 0},
+    {8061, 76, 0, 0},
+    {10030, 77, 0, 0},
+    {10030, 78, 0, 0},
+    {10030, 79, 0, 0},
+    {10030, 80, 0, 0},
+    {3000, 81, 0, 0},
+    {3000, 82, 0, 0},
+    {3000, 83, 0, 0},
+    {3000, 84, 0, 0},
+    {3000, 85, 0, 0},
+    {3000, 86, 0, 0},
+    {3000, 87, 0, 0},
+    {3000, 88, 0, 0},
+    {3002, 89, 0, 0},
+    {3002, 90, 0, 0},
+    {3002, 91, 0, 0},
+    {3002, 92, 0, 0},
+    {3002, 93, 0, 0},
+    {3002, 94, 0, 0},
+    {3002, 95, 0, 0},
+    {3002, 96, 0, 0},
+    {54, 97, 0, 0},
+    {54, 98, 0, 0},
+    {54, 99, 0, 0},
+    {54, 100, 0, 0},
+    {1404, 101, 0, 0},
+    {50, 102, 0, 0},
+    {1410, 103, 0, 0},
+    {1410, 104, 0, 0},
+    {1410, 105, 0, 0},
+    {48, 106, 0, 0},
+    {48, 107, 0, 0},
+    {48, 108, 0, 0},
+    {48, 109, 0, 0},
+    {8036, 110, 0, 0},
+    {57, 111, 0, 0},
+    {48, 112, 0, 0},
+    {48, 113, 0, 0},
+    {48, 114, 0, 0},
+    {48, 115, 0, 0},
+    {48, 116, 0, 0},
+    {99, 117, 0, 0},
+    {8065, 118, 0, 0},
+    {50, 119, 0, 0},
+    {140, 120, 0, 0},
+    {8034, 121, 0, 0},
+    {9001, 122, 0, 0},
+    {9001, 123, 0, 0},
+    {9001, 124, 0, 0},
+    {9001, 125, 0, 0},
+    {9001, 126, 0, 0},
+    {9001, 127, 0, 0},
+    {9001, 128, 0, 0},
+    {9001, 129, 0, 0},
+    {9001, 130, 0, 0},
+    {9001, 131, 0, 0},
+    {9001, 132, 0, 0},
+    {9001, 133, 0, 0},
+    {9001, 134, 0, 0},
+    {9001, 135, 0, 0},
+    {9001, 136, 0, 0},
+    {9001, 137, 0, 0},
+    {9001, 138, 0, 0},
+    {9001, 139, 0, 0},
+    {9001, 140, 0, 0},
+    {9001, 141, 0, 0},
+    {9001, 142, 0, 0},
+    {9001, 143, 0, 0},
+    {9001, 144, 0, 0},
+    {9001, 145, 0, 0},
+    {9001, 146, 0, 0},
+    {9001, 147, 0, 0},
+    {9001, 148, 0, 0},
+    {9001, 149, 0, 0},
+    {9001, 150, 0, 0},
+    {9001, 151, 0, 0},
+    {9001, 152, 0, 0},
+    {9001, 153, 0, 0},
+    {9001, 154, 0, 0},
+    {9001, 155, 0, 0},
+    {9001, 156, 0, 0},
+    {9001, 157, 0, 0},
+    {9001, 158, 0, 0},
+    {9001, 159, 0, 0},
+    {9001, 160, 0, 0},
+    {9001, 161, 0, 0},
+    {9001, 162, 0, 0},
+    {9001, 163, 0, 0},
+    {14, 164, 0, 0},
+    {10030, 165, 0, 0},
+    {10030, 166, 0, 0},
+    {10030, 167, 0, 0},
+    {10030, 168, 0, 0},
+    {10030, 169, 0, 0},
+    {10030, 170, 0, 0},
+    {10030, 171, 0, 0},
+    {10030, 172, 0, 0},
+    {10030, 173, 0, 0},
+    {10030, 174, 0, 0},
+    {10030, 175, 0, 0},
+    {10030, 176, 0, 0},
+    {10030, 177, 0, 0},
+    {11, 178, 0, 0},
+    {11, 179, 0, 0},
+    {8000, 180, 0, 0},
+    {8000, 181, 0, 0},
+    {8000, 182, 0, 0},
+    {8000, 183, 0, 0},
+    {8000, 184, 0, 0},
+    {106, 185, 0, 0},
+    {8000, 186, 0, 0},
+    {8068, 187, 0, 0},
+    {8068, 188, 0, 0},
+    {8068, 189, 0, 0},
+    {8068, 190, 0, 0},
+    {8068, 191, 0, 0},
+    {8068, 192, 0, 0},
+    {8068, 193, 0, 0},
+    {8068, 194, 0, 0},
+    {8068, 195, 0, 0},
+    {8068, 196, 0, 0},
+    {59, 197, 0, 0},
+    {59, 198, 0, 0},
+    {59, 199, 0, 0},
+    {59, 200, 0, 0},
+    {58, 201, 0, 0},
+    {58, 202, 0, 0},
+    {58, 203, 0, 0},
+    {58, 204, 0, 0},
+    {8068, 205, 0, 0},
+    {8068, 206, 0, 0},
+    {8068, 207, 0, 0},
+    {79, 208, 0, 0},
+    {48, 209, 0, 0},
+    {8062, 210, 0, 0},
+    {8062, 211, 0, 0},
+    {113, 212, 0, 0},
+    {79, 213, 0, 0},
+    {82, 214, 0, 0},
+    {81, 215, 0, 0},
+    {82, 216, 0, 0},
+    {81, 217, 0, 0},
+    {82, 218, 0, 0},
+    {8007, 219, 0, 0},
+    {81, 220, 0, 0},
+    {81, 221, 0, 0},
+    {81, 222, 0, 0},
+    {81, 223, 0, 0},
+    {82, 224, 0, 0},
+    {1410, 225, 0, 0},
+    {1410, 226, 0, 0},
+    {10060, 227, 0, 0},
+    {10030, 228, 0, 0},
+    {10030, 229, 0, 0},
+    {10030, 230, 0, 0},
+    {10030, 231, 0, 0},
+    {10030, 232, 0, 0},
+    {10030, 233, 0, 0},
+    {10030, 234, 0, 0},
+    {82, 235, 0, 0},
+    {82, 236, 0, 0},
+    {82, 237, 0, 0},
+    {10030, 238, 0, 0},
+    {10030, 239, 0, 0},
+    {10030, 240, 0, 0},
+    {81, 241, 0, 0},
+    {81, 242, 0, 0},
+    {81, 243, 0, 0},
+    {82, 244, 0, 0},
+    {71, 245, 0, 0},
+    {10030, 246, 0, 0},
+    {10030, 247, 0, 0},
+    {10030, 248, 0, 0},
+    {10030, 249, 0, 0},
+    {10030, 250, 0, 0},
+    {10030, 251, 0, 0},
+    {10030, 252, 0, 0},
+    {10030, 253, 0, 0},
+    {10030, 254, 0, 0},
+    {10030, 255, 0, 0},
+    {10030, 256, 0, 0},
+    {81, 257, 0, 0},
+    {81, 258, 0, 0},
+    {81, 259, 0, 0},
+    {82, 260, 0, 0},
+    {81, 261, 0, 0},
+    {81, 262, 0, 0},
+    {81, 263, 0, 0},
+    {81, 264, 0, 0},
+    {81, 265, 0, 0},
+    {81, 266, 0, 0},
+    {81, 267, 0, 0},
+    {10, 268, 0, 0},
+    {53, 269, 0, 0},
+    {8010, 270, 0, 0},
+    {8009, 271, 0, 0},
+    {123, 272, 0, 0},
+    {8040, 273, 0, 0},
+    {20, 274, 0, 0},
+    {19, 275, 0, 0},
+    {18, 276, 0, 0},
+    {16, 277, 0, 0},
+    {13, 278, 0, 0},
+    {12, 279, 0, 0},
+    {23, 280, 0, 0},
+    {22, 281, 0, 0},
+    {21, 282, 0, 0},
+    {8008, 283, 0, 0},
+    {8002, 284, 0, 0},
+    {10110, 285, 0, 0},
+    {8003, 286, 0, 0},
+    {8003, 287, 0, 0},
+    {84, 288, 0, 0},
+    {30, 289, 0, 0},
+    {83, 290, 0, 0},
+    {32, 291, 0, 0},
+    {86, 292, 0, 0},
+    {36, 293, 0, 0},
+    {33, 294, 0, 0},
+    {10040, 295, 0, 0},
+    {3, 296, 0, 0},
+    {4, 297, 0, 0},
+    {11, 298, 0, 0},
+    {11, 299, 0, 0},
+    {11, 300, 0, 0},
+    {11, 301, 0, 0},
+    {11, 302, 0, 0},
+    {11, 303, 0, 0},
+    {8000, 304, 0, 0},
+    {8000, 305, 0, 0},
+    {140, 306, 0, 0},
+    {10110, 307, 0, 0},
+    {10110, 308, 0, 0},
+    {10110, 309, 0, 0},
+    {10110, 310, 0, 0},
+    {14, 311, 0, 0},
+    {10060, 312, 0, 0},
+    {10060, 313, 0, 0},
+    {9001, 314, 0, 0},
+    {9001, 315, 0, 0},
+    {9001, 316, 0, 0},
+    {9001, 317, 0, 0},
+    {122, 318, 0, 0},
+    {122, 319, 0, 0},
+    {122, 320, 0, 0},
+    {122, 321, 0, 0},
+    {122, 322, 0, 0},
+    {122, 323, 0, 0},
+    {122, 324, 0, 0},
+    {122, 325, 0, 0},
+    {122, 326, 0, 0},
+    {124, 327, 0, 0},
+    {124, 328, 0, 0},
+    {124, 329, 0, 0},
+    {124, 330, 0, 0},
+    {124, 331, 0, 0},
+    {124, 332, 0, 0},
+    {124, 333, 0, 0},
+    {124, 334, 0, 0},
+    {124, 335, 0, 0},
+    {124, 336, 0, 0},
+    {124, 337, 0, 0},
+    {8004, 338, 0, 0},
+    {9001, 339, 0, 0},
+    {9001, 340, 0, 0},
+    {81, 341, 0, 0},
+    {81, 342, 0, 0},
+    {84, 343, 0, 0},
+    {10120, 344, 0, 0},
+    {10120, 345, 0, 0},
+    {9100, 346, 0, 0},
+    {9101, 347, 0, 0},
+    {9102, 348, 0, 0},
+    {9103, 349, 0, 0},
+    // Seven Portals
+    {3001, 0, 0, 0},
+    {3000, 1, 0, 0},
+    {3000, 2, 0, 0},
+    {3001, 3, 0, 0},
+    {1, 4, 0, 0},
+    {3000, 5, 0, 0},
+    {3000, 6, 0, 0},
+    {3001, 7, 0, 0},
+    {3001, 8, 0, 0},
+    {3000, 9, 0, 0},
+    {3000, 10, 0, 0},
+    {3000, 11, 0, 0},
+    {3000, 12, 0, 0},
+    {3001, 13, 0, 0},
+    {3001, 14, 0, 0},
+    {3001, 15, 0, 0},
+    {3001, 16, 0, 0},
+    {3000, 17, 0, 0},
+    {3000, 18, 0, 0},
+    {3001, 19, 0, 0},
+    {3001, 20, 0, 0},
+    {3000, 21, 0, 0},
+    {3000, 22, 0, 0},
+    {3001, 23, 0, 0},
+    {3001, 24, 0, 0},
+    {3000, 25, 0, 0},
+    {3000, 26, 0, 0},
+    {3001, 27, 0, 0},
+    {3001, 28, 0, 0},
+    {3001, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3001, 33, 0, 0},
+    {3001, 34, 0, 0},
+    {3001, 35, 0, 0},
+    {3000, 36, 0, 0},
+    {3000, 37, 0, 0},
+    {3000, 38, 0, 0},
+    {3001, 39, 0, 0},
+    {3001, 40, 0, 0},
+    {3001, 41, 0, 0},
+    {3000, 42, 0, 0},
+    {3000, 43, 0, 0},
+    {3000, 44, 0, 0},
+    {3000, 45, 0, 0},
+    {3000, 46, 0, 0},
+    {3000, 47, 0, 0},
+    {3000, 48, 0, 0},
+    {2, 49, 0, 0},
+    {3, 50, 0, 0},
+    {4, 51, 0, 0},
+    {31, 52, 0, 0},
+    {10030, 53, 0, 0},
+    {31, 54, 0, 0},
+    {31, 55, 0, 0},
+    {31, 56, 0, 0},
+    {31, 57, 0, 0},
+    {31, 58, 0, 0},
+    {31, 59, 0, 0},
+    {107, 60, 0, 0},
+    {1410, 61, 0, 0},
+    {1410, 62, 0, 0},
+    {1410, 63, 0, 0},
+    {1410, 64, 0, 0},
+    {1410, 65, 0, 0},
+    {117, 66, 0, 0},
+    {117, 67, 0, 0},
+    {117, 68, 0, 0},
+    {117, 69, 0, 0},
+    {117, 70, 0, 0},
+    {117, 71, 0, 0},
+    {54, 72, 0, 0},
+    {54, 73, 0, 0},
+    {54, 74, 0, 0},
+    {54, 75, 0, 0},
+    {117, 76, 0, 0},
+    {117, 77, 0, 0},
+    {54, 78, 0, 0},
+    {54, 79, 0, 0},
+    {54, 80, 0, 0},
+    {54, 81, 0, 0},
+    {7, 82, 0, 0},
+    {9, 83, 0, 0},
+    {15, 84, 0, 0},
+    {6, 85, 0, 0},
+    {29, 86, 0, 0},
+    {79, 87, 0, 0},
+    {78, 88, 0, 0},
+    {78, 89, 0, 0},
+    {93, 90, 0, 0},
+    {95, 91, 0, 0},
+    {94, 92, 0, 0},
+    {89, 93, 0, 0},
+    {90, 94, 0, 0},
+    {90, 95, 0, 0},
+    {91, 96, 0, 0},
+    {90, 97, 0, 0},
+    {90, 98, 0, 0},
+    {89, 99, 0, 0},
+    {91, 100, 0, 0},
+    {90, 101, 0, 0},
+    {91, 102, 0, 0},
+    {90, 103, 0, 0},
+    {89, 104, 0, 0},
+    {74, 105, 0, 0},
+    {74, 106, 0, 0},
+    {74, 107, 0, 0},
+    {74, 108, 0, 0},
+    {72, 109, 0, 0},
+    {72, 110, 0, 0},
+    {74, 111, 0, 0},
+    {74, 112, 0, 0},
+    {74, 113, 0, 0},
+    {74, 114, 0, 0},
+    {72, 115, 0, 0},
+    {72, 116, 0, 0},
+    {74, 117, 0, 0},
+    {74, 118, 0, 0},
+    {74, 119, 0, 0},
+    {74, 120, 0, 0},
+    {72, 121, 0, 0},
+    {72, 122, 0, 0},
+    {74, 123, 0, 0},
+    {74, 124, 0, 0},
+    {8047, 125, 0, 0},
+    {8047, 126, 0, 0},
+    {8051, 127, 0, 0},
+    {8051, 128, 0, 0},
+    {8051, 129, 0, 0},
+    {8051, 130, 0, 0},
+    {77, 131, 0, 0},
+    {77, 132, 0, 0},
+    {73, 133, 0, 0},
+    {73, 134, 0, 0},
+    {76, 135, 0, 0},
+    {76, 136, 0, 0},
+    {76, 137, 0, 0},
+    {76, 138, 0, 0},
+    {73, 139, 0, 0},
+    {73, 140, 0, 0},
+    {91, 141, 0, 0},
+    {91, 142, 0, 0},
+    {90, 143, 0, 0},
+    {90, 144, 0, 0},
+    {90, 145, 0, 0},
+    {89, 146, 0, 0},
+    {89, 147, 0, 0},
+    {89, 148, 0, 0},
+    {89, 149, 0, 0},
+    {89, 150, 0, 0},
+    {95, 151, 0, 0},
+    {94, 152, 0, 0},
+    {93, 153, 0, 0},
+    {113, 154, 0, 0},
+    {113, 155, 0, 0},
+    {77, 156, 0, 0},
+    {77, 157, 0, 0},
+    {77, 158, 0, 0},
+    {77, 159, 0, 0},
+    {61, 160, 0, 0},
+    {61, 161, 0, 0},
+    {61, 162, 0, 0},
+    {61, 163, 0, 0},
+    {61, 164, 0, 0},
+    {61, 165, 0, 0},
+    {61, 166, 0, 0},
+    {61, 167, 0, 0},
+    {61, 168, 0, 0},
+    {61, 169, 0, 0},
+    {61, 170, 0, 0},
+    {116, 171, 0, 0},
+    {116, 172, 0, 0},
+    {116, 173, 0, 0},
+    {116, 174, 0, 0},
+    {116, 175, 0, 0},
+    {116, 176, 0, 0},
+    {28, 177, 0, 0},
+    {28, 178, 0, 0},
+    {28, 179, 0, 0},
+    {28, 180, 0, 0},
+    {28, 181, 0, 0},
+    {28, 182, 0, 0},
+    {28, 183, 0, 0},
+    {28, 184, 0, 0},
+    {28, 185, 0, 0},
+    {28, 186, 0, 0},
+    {49, 187, 0, 0},
+    {49, 188, 0, 0},
+    {111, 189, 0, 0},
+    {111, 190, 0, 0},
+    {111, 191, 0, 0},
+    {111, 192, 0, 0},
+    {111, 193, 0, 0},
+    {111, 194, 0, 0},
+    {111, 195, 0, 0},
+    {111, 196, 0, 0},
+    {111, 197, 0, 0},
+    {111, 198, 0, 0},
+    {117, 199, 0, 0},
+    {117, 200, 0, 0},
+    {117, 201, 0, 0},
+    {117, 202, 0, 0},
+    {54, 203, 0, 0},
+    {54, 204, 0, 0},
+    {54, 205, 0, 0},
+    {54, 206, 0, 0},
+    {54, 207, 0, 0},
+    {54, 208, 0, 0},
+    {54, 209, 0, 0},
+    {54, 210, 0, 0},
+    {9001, 211, 0, 0},
+    {9001, 212, 0, 0},
+    {9001, 213, 0, 0},
+    {9001, 214, 0, 0},
+    {9001, 215, 0, 0},
+    {9001, 216, 0, 0},
+    {9001, 217, 0, 0},
+    {31, 218, 0, 0},
+    {31, 219, 0, 0},
+    {1407, 220, 0, 0},
+    {1407, 221, 0, 0},
+    {1407, 222, 0, 0},
+    {1407, 223, 0, 0},
+    {1407, 224, 0, 0},
+    {1407, 225, 0, 0},
+    {1407, 226, 0, 0},
+    {1407, 227, 0, 0},
+    {1407, 228, 0, 0},
+    {1407, 229, 0, 0},
+    {1407, 230, 0, 0},
+    {1407, 231, 0, 0},
+    {1407, 232, 0, 0},
+    {1407, 233, 0, 0},
+    {1407, 234, 0, 0},
+    {1407, 235, 0, 0},
+    {1407, 236, 0, 0},
+    {1409, 237, 0, 0},
+    {1409, 238, 0, 0},
+    {1409, 239, 0, 0},
+    {1409, 240, 0, 0},
+    {1409, 241, 0, 0},
+    {1409, 242, 0, 0},
+    {1409, 243, 0, 0},
+    {1409, 244, 0, 0},
+    {1409, 245, 0, 0},
+    {1409, 246, 0, 0},
+    {1409, 247, 0, 0},
+    {1409, 248, 0, 0},
+    {1409, 249, 0, 0},
+    {1409, 250, 0, 0},
+    {1409, 251, 0, 0},
+    {1409, 252, 0, 0},
+    {1409, 253, 0, 0},
+    {1409, 254, 0, 0},
+    {1409, 255, 0, 0},
+    {1409, 256, 0, 0},
+    {1409, 257, 0, 0},
+    {1409, 258, 0, 0},
+    {1409, 259, 0, 0},
+    {1409, 260, 0, 0},
+    {1409, 261, 0, 0},
+    {1409, 262, 0, 0},
+    {1409, 263, 0, 0},
+    {1409, 264, 0, 0},
+    {1409, 265, 0, 0},
+    {1409, 266, 0, 0},
+    {1409, 267, 0, 0},
+    {1409, 268, 0, 0},
+    {1409, 269, 0, 0},
+    {1409, 270, 0, 0},
+    {1409, 271, 0, 0},
+    {1402, 272, 0, 0},
+    {1402, 273, 0, 0},
+    {10030, 274, 0, 0},
+    {10030, 275, 0, 0},
+    {107, 276, 0, 0},
+    {107, 277, 0, 0},
+    {31, 278, 0, 0},
+    {31, 279, 0, 0},
+    {31, 280, 0, 0},
+    {31, 281, 0, 0},
+    {31, 282, 0, 0},
+    {31, 283, 0, 0},
+    {31, 284, 0, 0},
+    {8048, 285, 0, 0},
+    {8048, 286, 0, 0},
+    {8045, 287, 0, 0},
+    {8045, 288, 0, 0},
+    {8045, 289, 0, 0},
+    {8045, 290, 0, 0},
+    {8048, 291, 0, 0},
+    {8048, 292, 0, 0},
+    {8044, 293, 0, 0},
+    {8044, 294, 0, 0},
+    {8044, 295, 0, 0},
+    {8044, 296, 0, 0},
+    {8044, 297, 0, 0},
+    {8044, 298, 0, 0},
+    {8044, 299, 0, 0},
+    {8044, 300, 0, 0},
+    {20, 301, 0, 0},
+    {16, 302, 0, 0},
+    {23, 303, 0, 0},
+    {8041, 304, 0, 0},
+    {9001, 305, 0, 0},
+    {9001, 306, 0, 0},
+    {8000, 307, 0, 0},
+    {8000, 308, 0, 0},
+    {8000, 309, 0, 0},
+    {8000, 310, 0, 0},
+    {8000, 311, 0, 0},
+    {8000, 312, 0, 0},
+    {8000, 313, 0, 0},
+    {8000, 314, 0, 0},
+    {8000, 315, 0, 0},
+    {8000, 316, 0, 0},
+    {8000, 317, 0, 0},
+    {8000, 318, 0, 0},
+    {8000, 319, 0, 0},
+    {8000, 320, 0, 0},
+    {8000, 321, 0, 0},
+    {8000, 322, 0, 0},
+    {8000, 323, 0, 0},
+    {8000, 324, 0, 0},
+    {8000, 325, 0, 0},
+    {8000, 326, 0, 0},
+    {8000, 327, 0, 0},
+    {8000, 328, 0, 0},
+    {8000, 329, 0, 0},
+    {8000, 330, 0, 0},
+    {8000, 331, 0, 0},
+    {8000, 332, 0, 0},
+    {10030, 333, 0, 0},
+    {10030, 334, 0, 0},
+    {10030, 335, 0, 0},
+    {10030, 336, 0, 0},
+    {10030, 337, 0, 0},
+    {10030, 338, 0, 0},
+    {10030, 339, 0, 0},
+    {10030, 340, 0, 0},
+    {8020, 341, 0, 0},
+    {8020, 342, 0, 0},
+    {8020, 343, 0, 0},
+    {8020, 344, 0, 0},
+    {10060, 345, 0, 0},
+    {10060, 346, 0, 0},
+    {107, 347, 0, 0},
+    {107, 348, 0, 0},
+    {10060, 349, 0, 0},
+    {10060, 350, 0, 0},
+    {31, 351, 0, 0},
+    {31, 352, 0, 0},
+    {11, 353, 0, 0},
+    {11, 354, 0, 0},
+    {11, 355, 0, 0},
+    {11, 356, 0, 0},
+    {81, 357, 0, 0},
+    {81, 358, 0, 0},
+    {81, 359, 0, 0},
+    {81, 360, 0, 0},
+    {81, 361, 0, 0},
+    {81, 362, 0, 0},
+    {81, 363, 0, 0},
+    {81, 364, 0, 0},
+    {81, 365, 0, 0},
+    {81, 366, 0, 0},
+    {81, 367, 0, 0},
+    {81, 368, 0, 0},
+    {81, 369, 0, 0},
+    {81, 370, 0, 0},
+    {81, 371, 0, 0},
+    {81, 372, 0, 0},
+    {81, 373, 0, 0},
+    {83, 374, 0, 0},
+    {81, 375, 0, 0},
+    {81, 376, 0, 0},
+    {81, 377, 0, 0},
+    {81, 378, 0, 0},
+    {81, 379, 0, 0},
+    {81, 380, 0, 0},
+    {81, 381, 0, 0},
+    {81, 382, 0, 0},
+    {81, 383, 0, 0},
+    {81, 384, 0, 0},
+    {8000, 385, 0, 0},
+    {8000, 386, 0, 0},
+    {8000, 387, 0, 0},
+    {122, 388, 0, 0},
+    {122, 389, 0, 0},
+    {122, 390, 0, 0},
+    {122, 391, 0, 0},
+    {122, 392, 0, 0},
+    {122, 393, 0, 0},
+    {122, 394, 0, 0},
+    {122, 395, 0, 0},
+    {122, 396, 0, 0},
+    {122, 397, 0, 0},
+    {122, 398, 0, 0},
+    {122, 399, 0, 0},
+    {122, 400, 0, 0},
+    {122, 401, 0, 0},
+    {122, 402, 0, 0},
+    {122, 403, 0, 0},
+    {122, 404, 0, 0},
+    {122, 405, 0, 0},
+    {122, 406, 0, 0},
+    {122, 407, 0, 0},
+    {122, 408, 0, 0},
+    {122, 409, 0, 0},
+    {122, 410, 0, 0},
+    {122, 411, 0, 0},
+    {82, 412, 0, 0},
+    {82, 413, 0, 0},
+    {82, 414, 0, 0},
+    {82, 415, 0, 0},
+    {82, 416, 0, 0},
+    {82, 417, 0, 0},
+    {82, 418, 0, 0},
+    {82, 419, 0, 0},
+    {82, 420, 0, 0},
+    {82, 421, 0, 0},
+    {82, 422, 0, 0},
+    {82, 423, 0, 0},
+    {82, 424, 0, 0},
+    {82, 425, 0, 0},
+    {82, 426, 0, 0},
+    {82, 427, 0, 0},
+    {82, 428, 0, 0},
+    {82, 429, 0, 0},
+    {82, 430, 0, 0},
+    {82, 431, 0, 0},
+    {82, 432, 0, 0},
+    {82, 433, 0, 0},
+    {122, 434, 0, 0},
+    {122, 435, 0, 0},
+    {122, 436, 0, 0},
+    {122, 437, 0, 0},
+    {122, 438, 0, 0},
+    {122, 439, 0, 0},
+    {122, 440, 0, 0},
+    {122, 441, 0, 0},
+    {81, 442, 0, 0},
+    {81, 443, 0, 0},
+    {81, 444, 0, 0},
+    {8004, 445, 0, 0},
+    {1, 446, 0, 0},
+    {2, 447, 0, 0},
+    {3, 448, 0, 0},
+    {4, 449, 0, 0},
+    {1, 450, 0, 0},
+    {2, 451, 0, 0},
+    {3, 452, 0, 0},
+    {4, 453, 0, 0},
+    {1, 454, 0, 0},
+    {2, 455, 0, 0},
+    {3, 456, 0, 0},
+    {4, 457, 0, 0},
+    {1, 458, 0, 0},
+    {2, 459, 0, 0},
+    {4, 460, 0, 0},
+    {3, 461, 0, 0},
+    {1, 462, 0, 0},
+    {2, 463, 0, 0},
+    {3, 464, 0, 0},
+    {4, 465, 0, 0},
+    {10030, 466, 0, 0},
+    {10030, 467, 0, 0},
+    {10030, 468, 0, 0},
+    {10030, 469, 0, 0},
+    {10030, 470, 0, 0},
+    {10030, 471, 0, 0},
+    {10030, 472, 0, 0},
+    {31, 473, 0, 0},
+    {31, 474, 0, 0},
+    {31, 475, 0, 0},
+    {31, 476, 0, 0},
+    {31, 477, 0, 0},
+    {31, 478, 0, 0},
+    {31, 479, 0, 0},
+    {31, 480, 0, 0},
+    {31, 481, 0, 0},
+    {31, 482, 0, 0},
+    {31, 483, 0, 0},
+    {31, 484, 0, 0},
+    {31, 485, 0, 0},
+    {31, 486, 0, 0},
+    {31, 487, 0, 0},
+    {31, 488, 0, 0},
+    {107, 489, 0, 0},
+    {107, 490, 0, 0},
+    {107, 491, 0, 0},
+    {10, 492, 0, 0},
+    {8009, 493, 0, 0},
+    {8010, 494, 0, 0},
+    {123, 495, 0, 0},
+    {8040, 496, 0, 0},
+    {53, 497, 0, 0},
+    {13, 498, 0, 0},
+    {12, 499, 0, 0},
+    {19, 500, 0, 0},
+    {18, 501, 0, 0},
+    {22, 502, 0, 0},
+    {21, 503, 0, 0},
+    {8006, 504, 0, 0},
+    {8007, 505, 0, 0},
+    {8005, 506, 0, 0},
+    {8008, 507, 0, 0},
+    {10030, 508, 0, 0},
+    {10030, 509, 0, 0},
+    {10060, 510, 0, 0},
+    {31, 511, 0, 0},
+    {10030, 512, 0, 0},
+    {10030, 513, 0, 0},
+    {10060, 514, 0, 0},
+    {10060, 515, 0, 0},
+    {10060, 516, 0, 0},
+    {10060, 517, 0, 0},
+    {10030, 518, 0, 0},
+    {10030, 519, 0, 0},
+    {10060, 520, 0, 0},
+    {10060, 521, 0, 0},
+    {10060, 522, 0, 0},
+    {10060, 523, 0, 0},
+    {10060, 524, 0, 0},
+    {10060, 525, 0, 0},
+    {10060, 526, 0, 0},
+    {10030, 527, 0, 0},
+    {10030, 528, 0, 0},
+    {10060, 529, 0, 0},
+    {10060, 530, 0, 0},
+    {107, 531, 0, 0},
+    {10060, 532, 0, 0},
+    {10060, 533, 0, 0},
+    {10060, 534, 0, 0},
+    {10030, 535, 0, 0},
+    {10030, 536, 0, 0},
+    {10060, 537, 0, 0},
+    {10060, 538, 0, 0},
+    {10030, 539, 0, 0},
+    {8020, 540, 0, 0},
+    {8020, 541, 0, 0},
+    {8020, 542, 0, 0},
+    {8020, 543, 0, 0},
+    {10060, 544, 0, 0},
+    {10060, 545, 0, 0},
+    {10060, 546, 0, 0},
+    {10060, 547, 0, 0},
+    {10060, 548, 0, 0},
+    {10060, 549, 0, 0},
+    {10060, 550, 0, 0},
+    {10060, 551, 0, 0},
+    {10060, 552, 0, 0},
+    {10060, 553, 0, 0},
+    {10060, 554, 0, 0},
+    {10060, 555, 0, 0},
+    {10030, 556, 0, 0},
+    {10030, 557, 0, 0},
+    {10030, 558, 0, 0},
+    {10030, 559, 0, 0},
+    {31, 560, 0, 0},
+    {31, 561, 0, 0},
+    {31, 562, 0, 0},
+    {8020, 563, 0, 0},
+    {8020, 564, 0, 0},
+    {8020, 565, 0, 0},
+    {122, 566, 0, 0},
+    {122, 567, 0, 0},
+    {122, 568, 0, 0},
+    {122, 569, 0, 0},
+    {122, 570, 0, 0},
+    {82, 571, 0, 0},
+    {82, 572, 0, 0},
+    {82, 573, 0, 0},
+    {122, 574, 0, 0},
+    {122, 575, 0, 0},
+    {122, 576, 0, 0},
+    {122, 577, 0, 0},
+    {122, 578, 0, 0},
+    {122, 579, 0, 0},
+    {122, 580, 0, 0},
+    {122, 581, 0, 0},
+    {122, 582, 0, 0},
+    {122, 583, 0, 0},
+    {122, 584, 0, 0},
+    {81, 585, 0, 0},
+    {81, 586, 0, 0},
+    {81, 587, 0, 0},
+    {81, 588, 0, 0},
+    {81, 589, 0, 0},
+    {81, 590, 0, 0},
+    {81, 591, 0, 0},
+    {81, 592, 0, 0},
+    {81, 593, 0, 0},
+    {81, 594, 0, 0},
+    {81, 595, 0, 0},
+    {81, 596, 0, 0},
+    {81, 597, 0, 0},
+    {81, 598, 0, 0},
+    {9001, 599, 0, 0},
+    {9001, 600, 0, 0},
+    {9001, 601, 0, 0},
+    {9001, 602, 0, 0},
+    {9001, 603, 0, 0},
+    {9001, 604, 0, 0},
+    {9001, 605, 0, 0},
+    {9001, 606, 0, 0},
+    {9001, 607, 0, 0},
+    {9001, 608, 0, 0},
+    {9001, 609, 0, 0},
+    {124, 610, 0, 0},
+    {124, 611, 0, 0},
+    {124, 612, 0, 0},
+    {124, 613, 0, 0},
+    {124, 614, 0, 0},
+    {124, 615, 0, 0},
+    {124, 616, 0, 0},
+    {124, 617, 0, 0},
+    {124, 618, 0, 0},
+    {124, 619, 0, 0},
+    {124, 620, 0, 0},
+    {124, 621, 0, 0},
+    {124, 622, 0, 0},
+    {124, 623, 0, 0},
+    {124, 624, 0, 0},
+    {124, 625, 0, 0},
+    {124, 626, 0, 0},
+    {124, 627, 0, 0},
+    {124, 628, 0, 0},
+    {124, 629, 0, 0},
+    {8004, 630, 0, 0},
+    {8004, 631, 0, 0},
+    {8004, 632, 0, 0},
+    {8004, 633, 0, 0},
+    {122, 634, 0, 0},
+    {122, 635, 0, 0},
+    {122, 636, 0, 0},
+    {122, 637, 0, 0},
+    {122, 638, 0, 0},
+    {122, 639, 0, 0},
+    {122, 640, 0, 0},
+    {122, 641, 0, 0},
+    {122, 642, 0, 0},
+    {122, 643, 0, 0},
+    {53, 644, 0, 0},
+    {8010, 645, 0, 0},
+    {10, 646, 0, 0},
+    {30, 647, 0, 0},
+    {82, 648, 0, 0},
+    {82, 649, 0, 0},
+    {82, 650, 0, 0},
+    {84, 651, 0, 0},
+    {84, 652, 0, 0},
+    {10120, 653, 0, 0},
+    {10120, 654, 0, 0},
+    {10120, 655, 0, 0},
+    {8004, 656, 0, 0},
+    {8004, 657, 0, 0},
+    {8004, 658, 0, 0},
+    {8004, 659, 0, 0},
+    {8004, 660, 0, 0},
+    {8004, 661, 0, 0},
+    {8004, 662, 0, 0},
+    {8004, 663, 0, 0},
+    {8004, 664, 0, 0},
+    {8004, 665, 0, 0},
+    {8004, 666, 0, 0},
+    {8004, 667, 0, 0},
+    {8004, 668, 0, 0},
+    {8004, 669, 0, 0},
+    {8004, 670, 0, 0},
+    {8004, 671, 0, 0},
+    {8004, 672, 0, 0},
+    {8004, 673, 0, 0},
+    {8004, 674, 0, 0},
+    {8004, 675, 0, 0},
+    {8004, 676, 0, 0},
+    {8004, 677, 0, 0},
+    {8004, 678, 0, 0},
+    {8004, 679, 0, 0},
+    {8004, 680, 0, 0},
+    {8004, 681, 0, 0},
+    {8004, 682, 0, 0},
+    {8004, 683, 0, 0},
+    {11, 684, 0, 0},
+    {11, 685, 0, 0},
+    {11, 686, 0, 0},
+    {11, 687, 0, 0},
+    {9100, 688, 0, 0},
+    {9101, 689, 0, 0},
+    {9102, 690, 0, 0},
+    {9103, 691, 0, 0},
+    {9100, 692, 0, 0},
+    {9101, 693, 0, 0},
+    {9102, 694, 0, 0},
+    {9103, 695, 0, 0},
+    {9100, 696, 0, 0},
+    {9101, 697, 0, 0},
+    {9102, 698, 0, 0},
+    {9103, 699, 0, 0},
+    {9100, 700, 0, 0},
+    {9101, 701, 0, 0},
+    {9102, 702, 0, 0},
+    {9103, 703, 0, 0},
+    {9100, 704, 0, 0},
+    {9101, 705, 0, 0},
+    {9102, 706, 0, 0},
+    {9103, 707, 0, 0},
+    {9100, 708, 0, 0},
+    {9101, 709, 0, 0},
+    {9102, 710, 0, 0},
+    {9103, 711, 0, 0},
+    // Guardian of Ice
+    {1, 0, 0, 0},
+    {73, 1, 0, 0},
+    {73, 2, 0, 0},
+    {72, 3, 0, 0},
+    {72, 4, 0, 0},
+    {94, 5, 0, 0},
+    {94, 6, 0, 0},
+    {95, 7, 0, 0},
+    {94, 8, 0, 0},
+    {95, 9, 0, 0},
+    {89, 10, 0, 0},
+    {90, 11, 0, 0},
+    {90, 12, 0, 0},
+    {90, 13, 0, 0},
+    {89, 14, 0, 0},
+    {117, 15, 0, 0},
+    {117, 16, 0, 0},
+    {9001, 17, 0, 0},
+    {9001, 18, 0, 0},
+    {54, 19, 0, 0},
+    {54, 20, 0, 0},
+    {55, 21, 0, 0},
+    {55, 22, 0, 0},
+    {54, 23, 0, 0},
+    {54, 24, 0, 0},
+    {54, 25, 0, 0},
+    {54, 26, 0, 0},
+    {54, 27, 0, 0},
+    {54, 28, 0, 0},
+    {54, 29, 0, 0},
+    {54, 30, 0, 0},
+    {55, 31, 0, 0},
+    {55, 32, 0, 0},
+    {55, 33, 0, 0},
+    {55, 34, 0, 0},
+    {55, 35, 0, 0},
+    {55, 36, 0, 0},
+    {117, 37, 0, 0},
+    {117, 38, 0, 0},
+    {9001, 39, 0, 0},
+    {54, 40, 0, 0},
+    {54, 41, 0, 0},
+    {9001, 42, 0, 0},
+    {9001, 43, 0, 0},
+    {55, 44, 0, 0},
+    {55, 45, 0, 0},
+    {55, 46, 0, 0},
+    {55, 47, 0, 0},
+    {9013, 48, 0, 0},
+    {9013, 49, 0, 0},
+    {9013, 50, 0, 0},
+    {9013, 51, 0, 0},
+    {8008, 52, 0, 0},
+    {9001, 53, 0, 0},
+    {9001, 54, 0, 0},
+    {9001, 55, 0, 0},
+    {9001, 56, 0, 0},
+    {9001, 57, 0, 0},
+    {9001, 58, 0, 0},
+    {9001, 59, 0, 0},
+    {9001, 60, 0, 0},
+    {9001, 61, 0, 0},
+    {9001, 62, 0, 0},
+    {9001, 63, 0, 0},
+    {107, 64, 0, 0},
+    {9001, 65, 0, 0},
+    {9001, 66, 0, 0},
+    {9001, 67, 0, 0},
+    {9001, 68, 0, 0},
+    {9001, 69, 0, 0},
+    {9001, 70, 0, 0},
+    {9001, 71, 0, 0},
+    {9001, 72, 0, 0},
+    {9001, 73, 0, 0},
+    {9001, 74, 0, 0},
+    {9001, 75, 0, 0},
+    {9001, 76, 0, 0},
+    {82, 77, 0, 0},
+    {82, 78, 0, 0},
+    {81, 79, 0, 0},
+    {81, 80, 0, 0},
+    {81, 81, 0, 0},
+    {81, 82, 0, 0},
+    {1407, 83, 0, 0},
+    {1407, 84, 0, 0},
+    {1407, 85, 0, 0},
+    {1407, 86, 0, 0},
+    {1407, 87, 0, 0},
+    {1407, 88, 0, 0},
+    {1407, 89, 0, 0},
+    {1407, 90, 0, 0},
+    {1407, 91, 0, 0},
+    {1407, 92, 0, 0},
+    {1407, 93, 0, 0},
+    {1407, 94, 0, 0},
+    {1407, 95, 0, 0},
+    {1407, 96, 0, 0},
+    {1407, 97, 0, 0},
+    {1407, 98, 0, 0},
+    {1407, 99, 0, 0},
+    {1407, 100, 0, 0},
+    {1407, 101, 0, 0},
+    {1407, 102, 0, 0},
+    {1407, 103, 0, 0},
+    {1407, 104, 0, 0},
+    {1407, 105, 0, 0},
+    {1407, 106, 0, 0},
+    {1407, 107, 0, 0},
+    {1407, 108, 0, 0},
+    {1407, 109, 0, 0},
+    {1407, 110, 0, 0},
+    {1407, 111, 0, 0},
+    {1407, 112, 0, 0},
+    {1407, 113, 0, 0},
+    {1407, 114, 0, 0},
+    {1407, 115, 0, 0},
+    {1407, 116, 0, 0},
+    {1407, 117, 0, 0},
+    {1407, 118, 0, 0},
+    {1407, 119, 0, 0},
+    {1407, 120, 0, 0},
+    {1407, 121, 0, 0},
+    {1407, 122, 0, 0},
+    {1407, 123, 0, 0},
+    {1407, 124, 0, 0},
+    {1407, 125, 0, 0},
+    {1407, 126, 0, 0},
+    {1407, 127, 0, 0},
+    {1407, 128, 0, 0},
+    {1407, 129, 0, 0},
+    {1407, 130, 0, 0},
+    {1407, 131, 0, 0},
+    {1407, 132, 0, 0},
+    {1407, 133, 0, 0},
+    {1407, 134, 0, 0},
+    {1407, 135, 0, 0},
+    {1407, 136, 0, 0},
+    {1407, 137, 0, 0},
+    {1407, 138, 0, 0},
+    {1407, 139, 0, 0},
+    {1407, 140, 0, 0},
+    {1407, 141, 0, 0},
+    {1407, 142, 0, 0},
+    {1407, 143, 0, 0},
+    {1407, 144, 0, 0},
+    {1407, 145, 0, 0},
+    {1407, 146, 0, 0},
+    {1407, 147, 0, 0},
+    {1407, 148, 0, 0},
+    {1407, 149, 0, 0},
+    {1407, 150, 0, 0},
+    {1407, 151, 0, 0},
+    {1407, 152, 0, 0},
+    {1407, 153, 0, 0},
+    {1407, 154, 0, 0},
+    {1407, 155, 0, 0},
+    {8033, 156, 0, 0},
+    {8030, 157, 0, 0},
+    {8008, 158, 0, 0},
+    {8010, 159, 0, 0},
+    {32, 160, 0, 0},
+    {8000, 161, 0, 0},
+    {8000, 162, 0, 0},
+    {8000, 163, 0, 0},
+    {8000, 164, 0, 0},
+    {8000, 165, 0, 0},
+    {8000, 166, 0, 0},
+    {8000, 167, 0, 0},
+    {8000, 168, 0, 0},
+    {82, 169, 0, 0},
+    {81, 170, 0, 0},
+    {81, 171, 0, 0},
+    {81, 172, 0, 0},
+    {81, 173, 0, 0},
+    {81, 174, 0, 0},
+    {81, 175, 0, 0},
+    {81, 176, 0, 0},
+    {81, 177, 0, 0},
+    {81, 178, 0, 0},
+    {81, 179, 0, 0},
+    {82, 180, 0, 0},
+    {82, 181, 0, 0},
+    {81, 182, 0, 0},
+    {81, 183, 0, 0},
+    {81, 184, 0, 0},
+    {81, 185, 0, 0},
+    {81, 186, 0, 0},
+    {81, 187, 0, 0},
+    {81, 188, 0, 0},
+    {8000, 189, 0, 0},
+    {8000, 190, 0, 0},
+    {8000, 191, 0, 0},
+    {8000, 192, 0, 0},
+    {8000, 193, 0, 0},
+    {8000, 194, 0, 0},
+    {8000, 195, 0, 0},
+    {8000, 196, 0, 0},
+    {81, 197, 0, 0},
+    {81, 198, 0, 0},
+    {81, 199, 0, 0},
+    {81, 200, 0, 0},
+    {81, 201, 0, 0},
+    {81, 202, 0, 0},
+    {10030, 203, 0, 0},
+    {10030, 204, 0, 0},
+    {10030, 205, 0, 0},
+    {10030, 206, 0, 0},
+    {10030, 207, 0, 0},
+    {10030, 208, 0, 0},
+    {10060, 209, 0, 0},
+    {10060, 210, 0, 0},
+    {10060, 211, 0, 0},
+    {107, 212, 0, 0},
+    {10030, 213, 0, 0},
+    {10030, 214, 0, 0},
+    {10030, 215, 0, 0},
+    {10030, 216, 0, 0},
+    {8020, 217, 0, 0},
+    {8020, 218, 0, 0},
+    {10030, 219, 0, 0},
+    {10030, 220, 0, 0},
+    {10030, 221, 0, 0},
+    {10030, 222, 0, 0},
+    {10030, 223, 0, 0},
+    {10030, 224, 0, 0},
+    {10030, 225, 0, 0},
+    {10030, 226, 0, 0},
+    {10030, 227, 0, 0},
+    {10060, 228, 0, 0},
+    {10060, 229, 0, 0},
+    {10030, 230, 0, 0},
+    {10030, 231, 0, 0},
+    {10030, 232, 0, 0},
+    {10030, 233, 0, 0},
+    {10030, 234, 0, 0},
+    {10030, 235, 0, 0},
+    {10030, 236, 0, 0},
+    {10060, 237, 0, 0},
+    {10060, 238, 0, 0},
+    {81, 239, 0, 0},
+    {81, 240, 0, 0},
+    {81, 241, 0, 0},
+    {81, 242, 0, 0},
+    {81, 243, 0, 0},
+    {81, 244, 0, 0},
+    {82, 245, 0, 0},
+    {122, 246, 0, 0},
+    {122, 247, 0, 0},
+    {122, 248, 0, 0},
+    {122, 249, 0, 0},
+    {122, 250, 0, 0},
+    {122, 251, 0, 0},
+    {122, 252, 0, 0},
+    {122, 253, 0, 0},
+    {81, 254, 0, 0},
+    {81, 255, 0, 0},
+    {81, 256, 0, 0},
+    {81, 257, 0, 0},
+    {81, 258, 0, 0},
+    {81, 259, 0, 0},
+    {122, 260, 0, 0},
+    {122, 261, 0, 0},
+    {122, 262, 0, 0},
+    {122, 263, 0, 0},
+    {122, 264, 0, 0},
+    {122, 265, 0, 0},
+    {122, 266, 0, 0},
+    {122, 267, 0, 0},
+    {122, 268, 0, 0},
+    {122, 269, 0, 0},
+    {122, 270, 0, 0},
+    {122, 271, 0, 0},
+    {122, 272, 0, 0},
+    {122, 273, 0, 0},
+    {122, 274, 0, 0},
+    {122, 275, 0, 0},
+    {81, 276, 0, 0},
+    {81, 277, 0, 0},
+    {81, 278, 0, 0},
+    {122, 279, 0, 0},
+    {122, 280, 0, 0},
+    {122, 281, 0, 0},
+    {122, 282, 0, 0},
+    {122, 283, 0, 0},
+    {81, 284, 0, 0},
+    {81, 285, 0, 0},
+    {81, 286, 0, 0},
+    {81, 287, 0, 0},
+    {81, 288, 0, 0},
+    {82, 289, 0, 0},
+    {82, 290, 0, 0},
+    {82, 291, 0, 0},
+    {2, 292, 0, 0},
+    {3, 293, 0, 0},
+    {4, 294, 0, 0},
+    {2, 295, 0, 0},
+    {3, 296, 0, 0},
+    {4, 297, 0, 0},
+    {11, 298, 0, 0},
+    {11, 299, 0, 0},
+    {11, 300, 0, 0},
+    {1, 301, 0, 0},
+    {11, 302, 0, 0},
+    {33, 303, 0, 0},
+    {10, 304, 0, 0},
+    {53, 305, 0, 0},
+    {8009, 306, 0, 0},
+    {123, 307, 0, 0},
+    {8040, 308, 0, 0},
+    {20, 309, 0, 0},
+    {16, 310, 0, 0},
+    {23, 311, 0, 0},
+    {19, 312, 0, 0},
+    {13, 313, 0, 0},
+    {22, 314, 0, 0},
+    {18, 315, 0, 0},
+    {12, 316, 0, 0},
+    {21, 317, 0, 0},
+    {84, 318, 0, 0},
+    {84, 319, 0, 0},
+    {8041, 320, 0, 0},
+    {30, 321, 0, 0},
+    {10040, 322, 0, 0},
+    {8006, 323, 0, 0},
+    {8041, 324, 0, 0},
+    {8020, 325, 0, 0},
+    {8020, 326, 0, 0},
+    {8020, 327, 0, 0},
+    {8020, 328, 0, 0},
+    {10060, 329, 0, 0},
+    {10060, 330, 0, 0},
+    {10030, 331, 0, 0},
+    {10030, 332, 0, 0},
+    {10060, 333, 0, 0},
+    {10060, 334, 0, 0},
+    {10030, 335, 0, 0},
+    {9001, 336, 0, 0},
+    {9001, 337, 0, 0},
+    {10030, 338, 0, 0},
+    {10030, 339, 0, 0},
+    {10060, 340, 0, 0},
+    {10060, 341, 0, 0},
+    {10060, 342, 0, 0},
+    {10060, 343, 0, 0},
+    {10060, 344, 0, 0},
+    {10060, 345, 0, 0},
+    {10060, 346, 0, 0},
+    {10060, 347, 0, 0},
+    {10060, 348, 0, 0},
+    {10060, 349, 0, 0},
+    {8020, 350, 0, 0},
+    {8020, 351, 0, 0},
+    {8020, 352, 0, 0},
+    {9001, 353, 0, 0},
+    {9001, 354, 0, 0},
+    {9001, 355, 0, 0},
+    {9001, 356, 0, 0},
+    {9001, 357, 0, 0},
+    {9001, 358, 0, 0},
+    {9001, 359, 0, 0},
+    {9001, 360, 0, 0},
+    {9001, 361, 0, 0},
+    {9001, 362, 0, 0},
+    {9001, 363, 0, 0},
+    {9001, 364, 0, 0},
+    {124, 365, 0, 0},
+    {124, 366, 0, 0},
+    {124, 367, 0, 0},
+    {124, 368, 0, 0},
+    {124, 369, 0, 0},
+    {124, 370, 0, 0},
+    {124, 371, 0, 0},
+    {8004, 372, 0, 0},
+    {8004, 373, 0, 0},
+    {124, 374, 0, 0},
+    {124, 375, 0, 0},
+    {124, 376, 0, 0},
+    {124, 377, 0, 0},
+    {1406, 378, 0, 0},
+    {1404, 379, 0, 0},
+    {10030, 380, 0, 0},
+    {10030, 381, 0, 0},
+    {8010, 382, 0, 0},
+    {82, 383, 0, 0},
+    {10120, 384, 0, 0},
+    {10120, 385, 0, 0},
+    {10120, 386, 0, 0},
+    {11, 387, 0, 0},
+    {11, 388, 0, 0},
+    {11, 389, 0, 0},
+    {11, 390, 0, 0},
+    {9100, 391, 0, 0},
+    {9101, 392, 0, 0},
+    {9102, 393, 0, 0},
+    {9103, 394, 0, 0},
+    {9100, 395, 0, 0},
+    {9101, 396, 0, 0},
+    {9102, 397, 0, 0},
+    {9103, 398, 0, 0},
+    // Guardian of Fire
+    {1, 0, 0, 0},
+    {3000, 1, 0, 0},
+    {3000, 2, 0, 0},
+    {3001, 3, 0, 0},
+    {3001, 4, 0, 0},
+    {3002, 5, 0, 0},
+    {3000, 6, 0, 0},
+    {14, 7, 0, 0},
+    {9001, 8, 0, 0},
+    {9001, 9, 0, 0},
+    {9001, 10, 0, 0},
+    {9001, 11, 0, 0},
+    {9001, 12, 0, 0},
+    {9001, 13, 0, 0},
+    {9001, 14, 0, 0},
+    {9001, 15, 0, 0},
+    {9001, 16, 0, 0},
+    {9001, 17, 0, 0},
+    {9001, 18, 0, 0},
+    {9001, 19, 0, 0},
+    {9001, 20, 0, 0},
+    {9001, 21, 0, 0},
+    {9001, 22, 0, 0},
+    {9001, 23, 0, 0},
+    {9001, 24, 0, 0},
+    {9001, 25, 0, 0},
+    {9001, 26, 0, 0},
+    {9001, 27, 0, 0},
+    {9001, 28, 0, 0},
+    {9001, 29, 0, 0},
+    {9001, 30, 0, 0},
+    {9001, 31, 0, 0},
+    {9001, 32, 0, 0},
+    {9001, 33, 0, 0},
+    {9001, 34, 0, 0},
+    {9001, 35, 0, 0},
+    {9001, 36, 0, 0},
+    {9001, 37, 0, 0},
+    {54, 38, 0, 0},
+    {54, 39, 0, 0},
+    {54, 40, 0, 0},
+    {54, 41, 0, 0},
+    {54, 42, 0, 0},
+    {54, 43, 0, 0},
+    {54, 44, 0, 0},
+    {54, 45, 0, 0},
+    {9001, 46, 0, 0},
+    {9001, 47, 0, 0},
+    {9001, 48, 0, 0},
+    {82, 49, 0, 0},
+    {82, 50, 0, 0},
+    {82, 51, 0, 0},
+    {82, 52, 0, 0},
+    {9001, 53, 0, 0},
+    {9001, 54, 0, 0},
+    {9001, 55, 0, 0},
+    {9001, 56, 0, 0},
+    {117, 57, 0, 0},
+    {117, 58, 0, 0},
+    {117, 59, 0, 0},
+    {117, 60, 0, 0},
+    {117, 61, 0, 0},
+    {117, 62, 0, 0},
+    {55, 63, 0, 0},
+    {55, 64, 0, 0},
+    {55, 65, 0, 0},
+    {55, 66, 0, 0},
+    {116, 67, 0, 0},
+    {116, 68, 0, 0},
+    {9001, 69, 0, 0},
+    {9001, 70, 0, 0},
+    {9001, 71, 0, 0},
+    {9001, 72, 0, 0},
+    {140, 73, 0, 0},
+    {9014, 74, 0, 0},
+    {1405, 75, 0, 0},
+    {117, 76, 0, 0},
+    {117, 77, 0, 0},
+    {117, 78, 0, 0},
+    {117, 79, 0, 0},
+    {117, 80, 0, 0},
+    {117, 81, 0, 0},
+    {117, 82, 0, 0},
+    {117, 83, 0, 0},
+    {9001, 84, 0, 0},
+    {9001, 85, 0, 0},
+    {9001, 86, 0, 0},
+    {9001, 87, 0, 0},
+    {9001, 88, 0, 0},
+    {9001, 89, 0, 0},
+    {9001, 90, 0, 0},
+    {9001, 91, 0, 0},
+    {9001, 92, 0, 0},
+    {8050, 93, 0, 0},
+    {8050, 94, 0, 0},
+    {8045, 95, 0, 0},
+    {8045, 96, 0, 0},
+    {8049, 97, 0, 0},
+    {8049, 98, 0, 0},
+    {8045, 99, 0, 0},
+    {8045, 100, 0, 0},
+    {8049, 101, 0, 0},
+    {8049, 102, 0, 0},
+    {8046, 103, 0, 0},
+    {8046, 104, 0, 0},
+    {53, 105, 0, 0},
+    {36, 106, 0, 0},
+    {8006, 107, 0, 0},
+    {8000, 108, 0, 0},
+    {8000, 109, 0, 0},
+    {8000, 110, 0, 0},
+    {8000, 111, 0, 0},
+    {8000, 112, 0, 0},
+    {8000, 113, 0, 0},
+    {8000, 114, 0, 0},
+    {10060, 115, 0, 0},
+    {10060, 116, 0, 0},
+    {10060, 117, 0, 0},
+    {10060, 118, 0, 0},
+    {10060, 119, 0, 0},
+    {10060, 120, 0, 0},
+    {10030, 121, 0, 0},
+    {10030, 122, 0, 0},
+    {10030, 123, 0, 0},
+    {10030, 124, 0, 0},
+    {10060, 125, 0, 0},
+    {10060, 126, 0, 0},
+    {10060, 127, 0, 0},
+    {10060, 128, 0, 0},
+    {10060, 129, 0, 0},
+    {10060, 130, 0, 0},
+    {10060, 131, 0, 0},
+    {10030, 132, 0, 0},
+    {10030, 133, 0, 0},
+    {10030, 134, 0, 0},
+    {10030, 135, 0, 0},
+    {10030, 136, 0, 0},
+    {10030, 137, 0, 0},
+    {81, 138, 0, 0},
+    {81, 139, 0, 0},
+    {81, 140, 0, 0},
+    {81, 141, 0, 0},
+    {81, 142, 0, 0},
+    {81, 143, 0, 0},
+    {81, 144, 0, 0},
+    {81, 145, 0, 0},
+    {122, 146, 0, 0},
+    {122, 147, 0, 0},
+    {122, 148, 0, 0},
+    {122, 149, 0, 0},
+    {122, 150, 0, 0},
+    {122, 151, 0, 0},
+    {122, 152, 0, 0},
+    {122, 153, 0, 0},
+    {82, 154, 0, 0},
+    {82, 155, 0, 0},
+    {10030, 156, 0, 0},
+    {10030, 157, 0, 0},
+    {10030, 158, 0, 0},
+    {10030, 159, 0, 0},
+    {10030, 160, 0, 0},
+    {10030, 161, 0, 0},
+    {122, 162, 0, 0},
+    {122, 163, 0, 0},
+    {122, 164, 0, 0},
+    {81, 165, 0, 0},
+    {81, 166, 0, 0},
+    {81, 167, 0, 0},
+    {81, 168, 0, 0},
+    {81, 169, 0, 0},
+    {8000, 170, 0, 0},
+    {8000, 171, 0, 0},
+    {8000, 172, 0, 0},
+    {8000, 173, 0, 0},
+    {81, 174, 0, 0},
+    {81, 175, 0, 0},
+    {81, 176, 0, 0},
+    {81, 177, 0, 0},
+    {122, 178, 0, 0},
+    {81, 179, 0, 0},
+    {81, 180, 0, 0},
+    {8000, 181, 0, 0},
+    {10060, 182, 0, 0},
+    {10060, 183, 0, 0},
+    {10030, 184, 0, 0},
+    {10030, 185, 0, 0},
+    {10030, 186, 0, 0},
+    {10030, 187, 0, 0},
+    {10060, 188, 0, 0},
+    {10060, 189, 0, 0},
+    {2, 190, 0, 0},
+    {3, 191, 0, 0},
+    {4, 192, 0, 0},
+    {1, 193, 0, 0},
+    {2, 194, 0, 0},
+    {3, 195, 0, 0},
+    {4, 196, 0, 0},
+    {11, 197, 0, 0},
+    {11, 198, 0, 0},
+    {11, 199, 0, 0},
+    {11, 200, 0, 0},
+    {10, 201, 0, 0},
+    {8010, 202, 0, 0},
+    {8009, 203, 0, 0},
+    {123, 204, 0, 0},
+    {8040, 205, 0, 0},
+    {20, 206, 0, 0},
+    {19, 207, 0, 0},
+    {18, 208, 0, 0},
+    {16, 209, 0, 0},
+    {13, 210, 0, 0},
+    {12, 211, 0, 0},
+    {23, 212, 0, 0},
+    {22, 213, 0, 0},
+    {21, 214, 0, 0},
+    {8005, 215, 0, 0},
+    {10110, 216, 0, 0},
+    {10110, 217, 0, 0},
+    {10110, 218, 0, 0},
+    {10110, 219, 0, 0},
+    {8002, 220, 0, 0},
+    {8041, 221, 0, 0},
+    {84, 222, 0, 0},
+    {30, 223, 0, 0},
+    {11, 224, 0, 0},
+    {4, 225, 0, 0},
+    {3, 226, 0, 0},
+    {2, 227, 0, 0},
+    {1, 228, 0, 0},
+    {32, 229, 0, 0},
+    {84, 230, 0, 0},
+    {10060, 231, 0, 0},
+    {10060, 232, 0, 0},
+    {10060, 233, 0, 0},
+    {10030, 234, 0, 0},
+    {10030, 235, 0, 0},
+    {10030, 236, 0, 0},
+    {10030, 237, 0, 0},
+    {10060, 238, 0, 0},
+    {10060, 239, 0, 0},
+    {10060, 240, 0, 0},
+    {10060, 241, 0, 0},
+    {10030, 242, 0, 0},
+    {10030, 243, 0, 0},
+    {10030, 244, 0, 0},
+    {10030, 245, 0, 0},
+    {10060, 246, 0, 0},
+    {10060, 247, 0, 0},
+    {10060, 248, 0, 0},
+    {10060, 249, 0, 0},
+    {10060, 250, 0, 0},
+    {10060, 251, 0, 0},
+    {10060, 252, 0, 0},
+    {10060, 253, 0, 0},
+    {10060, 254, 0, 0},
+    {10060, 255, 0, 0},
+    {10060, 256, 0, 0},
+    {9001, 257, 0, 0},
+    {9001, 258, 0, 0},
+    {9001, 259, 0, 0},
+    {9001, 260, 0, 0},
+    {9001, 261, 0, 0},
+    {124, 262, 0, 0},
+    {124, 263, 0, 0},
+    {124, 264, 0, 0},
+    {124, 265, 0, 0},
+    {124, 266, 0, 0},
+    {124, 267, 0, 0},
+    {124, 268, 0, 0},
+    {8004, 269, 0, 0},
+    {8004, 270, 0, 0},
+    {8004, 271, 0, 0},
+    {124, 272, 0, 0},
+    {124, 273, 0, 0},
+    {124, 274, 0, 0},
+    {124, 275, 0, 0},
+    {53, 276, 0, 0},
+    {82, 277, 0, 0},
+    {10120, 278, 0, 0},
+    {10120, 279, 0, 0},
+    {10120, 280, 0, 0},
+    {11, 281, 0, 0},
+    {11, 282, 0, 0},
+    {11, 283, 0, 0},
+    {9100, 284, 0, 0},
+    {9101, 285, 0, 0},
+    {9102, 286, 0, 0},
+    {9103, 287, 0, 0},
+    {9100, 288, 0, 0},
+    {9101, 289, 0, 0},
+    {9102, 290, 0, 0},
+    {9103, 291, 0, 0},
+    {9100, 292, 0, 0},
+    {9101, 293, 0, 0},
+    {9102, 294, 0, 0},
+    {9103, 295, 0, 0},
+    // Guardian of Steel
+    {1, 0, 0, 0},
+    {3002, 1, 0, 0},
+    {3002, 2, 0, 0},
+    {3002, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {3002, 5, 0, 0},
+    {3002, 6, 0, 0},
+    {10, 7, 0, 0},
+    {116, 8, 0, 0},
+    {116, 9, 0, 0},
+    {116, 10, 0, 0},
+    {116, 11, 0, 0},
+    {54, 12, 0, 0},
+    {54, 13, 0, 0},
+    {54, 14, 0, 0},
+    {54, 15, 0, 0},
+    {1407, 16, 0, 0},
+    {1407, 17, 0, 0},
+    {1407, 18, 0, 0},
+    {8020, 19, 0, 0},
+    {8020, 20, 0, 0},
+    {8020, 21, 0, 0},
+    {8005, 22, 0, 0},
+    {122, 23, 0, 0},
+    {122, 24, 0, 0},
+    {10040, 25, 0, 0},
+    {82, 26, 0, 0},
+    {82, 27, 0, 0},
+    {82, 28, 0, 0},
+    {1402, 29, 0, 0},
+    {1402, 30, 0, 0},
+    {1409, 31, 0, 0},
+    {1409, 32, 0, 0},
+    {1409, 33, 0, 0},
+    {1409, 34, 0, 0},
+    {1402, 35, 0, 0},
+    {1402, 36, 0, 0},
+    {1402, 37, 0, 0},
+    {1402, 38, 0, 0},
+    {1409, 39, 0, 0},
+    {1409, 40, 0, 0},
+    {1409, 41, 0, 0},
+    {1409, 42, 0, 0},
+    {1402, 43, 0, 0},
+    {1402, 44, 0, 0},
+    {1409, 45, 0, 0},
+    {1409, 46, 0, 0},
+    {1409, 47, 0, 0},
+    {1409, 48, 0, 0},
+    {1409, 49, 0, 0},
+    {1409, 50, 0, 0},
+    {1409, 51, 0, 0},
+    {1409, 52, 0, 0},
+    {1409, 53, 0, 0},
+    {1409, 54, 0, 0},
+    {1404, 55, 0, 0},
+    {1404, 56, 0, 0},
+    {1404, 57, 0, 0},
+    {1404, 58, 0, 0},
+    {1404, 59, 0, 0},
+    {1404, 60, 0, 0},
+    {1404, 61, 0, 0},
+    {1404, 62, 0, 0},
+    {1404, 63, 0, 0},
+    {1404, 64, 0, 0},
+    {1404, 65, 0, 0},
+    {1404, 66, 0, 0},
+    {1409, 67, 0, 0},
+    {1404, 68, 0, 0},
+    {1404, 69, 0, 0},
+    {1404, 70, 0, 0},
+    {1404, 71, 0, 0},
+    {1404, 72, 0, 0},
+    {1404, 73, 0, 0},
+    {1404, 74, 0, 0},
+    {1404, 75, 0, 0},
+    {1404, 76, 0, 0},
+    {1404, 77, 0, 0},
+    {1404, 78, 0, 0},
+    {1404, 79, 0, 0},
+    {1404, 80, 0, 0},
+    {1404, 81, 0, 0},
+    {1404, 82, 0, 0},
+    {1404, 83, 0, 0},
+    {8051, 84, 0, 0},
+    {8051, 85, 0, 0},
+    {8051, 86, 0, 0},
+    {8051, 87, 0, 0},
+    {8042, 88, 0, 0},
+    {8042, 89, 0, 0},
+    {8042, 90, 0, 0},
+    {8042, 91, 0, 0},
+    {8048, 92, 0, 0},
+    {8048, 93, 0, 0},
+    {8048, 94, 0, 0},
+    {8048, 95, 0, 0},
+    {8048, 96, 0, 0},
+    {8048, 97, 0, 0},
+    {8048, 98, 0, 0},
+    {8048, 99, 0, 0},
+    {8052, 100, 0, 0},
+    {8052, 101, 0, 0},
+    {8052, 102, 0, 0},
+    {8052, 103, 0, 0},
+    {8052, 104, 0, 0},
+    {8052, 105, 0, 0},
+    {8052, 106, 0, 0},
+    {8052, 107, 0, 0},
+    {8060, 108, 0, 0},
+    {8060, 109, 0, 0},
+    {8060, 110, 0, 0},
+    {8060, 111, 0, 0},
+    {8060, 112, 0, 0},
+    {8060, 113, 0, 0},
+    {8060, 114, 0, 0},
+    {8060, 115, 0, 0},
+    {93, 116, 0, 0},
+    {93, 117, 0, 0},
+    {93, 118, 0, 0},
+    {94, 119, 0, 0},
+    {94, 120, 0, 0},
+    {94, 121, 0, 0},
+    {95, 122, 0, 0},
+    {95, 123, 0, 0},
+    {95, 124, 0, 0},
+    {95, 125, 0, 0},
+    {95, 126, 0, 0},
+    {89, 127, 0, 0},
+    {89, 128, 0, 0},
+    {89, 129, 0, 0},
+    {89, 130, 0, 0},
+    {89, 131, 0, 0},
+    {90, 132, 0, 0},
+    {90, 133, 0, 0},
+    {90, 134, 0, 0},
+    {90, 135, 0, 0},
+    {90, 136, 0, 0},
+    {90, 137, 0, 0},
+    {91, 138, 0, 0},
+    {91, 139, 0, 0},
+    {91, 140, 0, 0},
+    {91, 141, 0, 0},
+    {91, 142, 0, 0},
+    {91, 143, 0, 0},
+    {91, 144, 0, 0},
+    {90, 145, 0, 0},
+    {8052, 146, 0, 0},
+    {8052, 147, 0, 0},
+    {8052, 148, 0, 0},
+    {8052, 149, 0, 0},
+    {54, 150, 0, 0},
+    {54, 151, 0, 0},
+    {54, 152, 0, 0},
+    {54, 153, 0, 0},
+    {54, 154, 0, 0},
+    {54, 155, 0, 0},
+    {54, 156, 0, 0},
+    {54, 157, 0, 0},
+    {8060, 158, 0, 0},
+    {8060, 159, 0, 0},
+    {8060, 160, 0, 0},
+    {8060, 161, 0, 0},
+    {9001, 162, 0, 0},
+    {8000, 163, 0, 0},
+    {8000, 164, 0, 0},
+    {8000, 165, 0, 0},
+    {8000, 166, 0, 0},
+    {8000, 167, 0, 0},
+    {8000, 168, 0, 0},
+    {8000, 169, 0, 0},
+    {8000, 170, 0, 0},
+    {8000, 171, 0, 0},
+    {8000, 172, 0, 0},
+    {8000, 173, 0, 0},
+    {8000, 174, 0, 0},
+    {8000, 175, 0, 0},
+    {8000, 176, 0, 0},
+    {8000, 177, 0, 0},
+    {8000, 178, 0, 0},
+    {8000, 179, 0, 0},
+    {8000, 180, 0, 0},
+    {8000, 181, 0, 0},
+    {8000, 182, 0, 0},
+    {8000, 183, 0, 0},
+    {8000, 184, 0, 0},
+    {8000, 185, 0, 0},
+    {8020, 186, 0, 0},
+    {8020, 187, 0, 0},
+    {8020, 188, 0, 0},
+    {8020, 189, 0, 0},
+    {8020, 190, 0, 0},
+    {107, 191, 0, 0},
+    {107, 192, 0, 0},
+    {107, 193, 0, 0},
+    {107, 194, 0, 0},
+    {107, 195, 0, 0},
+    {107, 196, 0, 0},
+    {10030, 197, 0, 0},
+    {10030, 198, 0, 0},
+    {10030, 199, 0, 0},
+    {10030, 200, 0, 0},
+    {10030, 201, 0, 0},
+    {10030, 202, 0, 0},
+    {107, 203, 0, 0},
+    {107, 204, 0, 0},
+    {107, 205, 0, 0},
+    {31, 206, 0, 0},
+    {31, 207, 0, 0},
+    {31, 208, 0, 0},
+    {31, 209, 0, 0},
+    {31, 210, 0, 0},
+    {31, 211, 0, 0},
+    {107, 212, 0, 0},
+    {107, 213, 0, 0},
+    {107, 214, 0, 0},
+    {107, 215, 0, 0},
+    {10030, 216, 0, 0},
+    {10030, 217, 0, 0},
+    {107, 218, 0, 0},
+    {107, 219, 0, 0},
+    {107, 220, 0, 0},
+    {107, 221, 0, 0},
+    {107, 222, 0, 0},
+    {107, 223, 0, 0},
+    {107, 224, 0, 0},
+    {107, 225, 0, 0},
+    {10030, 226, 0, 0},
+    {10030, 227, 0, 0},
+    {10030, 228, 0, 0},
+    {10030, 229, 0, 0},
+    {10030, 230, 0, 0},
+    {10030, 231, 0, 0},
+    {31, 232, 0, 0},
+    {31, 233, 0, 0},
+    {31, 234, 0, 0},
+    {31, 235, 0, 0},
+    {31, 236, 0, 0},
+    {31, 237, 0, 0},
+    {10030, 238, 0, 0},
+    {10030, 239, 0, 0},
+    {10030, 240, 0, 0},
+    {10030, 241, 0, 0},
+    {10030, 242, 0, 0},
+    {10030, 243, 0, 0},
+    {10030, 244, 0, 0},
+    {10030, 245, 0, 0},
+    {10030, 246, 0, 0},
+    {3000, 247, 0, 0},
+    {3000, 248, 0, 0},
+    {3000, 249, 0, 0},
+    {3000, 250, 0, 0},
+    {3000, 251, 0, 0},
+    {3000, 252, 0, 0},
+    {11, 253, 0, 0},
+    {11, 254, 0, 0},
+    {11, 255, 0, 0},
+    {11, 256, 0, 0},
+    {2, 257, 0, 0},
+    {3, 258, 0, 0},
+    {4, 259, 0, 0},
+    {4, 260, 0, 0},
+    {3, 261, 0, 0},
+    {2, 262, 0, 0},
+    {1, 263, 0, 0},
+    {1, 264, 0, 0},
+    {2, 265, 0, 0},
+    {3, 266, 0, 0},
+    {4, 267, 0, 0},
+    {33, 268, 0, 0},
+    {8010, 269, 0, 0},
+    {123, 270, 0, 0},
+    {16, 271, 0, 0},
+    {13, 272, 0, 0},
+    {12, 273, 0, 0},
+    {8009, 274, 0, 0},
+    {20, 275, 0, 0},
+    {19, 276, 0, 0},
+    {18, 277, 0, 0},
+    {53, 278, 0, 0},
+    {8040, 279, 0, 0},
+    {23, 280, 0, 0},
+    {22, 281, 0, 0},
+    {21, 282, 0, 0},
+    {8020, 283, 0, 0},
+    {8020, 284, 0, 0},
+    {8020, 285, 0, 0},
+    {82, 286, 0, 0},
+    {82, 287, 0, 0},
+    {82, 288, 0, 0},
+    {82, 289, 0, 0},
+    {82, 290, 0, 0},
+    {82, 291, 0, 0},
+    {82, 292, 0, 0},
+    {82, 293, 0, 0},
+    {122, 294, 0, 0},
+    {122, 295, 0, 0},
+    {122, 296, 0, 0},
+    {122, 297, 0, 0},
+    {122, 298, 0, 0},
+    {122, 299, 0, 0},
+    {122, 300, 0, 0},
+    {122, 301, 0, 0},
+    {81, 302, 0, 0},
+    {81, 303, 0, 0},
+    {81, 304, 0, 0},
+    {81, 305, 0, 0},
+    {81, 306, 0, 0},
+    {81, 307, 0, 0},
+    {81, 308, 0, 0},
+    {81, 309, 0, 0},
+    {8020, 310, 0, 0},
+    {8020, 311, 0, 0},
+    {8020, 312, 0, 0},
+    {8020, 313, 0, 0},
+    {8020, 314, 0, 0},
+    {8020, 315, 0, 0},
+    {10060, 316, 0, 0},
+    {10060, 317, 0, 0},
+    {10060, 318, 0, 0},
+    {10060, 319, 0, 0},
+    {10060, 320, 0, 0},
+    {10060, 321, 0, 0},
+    {10060, 322, 0, 0},
+    {10060, 323, 0, 0},
+    {10030, 324, 0, 0},
+    {10030, 325, 0, 0},
+    {10030, 326, 0, 0},
+    {10030, 327, 0, 0},
+    {10060, 328, 0, 0},
+    {10060, 329, 0, 0},
+    {10060, 330, 0, 0},
+    {10060, 331, 0, 0},
+    {10030, 332, 0, 0},
+    {10030, 333, 0, 0},
+    {10030, 334, 0, 0},
+    {10030, 335, 0, 0},
+    {10060, 336, 0, 0},
+    {10060, 337, 0, 0},
+    {10030, 338, 0, 0},
+    {10030, 339, 0, 0},
+    {10030, 340, 0, 0},
+    {10030, 341, 0, 0},
+    {10060, 342, 0, 0},
+    {10060, 343, 0, 0},
+    {10060, 344, 0, 0},
+    {10030, 345, 0, 0},
+    {10030, 346, 0, 0},
+    {10060, 347, 0, 0},
+    {10060, 348, 0, 0},
+    {31, 349, 0, 0},
+    {31, 350, 0, 0},
+    {107, 351, 0, 0},
+    {107, 352, 0, 0},
+    {10030, 353, 0, 0},
+    {10030, 354, 0, 0},
+    {10030, 355, 0, 0},
+    {10030, 356, 0, 0},
+    {107, 357, 0, 0},
+    {10030, 358, 0, 0},
+    {10060, 359, 0, 0},
+    {10060, 360, 0, 0},
+    {10060, 361, 0, 0},
+    {10060, 362, 0, 0},
+    {10060, 363, 0, 0},
+    {10060, 364, 0, 0},
+    {10060, 365, 0, 0},
+    {9001, 366, 0, 0},
+    {9001, 367, 0, 0},
+    {9001, 368, 0, 0},
+    {9001, 369, 0, 0},
+    {9001, 370, 0, 0},
+    {124, 371, 0, 0},
+    {124, 372, 0, 0},
+    {124, 373, 0, 0},
+    {124, 374, 0, 0},
+    {124, 375, 0, 0},
+    {124, 376, 0, 0},
+    {8004, 377, 0, 0},
+    {8004, 378, 0, 0},
+    {8004, 379, 0, 0},
+    {124, 380, 0, 0},
+    {124, 381, 0, 0},
+    {124, 382, 0, 0},
+    {124, 383, 0, 0},
+    {124, 384, 0, 0},
+    {124, 385, 0, 0},
+    {8004, 386, 0, 0},
+    {124, 387, 0, 0},
+    {124, 388, 0, 0},
+    {124, 389, 0, 0},
+    {124, 390, 0, 0},
+    {124, 391, 0, 0},
+    {124, 392, 0, 0},
+    {124, 393, 0, 0},
+    {124, 394, 0, 0},
+    {84, 395, 0, 0},
+    {32, 396, 0, 0},
+    {10, 397, 0, 0},
+    {82, 398, 0, 0},
+    {84, 399, 0, 0},
+    {122, 400, 0, 0},
+    {122, 401, 0, 0},
+    {122, 402, 0, 0},
+    {122, 403, 0, 0},
+    {122, 404, 0, 0},
+    {122, 405, 0, 0},
+    {122, 406, 0, 0},
+    {122, 407, 0, 0},
+    {122, 408, 0, 0},
+    {122, 409, 0, 0},
+    {122, 410, 0, 0},
+    {122, 411, 0, 0},
+    {122, 412, 0, 0},
+    {122, 413, 0, 0},
+    {122, 414, 0, 0},
+    {122, 415, 0, 0},
+    {122, 416, 0, 0},
+    {122, 417, 0, 0},
+    {122, 418, 0, 0},
+    {122, 419, 0, 0},
+    {122, 420, 0, 0},
+    {122, 421, 0, 0},
+    {122, 422, 0, 0},
+    {122, 423, 0, 0},
+    {122, 424, 0, 0},
+    {122, 425, 0, 0},
+    {122, 426, 0, 0},
+    {122, 427, 0, 0},
+    {122, 428, 0, 0},
+    {122, 429, 0, 0},
+    {122, 430, 0, 0},
+    {122, 431, 0, 0},
+    {122, 432, 0, 0},
+    {122, 433, 0, 0},
+    {122, 434, 0, 0},
+    {122, 435, 0, 0},
+    {122, 436, 0, 0},
+    {122, 437, 0, 0},
+    {122, 438, 0, 0},
+    {122, 439, 0, 0},
+    {122, 440, 0, 0},
+    {122, 441, 0, 0},
+    {81, 442, 0, 0},
+    {81, 443, 0, 0},
+    {81, 444, 0, 0},
+    {81, 445, 0, 0},
+    {81, 446, 0, 0},
+    {81, 447, 0, 0},
+    {81, 448, 0, 0},
+    {81, 449, 0, 0},
+    {81, 450, 0, 0},
+    {81, 451, 0, 0},
+    {81, 452, 0, 0},
+    {81, 453, 0, 0},
+    {81, 454, 0, 0},
+    {81, 455, 0, 0},
+    {81, 456, 0, 0},
+    {81, 457, 0, 0},
+    {81, 458, 0, 0},
+    {81, 459, 0, 0},
+    {81, 460, 0, 0},
+    {81, 461, 0, 0},
+    {81, 462, 0, 0},
+    {81, 463, 0, 0},
+    {81, 464, 0, 0},
+    {81, 465, 0, 0},
+    {81, 466, 0, 0},
+    {81, 467, 0, 0},
+    {81, 468, 0, 0},
+    {81, 469, 0, 0},
+    {81, 470, 0, 0},
+    {81, 471, 0, 0},
+    {81, 472, 0, 0},
+    {81, 473, 0, 0},
+    {81, 474, 0, 0},
+    {10120, 475, 0, 0},
+    {10120, 476, 0, 0},
+    {10120, 477, 0, 0},
+    {10120, 478, 0, 0},
+    {9100, 479, 0, 0},
+    {9101, 480, 0, 0},
+    {9102, 481, 0, 0},
+    {9103, 482, 0, 0},
+    {9100, 483, 0, 0},
+    {9101, 484, 0, 0},
+    {9102, 485, 0, 0},
+    {9103, 486, 0, 0},
+    {9100, 487, 0, 0},
+    {9101, 488, 0, 0},
+    {9102, 489, 0, 0},
+    {9103, 490, 0, 0},
+    {11, 491, 0, 0},
+    {11, 492, 0, 0},
+    {11, 493, 0, 0},
+    {11, 494, 0, 0},
+    // Bright Crucible
+    {1, 0, 0, 0},
+    {118, 1, 0, 0},
+    {118, 2, 0, 0},
+    {118, 3, 0, 0},
+    {118, 4, 0, 0},
+    {74, 5, 0, 0},
+    {74, 6, 0, 0},
+    {74, 7, 0, 0},
+    {74, 8, 0, 0},
+    {9001, 9, 0, 0},
+    {9001, 10, 0, 0},
+    {9001, 11, 0, 0},
+    {9001, 12, 0, 0},
+    {107, 13, 0, 0},
+    {107, 14, 0, 0},
+    {107, 15, 0, 0},
+    {107, 16, 0, 0},
+    {107, 17, 0, 0},
+    {107, 18, 0, 0},
+    {9003, 19, 0, 0},
+    {9012, 20, 0, 0},
+    {74, 21, 0, 0},
+    {74, 22, 0, 0},
+    {74, 23, 0, 0},
+    {74, 24, 0, 0},
+    {9001, 25, 0, 0},
+    {9001, 26, 0, 0},
+    {9001, 27, 0, 0},
+    {9001, 28, 0, 0},
+    {10030, 29, 0, 0},
+    {10030, 30, 0, 0},
+    {10030, 31, 0, 0},
+    {10030, 32, 0, 0},
+    {10030, 33, 0, 0},
+    {10030, 34, 0, 0},
+    {10030, 35, 0, 0},
+    {10030, 36, 0, 0},
+    {10030, 37, 0, 0},
+    {10030, 38, 0, 0},
+    {10030, 39, 0, 0},
+    {10030, 40, 0, 0},
+    {10030, 41, 0, 0},
+    {10030, 42, 0, 0},
+    {10030, 43, 0, 0},
+    {10030, 44, 0, 0},
+    {10030, 45, 0, 0},
+    {10030, 46, 0, 0},
+    {10030, 47, 0, 0},
+    {10030, 48, 0, 0},
+    {116, 49, 0, 0},
+    {116, 50, 0, 0},
+    {116, 51, 0, 0},
+    {116, 52, 0, 0},
+    {116, 53, 0, 0},
+    {116, 54, 0, 0},
+    {116, 55, 0, 0},
+    {116, 56, 0, 0},
+    {116, 57, 0, 0},
+    {116, 58, 0, 0},
+    {116, 59, 0, 0},
+    {116, 60, 0, 0},
+    {8061, 61, 0, 0},
+    {8061, 62, 0, 0},
+    {8061, 63, 0, 0},
+    {54, 64, 0, 0},
+    {54, 65, 0, 0},
+    {54, 66, 0, 0},
+    {54, 67, 0, 0},
+    {116, 68, 0, 0},
+    {116, 69, 0, 0},
+    {116, 70, 0, 0},
+    {116, 71, 0, 0},
+    {77, 72, 0, 0},
+    {77, 73, 0, 0},
+    {116, 74, 0, 0},
+    {116, 75, 0, 0},
+    {54, 76, 0, 0},
+    {54, 77, 0, 0},
+    {9, 78, 0, 0},
+    {7, 79, 0, 0},
+    {9, 80, 0, 0},
+    {9, 81, 0, 0},
+    {7, 82, 0, 0},
+    {15, 83, 0, 0},
+    {15, 84, 0, 0},
+    {7, 85, 0, 0},
+    {9, 86, 0, 0},
+    {15, 87, 0, 0},
+    {80, 88, 0, 0},
+    {87, 89, 0, 0},
+    {87, 90, 0, 0},
+    {87, 91, 0, 0},
+    {113, 92, 0, 0},
+    {113, 93, 0, 0},
+    {9001, 94, 0, 0},
+    {8008, 95, 0, 0},
+    {8005, 96, 0, 0},
+    {8006, 97, 0, 0},
+    {8007, 98, 0, 0},
+    {10110, 99, 0, 0},
+    {8000, 100, 0, 0},
+    {8000, 101, 0, 0},
+    {8000, 102, 0, 0},
+    {8000, 103, 0, 0},
+    {8000, 104, 0, 0},
+    {8000, 105, 0, 0},
+    {8000, 106, 0, 0},
+    {8000, 107, 0, 0},
+    {8000, 108, 0, 0},
+    {8000, 109, 0, 0},
+    {8000, 110, 0, 0},
+    {8000, 111, 0, 0},
+    {8000, 112, 0, 0},
+    {8000, 113, 0, 0},
+    {8000, 114, 0, 0},
+    {8000, 115, 0, 0},
+    {8000, 116, 0, 0},
+    {8000, 117, 0, 0},
+    {9001, 118, 0, 0},
+    {9001, 119, 0, 0},
+    {9001, 120, 0, 0},
+    {9001, 121, 0, 0},
+    {121, 122, 0, 0},
+    {121, 123, 0, 0},
+    {121, 124, 0, 0},
+    {121, 125, 0, 0},
+    {121, 126, 0, 0},
+    {121, 127, 0, 0},
+    {121, 128, 0, 0},
+    {10060, 129, 0, 0},
+    {10060, 130, 0, 0},
+    {10060, 131, 0, 0},
+    {10060, 132, 0, 0},
+    {8080, 133, 0, 0},
+    {8080, 134, 0, 0},
+    {8080, 135, 0, 0},
+    {8080, 136, 0, 0},
+    {8080, 137, 0, 0},
+    {8080, 138, 0, 0},
+    {8080, 139, 0, 0},
+    {8080, 140, 0, 0},
+    {8080, 141, 0, 0},
+    {11, 142, 0, 0},
+    {11, 143, 0, 0},
+    {11, 144, 0, 0},
+    {11, 145, 0, 0},
+    {8061, 146, 0, 0},
+    {80, 147, 0, 0},
+    {80, 148, 0, 0},
+    {80, 149, 0, 0},
+    {80, 150, 0, 0},
+    {80, 151, 0, 0},
+    {80, 152, 0, 0},
+    {87, 153, 0, 0},
+    {87, 154, 0, 0},
+    {37, 155, 0, 0},
+    {37, 156, 0, 0},
+    {37, 157, 0, 0},
+    {38, 158, 0, 0},
+    {38, 159, 0, 0},
+    {60, 160, 0, 0},
+    {60, 161, 0, 0},
+    {2, 162, 0, 0},
+    {3, 163, 0, 0},
+    {4, 164, 0, 0},
+    {107, 165, 0, 0},
+    {107, 166, 0, 0},
+    {107, 167, 0, 0},
+    {107, 168, 0, 0},
+    {107, 169, 0, 0},
+    {107, 170, 0, 0},
+    {31, 171, 0, 0},
+    {31, 172, 0, 0},
+    {31, 173, 0, 0},
+    {31, 174, 0, 0},
+    {31, 175, 0, 0},
+    {31, 176, 0, 0},
+    {31, 177, 0, 0},
+    {31, 178, 0, 0},
+    {31, 179, 0, 0},
+    {31, 180, 0, 0},
+    {31, 181, 0, 0},
+    {31, 182, 0, 0},
+    {31, 183, 0, 0},
+    {31, 184, 0, 0},
+    {31, 185, 0, 0},
+    {31, 186, 0, 0},
+    {31, 187, 0, 0},
+    {31, 188, 0, 0},
+    {10030, 189, 0, 0},
+    {10030, 190, 0, 0},
+    {10030, 191, 0, 0},
+    {10030, 192, 0, 0},
+    {84, 193, 0, 0},
+    {84, 194, 0, 0},
+    {83, 195, 0, 0},
+    {8010, 196, 0, 0},
+    {123, 197, 0, 0},
+    {16, 198, 0, 0},
+    {13, 199, 0, 0},
+    {12, 200, 0, 0},
+    {18, 201, 0, 0},
+    {19, 202, 0, 0},
+    {20, 203, 0, 0},
+    {8009, 204, 0, 0},
+    {10, 205, 0, 0},
+    {53, 206, 0, 0},
+    {8040, 207, 0, 0},
+    {23, 208, 0, 0},
+    {22, 209, 0, 0},
+    {21, 210, 0, 0},
+    {121, 211, 0, 0},
+    {121, 212, 0, 0},
+    {10030, 213, 0, 0},
+    {10030, 214, 0, 0},
+    {10030, 215, 0, 0},
+    {10030, 216, 0, 0},
+    {10030, 217, 0, 0},
+    {10030, 218, 0, 0},
+    {10030, 219, 0, 0},
+    {10030, 220, 0, 0},
+    {10030, 221, 0, 0},
+    {10060, 222, 0, 0},
+    {10060, 223, 0, 0},
+    {10060, 224, 0, 0},
+    {10060, 225, 0, 0},
+    {8080, 226, 0, 0},
+    {8080, 227, 0, 0},
+    {8080, 228, 0, 0},
+    {8080, 229, 0, 0},
+    {8080, 230, 0, 0},
+    {31, 231, 0, 0},
+    {31, 232, 0, 0},
+    {9001, 233, 0, 0},
+    {9001, 234, 0, 0},
+    {9001, 235, 0, 0},
+    {9001, 236, 0, 0},
+    {9001, 237, 0, 0},
+    {9001, 238, 0, 0},
+    {122, 239, 0, 0},
+    {122, 240, 0, 0},
+    {122, 241, 0, 0},
+    {122, 242, 0, 0},
+    {122, 243, 0, 0},
+    {122, 244, 0, 0},
+    {122, 245, 0, 0},
+    {122, 246, 0, 0},
+    {122, 247, 0, 0},
+    {122, 248, 0, 0},
+    {122, 249, 0, 0},
+    {122, 250, 0, 0},
+    {122, 251, 0, 0},
+    {122, 252, 0, 0},
+    {122, 253, 0, 0},
+    {122, 254, 0, 0},
+    {122, 255, 0, 0},
+    {122, 256, 0, 0},
+    {122, 257, 0, 0},
+    {122, 258, 0, 0},
+    {122, 259, 0, 0},
+    {122, 260, 0, 0},
+    {122, 261, 0, 0},
+    {122, 262, 0, 0},
+    {122, 263, 0, 0},
+    {122, 264, 0, 0},
+    {122, 265, 0, 0},
+    {122, 266, 0, 0},
+    {122, 267, 0, 0},
+    {122, 268, 0, 0},
+    {122, 269, 0, 0},
+    {122, 270, 0, 0},
+    {122, 271, 0, 0},
+    {122, 272, 0, 0},
+    {122, 273, 0, 0},
+    {122, 274, 0, 0},
+    {122, 275, 0, 0},
+    {122, 276, 0, 0},
+    {122, 277, 0, 0},
+    {122, 278, 0, 0},
+    {122, 279, 0, 0},
+    {122, 280, 0, 0},
+    {122, 281, 0, 0},
+    {124, 282, 0, 0},
+    {124, 283, 0, 0},
+    {124, 284, 0, 0},
+    {124, 285, 0, 0},
+    {124, 286, 0, 0},
+    {124, 287, 0, 0},
+    {124, 288, 0, 0},
+    {124, 289, 0, 0},
+    {124, 290, 0, 0},
+    {124, 291, 0, 0},
+    {124, 292, 0, 0},
+    {124, 293, 0, 0},
+    {124, 294, 0, 0},
+    {124, 295, 0, 0},
+    {124, 296, 0, 0},
+    {124, 297, 0, 0},
+    {124, 298, 0, 0},
+    {124, 299, 0, 0},
+    {124, 300, 0, 0},
+    {124, 301, 0, 0},
+    {124, 302, 0, 0},
+    {124, 303, 0, 0},
+    {8004, 304, 0, 0},
+    {8004, 305, 0, 0},
+    {8004, 306, 0, 0},
+    {8004, 307, 0, 0},
+    {81, 308, 0, 0},
+    {81, 309, 0, 0},
+    {81, 310, 0, 0},
+    {81, 311, 0, 0},
+    {81, 312, 0, 0},
+    {81, 313, 0, 0},
+    {81, 314, 0, 0},
+    {81, 315, 0, 0},
+    {81, 316, 0, 0},
+    {81, 317, 0, 0},
+    {81, 318, 0, 0},
+    {81, 319, 0, 0},
+    {81, 320, 0, 0},
+    {81, 321, 0, 0},
+    {81, 322, 0, 0},
+    {81, 323, 0, 0},
+    {81, 324, 0, 0},
+    {81, 325, 0, 0},
+    {81, 326, 0, 0},
+    {82, 327, 0, 0},
+    {82, 328, 0, 0},
+    {82, 329, 0, 0},
+    {82, 330, 0, 0},
+    {81, 331, 0, 0},
+    {81, 332, 0, 0},
+    {81, 333, 0, 0},
+    {81, 334, 0, 0},
+    {81, 335, 0, 0},
+    {81, 336, 0, 0},
+    {81, 337, 0, 0},
+    {81, 338, 0, 0},
+    {81, 339, 0, 0},
+    {81, 340, 0, 0},
+    {81, 341, 0, 0},
+    {81, 342, 0, 0},
+    {81, 343, 0, 0},
+    {81, 344, 0, 0},
+    {81, 345, 0, 0},
+    {81, 346, 0, 0},
+    {81, 347, 0, 0},
+    {81, 348, 0, 0},
+    {81, 349, 0, 0},
+    {81, 350, 0, 0},
+    {81, 351, 0, 0},
+    {81, 352, 0, 0},
+    {81, 353, 0, 0},
+    {81, 354, 0, 0},
+    {81, 355, 0, 0},
+    {82, 356, 0, 0},
+    {82, 357, 0, 0},
+    {82, 358, 0, 0},
+    {82, 359, 0, 0},
+    {82, 360, 0, 0},
+    {82, 361, 0, 0},
+    {82, 362, 0, 0},
+    {82, 363, 0, 0},
+    {82, 364, 0, 0},
+    {82, 365, 0, 0},
+    {82, 366, 0, 0},
+    {82, 367, 0, 0},
+    {82, 368, 0, 0},
+    {82, 369, 0, 0},
+    {82, 370, 0, 0},
+    {82, 371, 0, 0},
+    {82, 372, 0, 0},
+    {82, 373, 0, 0},
+    {10120, 374, 0, 0},
+    {10120, 375, 0, 0},
+    {10120, 376, 0, 0},
+    {10120, 377, 0, 0},
+    {9100, 378, 0, 0},
+    {9101, 379, 0, 0},
+    {9102, 380, 0, 0},
+    {9103, 381, 0, 0},
+    {11, 382, 0, 0},
+    {11, 383, 0, 0},
+    {11, 384, 0, 0},
+    {11, 385, 0, 0},
+    // Darkmere
+    {1, 0, 0, 0},
+    {1402, 1, 0, 0},
+    {2, 2, 0, 0},
+    {3, 3, 0, 0},
+    {4, 4, 0, 0},
+    {105, 5, 0, 0},
+    {10000, 6, 0, 0},
+    {10000, 7, 0, 0},
+    {10000, 8, 0, 0},
+    {88, 9, 0, 0},
+    {59, 10, 0, 0},
+    {59, 11, 0, 0},
+    {58, 12, 0, 0},
+    {58, 13, 0, 0},
+    {27, 14, 0, 0},
+    {60, 15, 0, 0},
+    {3000, 16, 0, 0},
+    {3002, 17, 0, 0},
+    {99, 18, 0, 0},
+    {99, 19, 0, 0},
+    {99, 20, 0, 0},
+    {97, 21, 0, 0},
+    {97, 22, 0, 0},
+    {97, 23, 0, 0},
+    {97, 24, 0, 0},
+    {98, 25, 0, 0},
+    {98, 26, 0, 0},
+    {98, 27, 0, 0},
+    {98, 28, 0, 0},
+    {61, 29, 0, 0},
+    {61, 30, 0, 0},
+    {41, 31, 0, 0},
+    {42, 32, 0, 0},
+    {44, 33, 0, 0},
+    {45, 34, 0, 0},
+    {45, 35, 0, 0},
+    {45, 36, 0, 0},
+    {45, 37, 0, 0},
+    {45, 38, 0, 0},
+    {45, 39, 0, 0},
+    {52, 40, 0, 0},
+    {52, 41, 0, 0},
+    {52, 42, 0, 0},
+    {56, 43, 0, 0},
+    {56, 44, 0, 0},
+    {56, 45, 0, 0},
+    {56, 46, 0, 0},
+    {56, 47, 0, 0},
+    {56, 48, 0, 0},
+    {57, 49, 0, 0},
+    {57, 50, 0, 0},
+    {57, 51, 0, 0},
+    {57, 52, 0, 0},
+    {48, 53, 0, 0},
+    {48, 54, 0, 0},
+    {49, 55, 0, 0},
+    {50, 56, 0, 0},
+    {50, 57, 0, 0},
+    {50, 58, 0, 0},
+    {51, 59, 0, 0},
+    {51, 60, 0, 0},
+    {51, 61, 0, 0},
+    {57, 62, 0, 0},
+    {57, 63, 0, 0},
+    {56, 64, 0, 0},
+    {5, 65, 0, 0},
+    {5, 66, 0, 0},
+    {8062, 67, 0, 0},
+    {8062, 68, 0, 0},
+    {8062, 69, 0, 0},
+    {8062, 70, 0, 0},
+    {8000, 71, 0, 0},
+    {8000, 72, 0, 0},
+    {8000, 73, 0, 0},
+    {8000, 74, 0, 0},
+    {8000, 75, 0, 0},
+    {8000, 76, 0, 0},
+    {8000, 77, 0, 0},
+    {8000, 78, 0, 0},
+    {8000, 79, 0, 0},
+    {11, 80, 0, 0},
+    {11, 81, 0, 0},
+    {27, 82, 0, 0},
+    {27, 83, 0, 0},
+    {27, 84, 0, 0},
+    {27, 85, 0, 0},
+    {27, 86, 0, 0},
+    {26, 87, 0, 0},
+    {26, 88, 0, 0},
+    {26, 89, 0, 0},
+    {26, 90, 0, 0},
+    {26, 91, 0, 0},
+    {26, 92, 0, 0},
+    {59, 93, 0, 0},
+    {59, 94, 0, 0},
+    {59, 95, 0, 0},
+    {59, 96, 0, 0},
+    {59, 97, 0, 0},
+    {59, 98, 0, 0},
+    {59, 99, 0, 0},
+    {58, 100, 0, 0},
+    {58, 101, 0, 0},
+    {58, 102, 0, 0},
+    {58, 103, 0, 0},
+    {27, 104, 0, 0},
+    {27, 105, 0, 0},
+    {27, 106, 0, 0},
+    {27, 107, 0, 0},
+    {27, 108, 0, 0},
+    {27, 109, 0, 0},
+    {8069, 110, 0, 0},
+    {59, 111, 0, 0},
+    {122, 112, 0, 0},
+    {81, 113, 0, 0},
+    {81, 114, 0, 0},
+    {10, 115, 0, 0},
+    {27, 116, 0, 0},
+    {27, 117, 0, 0},
+    {27, 118, 0, 0},
+    {27, 119, 0, 0},
+    {27, 120, 0, 0},
+    {27, 121, 0, 0},
+    {27, 122, 0, 0},
+    {27, 123, 0, 0},
+    {60, 124, 0, 0},
+    {27, 125, 0, 0},
+    {37, 126, 0, 0},
+    {37, 127, 0, 0},
+    {37, 128, 0, 0},
+    {37, 129, 0, 0},
+    {37, 130, 0, 0},
+    {37, 131, 0, 0},
+    {38, 132, 0, 0},
+    {99, 133, 0, 0},
+    {105, 134, 0, 0},
+    {105, 135, 0, 0},
+    {105, 136, 0, 0},
+    {105, 137, 0, 0},
+    {8042, 138, 0, 0},
+    {8042, 139, 0, 0},
+    {8042, 140, 0, 0},
+    {8042, 141, 0, 0},
+    {8042, 142, 0, 0},
+    {8042, 143, 0, 0},
+    {71, 144, 0, 0},
+    {71, 145, 0, 0},
+    {108, 146, 0, 0},
+    {111, 147, 0, 0},
+    {111, 148, 0, 0},
+    {111, 149, 0, 0},
+    {10503, 150, 0, 0},
+    {10503, 151, 0, 0},
+    {104, 152, 0, 0},
+    {111, 153, 0, 0},
+    {54, 154, 0, 0},
+    {54, 155, 0, 0},
+    {54, 156, 0, 0},
+    {17, 157, 0, 0},
+    {77, 158, 0, 0},
+    {8069, 159, 0, 0},
+    {10503, 160, 0, 0},
+    {10503, 161, 0, 0},
+    {8069, 162, 0, 0},
+    {10503, 163, 0, 0},
+    {10503, 164, 0, 0},
+    {77, 165, 0, 0},
+    {10503, 166, 0, 0},
+    {10503, 167, 0, 0},
+    {104, 168, 0, 0},
+    {1402, 169, 0, 0},
+    {3000, 170, 0, 0},
+    {3002, 171, 0, 0},
+    {54, 172, 0, 0},
+    {54, 173, 0, 0},
+    {116, 174, 0, 0},
+    {116, 175, 0, 0},
+    {116, 176, 0, 0},
+    {116, 177, 0, 0},
+    {116, 178, 0, 0},
+    {116, 179, 0, 0},
+    {116, 180, 0, 0},
+    {8100, 181, 0, 0},
+    {8100, 182, 0, 0},
+    {8100, 183, 0, 0},
+    {8100, 184, 0, 0},
+    {8100, 185, 0, 0},
+    {8100, 186, 0, 0},
+    {8100, 187, 0, 0},
+    {8100, 188, 0, 0},
+    {8100, 189, 0, 0},
+    {8064, 190, 0, 0},
+    {8064, 191, 0, 0},
+    {77, 192, 0, 0},
+    {77, 193, 0, 0},
+    {1410, 194, 0, 0},
+    {1410, 195, 0, 0},
+    {1410, 196, 0, 0},
+    {1410, 197, 0, 0},
+    {60, 198, 0, 0},
+    {38, 199, 0, 0},
+    {27, 200, 0, 0},
+    {27, 201, 0, 0},
+    {27, 202, 0, 0},
+    {27, 203, 0, 0},
+    {60, 204, 0, 0},
+    {60, 205, 0, 0},
+    {59, 206, 0, 0},
+    {59, 207, 0, 0},
+    {59, 208, 0, 0},
+    {8039, 209, 0, 0},
+    {8072, 210, 0, 0},
+    {8073, 211, 0, 0},
+    {71, 212, 0, 0},
+    {71, 213, 0, 0},
+    {71, 214, 0, 0},
+    {71, 215, 0, 0},
+    {108, 216, 0, 0},
+    {108, 217, 0, 0},
+    {108, 218, 0, 0},
+    {108, 219, 0, 0},
+    {26, 220, 0, 0},
+    {26, 221, 0, 0},
+    {26, 222, 0, 0},
+    {26, 223, 0, 0},
+    {26, 224, 0, 0},
+    {8071, 225, 0, 0},
+    {8103, 226, 0, 0},
+    {9001, 227, 0, 0},
+    {9001, 228, 0, 0},
+    {9001, 229, 0, 0},
+    {9001, 230, 0, 0},
+    {9001, 231, 0, 0},
+    {9001, 232, 0, 0},
+    {9001, 233, 0, 0},
+    {9001, 234, 0, 0},
+    {9001, 235, 0, 0},
+    {9001, 236, 0, 0},
+    {9001, 237, 0, 0},
+    {9001, 238, 0, 0},
+    {9001, 239, 0, 0},
+    {8042, 240, 0, 0},
+    {8042, 241, 0, 0},
+    {8042, 242, 0, 0},
+    {8042, 243, 0, 0},
+    {38, 244, 0, 0},
+    {38, 245, 0, 0},
+    {9001, 246, 0, 0},
+    {9001, 247, 0, 0},
+    {9001, 248, 0, 0},
+    {9001, 249, 0, 0},
+    {9001, 250, 0, 0},
+    {9001, 251, 0, 0},
+    {9001, 252, 0, 0},
+    {9001, 253, 0, 0},
+    {8200, 254, 0, 0},
+    {8008, 255, 0, 0},
+    {8008, 256, 0, 1},
+    {8008, 257, 0, 0},
+    {30, 258, 0, 0},
+    {30, 259, 0, 0},
+    {30, 260, 0, 0},
+    {84, 261, 0, 1},
+    {84, 262, 0, 0},
+    {84, 263, 0, 0},
+    {81, 264, 0, 0},
+    {81, 265, 0, 0},
+    {81, 266, 0, 0},
+    {81, 267, 0, 0},
+    {81, 268, 0, 0},
+    {81, 269, 0, 0},
+    {82, 270, 0, 0},
+    {82, 271, 0, 0},
+    {81, 272, 0, 0},
+    {81, 273, 0, 0},
+    {81, 274, 0, 0},
+    {81, 275, 0, 0},
+    {82, 276, 0, 0},
+    {82, 277, 0, 0},
+    {82, 278, 0, 0},
+    {81, 279, 0, 0},
+    {81, 280, 0, 0},
+    {81, 281, 0, 0},
+    {81, 282, 0, 0},
+    {81, 283, 0, 0},
+    {81, 284, 0, 0},
+    {81, 285, 0, 0},
+    {81, 286, 0, 0},
+    {81, 287, 0, 0},
+    {81, 288, 0, 0},
+    {81, 289, 0, 0},
+    {81, 290, 0, 0},
+    {81, 291, 0, 0},
+    {81, 292, 0, 0},
+    {81, 293, 0, 0},
+    {81, 294, 0, 0},
+    {81, 295, 0, 0},
+    {81, 296, 0, 0},
+    {82, 297, 0, 0},
+    {82, 298, 0, 0},
+    {82, 299, 0, 0},
+    {82, 300, 0, 0},
+    {82, 301, 0, 0},
+    {82, 302, 0, 0},
+    {81, 303, 0, 0},
+    {81, 304, 0, 0},
+    {81, 305, 0, 0},
+    {8000, 306, 0, 0},
+    {8000, 307, 0, 0},
+    {8000, 308, 0, 0},
+    {8000, 309, 0, 0},
+    {8000, 310, 0, 0},
+    {8000, 311, 0, 0},
+    {8000, 312, 0, 0},
+    {8000, 313, 0, 0},
+    {8000, 314, 0, 0},
+    {8000, 315, 0, 0},
+    {8000, 316, 0, 0},
+    {122, 317, 0, 0},
+    {122, 318, 0, 0},
+    {124, 319, 0, 0},
+    {124, 320, 0, 0},
+    {124, 321, 0, 0},
+    {122, 322, 0, 0},
+    {122, 323, 0, 0},
+    {122, 324, 0, 0},
+    {122, 325, 0, 0},
+    {124, 326, 0, 0},
+    {124, 327, 0, 0},
+    {124, 328, 0, 0},
+    {8004, 329, 0, 0},
+    {8004, 330, 0, 0},
+    {8010, 331, 0, 0},
+    {53, 332, 0, 0},
+    {8009, 333, 0, 0},
+    {123, 334, 0, 0},
+    {8040, 335, 0, 0},
+    {20, 336, 0, 0},
+    {19, 337, 0, 0},
+    {18, 338, 0, 0},
+    {16, 339, 0, 0},
+    {13, 340, 0, 0},
+    {12, 341, 0, 0},
+    {23, 342, 0, 0},
+    {22, 343, 0, 0},
+    {21, 344, 0, 0},
+    {8008, 345, 0, 0},
+    {8005, 346, 0, 0},
+    {10110, 347, 0, 0},
+    {10110, 348, 0, 0},
+    {10110, 349, 0, 0},
+    {10110, 350, 0, 0},
+    {10110, 351, 0, 0},
+    {8003, 352, 0, 0},
+    {8003, 353, 0, 0},
+    {8002, 354, 0, 0},
+    {8041, 355, 0, 0},
+    {84, 356, 0, 0},
+    {84, 357, 0, 0},
+    {30, 358, 0, 0},
+    {83, 359, 0, 0},
+    {32, 360, 0, 0},
+    {82, 361, 0, 0},
+    {82, 362, 0, 0},
+    {82, 363, 0, 0},
+    {81, 364, 0, 0},
+    {81, 365, 0, 0},
+    {81, 366, 0, 0},
+    {81, 367, 0, 0},
+    {81, 368, 0, 0},
+    {8007, 369, 0, 0},
+    {8000, 370, 0, 0},
+    {8000, 371, 0, 0},
+    {8000, 372, 0, 0},
+    {8000, 373, 0, 0},
+    {8000, 374, 0, 0},
+    {8000, 375, 0, 0},
+    {8006, 376, 0, 0},
+    {86, 377, 0, 0},
+    {36, 378, 0, 0},
+    {33, 379, 0, 0},
+    {10110, 380, 0, 0},
+    {10040, 381, 0, 0},
+    {11, 382, 0, 0},
+    {11, 383, 0, 0},
+    {121, 384, 0, 0},
+    {121, 385, 0, 0},
+    {121, 386, 0, 0},
+    {121, 387, 0, 0},
+    {121, 388, 0, 0},
+    {121, 389, 0, 0},
+    {10030, 390, 0, 0},
+    {10030, 391, 0, 0},
+    {10030, 392, 0, 0},
+    {10030, 393, 0, 0},
+    {121, 394, 0, 0},
+    {121, 395, 0, 0},
+    {121, 396, 0, 0},
+    {121, 397, 0, 0},
+    {121, 398, 0, 0},
+    {121, 399, 0, 0},
+    {10060, 400, 0, 0},
+    {10060, 401, 0, 0},
+    {31, 402, 0, 0},
+    {10030, 403, 0, 0},
+    {10030, 404, 0, 0},
+    {10030, 405, 0, 0},
+    {10030, 406, 0, 0},
+    {10030, 407, 0, 0},
+    {10060, 408, 0, 0},
+    {10060, 409, 0, 0},
+    {10060, 410, 0, 0},
+    {10060, 411, 0, 0},
+    {121, 412, 0, 0},
+    {121, 413, 0, 0},
+    {120, 414, 0, 0},
+    {120, 415, 0, 0},
+    {120, 416, 0, 0},
+    {120, 417, 0, 0},
+    {120, 418, 0, 0},
+    {10060, 419, 0, 0},
+    {10060, 420, 0, 0},
+    {10060, 421, 0, 0},
+    {10060, 422, 0, 0},
+    {10060, 423, 0, 0},
+    {9001, 424, 0, 0},
+    {9001, 425, 0, 0},
+    {9001, 426, 0, 0},
+    {9001, 427, 0, 0},
+    {9001, 428, 0, 0},
+    {10060, 429, 0, 0},
+    {10060, 430, 0, 0},
+    {10060, 431, 0, 0},
+    {10060, 432, 0, 0},
+    {10060, 433, 0, 0},
+    {10060, 434, 0, 0},
+    {10060, 435, 0, 0},
+    {10060, 436, 0, 0},
+    {10060, 437, 0, 0},
+    {10060, 438, 0, 0},
+    {10060, 439, 0, 0},
+    {10060, 440, 0, 0},
+    {10060, 441, 0, 0},
+    {10060, 442, 0, 0},
+    {107, 443, 0, 0},
+    {107, 444, 0, 0},
+    {107, 445, 0, 0},
+    {107, 446, 0, 0},
+    {31, 447, 0, 0},
+    {31, 448, 0, 0},
+    {107, 449, 0, 0},
+    {8080, 450, 0, 0},
+    {8080, 451, 0, 0},
+    {107, 452, 0, 0},
+    {107, 453, 0, 0},
+    {10060, 454, 0, 0},
+    {10060, 455, 0, 0},
+    {10060, 456, 0, 0},
+    {10060, 457, 0, 0},
+    {10030, 458, 0, 0},
+    {10030, 459, 0, 0},
+    {10030, 460, 0, 0},
+    {10030, 461, 0, 0},
+    {107, 462, 0, 0},
+    {10060, 463, 0, 0},
+    {10060, 464, 0, 0},
+    {10030, 465, 0, 0},
+    {10030, 466, 0, 0},
+    {31, 467, 0, 0},
+    {31, 468, 0, 0},
+    {31, 469, 0, 0},
+    {31, 470, 0, 0},
+    {31, 471, 0, 0},
+    {31, 472, 0, 0},
+    {31, 473, 0, 0},
+    {107, 474, 0, 0},
+    {10060, 475, 0, 0},
+    {10030, 476, 0, 0},
+    {10030, 477, 0, 0},
+    {10030, 478, 0, 0},
+    {10030, 479, 0, 0},
+    {10030, 480, 0, 0},
+    {10030, 481, 0, 0},
+    {10030, 482, 0, 0},
+    {10030, 483, 0, 0},
+    {10030, 484, 0, 0},
+    {10030, 485, 0, 0},
+    {10030, 486, 0, 0},
+    {10030, 487, 0, 0},
+    {10030, 488, 0, 0},
+    {10030, 489, 0, 0},
+    {10030, 490, 0, 0},
+    {10030, 491, 0, 0},
+    {10030, 492, 0, 0},
+    {107, 493, 0, 0},
+    {107, 494, 0, 0},
+    {107, 495, 0, 0},
+    {107, 496, 0, 0},
+    {107, 497, 0, 0},
+    {107, 498, 0, 0},
+    {31, 499, 0, 0},
+    {10030, 500, 0, 0},
+    {10030, 501, 0, 0},
+    {10060, 502, 0, 0},
+    {10060, 503, 0, 0},
+    {10060, 504, 0, 0},
+    {10060, 505, 0, 0},
+    {10060, 506, 0, 0},
+    {10060, 507, 0, 0},
+    {10030, 508, 0, 0},
+    {10030, 509, 0, 0},
+    {10030, 510, 0, 0},
+    {10030, 511, 0, 0},
+    {10030, 512, 0, 0},
+    {10030, 513, 0, 0},
+    {10030, 514, 0, 0},
+    {10030, 515, 0, 0},
+    {10030, 516, 0, 0},
+    {10030, 517, 0, 0},
+    {10030, 518, 0, 0},
+    {10030, 519, 0, 0},
+    {11, 520, 0, 0},
+    {11, 521, 0, 0},
+    {8505, 522, 0, 0},
+    {8500, 523, 0, 0},
+    {8506, 524, 0, 0},
+    {8500, 525, 0, 0},
+    {8508, 526, 0, 0},
+    {1406, 527, 0, 0},
+    {1406, 528, 0, 0},
+    {1406, 529, 0, 0},
+    {8042, 530, 0, 0},
+    {8042, 531, 0, 0},
+    {8042, 532, 0, 0},
+    {8042, 533, 0, 0},
+    {8042, 534, 0, 0},
+    {8042, 535, 0, 0},
+    {8042, 536, 0, 0},
+    {8042, 537, 0, 0},
+    {8042, 538, 0, 0},
+    {8043, 539, 0, 0},
+    {116, 540, 0, 0},
+    {116, 541, 0, 0},
+    {10110, 542, 0, 0},
+    {10110, 543, 0, 0},
+    {10110, 544, 0, 0},
+    {10110, 545, 0, 0},
+    {8002, 546, 0, 0},
+    {115, 547, 0, 0},
+    {107, 548, 0, 0},
+    {107, 549, 0, 0},
+    {10030, 550, 0, 0},
+    {10030, 551, 0, 0},
+    {10030, 552, 0, 0},
+    {10030, 553, 0, 0},
+    {10030, 554, 0, 0},
+    {10030, 555, 0, 0},
+    {10030, 556, 0, 0},
+    {10030, 557, 0, 0},
+    {10030, 558, 0, 0},
+    {10060, 559, 0, 0},
+    {10060, 560, 0, 0},
+    {10060, 561, 0, 0},
+    {10060, 562, 0, 0},
+    {10060, 563, 0, 0},
+    {10060, 564, 0, 0},
+    {10060, 565, 0, 0},
+    {10060, 566, 0, 0},
+    {9001, 567, 0, 0},
+    {9001, 568, 0, 0},
+    {9001, 569, 0, 0},
+    {9001, 570, 0, 0},
+    {9001, 571, 0, 0},
+    {9001, 572, 0, 0},
+    {9001, 573, 0, 0},
+    {9001, 574, 0, 0},
+    {9001, 575, 0, 0},
+    {9001, 576, 0, 0},
+    {9001, 577, 0, 0},
+    {9001, 578, 0, 0},
+    {9001, 579, 0, 0},
+    {9001, 580, 0, 0},
+    {9001, 581, 0, 0},
+    {9001, 582, 0, 0},
+    {11, 583, 0, 0},
+    {10120, 584, 0, 0},
+    {10120, 585, 0, 0},
+    {10120, 586, 0, 0},
+    {10120, 587, 0, 0},
+    {11, 588, 0, 0},
+    {9100, 589, 0, 0},
+    {9101, 590, 0, 0},
+    {9102, 591, 0, 0},
+    {9103, 592, 0, 0},
+    // Caves of Circe
+    {1, 0, 0, 0},
+    {3002, 1, 0, 0},
+    {3000, 2, 0, 0},
+    {3000, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {48, 5, 0, 0},
+    {48, 6, 0, 0},
+    {48, 7, 0, 0},
+    {15, 8, 0, 0},
+    {7, 9, 0, 0},
+    {9, 10, 0, 0},
+    {6, 11, 0, 0},
+    {79, 12, 0, 0},
+    {24, 13, 0, 0},
+    {24, 14, 0, 0},
+    {52, 15, 0, 0},
+    {45, 16, 0, 0},
+    {44, 17, 0, 0},
+    {42, 18, 0, 0},
+    {42, 19, 0, 0},
+    {52, 20, 0, 0},
+    {52, 21, 0, 0},
+    {52, 22, 0, 0},
+    {56, 23, 0, 0},
+    {56, 24, 0, 0},
+    {57, 25, 0, 0},
+    {49, 26, 0, 0},
+    {50, 27, 0, 0},
+    {50, 28, 0, 0},
+    {51, 29, 0, 0},
+    {51, 30, 0, 0},
+    {41, 31, 0, 0},
+    {42, 32, 0, 0},
+    {44, 33, 0, 0},
+    {45, 34, 0, 0},
+    {48, 35, 0, 0},
+    {48, 36, 0, 0},
+    {48, 37, 0, 0},
+    {50, 38, 0, 0},
+    {57, 39, 0, 0},
+    {56, 40, 0, 0},
+    {49, 41, 0, 0},
+    {48, 42, 0, 0},
+    {48, 43, 0, 0},
+    {48, 44, 0, 0},
+    {48, 45, 0, 0},
+    {48, 46, 0, 0},
+    {48, 47, 0, 0},
+    {49, 48, 0, 0},
+    {52, 49, 0, 0},
+    {56, 50, 0, 0},
+    {50, 51, 0, 0},
+    {51, 52, 0, 0},
+    {57, 53, 0, 0},
+    {42, 54, 0, 0},
+    {44, 55, 0, 0},
+    {45, 56, 0, 0},
+    {41, 57, 0, 0},
+    {48, 58, 0, 0},
+    {48, 59, 0, 0},
+    {48, 60, 0, 0},
+    {57, 61, 0, 0},
+    {57, 62, 0, 0},
+    {50, 63, 0, 0},
+    {50, 64, 0, 0},
+    {49, 65, 0, 0},
+    {52, 66, 0, 0},
+    {49, 67, 0, 0},
+    {49, 68, 0, 0},
+    {49, 69, 0, 0},
+    {50, 70, 0, 0},
+    {50, 71, 0, 0},
+    {50, 72, 0, 0},
+    {51, 73, 0, 0},
+    {51, 74, 0, 0},
+    {51, 75, 0, 0},
+    {48, 76, 0, 0},
+    {48, 77, 0, 0},
+    {48, 78, 0, 0},
+    {9, 79, 0, 0},
+    {9, 80, 0, 0},
+    {9, 81, 0, 0},
+    {9, 82, 0, 0},
+    {9, 83, 0, 0},
+    {7, 84, 0, 0},
+    {7, 85, 0, 0},
+    {7, 86, 0, 0},
+    {7, 87, 0, 0},
+    {7, 88, 0, 0},
+    {15, 89, 0, 0},
+    {15, 90, 0, 0},
+    {6, 91, 0, 0},
+    {6, 92, 0, 0},
+    {41, 93, 0, 0},
+    {41, 94, 0, 0},
+    {42, 95, 0, 0},
+    {42, 96, 0, 0},
+    {44, 97, 0, 0},
+    {44, 98, 0, 0},
+    {44, 99, 0, 0},
+    {42, 100, 0, 0},
+    {42, 101, 0, 0},
+    {45, 102, 0, 0},
+    {45, 103, 0, 0},
+    {41, 104, 0, 0},
+    {41, 105, 0, 0},
+    {52, 106, 0, 0},
+    {52, 107, 0, 0},
+    {52, 108, 0, 0},
+    {52, 109, 0, 0},
+    {56, 110, 0, 0},
+    {56, 111, 0, 0},
+    {57, 112, 0, 0},
+    {57, 113, 0, 0},
+    {8080, 114, 0, 0},
+    {8005, 115, 0, 0},
+    {36, 116, 0, 0},
+    {81, 117, 0, 0},
+    {81, 118, 0, 0},
+    {81, 119, 0, 0},
+    {81, 120, 0, 0},
+    {81, 121, 0, 0},
+    {81, 122, 0, 0},
+    {8000, 123, 0, 0},
+    {8000, 124, 0, 0},
+    {8000, 125, 0, 0},
+    {8000, 126, 0, 0},
+    {8000, 127, 0, 0},
+    {8000, 128, 0, 0},
+    {8000, 129, 0, 0},
+    {8000, 130, 0, 0},
+    {53, 131, 0, 0},
+    {8031, 132, 0, 0},
+    {8080, 133, 0, 0},
+    {8080, 134, 0, 0},
+    {8080, 135, 0, 0},
+    {8080, 136, 0, 0},
+    {8080, 137, 0, 0},
+    {10030, 138, 0, 0},
+    {10030, 139, 0, 0},
+    {10030, 140, 0, 0},
+    {10030, 141, 0, 0},
+    {8080, 142, 0, 0},
+    {10030, 143, 0, 0},
+    {10030, 144, 0, 0},
+    {10030, 145, 0, 0},
+    {10030, 146, 0, 0},
+    {8080, 147, 0, 0},
+    {8080, 148, 0, 0},
+    {8080, 149, 0, 0},
+    {8080, 150, 0, 0},
+    {8080, 151, 0, 0},
+    {10030, 152, 0, 0},
+    {10030, 153, 0, 0},
+    {10030, 154, 0, 0},
+    {8080, 155, 0, 0},
+    {8080, 156, 0, 0},
+    {8080, 157, 0, 0},
+    {8080, 158, 0, 0},
+    {8080, 159, 0, 0},
+    {8080, 160, 0, 0},
+    {8080, 161, 0, 0},
+    {10030, 162, 0, 0},
+    {10030, 163, 0, 0},
+    {10030, 164, 0, 0},
+    {10030, 165, 0, 0},
+    {10030, 166, 0, 0},
+    {10030, 167, 0, 0},
+    {10030, 168, 0, 0},
+    {10030, 169, 0, 0},
+    {10030, 170, 0, 0},
+    {8080, 171, 0, 0},
+    {8080, 172, 0, 0},
+    {10030, 173, 0, 0},
+    {10030, 174, 0, 0},
+    {8080, 175, 0, 0},
+    {10030, 176, 0, 0},
+    {10030, 177, 0, 0},
+    {10030, 178, 0, 0},
+    {81, 179, 0, 0},
+    {81, 180, 0, 0},
+    {81, 181, 0, 0},
+    {81, 182, 0, 0},
+    {8066, 183, 0, 0},
+    {8066, 184, 0, 0},
+    {81, 185, 0, 0},
+    {81, 186, 0, 0},
+    {81, 187, 0, 0},
+    {81, 188, 0, 0},
+    {81, 189, 0, 0},
+    {81, 190, 0, 0},
+    {8000, 191, 0, 0},
+    {8000, 192, 0, 0},
+    {8000, 193, 0, 0},
+    {8000, 194, 0, 0},
+    {8000, 195, 0, 0},
+    {8000, 196, 0, 0},
+    {82, 197, 0, 0},
+    {82, 198, 0, 0},
+    {82, 199, 0, 0},
+    {124, 200, 0, 0},
+    {124, 201, 0, 0},
+    {122, 202, 0, 0},
+    {122, 203, 0, 0},
+    {8004, 204, 0, 0},
+    {117, 205, 0, 0},
+    {117, 206, 0, 0},
+    {117, 207, 0, 0},
+    {117, 208, 0, 0},
+    {30, 209, 0, 0},
+    {8004, 210, 0, 0},
+    {8004, 211, 0, 0},
+    {8004, 212, 0, 0},
+    {124, 213, 0, 0},
+    {124, 214, 0, 0},
+    {124, 215, 0, 0},
+    {124, 216, 0, 0},
+    {122, 217, 0, 0},
+    {122, 218, 0, 0},
+    {122, 219, 0, 0},
+    {122, 220, 0, 0},
+    {124, 221, 0, 0},
+    {124, 222, 0, 0},
+    {81, 223, 0, 0},
+    {81, 224, 0, 0},
+    {81, 225, 0, 0},
+    {81, 226, 0, 0},
+    {8000, 227, 0, 0},
+    {8000, 228, 0, 0},
+    {8000, 229, 0, 0},
+    {8000, 230, 0, 0},
+    {8000, 231, 0, 0},
+    {8000, 232, 0, 0},
+    {81, 233, 0, 0},
+    {81, 234, 0, 0},
+    {81, 235, 0, 0},
+    {81, 236, 0, 0},
+    {81, 237, 0, 0},
+    {81, 238, 0, 0},
+    {8007, 239, 0, 1},
+    {82, 240, 0, 0},
+    {82, 241, 0, 0},
+    {124, 242, 0, 0},
+    {124, 243, 0, 0},
+    {122, 244, 0, 0},
+    {122, 245, 0, 0},
+    {122, 246, 0, 0},
+    {122, 247, 0, 0},
+    {124, 248, 0, 0},
+    {124, 249, 0, 0},
+    {122, 250, 0, 0},
+    {122, 251, 0, 0},
+    {122, 252, 0, 0},
+    {122, 253, 0, 0},
+    {124, 254, 0, 0},
+    {124, 255, 0, 0},
+    {124, 256, 0, 0},
+    {124, 257, 0, 0},
+    {81, 258, 0, 0},
+    {81, 259, 0, 0},
+    {81, 260, 0, 0},
+    {81, 261, 0, 0},
+    {81, 262, 0, 0},
+    {81, 263, 0, 0},
+    {81, 264, 0, 0},
+    {81, 265, 0, 0},
+    {57, 266, 0, 0},
+    {56, 267, 0, 0},
+    {9001, 268, 0, 0},
+    {9001, 269, 0, 0},
+    {57, 270, 0, 0},
+    {9001, 271, 0, 0},
+    {56, 272, 0, 0},
+    {9001, 273, 0, 0},
+    {9001, 274, 0, 0},
+    {9001, 275, 0, 0},
+    {56, 276, 0, 0},
+    {9001, 277, 0, 0},
+    {57, 278, 0, 0},
+    {9001, 279, 0, 0},
+    {2, 280, 0, 0},
+    {3, 281, 0, 0},
+    {4, 282, 0, 0},
+    {10225, 283, 0, 0},
+    {10225, 284, 0, 0},
+    {10225, 285, 0, 0},
+    {140, 286, 0, 0},
+    {14, 287, 0, 0},
+    {10, 288, 0, 0},
+    {8010, 289, 0, 0},
+    {53, 290, 0, 0},
+    {8009, 291, 0, 0},
+    {123, 292, 0, 0},
+    {8040, 293, 0, 0},
+    {20, 294, 0, 0},
+    {19, 295, 0, 0},
+    {18, 296, 0, 0},
+    {16, 297, 0, 0},
+    {13, 298, 0, 0},
+    {12, 299, 0, 0},
+    {23, 300, 0, 0},
+    {22, 301, 0, 0},
+    {21, 302, 0, 0},
+    {8008, 303, 0, 0},
+    {8005, 304, 0, 0},
+    {10110, 305, 0, 0},
+    {10110, 306, 0, 0},
+    {10110, 307, 0, 0},
+    {10110, 308, 0, 0},
+    {10110, 309, 0, 0},
+    {10110, 310, 0, 0},
+    {10110, 311, 0, 0},
+    {10110, 312, 0, 0},
+    {8003, 313, 0, 0},
+    {8002, 314, 0, 0},
+    {8041, 315, 0, 0},
+    {8041, 316, 0, 0},
+    {8041, 317, 0, 0},
+    {84, 318, 0, 0},
+    {84, 319, 0, 0},
+    {83, 320, 0, 0},
+    {32, 321, 0, 0},
+    {8007, 322, 0, 0},
+    {8006, 323, 0, 0},
+    {36, 324, 0, 0},
+    {10040, 325, 0, 0},
+    {84, 326, 0, 0},
+    {11, 327, 0, 0},
+    {11, 328, 0, 0},
+    {11, 329, 0, 0},
+    {11, 330, 0, 0},
+    {9001, 331, 0, 0},
+    {9001, 332, 0, 0},
+    {9001, 333, 0, 0},
+    {9001, 334, 0, 0},
+    {9001, 335, 0, 0},
+    {10060, 336, 0, 0},
+    {10060, 337, 0, 0},
+    {10060, 338, 0, 0},
+    {10060, 339, 0, 0},
+    {10060, 340, 0, 0},
+    {10060, 341, 0, 0},
+    {10060, 342, 0, 0},
+    {10060, 343, 0, 0},
+    {10060, 344, 0, 0},
+    {10060, 345, 0, 0},
+    {10060, 346, 0, 0},
+    {10060, 347, 0, 0},
+    {10060, 348, 0, 0},
+    {10060, 349, 0, 0},
+    {10060, 350, 0, 0},
+    {10060, 351, 0, 0},
+    {10060, 352, 0, 0},
+    {10060, 353, 0, 0},
+    {10030, 354, 0, 0},
+    {10030, 355, 0, 0},
+    {10030, 356, 0, 0},
+    {10030, 357, 0, 0},
+    {10030, 358, 0, 0},
+    {10030, 359, 0, 0},
+    {10030, 360, 0, 0},
+    {10030, 361, 0, 0},
+    {10030, 362, 0, 0},
+    {10030, 363, 0, 0},
+    {10030, 364, 0, 0},
+    {10030, 365, 0, 0},
+    {10030, 366, 0, 0},
+    {10030, 367, 0, 0},
+    {10120, 368, 0, 0},
+    {10120, 369, 0, 0},
+    {10120, 370, 0, 0},
+    {11, 371, 0, 0},
+    {11, 372, 0, 0},
+    {11, 373, 0, 0},
+    {11, 374, 0, 0},
+    {9100, 375, 0, 0},
+    {9101, 376, 0, 0},
+    {9102, 377, 0, 0},
+    {9103, 378, 0, 0},
+    // Wastelands
+    {1, 0, 0, 0},
+    {3000, 1, 0, 0},
+    {3002, 2, 0, 0},
+    {3000, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {3000, 5, 0, 0},
+    {3002, 6, 0, 0},
+    {3000, 7, 0, 0},
+    {3002, 8, 0, 0},
+    {3000, 9, 0, 0},
+    {3001, 10, 0, 0},
+    {3000, 11, 0, 0},
+    {3001, 12, 0, 0},
+    {3001, 13, 0, 0},
+    {3000, 14, 0, 0},
+    {10030, 15, 0, 0},
+    {10030, 16, 0, 0},
+    {10030, 17, 0, 0},
+    {10030, 18, 0, 0},
+    {10030, 19, 0, 0},
+    {10030, 20, 0, 0},
+    {10030, 21, 0, 0},
+    {10030, 22, 0, 0},
+    {10030, 23, 0, 0},
+    {10030, 24, 0, 0},
+    {107, 25, 0, 0},
+    {107, 26, 0, 0},
+    {107, 27, 0, 0},
+    {107, 28, 0, 0},
+    {107, 29, 0, 0},
+    {9001, 30, 0, 0},
+    {9001, 31, 0, 0},
+    {9001, 32, 0, 0},
+    {9001, 33, 0, 0},
+    {9001, 34, 0, 0},
+    {9001, 35, 0, 0},
+    {9001, 36, 0, 0},
+    {9001, 37, 0, 0},
+    {10060, 38, 0, 0},
+    {9001, 39, 0, 0},
+    {10060, 40, 0, 0},
+    {10060, 41, 0, 0},
+    {10060, 42, 0, 0},
+    {10060, 43, 0, 0},
+    {9001, 44, 0, 0},
+    {10000, 45, 0, 0},
+    {10000, 46, 0, 0},
+    {77, 47, 0, 0},
+    {77, 48, 0, 0},
+    {77, 49, 0, 0},
+    {77, 50, 0, 0},
+    {77, 51, 0, 0},
+    {77, 52, 0, 0},
+    {117, 53, 0, 0},
+    {117, 54, 0, 0},
+    {117, 55, 0, 0},
+    {117, 56, 0, 0},
+    {117, 57, 0, 0},
+    {117, 58, 0, 0},
+    {119, 59, 0, 0},
+    {119, 60, 0, 0},
+    {119, 61, 0, 0},
+    {119, 62, 0, 0},
+    {119, 63, 0, 0},
+    {119, 64, 0, 0},
+    {5, 65, 0, 0},
+    {5, 66, 0, 0},
+    {55, 67, 0, 0},
+    {55, 68, 0, 0},
+    {55, 69, 0, 0},
+    {55, 70, 0, 0},
+    {55, 71, 0, 0},
+    {55, 72, 0, 0},
+    {8003, 73, 0, 0},
+    {9001, 74, 0, 0},
+    {9001, 75, 0, 0},
+    {9001, 76, 0, 0},
+    {9001, 77, 0, 0},
+    {9001, 78, 0, 0},
+    {9001, 79, 0, 0},
+    {9001, 80, 0, 0},
+    {9001, 81, 0, 0},
+    {99, 82, 0, 0},
+    {97, 83, 0, 0},
+    {98, 84, 0, 0},
+    {98, 85, 0, 0},
+    {98, 86, 0, 0},
+    {97, 87, 0, 0},
+    {97, 88, 0, 0},
+    {99, 89, 0, 0},
+    {98, 90, 0, 0},
+    {98, 91, 0, 0},
+    {97, 92, 0, 0},
+    {99, 93, 0, 0},
+    {99, 94, 0, 0},
+    {97, 95, 0, 0},
+    {99, 96, 0, 0},
+    {99, 97, 0, 0},
+    {97, 98, 0, 0},
+    {98, 99, 0, 0},
+    {99, 100, 0, 0},
+    {97, 101, 0, 0},
+    {98, 102, 0, 0},
+    {98, 103, 0, 0},
+    {98, 104, 0, 0},
+    {99, 105, 0, 0},
+    {97, 106, 0, 0},
+    {98, 107, 0, 0},
+    {99, 108, 0, 0},
+    {99, 109, 0, 0},
+    {97, 110, 0, 0},
+    {98, 111, 0, 0},
+    {97, 112, 0, 0},
+    {99, 113, 0, 0},
+    {99, 114, 0, 0},
+    {97, 115, 0, 0},
+    {60, 116, 0, 0},
+    {26, 117, 0, 0},
+    {27, 118, 0, 0},
+    {38, 119, 0, 0},
+    {38, 120, 0, 0},
+    {38, 121, 0, 0},
+    {26, 122, 0, 0},
+    {27, 123, 0, 0},
+    {61, 124, 0, 0},
+    {61, 125, 0, 0},
+    {61, 126, 0, 0},
+    {61, 127, 0, 0},
+    {61, 128, 0, 0},
+    {61, 129, 0, 0},
+    {61, 130, 0, 0},
+    {61, 131, 0, 0},
+    {78, 132, 0, 0},
+    {87, 133, 0, 0},
+    {80, 134, 0, 0},
+    {28, 135, 0, 0},
+    {56, 136, 0, 0},
+    {56, 137, 0, 0},
+    {56, 138, 0, 0},
+    {52, 139, 0, 0},
+    {52, 140, 0, 0},
+    {52, 141, 0, 0},
+    {52, 142, 0, 0},
+    {6, 143, 0, 0},
+    {6, 144, 0, 0},
+    {7, 145, 0, 0},
+    {9, 146, 0, 0},
+    {9, 147, 0, 0},
+    {15, 148, 0, 0},
+    {15, 149, 0, 0},
+    {8010, 150, 0, 0},
+    {8002, 151, 0, 0},
+    {8003, 152, 0, 0},
+    {30, 153, 0, 0},
+    {8006, 154, 0, 0},
+    {8038, 155, 0, 0},
+    {32, 156, 0, 0},
+    {8000, 157, 0, 0},
+    {8000, 158, 0, 0},
+    {8000, 159, 0, 0},
+    {8000, 160, 0, 0},
+    {8000, 161, 0, 0},
+    {8000, 162, 0, 0},
+    {8000, 163, 0, 0},
+    {8000, 164, 0, 0},
+    {8000, 165, 0, 0},
+    {8000, 166, 0, 0},
+    {8000, 167, 0, 0},
+    {8000, 168, 0, 0},
+    {8000, 169, 0, 0},
+    {8000, 170, 0, 0},
+    {8000, 171, 0, 0},
+    {120, 172, 0, 0},
+    {120, 173, 0, 0},
+    {121, 174, 0, 0},
+    {121, 175, 0, 0},
+    {107, 176, 0, 0},
+    {107, 177, 0, 0},
+    {107, 178, 0, 0},
+    {107, 179, 0, 0},
+    {107, 180, 0, 0},
+    {107, 181, 0, 0},
+    {8080, 182, 0, 0},
+    {8080, 183, 0, 0},
+    {8080, 184, 0, 0},
+    {8080, 185, 0, 0},
+    {8080, 186, 0, 0},
+    {8080, 187, 0, 0},
+    {8080, 188, 0, 0},
+    {8080, 189, 0, 0},
+    {10030, 190, 0, 0},
+    {10030, 191, 0, 0},
+    {10030, 192, 0, 0},
+    {10030, 193, 0, 0},
+    {10030, 194, 0, 0},
+    {10030, 195, 0, 0},
+    {10030, 196, 0, 0},
+    {8080, 197, 0, 0},
+    {107, 198, 0, 0},
+    {107, 199, 0, 0},
+    {107, 200, 0, 0},
+    {107, 201, 0, 0},
+    {107, 202, 0, 0},
+    {107, 203, 0, 0},
+    {107, 204, 0, 0},
+    {8080, 205, 0, 0},
+    {8080, 206, 0, 0},
+    {8080, 207, 0, 0},
+    {10060, 208, 0, 0},
+    {10060, 209, 0, 0},
+    {10060, 210, 0, 0},
+    {10060, 211, 0, 0},
+    {10060, 212, 0, 0},
+    {10060, 213, 0, 0},
+    {10060, 214, 0, 0},
+    {10060, 215, 0, 0},
+    {10060, 216, 0, 0},
+    {10060, 217, 0, 0},
+    {10060, 218, 0, 0},
+    {10060, 219, 0, 0},
+    {10060, 220, 0, 0},
+    {10060, 221, 0, 0},
+    {10060, 222, 0, 0},
+    {10060, 223, 0, 0},
+    {10060, 224, 0, 0},
+    {8080, 225, 0, 0},
+    {8080, 226, 0, 0},
+    {8080, 227, 0, 0},
+    {10090, 228, 0, 0},
+    {10090, 229, 0, 0},
+    {10090, 230, 0, 0},
+    {10090, 231, 0, 0},
+    {10090, 232, 0, 0},
+    {10090, 233, 0, 0},
+    {10090, 234, 0, 0},
+    {10090, 235, 0, 0},
+    {10090, 236, 0, 0},
+    {10090, 237, 0, 0},
+    {10090, 238, 0, 0},
+    {10090, 239, 0, 0},
+    {10090, 240, 0, 0},
+    {10090, 241, 0, 0},
+    {10090, 242, 0, 0},
+    {10090, 243, 0, 0},
+    {10090, 244, 0, 0},
+    {10090, 245, 0, 0},
+    {10090, 246, 0, 0},
+    {10090, 247, 0, 0},
+    {10090, 248, 0, 0},
+    {10090, 249, 0, 0},
+    {11, 250, 0, 0},
+    {11, 251, 0, 0},
+    {11, 252, 0, 0},
+    {11, 253, 0, 0},
+    {8004, 254, 0, 0},
+    {8004, 255, 0, 0},
+    {8004, 256, 0, 0},
+    {81, 257, 0, 0},
+    {81, 258, 0, 0},
+    {81, 259, 0, 0},
+    {81, 260, 0, 0},
+    {81, 261, 0, 0},
+    {81, 262, 0, 0},
+    {81, 263, 0, 0},
+    {81, 264, 0, 0},
+    {81, 265, 0, 0},
+    {81, 266, 0, 0},
+    {81, 267, 0, 0},
+    {82, 268, 0, 0},
+    {124, 269, 0, 0},
+    {124, 270, 0, 0},
+    {124, 271, 0, 0},
+    {124, 272, 0, 0},
+    {124, 273, 0, 0},
+    {124, 274, 0, 0},
+    {124, 275, 0, 0},
+    {122, 276, 0, 0},
+    {122, 277, 0, 0},
+    {122, 278, 0, 0},
+    {122, 279, 0, 0},
+    {122, 280, 0, 0},
+    {122, 281, 0, 0},
+    {124, 282, 0, 0},
+    {124, 283, 0, 0},
+    {124, 284, 0, 0},
+    {81, 285, 0, 0},
+    {81, 286, 0, 0},
+    {81, 287, 0, 0},
+    {81, 288, 0, 0},
+    {81, 289, 0, 0},
+    {81, 290, 0, 0},
+    {8000, 291, 0, 0},
+    {8000, 292, 0, 0},
+    {8000, 293, 0, 0},
+    {8000, 294, 0, 0},
+    {8000, 295, 0, 0},
+    {8000, 296, 0, 0},
+    {8000, 297, 0, 0},
+    {8000, 298, 0, 0},
+    {8000, 299, 0, 0},
+    {8000, 300, 0, 0},
+    {8000, 301, 0, 0},
+    {8000, 302, 0, 0},
+    {81, 303, 0, 0},
+    {81, 304, 0, 0},
+    {81, 305, 0, 0},
+    {122, 306, 0, 0},
+    {122, 307, 0, 0},
+    {122, 308, 0, 0},
+    {124, 309, 0, 0},
+    {124, 310, 0, 0},
+    {124, 311, 0, 0},
+    {2, 312, 0, 0},
+    {3, 313, 0, 0},
+    {4, 314, 0, 0},
+    {107, 315, 0, 0},
+    {107, 316, 0, 0},
+    {107, 317, 0, 0},
+    {107, 318, 0, 0},
+    {107, 319, 0, 0},
+    {107, 320, 0, 0},
+    {107, 321, 0, 0},
+    {107, 322, 0, 0},
+    {107, 323, 0, 0},
+    {107, 324, 0, 0},
+    {107, 325, 0, 0},
+    {10030, 326, 0, 0},
+    {10030, 327, 0, 0},
+    {10030, 328, 0, 0},
+    {10030, 329, 0, 0},
+    {10030, 330, 0, 0},
+    {10030, 331, 0, 0},
+    {10030, 332, 0, 0},
+    {10030, 333, 0, 0},
+    {10030, 334, 0, 0},
+    {10030, 335, 0, 0},
+    {10060, 336, 0, 0},
+    {10060, 337, 0, 0},
+    {10060, 338, 0, 0},
+    {10060, 339, 0, 0},
+    {123, 340, 0, 0},
+    {16, 341, 0, 0},
+    {13, 342, 0, 0},
+    {12, 343, 0, 0},
+    {10, 344, 0, 0},
+    {8009, 345, 0, 0},
+    {20, 346, 0, 0},
+    {19, 347, 0, 0},
+    {18, 348, 0, 0},
+    {53, 349, 0, 0},
+    {8040, 350, 0, 0},
+    {23, 351, 0, 0},
+    {22, 352, 0, 0},
+    {21, 353, 0, 0},
+    {83, 354, 0, 0},
+    {8007, 355, 0, 0},
+    {8008, 356, 0, 0},
+    {8005, 357, 0, 0},
+    {9001, 358, 0, 0},
+    {9001, 359, 0, 0},
+    {9001, 360, 0, 0},
+    {9001, 361, 0, 0},
+    {9001, 362, 0, 0},
+    {10030, 363, 0, 0},
+    {10030, 364, 0, 0},
+    {10030, 365, 0, 0},
+    {10030, 366, 0, 0},
+    {107, 367, 0, 0},
+    {107, 368, 0, 0},
+    {107, 369, 0, 0},
+    {107, 370, 0, 0},
+    {107, 371, 0, 0},
+    {8080, 372, 0, 0},
+    {8080, 373, 0, 0},
+    {10060, 374, 0, 0},
+    {10060, 375, 0, 0},
+    {10060, 376, 0, 0},
+    {10060, 377, 0, 0},
+    {10060, 378, 0, 0},
+    {10060, 379, 0, 0},
+    {10060, 380, 0, 0},
+    {10060, 381, 0, 0},
+    {10030, 382, 0, 0},
+    {10030, 383, 0, 0},
+    {8080, 384, 0, 0},
+    {8080, 385, 0, 0},
+    {8080, 386, 0, 0},
+    {8080, 387, 0, 0},
+    {8080, 388, 0, 0},
+    {121, 389, 0, 0},
+    {121, 390, 0, 0},
+    {10060, 391, 0, 0},
+    {10030, 392, 0, 0},
+    {10060, 393, 0, 0},
+    {10060, 394, 0, 0},
+    {10060, 395, 0, 0},
+    {10060, 396, 0, 0},
+    {10030, 397, 0, 0},
+    {10030, 398, 0, 0},
+    {10030, 399, 0, 0},
+    {107, 400, 0, 0},
+    {107, 401, 0, 0},
+    {121, 402, 0, 0},
+    {121, 403, 0, 0},
+    {8080, 404, 0, 0},
+    {8080, 405, 0, 0},
+    {10030, 406, 0, 0},
+    {10030, 407, 0, 0},
+    {84, 408, 0, 0},
+    {84, 409, 0, 0},
+    {82, 410, 0, 0},
+    {82, 411, 0, 0},
+    {82, 412, 0, 0},
+    {82, 413, 0, 0},
+    {82, 414, 0, 0},
+    {82, 415, 0, 0},
+    {82, 416, 0, 0},
+    {82, 417, 0, 0},
+    {82, 418, 0, 0},
+    {82, 419, 0, 0},
+    {81, 420, 0, 0},
+    {81, 421, 0, 0},
+    {81, 422, 0, 0},
+    {81, 423, 0, 0},
+    {81, 424, 0, 0},
+    {81, 425, 0, 0},
+    {81, 426, 0, 0},
+    {81, 427, 0, 0},
+    {81, 428, 0, 0},
+    {81, 429, 0, 0},
+    {81, 430, 0, 0},
+    {81, 431, 0, 0},
+    {81, 432, 0, 0},
+    {81, 433, 0, 0},
+    {81, 434, 0, 0},
+    {81, 435, 0, 0},
+    {81, 436, 0, 0},
+    {10120, 437, 0, 0},
+    {10120, 438, 0, 0},
+    {10120, 439, 0, 0},
+    {10120, 440, 0, 0},
+    {140, 441, 0, 0},
+    {11, 442, 0, 0},
+    {11, 443, 0, 0},
+    {11, 444, 0, 0},
+    {11, 445, 0, 0},
+    {9100, 446, 0, 0},
+    {9101, 447, 0, 0},
+    {9102, 448, 0, 0},
+    {9103, 449, 0, 0},
+    // Sacred Grove
+    {1, 0, 0, 0},
+    {9001, 1, 0, 0},
+    {9001, 2, 0, 0},
+    {9001, 3, 0, 0},
+    {9001, 4, 0, 0},
+    {10030, 5, 0, 0},
+    {10030, 6, 0, 0},
+    {10030, 7, 0, 0},
+    {10030, 8, 0, 0},
+    {9001, 9, 0, 0},
+    {9001, 10, 0, 0},
+    {9001, 11, 0, 0},
+    {9001, 12, 0, 0},
+    {78, 13, 0, 0},
+    {78, 14, 0, 0},
+    {78, 15, 0, 0},
+    {78, 16, 0, 0},
+    {79, 17, 0, 0},
+    {79, 18, 0, 0},
+    {79, 19, 0, 0},
+    {79, 20, 0, 0},
+    {10030, 21, 0, 0},
+    {10030, 22, 0, 0},
+    {10030, 23, 0, 0},
+    {11, 24, 0, 0},
+    {11, 25, 0, 0},
+    {11, 26, 0, 0},
+    {11, 27, 0, 0},
+    {10030, 28, 0, 0},
+    {8004, 29, 0, 0},
+    {8004, 30, 0, 0},
+    {8004, 31, 0, 0},
+    {8004, 32, 0, 0},
+    {8004, 33, 0, 0},
+    {8004, 34, 0, 0},
+    {8004, 35, 0, 0},
+    {8004, 36, 0, 0},
+    {81, 37, 0, 0},
+    {81, 38, 0, 0},
+    {81, 39, 0, 0},
+    {81, 40, 0, 0},
+    {81, 41, 0, 0},
+    {81, 42, 0, 0},
+    {81, 43, 0, 0},
+    {81, 44, 0, 0},
+    {82, 45, 0, 0},
+    {82, 46, 0, 0},
+    {82, 47, 0, 0},
+    {82, 48, 0, 0},
+    {10030, 49, 0, 0},
+    {10030, 50, 0, 0},
+    {10030, 51, 0, 0},
+    {10030, 52, 0, 0},
+    {10030, 53, 0, 0},
+    {81, 54, 0, 0},
+    {81, 55, 0, 0},
+    {81, 56, 0, 0},
+    {81, 57, 0, 0},
+    {81, 58, 0, 0},
+    {81, 59, 0, 0},
+    {81, 60, 0, 0},
+    {81, 61, 0, 0},
+    {32, 62, 0, 0},
+    {32, 63, 0, 0},
+    {32, 64, 0, 0},
+    {82, 65, 0, 0},
+    {82, 66, 0, 0},
+    {82, 67, 0, 0},
+    {82, 68, 0, 0},
+    {122, 69, 0, 0},
+    {122, 70, 0, 0},
+    {122, 71, 0, 0},
+    {122, 72, 0, 0},
+    {122, 73, 0, 0},
+    {122, 74, 0, 0},
+    {122, 75, 0, 0},
+    {122, 76, 0, 0},
+    {124, 77, 0, 0},
+    {124, 78, 0, 0},
+    {124, 79, 0, 0},
+    {124, 80, 0, 0},
+    {124, 81, 0, 0},
+    {124, 82, 0, 0},
+    {124, 83, 0, 0},
+    {124, 84, 0, 0},
+    {10030, 85, 0, 0},
+    {10030, 86, 0, 0},
+    {10030, 87, 0, 0},
+    {2, 88, 0, 0},
+    {3, 89, 0, 0},
+    {4, 90, 0, 0},
+    {8010, 91, 0, 0},
+    {123, 92, 0, 0},
+    {10, 93, 0, 0},
+    {8009, 94, 0, 0},
+    {53, 95, 0, 0},
+    {8040, 96, 0, 0},
+    {9001, 97, 0, 0},
+    {9001, 98, 0, 0},
+    {9001, 99, 0, 0},
+    {9001, 100, 0, 0},
+    {9001, 101, 0, 0},
+    {10030, 102, 0, 0},
+    {10030, 103, 0, 0},
+    {10030, 104, 0, 0},
+    {10030, 105, 0, 0},
+    {10120, 106, 0, 0},
+    {10120, 107, 0, 0},
+    {9100, 108, 0, 0},
+    {9101, 109, 0, 0},
+    {9102, 110, 0, 0},
+    {9103, 111, 0, 0},
+    {11, 112, 0, 0},
+    {11, 113, 0, 0},
+    {11, 114, 0, 0},
+    {11, 115, 0, 0},
+    // Hypostyle
+    {1, 0, 0, 0},
+    {10030, 1, 0, 0},
+    {107, 2, 0, 0},
+    {10030, 3, 0, 0},
+    {9, 4, 0, 0},
+    {9, 5, 0, 0},
+    {9, 6, 0, 0},
+    {9, 7, 0, 0},
+    {9, 8, 0, 0},
+    {9, 9, 0, 0},
+    {9, 10, 0, 0},
+    {9, 11, 0, 0},
+    {7, 12, 0, 0},
+    {7, 13, 0, 0},
+    {7, 14, 0, 0},
+    {7, 15, 0, 0},
+    {6, 16, 0, 0},
+    {6, 17, 0, 0},
+    {6, 18, 0, 0},
+    {6, 19, 0, 0},
+    {9, 20, 0, 0},
+    {15, 21, 0, 0},
+    {15, 22, 0, 0},
+    {52, 23, 0, 0},
+    {57, 24, 0, 0},
+    {51, 25, 0, 0},
+    {51, 26, 0, 0},
+    {51, 27, 0, 0},
+    {42, 28, 0, 0},
+    {42, 29, 0, 0},
+    {45, 30, 0, 0},
+    {45, 31, 0, 0},
+    {44, 32, 0, 0},
+    {44, 33, 0, 0},
+    {44, 34, 0, 0},
+    {14, 35, 0, 0},
+    {9001, 36, 0, 0},
+    {9001, 37, 0, 0},
+    {9001, 38, 0, 0},
+    {9001, 39, 0, 0},
+    {9001, 40, 0, 0},
+    {9001, 41, 0, 0},
+    {9001, 42, 0, 0},
+    {9001, 43, 0, 0},
+    {140, 44, 0, 0},
+    {140, 45, 0, 0},
+    {10030, 46, 0, 0},
+    {15, 47, 0, 0},
+    {6, 48, 0, 0},
+    {7, 49, 0, 0},
+    {15, 50, 0, 0},
+    {44, 51, 0, 0},
+    {42, 52, 0, 0},
+    {41, 53, 0, 0},
+    {41, 54, 0, 0},
+    {42, 55, 0, 0},
+    {44, 56, 0, 0},
+    {45, 57, 0, 0},
+    {254, 58, 0, 0},
+    {9001, 59, 0, 0},
+    {9001, 60, 0, 0},
+    {9001, 61, 0, 0},
+    {9001, 62, 0, 0},
+    {32, 63, 0, 0},
+    {82, 64, 0, 0},
+    {82, 65, 0, 0},
+    {82, 66, 0, 0},
+    {82, 67, 0, 0},
+    {82, 68, 0, 0},
+    {82, 69, 0, 0},
+    {82, 70, 0, 0},
+    {8000, 71, 0, 0},
+    {8000, 72, 0, 0},
+    {8000, 73, 0, 0},
+    {8000, 74, 0, 0},
+    {8000, 75, 0, 0},
+    {8000, 76, 0, 0},
+    {8000, 77, 0, 0},
+    {8000, 78, 0, 0},
+    {19, 79, 0, 0},
+    {22, 80, 0, 0},
+    {13, 81, 0, 0},
+    {107, 82, 0, 0},
+    {107, 83, 0, 0},
+    {107, 84, 0, 0},
+    {107, 85, 0, 0},
+    {107, 86, 0, 0},
+    {107, 87, 0, 0},
+    {107, 88, 0, 0},
+    {10060, 89, 0, 0},
+    {10060, 90, 0, 0},
+    {10060, 91, 0, 0},
+    {10060, 92, 0, 0},
+    {10060, 93, 0, 0},
+    {10060, 94, 0, 0},
+    {10030, 95, 0, 0},
+    {10060, 96, 0, 0},
+    {10060, 97, 0, 0},
+    {10030, 98, 0, 0},
+    {10030, 99, 0, 0},
+    {10030, 100, 0, 0},
+    {10030, 101, 0, 0},
+    {10030, 102, 0, 0},
+    {10030, 103, 0, 0},
+    {31, 104, 0, 0},
+    {31, 105, 0, 0},
+    {31, 106, 0, 0},
+    {31, 107, 0, 0},
+    {31, 108, 0, 0},
+    {10060, 109, 0, 0},
+    {10060, 110, 0, 0},
+    {10060, 111, 0, 0},
+    {10060, 112, 0, 0},
+    {10060, 113, 0, 0},
+    {10060, 114, 0, 0},
+    {10030, 115, 0, 0},
+    {10030, 116, 0, 0},
+    {10030, 117, 0, 0},
+    {8080, 118, 0, 0},
+    {8080, 119, 0, 0},
+    {8080, 120, 0, 0},
+    {8080, 121, 0, 0},
+    {8080, 122, 0, 0},
+    {8080, 123, 0, 0},
+    {8080, 124, 0, 0},
+    {10030, 125, 0, 0},
+    {10030, 126, 0, 0},
+    {10030, 127, 0, 0},
+    {10030, 128, 0, 0},
+    {10030, 129, 0, 0},
+    {10030, 130, 0, 0},
+    {10030, 131, 0, 0},
+    {10030, 132, 0, 0},
+    {10030, 133, 0, 0},
+    {10030, 134, 0, 0},
+    {10030, 135, 0, 0},
+    {10030, 136, 0, 0},
+    {10030, 137, 0, 0},
+    {10030, 138, 0, 0},
+    {10030, 139, 0, 0},
+    {8080, 140, 0, 0},
+    {8080, 141, 0, 0},
+    {10030, 142, 0, 0},
+    {10030, 143, 0, 0},
+    {10030, 144, 0, 0},
+    {10030, 145, 0, 0},
+    {82, 146, 0, 0},
+    {82, 147, 0, 0},
+    {82, 148, 0, 0},
+    {82, 149, 0, 0},
+    {82, 150, 0, 0},
+    {82, 151, 0, 0},
+    {81, 152, 0, 0},
+    {81, 153, 0, 0},
+    {81, 154, 0, 0},
+    {81, 155, 0, 0},
+    {81, 156, 0, 0},
+    {81, 157, 0, 0},
+    {81, 158, 0, 0},
+    {81, 159, 0, 0},
+    {10030, 160, 0, 0},
+    {10030, 161, 0, 0},
+    {10030, 162, 0, 0},
+    {9001, 163, 0, 0},
+    {9001, 164, 0, 0},
+    {9001, 165, 0, 0},
+    {9001, 166, 0, 0},
+    {81, 167, 0, 0},
+    {81, 168, 0, 0},
+    {81, 169, 0, 0},
+    {81, 170, 0, 0},
+    {81, 171, 0, 0},
+    {81, 172, 0, 0},
+    {81, 173, 0, 0},
+    {81, 174, 0, 0},
+    {81, 175, 0, 0},
+    {81, 176, 0, 0},
+    {81, 177, 0, 0},
+    {81, 178, 0, 0},
+    {122, 179, 0, 0},
+    {122, 180, 0, 0},
+    {122, 181, 0, 0},
+    {124, 182, 0, 0},
+    {124, 183, 0, 0},
+    {124, 184, 0, 0},
+    {124, 185, 0, 0},
+    {122, 186, 0, 0},
+    {8004, 187, 0, 0},
+    {122, 188, 0, 0},
+    {122, 189, 0, 0},
+    {122, 190, 0, 0},
+    {124, 191, 0, 0},
+    {124, 192, 0, 0},
+    {124, 193, 0, 0},
+    {81, 194, 0, 0},
+    {81, 195, 0, 0},
+    {81, 196, 0, 0},
+    {81, 197, 0, 0},
+    {81, 198, 0, 0},
+    {81, 199, 0, 0},
+    {8004, 200, 0, 0},
+    {8004, 201, 0, 0},
+    {124, 202, 0, 0},
+    {124, 203, 0, 0},
+    {124, 204, 0, 0},
+    {122, 205, 0, 0},
+    {122, 206, 0, 0},
+    {122, 207, 0, 0},
+    {81, 208, 0, 0},
+    {81, 209, 0, 0},
+    {81, 210, 0, 0},
+    {81, 211, 0, 0},
+    {8004, 212, 0, 0},
+    {124, 213, 0, 0},
+    {124, 214, 0, 0},
+    {124, 215, 0, 0},
+    {122, 216, 0, 0},
+    {122, 217, 0, 0},
+    {122, 218, 0, 0},
+    {2, 219, 0, 0},
+    {3, 220, 0, 0},
+    {4, 221, 0, 0},
+    {8007, 222, 0, 0},
+    {8006, 223, 0, 0},
+    {8041, 224, 0, 0},
+    {8008, 225, 0, 0},
+    {8005, 226, 0, 0},
+    {10040, 227, 0, 0},
+    {36, 228, 0, 0},
+    {10, 229, 0, 0},
+    {20, 230, 0, 0},
+    {16, 231, 0, 0},
+    {23, 232, 0, 0},
+    {19, 233, 0, 0},
+    {13, 234, 0, 0},
+    {22, 235, 0, 0},
+    {8010, 236, 0, 0},
+    {123, 237, 0, 0},
+    {18, 238, 0, 0},
+    {12, 239, 0, 0},
+    {21, 240, 0, 0},
+    {53, 241, 0, 0},
+    {8040, 242, 0, 0},
+    {11, 243, 0, 0},
+    {11, 244, 0, 0},
+    {11, 245, 0, 0},
+    {11, 246, 0, 0},
+    {84, 247, 0, 0},
+    {83, 248, 0, 0},
+    {9001, 249, 0, 0},
+    {9001, 250, 0, 0},
+    {9001, 251, 0, 0},
+    {9001, 252, 0, 0},
+    {9001, 253, 0, 0},
+    {83, 254, 0, 0},
+    {8080, 255, 0, 0},
+    {8080, 256, 0, 0},
+    {10060, 257, 0, 0},
+    {10060, 258, 0, 0},
+    {10060, 259, 0, 0},
+    {10060, 260, 0, 0},
+    {31, 261, 0, 0},
+    {31, 262, 0, 0},
+    {8009, 263, 0, 0},
+    {84, 264, 0, 0},
+    {10120, 265, 0, 0},
+    {10120, 266, 0, 0},
+    {10120, 267, 0, 0},
+    {10120, 268, 0, 0},
+    {10120, 269, 0, 0},
+    {9100, 270, 0, 0},
+    {9101, 271, 0, 0},
+    {9102, 272, 0, 0},
+    {9103, 273, 0, 0},
+    {11, 274, 0, 0},
+    {11, 275, 0, 0},
+    {11, 276, 0, 0},
+    {11, 277, 0, 0},
+    // Shadow Wood
+    {1, 0, 0, 0},
+    {79, 1, 0, 0},
+    {78, 2, 0, 0},
+    {79, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {3002, 5, 0, 0},
+    {3000, 6, 0, 0},
+    {3000, 7, 0, 0},
+    {1410, 8, 0, 0},
+    {1410, 9, 0, 0},
+    {122, 10, 0, 0},
+    {122, 11, 0, 0},
+    {122, 12, 0, 0},
+    {122, 13, 0, 0},
+    {82, 14, 0, 0},
+    {82, 15, 0, 0},
+    {122, 16, 0, 0},
+    {101, 17, 0, 0},
+    {101, 18, 0, 0},
+    {102, 19, 0, 0},
+    {102, 20, 0, 0},
+    {78, 21, 0, 0},
+    {79, 22, 0, 0},
+    {79, 23, 0, 0},
+    {79, 24, 0, 0},
+    {79, 25, 0, 0},
+    {79, 26, 0, 0},
+    {79, 27, 0, 0},
+    {79, 28, 0, 0},
+    {79, 29, 0, 0},
+    {79, 30, 0, 0},
+    {8044, 31, 0, 0},
+    {8044, 32, 0, 0},
+    {8044, 33, 0, 0},
+    {8044, 34, 0, 0},
+    {99, 35, 0, 0},
+    {100, 36, 0, 0},
+    {100, 37, 0, 0},
+    {102, 38, 0, 0},
+    {102, 39, 0, 0},
+    {101, 40, 0, 0},
+    {101, 41, 0, 0},
+    {106, 42, 0, 0},
+    {106, 43, 0, 0},
+    {9, 44, 0, 0},
+    {97, 45, 0, 0},
+    {97, 46, 0, 0},
+    {42, 47, 0, 0},
+    {42, 48, 0, 0},
+    {8068, 49, 0, 0},
+    {8068, 50, 0, 0},
+    {8068, 51, 0, 0},
+    {8068, 52, 0, 0},
+    {8068, 53, 0, 0},
+    {8068, 54, 0, 0},
+    {8068, 55, 0, 0},
+    {8068, 56, 0, 0},
+    {101, 57, 0, 0},
+    {102, 58, 0, 0},
+    {8101, 59, 0, 0},
+    {8101, 60, 0, 0},
+    {8101, 61, 0, 0},
+    {8101, 62, 0, 0},
+    {8101, 63, 0, 0},
+    {8102, 64, 0, 0},
+    {97, 65, 0, 0},
+    {59, 66, 0, 0},
+    {59, 67, 0, 0},
+    {59, 68, 0, 0},
+    {59, 69, 0, 0},
+    {58, 70, 0, 0},
+    {58, 71, 0, 0},
+    {58, 72, 0, 0},
+    {57, 73, 0, 0},
+    {57, 74, 0, 0},
+    {98, 75, 0, 0},
+    {8101, 76, 0, 0},
+    {8101, 77, 0, 0},
+    {8101, 78, 0, 0},
+    {8101, 79, 0, 0},
+    {8101, 80, 0, 0},
+    {8102, 81, 0, 0},
+    {46, 82, 0, 0},
+    {46, 83, 0, 0},
+    {46, 84, 0, 0},
+    {46, 85, 0, 0},
+    {46, 86, 0, 0},
+    {71, 87, 0, 0},
+    {71, 88, 0, 0},
+    {71, 89, 0, 0},
+    {8047, 90, 0, 0},
+    {8047, 91, 0, 0},
+    {111, 92, 0, 0},
+    {111, 93, 0, 0},
+    {111, 94, 0, 0},
+    {54, 95, 0, 0},
+    {119, 96, 0, 0},
+    {8072, 97, 0, 0},
+    {8072, 98, 0, 0},
+    {8072, 99, 0, 0},
+    {8073, 100, 0, 0},
+    {8072, 101, 0, 0},
+    {8072, 102, 0, 0},
+    {8072, 103, 0, 0},
+    {8072, 104, 0, 0},
+    {8072, 105, 0, 0},
+    {8072, 106, 0, 0},
+    {8072, 107, 0, 0},
+    {8072, 108, 0, 0},
+    {8072, 109, 0, 0},
+    {8072, 110, 0, 0},
+    {8072, 111, 0, 0},
+    {8072, 112, 0, 0},
+    {8072, 113, 0, 0},
+    {8072, 114, 0, 0},
+    {8077, 115, 0, 0},
+    {8076, 116, 0, 0},
+    {8075, 117, 0, 0},
+    {8076, 118, 0, 0},
+    {8076, 119, 0, 0},
+    {8072, 120, 0, 0},
+    {8072, 121, 0, 0},
+    {8077, 122, 0, 0},
+    {8072, 123, 0, 0},
+    {8072, 124, 0, 0},
+    {8077, 125, 0, 0},
+    {8072, 126, 0, 0},
+    {8072, 127, 0, 0},
+    {8077, 128, 0, 0},
+    {8061, 129, 0, 0},
+    {105, 130, 0, 0},
+    {8061, 131, 0, 0},
+    {8072, 132, 0, 0},
+    {8072, 133, 0, 0},
+    {8073, 134, 0, 0},
+    {8074, 135, 0, 0},
+    {54, 136, 0, 0},
+    {54, 137, 0, 0},
+    {54, 138, 0, 0},
+    {111, 139, 0, 0},
+    {8047, 140, 0, 0},
+    {8047, 141, 0, 0},
+    {105, 142, 0, 0},
+    {105, 143, 0, 0},
+    {110, 144, 0, 0},
+    {110, 145, 0, 0},
+    {119, 146, 0, 0},
+    {3002, 147, 0, 0},
+    {3002, 148, 0, 0},
+    {3000, 149, 0, 0},
+    {3000, 150, 0, 0},
+    {9001, 151, 0, 0},
+    {9001, 152, 0, 0},
+    {9001, 153, 0, 0},
+    {9001, 154, 0, 0},
+    {9001, 155, 0, 0},
+    {9001, 156, 0, 0},
+    {9001, 157, 0, 0},
+    {9001, 158, 0, 0},
+    {9001, 159, 0, 0},
+    {9001, 160, 0, 0},
+    {9001, 161, 0, 0},
+    {9001, 162, 0, 0},
+    {9001, 163, 0, 0},
+    {9001, 164, 0, 0},
+    {9001, 165, 0, 0},
+    {9001, 166, 0, 0},
+    {9001, 167, 0, 0},
+    {9001, 168, 0, 0},
+    {107, 169, 0, 0},
+    {107, 170, 0, 0},
+    {107, 171, 0, 0},
+    {107, 172, 0, 0},
+    {107, 173, 0, 0},
+    {10060, 174, 0, 0},
+    {10060, 175, 0, 0},
+    {10060, 176, 0, 0},
+    {10060, 177, 0, 0},
+    {31, 178, 0, 0},
+    {121, 179, 0, 0},
+    {121, 180, 0, 0},
+    {121, 181, 0, 0},
+    {121, 182, 0, 0},
+    {10060, 183, 0, 0},
+    {10060, 184, 0, 0},
+    {10030, 185, 0, 0},
+    {10030, 186, 0, 0},
+    {10030, 187, 0, 0},
+    {10030, 188, 0, 0},
+    {10030, 189, 0, 0},
+    {31, 190, 0, 0},
+    {31, 191, 0, 0},
+    {31, 192, 0, 0},
+    {31, 193, 0, 0},
+    {31, 194, 0, 0},
+    {10060, 195, 0, 0},
+    {107, 196, 0, 0},
+    {10060, 197, 0, 0},
+    {107, 198, 0, 0},
+    {10060, 199, 0, 0},
+    {10060, 200, 0, 0},
+    {10030, 201, 0, 0},
+    {10030, 202, 0, 0},
+    {10030, 203, 0, 0},
+    {31, 204, 0, 0},
+    {31, 205, 0, 0},
+    {107, 206, 0, 0},
+    {107, 207, 0, 0},
+    {107, 208, 0, 0},
+    {8007, 209, 0, 0},
+    {86, 210, 0, 0},
+    {36, 211, 0, 0},
+    {8041, 212, 0, 0},
+    {8009, 213, 0, 0},
+    {123, 214, 0, 0},
+    {8040, 215, 0, 0},
+    {81, 216, 0, 0},
+    {81, 217, 0, 0},
+    {81, 218, 0, 0},
+    {81, 219, 0, 0},
+    {81, 220, 0, 0},
+    {81, 221, 0, 0},
+    {81, 222, 0, 0},
+    {81, 223, 0, 0},
+    {81, 224, 0, 0},
+    {81, 225, 0, 0},
+    {81, 226, 0, 0},
+    {81, 227, 0, 0},
+    {81, 228, 0, 0},
+    {81, 229, 0, 0},
+    {81, 230, 0, 0},
+    {81, 231, 0, 0},
+    {81, 232, 0, 0},
+    {81, 233, 0, 0},
+    {81, 234, 0, 0},
+    {81, 235, 0, 0},
+    {81, 236, 0, 0},
+    {81, 237, 0, 0},
+    {81, 238, 0, 0},
+    {81, 239, 0, 0},
+    {81, 240, 0, 0},
+    {81, 241, 0, 0},
+    {81, 242, 0, 0},
+    {81, 243, 0, 0},
+    {81, 244, 0, 0},
+    {81, 245, 0, 0},
+    {81, 246, 0, 0},
+    {81, 247, 0, 0},
+    {82, 248, 0, 0},
+    {82, 249, 0, 0},
+    {82, 250, 0, 0},
+    {82, 251, 0, 0},
+    {82, 252, 0, 0},
+    {82, 253, 0, 0},
+    {82, 254, 0, 0},
+    {82, 255, 0, 0},
+    {82, 256, 0, 0},
+    {82, 257, 0, 0},
+    {82, 258, 0, 0},
+    {82, 259, 0, 0},
+    {82, 260, 0, 0},
+    {82, 261, 0, 0},
+    {82, 262, 0, 0},
+    {82, 263, 0, 0},
+    {82, 264, 0, 0},
+    {82, 265, 0, 0},
+    {82, 266, 0, 0},
+    {82, 267, 0, 0},
+    {124, 268, 0, 0},
+    {124, 269, 0, 0},
+    {124, 270, 0, 0},
+    {122, 271, 0, 0},
+    {122, 272, 0, 0},
+    {122, 273, 0, 0},
+    {122, 274, 0, 0},
+    {122, 275, 0, 0},
+    {122, 276, 0, 0},
+    {122, 277, 0, 0},
+    {124, 278, 0, 0},
+    {124, 279, 0, 0},
+    {124, 280, 0, 0},
+    {124, 281, 0, 0},
+    {122, 282, 0, 0},
+    {122, 283, 0, 0},
+    {122, 284, 0, 0},
+    {124, 285, 0, 0},
+    {124, 286, 0, 0},
+    {122, 287, 0, 0},
+    {122, 288, 0, 0},
+    {124, 289, 0, 0},
+    {124, 290, 0, 0},
+    {124, 291, 0, 0},
+    {122, 292, 0, 0},
+    {122, 293, 0, 0},
+    {122, 294, 0, 0},
+    {124, 295, 0, 0},
+    {124, 296, 0, 0},
+    {8004, 297, 0, 0},
+    {8004, 298, 0, 0},
+    {8004, 299, 0, 0},
+    {8004, 300, 0, 0},
+    {8004, 301, 0, 0},
+    {8004, 302, 0, 0},
+    {8004, 303, 0, 0},
+    {8004, 304, 0, 0},
+    {8004, 305, 0, 0},
+    {8004, 306, 0, 0},
+    {107, 307, 0, 0},
+    {107, 308, 0, 0},
+    {107, 309, 0, 0},
+    {107, 310, 0, 0},
+    {10060, 311, 0, 0},
+    {10060, 312, 0, 0},
+    {122, 313, 0, 0},
+    {122, 314, 0, 0},
+    {122, 315, 0, 0},
+    {124, 316, 0, 0},
+    {124, 317, 0, 0},
+    {124, 318, 0, 0},
+    {8004, 319, 0, 0},
+    {82, 320, 0, 0},
+    {82, 321, 0, 0},
+    {82, 322, 0, 0},
+    {82, 323, 0, 0},
+    {31, 324, 0, 0},
+    {82, 325, 0, 0},
+    {82, 326, 0, 0},
+    {82, 327, 0, 0},
+    {82, 328, 0, 0},
+    {10060, 329, 0, 0},
+    {32, 330, 0, 0},
+    {107, 331, 0, 0},
+    {121, 332, 0, 0},
+    {121, 333, 0, 0},
+    {10060, 334, 0, 0},
+    {10060, 335, 0, 0},
+    {10060, 336, 0, 0},
+    {10060, 337, 0, 0},
+    {10060, 338, 0, 0},
+    {10060, 339, 0, 0},
+    {121, 340, 0, 0},
+    {1, 341, 0, 0},
+    {2, 342, 0, 0},
+    {3, 343, 0, 0},
+    {4, 344, 0, 0},
+    {3, 345, 0, 0},
+    {4, 346, 0, 0},
+    {1, 347, 0, 0},
+    {2, 348, 0, 0},
+    {4, 349, 0, 0},
+    {3, 350, 0, 0},
+    {2, 351, 0, 0},
+    {1, 352, 0, 0},
+    {3, 353, 0, 0},
+    {4, 354, 0, 0},
+    {1, 355, 0, 0},
+    {2, 356, 0, 0},
+    {4, 357, 0, 0},
+    {3, 358, 0, 0},
+    {2, 359, 0, 0},
+    {1, 360, 0, 0},
+    {9001, 361, 0, 0},
+    {9001, 362, 0, 0},
+    {9001, 363, 0, 0},
+    {9001, 364, 0, 0},
+    {9001, 365, 0, 0},
+    {31, 366, 0, 0},
+    {31, 367, 0, 0},
+    {31, 368, 0, 0},
+    {10060, 369, 0, 0},
+    {10060, 370, 0, 0},
+    {10060, 371, 0, 0},
+    {10030, 372, 0, 0},
+    {10030, 373, 0, 0},
+    {10030, 374, 0, 0},
+    {10030, 375, 0, 0},
+    {10030, 376, 0, 0},
+    {10030, 377, 0, 0},
+    {10030, 378, 0, 0},
+    {10030, 379, 0, 0},
+    {10030, 380, 0, 0},
+    {10060, 381, 0, 0},
+    {10060, 382, 0, 0},
+    {10030, 383, 0, 0},
+    {10030, 384, 0, 0},
+    {107, 385, 0, 0},
+    {107, 386, 0, 0},
+    {10060, 387, 0, 0},
+    {10060, 388, 0, 0},
+    {10060, 389, 0, 0},
+    {10060, 390, 0, 0},
+    {10060, 391, 0, 0},
+    {10060, 392, 0, 0},
+    {10060, 393, 0, 0},
+    {10060, 394, 0, 0},
+    {10060, 395, 0, 0},
+    {10060, 396, 0, 0},
+    {10060, 397, 0, 0},
+    {10030, 398, 0, 0},
+    {10030, 399, 0, 0},
+    {10030, 400, 0, 0},
+    {10030, 401, 0, 0},
+    {10030, 402, 0, 0},
+    {10030, 403, 0, 0},
+    {10030, 404, 0, 0},
+    {11, 405, 0, 0},
+    {11, 406, 0, 0},
+    {11, 407, 0, 0},
+    {10060, 408, 0, 0},
+    {10060, 409, 0, 0},
+    {10060, 410, 0, 0},
+    {10060, 411, 0, 0},
+    {10060, 412, 0, 0},
+    {32, 413, 0, 0},
+    {2, 414, 0, 0},
+    {3, 415, 0, 0},
+    {4, 416, 0, 0},
+    {11, 417, 0, 0},
+    {10, 418, 0, 0},
+    {8010, 419, 0, 0},
+    {53, 420, 0, 0},
+    {20, 421, 0, 0},
+    {19, 422, 0, 0},
+    {18, 423, 0, 0},
+    {16, 424, 0, 0},
+    {13, 425, 0, 0},
+    {12, 426, 0, 0},
+    {23, 427, 0, 0},
+    {22, 428, 0, 0},
+    {21, 429, 0, 0},
+    {83, 430, 0, 0},
+    {84, 431, 0, 0},
+    {84, 432, 0, 0},
+    {10120, 433, 0, 0},
+    {10120, 434, 0, 0},
+    {10120, 435, 0, 0},
+    {10120, 436, 0, 0},
+    {8004, 437, 0, 0},
+    {8004, 438, 0, 0},
+    {8004, 439, 0, 0},
+    {8004, 440, 0, 0},
+    {8004, 441, 0, 0},
+    {8004, 442, 0, 0},
+    {8004, 443, 0, 0},
+    {8004, 444, 0, 0},
+    {8004, 445, 0, 0},
+    {8004, 446, 0, 0},
+    {8004, 447, 0, 0},
+    {8004, 448, 0, 0},
+    {8004, 449, 0, 0},
+    {8004, 450, 0, 0},
+    {8004, 451, 0, 0},
+    {8004, 452, 0, 0},
+    {8004, 453, 0, 0},
+    {8004, 454, 0, 0},
+    {8004, 455, 0, 0},
+    {8004, 456, 0, 0},
+    {8004, 457, 0, 0},
+    {8004, 458, 0, 0},
+    {8004, 459, 0, 0},
+    {8004, 460, 0, 0},
+    {8004, 461, 0, 0},
+    {8004, 462, 0, 0},
+    {8004, 463, 0, 0},
+    {8004, 464, 0, 0},
+    {8004, 465, 0, 0},
+    {8004, 466, 0, 0},
+    {8004, 467, 0, 0},
+    {8004, 468, 0, 0},
+    {10, 469, 0, 0},
+    {8010, 470, 0, 0},
+    {53, 471, 0, 0},
+    {10110, 472, 0, 0},
+    {10110, 473, 0, 0},
+    {10110, 474, 0, 0},
+    {10110, 475, 0, 0},
+    {10110, 476, 0, 0},
+    {10110, 477, 0, 0},
+    {10110, 478, 0, 0},
+    {10110, 479, 0, 0},
+    {10110, 480, 0, 0},
+    {10110, 481, 0, 0},
+    {10110, 482, 0, 0},
+    {10110, 483, 0, 0},
+    {10110, 484, 0, 0},
+    {118, 485, 0, 0},
+    {118, 486, 0, 0},
+    {118, 487, 0, 0},
+    {118, 488, 0, 0},
+    {118, 489, 0, 0},
+    {118, 490, 0, 0},
+    {118, 491, 0, 0},
+    {118, 492, 0, 0},
+    {11, 493, 0, 0},
+    {11, 494, 0, 0},
+    {11, 495, 0, 0},
+    {11, 496, 0, 0},
+    {9100, 497, 0, 0},
+    {9101, 498, 0, 0},
+    {9102, 499, 0, 0},
+    {9103, 500, 0, 0},
+    {9100, 501, 0, 0},
+    {9101, 502, 0, 0},
+    {9102, 503, 0, 0},
+    {9103, 504, 0, 0},
+    {9100, 505, 0, 0},
+    {9101, 506, 0, 0},
+    {9102, 507, 0, 0},
+    {9103, 508, 0, 0},
+    {9100, 509, 0, 0},
+    {9101, 510, 0, 0},
+    {9102, 511, 0, 0},
+    {9103, 512, 0, 0},
+    {9100, 513, 0, 0},
+    {9101, 514, 0, 0},
+    {9102, 515, 0, 0},
+    {9103, 516, 0, 0},
+    {9100, 517, 0, 0},
+    {9101, 518, 0, 0},
+    {9102, 519, 0, 0},
+    {9103, 520, 0, 0},
+    // Heresiarch's Seminary
+    {1, 0, 0, 0},
+    {3000, 1, 0, 0},
+    {3000, 2, 0, 0},
+    {3001, 3, 0, 0},
+    {3001, 4, 0, 0},
+    {3000, 5, 0, 0},
+    {3002, 6, 0, 0},
+    {3000, 7, 0, 0},
+    {3000, 8, 0, 0},
+    {3002, 9, 0, 0},
+    {3002, 10, 0, 0},
+    {3000, 11, 0, 0},
+    {3001, 12, 0, 0},
+    {3001, 13, 0, 0},
+    {3001, 14, 0, 0},
+    {3001, 15, 0, 0},
+    {3000, 16, 0, 0},
+    {3000, 17, 0, 0},
+    {3000, 18, 0, 0},
+    {115, 19, 0, 0},
+    {107, 20, 0, 0},
+    {107, 21, 0, 0},
+    {107, 22, 0, 0},
+    {107, 23, 0, 0},
+    {107, 24, 0, 0},
+    {1404, 25, 0, 0},
+    {1404, 26, 0, 0},
+    {1404, 27, 0, 0},
+    {1404, 28, 0, 0},
+    {1404, 29, 0, 0},
+    {1404, 30, 0, 0},
+    {9001, 31, 0, 0},
+    {9001, 32, 0, 0},
+    {9001, 33, 0, 0},
+    {9001, 34, 0, 0},
+    {9001, 35, 0, 0},
+    {9001, 36, 0, 0},
+    {9001, 37, 0, 0},
+    {9001, 38, 0, 0},
+    {9001, 39, 0, 0},
+    {9001, 40, 0, 0},
+    {9001, 41, 0, 0},
+    {9001, 42, 0, 0},
+    {14, 43, 0, 0},
+    {14, 44, 0, 0},
+    {9001, 45, 0, 0},
+    {9001, 46, 0, 0},
+    {9001, 47, 0, 0},
+    {9001, 48, 0, 0},
+    {9001, 49, 0, 0},
+    {9001, 50, 0, 0},
+    {9001, 51, 0, 0},
+    {9001, 52, 0, 0},
+    {9001, 53, 0, 0},
+    {9001, 54, 0, 0},
+    {9001, 55, 0, 0},
+    {9001, 56, 0, 0},
+    {9001, 57, 0, 0},
+    {9001, 58, 0, 0},
+    {9001, 59, 0, 0},
+    {9001, 60, 0, 0},
+    {9001, 61, 0, 0},
+    {9001, 62, 0, 0},
+    {9001, 63, 0, 0},
+    {14, 64, 0, 0},
+    {10080, 65, 0, 0},
+    {77, 66, 0, 0},
+    {9001, 67, 0, 0},
+    {9001, 68, 0, 0},
+    {9001, 69, 0, 0},
+    {9001, 70, 0, 0},
+    {31, 71, 0, 0},
+    {31, 72, 0, 0},
+    {31, 73, 0, 0},
+    {31, 74, 0, 0},
+    {84, 75, 0, 0},
+    {117, 76, 0, 0},
+    {117, 77, 0, 0},
+    {117, 78, 0, 0},
+    {117, 79, 0, 0},
+    {117, 80, 0, 0},
+    {117, 81, 0, 0},
+    {117, 82, 0, 0},
+    {117, 83, 0, 0},
+    {117, 84, 0, 0},
+    {117, 85, 0, 0},
+    {117, 86, 0, 0},
+    {117, 87, 0, 0},
+    {117, 88, 0, 0},
+    {117, 89, 0, 0},
+    {117, 90, 0, 0},
+    {117, 91, 0, 0},
+    {117, 92, 0, 0},
+    {117, 93, 0, 0},
+    {117, 94, 0, 0},
+    {117, 95, 0, 0},
+    {117, 96, 0, 0},
+    {117, 97, 0, 0},
+    {117, 98, 0, 0},
+    {117, 99, 0, 0},
+    {117, 100, 0, 0},
+    {117, 101, 0, 0},
+    {117, 102, 0, 0},
+    {117, 103, 0, 0},
+    {117, 104, 0, 0},
+    {117, 105, 0, 0},
+    {117, 106, 0, 0},
+    {117, 107, 0, 0},
+    {18, 108, 0, 0},
+    {12, 109, 0, 0},
+    {21, 110, 0, 0},
+    {77, 111, 0, 0},
+    {77, 112, 0, 0},
+    {77, 113, 0, 0},
+    {77, 114, 0, 0},
+    {77, 115, 0, 0},
+    {77, 116, 0, 0},
+    {87, 117, 0, 0},
+    {87, 118, 0, 0},
+    {80, 119, 0, 0},
+    {80, 120, 0, 0},
+    {80, 121, 0, 0},
+    {8104, 122, 0, 0},
+    {8104, 123, 0, 0},
+    {8104, 124, 0, 0},
+    {8104, 125, 0, 0},
+    {8104, 126, 0, 0},
+    {8104, 127, 0, 0},
+    {101, 128, 0, 0},
+    {101, 129, 0, 0},
+    {101, 130, 0, 0},
+    {102, 131, 0, 0},
+    {102, 132, 0, 0},
+    {103, 133, 0, 0},
+    {103, 134, 0, 0},
+    {77, 135, 0, 0},
+    {77, 136, 0, 0},
+    {116, 137, 0, 0},
+    {116, 138, 0, 0},
+    {54, 139, 0, 0},
+    {54, 140, 0, 0},
+    {54, 141, 0, 0},
+    {54, 142, 0, 0},
+    {54, 143, 0, 0},
+    {54, 144, 0, 0},
+    {54, 145, 0, 0},
+    {54, 146, 0, 0},
+    {54, 147, 0, 0},
+    {54, 148, 0, 0},
+    {54, 149, 0, 0},
+    {54, 150, 0, 0},
+    {54, 151, 0, 0},
+    {54, 152, 0, 0},
+    {109, 153, 0, 0},
+    {108, 154, 0, 0},
+    {77, 155, 0, 0},
+    {77, 156, 0, 0},
+    {77, 157, 0, 0},
+    {77, 158, 0, 0},
+    {77, 159, 0, 0},
+    {77, 160, 0, 0},
+    {77, 161, 0, 0},
+    {103, 162, 0, 0},
+    {103, 163, 0, 0},
+    {116, 164, 0, 0},
+    {116, 165, 0, 0},
+    {116, 166, 0, 0},
+    {116, 167, 0, 0},
+    {103, 168, 0, 0},
+    {103, 169, 0, 0},
+    {103, 170, 0, 0},
+    {103, 171, 0, 0},
+    {119, 172, 0, 0},
+    {119, 173, 0, 0},
+    {119, 174, 0, 0},
+    {119, 175, 0, 0},
+    {119, 176, 0, 0},
+    {119, 177, 0, 0},
+    {119, 178, 0, 0},
+    {119, 179, 0, 0},
+    {119, 180, 0, 0},
+    {119, 181, 0, 0},
+    {77, 182, 0, 0},
+    {77, 183, 0, 0},
+    {54, 184, 0, 0},
+    {54, 185, 0, 0},
+    {54, 186, 0, 0},
+    {54, 187, 0, 0},
+    {103, 188, 0, 0},
+    {103, 189, 0, 0},
+    {77, 190, 0, 0},
+    {77, 191, 0, 0},
+    {77, 192, 0, 0},
+    {77, 193, 0, 0},
+    {77, 194, 0, 0},
+    {77, 195, 0, 0},
+    {77, 196, 0, 0},
+    {77, 197, 0, 0},
+    {116, 198, 0, 0},
+    {116, 199, 0, 0},
+    {103, 200, 0, 0},
+    {103, 201, 0, 0},
+    {77, 202, 0, 0},
+    {77, 203, 0, 0},
+    {54, 204, 0, 0},
+    {54, 205, 0, 0},
+    {54, 206, 0, 0},
+    {54, 207, 0, 0},
+    {54, 208, 0, 0},
+    {54, 209, 0, 0},
+    {54, 210, 0, 0},
+    {54, 211, 0, 0},
+    {54, 212, 0, 0},
+    {8100, 213, 0, 0},
+    {8100, 214, 0, 0},
+    {8100, 215, 0, 0},
+    {8100, 216, 0, 0},
+    {8100, 217, 0, 0},
+    {8100, 218, 0, 0},
+    {8100, 219, 0, 0},
+    {8100, 220, 0, 0},
+    {8100, 221, 0, 0},
+    {8100, 222, 0, 0},
+    {29, 223, 0, 0},
+    {28, 224, 0, 0},
+    {28, 225, 0, 0},
+    {80, 226, 0, 0},
+    {80, 227, 0, 0},
+    {80, 228, 0, 0},
+    {80, 229, 0, 0},
+    {8062, 230, 0, 0},
+    {8062, 231, 0, 0},
+    {104, 232, 0, 0},
+    {104, 233, 0, 0},
+    {104, 234, 0, 0},
+    {104, 235, 0, 0},
+    {104, 236, 0, 0},
+    {105, 237, 0, 0},
+    {105, 238, 0, 0},
+    {105, 239, 0, 0},
+    {105, 240, 0, 0},
+    {105, 241, 0, 0},
+    {105, 242, 0, 0},
+    {105, 243, 0, 0},
+    {105, 244, 0, 0},
+    {105, 245, 0, 0},
+    {105, 246, 0, 0},
+    {104, 247, 0, 0},
+    {104, 248, 0, 0},
+    {104, 249, 0, 0},
+    {104, 250, 0, 0},
+    {104, 251, 0, 0},
+    {104, 252, 0, 0},
+    {105, 253, 0, 0},
+    {105, 254, 0, 0},
+    {106, 255, 0, 0},
+    {106, 256, 0, 0},
+    {106, 257, 0, 0},
+    {106, 258, 0, 0},
+    {106, 259, 0, 0},
+    {106, 260, 0, 0},
+    {106, 261, 0, 0},
+    {116, 262, 0, 0},
+    {116, 263, 0, 0},
+    {116, 264, 0, 0},
+    {116, 265, 0, 0},
+    {116, 266, 0, 0},
+    {116, 267, 0, 0},
+    {116, 268, 0, 0},
+    {116, 269, 0, 0},
+    {5, 270, 0, 0},
+    {5, 271, 0, 0},
+    {54, 272, 0, 0},
+    {54, 273, 0, 0},
+    {54, 274, 0, 0},
+    {54, 275, 0, 0},
+    {54, 276, 0, 0},
+    {54, 277, 0, 0},
+    {103, 278, 0, 0},
+    {103, 279, 0, 0},
+    {71, 280, 0, 0},
+    {108, 281, 0, 0},
+    {109, 282, 0, 0},
+    {62, 283, 0, 0},
+    {62, 284, 0, 0},
+    {62, 285, 0, 0},
+    {110, 286, 0, 0},
+    {77, 287, 0, 0},
+    {103, 288, 0, 0},
+    {103, 289, 0, 0},
+    {108, 290, 0, 0},
+    {109, 291, 0, 0},
+    {71, 292, 0, 0},
+    {71, 293, 0, 0},
+    {111, 294, 0, 0},
+    {111, 295, 0, 0},
+    {111, 296, 0, 0},
+    {110, 297, 0, 0},
+    {110, 298, 0, 0},
+    {62, 299, 0, 0},
+    {62, 300, 0, 0},
+    {62, 301, 0, 0},
+    {62, 302, 0, 0},
+    {110, 303, 0, 0},
+    {110, 304, 0, 0},
+    {71, 305, 0, 0},
+    {17, 306, 0, 0},
+    {8100, 307, 0, 0},
+    {8100, 308, 0, 0},
+    {8100, 309, 0, 0},
+    {8100, 310, 0, 0},
+    {8100, 311, 0, 0},
+    {8100, 312, 0, 0},
+    {8100, 313, 0, 0},
+    {8100, 314, 0, 0},
+    {54, 315, 0, 0},
+    {54, 316, 0, 0},
+    {54, 317, 0, 0},
+    {54, 318, 0, 0},
+    {54, 319, 0, 0},
+    {54, 320, 0, 0},
+    {54, 321, 0, 0},
+    {5, 322, 0, 0},
+    {5, 323, 0, 0},
+    {5, 324, 0, 0},
+    {5, 325, 0, 0},
+    {103, 326, 0, 0},
+    {103, 327, 0, 0},
+    {110, 328, 0, 0},
+    {110, 329, 0, 0},
+    {110, 330, 0, 0},
+    {110, 331, 0, 0},
+    {62, 332, 0, 0},
+    {62, 333, 0, 0},
+    {62, 334, 0, 0},
+    {100, 335, 0, 0},
+    {102, 336, 0, 0},
+    {71, 337, 0, 0},
+    {71, 338, 0, 0},
+    {71, 339, 0, 0},
+    {71, 340, 0, 0},
+    {71, 341, 0, 0},
+    {116, 342, 0, 0},
+    {116, 343, 0, 0},
+    {8006, 344, 0, 0},
+    {8002, 345, 0, 0},
+    {83, 346, 0, 0},
+    {10110, 347, 0, 0},
+    {10110, 348, 0, 0},
+    {10110, 349, 0, 0},
+    {8000, 350, 0, 0},
+    {8000, 351, 0, 0},
+    {8000, 352, 0, 0},
+    {8000, 353, 0, 0},
+    {8000, 354, 0, 0},
+    {8000, 355, 0, 0},
+    {8000, 356, 0, 0},
+    {8000, 357, 0, 0},
+    {8000, 358, 0, 0},
+    {8000, 359, 0, 0},
+    {8000, 360, 0, 0},
+    {8000, 361, 0, 0},
+    {8000, 362, 0, 0},
+    {8000, 363, 0, 0},
+    {8000, 364, 0, 0},
+    {8000, 365, 0, 0},
+    {8000, 366, 0, 0},
+    {8000, 367, 0, 0},
+    {8000, 368, 0, 0},
+    {8000, 369, 0, 0},
+    {8000, 370, 0, 0},
+    {8000, 371, 0, 0},
+    {8000, 372, 0, 0},
+    {10030, 373, 0, 0},
+    {10030, 374, 0, 0},
+    {10030, 375, 0, 0},
+    {10030, 376, 0, 0},
+    {10030, 377, 0, 0},
+    {10030, 378, 0, 0},
+    {8000, 379, 0, 0},
+    {8000, 380, 0, 0},
+    {8000, 381, 0, 0},
+    {8000, 382, 0, 0},
+    {8000, 383, 0, 0},
+    {8000, 384, 0, 0},
+    {8000, 385, 0, 0},
+    {8000, 386, 0, 0},
+    {31, 387, 0, 0},
+    {31, 388, 0, 0},
+    {31, 389, 0, 0},
+    {31, 390, 0, 0},
+    {10030, 391, 0, 0},
+    {10030, 392, 0, 0},
+    {10030, 393, 0, 0},
+    {10030, 394, 0, 0},
+    {31, 395, 0, 0},
+    {114, 396, 0, 0},
+    {114, 397, 0, 0},
+    {114, 398, 0, 0},
+    {114, 399, 0, 0},
+    {114, 400, 0, 0},
+    {114, 401, 0, 0},
+    {114, 402, 0, 0},
+    {114, 403, 0, 0},
+    {114, 404, 0, 0},
+    {114, 405, 0, 0},
+    {114, 406, 0, 0},
+    {114, 407, 0, 0},
+    {114, 408, 0, 0},
+    {114, 409, 0, 0},
+    {114, 410, 0, 0},
+    {114, 411, 0, 0},
+    {114, 412, 0, 0},
+    {114, 413, 0, 0},
+    {114, 414, 0, 0},
+    {114, 415, 0, 0},
+    {114, 416, 0, 0},
+    {114, 417, 0, 0},
+    {114, 418, 0, 0},
+    {115, 419, 0, 0},
+    {115, 420, 0, 0},
+    {107, 421, 0, 0},
+    {107, 422, 0, 0},
+    {107, 423, 0, 0},
+    {107, 424, 0, 0},
+    {31, 425, 0, 0},
+    {31, 426, 0, 0},
+    {31, 427, 0, 0},
+    {10060, 428, 0, 0},
+    {10060, 429, 0, 0},
+    {10060, 430, 0, 0},
+    {10060, 431, 0, 0},
+    {10060, 432, 0, 0},
+    {10060, 433, 0, 0},
+    {114, 434, 0, 0},
+    {114, 435, 0, 0},
+    {114, 436, 0, 0},
+    {114, 437, 0, 0},
+    {10030, 438, 0, 0},
+    {10030, 439, 0, 0},
+    {10030, 440, 0, 0},
+    {10030, 441, 0, 0},
+    {10060, 442, 0, 0},
+    {10060, 443, 0, 0},
+    {10060, 444, 0, 0},
+    {10060, 445, 0, 0},
+    {31, 446, 0, 0},
+    {31, 447, 0, 0},
+    {31, 448, 0, 0},
+    {114, 449, 0, 0},
+    {114, 450, 0, 0},
+    {114, 451, 0, 0},
+    {114, 452, 0, 0},
+    {114, 453, 0, 0},
+    {114, 454, 0, 0},
+    {114, 455, 0, 0},
+    {114, 456, 0, 0},
+    {31, 457, 0, 0},
+    {31, 458, 0, 0},
+    {10060, 459, 0, 0},
+    {10060, 460, 0, 0},
+    {10060, 461, 0, 0},
+    {10060, 462, 0, 0},
+    {10030, 463, 0, 0},
+    {10030, 464, 0, 0},
+    {10030, 465, 0, 0},
+    {31, 466, 0, 0},
+    {31, 467, 0, 0},
+    {31, 468, 0, 0},
+    {31, 469, 0, 0},
+    {11, 470, 0, 0},
+    {11, 471, 0, 0},
+    {11, 472, 0, 0},
+    {11, 473, 0, 0},
+    {124, 474, 0, 0},
+    {124, 475, 0, 0},
+    {124, 476, 0, 0},
+    {124, 477, 0, 0},
+    {124, 478, 0, 0},
+    {124, 479, 0, 0},
+    {8004, 480, 0, 0},
+    {81, 481, 0, 0},
+    {81, 482, 0, 0},
+    {81, 483, 0, 0},
+    {81, 484, 0, 0},
+    {81, 485, 0, 0},
+    {81, 486, 0, 0},
+    {10110, 487, 0, 0},
+    {10110, 488, 0, 0},
+    {10110, 489, 0, 0},
+    {10110, 490, 0, 0},
+    {10110, 491, 0, 0},
+    {10110, 492, 0, 0},
+    {10110, 493, 0, 0},
+    {10110, 494, 0, 0},
+    {10110, 495, 0, 0},
+    {10110, 496, 0, 0},
+    {81, 497, 0, 0},
+    {81, 498, 0, 0},
+    {81, 499, 0, 0},
+    {81, 500, 0, 0},
+    {124, 501, 0, 0},
+    {124, 502, 0, 0},
+    {124, 503, 0, 0},
+    {124, 504, 0, 0},
+    {81, 505, 0, 0},
+    {81, 506, 0, 0},
+    {81, 507, 0, 0},
+    {81, 508, 0, 0},
+    {122, 509, 0, 0},
+    {122, 510, 0, 0},
+    {122, 511, 0, 0},
+    {8004, 512, 0, 0},
+    {81, 513, 0, 0},
+    {81, 514, 0, 0},
+    {81, 515, 0, 0},
+    {81, 516, 0, 0},
+    {81, 517, 0, 0},
+    {81, 518, 0, 0},
+    {81, 519, 0, 0},
+    {124, 520, 0, 0},
+    {124, 521, 0, 0},
+    {124, 522, 0, 0},
+    {124, 523, 0, 0},
+    {122, 524, 0, 0},
+    {122, 525, 0, 0},
+    {122, 526, 0, 0},
+    {122, 527, 0, 0},
+    {82, 528, 0, 0},
+    {82, 529, 0, 0},
+    {82, 530, 0, 0},
+    {82, 531, 0, 0},
+    {10110, 532, 0, 0},
+    {10110, 533, 0, 0},
+    {8004, 534, 0, 0},
+    {122, 535, 0, 0},
+    {122, 536, 0, 0},
+    {122, 537, 0, 0},
+    {124, 538, 0, 0},
+    {124, 539, 0, 0},
+    {124, 540, 0, 0},
+    {81, 541, 0, 0},
+    {81, 542, 0, 0},
+    {81, 543, 0, 0},
+    {81, 544, 0, 0},
+    {81, 545, 0, 0},
+    {81, 546, 0, 0},
+    {10110, 547, 0, 0},
+    {10110, 548, 0, 0},
+    {10110, 549, 0, 0},
+    {122, 550, 0, 0},
+    {122, 551, 0, 0},
+    {122, 552, 0, 0},
+    {122, 553, 0, 0},
+    {124, 554, 0, 0},
+    {124, 555, 0, 0},
+    {124, 556, 0, 0},
+    {124, 557, 0, 0},
+    {124, 558, 0, 0},
+    {124, 559, 0, 0},
+    {124, 560, 0, 0},
+    {124, 561, 0, 0},
+    {87, 562, 0, 0},
+    {80, 563, 0, 0},
+    {80, 564, 0, 0},
+    {87, 565, 0, 0},
+    {7, 566, 0, 0},
+    {7, 567, 0, 0},
+    {6, 568, 0, 0},
+    {9, 569, 0, 0},
+    {15, 570, 0, 0},
+    {15, 571, 0, 0},
+    {2, 572, 0, 0},
+    {3, 573, 0, 0},
+    {4, 574, 0, 0},
+    {1, 575, 0, 0},
+    {2, 576, 0, 0},
+    {3, 577, 0, 0},
+    {4, 578, 0, 0},
+    {1, 579, 0, 0},
+    {2, 580, 0, 0},
+    {4, 581, 0, 0},
+    {3, 582, 0, 0},
+    {1, 583, 0, 0},
+    {2, 584, 0, 0},
+    {3, 585, 0, 0},
+    {4, 586, 0, 0},
+    {1, 587, 0, 0},
+    {2, 588, 0, 0},
+    {3, 589, 0, 0},
+    {4, 590, 0, 0},
+    {82, 591, 0, 0},
+    {82, 592, 0, 0},
+    {82, 593, 0, 0},
+    {82, 594, 0, 0},
+    {82, 595, 0, 0},
+    {82, 596, 0, 0},
+    {82, 597, 0, 0},
+    {82, 598, 0, 0},
+    {82, 599, 0, 0},
+    {82, 600, 0, 0},
+    {82, 601, 0, 0},
+    {82, 602, 0, 0},
+    {82, 603, 0, 0},
+    {82, 604, 0, 0},
+    {81, 605, 0, 0},
+    {81, 606, 0, 0},
+    {81, 607, 0, 0},
+    {81, 608, 0, 0},
+    {81, 609, 0, 0},
+    {81, 610, 0, 0},
+    {81, 611, 0, 0},
+    {81, 612, 0, 0},
+    {81, 613, 0, 0},
+    {81, 614, 0, 0},
+    {81, 615, 0, 0},
+    {81, 616, 0, 0},
+    {81, 617, 0, 0},
+    {81, 618, 0, 0},
+    {81, 619, 0, 0},
+    {81, 620, 0, 0},
+    {81, 621, 0, 0},
+    {81, 622, 0, 0},
+    {81, 623, 0, 0},
+    {81, 624, 0, 0},
+    {84, 625, 0, 0},
+    {31, 626, 0, 0},
+    {31, 627, 0, 0},
+    {31, 628, 0, 0},
+    {31, 629, 0, 0},
+    {31, 630, 0, 0},
+    {31, 631, 0, 0},
+    {31, 632, 0, 0},
+    {31, 633, 0, 0},
+    {107, 634, 0, 0},
+    {107, 635, 0, 0},
+    {107, 636, 0, 0},
+    {107, 637, 0, 0},
+    {107, 638, 0, 0},
+    {10080, 639, 0, 0},
+    {8007, 640, 0, 0},
+    {8041, 641, 0, 0},
+    {8005, 642, 0, 0},
+    {8008, 643, 0, 0},
+    {10, 644, 0, 0},
+    {8010, 645, 0, 0},
+    {53, 646, 0, 0},
+    {9001, 647, 0, 0},
+    {9001, 648, 0, 0},
+    {9001, 649, 0, 0},
+    {9001, 650, 0, 0},
+    {107, 651, 0, 0},
+    {107, 652, 0, 0},
+    {31, 653, 0, 0},
+    {31, 654, 0, 0},
+    {31, 655, 0, 0},
+    {31, 656, 0, 0},
+    {31, 657, 0, 0},
+    {31, 658, 0, 0},
+    {114, 659, 0, 0},
+    {10060, 660, 0, 0},
+    {10060, 661, 0, 0},
+    {10060, 662, 0, 0},
+    {31, 663, 0, 0},
+    {31, 664, 0, 0},
+    {31, 665, 0, 0},
+    {10030, 666, 0, 0},
+    {107, 667, 0, 0},
+    {115, 668, 0, 0},
+    {31, 669, 0, 0},
+    {31, 670, 0, 0},
+    {31, 671, 0, 0},
+    {10060, 672, 0, 0},
+    {10060, 673, 0, 0},
+    {10060, 674, 0, 0},
+    {10030, 675, 0, 0},
+    {10030, 676, 0, 0},
+    {10030, 677, 0, 0},
+    {10030, 678, 0, 0},
+    {10030, 679, 0, 0},
+    {10030, 680, 0, 0},
+    {10060, 681, 0, 0},
+    {10060, 682, 0, 0},
+    {10060, 683, 0, 0},
+    {10060, 684, 0, 0},
+    {10060, 685, 0, 0},
+    {10060, 686, 0, 0},
+    {114, 687, 0, 0},
+    {114, 688, 0, 0},
+    {114, 689, 0, 0},
+    {114, 690, 0, 0},
+    {114, 691, 0, 0},
+    {114, 692, 0, 0},
+    {107, 693, 0, 0},
+    {107, 694, 0, 0},
+    {10060, 695, 0, 0},
+    {10060, 696, 0, 0},
+    {10060, 697, 0, 0},
+    {10060, 698, 0, 0},
+    {10030, 699, 0, 0},
+    {10030, 700, 0, 0},
+    {114, 701, 0, 0},
+    {114, 702, 0, 0},
+    {114, 703, 0, 0},
+    {114, 704, 0, 0},
+    {114, 705, 0, 0},
+    {10030, 706, 0, 0},
+    {10030, 707, 0, 0},
+    {10030, 708, 0, 0},
+    {10030, 709, 0, 0},
+    {10030, 710, 0, 0},
+    {10120, 711, 0, 0},
+    {10120, 712, 0, 0},
+    {10120, 713, 0, 0},
+    {10120, 714, 0, 0},
+    {10120, 715, 0, 0},
+    {122, 716, 0, 0},
+    {122, 717, 0, 0},
+    {122, 718, 0, 0},
+    {122, 719, 0, 0},
+    {124, 720, 0, 0},
+    {124, 721, 0, 0},
+    {124, 722, 0, 0},
+    {124, 723, 0, 0},
+    {124, 724, 0, 0},
+    {124, 725, 0, 0},
+    {124, 726, 0, 0},
+    {124, 727, 0, 0},
+    {124, 728, 0, 0},
+    {124, 729, 0, 0},
+    {122, 730, 0, 0},
+    {122, 731, 0, 0},
+    {122, 732, 0, 0},
+    {122, 733, 0, 0},
+    {122, 734, 0, 0},
+    {122, 735, 0, 0},
+    {122, 736, 0, 0},
+    {122, 737, 0, 0},
+    {122, 738, 0, 0},
+    {122, 739, 0, 0},
+    {122, 740, 0, 0},
+    {122, 741, 0, 0},
+    {8004, 742, 0, 0},
+    {8004, 743, 0, 0},
+    {8004, 744, 0, 0},
+    {8004, 745, 0, 0},
+    {8004, 746, 0, 0},
+    {8004, 747, 0, 0},
+    {8004, 748, 0, 0},
+    {8004, 749, 0, 0},
+    {8004, 750, 0, 0},
+    {8004, 751, 0, 0},
+    {8004, 752, 0, 0},
+    {122, 753, 0, 0},
+    {122, 754, 0, 0},
+    {122, 755, 0, 0},
+    {122, 756, 0, 0},
+    {122, 757, 0, 0},
+    {122, 758, 0, 0},
+    {122, 759, 0, 0},
+    {122, 760, 0, 0},
+    {122, 761, 0, 0},
+    {122, 762, 0, 0},
+    {122, 763, 0, 0},
+    {122, 764, 0, 0},
+    {124, 765, 0, 0},
+    {124, 766, 0, 0},
+    {124, 767, 0, 0},
+    {124, 768, 0, 0},
+    {124, 769, 0, 0},
+    {124, 770, 0, 0},
+    {124, 771, 0, 0},
+    {124, 772, 0, 0},
+    {124, 773, 0, 0},
+    {124, 774, 0, 0},
+    {124, 775, 0, 0},
+    {124, 776, 0, 0},
+    {9001, 777, 0, 0},
+    {8004, 778, 0, 0},
+    {8004, 779, 0, 0},
+    {8004, 780, 0, 0},
+    {8004, 781, 0, 0},
+    {8004, 782, 0, 0},
+    {8004, 783, 0, 0},
+    {8004, 784, 0, 0},
+    {8004, 785, 0, 0},
+    {8004, 786, 0, 0},
+    {8004, 787, 0, 0},
+    {8004, 788, 0, 0},
+    {8004, 789, 0, 0},
+    {8004, 790, 0, 0},
+    {8004, 791, 0, 0},
+    {8004, 792, 0, 0},
+    {8004, 793, 0, 0},
+    {8004, 794, 0, 0},
+    {8004, 795, 0, 0},
+    {8004, 796, 0, 0},
+    {8004, 797, 0, 0},
+    {8004, 798, 0, 0},
+    {8004, 799, 0, 0},
+    {8004, 800, 0, 0},
+    {8004, 801, 0, 0},
+    {8004, 802, 0, 0},
+    {8004, 803, 0, 0},
+    {8004, 804, 0, 0},
+    {8004, 805, 0, 0},
+    {8004, 806, 0, 0},
+    {8004, 807, 0, 0},
+    {8004, 808, 0, 0},
+    {8004, 809, 0, 0},
+    {8004, 810, 0, 0},
+    {8004, 811, 0, 0},
+    {8004, 812, 0, 0},
+    {8004, 813, 0, 0},
+    {8004, 814, 0, 0},
+    {8004, 815, 0, 0},
+    {8004, 816, 0, 0},
+    {8004, 817, 0, 0},
+    {10, 818, 0, 0},
+    {8010, 819, 0, 0},
+    {53, 820, 0, 0},
+    {8009, 821, 0, 0},
+    {123, 822, 0, 0},
+    {8040, 823, 0, 0},
+    {8009, 824, 0, 0},
+    {123, 825, 0, 0},
+    {8040, 826, 0, 0},
+    {20, 827, 0, 0},
+    {23, 828, 0, 0},
+    {16, 829, 0, 0},
+    {19, 830, 0, 0},
+    {13, 831, 0, 0},
+    {22, 832, 0, 0},
+    {11, 833, 0, 0},
+    {11, 834, 0, 0},
+    {11, 835, 0, 0},
+    {11, 836, 0, 0},
+    {9100, 837, 0, 0},
+    {9101, 838, 0, 0},
+    {9102, 839, 0, 0},
+    {9103, 840, 0, 0},
+    {9100, 841, 0, 0},
+    {9101, 842, 0, 0},
+    {9102, 843, 0, 0},
+    {9103, 844, 0, 0},
+    {9100, 845, 0, 0},
+    {9101, 846, 0, 0},
+    {9102, 847, 0, 0},
+    {9103, 848, 0, 0},
+    {9100, 849, 0, 0},
+    {9101, 850, 0, 0},
+    {9102, 851, 0, 0},
+    {9103, 852, 0, 0},
+    // Dragon Chapel
+    {3002, 0, 0, 0},
+    {3002, 1, 0, 0},
+    {3002, 2, 0, 0},
+    {3002, 3, 0, 0},
+    {3000, 4, 0, 0},
+    {3000, 5, 0, 0},
+    {3000, 6, 0, 0},
+    {3000, 7, 0, 0},
+    {3000, 8, 0, 0},
+    {3000, 9, 0, 0},
+    {3000, 10, 0, 0},
+    {3000, 11, 0, 0},
+    {3001, 12, 0, 0},
+    {3001, 13, 0, 0},
+    {3001, 14, 0, 0},
+    {3001, 15, 0, 0},
+    {1, 16, 0, 0},
+    {1406, 17, 0, 0},
+    {10060, 18, 0, 0},
+    {10060, 19, 0, 0},
+    {116, 20, 0, 0},
+    {116, 21, 0, 0},
+    {116, 22, 0, 0},
+    {116, 23, 0, 0},
+    {81, 24, 0, 0},
+    {81, 25, 0, 0},
+    {81, 26, 0, 0},
+    {81, 27, 0, 0},
+    {77, 28, 0, 0},
+    {77, 29, 0, 0},
+    {77, 30, 0, 0},
+    {77, 31, 0, 0},
+    {116, 32, 0, 0},
+    {116, 33, 0, 0},
+    {116, 34, 0, 0},
+    {116, 35, 0, 0},
+    {116, 36, 0, 0},
+    {116, 37, 0, 0},
+    {116, 38, 0, 0},
+    {54, 39, 0, 0},
+    {54, 40, 0, 0},
+    {54, 41, 0, 0},
+    {54, 42, 0, 0},
+    {54, 43, 0, 0},
+    {54, 44, 0, 0},
+    {54, 45, 0, 0},
+    {54, 46, 0, 0},
+    {54, 47, 0, 0},
+    {54, 48, 0, 0},
+    {116, 49, 0, 0},
+    {116, 50, 0, 0},
+    {116, 51, 0, 0},
+    {116, 52, 0, 0},
+    {116, 53, 0, 0},
+    {116, 54, 0, 0},
+    {9001, 55, 0, 0},
+    {110, 56, 0, 0},
+    {110, 57, 0, 0},
+    {110, 58, 0, 0},
+    {110, 59, 0, 0},
+    {8060, 60, 0, 0},
+    {8060, 61, 0, 0},
+    {8060, 62, 0, 0},
+    {8060, 63, 0, 0},
+    {8060, 64, 0, 0},
+    {8060, 65, 0, 0},
+    {8060, 66, 0, 0},
+    {8060, 67, 0, 0},
+    {8060, 68, 0, 0},
+    {8060, 69, 0, 0},
+    {8060, 70, 0, 0},
+    {8060, 71, 0, 0},
+    {8060, 72, 0, 0},
+    {8060, 73, 0, 0},
+    {8060, 74, 0, 0},
+    {8060, 75, 0, 0},
+    {119, 76, 0, 0},
+    {119, 77, 0, 0},
+    {119, 78, 0, 0},
+    {119, 79, 0, 0},
+    {119, 80, 0, 0},
+    {119, 81, 0, 0},
+    {119, 82, 0, 0},
+    {119, 83, 0, 0},
+    {119, 84, 0, 0},
+    {119, 85, 0, 0},
+    {117, 86, 0, 0},
+    {117, 87, 0, 0},
+    {117, 88, 0, 0},
+    {117, 89, 0, 0},
+    {117, 90, 0, 0},
+    {117, 91, 0, 0},
+    {117, 92, 0, 0},
+    {117, 93, 0, 0},
+    {119, 94, 0, 0},
+    {119, 95, 0, 0},
+    {119, 96, 0, 0},
+    {119, 97, 0, 0},
+    {119, 98, 0, 0},
+    {119, 99, 0, 0},
+    {116, 100, 0, 0},
+    {116, 101, 0, 0},
+    {116, 102, 0, 0},
+    {116, 103, 0, 0},
+    {32, 104, 0, 0},
+    {10110, 105, 0, 0},
+    {8000, 106, 0, 0},
+    {8000, 107, 0, 0},
+    {8000, 108, 0, 0},
+    {8000, 109, 0, 0},
+    {8000, 110, 0, 0},
+    {8000, 111, 0, 0},
+    {8000, 112, 0, 0},
+    {8000, 113, 0, 0},
+    {8000, 114, 0, 0},
+    {115, 115, 0, 0},
+    {115, 116, 0, 0},
+    {115, 117, 0, 0},
+    {115, 118, 0, 0},
+    {120, 119, 0, 0},
+    {120, 120, 0, 0},
+    {121, 121, 0, 0},
+    {10060, 122, 0, 0},
+    {10060, 123, 0, 0},
+    {10060, 124, 0, 0},
+    {10060, 125, 0, 0},
+    {10060, 126, 0, 0},
+    {10060, 127, 0, 0},
+    {10030, 128, 0, 0},
+    {10030, 129, 0, 0},
+    {10030, 130, 0, 0},
+    {10030, 131, 0, 0},
+    {10030, 132, 0, 0},
+    {10030, 133, 0, 0},
+    {31, 134, 0, 0},
+    {31, 135, 0, 0},
+    {114, 136, 0, 0},
+    {114, 137, 0, 0},
+    {114, 138, 0, 0},
+    {114, 139, 0, 0},
+    {114, 140, 0, 0},
+    {114, 141, 0, 0},
+    {114, 142, 0, 0},
+    {114, 143, 0, 0},
+    {114, 144, 0, 0},
+    {114, 145, 0, 0},
+    {10030, 146, 0, 0},
+    {10030, 147, 0, 0},
+    {10030, 148, 0, 0},
+    {10030, 149, 0, 0},
+    {10030, 150, 0, 0},
+    {115, 151, 0, 0},
+    {115, 152, 0, 0},
+    {115, 153, 0, 0},
+    {115, 154, 0, 0},
+    {114, 155, 0, 0},
+    {114, 156, 0, 0},
+    {114, 157, 0, 0},
+    {114, 158, 0, 0},
+    {10030, 159, 0, 0},
+    {10030, 160, 0, 0},
+    {10030, 161, 0, 0},
+    {10030, 162, 0, 0},
+    {10030, 163, 0, 0},
+    {10030, 164, 0, 0},
+    {10030, 165, 0, 0},
+    {114, 166, 0, 0},
+    {114, 167, 0, 0},
+    {11, 168, 0, 0},
+    {11, 169, 0, 0},
+    {11, 170, 0, 0},
+    {11, 171, 0, 0},
+    {11, 172, 0, 0},
+    {11, 173, 0, 0},
+    {10110, 174, 0, 0},
+    {10110, 175, 0, 0},
+    {10110, 176, 0, 0},
+    {10110, 177, 0, 0},
+    {10110, 178, 0, 0},
+    {10110, 179, 0, 0},
+    {10110, 180, 0, 0},
+    {10110, 181, 0, 0},
+    {8000, 182, 0, 0},
+    {8000, 183, 0, 0},
+    {8000, 184, 0, 0},
+    {8000, 185, 0, 0},
+    {8000, 186, 0, 0},
+    {8000, 187, 0, 0},
+    {8000, 188, 0, 0},
+    {8000, 189, 0, 0},
+    {81, 190, 0, 0},
+    {81, 191, 0, 0},
+    {81, 192, 0, 0},
+    {81, 193, 0, 0},
+    {124, 194, 0, 0},
+    {124, 195, 0, 0},
+    {124, 196, 0, 0},
+    {124, 197, 0, 0},
+    {122, 198, 0, 0},
+    {122, 199, 0, 0},
+    {122, 200, 0, 0},
+    {122, 201, 0, 0},
+    {8004, 202, 0, 0},
+    {82, 203, 0, 0},
+    {82, 204, 0, 0},
+    {82, 205, 0, 0},
+    {82, 206, 0, 0},
+    {124, 207, 0, 0},
+    {124, 208, 0, 0},
+    {122, 209, 0, 0},
+    {122, 210, 0, 0},
+    {122, 211, 0, 0},
+    {122, 212, 0, 0},
+    {122, 213, 0, 0},
+    {122, 214, 0, 0},
+    {122, 215, 0, 0},
+    {122, 216, 0, 0},
+    {124, 217, 0, 0},
+    {124, 218, 0, 0},
+    {124, 219, 0, 0},
+    {124, 220, 0, 0},
+    {124, 221, 0, 0},
+    {124, 222, 0, 0},
+    {82, 223, 0, 0},
+    {82, 224, 0, 0},
+    {82, 225, 0, 0},
+    {82, 226, 0, 0},
+    {81, 227, 0, 0},
+    {81, 228, 0, 0},
+    {81, 229, 0, 0},
+    {81, 230, 0, 0},
+    {81, 231, 0, 0},
+    {81, 232, 0, 0},
+    {81, 233, 0, 0},
+    {81, 234, 0, 0},
+    {122, 235, 0, 0},
+    {122, 236, 0, 0},
+    {122, 237, 0, 0},
+    {122, 238, 0, 0},
+    {122, 239, 0, 0},
+    {124, 240, 0, 0},
+    {124, 241, 0, 0},
+    {124, 242, 0, 0},
+    {124, 243, 0, 0},
+    {124, 244, 0, 0},
+    {82, 245, 0, 0},
+    {82, 246, 0, 0},
+    {82, 247, 0, 0},
+    {82, 248, 0, 0},
+    {82, 249, 0, 0},
+    {2, 250, 0, 0},
+    {3, 251, 0, 0},
+    {4, 252, 0, 0},
+    {8010, 253, 0, 0},
+    {10, 254, 0, 0},
+    {53, 255, 0, 0},
+    {8009, 256, 0, 0},
+    {123, 257, 0, 0},
+    {8040, 258, 0, 0},
+    {20, 259, 0, 0},
+    {19, 260, 0, 0},
+    {18, 261, 0, 0},
+    {16, 262, 0, 0},
+    {13, 263, 0, 0},
+    {12, 264, 0, 0},
+    {23, 265, 0, 0},
+    {22, 266, 0, 0},
+    {21, 267, 0, 0},
+    {9001, 268, 0, 0},
+    {9001, 269, 0, 0},
+    {9001, 270, 0, 0},
+    {9001, 271, 0, 0},
+    {9001, 272, 0, 0},
+    {10060, 273, 0, 0},
+    {10060, 274, 0, 0},
+    {10060, 275, 0, 0},
+    {10060, 276, 0, 0},
+    {120, 277, 0, 0},
+    {114, 278, 0, 0},
+    {114, 279, 0, 0},
+    {114, 280, 0, 0},
+    {114, 281, 0, 0},
+    {115, 282, 0, 0},
+    {115, 283, 0, 0},
+    {115, 284, 0, 0},
+    {115, 285, 0, 0},
+    {114, 286, 0, 0},
+    {114, 287, 0, 0},
+    {114, 288, 0, 0},
+    {10030, 289, 0, 0},
+    {10030, 290, 0, 0},
+    {10030, 291, 0, 0},
+    {10030, 292, 0, 0},
+    {10030, 293, 0, 0},
+    {10030, 294, 0, 0},
+    {107, 295, 0, 0},
+    {107, 296, 0, 0},
+    {107, 297, 0, 0},
+    {10060, 298, 0, 0},
+    {10060, 299, 0, 0},
+    {10060, 300, 0, 0},
+    {114, 301, 0, 0},
+    {114, 302, 0, 0},
+    {114, 303, 0, 0},
+    {114, 304, 0, 0},
+    {114, 305, 0, 0},
+    {114, 306, 0, 0},
+    {114, 307, 0, 0},
+    {10030, 308, 0, 0},
+    {10030, 309, 0, 0},
+    {10030, 310, 0, 0},
+    {10030, 311, 0, 0},
+    {10030, 312, 0, 0},
+    {84, 313, 0, 0},
+    {84, 314, 0, 0},
+    {10120, 315, 0, 0},
+    {10120, 316, 0, 0},
+    {10120, 317, 0, 0},
+    {10120, 318, 0, 0},
+    {124, 319, 0, 0},
+    {124, 320, 0, 0},
+    {122, 321, 0, 0},
+    {122, 322, 0, 0},
+    {122, 323, 0, 0},
+    {122, 324, 0, 0},
+    {9100, 325, 0, 0},
+    {9101, 326, 0, 0},
+    {9102, 327, 0, 0},
+    {9103, 328, 0, 0},
+    {11, 329, 0, 0},
+    {11, 330, 0, 0},
+    // Griffin Chapel
+    {3000, 0, 0, 0},
+    {3000, 1, 0, 0},
+    {3000, 2, 0, 0},
+    {3000, 3, 0, 0},
+    {3000, 4, 0, 0},
+    {3000, 5, 0, 0},
+    {3000, 6, 0, 0},
+    {3000, 7, 0, 0},
+    {3000, 8, 0, 0},
+    {3000, 9, 0, 0},
+    {3000, 10, 0, 0},
+    {3000, 11, 0, 0},
+    {3002, 12, 0, 0},
+    {3002, 13, 0, 0},
+    {3002, 14, 0, 0},
+    {3002, 15, 0, 0},
+    {3002, 16, 0, 0},
+    {3002, 17, 0, 0},
+    {3002, 18, 0, 0},
+    {3002, 19, 0, 0},
+    {3002, 20, 0, 0},
+    {3002, 21, 0, 0},
+    {3002, 22, 0, 0},
+    {3002, 23, 0, 0},
+    {1, 24, 0, 0},
+    {77, 25, 0, 0},
+    {9001, 26, 0, 0},
+    {9001, 27, 0, 0},
+    {9001, 28, 0, 0},
+    {9001, 29, 0, 0},
+    {9001, 30, 0, 0},
+    {9001, 31, 0, 0},
+    {9001, 32, 0, 0},
+    {9001, 33, 0, 0},
+    {9001, 34, 0, 0},
+    {9001, 35, 0, 0},
+    {9001, 36, 0, 0},
+    {9001, 37, 0, 0},
+    {9001, 38, 0, 0},
+    {9001, 39, 0, 0},
+    {9001, 40, 0, 0},
+    {9001, 41, 0, 0},
+    {9001, 42, 0, 0},
+    {9001, 43, 0, 0},
+    {9001, 44, 0, 0},
+    {9001, 45, 0, 0},
+    {9001, 46, 0, 0},
+    {9001, 47, 0, 0},
+    {9001, 48, 0, 0},
+    {31, 49, 0, 0},
+    {14, 50, 0, 0},
+    {140, 51, 0, 0},
+    {14, 52, 0, 0},
+    {140, 53, 0, 0},
+    {31, 54, 0, 0},
+    {31, 55, 0, 0},
+    {114, 56, 0, 0},
+    {114, 57, 0, 0},
+    {114, 58, 0, 0},
+    {114, 59, 0, 0},
+    {8006, 60, 0, 0},
+    {31, 61, 0, 0},
+    {115, 62, 0, 0},
+    {116, 63, 0, 0},
+    {116, 64, 0, 0},
+    {54, 65, 0, 0},
+    {54, 66, 0, 0},
+    {103, 67, 0, 0},
+    {103, 68, 0, 0},
+    {103, 69, 0, 0},
+    {103, 70, 0, 0},
+    {54, 71, 0, 0},
+    {54, 72, 0, 0},
+    {54, 73, 0, 0},
+    {54, 74, 0, 0},
+    {54, 75, 0, 0},
+    {54, 76, 0, 0},
+    {77, 77, 0, 0},
+    {77, 78, 0, 0},
+    {77, 79, 0, 0},
+    {77, 80, 0, 0},
+    {103, 81, 0, 0},
+    {103, 82, 0, 0},
+    {103, 83, 0, 0},
+    {54, 84, 0, 0},
+    {54, 85, 0, 0},
+    {5, 86, 0, 0},
+    {111, 87, 0, 0},
+    {111, 88, 0, 0},
+    {111, 89, 0, 0},
+    {111, 90, 0, 0},
+    {71, 91, 0, 0},
+    {71, 92, 0, 0},
+    {71, 93, 0, 0},
+    {71, 94, 0, 0},
+    {71, 95, 0, 0},
+    {61, 96, 0, 0},
+    {61, 97, 0, 0},
+    {108, 98, 0, 0},
+    {108, 99, 0, 0},
+    {108, 100, 0, 0},
+    {108, 101, 0, 0},
+    {109, 102, 0, 0},
+    {109, 103, 0, 0},
+    {109, 104, 0, 0},
+    {109, 105, 0, 0},
+    {109, 106, 0, 0},
+    {110, 107, 0, 0},
+    {110, 108, 0, 0},
+    {110, 109, 0, 0},
+    {62, 110, 0, 0},
+    {104, 111, 0, 0},
+    {106, 112, 0, 0},
+    {105, 113, 0, 0},
+    {105, 114, 0, 0},
+    {104, 115, 0, 0},
+    {103, 116, 0, 0},
+    {103, 117, 0, 0},
+    {10110, 118, 0, 0},
+    {36, 119, 0, 0},
+    {8000, 120, 0, 0},
+    {8000, 121, 0, 0},
+    {8000, 122, 0, 0},
+    {8000, 123, 0, 0},
+    {8000, 124, 0, 0},
+    {8000, 125, 0, 0},
+    {8000, 126, 0, 0},
+    {8000, 127, 0, 0},
+    {31, 128, 0, 0},
+    {10030, 129, 0, 0},
+    {10030, 130, 0, 0},
+    {10030, 131, 0, 0},
+    {10030, 132, 0, 0},
+    {31, 133, 0, 0},
+    {31, 134, 0, 0},
+    {31, 135, 0, 0},
+    {31, 136, 0, 0},
+    {10060, 137, 0, 0},
+    {10060, 138, 0, 0},
+    {10060, 139, 0, 0},
+    {10060, 140, 0, 0},
+    {10060, 141, 0, 0},
+    {10060, 142, 0, 0},
+    {10060, 143, 0, 0},
+    {10060, 144, 0, 0},
+    {10030, 145, 0, 0},
+    {10030, 146, 0, 0},
+    {10030, 147, 0, 0},
+    {10030, 148, 0, 0},
+    {10030, 149, 0, 0},
+    {10030, 150, 0, 0},
+    {10030, 151, 0, 0},
+    {10030, 152, 0, 0},
+    {10030, 153, 0, 0},
+    {10030, 154, 0, 0},
+    {10030, 155, 0, 0},
+    {10030, 156, 0, 0},
+    {114, 157, 0, 0},
+    {114, 158, 0, 0},
+    {114, 159, 0, 0},
+    {115, 160, 0, 0},
+    {115, 161, 0, 0},
+    {31, 162, 0, 0},
+    {10030, 163, 0, 0},
+    {10030, 164, 0, 0},
+    {10030, 165, 0, 0},
+    {10030, 166, 0, 0},
+    {10030, 167, 0, 0},
+    {11, 168, 0, 0},
+    {11, 169, 0, 0},
+    {11, 170, 0, 0},
+    {11, 171, 0, 0},
+    {10110, 172, 0, 0},
+    {10110, 173, 0, 0},
+    {10110, 174, 0, 0},
+    {10110, 175, 0, 0},
+    {8000, 176, 0, 0},
+    {8000, 177, 0, 0},
+    {8000, 178, 0, 0},
+    {8000, 179, 0, 0},
+    {8000, 180, 0, 0},
+    {81, 181, 0, 0},
+    {81, 182, 0, 0},
+    {81, 183, 0, 0},
+    {81, 184, 0, 0},
+    {81, 185, 0, 0},
+    {81, 186, 0, 0},
+    {124, 187, 0, 0},
+    {124, 188, 0, 0},
+    {124, 189, 0, 0},
+    {122, 190, 0, 0},
+    {122, 191, 0, 0},
+    {122, 192, 0, 0},
+    {33, 193, 0, 0},
+    {82, 194, 0, 0},
+    {21, 195, 0, 0},
+    {81, 196, 0, 0},
+    {81, 197, 0, 0},
+    {81, 198, 0, 0},
+    {81, 199, 0, 0},
+    {81, 200, 0, 0},
+    {81, 201, 0, 0},
+    {81, 202, 0, 0},
+    {81, 203, 0, 0},
+    {81, 204, 0, 0},
+    {81, 205, 0, 0},
+    {81, 206, 0, 0},
+    {81, 207, 0, 0},
+    {82, 208, 0, 0},
+    {122, 209, 0, 0},
+    {122, 210, 0, 0},
+    {124, 211, 0, 0},
+    {124, 212, 0, 0},
+    {124, 213, 0, 0},
+    {124, 214, 0, 0},
+    {122, 215, 0, 0},
+    {122, 216, 0, 0},
+    {30, 217, 0, 0},
+    {81, 218, 0, 0},
+    {81, 219, 0, 0},
+    {81, 220, 0, 0},
+    {8004, 221, 0, 0},
+    {10060, 222, 0, 0},
+    {10060, 223, 0, 0},
+    {10060, 224, 0, 0},
+    {10060, 225, 0, 0},
+    {2, 226, 0, 0},
+    {3, 227, 0, 0},
+    {4, 228, 0, 0},
+    {8007, 229, 0, 0},
+    {8005, 230, 0, 0},
+    {8008, 231, 0, 0},
+    {83, 232, 0, 0},
+    {123, 233, 0, 0},
+    {8010, 234, 0, 0},
+    {10, 235, 0, 0},
+    {53, 236, 0, 0},
+    {8009, 237, 0, 0},
+    {8040, 238, 0, 0},
+    {9001, 239, 0, 0},
+    {9001, 240, 0, 0},
+    {9001, 241, 0, 0},
+    {9001, 242, 0, 0},
+    {9001, 243, 0, 0},
+    {10060, 244, 0, 0},
+    {10060, 245, 0, 0},
+    {10060, 246, 0, 0},
+    {10060, 247, 0, 0},
+    {31, 248, 0, 0},
+    {31, 249, 0, 0},
+    {10030, 250, 0, 0},
+    {10030, 251, 0, 0},
+    {10030, 252, 0, 0},
+    {10030, 253, 0, 0},
+    {31, 254, 0, 0},
+    {31, 255, 0, 0},
+    {31, 256, 0, 0},
+    {10060, 257, 0, 0},
+    {10060, 258, 0, 0},
+    {10060, 259, 0, 0},
+    {10060, 260, 0, 0},
+    {10060, 261, 0, 0},
+    {10060, 262, 0, 0},
+    {10060, 263, 0, 0},
+    {10060, 264, 0, 0},
+    {82, 265, 0, 0},
+    {84, 266, 0, 0},
+    {84, 267, 0, 0},
+    {10120, 268, 0, 0},
+    {10120, 269, 0, 0},
+    {10120, 270, 0, 0},
+    {122, 271, 0, 0},
+    {122, 272, 0, 0},
+    {122, 273, 0, 0},
+    {122, 274, 0, 0},
+    {122, 275, 0, 0},
+    {122, 276, 0, 0},
+    {122, 277, 0, 0},
+    {122, 278, 0, 0},
+    {122, 279, 0, 0},
+    {122, 280, 0, 0},
+    {122, 281, 0, 0},
+    {124, 282, 0, 0},
+    {124, 283, 0, 0},
+    {124, 284, 0, 0},
+    {124, 285, 0, 0},
+    {124, 286, 0, 0},
+    {124, 287, 0, 0},
+    {124, 288, 0, 0},
+    {124, 289, 0, 0},
+    {124, 290, 0, 0},
+    {124, 291, 0, 0},
+    {11, 292, 0, 0},
+    {11, 293, 0, 0},
+    {11, 294, 0, 0},
+    {11, 295, 0, 0},
+    {9100, 296, 0, 0},
+    {9101, 297, 0, 0},
+    {9102, 298, 0, 0},
+    {9103, 299, 0, 0},
+    // Deathwind Chapel
+    {1, 0, 0, 0},
+    {14, 1, 0, 0},
+    {117, 2, 0, 0},
+    {117, 3, 0, 0},
+    {117, 4, 0, 0},
+    {117, 5, 0, 0},
+    {55, 6, 0, 0},
+    {55, 7, 0, 0},
+    {55, 8, 0, 0},
+    {55, 9, 0, 0},
+    {54, 10, 0, 0},
+    {54, 11, 0, 0},
+    {54, 12, 0, 0},
+    {54, 13, 0, 0},
+    {54, 14, 0, 0},
+    {54, 15, 0, 0},
+    {54, 16, 0, 0},
+    {54, 17, 0, 0},
+    {54, 18, 0, 0},
+    {54, 19, 0, 0},
+    {54, 20, 0, 0},
+    {54, 21, 0, 0},
+    {54, 22, 0, 0},
+    {54, 23, 0, 0},
+    {54, 24, 0, 0},
+    {54, 25, 0, 0},
+    {9001, 26, 0, 0},
+    {9001, 27, 0, 0},
+    {9001, 28, 0, 0},
+    {9001, 29, 0, 0},
+    {9001, 30, 0, 0},
+    {9001, 31, 0, 0},
+    {140, 32, 0, 0},
+    {140, 33, 0, 0},
+    {5, 34, 0, 0},
+    {140, 35, 0, 0},
+    {14, 36, 0, 0},
+    {140, 37, 0, 0},
+    {9001, 38, 0, 0},
+    {3002, 39, 0, 0},
+    {3002, 40, 0, 0},
+    {3002, 41, 0, 0},
+    {3002, 42, 0, 0},
+    {3002, 43, 0, 0},
+    {3002, 44, 0, 0},
+    {3002, 45, 0, 0},
+    {3002, 46, 0, 0},
+    {3000, 47, 0, 0},
+    {3000, 48, 0, 0},
+    {3000, 49, 0, 0},
+    {3000, 50, 0, 0},
+    {3000, 51, 0, 0},
+    {3000, 52, 0, 0},
+    {3000, 53, 0, 0},
+    {3000, 54, 0, 0},
+    {55, 55, 0, 0},
+    {55, 56, 0, 0},
+    {55, 57, 0, 0},
+    {55, 58, 0, 0},
+    {55, 59, 0, 0},
+    {55, 60, 0, 0},
+    {106, 61, 0, 0},
+    {106, 62, 0, 0},
+    {105, 63, 0, 0},
+    {105, 64, 0, 0},
+    {106, 65, 0, 0},
+    {104, 66, 0, 0},
+    {105, 67, 0, 0},
+    {100, 68, 0, 0},
+    {101, 69, 0, 0},
+    {102, 70, 0, 0},
+    {14, 71, 0, 0},
+    {14, 72, 0, 0},
+    {8003, 73, 0, 0},
+    {8007, 74, 0, 0},
+    {8000, 75, 0, 0},
+    {8000, 76, 0, 0},
+    {8000, 77, 0, 0},
+    {8000, 78, 0, 0},
+    {8000, 79, 0, 0},
+    {8000, 80, 0, 0},
+    {8000, 81, 0, 0},
+    {8000, 82, 0, 0},
+    {10, 83, 0, 0},
+    {8009, 84, 0, 0},
+    {8010, 85, 0, 0},
+    {123, 86, 0, 0},
+    {53, 87, 0, 0},
+    {8040, 88, 0, 0},
+    {107, 89, 0, 0},
+    {107, 90, 0, 0},
+    {107, 91, 0, 0},
+    {107, 92, 0, 0},
+    {107, 93, 0, 0},
+    {107, 94, 0, 0},
+    {107, 95, 0, 0},
+    {107, 96, 0, 0},
+    {107, 97, 0, 0},
+    {115, 98, 0, 0},
+    {115, 99, 0, 0},
+    {115, 100, 0, 0},
+    {114, 101, 0, 0},
+    {114, 102, 0, 0},
+    {114, 103, 0, 0},
+    {114, 104, 0, 0},
+    {10060, 105, 0, 0},
+    {10060, 106, 0, 0},
+    {10060, 107, 0, 0},
+    {10060, 108, 0, 0},
+    {10060, 109, 0, 0},
+    {10060, 110, 0, 0},
+    {10060, 111, 0, 0},
+    {10060, 112, 0, 0},
+    {10060, 113, 0, 0},
+    {10060, 114, 0, 0},
+    {10060, 115, 0, 0},
+    {10060, 116, 0, 0},
+    {115, 117, 0, 0},
+    {115, 118, 0, 0},
+    {114, 119, 0, 0},
+    {114, 120, 0, 0},
+    {114, 121, 0, 0},
+    {114, 122, 0, 0},
+    {114, 123, 0, 0},
+    {114, 124, 0, 0},
+    {114, 125, 0, 0},
+    {114, 126, 0, 0},
+    {114, 127, 0, 0},
+    {107, 128, 0, 0},
+    {10030, 129, 0, 0},
+    {10030, 130, 0, 0},
+    {10030, 131, 0, 0},
+    {10030, 132, 0, 0},
+    {10030, 133, 0, 0},
+    {10030, 134, 0, 0},
+    {114, 135, 0, 0},
+    {114, 136, 0, 0},
+    {114, 137, 0, 0},
+    {114, 138, 0, 0},
+    {114, 139, 0, 0},
+    {114, 140, 0, 0},
+    {114, 141, 0, 0},
+    {114, 142, 0, 0},
+    {114, 143, 0, 0},
+    {114, 144, 0, 0},
+    {114, 145, 0, 0},
+    {114, 146, 0, 0},
+    {114, 147, 0, 0},
+    {114, 148, 0, 0},
+    {114, 149, 0, 0},
+    {81, 150, 0, 0},
+    {81, 151, 0, 0},
+    {81, 152, 0, 0},
+    {81, 153, 0, 0},
+    {81, 154, 0, 0},
+    {81, 155, 0, 0},
+    {122, 156, 0, 0},
+    {122, 157, 0, 0},
+    {122, 158, 0, 0},
+    {122, 159, 0, 0},
+    {124, 160, 0, 0},
+    {124, 161, 0, 0},
+    {124, 162, 0, 0},
+    {124, 163, 0, 0},
+    {8004, 164, 0, 0},
+    {81, 165, 0, 0},
+    {81, 166, 0, 0},
+    {82, 167, 0, 0},
+    {82, 168, 0, 0},
+    {81, 169, 0, 0},
+    {81, 170, 0, 0},
+    {81, 171, 0, 0},
+    {81, 172, 0, 0},
+    {8004, 173, 0, 0},
+    {82, 174, 0, 0},
+    {82, 175, 0, 0},
+    {122, 176, 0, 0},
+    {124, 177, 0, 0},
+    {124, 178, 0, 0},
+    {124, 179, 0, 0},
+    {122, 180, 0, 0},
+    {122, 181, 0, 0},
+    {81, 182, 0, 0},
+    {81, 183, 0, 0},
+    {81, 184, 0, 0},
+    {81, 185, 0, 0},
+    {81, 186, 0, 0},
+    {81, 187, 0, 0},
+    {81, 188, 0, 0},
+    {81, 189, 0, 0},
+    {122, 190, 0, 0},
+    {122, 191, 0, 0},
+    {124, 192, 0, 0},
+    {124, 193, 0, 0},
+    {10110, 194, 0, 0},
+    {10110, 195, 0, 0},
+    {10110, 196, 0, 0},
+    {10110, 197, 0, 0},
+    {10110, 198, 0, 0},
+    {10110, 199, 0, 0},
+    {10110, 200, 0, 0},
+    {10110, 201, 0, 0},
+    {81, 202, 0, 0},
+    {81, 203, 0, 0},
+    {2, 204, 0, 0},
+    {3, 205, 0, 0},
+    {4, 206, 0, 0},
+    {11, 207, 0, 0},
+    {11, 208, 0, 0},
+    {11, 209, 0, 0},
+    {11, 210, 0, 0},
+    {10, 211, 0, 0},
+    {8010, 212, 0, 0},
+    {53, 213, 0, 0},
+    {8009, 214, 0, 0},
+    {123, 215, 0, 0},
+    {8040, 216, 0, 0},
+    {20, 217, 0, 0},
+    {16, 218, 0, 0},
+    {23, 219, 0, 0},
+    {19, 220, 0, 0},
+    {13, 221, 0, 0},
+    {22, 222, 0, 0},
+    {12, 223, 0, 0},
+    {18, 224, 0, 0},
+    {21, 225, 0, 0},
+    {8008, 226, 0, 0},
+    {8005, 227, 0, 0},
+    {8003, 228, 0, 0},
+    {8002, 229, 0, 0},
+    {8041, 230, 0, 0},
+    {30, 231, 0, 0},
+    {32, 232, 0, 0},
+    {36, 233, 0, 0},
+    {86, 234, 0, 0},
+    {10040, 235, 0, 0},
+    {9001, 236, 0, 0},
+    {9001, 237, 0, 0},
+    {9001, 238, 0, 0},
+    {9001, 239, 0, 0},
+    {9001, 240, 0, 0},
+    {114, 241, 0, 0},
+    {114, 242, 0, 0},
+    {114, 243, 0, 0},
+    {10030, 244, 0, 0},
+    {10030, 245, 0, 0},
+    {10030, 246, 0, 0},
+    {10030, 247, 0, 0},
+    {114, 248, 0, 0},
+    {114, 249, 0, 0},
+    {114, 250, 0, 0},
+    {114, 251, 0, 0},
+    {10060, 252, 0, 0},
+    {10060, 253, 0, 0},
+    {114, 254, 0, 0},
+    {10060, 255, 0, 0},
+    {107, 256, 0, 0},
+    {107, 257, 0, 0},
+    {84, 258, 0, 0},
+    {84, 259, 0, 0},
+    {10120, 260, 0, 0},
+    {10120, 261, 0, 0},
+    {10120, 262, 0, 0},
+    {10120, 263, 0, 0},
+    {122, 264, 0, 0},
+    {122, 265, 0, 0},
+    {122, 266, 0, 0},
+    {122, 267, 0, 0},
+    {122, 268, 0, 0},
+    {122, 269, 0, 0},
+    {122, 270, 0, 0},
+    {122, 271, 0, 0},
+    {122, 272, 0, 0},
+    {122, 273, 0, 0},
+    {122, 274, 0, 0},
+    {122, 275, 0, 0},
+    {11, 276, 0, 0},
+    {11, 277, 0, 0},
+    {11, 278, 0, 0},
+    {11, 279, 0, 0},
+    {9100, 280, 0, 0},
+    {9101, 281, 0, 0},
+    {9102, 282, 0, 0},
+    {9103, 283, 0, 0},
+    // Orchard of Lamentations
+    {1, 0, 0, 0},
+    {14, 1, 0, 0},
+    {14, 2, 0, 0},
+    {14, 3, 0, 0},
+    {14, 4, 0, 0},
+    {9010, 5, 0, 0},
+    {9009, 6, 0, 0},
+    {8100, 7, 0, 0},
+    {8100, 8, 0, 0},
+    {8100, 9, 0, 0},
+    {8100, 10, 0, 0},
+    {8100, 11, 0, 0},
+    {8100, 12, 0, 0},
+    {8100, 13, 0, 0},
+    {8100, 14, 0, 0},
+    {8100, 15, 0, 0},
+    {8100, 16, 0, 0},
+    {8100, 17, 0, 0},
+    {8100, 18, 0, 0},
+    {8100, 19, 0, 0},
+    {8100, 20, 0, 0},
+    {6, 21, 0, 0},
+    {6, 22, 0, 0},
+    {6, 23, 0, 0},
+    {7, 24, 0, 0},
+    {7, 25, 0, 0},
+    {7, 26, 0, 0},
+    {9, 27, 0, 0},
+    {9, 28, 0, 0},
+    {9, 29, 0, 0},
+    {15, 30, 0, 0},
+    {15, 31, 0, 0},
+    {8104, 32, 0, 0},
+    {8104, 33, 0, 0},
+    {8104, 34, 0, 0},
+    {8104, 35, 0, 0},
+    {8104, 36, 0, 0},
+    {8104, 37, 0, 0},
+    {39, 38, 0, 0},
+    {39, 39, 0, 0},
+    {39, 40, 0, 0},
+    {39, 41, 0, 0},
+    {39, 42, 0, 0},
+    {40, 43, 0, 0},
+    {40, 44, 0, 0},
+    {46, 45, 0, 0},
+    {29, 46, 0, 0},
+    {29, 47, 0, 0},
+    {29, 48, 0, 0},
+    {29, 49, 0, 0},
+    {28, 50, 0, 0},
+    {28, 51, 0, 0},
+    {28, 52, 0, 0},
+    {29, 53, 0, 0},
+    {29, 54, 0, 0},
+    {29, 55, 0, 0},
+    {29, 56, 0, 0},
+    {29, 57, 0, 0},
+    {28, 58, 0, 0},
+    {28, 59, 0, 0},
+    {80, 60, 0, 0},
+    {87, 61, 0, 0},
+    {8008, 62, 0, 0},
+    {30, 63, 0, 0},
+    {10110, 64, 0, 0},
+    {8000, 65, 0, 0},
+    {8000, 66, 0, 0},
+    {8000, 67, 0, 0},
+    {8000, 68, 0, 0},
+    {8000, 69, 0, 0},
+    {8000, 70, 0, 0},
+    {8000, 71, 0, 0},
+    {8000, 72, 0, 0},
+    {8000, 73, 0, 0},
+    {8000, 74, 0, 0},
+    {8000, 75, 0, 0},
+    {8000, 76, 0, 0},
+    {8000, 77, 0, 0},
+    {8000, 78, 0, 0},
+    {8000, 79, 0, 0},
+    {8000, 80, 0, 0},
+    {8000, 81, 0, 0},
+    {10030, 82, 0, 0},
+    {10030, 83, 0, 0},
+    {10030, 84, 0, 0},
+    {10030, 85, 0, 0},
+    {10030, 86, 0, 0},
+    {10030, 87, 0, 0},
+    {10030, 88, 0, 0},
+    {10030, 89, 0, 0},
+    {10030, 90, 0, 0},
+    {10030, 91, 0, 0},
+    {114, 92, 0, 0},
+    {114, 93, 0, 0},
+    {114, 94, 0, 0},
+    {114, 95, 0, 0},
+    {107, 96, 0, 0},
+    {107, 97, 0, 0},
+    {107, 98, 0, 0},
+    {107, 99, 0, 0},
+    {115, 100, 0, 0},
+    {115, 101, 0, 0},
+    {10030, 102, 0, 0},
+    {10030, 103, 0, 0},
+    {10030, 104, 0, 0},
+    {10030, 105, 0, 0},
+    {10030, 106, 0, 0},
+    {10030, 107, 0, 0},
+    {115, 108, 0, 0},
+    {115, 109, 0, 0},
+    {115, 110, 0, 0},
+    {115, 111, 0, 0},
+    {120, 112, 0, 0},
+    {120, 113, 0, 0},
+    {10030, 114, 0, 0},
+    {10030, 115, 0, 0},
+    {10030, 116, 0, 0},
+    {10030, 117, 0, 0},
+    {10030, 118, 0, 0},
+    {10030, 119, 0, 0},
+    {10030, 120, 0, 0},
+    {10030, 121, 0, 0},
+    {10030, 122, 0, 0},
+    {10030, 123, 0, 0},
+    {107, 124, 0, 0},
+    {107, 125, 0, 0},
+    {107, 126, 0, 0},
+    {107, 127, 0, 0},
+    {107, 128, 0, 0},
+    {121, 129, 0, 0},
+    {10030, 130, 0, 0},
+    {10030, 131, 0, 0},
+    {10030, 132, 0, 0},
+    {10030, 133, 0, 0},
+    {8010, 134, 0, 0},
+    {10, 135, 0, 0},
+    {53, 136, 0, 0},
+    {11, 137, 0, 0},
+    {11, 138, 0, 0},
+    {11, 139, 0, 0},
+    {11, 140, 0, 0},
+    {8004, 141, 0, 0},
+    {122, 142, 0, 0},
+    {122, 143, 0, 0},
+    {122, 144, 0, 0},
+    {122, 145, 0, 0},
+    {124, 146, 0, 0},
+    {124, 147, 0, 0},
+    {124, 148, 0, 0},
+    {124, 149, 0, 0},
+    {81, 150, 0, 0},
+    {81, 151, 0, 0},
+    {81, 152, 0, 0},
+    {81, 153, 0, 0},
+    {81, 154, 0, 0},
+    {81, 155, 0, 0},
+    {81, 156, 0, 0},
+    {81, 157, 0, 0},
+    {81, 158, 0, 0},
+    {81, 159, 0, 0},
+    {81, 160, 0, 0},
+    {81, 161, 0, 0},
+    {10110, 162, 0, 0},
+    {10110, 163, 0, 0},
+    {10110, 164, 0, 0},
+    {10110, 165, 0, 0},
+    {10110, 166, 0, 0},
+    {10110, 167, 0, 0},
+    {10110, 168, 0, 0},
+    {10110, 169, 0, 0},
+    {10110, 170, 0, 0},
+    {10110, 171, 0, 0},
+    {10110, 172, 0, 0},
+    {10110, 173, 0, 0},
+    {10110, 174, 0, 0},
+    {10110, 175, 0, 0},
+    {82, 176, 0, 0},
+    {82, 177, 0, 0},
+    {82, 178, 0, 0},
+    {82, 179, 0, 0},
+    {2, 180, 0, 0},
+    {3, 181, 0, 0},
+    {4, 182, 0, 0},
+    {8005, 183, 0, 0},
+    {8041, 184, 0, 0},
+    {8007, 185, 0, 0},
+    {8006, 186, 0, 0},
+    {8009, 187, 0, 0},
+    {123, 188, 0, 0},
+    {8040, 189, 0, 0},
+    {83, 190, 0, 0},
+    {9001, 191, 0, 0},
+    {9001, 192, 0, 0},
+    {9001, 193, 0, 0},
+    {9001, 194, 0, 0},
+    {9001, 195, 0, 0},
+    {114, 196, 0, 0},
+    {114, 197, 0, 0},
+    {114, 198, 0, 0},
+    {114, 199, 0, 0},
+    {10030, 200, 0, 0},
+    {10030, 201, 0, 0},
+    {10030, 202, 0, 0},
+    {10030, 203, 0, 0},
+    {107, 204, 0, 0},
+    {107, 205, 0, 0},
+    {10030, 206, 0, 0},
+    {10030, 207, 0, 0},
+    {10030, 208, 0, 0},
+    {10030, 209, 0, 0},
+    {10030, 210, 0, 0},
+    {10030, 211, 0, 0},
+    {10030, 212, 0, 0},
+    {10030, 213, 0, 0},
+    {10030, 214, 0, 0},
+    {10030, 215, 0, 0},
+    {10030, 216, 0, 0},
+    {10030, 217, 0, 0},
+    {10030, 218, 0, 0},
+    {10030, 219, 0, 0},
+    {107, 220, 0, 0},
+    {107, 221, 0, 0},
+    {10030, 222, 0, 0},
+    {10060, 223, 0, 0},
+    {10060, 224, 0, 0},
+    {10060, 225, 0, 0},
+    {10060, 226, 0, 0},
+    {10060, 227, 0, 0},
+    {10060, 228, 0, 0},
+    {31, 229, 0, 0},
+    {31, 230, 0, 0},
+    {84, 231, 0, 0},
+    {84, 232, 0, 0},
+    {10120, 233, 0, 0},
+    {10120, 234, 0, 0},
+    {122, 235, 0, 0},
+    {122, 236, 0, 0},
+    {122, 237, 0, 0},
+    {122, 238, 0, 0},
+    {122, 239, 0, 0},
+    {122, 240, 0, 0},
+    {122, 241, 0, 0},
+    {122, 242, 0, 0},
+    {122, 243, 0, 0},
+    {124, 244, 0, 0},
+    {124, 245, 0, 0},
+    {124, 246, 0, 0},
+    {124, 247, 0, 0},
+    {124, 248, 0, 0},
+    {124, 249, 0, 0},
+    {124, 250, 0, 0},
+    {124, 251, 0, 0},
+    {124, 252, 0, 0},
+    {124, 253, 0, 0},
+    {124, 254, 0, 0},
+    {122, 255, 0, 0},
+    {122, 256, 0, 0},
+    {122, 257, 0, 0},
+    {9100, 258, 0, 0},
+    {9101, 259, 0, 0},
+    {9102, 260, 0, 0},
+    {9103, 261, 0, 0},
+    {11, 262, 0, 0},
+    {11, 263, 0, 0},
+    {11, 264, 0, 0},
+    {11, 265, 0, 0},
+    // Silent Refectory
+    {1, 0, 0, 0},
+    {14, 1, 0, 0},
+    {3001, 2, 0, 0},
+    {3000, 3, 0, 0},
+    {3001, 4, 0, 0},
+    {3000, 5, 0, 0},
+    {3001, 6, 0, 0},
+    {3000, 7, 0, 0},
+    {55, 8, 0, 0},
+    {55, 9, 0, 0},
+    {55, 10, 0, 0},
+    {55, 11, 0, 0},
+    {55, 12, 0, 0},
+    {55, 13, 0, 0},
+    {55, 14, 0, 0},
+    {55, 15, 0, 0},
+    {55, 16, 0, 0},
+    {55, 17, 0, 0},
+    {55, 18, 0, 0},
+    {9006, 19, 0, 0},
+    {9005, 20, 0, 0},
+    {9004, 21, 0, 0},
+    {8100, 22, 0, 0},
+    {8100, 23, 0, 0},
+    {8100, 24, 0, 0},
+    {8100, 25, 0, 0},
+    {8100, 26, 0, 0},
+    {8100, 27, 0, 0},
+    {8100, 28, 0, 0},
+    {100, 29, 0, 0},
+    {101, 30, 0, 0},
+    {102, 31, 0, 0},
+    {101, 32, 0, 0},
+    {100, 33, 0, 0},
+    {101, 34, 0, 0},
+    {101, 35, 0, 0},
+    {101, 36, 0, 0},
+    {100, 37, 0, 0},
+    {100, 38, 0, 0},
+    {102, 39, 0, 0},
+    {102, 40, 0, 0},
+    {106, 41, 0, 0},
+    {106, 42, 0, 0},
+    {105, 43, 0, 0},
+    {105, 44, 0, 0},
+    {104, 45, 0, 0},
+    {104, 46, 0, 0},
+    {104, 47, 0, 0},
+    {105, 48, 0, 0},
+    {106, 49, 0, 0},
+    {55, 50, 0, 0},
+    {55, 51, 0, 0},
+    {55, 52, 0, 0},
+    {55, 53, 0, 0},
+    {55, 54, 0, 0},
+    {55, 55, 0, 0},
+    {55, 56, 0, 0},
+    {55, 57, 0, 0},
+    {9001, 58, 0, 0},
+    {9001, 59, 0, 0},
+    {9001, 60, 0, 0},
+    {9001, 61, 0, 0},
+    {17, 62, 0, 0},
+    {17, 63, 0, 0},
+    {8063, 64, 0, 0},
+    {8063, 65, 0, 0},
+    {8063, 66, 0, 0},
+    {8063, 67, 0, 0},
+    {8063, 68, 0, 0},
+    {8063, 69, 0, 0},
+    {30, 70, 0, 0},
+    {8005, 71, 0, 0},
+    {123, 72, 0, 0},
+    {8009, 73, 0, 0},
+    {8040, 74, 0, 0},
+    {114, 75, 0, 0},
+    {114, 76, 0, 0},
+    {114, 77, 0, 0},
+    {114, 78, 0, 0},
+    {114, 79, 0, 0},
+    {114, 80, 0, 0},
+    {114, 81, 0, 0},
+    {114, 82, 0, 0},
+    {114, 83, 0, 0},
+    {114, 84, 0, 0},
+    {114, 85, 0, 0},
+    {114, 86, 0, 0},
+    {114, 87, 0, 0},
+    {115, 88, 0, 0},
+    {107, 89, 0, 0},
+    {107, 90, 0, 0},
+    {114, 91, 0, 0},
+    {114, 92, 0, 0},
+    {114, 93, 0, 0},
+    {114, 94, 0, 0},
+    {114, 95, 0, 0},
+    {114, 96, 0, 0},
+    {114, 97, 0, 0},
+    {114, 98, 0, 0},
+    {114, 99, 0, 0},
+    {114, 100, 0, 0},
+    {114, 101, 0, 0},
+    {114, 102, 0, 0},
+    {114, 103, 0, 0},
+    {114, 104, 0, 0},
+    {114, 105, 0, 0},
+    {114, 106, 0, 0},
+    {114, 107, 0, 0},
+    {114, 108, 0, 0},
+    {114, 109, 0, 0},
+    {114, 110, 0, 0},
+    {114, 111, 0, 0},
+    {114, 112, 0, 0},
+    {114, 113, 0, 0},
+    {114, 114, 0, 0},
+    {114, 115, 0, 0},
+    {114, 116, 0, 0},
+    {114, 117, 0, 0},
+    {114, 118, 0, 0},
+    {114, 119, 0, 0},
+    {10030, 120, 0, 0},
+    {10030, 121, 0, 0},
+    {10030, 122, 0, 0},
+    {10030, 123, 0, 0},
+    {10030, 124, 0, 0},
+    {10110, 125, 0, 0},
+    {10110, 126, 0, 0},
+    {10110, 127, 0, 0},
+    {10110, 128, 0, 0},
+    {10110, 129, 0, 0},
+    {10110, 130, 0, 0},
+    {33, 131, 0, 0},
+    {8000, 132, 0, 0},
+    {8000, 133, 0, 0},
+    {8000, 134, 0, 0},
+    {8000, 135, 0, 0},
+    {8000, 136, 0, 0},
+    {8000, 137, 0, 0},
+    {81, 138, 0, 0},
+    {81, 139, 0, 0},
+    {81, 140, 0, 0},
+    {81, 141, 0, 0},
+    {81, 142, 0, 0},
+    {81, 143, 0, 0},
+    {81, 144, 0, 0},
+    {81, 145, 0, 0},
+    {124, 146, 0, 0},
+    {124, 147, 0, 0},
+    {124, 148, 0, 0},
+    {124, 149, 0, 0},
+    {122, 150, 0, 0},
+    {122, 151, 0, 0},
+    {122, 152, 0, 0},
+    {122, 153, 0, 0},
+    {122, 154, 0, 0},
+    {122, 155, 0, 0},
+    {10040, 156, 0, 0},
+    {81, 157, 0, 0},
+    {81, 158, 0, 0},
+    {81, 159, 0, 0},
+    {81, 160, 0, 0},
+    {81, 161, 0, 0},
+    {82, 162, 0, 0},
+    {82, 163, 0, 0},
+    {2, 164, 0, 0},
+    {3, 165, 0, 0},
+    {4, 166, 0, 0},
+    {8502, 167, 0, 0},
+    {8502, 168, 0, 0},
+    {8509, 169, 0, 0},
+    {8508, 170, 0, 0},
+    {8508, 171, 0, 0},
+    {8508, 172, 0, 0},
+    {8507, 173, 0, 0},
+    {8507, 174, 0, 0},
+    {8507, 175, 0, 0},
+    {8505, 176, 0, 0},
+    {8506, 177, 0, 0},
+    {8505, 178, 0, 0},
+    {8505, 179, 0, 0},
+    {8506, 180, 0, 0},
+    {8500, 181, 0, 0},
+    {8501, 182, 0, 0},
+    {9001, 183, 0, 0},
+    {9001, 184, 0, 0},
+    {9001, 185, 0, 0},
+    {9001, 186, 0, 0},
+    {9001, 187, 0, 0},
+    {11, 188, 0, 0},
+    {11, 189, 0, 0},
+    {11, 190, 0, 0},
+    {11, 191, 0, 0},
+    {10, 192, 0, 0},
+    {8010, 193, 0, 0},
+    {53, 194, 0, 0},
+    {8009, 195, 0, 0},
+    {123, 196, 0, 0},
+    {8040, 197, 0, 0},
+    {20, 198, 0, 0},
+    {16, 199, 0, 0},
+    {23, 200, 0, 0},
+    {19, 201, 0, 0},
+    {22, 202, 0, 0},
+    {13, 203, 0, 0},
+    {12, 204, 0, 0},
+    {21, 205, 0, 0},
+    {18, 206, 0, 0},
+    {8003, 207, 0, 0},
+    {8002, 208, 0, 0},
+    {8041, 209, 0, 0},
+    {32, 210, 0, 0},
+    {36, 211, 0, 0},
+    {10040, 212, 0, 0},
+    {8008, 213, 0, 0},
+    {8005, 214, 0, 0},
+    {8007, 215, 0, 0},
+    {8006, 216, 0, 0},
+    {114, 217, 0, 0},
+    {114, 218, 0, 0},
+    {114, 219, 0, 0},
+    {114, 220, 0, 0},
+    {114, 221, 0, 0},
+    {114, 222, 0, 0},
+    {114, 223, 0, 0},
+    {115, 224, 0, 0},
+    {114, 225, 0, 0},
+    {114, 226, 0, 0},
+    {114, 227, 0, 0},
+    {114, 228, 0, 0},
+    {114, 229, 0, 0},
+    {114, 230, 0, 0},
+    {114, 231, 0, 0},
+    {114, 232, 0, 0},
+    {114, 233, 0, 0},
+    {114, 234, 0, 0},
+    {114, 235, 0, 0},
+    {114, 236, 0, 0},
+    {114, 237, 0, 0},
+    {114, 238, 0, 0},
+    {114, 239, 0, 0},
+    {114, 240, 0, 0},
+    {10030, 241, 0, 0},
+    {10030, 242, 0, 0},
+    {10030, 243, 0, 0},
+    {10030, 244, 0, 0},
+    {81, 245, 0, 0},
+    {81, 246, 0, 0},
+    {81, 247, 0, 0},
+    {81, 248, 0, 0},
+    {81, 249, 0, 0},
+    {81, 250, 0, 0},
+    {8000, 251, 0, 0},
+    {8000, 252, 0, 0},
+    {8000, 253, 0, 0},
+    {8000, 254, 0, 0},
+    {8000, 255, 0, 0},
+    {8000, 256, 0, 0},
+    {8000, 257, 0, 0},
+    {122, 258, 0, 0},
+    {122, 259, 0, 0},
+    {122, 260, 0, 0},
+    {124, 261, 0, 0},
+    {124, 262, 0, 0},
+    {8004, 263, 0, 0},
+    {84, 264, 0, 0},
+    {84, 265, 0, 0},
+    {10120, 266, 0, 0},
+    {10120, 267, 0, 0},
+    {10120, 268, 0, 0},
+    {10120, 269, 0, 0},
+    {122, 270, 0, 0},
+    {122, 271, 0, 0},
+    {122, 272, 0, 0},
+    {122, 273, 0, 0},
+    {122, 274, 0, 0},
+    {122, 275, 0, 0},
+    {122, 276, 0, 0},
+    {124, 277, 0, 0},
+    {124, 278, 0, 0},
+    {124, 279, 0, 0},
+    {124, 280, 0, 0},
+    {124, 281, 0, 0},
+    {124, 282, 0, 0},
+    {124, 283, 0, 0},
+    {11, 284, 0, 0},
+    {11, 285, 0, 0},
+    {11, 286, 0, 0},
+    {11, 287, 0, 0},
+    {9100, 288, 0, 0},
+    {9101, 289, 0, 0},
+    {9102, 290, 0, 0},
+    {9103, 291, 0, 0},
+    // Wolf Chapel
+    {1, 0, 0, 0},
+    {9001, 1, 0, 0},
+    {9001, 2, 0, 0},
+    {9001, 3, 0, 0},
+    {9001, 4, 0, 0},
+    {9001, 5, 0, 0},
+    {9001, 6, 0, 0},
+    {9001, 7, 0, 0},
+    {9001, 8, 0, 0},
+    {9001, 9, 0, 0},
+    {9001, 10, 0, 0},
+    {9001, 11, 0, 0},
+    {9001, 12, 0, 0},
+    {9001, 13, 0, 0},
+    {9001, 14, 0, 0},
+    {9001, 15, 0, 0},
+    {9001, 16, 0, 0},
+    {55, 17, 0, 0},
+    {55, 18, 0, 0},
+    {55, 19, 0, 0},
+    {55, 20, 0, 0},
+    {8100, 21, 0, 0},
+    {8100, 22, 0, 0},
+    {8100, 23, 0, 0},
+    {8100, 24, 0, 0},
+    {8100, 25, 0, 0},
+    {8100, 26, 0, 0},
+    {8100, 27, 0, 0},
+    {8100, 28, 0, 0},
+    {8100, 29, 0, 0},
+    {8100, 30, 0, 0},
+    {8100, 31, 0, 0},
+    {8100, 32, 0, 0},
+    {8100, 33, 0, 0},
+    {8100, 34, 0, 0},
+    {8100, 35, 0, 0},
+    {8100, 36, 0, 0},
+    {8100, 37, 0, 0},
+    {9001, 38, 0, 0},
+    {9001, 39, 0, 0},
+    {9001, 40, 0, 0},
+    {9001, 41, 0, 0},
+    {18, 42, 0, 0},
+    {10040, 43, 0, 0},
+    {8041, 44, 0, 0},
+    {10110, 45, 0, 0},
+    {10110, 46, 0, 0},
+    {10110, 47, 0, 0},
+    {117, 48, 0, 0},
+    {117, 49, 0, 0},
+    {117, 50, 0, 0},
+    {117, 51, 0, 0},
+    {31, 52, 0, 0},
+    {31, 53, 0, 0},
+    {31, 54, 0, 0},
+    {31, 55, 0, 0},
+    {31, 56, 0, 0},
+    {31, 57, 0, 0},
+    {31, 58, 0, 0},
+    {31, 59, 0, 0},
+    {114, 60, 0, 0},
+    {114, 61, 0, 0},
+    {114, 62, 0, 0},
+    {114, 63, 0, 0},
+    {10030, 64, 0, 0},
+    {10030, 65, 0, 0},
+    {10030, 66, 0, 0},
+    {10030, 67, 0, 0},
+    {10030, 68, 0, 0},
+    {10030, 69, 0, 0},
+    {114, 70, 0, 0},
+    {114, 71, 0, 0},
+    {114, 72, 0, 0},
+    {114, 73, 0, 0},
+    {10030, 74, 0, 0},
+    {10030, 75, 0, 0},
+    {10030, 76, 0, 0},
+    {114, 77, 0, 0},
+    {114, 78, 0, 0},
+    {114, 79, 0, 0},
+    {114, 80, 0, 0},
+    {114, 81, 0, 0},
+    {114, 82, 0, 0},
+    {114, 83, 0, 0},
+    {114, 84, 0, 0},
+    {114, 85, 0, 0},
+    {114, 86, 0, 0},
+    {114, 87, 0, 0},
+    {10030, 88, 0, 0},
+    {10030, 89, 0, 0},
+    {10030, 90, 0, 0},
+    {10030, 91, 0, 0},
+    {23, 92, 0, 0},
+    {81, 93, 0, 0},
+    {81, 94, 0, 0},
+    {81, 95, 0, 0},
+    {81, 96, 0, 0},
+    {81, 97, 0, 0},
+    {81, 98, 0, 0},
+    {82, 99, 0, 0},
+    {82, 100, 0, 0},
+    {8004, 101, 0, 0},
+    {122, 102, 0, 0},
+    {122, 103, 0, 0},
+    {124, 104, 0, 0},
+    {124, 105, 0, 0},
+    {10030, 106, 0, 0},
+    {10030, 107, 0, 0},
+    {10030, 108, 0, 0},
+    {10030, 109, 0, 0},
+    {10030, 110, 0, 0},
+    {10030, 111, 0, 0},
+    {9001, 112, 0, 0},
+    {9001, 113, 0, 0},
+    {9001, 114, 0, 0},
+    {9001, 115, 0, 0},
+    {9001, 116, 0, 0},
+    {9001, 117, 0, 0},
+    {9001, 118, 0, 0},
+    {9001, 119, 0, 0},
+    {9001, 120, 0, 0},
+    {9001, 121, 0, 0},
+    {9001, 122, 0, 0},
+    {9001, 123, 0, 0},
+    {122, 124, 0, 0},
+    {107, 125, 0, 0},
+    {107, 126, 0, 0},
+    {115, 127, 0, 0},
+    {115, 128, 0, 0},
+    {114, 129, 0, 0},
+    {114, 130, 0, 0},
+    {114, 131, 0, 0},
+    {114, 132, 0, 0},
+    {114, 133, 0, 0},
+    {115, 134, 0, 0},
+    {115, 135, 0, 0},
+    {107, 136, 0, 0},
+    {107, 137, 0, 0},
+    {107, 138, 0, 0},
+    {107, 139, 0, 0},
+    {107, 140, 0, 0},
+    {107, 141, 0, 0},
+    {115, 142, 0, 0},
+    {107, 143, 0, 0},
+    {107, 144, 0, 0},
+    {107, 145, 0, 0},
+    {107, 146, 0, 0},
+    {115, 147, 0, 0},
+    {8004, 148, 0, 0},
+    {81, 149, 0, 0},
+    {81, 150, 0, 0},
+    {81, 151, 0, 0},
+    {81, 152, 0, 0},
+    {81, 153, 0, 0},
+    {81, 154, 0, 0},
+    {122, 155, 0, 0},
+    {122, 156, 0, 0},
+    {122, 157, 0, 0},
+    {122, 158, 0, 0},
+    {124, 159, 0, 0},
+    {124, 160, 0, 0},
+    {124, 161, 0, 0},
+    {124, 162, 0, 0},
+    {81, 163, 0, 0},
+    {81, 164, 0, 0},
+    {81, 165, 0, 0},
+    {81, 166, 0, 0},
+    {10501, 167, 0, 0},
+    {10501, 168, 0, 0},
+    {10503, 169, 0, 0},
+    {10503, 170, 0, 0},
+    {10503, 171, 0, 0},
+    {10503, 172, 0, 0},
+    {10503, 173, 0, 0},
+    {84, 174, 0, 0},
+    {122, 175, 0, 0},
+    {122, 176, 0, 0},
+    {122, 177, 0, 0},
+    {122, 178, 0, 0},
+    {82, 179, 0, 0},
+    {82, 180, 0, 0},
+    {8071, 181, 0, 0},
+    {8071, 182, 0, 0},
+    {8071, 183, 0, 0},
+    {8077, 184, 0, 0},
+    {8073, 185, 0, 0},
+    {8075, 186, 0, 0},
+    {8076, 187, 0, 0},
+    {8074, 188, 0, 0},
+    {8073, 189, 0, 0},
+    {8072, 190, 0, 0},
+    {122, 191, 0, 0},
+    {122, 192, 0, 0},
+    {122, 193, 0, 0},
+    {124, 194, 0, 0},
+    {124, 195, 0, 0},
+    {124, 196, 0, 0},
+    {81, 197, 0, 0},
+    {81, 198, 0, 0},
+    {81, 199, 0, 0},
+    {81, 200, 0, 0},
+    {81, 201, 0, 0},
+    {81, 202, 0, 0},
+    {10110, 203, 0, 0},
+    {10110, 204, 0, 0},
+    {10110, 205, 0, 0},
+    {10110, 206, 0, 0},
+    {10110, 207, 0, 0},
+    {10110, 208, 0, 0},
+    {10110, 209, 0, 0},
+    {10110, 210, 0, 0},
+    {122, 211, 0, 0},
+    {122, 212, 0, 0},
+    {122, 213, 0, 0},
+    {124, 214, 0, 0},
+    {124, 215, 0, 0},
+    {124, 216, 0, 0},
+    {8000, 217, 0, 0},
+    {8000, 218, 0, 0},
+    {8000, 219, 0, 0},
+    {8000, 220, 0, 0},
+    {8000, 221, 0, 0},
+    {8000, 222, 0, 0},
+    {8000, 223, 0, 0},
+    {8000, 224, 0, 0},
+    {8061, 225, 0, 0},
+    {8061, 226, 0, 0},
+    {116, 227, 0, 0},
+    {116, 228, 0, 0},
+    {116, 229, 0, 0},
+    {116, 230, 0, 0},
+    {116, 231, 0, 0},
+    {116, 232, 0, 0},
+    {116, 233, 0, 0},
+    {116, 234, 0, 0},
+    {116, 235, 0, 0},
+    {116, 236, 0, 0},
+    {116, 237, 0, 0},
+    {116, 238, 0, 0},
+    {9001, 239, 0, 0},
+    {9001, 240, 0, 0},
+    {9001, 241, 0, 0},
+    {9001, 242, 0, 0},
+    {9001, 243, 0, 0},
+    {9001, 244, 0, 0},
+    {9001, 245, 0, 0},
+    {9001, 246, 0, 0},
+    {9001, 247, 0, 0},
+    {9001, 248, 0, 0},
+    {9001, 249, 0, 0},
+    {9001, 250, 0, 0},
+    {2, 251, 0, 0},
+    {3, 252, 0, 0},
+    {4, 253, 0, 0},
+    {11, 254, 0, 0},
+    {11, 255, 0, 0},
+    {11, 256, 0, 0},
+    {11, 257, 0, 0},
+    {10, 258, 0, 0},
+    {8010, 259, 0, 0},
+    {53, 260, 0, 0},
+    {8009, 261, 0, 0},
+    {123, 262, 0, 0},
+    {8040, 263, 0, 0},
+    {20, 264, 0, 0},
+    {19, 265, 0, 0},
+    {13, 266, 0, 0},
+    {22, 267, 0, 0},
+    {23, 268, 0, 0},
+    {16, 269, 0, 0},
+    {18, 270, 0, 0},
+    {12, 271, 0, 0},
+    {21, 272, 0, 0},
+    {8008, 273, 0, 0},
+    {8005, 274, 0, 0},
+    {83, 275, 0, 0},
+    {8003, 276, 0, 0},
+    {8007, 277, 0, 0},
+    {30, 278, 0, 0},
+    {8006, 279, 0, 0},
+    {36, 280, 0, 0},
+    {10040, 281, 0, 0},
+    {33, 282, 0, 0},
+    {9001, 283, 0, 0},
+    {9001, 284, 0, 0},
+    {9001, 285, 0, 0},
+    {9001, 286, 0, 0},
+    {9001, 287, 0, 0},
+    {107, 288, 0, 0},
+    {107, 289, 0, 0},
+    {107, 290, 0, 0},
+    {107, 291, 0, 0},
+    {115, 292, 0, 0},
+    {114, 293, 0, 0},
+    {114, 294, 0, 0},
+    {114, 295, 0, 0},
+    {114, 296, 0, 0},
+    {114, 297, 0, 0},
+    {114, 298, 0, 0},
+    {114, 299, 0, 0},
+    {114, 300, 0, 0},
+    {10030, 301, 0, 0},
+    {10030, 302, 0, 0},
+    {107, 303, 0, 0},
+    {10030, 304, 0, 0},
+    {10030, 305, 0, 0},
+    {10030, 306, 0, 0},
+    {10030, 307, 0, 0},
+    {114, 308, 0, 0},
+    {115, 309, 0, 0},
+    {115, 310, 0, 0},
+    {115, 311, 0, 0},
+    {31, 312, 0, 0},
+    {31, 313, 0, 0},
+    {82, 314, 0, 0},
+    {82, 315, 0, 0},
+    {82, 316, 0, 0},
+    {82, 317, 0, 0},
+    {82, 318, 0, 0},
+    {82, 319, 0, 0},
+    {82, 320, 0, 0},
+    {82, 321, 0, 0},
+    {82, 322, 0, 0},
+    {82, 323, 0, 0},
+    {82, 324, 0, 0},
+    {124, 325, 0, 0},
+    {124, 326, 0, 0},
+    {124, 327, 0, 0},
+    {124, 328, 0, 0},
+    {8004, 329, 0, 0},
+    {8004, 330, 0, 0},
+    {122, 331, 0, 0},
+    {122, 332, 0, 0},
+    {122, 333, 0, 0},
+    {122, 334, 0, 0},
+    {122, 335, 0, 0},
+    {122, 336, 0, 0},
+    {124, 337, 0, 0},
+    {124, 338, 0, 0},
+    {84, 339, 0, 0},
+    {10120, 340, 0, 0},
+    {10120, 341, 0, 0},
+    {10120, 342, 0, 0},
+    {10120, 343, 0, 0},
+    {124, 344, 0, 0},
+    {124, 345, 0, 0},
+    {124, 346, 0, 0},
+    {124, 347, 0, 0},
+    {124, 348, 0, 0},
+    {124, 349, 0, 0},
+    {124, 350, 0, 0},
+    {124, 351, 0, 0},
+    {124, 352, 0, 0},
+    {124, 353, 0, 0},
+    {124, 354, 0, 0},
+    {124, 355, 0, 0},
+    {124, 356, 0, 0},
+    {124, 357, 0, 0},
+    {122, 358, 0, 0},
+    {122, 359, 0, 0},
+    {122, 360, 0, 0},
+    {122, 361, 0, 0},
+    {122, 362, 0, 0},
+    {124, 363, 0, 0},
+    {124, 364, 0, 0},
+    {124, 365, 0, 0},
+    {124, 366, 0, 0},
+    {122, 367, 0, 0},
+    {122, 368, 0, 0},
+    {122, 369, 0, 0},
+    {122, 370, 0, 0},
+    {122, 371, 0, 0},
+    {122, 372, 0, 0},
+    {122, 373, 0, 0},
+    {122, 374, 0, 0},
+    {9100, 375, 0, 0},
+    {9101, 376, 0, 0},
+    {9102, 377, 0, 0},
+    {9103, 378, 0, 0},
+    {11, 379, 0, 0},
+    {11, 380, 0, 0},
+    {11, 381, 0, 0},
+    {11, 382, 0, 0},
+    // Forsaken Outpost
+    {1, 0, 0, 0},
+    {3000, 1, 0, 0},
+    {3001, 2, 0, 0},
+    {14, 3, 0, 0},
+    {14, 4, 0, 0},
+    {3002, 5, 0, 0},
+    {3002, 6, 0, 0},
+    {3000, 7, 0, 0},
+    {3000, 8, 0, 0},
+    {3000, 9, 0, 0},
+    {3000, 10, 0, 0},
+    {3001, 11, 0, 0},
+    {3001, 12, 0, 0},
+    {15, 13, 0, 0},
+    {15, 14, 0, 0},
+    {9, 15, 0, 0},
+    {9, 16, 0, 0},
+    {52, 17, 0, 0},
+    {7, 18, 0, 0},
+    {6, 19, 0, 0},
+    {6, 20, 0, 0},
+    {52, 21, 0, 0},
+    {52, 22, 0, 0},
+    {56, 23, 0, 0},
+    {57, 24, 0, 0},
+    {49, 25, 0, 0},
+    {50, 26, 0, 0},
+    {50, 27, 0, 0},
+    {51, 28, 0, 0},
+    {51, 29, 0, 0},
+    {52, 30, 0, 0},
+    {5, 31, 0, 0},
+    {54, 32, 0, 0},
+    {54, 33, 0, 0},
+    {54, 34, 0, 0},
+    {54, 35, 0, 0},
+    {54, 36, 0, 0},
+    {54, 37, 0, 0},
+    {55, 38, 0, 0},
+    {55, 39, 0, 0},
+    {55, 40, 0, 0},
+    {55, 41, 0, 0},
+    {55, 42, 0, 0},
+    {55, 43, 0, 0},
+    {77, 44, 0, 0},
+    {77, 45, 0, 0},
+    {109, 46, 0, 0},
+    {109, 47, 0, 0},
+    {71, 48, 0, 0},
+    {108, 49, 0, 0},
+    {116, 50, 0, 0},
+    {116, 51, 0, 0},
+    {116, 52, 0, 0},
+    {116, 53, 0, 0},
+    {116, 54, 0, 0},
+    {116, 55, 0, 0},
+    {116, 56, 0, 0},
+    {116, 57, 0, 0},
+    {116, 58, 0, 0},
+    {116, 59, 0, 0},
+    {116, 60, 0, 0},
+    {116, 61, 0, 0},
+    {109, 62, 0, 0},
+    {6, 63, 0, 0},
+    {6, 64, 0, 0},
+    {6, 65, 0, 0},
+    {7, 66, 0, 0},
+    {7, 67, 0, 0},
+    {7, 68, 0, 0},
+    {9, 69, 0, 0},
+    {9, 70, 0, 0},
+    {15, 71, 0, 0},
+    {54, 72, 0, 0},
+    {54, 73, 0, 0},
+    {117, 74, 0, 0},
+    {117, 75, 0, 0},
+    {55, 76, 0, 0},
+    {114, 77, 0, 0},
+    {9001, 78, 0, 0},
+    {6, 79, 0, 0},
+    {9, 80, 0, 0},
+    {42, 81, 0, 0},
+    {44, 82, 0, 0},
+    {45, 83, 0, 0},
+    {41, 84, 0, 0},
+    {52, 85, 0, 0},
+    {56, 86, 0, 0},
+    {52, 87, 0, 0},
+    {9, 88, 0, 0},
+    {10060, 89, 0, 0},
+    {117, 90, 0, 0},
+    {117, 91, 0, 0},
+    {117, 92, 0, 0},
+    {117, 93, 0, 0},
+    {117, 94, 0, 0},
+    {117, 95, 0, 0},
+    {117, 96, 0, 0},
+    {117, 97, 0, 0},
+    {54, 98, 0, 0},
+    {55, 99, 0, 0},
+    {55, 100, 0, 0},
+    {55, 101, 0, 0},
+    {55, 102, 0, 0},
+    {10030, 103, 0, 0},
+    {10030, 104, 0, 0},
+    {10030, 105, 0, 0},
+    {10030, 106, 0, 0},
+    {9001, 107, 0, 0},
+    {9001, 108, 0, 0},
+    {9001, 109, 0, 0},
+    {9001, 110, 0, 0},
+    {9001, 111, 0, 0},
+    {9001, 112, 0, 0},
+    {81, 113, 0, 0},
+    {81, 114, 0, 0},
+    {81, 115, 0, 0},
+    {81, 116, 0, 0},
+    {81, 117, 0, 0},
+    {81, 118, 0, 0},
+    {81, 119, 0, 0},
+    {81, 120, 0, 0},
+    {81, 121, 0, 0},
+    {81, 122, 0, 0},
+    {81, 123, 0, 0},
+    {81, 124, 0, 0},
+    {82, 125, 0, 0},
+    {82, 126, 0, 0},
+    {82, 127, 0, 0},
+    {82, 128, 0, 0},
+    {82, 129, 0, 0},
+    {82, 130, 0, 0},
+    {82, 131, 0, 0},
+    {82, 132, 0, 0},
+    {11, 133, 0, 0},
+    {11, 134, 0, 0},
+    {8037, 135, 0, 0},
+    {9001, 136, 0, 0},
+    {9001, 137, 0, 0},
+    {9001, 138, 0, 0},
+    {9001, 139, 0, 0},
+    {9001, 140, 0, 0},
+    {9001, 141, 0, 0},
+    {9001, 142, 0, 0},
+    {9001, 143, 0, 0},
+    {9001, 144, 0, 0},
+    {9001, 145, 0, 0},
+    {9001, 146, 0, 0},
+    {9001, 147, 0, 0},
+    {8010, 148, 0, 0},
+    {30, 149, 0, 0},
+    {8002, 150, 0, 0},
+    {8007, 151, 0, 0},
+    {9007, 152, 0, 0},
+    {9008, 153, 0, 0},
+    {114, 154, 0, 0},
+    {114, 155, 0, 0},
+    {114, 156, 0, 0},
+    {114, 157, 0, 0},
+    {114, 158, 0, 0},
+    {114, 159, 0, 0},
+    {114, 160, 0, 0},
+    {114, 161, 0, 0},
+    {114, 162, 0, 0},
+    {114, 163, 0, 0},
+    {114, 164, 0, 0},
+    {107, 165, 0, 0},
+    {107, 166, 0, 0},
+    {107, 167, 0, 0},
+    {107, 168, 0, 0},
+    {107, 169, 0, 0},
+    {115, 170, 0, 0},
+    {115, 171, 0, 0},
+    {10030, 172, 0, 0},
+    {10030, 173, 0, 0},
+    {31, 174, 0, 0},
+    {31, 175, 0, 0},
+    {31, 176, 0, 0},
+    {31, 177, 0, 0},
+    {107, 178, 0, 0},
+    {107, 179, 0, 0},
+    {115, 180, 0, 0},
+    {115, 181, 0, 0},
+    {107, 182, 0, 0},
+    {107, 183, 0, 0},
+    {107, 184, 0, 0},
+    {107, 185, 0, 0},
+    {107, 186, 0, 0},
+    {107, 187, 0, 0},
+    {10030, 188, 0, 0},
+    {10030, 189, 0, 0},
+    {10030, 190, 0, 0},
+    {10030, 191, 0, 0},
+    {10030, 192, 0, 0},
+    {10030, 193, 0, 0},
+    {10030, 194, 0, 0},
+    {10030, 195, 0, 0},
+    {10030, 196, 0, 0},
+    {114, 197, 0, 0},
+    {114, 198, 0, 0},
+    {114, 199, 0, 0},
+    {114, 200, 0, 0},
+    {114, 201, 0, 0},
+    {10030, 202, 0, 0},
+    {10030, 203, 0, 0},
+    {10030, 204, 0, 0},
+    {81, 205, 0, 0},
+    {81, 206, 0, 0},
+    {81, 207, 0, 0},
+    {81, 208, 0, 0},
+    {81, 209, 0, 0},
+    {81, 210, 0, 0},
+    {81, 211, 0, 0},
+    {81, 212, 0, 0},
+    {114, 213, 0, 0},
+    {114, 214, 0, 0},
+    {114, 215, 0, 0},
+    {114, 216, 0, 0},
+    {114, 217, 0, 0},
+    {114, 218, 0, 0},
+    {114, 219, 0, 0},
+    {114, 220, 0, 0},
+    {81, 221, 0, 0},
+    {81, 222, 0, 0},
+    {81, 223, 0, 0},
+    {81, 224, 0, 0},
+    {81, 225, 0, 0},
+    {8000, 226, 0, 0},
+    {8000, 227, 0, 0},
+    {8000, 228, 0, 0},
+    {10110, 229, 0, 0},
+    {10110, 230, 0, 0},
+    {10110, 231, 0, 0},
+    {10110, 232, 0, 0},
+    {82, 233, 0, 0},
+    {81, 234, 0, 0},
+    {81, 235, 0, 0},
+    {81, 236, 0, 0},
+    {81, 237, 0, 0},
+    {10030, 238, 0, 0},
+    {10030, 239, 0, 0},
+    {83, 240, 0, 0},
+    {82, 241, 0, 0},
+    {10110, 242, 0, 0},
+    {10110, 243, 0, 0},
+    {10110, 244, 0, 0},
+    {10110, 245, 0, 0},
+    {10110, 246, 0, 0},
+    {10110, 247, 0, 0},
+    {10110, 248, 0, 0},
+    {10110, 249, 0, 0},
+    {10110, 250, 0, 0},
+    {10110, 251, 0, 0},
+    {10110, 252, 0, 0},
+    {10110, 253, 0, 0},
+    {10110, 254, 0, 0},
+    {10110, 255, 0, 0},
+    {10110, 256, 0, 0},
+    {10110, 257, 0, 0},
+    {10110, 258, 0, 0},
+    {10110, 259, 0, 0},
+    {10110, 260, 0, 0},
+    {10110, 261, 0, 0},
+    {10110, 262, 0, 0},
+    {8000, 263, 0, 0},
+    {8000, 264, 0, 0},
+    {8000, 265, 0, 0},
+    {8000, 266, 0, 0},
+    {8000, 267, 0, 0},
+    {8000, 268, 0, 0},
+    {122, 269, 0, 0},
+    {122, 270, 0, 0},
+    {122, 271, 0, 0},
+    {122, 272, 0, 0},
+    {122, 273, 0, 0},
+    {122, 274, 0, 0},
+    {124, 275, 0, 0},
+    {124, 276, 0, 0},
+    {124, 277, 0, 0},
+    {124, 278, 0, 0},
+    {124, 279, 0, 0},
+    {124, 280, 0, 0},
+    {124, 281, 0, 0},
+    {124, 282, 0, 0},
+    {124, 283, 0, 0},
+    {122, 284, 0, 0},
+    {122, 285, 0, 0},
+    {122, 286, 0, 0},
+    {122, 287, 0, 0},
+    {122, 288, 0, 0},
+    {122, 289, 0, 0},
+    {122, 290, 0, 0},
+    {122, 291, 0, 0},
+    {124, 292, 0, 0},
+    {124, 293, 0, 0},
+    {124, 294, 0, 0},
+    {124, 295, 0, 0},
+    {124, 296, 0, 0},
+    {124, 297, 0, 0},
+    {122, 298, 0, 0},
+    {122, 299, 0, 0},
+    {122, 300, 0, 0},
+    {122, 301, 0, 0},
+    {122, 302, 0, 0},
+    {122, 303, 0, 0},
+    {124, 304, 0, 0},
+    {124, 305, 0, 0},
+    {124, 306, 0, 0},
+    {124, 307, 0, 0},
+    {124, 308, 0, 0},
+    {124, 309, 0, 0},
+    {124, 310, 0, 0},
+    {124, 311, 0, 0},
+    {8004, 312, 0, 0},
+    {122, 313, 0, 0},
+    {122, 314, 0, 0},
+    {9001, 315, 0, 0},
+    {124, 316, 0, 0},
+    {124, 317, 0, 0},
+    {122, 318, 0, 0},
+    {122, 319, 0, 0},
+    {122, 320, 0, 0},
+    {2, 321, 0, 0},
+    {3, 322, 0, 0},
+    {4, 323, 0, 0},
+    {1, 324, 0, 0},
+    {2, 325, 0, 0},
+    {3, 326, 0, 0},
+    {4, 327, 0, 0},
+    {1, 328, 0, 0},
+    {2, 329, 0, 0},
+    {3, 330, 0, 0},
+    {4, 331, 0, 0},
+    {11, 332, 0, 0},
+    {11, 333, 0, 0},
+    {11, 334, 0, 0},
+    {10, 335, 0, 0},
+    {8010, 336, 0, 0},
+    {53, 337, 0, 0},
+    {8009, 338, 0, 0},
+    {123, 339, 0, 0},
+    {8040, 340, 0, 0},
+    {20, 341, 0, 0},
+    {19, 342, 0, 0},
+    {18, 343, 0, 0},
+    {16, 344, 0, 0},
+    {23, 345, 0, 0},
+    {13, 346, 0, 0},
+    {12, 347, 0, 0},
+    {21, 348, 0, 0},
+    {22, 349, 0, 0},
+    {8008, 350, 0, 0},
+    {8005, 351, 0, 0},
+    {8003, 352, 0, 0},
+    {8002, 353, 0, 0},
+    {8041, 354, 0, 0},
+    {30, 355, 0, 0},
+    {83, 356, 0, 0},
+    {32, 357, 0, 0},
+    {8007, 358, 0, 0},
+    {8006, 359, 0, 0},
+    {86, 360, 0, 0},
+    {36, 361, 0, 0},
+    {10040, 362, 0, 0},
+    {9001, 363, 0, 0},
+    {9001, 364, 0, 0},
+    {9001, 365, 0, 0},
+    {9001, 366, 0, 0},
+    {9001, 367, 0, 0},
+    {107, 368, 0, 0},
+    {107, 369, 0, 0},
+    {10030, 370, 0, 0},
+    {10030, 371, 0, 0},
+    {31, 372, 0, 0},
+    {10060, 373, 0, 0},
+    {10060, 374, 0, 0},
+    {10060, 375, 0, 0},
+    {10060, 376, 0, 0},
+    {10060, 377, 0, 0},
+    {10060, 378, 0, 0},
+    {10030, 379, 0, 0},
+    {10030, 380, 0, 0},
+    {10030, 381, 0, 0},
+    {10030, 382, 0, 0},
+    {31, 383, 0, 0},
+    {31, 384, 0, 0},
+    {10030, 385, 0, 0},
+    {10030, 386, 0, 0},
+    {10030, 387, 0, 0},
+    {10030, 388, 0, 0},
+    {10030, 389, 0, 0},
+    {10030, 390, 0, 0},
+    {10030, 391, 0, 0},
+    {10030, 392, 0, 0},
+    {10030, 393, 0, 0},
+    {31, 394, 0, 0},
+    {9001, 395, 0, 0},
+    {9001, 396, 0, 0},
+    {10120, 397, 0, 0},
+    {10120, 398, 0, 0},
+    {10120, 399, 0, 0},
+    {11, 400, 0, 0},
+    {11, 401, 0, 0},
+    {11, 402, 0, 0},
+    {9100, 403, 0, 0},
+    {9101, 404, 0, 0},
+    {9102, 405, 0, 0},
+    {9103, 406, 0, 0},
+    {9100, 407, 0, 0},
+    {9101, 408, 0, 0},
+    {9102, 409, 0, 0},
+    {9103, 410, 0, 0},
+    {9100, 411, 0, 0},
+    {9101, 412, 0, 0},
+    {9102, 413, 0, 0},
+    {9103, 414, 0, 0},
+    // Castle of Grief
+    {1, 0, 0, 0},
+    {121, 1, 0, 0},
+    {121, 2, 0, 0},
+    {121, 3, 0, 0},
+    {121, 4, 0, 0},
+    {114, 5, 0, 0},
+    {114, 6, 0, 0},
+    {114, 7, 0, 0},
+    {114, 8, 0, 0},
+    {9001, 9, 0, 0},
+    {9001, 10, 0, 0},
+    {9001, 11, 0, 0},
+    {9001, 12, 0, 0},
+    {9001, 13, 0, 0},
+    {9001, 14, 0, 0},
+    {9001, 15, 0, 0},
+    {9001, 16, 0, 0},
+    {114, 17, 0, 0},
+    {114, 18, 0, 0},
+    {114, 19, 0, 0},
+    {114, 20, 0, 0},
+    {114, 21, 0, 0},
+    {9001, 22, 0, 0},
+    {9001, 23, 0, 0},
+    {9001, 24, 0, 0},
+    {9001, 25, 0, 0},
+    {9001, 26, 0, 0},
+    {10060, 27, 0, 0},
+    {10060, 28, 0, 0},
+    {10060, 29, 0, 0},
+    {10060, 30, 0, 0},
+    {10090, 31, 0, 0},
+    {10090, 32, 0, 0},
+    {10090, 33, 0, 0},
+    {10090, 34, 0, 0},
+    {10090, 35, 0, 0},
+    {10090, 36, 0, 0},
+    {10090, 37, 0, 0},
+    {10090, 38, 0, 0},
+    {10090, 39, 0, 0},
+    {10090, 40, 0, 0},
+    {10090, 41, 0, 0},
+    {10090, 42, 0, 0},
+    {10090, 43, 0, 0},
+    {10090, 44, 0, 0},
+    {10090, 45, 0, 0},
+    {10090, 46, 0, 0},
+    {10090, 47, 0, 0},
+    {116, 48, 0, 0},
+    {116, 49, 0, 0},
+    {116, 50, 0, 0},
+    {116, 51, 0, 0},
+    {116, 52, 0, 0},
+    {116, 53, 0, 0},
+    {116, 54, 0, 0},
+    {116, 55, 0, 0},
+    {116, 56, 0, 0},
+    {116, 57, 0, 0},
+    {116, 58, 0, 0},
+    {116, 59, 0, 0},
+    {116, 60, 0, 0},
+    {116, 61, 0, 0},
+    {116, 62, 0, 0},
+    {116, 63, 0, 0},
+    {116, 64, 0, 0},
+    {116, 65, 0, 0},
+    {116, 66, 0, 0},
+    {116, 67, 0, 0},
+    {54, 68, 0, 0},
+    {54, 69, 0, 0},
+    {54, 70, 0, 0},
+    {54, 71, 0, 0},
+    {54, 72, 0, 0},
+    {54, 73, 0, 0},
+    {119, 74, 0, 0},
+    {119, 75, 0, 0},
+    {119, 76, 0, 0},
+    {119, 77, 0, 0},
+    {119, 78, 0, 0},
+    {24, 79, 0, 0},
+    {24, 80, 0, 0},
+    {24, 81, 0, 0},
+    {24, 82, 0, 0},
+    {24, 83, 0, 0},
+    {24, 84, 0, 0},
+    {6, 85, 0, 0},
+    {9, 86, 0, 0},
+    {7, 87, 0, 0},
+    {15, 88, 0, 0},
+    {55, 89, 0, 0},
+    {55, 90, 0, 0},
+    {55, 91, 0, 0},
+    {55, 92, 0, 0},
+    {55, 93, 0, 0},
+    {55, 94, 0, 0},
+    {55, 95, 0, 0},
+    {55, 96, 0, 0},
+    {8064, 97, 0, 0},
+    {8064, 98, 0, 0},
+    {62, 99, 0, 0},
+    {62, 100, 0, 0},
+    {100, 101, 0, 0},
+    {100, 102, 0, 0},
+    {101, 103, 0, 0},
+    {101, 104, 0, 0},
+    {102, 105, 0, 0},
+    {77, 106, 0, 0},
+    {77, 107, 0, 0},
+    {77, 108, 0, 0},
+    {77, 109, 0, 0},
+    {77, 110, 0, 0},
+    {77, 111, 0, 0},
+    {108, 112, 0, 0},
+    {109, 113, 0, 0},
+    {71, 114, 0, 0},
+    {110, 115, 0, 0},
+    {109, 116, 0, 0},
+    {61, 117, 0, 0},
+    {109, 118, 0, 0},
+    {62, 119, 0, 0},
+    {62, 120, 0, 0},
+    {61, 121, 0, 0},
+    {109, 122, 0, 0},
+    {8102, 123, 0, 0},
+    {8102, 124, 0, 0},
+    {8102, 125, 0, 0},
+    {8102, 126, 0, 0},
+    {8102, 127, 0, 0},
+    {8102, 128, 0, 0},
+    {29, 129, 0, 0},
+    {29, 130, 0, 0},
+    {29, 131, 0, 0},
+    {29, 132, 0, 0},
+    {29, 133, 0, 0},
+    {29, 134, 0, 0},
+    {116, 135, 0, 0},
+    {116, 136, 0, 0},
+    {116, 137, 0, 0},
+    {116, 138, 0, 0},
+    {116, 139, 0, 0},
+    {116, 140, 0, 0},
+    {116, 141, 0, 0},
+    {116, 142, 0, 0},
+    {116, 143, 0, 0},
+    {54, 144, 0, 0},
+    {54, 145, 0, 0},
+    {54, 146, 0, 0},
+    {54, 147, 0, 0},
+    {54, 148, 0, 0},
+    {54, 149, 0, 0},
+    {54, 150, 0, 0},
+    {54, 151, 0, 0},
+    {54, 152, 0, 0},
+    {8008, 153, 0, 0},
+    {8003, 154, 0, 0},
+    {86, 155, 0, 0},
+    {10110, 156, 0, 0},
+    {8064, 157, 0, 0},
+    {8064, 158, 0, 0},
+    {8064, 159, 0, 0},
+    {8064, 160, 0, 0},
+    {8000, 161, 0, 0},
+    {8000, 162, 0, 0},
+    {8000, 163, 0, 0},
+    {8000, 164, 0, 0},
+    {8000, 165, 0, 0},
+    {8000, 166, 0, 0},
+    {8000, 167, 0, 0},
+    {8000, 168, 0, 0},
+    {8000, 169, 0, 0},
+    {8000, 170, 0, 0},
+    {8000, 171, 0, 0},
+    {8000, 172, 0, 0},
+    {8000, 173, 0, 0},
+    {8000, 174, 0, 0},
+    {8000, 175, 0, 0},
+    {8000, 176, 0, 0},
+    {8000, 177, 0, 0},
+    {8000, 178, 0, 0},
+    {8000, 179, 0, 0},
+    {8000, 180, 0, 0},
+    {8000, 181, 0, 0},
+    {8000, 182, 0, 0},
+    {8000, 183, 0, 0},
+    {8000, 184, 0, 0},
+    {10030, 185, 0, 0},
+    {10030, 186, 0, 0},
+    {10030, 187, 0, 0},
+    {10030, 188, 0, 0},
+    {10030, 189, 0, 0},
+    {10030, 190, 0, 0},
+    {10030, 191, 0, 0},
+    {10030, 192, 0, 0},
+    {10030, 193, 0, 0},
+    {10030, 194, 0, 0},
+    {10030, 195, 0, 0},
+    {10030, 196, 0, 0},
+    {31, 197, 0, 0},
+    {31, 198, 0, 0},
+    {31, 199, 0, 0},
+    {31, 200, 0, 0},
+    {31, 201, 0, 0},
+    {31, 202, 0, 0},
+    {31, 203, 0, 0},
+    {31, 204, 0, 0},
+    {31, 205, 0, 0},
+    {31, 206, 0, 0},
+    {107, 207, 0, 0},
+    {107, 208, 0, 0},
+    {107, 209, 0, 0},
+    {107, 210, 0, 0},
+    {107, 211, 0, 0},
+    {107, 212, 0, 0},
+    {107, 213, 0, 0},
+    {107, 214, 0, 0},
+    {107, 215, 0, 0},
+    {107, 216, 0, 0},
+    {115, 217, 0, 0},
+    {115, 218, 0, 0},
+    {115, 219, 0, 0},
+    {115, 220, 0, 0},
+    {115, 221, 0, 0},
+    {115, 222, 0, 0},
+    {114, 223, 0, 0},
+    {114, 224, 0, 0},
+    {114, 225, 0, 0},
+    {114, 226, 0, 0},
+    {114, 227, 0, 0},
+    {114, 228, 0, 0},
+    {10030, 229, 0, 0},
+    {10030, 230, 0, 0},
+    {10030, 231, 0, 0},
+    {10030, 232, 0, 0},
+    {10030, 233, 0, 0},
+    {10030, 234, 0, 0},
+    {10030, 235, 0, 0},
+    {10030, 236, 0, 0},
+    {10030, 237, 0, 0},
+    {10030, 238, 0, 0},
+    {10030, 239, 0, 0},
+    {10030, 240, 0, 0},
+    {10030, 241, 0, 0},
+    {10030, 242, 0, 0},
+    {10030, 243, 0, 0},
+    {10030, 244, 0, 0},
+    {10030, 245, 0, 0},
+    {31, 246, 0, 0},
+    {31, 247, 0, 0},
+    {31, 248, 0, 0},
+    {31, 249, 0, 0},
+    {31, 250, 0, 0},
+    {31, 251, 0, 0},
+    {58, 252, 0, 0},
+    {58, 253, 0, 0},
+    {59, 254, 0, 0},
+    {59, 255, 0, 0},
+    {9021, 256, 0, 0},
+    {9018, 257, 0, 0},
+    {9020, 258, 0, 0},
+    {9019, 259, 0, 0},
+    {11, 260, 0, 0},
+    {11, 261, 0, 0},
+    {11, 262, 0, 0},
+    {11, 263, 0, 0},
+    {124, 264, 0, 0},
+    {124, 265, 0, 0},
+    {124, 266, 0, 0},
+    {124, 267, 0, 0},
+    {122, 268, 0, 0},
+    {122, 269, 0, 0},
+    {122, 270, 0, 0},
+    {122, 271, 0, 0},
+    {8004, 272, 0, 0},
+    {8004, 273, 0, 0},
+    {81, 274, 0, 0},
+    {81, 275, 0, 0},
+    {81, 276, 0, 0},
+    {81, 277, 0, 0},
+    {81, 278, 0, 0},
+    {81, 279, 0, 0},
+    {81, 280, 0, 0},
+    {81, 281, 0, 0},
+    {81, 282, 0, 0},
+    {81, 283, 0, 0},
+    {81, 284, 0, 0},
+    {81, 285, 0, 0},
+    {81, 286, 0, 0},
+    {81, 287, 0, 0},
+    {81, 288, 0, 0},
+    {81, 289, 0, 0},
+    {81, 290, 0, 0},
+    {81, 291, 0, 0},
+    {81, 292, 0, 0},
+    {81, 293, 0, 0},
+    {81, 294, 0, 0},
+    {81, 295, 0, 0},
+    {81, 296, 0, 0},
+    {81, 297, 0, 0},
+    {122, 298, 0, 0},
+    {122, 299, 0, 0},
+    {122, 300, 0, 0},
+    {122, 301, 0, 0},
+    {122, 302, 0, 0},
+    {122, 303, 0, 0},
+    {122, 304, 0, 0},
+    {122, 305, 0, 0},
+    {122, 306, 0, 0},
+    {122, 307, 0, 0},
+    {122, 308, 0, 0},
+    {122, 309, 0, 0},
+    {124, 310, 0, 0},
+    {124, 311, 0, 0},
+    {124, 312, 0, 0},
+    {124, 313, 0, 0},
+    {124, 314, 0, 0},
+    {124, 315, 0, 0},
+    {124, 316, 0, 0},
+    {124, 317, 0, 0},
+    {124, 318, 0, 0},
+    {124, 319, 0, 0},
+    {124, 320, 0, 0},
+    {124, 321, 0, 0},
+    {8000, 322, 0, 0},
+    {8000, 323, 0, 0},
+    {8000, 324, 0, 0},
+    {8000, 325, 0, 0},
+    {8000, 326, 0, 0},
+    {8000, 327, 0, 0},
+    {8000, 328, 0, 0},
+    {8000, 329, 0, 0},
+    {8000, 330, 0, 0},
+    {8000, 331, 0, 0},
+    {8000, 332, 0, 0},
+    {8000, 333, 0, 0},
+    {81, 334, 0, 0},
+    {81, 335, 0, 0},
+    {122, 336, 0, 0},
+    {122, 337, 0, 0},
+    {124, 338, 0, 0},
+    {124, 339, 0, 0},
+    {122, 340, 0, 0},
+    {122, 341, 0, 0},
+    {8000, 342, 0, 0},
+    {8000, 343, 0, 0},
+    {8000, 344, 0, 0},
+    {8000, 345, 0, 0},
+    {8000, 346, 0, 0},
+    {8000, 347, 0, 0},
+    {10110, 348, 0, 0},
+    {10110, 349, 0, 0},
+    {10110, 350, 0, 0},
+    {10110, 351, 0, 0},
+    {10110, 352, 0, 0},
+    {10110, 353, 0, 0},
+    {10110, 354, 0, 0},
+    {10110, 355, 0, 0},
+    {10110, 356, 0, 0},
+    {10110, 357, 0, 0},
+    {10110, 358, 0, 0},
+    {10110, 359, 0, 0},
+    {10110, 360, 0, 0},
+    {10110, 361, 0, 0},
+    {2, 362, 0, 0},
+    {3, 363, 0, 0},
+    {4, 364, 0, 0},
+    {1, 365, 0, 0},
+    {2, 366, 0, 0},
+    {3, 367, 0, 0},
+    {4, 368, 0, 0},
+    {1, 369, 0, 0},
+    {2, 370, 0, 0},
+    {3, 371, 0, 0},
+    {4, 372, 0, 0},
+    {1, 373, 0, 0},
+    {2, 374, 0, 0},
+    {3, 375, 0, 0},
+    {4, 376, 0, 0},
+    {10060, 377, 0, 0},
+    {10060, 378, 0, 0},
+    {10060, 379, 0, 0},
+    {10060, 380, 0, 0},
+    {114, 381, 0, 0},
+    {114, 382, 0, 0},
+    {114, 383, 0, 0},
+    {114, 384, 0, 0},
+    {114, 385, 0, 0},
+    {83, 386, 0, 0},
+    {10, 387, 0, 0},
+    {8010, 388, 0, 0},
+    {53, 389, 0, 0},
+    {30, 390, 0, 0},
+    {84, 391, 0, 0},
+    {84, 392, 0, 0},
+    {8040, 393, 0, 0},
+    {123, 394, 0, 0},
+    {8009, 395, 0, 0},
+    {20, 396, 0, 0},
+    {19, 397, 0, 0},
+    {18, 398, 0, 0},
+    {16, 399, 0, 0},
+    {13, 400, 0, 0},
+    {12, 401, 0, 0},
+    {23, 402, 0, 0},
+    {22, 403, 0, 0},
+    {21, 404, 0, 0},
+    {8005, 405, 0, 0},
+    {8007, 406, 0, 0},
+    {8006, 407, 0, 0},
+    {9001, 408, 0, 0},
+    {9001, 409, 0, 0},
+    {9001, 410, 0, 0},
+    {9001, 411, 0, 0},
+    {9001, 412, 0, 0},
+    {120, 413, 0, 0},
+    {120, 414, 0, 0},
+    {10030, 415, 0, 0},
+    {10030, 416, 0, 0},
+    {10030, 417, 0, 0},
+    {10030, 418, 0, 0},
+    {107, 419, 0, 0},
+    {107, 420, 0, 0},
+    {10030, 421, 0, 0},
+    {10030, 422, 0, 0},
+    {10030, 423, 0, 0},
+    {10030, 424, 0, 0},
+    {115, 425, 0, 0},
+    {115, 426, 0, 0},
+    {115, 427, 0, 0},
+    {115, 428, 0, 0},
+    {115, 429, 0, 0},
+    {115, 430, 0, 0},
+    {10030, 431, 0, 0},
+    {10030, 432, 0, 0},
+    {10030, 433, 0, 0},
+    {10030, 434, 0, 0},
+    {10060, 435, 0, 0},
+    {10060, 436, 0, 0},
+    {10060, 437, 0, 0},
+    {10060, 438, 0, 0},
+    {31, 439, 0, 0},
+    {9001, 440, 0, 0},
+    {122, 441, 0, 0},
+    {122, 442, 0, 0},
+    {122, 443, 0, 0},
+    {122, 444, 0, 0},
+    {124, 445, 0, 0},
+    {124, 446, 0, 0},
+    {124, 447, 0, 0},
+    {124, 448, 0, 0},
+    {124, 449, 0, 0},
+    {122, 450, 0, 0},
+    {8004, 451, 0, 0},
+    {8004, 452, 0, 0},
+    {10120, 453, 0, 0},
+    {10120, 454, 0, 0},
+    {10120, 455, 0, 0},
+    {10120, 456, 0, 0},
+    {8004, 457, 0, 0},
+    {8004, 458, 0, 0},
+    {8004, 459, 0, 0},
+    {8004, 460, 0, 0},
+    {8004, 461, 0, 0},
+    {8004, 462, 0, 0},
+    {8004, 463, 0, 0},
+    {8004, 464, 0, 0},
+    {8004, 465, 0, 0},
+    {8004, 466, 0, 0},
+    {8004, 467, 0, 0},
+    {8004, 468, 0, 0},
+    {8004, 469, 0, 0},
+    {8004, 470, 0, 0},
+    {8004, 471, 0, 0},
+    {8004, 472, 0, 0},
+    {8004, 473, 0, 0},
+    {8004, 474, 0, 0},
+    {8004, 475, 0, 0},
+    {8004, 476, 0, 0},
+    {8004, 477, 0, 0},
+    {8004, 478, 0, 0},
+    {8004, 479, 0, 0},
+    {8004, 480, 0, 0},
+    {8004, 481, 0, 0},
+    {8004, 482, 0, 0},
+    {8004, 483, 0, 0},
+    {8004, 484, 0, 0},
+    {8004, 485, 0, 0},
+    {8004, 486, 0, 0},
+    {8004, 487, 0, 0},
+    {8004, 488, 0, 0},
+    {8004, 489, 0, 0},
+    {8004, 490, 0, 0},
+    {8004, 491, 0, 0},
+    {8004, 492, 0, 0},
+    {8004, 493, 0, 0},
+    {8004, 494, 0, 0},
+    {8004, 495, 0, 0},
+    {8004, 496, 0, 0},
+    {10, 497, 0, 0},
+    {8010, 498, 0, 0},
+    {53, 499, 0, 0},
+    {8040, 500, 0, 0},
+    {8009, 501, 0, 0},
+    {123, 502, 0, 0},
+    {11, 503, 0, 0},
+    {11, 504, 0, 0},
+    {11, 505, 0, 0},
+    {11, 506, 0, 0},
+    {9100, 507, 0, 0},
+    {9101, 508, 0, 0},
+    {9102, 509, 0, 0},
+    {9103, 510, 0, 0},
+    {9100, 511, 0, 0},
+    {9101, 512, 0, 0},
+    {9102, 513, 0, 0},
+    {9103, 514, 0, 0},
+    {9100, 515, 0, 0},
+    {9101, 516, 0, 0},
+    {9102, 517, 0, 0},
+    {9103, 518, 0, 0},
+    {9100, 519, 0, 0},
+    {9101, 520, 0, 0},
+    {9102, 521, 0, 0},
+    {9103, 522, 0, 0},
+    // Gibbet
+    {1, 0, 0, 0},
+    {3000, 1, 0, 0},
+    {3000, 2, 0, 0},
+    {3002, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {3000, 5, 0, 0},
+    {3000, 6, 0, 0},
+    {3002, 7, 0, 0},
+    {3002, 8, 0, 0},
+    {3000, 9, 0, 0},
+    {3000, 10, 0, 0},
+    {3002, 11, 0, 0},
+    {3002, 12, 0, 0},
+    {9001, 13, 0, 0},
+    {9001, 14, 0, 0},
+    {9001, 15, 0, 0},
+    {9001, 16, 0, 0},
+    {116, 17, 0, 0},
+    {116, 18, 0, 0},
+    {116, 19, 0, 0},
+    {116, 20, 0, 0},
+    {116, 21, 0, 0},
+    {116, 22, 0, 0},
+    {116, 23, 0, 0},
+    {116, 24, 0, 0},
+    {116, 25, 0, 0},
+    {116, 26, 0, 0},
+    {116, 27, 0, 0},
+    {116, 28, 0, 0},
+    {116, 29, 0, 0},
+    {116, 30, 0, 0},
+    {116, 31, 0, 0},
+    {55, 32, 0, 0},
+    {55, 33, 0, 0},
+    {55, 34, 0, 0},
+    {55, 35, 0, 0},
+    {55, 36, 0, 0},
+    {55, 37, 0, 0},
+    {55, 38, 0, 0},
+    {55, 39, 0, 0},
+    {55, 40, 0, 0},
+    {55, 41, 0, 0},
+    {55, 42, 0, 0},
+    {55, 43, 0, 0},
+    {55, 44, 0, 0},
+    {55, 45, 0, 0},
+    {55, 46, 0, 0},
+    {55, 47, 0, 0},
+    {55, 48, 0, 0},
+    {55, 49, 0, 0},
+    {55, 50, 0, 0},
+    {14, 51, 0, 0},
+    {9001, 52, 0, 0},
+    {9001, 53, 0, 0},
+    {9002, 54, 0, 0},
+    {17, 55, 0, 0},
+    {17, 56, 0, 0},
+    {17, 57, 0, 0},
+    {17, 58, 0, 0},
+    {17, 59, 0, 0},
+    {17, 60, 0, 0},
+    {17, 61, 0, 0},
+    {17, 62, 0, 0},
+    {17, 63, 0, 0},
+    {54, 64, 0, 0},
+    {54, 65, 0, 0},
+    {54, 66, 0, 0},
+    {54, 67, 0, 0},
+    {54, 68, 0, 0},
+    {54, 69, 0, 0},
+    {54, 70, 0, 0},
+    {62, 71, 0, 0},
+    {62, 72, 0, 0},
+    {117, 73, 0, 0},
+    {117, 74, 0, 0},
+    {117, 75, 0, 0},
+    {117, 76, 0, 0},
+    {117, 77, 0, 0},
+    {117, 78, 0, 0},
+    {117, 79, 0, 0},
+    {9011, 80, 0, 0},
+    {71, 81, 0, 0},
+    {71, 82, 0, 0},
+    {109, 83, 0, 0},
+    {108, 84, 0, 0},
+    {71, 85, 0, 0},
+    {108, 86, 0, 0},
+    {71, 87, 0, 0},
+    {109, 88, 0, 0},
+    {8032, 89, 0, 0},
+    {71, 90, 0, 0},
+    {71, 91, 0, 0},
+    {9001, 92, 0, 0},
+    {10060, 93, 0, 0},
+    {10060, 94, 0, 0},
+    {10060, 95, 0, 0},
+    {10060, 96, 0, 0},
+    {10060, 97, 0, 0},
+    {10060, 98, 0, 0},
+    {10060, 99, 0, 0},
+    {10060, 100, 0, 0},
+    {10060, 101, 0, 0},
+    {10060, 102, 0, 0},
+    {84, 103, 0, 0},
+    {114, 104, 0, 0},
+    {114, 105, 0, 0},
+    {114, 106, 0, 0},
+    {114, 107, 0, 0},
+    {114, 108, 0, 0},
+    {114, 109, 0, 0},
+    {117, 110, 0, 0},
+    {117, 111, 0, 0},
+    {117, 112, 0, 0},
+    {117, 113, 0, 0},
+    {117, 114, 0, 0},
+    {117, 115, 0, 0},
+    {117, 116, 0, 0},
+    {117, 117, 0, 0},
+    {108, 118, 0, 0},
+    {108, 119, 0, 0},
+    {108, 120, 0, 0},
+    {109, 121, 0, 0},
+    {109, 122, 0, 0},
+    {109, 123, 0, 0},
+    {71, 124, 0, 0},
+    {71, 125, 0, 0},
+    {71, 126, 0, 0},
+    {9001, 127, 0, 0},
+    {9001, 128, 0, 0},
+    {61, 129, 0, 0},
+    {61, 130, 0, 0},
+    {61, 131, 0, 0},
+    {61, 132, 0, 0},
+    {77, 133, 0, 0},
+    {77, 134, 0, 0},
+    {117, 135, 0, 0},
+    {117, 136, 0, 0},
+    {117, 137, 0, 0},
+    {117, 138, 0, 0},
+    {117, 139, 0, 0},
+    {117, 140, 0, 0},
+    {117, 141, 0, 0},
+    {117, 142, 0, 0},
+    {117, 143, 0, 0},
+    {117, 144, 0, 0},
+    {117, 145, 0, 0},
+    {9001, 146, 0, 0},
+    {9001, 147, 0, 0},
+    {9001, 148, 0, 0},
+    {9001, 149, 0, 0},
+    {9001, 150, 0, 0},
+    {9001, 151, 0, 0},
+    {9001, 152, 0, 0},
+    {115, 153, 0, 0},
+    {8064, 154, 0, 0},
+    {8064, 155, 0, 0},
+    {17, 156, 0, 0},
+    {17, 157, 0, 0},
+    {103, 158, 0, 0},
+    {103, 159, 0, 0},
+    {103, 160, 0, 0},
+    {103, 161, 0, 0},
+    {103, 162, 0, 0},
+    {103, 163, 0, 0},
+    {103, 164, 0, 0},
+    {103, 165, 0, 0},
+    {104, 166, 0, 0},
+    {105, 167, 0, 0},
+    {81, 168, 0, 0},
+    {71, 169, 0, 0},
+    {62, 170, 0, 0},
+    {62, 171, 0, 0},
+    {110, 172, 0, 0},
+    {62, 173, 0, 0},
+    {10030, 174, 0, 0},
+    {10030, 175, 0, 0},
+    {8100, 176, 0, 0},
+    {8100, 177, 0, 0},
+    {8100, 178, 0, 0},
+    {8100, 179, 0, 0},
+    {8100, 180, 0, 0},
+    {8100, 181, 0, 0},
+    {8100, 182, 0, 0},
+    {8100, 183, 0, 0},
+    {8100, 184, 0, 0},
+    {8100, 185, 0, 0},
+    {8100, 186, 0, 0},
+    {8100, 187, 0, 0},
+    {8100, 188, 0, 0},
+    {8100, 189, 0, 0},
+    {8000, 190, 0, 0},
+    {8100, 191, 0, 0},
+    {8100, 192, 0, 0},
+    {8100, 193, 0, 0},
+    {8100, 194, 0, 0},
+    {82, 195, 0, 0},
+    {114, 196, 0, 0},
+    {114, 197, 0, 0},
+    {114, 198, 0, 0},
+    {114, 199, 0, 0},
+    {114, 200, 0, 0},
+    {114, 201, 0, 0},
+    {1406, 202, 0, 0},
+    {8041, 203, 0, 0},
+    {8000, 204, 0, 0},
+    {8000, 205, 0, 0},
+    {8000, 206, 0, 0},
+    {10110, 207, 0, 0},
+    {83, 208, 0, 0},
+    {10080, 209, 0, 0},
+    {8064, 210, 0, 0},
+    {8064, 211, 0, 0},
+    {8064, 212, 0, 0},
+    {8064, 213, 0, 0},
+    {8064, 214, 0, 0},
+    {8064, 215, 0, 0},
+    {8064, 216, 0, 0},
+    {8064, 217, 0, 0},
+    {8000, 218, 0, 0},
+    {8000, 219, 0, 0},
+    {8000, 220, 0, 0},
+    {8000, 221, 0, 0},
+    {8000, 222, 0, 0},
+    {82, 223, 0, 0},
+    {82, 224, 0, 0},
+    {82, 225, 0, 0},
+    {82, 226, 0, 0},
+    {82, 227, 0, 0},
+    {8000, 228, 0, 0},
+    {8000, 229, 0, 0},
+    {8000, 230, 0, 0},
+    {8000, 231, 0, 0},
+    {8000, 232, 0, 0},
+    {8000, 233, 0, 0},
+    {8000, 234, 0, 0},
+    {8000, 235, 0, 0},
+    {9001, 236, 0, 0},
+    {9001, 237, 0, 0},
+    {9001, 238, 0, 0},
+    {9001, 239, 0, 0},
+    {9001, 240, 0, 0},
+    {9001, 241, 0, 0},
+    {9001, 242, 0, 0},
+    {9001, 243, 0, 0},
+    {9001, 244, 0, 0},
+    {9001, 245, 0, 0},
+    {9001, 246, 0, 0},
+    {9001, 247, 0, 0},
+    {9001, 248, 0, 0},
+    {9001, 249, 0, 0},
+    {9001, 250, 0, 0},
+    {9001, 251, 0, 0},
+    {82, 252, 0, 0},
+    {82, 253, 0, 0},
+    {82, 254, 0, 0},
+    {8004, 255, 0, 0},
+    {115, 256, 0, 0},
+    {115, 257, 0, 0},
+    {10030, 258, 0, 0},
+    {10030, 259, 0, 0},
+    {10030, 260, 0, 0},
+    {10030, 261, 0, 0},
+    {10030, 262, 0, 0},
+    {10030, 263, 0, 0},
+    {10030, 264, 0, 0},
+    {10030, 265, 0, 0},
+    {107, 266, 0, 0},
+    {107, 267, 0, 0},
+    {107, 268, 0, 0},
+    {107, 269, 0, 0},
+    {114, 270, 0, 0},
+    {114, 271, 0, 0},
+    {107, 272, 0, 0},
+    {107, 273, 0, 0},
+    {107, 274, 0, 0},
+    {10030, 275, 0, 0},
+    {114, 276, 0, 0},
+    {10060, 277, 0, 0},
+    {10060, 278, 0, 0},
+    {10060, 279, 0, 0},
+    {10060, 280, 0, 0},
+    {10060, 281, 0, 0},
+    {10060, 282, 0, 0},
+    {10060, 283, 0, 0},
+    {10060, 284, 0, 0},
+    {10060, 285, 0, 0},
+    {10060, 286, 0, 0},
+    {10060, 287, 0, 0},
+    {107, 288, 0, 0},
+    {107, 289, 0, 0},
+    {107, 290, 0, 0},
+    {107, 291, 0, 0},
+    {107, 292, 0, 0},
+    {107, 293, 0, 0},
+    {107, 294, 0, 0},
+    {107, 295, 0, 0},
+    {107, 296, 0, 0},
+    {107, 297, 0, 0},
+    {107, 298, 0, 0},
+    {107, 299, 0, 0},
+    {10030, 300, 0, 0},
+    {10030, 301, 0, 0},
+    {10030, 302, 0, 0},
+    {10030, 303, 0, 0},
+    {10030, 304, 0, 0},
+    {10030, 305, 0, 0},
+    {10030, 306, 0, 0},
+    {10030, 307, 0, 0},
+    {10030, 308, 0, 0},
+    {10030, 309, 0, 0},
+    {10030, 310, 0, 0},
+    {8009, 311, 0, 0},
+    {123, 312, 0, 0},
+    {8040, 313, 0, 0},
+    {8067, 314, 0, 0},
+    {8067, 315, 0, 0},
+    {8067, 316, 0, 0},
+    {8067, 317, 0, 0},
+    {11, 318, 0, 0},
+    {11, 319, 0, 0},
+    {11, 320, 0, 0},
+    {11, 321, 0, 0},
+    {10110, 322, 0, 0},
+    {10110, 323, 0, 0},
+    {10110, 324, 0, 0},
+    {10110, 325, 0, 0},
+    {10110, 326, 0, 0},
+    {10110, 327, 0, 0},
+    {10110, 328, 0, 0},
+    {10110, 329, 0, 0},
+    {8000, 330, 0, 0},
+    {8000, 331, 0, 0},
+    {8000, 332, 0, 0},
+    {8000, 333, 0, 0},
+    {8000, 334, 0, 0},
+    {8000, 335, 0, 0},
+    {8000, 336, 0, 0},
+    {8000, 337, 0, 0},
+    {82, 338, 0, 0},
+    {82, 339, 0, 0},
+    {82, 340, 0, 0},
+    {82, 341, 0, 0},
+    {82, 342, 0, 0},
+    {82, 343, 0, 0},
+    {82, 344, 0, 0},
+    {82, 345, 0, 0},
+    {81, 346, 0, 0},
+    {81, 347, 0, 0},
+    {81, 348, 0, 0},
+    {81, 349, 0, 0},
+    {81, 350, 0, 0},
+    {81, 351, 0, 0},
+    {81, 352, 0, 0},
+    {81, 353, 0, 0},
+    {81, 354, 0, 0},
+    {81, 355, 0, 0},
+    {81, 356, 0, 0},
+    {81, 357, 0, 0},
+    {81, 358, 0, 0},
+    {81, 359, 0, 0},
+    {124, 360, 0, 0},
+    {124, 361, 0, 0},
+    {124, 362, 0, 0},
+    {124, 363, 0, 0},
+    {124, 364, 0, 0},
+    {124, 365, 0, 0},
+    {124, 366, 0, 0},
+    {124, 367, 0, 0},
+    {122, 368, 0, 0},
+    {122, 369, 0, 0},
+    {122, 370, 0, 0},
+    {122, 371, 0, 0},
+    {122, 372, 0, 0},
+    {122, 373, 0, 0},
+    {122, 374, 0, 0},
+    {122, 375, 0, 0},
+    {2, 376, 0, 0},
+    {3, 377, 0, 0},
+    {4, 378, 0, 0},
+    {1, 379, 0, 0},
+    {2, 380, 0, 0},
+    {3, 381, 0, 0},
+    {4, 382, 0, 0},
+    {1, 383, 0, 0},
+    {2, 384, 0, 0},
+    {3, 385, 0, 0},
+    {4, 386, 0, 0},
+    {114, 387, 0, 0},
+    {114, 388, 0, 0},
+    {114, 389, 0, 0},
+    {114, 390, 0, 0},
+    {8006, 391, 0, 0},
+    {8008, 392, 0, 0},
+    {114, 393, 0, 0},
+    {114, 394, 0, 0},
+    {114, 395, 0, 0},
+    {114, 396, 0, 0},
+    {114, 397, 0, 0},
+    {114, 398, 0, 0},
+    {8005, 399, 0, 0},
+    {8007, 400, 0, 0},
+    {84, 401, 0, 0},
+    {10, 402, 0, 0},
+    {8010, 403, 0, 0},
+    {53, 404, 0, 0},
+    {20, 405, 0, 0},
+    {19, 406, 0, 0},
+    {18, 407, 0, 0},
+    {16, 408, 0, 0},
+    {23, 409, 0, 0},
+    {13, 410, 0, 0},
+    {12, 411, 0, 0},
+    {22, 412, 0, 0},
+    {21, 413, 0, 0},
+    {10060, 414, 0, 0},
+    {10060, 415, 0, 0},
+    {10060, 416, 0, 0},
+    {10060, 417, 0, 0},
+    {10060, 418, 0, 0},
+    {10060, 419, 0, 0},
+    {10060, 420, 0, 0},
+    {10060, 421, 0, 0},
+    {10060, 422, 0, 0},
+    {10060, 423, 0, 0},
+    {10080, 424, 0, 0},
+    {114, 425, 0, 0},
+    {114, 426, 0, 0},
+    {114, 427, 0, 0},
+    {114, 428, 0, 0},
+    {114, 429, 0, 0},
+    {114, 430, 0, 0},
+    {9001, 431, 0, 0},
+    {9001, 432, 0, 0},
+    {9001, 433, 0, 0},
+    {9001, 434, 0, 0},
+    {9001, 435, 0, 0},
+    {114, 436, 0, 0},
+    {114, 437, 0, 0},
+    {114, 438, 0, 0},
+    {114, 439, 0, 0},
+    {114, 440, 0, 0},
+    {114, 441, 0, 0},
+    {10060, 442, 0, 0},
+    {10060, 443, 0, 0},
+    {10060, 444, 0, 0},
+    {10060, 445, 0, 0},
+    {10060, 446, 0, 0},
+    {10060, 447, 0, 0},
+    {115, 448, 0, 0},
+    {115, 449, 0, 0},
+    {115, 450, 0, 0},
+    {10030, 451, 0, 0},
+    {10030, 452, 0, 0},
+    {10030, 453, 0, 0},
+    {10030, 454, 0, 0},
+    {9001, 455, 0, 0},
+    {10060, 456, 0, 0},
+    {10060, 457, 0, 0},
+    {10060, 458, 0, 0},
+    {10060, 459, 0, 0},
+    {114, 460, 0, 0},
+    {114, 461, 0, 0},
+    {114, 462, 0, 0},
+    {114, 463, 0, 0},
+    {114, 464, 0, 0},
+    {114, 465, 0, 0},
+    {10030, 466, 0, 0},
+    {10030, 467, 0, 0},
+    {120, 468, 0, 0},
+    {121, 469, 0, 0},
+    {30, 470, 0, 0},
+    {10120, 471, 0, 0},
+    {10120, 472, 0, 0},
+    {10120, 473, 0, 0},
+    {10120, 474, 0, 0},
+    {81, 475, 0, 0},
+    {81, 476, 0, 0},
+    {81, 477, 0, 0},
+    {81, 478, 0, 0},
+    {82, 479, 0, 0},
+    {11, 480, 0, 0},
+    {11, 481, 0, 0},
+    {11, 482, 0, 0},
+    {11, 483, 0, 0},
+    {9100, 484, 0, 0},
+    {9101, 485, 0, 0},
+    {9102, 486, 0, 0},
+    {9103, 487, 0, 0},
+    {9100, 488, 0, 0},
+    {9101, 489, 0, 0},
+    {9102, 490, 0, 0},
+    {9103, 491, 0, 0},
+    {9100, 492, 0, 0},
+    {9101, 493, 0, 0},
+    {9102, 494, 0, 0},
+    {9103, 495, 0, 0},
+    // Effluvium
+    {3002, 0, 0, 0},
+    {3000, 1, 0, 0},
+    {14, 2, 0, 0},
+    {14, 3, 0, 0},
+    {1, 4, 0, 0},
+    {10000, 5, 0, 0},
+    {10000, 6, 0, 0},
+    {10000, 7, 0, 0},
+    {1406, 8, 0, 0},
+    {1406, 9, 0, 0},
+    {1406, 10, 0, 0},
+    {1406, 11, 0, 0},
+    {1406, 12, 0, 0},
+    {1406, 13, 0, 0},
+    {1406, 14, 0, 0},
+    {1406, 15, 0, 0},
+    {1406, 16, 0, 0},
+    {1406, 17, 0, 0},
+    {1406, 18, 0, 0},
+    {1406, 19, 0, 0},
+    {1406, 20, 0, 0},
+    {1406, 21, 0, 0},
+    {1406, 22, 0, 0},
+    {1406, 23, 0, 0},
+    {1406, 24, 0, 0},
+    {1406, 25, 0, 0},
+    {1406, 26, 0, 0},
+    {8104, 27, 0, 0},
+    {8104, 28, 0, 0},
+    {8104, 29, 0, 0},
+    {8104, 30, 0, 0},
+    {8104, 31, 0, 0},
+    {80, 32, 0, 0},
+    {80, 33, 0, 0},
+    {87, 34, 0, 0},
+    {87, 35, 0, 0},
+    {80, 36, 0, 0},
+    {87, 37, 0, 0},
+    {37, 38, 0, 0},
+    {38, 39, 0, 0},
+    {28, 40, 0, 0},
+    {87, 41, 0, 0},
+    {80, 42, 0, 0},
+    {87, 43, 0, 0},
+    {87, 44, 0, 0},
+    {87, 45, 0, 0},
+    {80, 46, 0, 0},
+    {80, 47, 0, 0},
+    {80, 48, 0, 0},
+    {71, 49, 0, 0},
+    {71, 50, 0, 0},
+    {108, 51, 0, 0},
+    {108, 52, 0, 0},
+    {58, 53, 0, 0},
+    {58, 54, 0, 0},
+    {58, 55, 0, 0},
+    {58, 56, 0, 0},
+    {58, 57, 0, 0},
+    {58, 58, 0, 0},
+    {58, 59, 0, 0},
+    {58, 60, 0, 0},
+    {58, 61, 0, 0},
+    {58, 62, 0, 0},
+    {58, 63, 0, 0},
+    {58, 64, 0, 0},
+    {58, 65, 0, 0},
+    {59, 66, 0, 0},
+    {59, 67, 0, 0},
+    {59, 68, 0, 0},
+    {59, 69, 0, 0},
+    {58, 70, 0, 0},
+    {58, 71, 0, 0},
+    {59, 72, 0, 0},
+    {59, 73, 0, 0},
+    {59, 74, 0, 0},
+    {59, 75, 0, 0},
+    {59, 76, 0, 0},
+    {59, 77, 0, 0},
+    {59, 78, 0, 0},
+    {59, 79, 0, 0},
+    {59, 80, 0, 0},
+    {59, 81, 0, 0},
+    {59, 82, 0, 0},
+    {59, 83, 0, 0},
+    {59, 84, 0, 0},
+    {59, 85, 0, 0},
+    {59, 86, 0, 0},
+    {59, 87, 0, 0},
+    {58, 88, 0, 0},
+    {58, 89, 0, 0},
+    {58, 90, 0, 0},
+    {58, 91, 0, 0},
+    {58, 92, 0, 0},
+    {58, 93, 0, 0},
+    {58, 94, 0, 0},
+    {59, 95, 0, 0},
+    {59, 96, 0, 0},
+    {59, 97, 0, 0},
+    {59, 98, 0, 0},
+    {58, 99, 0, 0},
+    {58, 100, 0, 0},
+    {58, 101, 0, 0},
+    {58, 102, 0, 0},
+    {1406, 103, 0, 0},
+    {8006, 104, 0, 0},
+    {32, 105, 0, 0},
+    {30, 106, 0, 0},
+    {8000, 107, 0, 0},
+    {8000, 108, 0, 0},
+    {8000, 109, 0, 0},
+    {8000, 110, 0, 0},
+    {8000, 111, 0, 0},
+    {8000, 112, 0, 0},
+    {81, 113, 0, 0},
+    {81, 114, 0, 0},
+    {81, 115, 0, 0},
+    {81, 116, 0, 0},
+    {82, 117, 0, 0},
+    {82, 118, 0, 0},
+    {82, 119, 0, 0},
+    {10, 120, 0, 0},
+    {8041, 121, 0, 0},
+    {121, 122, 0, 0},
+    {121, 123, 0, 0},
+    {121, 124, 0, 0},
+    {120, 125, 0, 0},
+    {120, 126, 0, 0},
+    {120, 127, 0, 0},
+    {120, 128, 0, 0},
+    {121, 129, 0, 0},
+    {121, 130, 0, 0},
+    {8080, 131, 0, 0},
+    {10030, 132, 0, 0},
+    {10030, 133, 0, 0},
+    {10030, 134, 0, 0},
+    {10030, 135, 0, 0},
+    {121, 136, 0, 0},
+    {121, 137, 0, 0},
+    {10030, 138, 0, 0},
+    {10030, 139, 0, 0},
+    {10030, 140, 0, 0},
+    {10030, 141, 0, 0},
+    {10030, 142, 0, 0},
+    {10030, 143, 0, 0},
+    {121, 144, 0, 0},
+    {121, 145, 0, 0},
+    {121, 146, 0, 0},
+    {121, 147, 0, 0},
+    {107, 148, 0, 0},
+    {107, 149, 0, 0},
+    {107, 150, 0, 0},
+    {107, 151, 0, 0},
+    {8080, 152, 0, 0},
+    {8080, 153, 0, 0},
+    {8080, 154, 0, 0},
+    {8080, 155, 0, 0},
+    {8080, 156, 0, 0},
+    {115, 157, 0, 0},
+    {115, 158, 0, 0},
+    {10030, 159, 0, 0},
+    {10030, 160, 0, 0},
+    {122, 161, 0, 0},
+    {122, 162, 0, 0},
+    {122, 163, 0, 0},
+    {122, 164, 0, 0},
+    {122, 165, 0, 0},
+    {122, 166, 0, 0},
+    {124, 167, 0, 0},
+    {124, 168, 0, 0},
+    {124, 169, 0, 0},
+    {124, 170, 0, 0},
+    {10110, 171, 0, 0},
+    {10110, 172, 0, 0},
+    {10110, 173, 0, 0},
+    {10110, 174, 0, 0},
+    {10110, 175, 0, 0},
+    {10110, 176, 0, 0},
+    {81, 177, 0, 0},
+    {81, 178, 0, 0},
+    {81, 179, 0, 0},
+    {81, 180, 0, 0},
+    {81, 181, 0, 0},
+    {81, 182, 0, 0},
+    {8003, 183, 0, 0},
+    {8000, 184, 0, 0},
+    {8000, 185, 0, 0},
+    {8000, 186, 0, 0},
+    {8000, 187, 0, 0},
+    {124, 188, 0, 0},
+    {124, 189, 0, 0},
+    {122, 190, 0, 0},
+    {122, 191, 0, 0},
+    {124, 192, 0, 0},
+    {124, 193, 0, 0},
+    {124, 194, 0, 0},
+    {122, 195, 0, 0},
+    {122, 196, 0, 0},
+    {122, 197, 0, 0},
+    {10110, 198, 0, 0},
+    {10110, 199, 0, 0},
+    {10110, 200, 0, 0},
+    {10110, 201, 0, 0},
+    {10110, 202, 0, 0},
+    {10110, 203, 0, 0},
+    {124, 204, 0, 0},
+    {124, 205, 0, 0},
+    {81, 206, 0, 0},
+    {81, 207, 0, 0},
+    {81, 208, 0, 0},
+    {81, 209, 0, 0},
+    {81, 210, 0, 0},
+    {81, 211, 0, 0},
+    {81, 212, 0, 0},
+    {81, 213, 0, 0},
+    {81, 214, 0, 0},
+    {81, 215, 0, 0},
+    {81, 216, 0, 0},
+    {81, 217, 0, 0},
+    {2, 218, 0, 0},
+    {3, 219, 0, 0},
+    {4, 220, 0, 0},
+    {1, 221, 0, 0},
+    {2, 222, 0, 0},
+    {3, 223, 0, 0},
+    {4, 224, 0, 0},
+    {1, 225, 0, 0},
+    {2, 226, 0, 0},
+    {3, 227, 0, 0},
+    {4, 228, 0, 0},
+    {4, 229, 0, 0},
+    {3, 230, 0, 0},
+    {2, 231, 0, 0},
+    {1, 232, 0, 0},
+    {8035, 233, 0, 0},
+    {11, 234, 0, 0},
+    {11, 235, 0, 0},
+    {11, 236, 0, 0},
+    {11, 237, 0, 0},
+    {10, 238, 0, 0},
+    {8010, 239, 0, 0},
+    {53, 240, 0, 0},
+    {8009, 241, 0, 0},
+    {123, 242, 0, 0},
+    {8040, 243, 0, 0},
+    {20, 244, 0, 0},
+    {16, 245, 0, 0},
+    {23, 246, 0, 0},
+    {22, 247, 0, 0},
+    {13, 248, 0, 0},
+    {19, 249, 0, 0},
+    {18, 250, 0, 0},
+    {12, 251, 0, 0},
+    {21, 252, 0, 0},
+    {8008, 253, 0, 0},
+    {8005, 254, 0, 0},
+    {8002, 255, 0, 0},
+    {8041, 256, 0, 0},
+    {30, 257, 0, 0},
+    {8007, 258, 0, 0},
+    {32, 259, 0, 0},
+    {36, 260, 0, 0},
+    {33, 261, 0, 0},
+    {10040, 262, 0, 0},
+    {9001, 263, 0, 0},
+    {9001, 264, 0, 0},
+    {9001, 265, 0, 0},
+    {9001, 266, 0, 0},
+    {9001, 267, 0, 0},
+    {33, 268, 0, 0},
+    {120, 269, 0, 0},
+    {107, 270, 0, 0},
+    {107, 271, 0, 0},
+    {10030, 272, 0, 0},
+    {10030, 273, 0, 0},
+    {10060, 274, 0, 0},
+    {121, 275, 0, 0},
+    {120, 276, 0, 0},
+    {120, 277, 0, 0},
+    {8080, 278, 0, 0},
+    {121, 279, 0, 0},
+    {84, 280, 0, 0},
+    {84, 281, 0, 0},
+    {10120, 282, 0, 0},
+    {10120, 283, 0, 0},
+    {10120, 284, 0, 0},
+    {10120, 285, 0, 0},
+    {11, 286, 0, 0},
+    {11, 287, 0, 0},
+    {11, 288, 0, 0},
+    {11, 289, 0, 0},
+    {9100, 290, 0, 0},
+    {9101, 291, 0, 0},
+    {9102, 292, 0, 0},
+    {9103, 293, 0, 0},
+    {9100, 294, 0, 0},
+    {9101, 295, 0, 0},
+    {9102, 296, 0, 0},
+    {9103, 297, 0, 0},
+    {9100, 298, 0, 0},
+    {9101, 299, 0, 0},
+    {9102, 300, 0, 0},
+    {9103, 301, 0, 0},
+    {9100, 302, 0, 0},
+    {9101, 303, 0, 0},
+    {9102, 304, 0, 0},
+    {9103, 305, 0, 0},
+    // Dungeons
+    {1, 0, 0, 0},
+    {3000, 1, 0, 0},
+    {3001, 2, 0, 0},
+    {3002, 3, 0, 0},
+    {3000, 4, 0, 0},
+    {9001, 5, 0, 0},
+    {9001, 6, 0, 0},
+    {9001, 7, 0, 0},
+    {9001, 8, 0, 0},
+    {9001, 9, 0, 0},
+    {9001, 10, 0, 0},
+    {9001, 11, 0, 0},
+    {55, 12, 0, 0},
+    {55, 13, 0, 0},
+    {55, 14, 0, 0},
+    {55, 15, 0, 0},
+    {55, 16, 0, 0},
+    {55, 17, 0, 0},
+    {55, 18, 0, 0},
+    {55, 19, 0, 0},
+    {55, 20, 0, 0},
+    {55, 21, 0, 0},
+    {55, 22, 0, 0},
+    {55, 23, 0, 0},
+    {55, 24, 0, 0},
+    {55, 25, 0, 0},
+    {55, 26, 0, 0},
+    {55, 27, 0, 0},
+    {55, 28, 0, 0},
+    {110, 29, 0, 0},
+    {110, 30, 0, 0},
+    {109, 31, 0, 0},
+    {62, 32, 0, 0},
+    {62, 33, 0, 0},
+    {71, 34, 0, 0},
+    {111, 35, 0, 0},
+    {111, 36, 0, 0},
+    {111, 37, 0, 0},
+    {111, 38, 0, 0},
+    {111, 39, 0, 0},
+    {111, 40, 0, 0},
+    {111, 41, 0, 0},
+    {111, 42, 0, 0},
+    {111, 43, 0, 0},
+    {111, 44, 0, 0},
+    {111, 45, 0, 0},
+    {71, 46, 0, 0},
+    {110, 47, 0, 0},
+    {62, 48, 0, 0},
+    {62, 49, 0, 0},
+    {62, 50, 0, 0},
+    {110, 51, 0, 0},
+    {108, 52, 0, 0},
+    {109, 53, 0, 0},
+    {109, 54, 0, 0},
+    {71, 55, 0, 0},
+    {62, 56, 0, 0},
+    {62, 57, 0, 0},
+    {62, 58, 0, 0},
+    {110, 59, 0, 0},
+    {110, 60, 0, 0},
+    {108, 61, 0, 0},
+    {108, 62, 0, 0},
+    {108, 63, 0, 0},
+    {109, 64, 0, 0},
+    {108, 65, 0, 0},
+    {108, 66, 0, 0},
+    {109, 67, 0, 0},
+    {108, 68, 0, 0},
+    {110, 69, 0, 0},
+    {110, 70, 0, 0},
+    {110, 71, 0, 0},
+    {110, 72, 0, 0},
+    {110, 73, 0, 0},
+    {110, 74, 0, 0},
+    {110, 75, 0, 0},
+    {110, 76, 0, 0},
+    {110, 77, 0, 0},
+    {110, 78, 0, 0},
+    {110, 79, 0, 0},
+    {62, 80, 0, 0},
+    {62, 81, 0, 0},
+    {62, 82, 0, 0},
+    {62, 83, 0, 0},
+    {62, 84, 0, 0},
+    {62, 85, 0, 0},
+    {62, 86, 0, 0},
+    {62, 87, 0, 0},
+    {62, 88, 0, 0},
+    {62, 89, 0, 0},
+    {62, 90, 0, 0},
+    {110, 91, 0, 0},
+    {110, 92, 0, 0},
+    {108, 93, 0, 0},
+    {108, 94, 0, 0},
+    {109, 95, 0, 0},
+    {109, 96, 0, 0},
+    {71, 97, 0, 0},
+    {71, 98, 0, 0},
+    {71, 99, 0, 0},
+    {61, 100, 0, 0},
+    {55, 101, 0, 0},
+    {55, 102, 0, 0},
+    {55, 103, 0, 0},
+    {55, 104, 0, 0},
+    {54, 105, 0, 0},
+    {54, 106, 0, 0},
+    {54, 107, 0, 0},
+    {54, 108, 0, 0},
+    {54, 109, 0, 0},
+    {54, 110, 0, 0},
+    {8100, 111, 0, 0},
+    {8100, 112, 0, 0},
+    {8100, 113, 0, 0},
+    {8100, 114, 0, 0},
+    {100, 115, 0, 0},
+    {101, 116, 0, 0},
+    {102, 117, 0, 0},
+    {108, 118, 0, 0},
+    {108, 119, 0, 0},
+    {109, 120, 0, 0},
+    {71, 121, 0, 0},
+    {71, 122, 0, 0},
+    {8100, 123, 0, 0},
+    {8100, 124, 0, 0},
+    {8100, 125, 0, 0},
+    {8100, 126, 0, 0},
+    {110, 127, 0, 0},
+    {110, 128, 0, 0},
+    {110, 129, 0, 0},
+    {110, 130, 0, 0},
+    {110, 131, 0, 0},
+    {110, 132, 0, 0},
+    {110, 133, 0, 0},
+    {110, 134, 0, 0},
+    {62, 135, 0, 0},
+    {62, 136, 0, 0},
+    {62, 137, 0, 0},
+    {62, 138, 0, 0},
+    {71, 139, 0, 0},
+    {109, 140, 0, 0},
+    {110, 141, 0, 0},
+    {110, 142, 0, 0},
+    {110, 143, 0, 0},
+    {8100, 144, 0, 0},
+    {8100, 145, 0, 0},
+    {8100, 146, 0, 0},
+    {8100, 147, 0, 0},
+    {8100, 148, 0, 0},
+    {110, 149, 0, 0},
+    {110, 150, 0, 0},
+    {110, 151, 0, 0},
+    {110, 152, 0, 0},
+    {9001, 153, 0, 0},
+    {31, 154, 0, 0},
+    {31, 155, 0, 0},
+    {31, 156, 0, 0},
+    {31, 157, 0, 0},
+    {55, 158, 0, 0},
+    {55, 159, 0, 0},
+    {55, 160, 0, 0},
+    {55, 161, 0, 0},
+    {55, 162, 0, 0},
+    {55, 163, 0, 0},
+    {55, 164, 0, 0},
+    {55, 165, 0, 0},
+    {55, 166, 0, 0},
+    {55, 167, 0, 0},
+    {55, 168, 0, 0},
+    {55, 169, 0, 0},
+    {55, 170, 0, 0},
+    {55, 171, 0, 0},
+    {55, 172, 0, 0},
+    {55, 173, 0, 0},
+    {55, 174, 0, 0},
+    {55, 175, 0, 0},
+    {55, 176, 0, 0},
+    {55, 177, 0, 0},
+    {55, 178, 0, 0},
+    {55, 179, 0, 0},
+    {55, 180, 0, 0},
+    {55, 181, 0, 0},
+    {55, 182, 0, 0},
+    {55, 183, 0, 0},
+    {10030, 184, 0, 0},
+    {10030, 185, 0, 0},
+    {10030, 186, 0, 0},
+    {10030, 187, 0, 0},
+    {10030, 188, 0, 0},
+    {10030, 189, 0, 0},
+    {10030, 190, 0, 0},
+    {10030, 191, 0, 0},
+    {10030, 192, 0, 0},
+    {52, 193, 0, 0},
+    {52, 194, 0, 0},
+    {52, 195, 0, 0},
+    {56, 196, 0, 0},
+    {56, 197, 0, 0},
+    {57, 198, 0, 0},
+    {57, 199, 0, 0},
+    {57, 200, 0, 0},
+    {57, 201, 0, 0},
+    {57, 202, 0, 0},
+    {57, 203, 0, 0},
+    {57, 204, 0, 0},
+    {56, 205, 0, 0},
+    {52, 206, 0, 0},
+    {50, 207, 0, 0},
+    {50, 208, 0, 0},
+    {50, 209, 0, 0},
+    {51, 210, 0, 0},
+    {51, 211, 0, 0},
+    {51, 212, 0, 0},
+    {10060, 213, 0, 0},
+    {10060, 214, 0, 0},
+    {8100, 215, 0, 0},
+    {8100, 216, 0, 0},
+    {8100, 217, 0, 0},
+    {8100, 218, 0, 0},
+    {54, 219, 0, 0},
+    {116, 220, 0, 0},
+    {116, 221, 0, 0},
+    {116, 222, 0, 0},
+    {116, 223, 0, 0},
+    {62, 224, 0, 0},
+    {62, 225, 0, 0},
+    {62, 226, 0, 0},
+    {108, 227, 0, 0},
+    {108, 228, 0, 0},
+    {109, 229, 0, 0},
+    {109, 230, 0, 0},
+    {109, 231, 0, 0},
+    {61, 232, 0, 0},
+    {61, 233, 0, 0},
+    {61, 234, 0, 0},
+    {61, 235, 0, 0},
+    {71, 236, 0, 0},
+    {71, 237, 0, 0},
+    {71, 238, 0, 0},
+    {10060, 239, 0, 0},
+    {10060, 240, 0, 0},
+    {10060, 241, 0, 0},
+    {116, 242, 0, 0},
+    {116, 243, 0, 0},
+    {116, 244, 0, 0},
+    {116, 245, 0, 0},
+    {116, 246, 0, 0},
+    {8005, 247, 0, 0},
+    {30, 248, 0, 0},
+    {10110, 249, 0, 0},
+    {10110, 250, 0, 0},
+    {8004, 251, 0, 0},
+    {8000, 252, 0, 0},
+    {8000, 253, 0, 0},
+    {8000, 254, 0, 0},
+    {8000, 255, 0, 0},
+    {8000, 256, 0, 0},
+    {8000, 257, 0, 0},
+    {8000, 258, 0, 0},
+    {8000, 259, 0, 0},
+    {8000, 260, 0, 0},
+    {8000, 261, 0, 0},
+    {8000, 262, 0, 0},
+    {8000, 263, 0, 0},
+    {8000, 264, 0, 0},
+    {53, 265, 0, 0},
+    {10060, 266, 0, 0},
+    {10060, 267, 0, 0},
+    {10060, 268, 0, 0},
+    {8070, 269, 0, 0},
+    {8069, 270, 0, 0},
+    {8070, 271, 0, 0},
+    {8067, 272, 0, 0},
+    {8067, 273, 0, 0},
+    {8067, 274, 0, 0},
+    {8067, 275, 0, 0},
+    {8067, 276, 0, 0},
+    {8067, 277, 0, 0},
+    {8067, 278, 0, 0},
+    {115, 279, 0, 0},
+    {115, 280, 0, 0},
+    {115, 281, 0, 0},
+    {115, 282, 0, 0},
+    {10030, 283, 0, 0},
+    {10030, 284, 0, 0},
+    {10030, 285, 0, 0},
+    {10030, 286, 0, 0},
+    {10030, 287, 0, 0},
+    {10030, 288, 0, 0},
+    {10030, 289, 0, 0},
+    {10030, 290, 0, 0},
+    {121, 291, 0, 0},
+    {121, 292, 0, 0},
+    {10060, 293, 0, 0},
+    {10060, 294, 0, 0},
+    {10060, 295, 0, 0},
+    {10060, 296, 0, 0},
+    {10030, 297, 0, 0},
+    {10030, 298, 0, 0},
+    {10030, 299, 0, 0},
+    {10030, 300, 0, 0},
+    {107, 301, 0, 0},
+    {115, 302, 0, 0},
+    {115, 303, 0, 0},
+    {10030, 304, 0, 0},
+    {10030, 305, 0, 0},
+    {10030, 306, 0, 0},
+    {10030, 307, 0, 0},
+    {10030, 308, 0, 0},
+    {10030, 309, 0, 0},
+    {31, 310, 0, 0},
+    {31, 311, 0, 0},
+    {114, 312, 0, 0},
+    {114, 313, 0, 0},
+    {114, 314, 0, 0},
+    {109, 315, 0, 0},
+    {109, 316, 0, 0},
+    {8067, 317, 0, 0},
+    {8067, 318, 0, 0},
+    {8067, 319, 0, 0},
+    {8004, 320, 0, 0},
+    {8004, 321, 0, 0},
+    {8067, 322, 0, 0},
+    {8067, 323, 0, 0},
+    {8067, 324, 0, 0},
+    {8067, 325, 0, 0},
+    {11, 326, 0, 0},
+    {11, 327, 0, 0},
+    {11, 328, 0, 0},
+    {11, 329, 0, 0},
+    {124, 330, 0, 0},
+    {124, 331, 0, 0},
+    {124, 332, 0, 0},
+    {124, 333, 0, 0},
+    {124, 334, 0, 0},
+    {8000, 335, 0, 0},
+    {8000, 336, 0, 0},
+    {8000, 337, 0, 0},
+    {8000, 338, 0, 0},
+    {8000, 339, 0, 0},
+    {8000, 340, 0, 0},
+    {10110, 341, 0, 0},
+    {10110, 342, 0, 0},
+    {10110, 343, 0, 0},
+    {10110, 344, 0, 0},
+    {10110, 345, 0, 0},
+    {10110, 346, 0, 0},
+    {8000, 347, 0, 0},
+    {8000, 348, 0, 0},
+    {8000, 349, 0, 0},
+    {8000, 350, 0, 0},
+    {8000, 351, 0, 0},
+    {8000, 352, 0, 0},
+    {8004, 353, 0, 0},
+    {124, 354, 0, 0},
+    {124, 355, 0, 0},
+    {124, 356, 0, 0},
+    {124, 357, 0, 0},
+    {122, 358, 0, 0},
+    {122, 359, 0, 0},
+    {122, 360, 0, 0},
+    {122, 361, 0, 0},
+    {81, 362, 0, 0},
+    {81, 363, 0, 0},
+    {81, 364, 0, 0},
+    {81, 365, 0, 0},
+    {81, 366, 0, 0},
+    {81, 367, 0, 0},
+    {8000, 368, 0, 0},
+    {8000, 369, 0, 0},
+    {8000, 370, 0, 0},
+    {8000, 371, 0, 0},
+    {8000, 372, 0, 0},
+    {8000, 373, 0, 0},
+    {8000, 374, 0, 0},
+    {8000, 375, 0, 0},
+    {8000, 376, 0, 0},
+    {124, 377, 0, 0},
+    {124, 378, 0, 0},
+    {124, 379, 0, 0},
+    {124, 380, 0, 0},
+    {122, 381, 0, 0},
+    {122, 382, 0, 0},
+    {122, 383, 0, 0},
+    {122, 384, 0, 0},
+    {8004, 385, 0, 0},
+    {10110, 386, 0, 0},
+    {10110, 387, 0, 0},
+    {10110, 388, 0, 0},
+    {10110, 389, 0, 0},
+    {10110, 390, 0, 0},
+    {10110, 391, 0, 0},
+    {10110, 392, 0, 0},
+    {10110, 393, 0, 0},
+    {82, 394, 0, 0},
+    {82, 395, 0, 0},
+    {82, 396, 0, 0},
+    {124, 397, 0, 0},
+    {124, 398, 0, 0},
+    {124, 399, 0, 0},
+    {124, 400, 0, 0},
+    {122, 401, 0, 0},
+    {122, 402, 0, 0},
+    {122, 403, 0, 0},
+    {122, 404, 0, 0},
+    {10110, 405, 0, 0},
+    {10110, 406, 0, 0},
+    {10110, 407, 0, 0},
+    {10110, 408, 0, 0},
+    {10110, 409, 0, 0},
+    {10110, 410, 0, 0},
+    {8004, 411, 0, 0},
+    {124, 412, 0, 0},
+    {122, 413, 0, 0},
+    {122, 414, 0, 0},
+    {124, 415, 0, 0},
+    {8004, 416, 0, 0},
+    {82, 417, 0, 0},
+    {82, 418, 0, 0},
+    {82, 419, 0, 0},
+    {82, 420, 0, 0},
+    {81, 421, 0, 0},
+    {81, 422, 0, 0},
+    {81, 423, 0, 0},
+    {81, 424, 0, 0},
+    {81, 425, 0, 0},
+    {81, 426, 0, 0},
+    {81, 427, 0, 0},
+    {81, 428, 0, 0},
+    {81, 429, 0, 0},
+    {81, 430, 0, 0},
+    {81, 431, 0, 0},
+    {81, 432, 0, 0},
+    {81, 433, 0, 0},
+    {81, 434, 0, 0},
+    {81, 435, 0, 0},
+    {81, 436, 0, 0},
+    {81, 437, 0, 0},
+    {81, 438, 0, 0},
+    {81, 439, 0, 0},
+    {81, 440, 0, 0},
+    {81, 441, 0, 0},
+    {81, 442, 0, 0},
+    {81, 443, 0, 0},
+    {82, 444, 0, 0},
+    {82, 445, 0, 0},
+    {2, 446, 0, 0},
+    {3, 447, 0, 0},
+    {4, 448, 0, 0},
+    {1, 449, 0, 0},
+    {2, 450, 0, 0},
+    {3, 451, 0, 0},
+    {4, 452, 0, 0},
+    {71, 453, 0, 0},
+    {108, 454, 0, 0},
+    {109, 455, 0, 0},
+    {71, 456, 0, 0},
+    {31, 457, 0, 0},
+    {31, 458, 0, 0},
+    {31, 459, 0, 0},
+    {31, 460, 0, 0},
+    {31, 461, 0, 0},
+    {31, 462, 0, 0},
+    {10030, 463, 0, 0},
+    {10030, 464, 0, 0},
+    {10030, 465, 0, 0},
+    {10030, 466, 0, 0},
+    {10030, 467, 0, 0},
+    {10030, 468, 0, 0},
+    {10030, 469, 0, 0},
+    {10030, 470, 0, 0},
+    {10030, 471, 0, 0},
+    {8006, 472, 0, 0},
+    {8007, 473, 0, 0},
+    {8008, 474, 0, 0},
+    {8041, 475, 0, 0},
+    {8010, 476, 0, 0},
+    {123, 477, 0, 0},
+    {16, 478, 0, 0},
+    {13, 479, 0, 0},
+    {12, 480, 0, 0},
+    {10, 481, 0, 0},
+    {8009, 482, 0, 0},
+    {20, 483, 0, 0},
+    {19, 484, 0, 0},
+    {18, 485, 0, 0},
+    {8040, 486, 0, 0},
+    {23, 487, 0, 0},
+    {22, 488, 0, 0},
+    {21, 489, 0, 0},
+    {9001, 490, 0, 0},
+    {9001, 491, 0, 0},
+    {9001, 492, 0, 0},
+    {9001, 493, 0, 0},
+    {9001, 494, 0, 0},
+    {10030, 495, 0, 0},
+    {10030, 496, 0, 0},
+    {10030, 497, 0, 0},
+    {10060, 498, 0, 0},
+    {10060, 499, 0, 0},
+    {10060, 500, 0, 0},
+    {10060, 501, 0, 0},
+    {10060, 502, 0, 0},
+    {10060, 503, 0, 0},
+    {31, 504, 0, 0},
+    {31, 505, 0, 0},
+    {10030, 506, 0, 0},
+    {10030, 507, 0, 0},
+    {10030, 508, 0, 0},
+    {10030, 509, 0, 0},
+    {10030, 510, 0, 0},
+    {10030, 511, 0, 0},
+    {115, 512, 0, 0},
+    {115, 513, 0, 0},
+    {115, 514, 0, 0},
+    {31, 515, 0, 0},
+    {31, 516, 0, 0},
+    {107, 517, 0, 0},
+    {107, 518, 0, 0},
+    {84, 519, 0, 0},
+    {84, 520, 0, 0},
+    {10120, 521, 0, 0},
+    {10120, 522, 0, 0},
+    {10120, 523, 0, 0},
+    {10120, 524, 0, 0},
+    {11, 525, 0, 0},
+    {11, 526, 0, 0},
+    {11, 527, 0, 0},
+    {11, 528, 0, 0},
+    {9100, 529, 0, 0},
+    {9101, 530, 0, 0},
+    {9102, 531, 0, 0},
+    {9103, 532, 0, 0},
+    {9100, 533, 0, 0},
+    {9101, 534, 0, 0},
+    {9102, 535, 0, 0},
+    {9103, 536, 0, 0},
+    // Desolate Garden
+    {1406, 0, 0, 0},
+    {1406, 1, 0, 0},
+    {1406, 2, 0, 0},
+    {1406, 3, 0, 0},
+    {1406, 4, 0, 0},
+    {1, 5, 0, 0},
+    {78, 6, 0, 0},
+    {78, 7, 0, 0},
+    {78, 8, 0, 0},
+    {78, 9, 0, 0},
+    {113, 10, 0, 0},
+    {113, 11, 0, 0},
+    {9001, 12, 0, 0},
+    {9001, 13, 0, 0},
+    {9001, 14, 0, 0},
+    {9001, 15, 0, 0},
+    {9001, 16, 0, 0},
+    {9001, 17, 0, 0},
+    {9001, 18, 0, 0},
+    {9001, 19, 0, 0},
+    {9001, 20, 0, 0},
+    {9001, 21, 0, 0},
+    {9001, 22, 0, 0},
+    {9001, 23, 0, 0},
+    {9001, 24, 0, 0},
+    {77, 25, 0, 0},
+    {77, 26, 0, 0},
+    {77, 27, 0, 0},
+    {77, 28, 0, 0},
+    {77, 29, 0, 0},
+    {77, 30, 0, 0},
+    {54, 31, 0, 0},
+    {54, 32, 0, 0},
+    {54, 33, 0, 0},
+    {54, 34, 0, 0},
+    {54, 35, 0, 0},
+    {54, 36, 0, 0},
+    {116, 37, 0, 0},
+    {116, 38, 0, 0},
+    {103, 39, 0, 0},
+    {103, 40, 0, 0},
+    {116, 41, 0, 0},
+    {116, 42, 0, 0},
+    {77, 43, 0, 0},
+    {77, 44, 0, 0},
+    {77, 45, 0, 0},
+    {77, 46, 0, 0},
+    {77, 47, 0, 0},
+    {77, 48, 0, 0},
+    {77, 49, 0, 0},
+    {8100, 50, 0, 0},
+    {8100, 51, 0, 0},
+    {8100, 52, 0, 0},
+    {8100, 53, 0, 0},
+    {8100, 54, 0, 0},
+    {8100, 55, 0, 0},
+    {8100, 56, 0, 0},
+    {1406, 57, 0, 0},
+    {59, 58, 0, 0},
+    {59, 59, 0, 0},
+    {59, 60, 0, 0},
+    {58, 61, 0, 0},
+    {58, 62, 0, 0},
+    {58, 63, 0, 0},
+    {59, 64, 0, 0},
+    {8003, 65, 0, 0},
+    {8010, 66, 0, 0},
+    {10, 67, 0, 0},
+    {53, 68, 0, 0},
+    {8040, 69, 0, 0},
+    {8009, 70, 0, 0},
+    {123, 71, 0, 0},
+    {16, 72, 0, 0},
+    {13, 73, 0, 0},
+    {12, 74, 0, 0},
+    {20, 75, 0, 0},
+    {19, 76, 0, 0},
+    {18, 77, 0, 0},
+    {23, 78, 0, 0},
+    {22, 79, 0, 0},
+    {21, 80, 0, 0},
+    {10110, 81, 0, 0},
+    {10110, 82, 0, 0},
+    {8000, 83, 0, 0},
+    {8000, 84, 0, 0},
+    {8000, 85, 0, 0},
+    {8000, 86, 0, 0},
+    {8000, 87, 0, 0},
+    {8000, 88, 0, 0},
+    {8000, 89, 0, 0},
+    {8000, 90, 0, 0},
+    {114, 91, 0, 0},
+    {114, 92, 0, 0},
+    {114, 93, 0, 0},
+    {114, 94, 0, 0},
+    {107, 95, 0, 0},
+    {107, 96, 0, 0},
+    {107, 97, 0, 0},
+    {115, 98, 0, 0},
+    {10030, 99, 0, 0},
+    {10030, 100, 0, 0},
+    {10030, 101, 0, 0},
+    {10030, 102, 0, 0},
+    {10060, 103, 0, 0},
+    {10060, 104, 0, 0},
+    {10060, 105, 0, 0},
+    {10060, 106, 0, 0},
+    {10060, 107, 0, 0},
+    {10060, 108, 0, 0},
+    {10060, 109, 0, 0},
+    {10060, 110, 0, 0},
+    {10060, 111, 0, 0},
+    {10060, 112, 0, 0},
+    {10060, 113, 0, 0},
+    {10060, 114, 0, 0},
+    {10030, 115, 0, 0},
+    {10030, 116, 0, 0},
+    {10030, 117, 0, 0},
+    {10030, 118, 0, 0},
+    {10030, 119, 0, 0},
+    {10030, 120, 0, 0},
+    {31, 121, 0, 0},
+    {31, 122, 0, 0},
+    {31, 123, 0, 0},
+    {31, 124, 0, 0},
+    {31, 125, 0, 0},
+    {31, 126, 0, 0},
+    {31, 127, 0, 0},
+    {11, 128, 0, 0},
+    {11, 129, 0, 0},
+    {10110, 130, 0, 0},
+    {10110, 131, 0, 0},
+    {10110, 132, 0, 0},
+    {10110, 133, 0, 0},
+    {10110, 134, 0, 0},
+    {10110, 135, 0, 0},
+    {10110, 136, 0, 0},
+    {10110, 137, 0, 0},
+    {122, 138, 0, 0},
+    {122, 139, 0, 0},
+    {122, 140, 0, 0},
+    {122, 141, 0, 0},
+    {124, 142, 0, 0},
+    {124, 143, 0, 0},
+    {124, 144, 0, 0},
+    {124, 145, 0, 0},
+    {82, 146, 0, 0},
+    {82, 147, 0, 0},
+    {81, 148, 0, 0},
+    {81, 149, 0, 0},
+    {81, 150, 0, 0},
+    {81, 151, 0, 0},
+    {81, 152, 0, 0},
+    {81, 153, 0, 0},
+    {81, 154, 0, 0},
+    {81, 155, 0, 0},
+    {81, 156, 0, 0},
+    {81, 157, 0, 0},
+    {81, 158, 0, 0},
+    {81, 159, 0, 0},
+    {8004, 160, 0, 0},
+    {8004, 161, 0, 0},
+    {8004, 162, 0, 0},
+    {8004, 163, 0, 0},
+    {8000, 164, 0, 0},
+    {8000, 165, 0, 0},
+    {8000, 166, 0, 0},
+    {8000, 167, 0, 0},
+    {8000, 168, 0, 0},
+    {8000, 169, 0, 0},
+    {10110, 170, 0, 0},
+    {10110, 171, 0, 0},
+    {10110, 172, 0, 0},
+    {10110, 173, 0, 0},
+    {10110, 174, 0, 0},
+    {10110, 175, 0, 0},
+    {81, 176, 0, 0},
+    {81, 177, 0, 0},
+    {81, 178, 0, 0},
+    {81, 179, 0, 0},
+    {81, 180, 0, 0},
+    {81, 181, 0, 0},
+    {122, 182, 0, 0},
+    {122, 183, 0, 0},
+    {124, 184, 0, 0},
+    {124, 185, 0, 0},
+    {124, 186, 0, 0},
+    {124, 187, 0, 0},
+    {122, 188, 0, 0},
+    {122, 189, 0, 0},
+    {2, 190, 0, 0},
+    {3, 191, 0, 0},
+    {4, 192, 0, 0},
+    {11, 193, 0, 0},
+    {11, 194, 0, 0},
+    {8010, 195, 0, 0},
+    {123, 196, 0, 0},
+    {10, 197, 0, 0},
+    {8009, 198, 0, 0},
+    {53, 199, 0, 0},
+    {8040, 200, 0, 0},
+    {8008, 201, 0, 0},
+    {8005, 202, 0, 0},
+    {8007, 203, 0, 0},
+    {8006, 204, 0, 0},
+    {9001, 205, 0, 0},
+    {9001, 206, 0, 0},
+    {9001, 207, 0, 0},
+    {9001, 208, 0, 0},
+    {9001, 209, 0, 0},
+    {10030, 210, 0, 0},
+    {10030, 211, 0, 0},
+    {31, 212, 0, 0},
+    {31, 213, 0, 0},
+    {114, 214, 0, 0},
+    {31, 215, 0, 0},
+    {8080, 216, 0, 0},
+    {115, 217, 0, 0},
+    {84, 218, 0, 0},
+    {84, 219, 0, 0},
+    {10120, 220, 0, 0},
+    {10120, 221, 0, 0},
+    {9100, 222, 0, 0},
+    {9101, 223, 0, 0},
+    {9102, 224, 0, 0},
+    {9103, 225, 0, 0},
+    {11, 226, 0, 0},
+    {11, 227, 0, 0},
+    {11, 228, 0, 0},
+    {11, 229, 0, 0},
+    // Necropolis
+    {3002, 0, 0, 0},
+    {3002, 1, 0, 0},
+    {3000, 2, 0, 0},
+    {3000, 3, 0, 0},
+    {14, 4, 0, 0},
+    {1, 5, 0, 0},
+    {65, 6, 0, 0},
+    {65, 7, 0, 0},
+    {65, 8, 0, 0},
+    {65, 9, 0, 0},
+    {65, 10, 0, 0},
+    {65, 11, 0, 0},
+    {67, 12, 0, 0},
+    {67, 13, 0, 0},
+    {67, 14, 0, 0},
+    {67, 15, 0, 0},
+    {67, 16, 0, 0},
+    {67, 17, 0, 0},
+    {63, 18, 0, 0},
+    {63, 19, 0, 0},
+    {63, 20, 0, 0},
+    {63, 21, 0, 0},
+    {63, 22, 0, 0},
+    {68, 23, 0, 0},
+    {68, 24, 0, 0},
+    {68, 25, 0, 0},
+    {68, 26, 0, 0},
+    {68, 27, 0, 0},
+    {69, 28, 0, 0},
+    {66, 29, 0, 0},
+    {64, 30, 0, 0},
+    {78, 31, 0, 0},
+    {78, 32, 0, 0},
+    {78, 33, 0, 0},
+    {79, 34, 0, 0},
+    {79, 35, 0, 0},
+    {79, 36, 0, 0},
+    {79, 37, 0, 0},
+    {15, 38, 0, 0},
+    {15, 39, 0, 0},
+    {15, 40, 0, 0},
+    {9, 41, 0, 0},
+    {9, 42, 0, 0},
+    {9, 43, 0, 0},
+    {7, 44, 0, 0},
+    {7, 45, 0, 0},
+    {7, 46, 0, 0},
+    {6, 47, 0, 0},
+    {6, 48, 0, 0},
+    {6, 49, 0, 0},
+    {6, 50, 0, 0},
+    {6, 51, 0, 0},
+    {7, 52, 0, 0},
+    {42, 53, 0, 0},
+    {44, 54, 0, 0},
+    {45, 55, 0, 0},
+    {15, 56, 0, 0},
+    {9, 57, 0, 0},
+    {7, 58, 0, 0},
+    {6, 59, 0, 0},
+    {8104, 60, 0, 0},
+    {8104, 61, 0, 0},
+    {8104, 62, 0, 0},
+    {8104, 63, 0, 0},
+    {8104, 64, 0, 0},
+    {8060, 65, 0, 0},
+    {8060, 66, 0, 0},
+    {8060, 67, 0, 0},
+    {8060, 68, 0, 0},
+    {8060, 69, 0, 0},
+    {8060, 70, 0, 0},
+    {8060, 71, 0, 0},
+    {8060, 72, 0, 0},
+    {8060, 73, 0, 0},
+    {8060, 74, 0, 0},
+    {107, 75, 0, 0},
+    {8003, 76, 0, 0},
+    {8002, 77, 0, 0},
+    {8007, 78, 0, 0},
+    {34, 79, 0, 0},
+    {34, 80, 0, 0},
+    {34, 81, 0, 0},
+    {34, 82, 0, 0},
+    {34, 83, 0, 0},
+    {34, 84, 0, 0},
+    {34, 85, 0, 0},
+    {34, 86, 0, 0},
+    {34, 87, 0, 0},
+    {34, 88, 0, 0},
+    {34, 89, 0, 0},
+    {34, 90, 0, 0},
+    {34, 91, 0, 0},
+    {34, 92, 0, 0},
+    {34, 93, 0, 0},
+    {34, 94, 0, 0},
+    {34, 95, 0, 0},
+    {10011, 96, 0, 0},
+    {10011, 97, 0, 0},
+    {10011, 98, 0, 0},
+    {10011, 99, 0, 0},
+    {10011, 100, 0, 0},
+    {10011, 101, 0, 0},
+    {10011, 102, 0, 0},
+    {10011, 103, 0, 0},
+    {10011, 104, 0, 0},
+    {10011, 105, 0, 0},
+    {10011, 106, 0, 0},
+    {10011, 107, 0, 0},
+    {10011, 108, 0, 0},
+    {10011, 109, 0, 0},
+    {10011, 110, 0, 0},
+    {10011, 111, 0, 0},
+    {10011, 112, 0, 0},
+    {10011, 113, 0, 0},
+    {10011, 114, 0, 0},
+    {10011, 115, 0, 0},
+    {10011, 116, 0, 0},
+    {10011, 117, 0, 0},
+    {10011, 118, 0, 0},
+    {10011, 119, 0, 0},
+    {10011, 120, 0, 0},
+    {10011, 121, 0, 0},
+    {10011, 122, 0, 0},
+    {10011, 123, 0, 0},
+    {10011, 124, 0, 0},
+    {10011, 125, 0, 0},
+    {10011, 126, 0, 0},
+    {10011, 127, 0, 0},
+    {10011, 128, 0, 0},
+    {10011, 129, 0, 0},
+    {10011, 130, 0, 0},
+    {10011, 131, 0, 0},
+    {10011, 132, 0, 0},
+    {10011, 133, 0, 0},
+    {10011, 134, 0, 0},
+    {10011, 135, 0, 0},
+    {10011, 136, 0, 0},
+    {10011, 137, 0, 0},
+    {10011, 138, 0, 0},
+    {10011, 139, 0, 0},
+    {10011, 140, 0, 0},
+    {10011, 141, 0, 0},
+    {10011, 142, 0, 0},
+    {10011, 143, 0, 0},
+    {10011, 144, 0, 0},
+    {107, 145, 0, 0},
+    {107, 146, 0, 0},
+    {107, 147, 0, 0},
+    {107, 148, 0, 0},
+    {107, 149, 0, 0},
+    {107, 150, 0, 0},
+    {107, 151, 0, 0},
+    {107, 152, 0, 0},
+    {107, 153, 0, 0},
+    {107, 154, 0, 0},
+    {107, 155, 0, 0},
+    {107, 156, 0, 0},
+    {107, 157, 0, 0},
+    {107, 158, 0, 0},
+    {107, 159, 0, 0},
+    {107, 160, 0, 0},
+    {107, 161, 0, 0},
+    {107, 162, 0, 0},
+    {107, 163, 0, 0},
+    {107, 164, 0, 0},
+    {107, 165, 0, 0},
+    {114, 166, 0, 0},
+    {114, 167, 0, 0},
+    {114, 168, 0, 0},
+    {114, 169, 0, 0},
+    {114, 170, 0, 0},
+    {114, 171, 0, 0},
+    {114, 172, 0, 0},
+    {114, 173, 0, 0},
+    {114, 174, 0, 0},
+    {114, 175, 0, 0},
+    {114, 176, 0, 0},
+    {114, 177, 0, 0},
+    {114, 178, 0, 0},
+    {114, 179, 0, 0},
+    {114, 180, 0, 0},
+    {114, 181, 0, 0},
+    {114, 182, 0, 0},
+    {114, 183, 0, 0},
+    {114, 184, 0, 0},
+    {114, 185, 0, 0},
+    {114, 186, 0, 0},
+    {114, 187, 0, 0},
+    {114, 188, 0, 0},
+    {8080, 189, 0, 0},
+    {8080, 190, 0, 0},
+    {8080, 191, 0, 0},
+    {8080, 192, 0, 0},
+    {8080, 193, 0, 0},
+    {10030, 194, 0, 0},
+    {10030, 195, 0, 0},
+    {10030, 196, 0, 0},
+    {10030, 197, 0, 0},
+    {82, 198, 0, 0},
+    {82, 199, 0, 0},
+    {82, 200, 0, 0},
+    {82, 201, 0, 0},
+    {82, 202, 0, 0},
+    {82, 203, 0, 0},
+    {8000, 204, 0, 0},
+    {8000, 205, 0, 0},
+    {8000, 206, 0, 0},
+    {8000, 207, 0, 0},
+    {8000, 208, 0, 0},
+    {8000, 209, 0, 0},
+    {10110, 210, 0, 0},
+    {10110, 211, 0, 0},
+    {10110, 212, 0, 0},
+    {10110, 213, 0, 0},
+    {10110, 214, 0, 0},
+    {10110, 215, 0, 0},
+    {82, 216, 0, 0},
+    {82, 217, 0, 0},
+    {82, 218, 0, 0},
+    {82, 219, 0, 0},
+    {82, 220, 0, 0},
+    {82, 221, 0, 0},
+    {10110, 222, 0, 0},
+    {10110, 223, 0, 0},
+    {10110, 224, 0, 0},
+    {10110, 225, 0, 0},
+    {10110, 226, 0, 0},
+    {10110, 227, 0, 0},
+    {8000, 228, 0, 0},
+    {8000, 229, 0, 0},
+    {8000, 230, 0, 0},
+    {8000, 231, 0, 0},
+    {8000, 232, 0, 0},
+    {8000, 233, 0, 0},
+    {8000, 234, 0, 0},
+    {8000, 235, 0, 0},
+    {8000, 236, 0, 0},
+    {8000, 237, 0, 0},
+    {8000, 238, 0, 0},
+    {8000, 239, 0, 0},
+    {82, 240, 0, 0},
+    {82, 241, 0, 0},
+    {82, 242, 0, 0},
+    {82, 243, 0, 0},
+    {82, 244, 0, 0},
+    {82, 245, 0, 0},
+    {10110, 246, 0, 0},
+    {10110, 247, 0, 0},
+    {10110, 248, 0, 0},
+    {10110, 249, 0, 0},
+    {10110, 250, 0, 0},
+    {10110, 251, 0, 0},
+    {8004, 252, 0, 0},
+    {8004, 253, 0, 0},
+    {8004, 254, 0, 0},
+    {8004, 255, 0, 0},
+    {8004, 256, 0, 0},
+    {8004, 257, 0, 0},
+    {8004, 258, 0, 0},
+    {8004, 259, 0, 0},
+    {8004, 260, 0, 0},
+    {8004, 261, 0, 0},
+    {8004, 262, 0, 0},
+    {8004, 263, 0, 0},
+    {8004, 264, 0, 0},
+    {8004, 265, 0, 0},
+    {122, 266, 0, 0},
+    {122, 267, 0, 0},
+    {122, 268, 0, 0},
+    {122, 269, 0, 0},
+    {122, 270, 0, 0},
+    {122, 271, 0, 0},
+    {122, 272, 0, 0},
+    {122, 273, 0, 0},
+    {124, 274, 0, 0},
+    {124, 275, 0, 0},
+    {124, 276, 0, 0},
+    {124, 277, 0, 0},
+    {124, 278, 0, 0},
+    {124, 279, 0, 0},
+    {124, 280, 0, 0},
+    {124, 281, 0, 0},
+    {124, 282, 0, 0},
+    {124, 283, 0, 0},
+    {124, 284, 0, 0},
+    {124, 285, 0, 0},
+    {122, 286, 0, 0},
+    {122, 287, 0, 0},
+    {122, 288, 0, 0},
+    {122, 289, 0, 0},
+    {81, 290, 0, 0},
+    {81, 291, 0, 0},
+    {81, 292, 0, 0},
+    {81, 293, 0, 0},
+    {81, 294, 0, 0},
+    {81, 295, 0, 0},
+    {81, 296, 0, 0},
+    {81, 297, 0, 0},
+    {81, 298, 0, 0},
+    {81, 299, 0, 0},
+    {81, 300, 0, 0},
+    {81, 301, 0, 0},
+    {81, 302, 0, 0},
+    {81, 303, 0, 0},
+    {81, 304, 0, 0},
+    {81, 305, 0, 0},
+    {81, 306, 0, 0},
+    {81, 307, 0, 0},
+    {81, 308, 0, 0},
+    {81, 309, 0, 0},
+    {81, 310, 0, 0},
+    {81, 311, 0, 0},
+    {81, 312, 0, 0},
+    {81, 313, 0, 0},
+    {81, 314, 0, 0},
+    {81, 315, 0, 0},
+    {81, 316, 0, 0},
+    {81, 317, 0, 0},
+    {81, 318, 0, 0},
+    {81, 319, 0, 0},
+    {81, 320, 0, 0},
+    {81, 321, 0, 0},
+    {81, 322, 0, 0},
+    {81, 323, 0, 0},
+    {81, 324, 0, 0},
+    {81, 325, 0, 0},
+    {81, 326, 0, 0},
+    {81, 327, 0, 0},
+    {81, 328, 0, 0},
+    {81, 329, 0, 0},
+    {81, 330, 0, 0},
+    {81, 331, 0, 0},
+    {4, 332, 0, 0},
+    {3, 333, 0, 0},
+    {2, 334, 0, 0},
+    {1, 335, 0, 0},
+    {1, 336, 0, 0},
+    {2, 337, 0, 0},
+    {3, 338, 0, 0},
+    {4, 339, 0, 0},
+    {1, 340, 0, 0},
+    {2, 341, 0, 0},
+    {3, 342, 0, 0},
+    {4, 343, 0, 0},
+    {1, 344, 0, 0},
+    {2, 345, 0, 0},
+    {3, 346, 0, 0},
+    {4, 347, 0, 0},
+    {11, 348, 0, 0},
+    {11, 349, 0, 0},
+    {11, 350, 0, 0},
+    {11, 351, 0, 0},
+    {10, 352, 0, 0},
+    {8010, 353, 0, 0},
+    {53, 354, 0, 0},
+    {8009, 355, 0, 0},
+    {123, 356, 0, 0},
+    {8040, 357, 0, 0},
+    {22, 358, 0, 0},
+    {23, 359, 0, 0},
+    {21, 360, 0, 0},
+    {16, 361, 0, 0},
+    {13, 362, 0, 0},
+    {12, 363, 0, 0},
+    {20, 364, 0, 0},
+    {19, 365, 0, 0},
+    {18, 366, 0, 0},
+    {8008, 367, 0, 0},
+    {8005, 368, 0, 0},
+    {8003, 369, 0, 0},
+    {8002, 370, 0, 0},
+    {8041, 371, 0, 0},
+    {84, 372, 0, 0},
+    {84, 373, 0, 0},
+    {30, 374, 0, 0},
+    {83, 375, 0, 0},
+    {32, 376, 0, 0},
+    {8007, 377, 0, 0},
+    {8006, 378, 0, 0},
+    {86, 379, 0, 0},
+    {36, 380, 0, 0},
+    {33, 381, 0, 0},
+    {10040, 382, 0, 0},
+    {9001, 383, 0, 0},
+    {9001, 384, 0, 0},
+    {9001, 385, 0, 0},
+    {9001, 386, 0, 0},
+    {9001, 387, 0, 0},
+    {10011, 388, 0, 0},
+    {10011, 389, 0, 0},
+    {10011, 390, 0, 0},
+    {10011, 391, 0, 0},
+    {10011, 392, 0, 0},
+    {10011, 393, 0, 0},
+    {10011, 394, 0, 0},
+    {10011, 395, 0, 0},
+    {10011, 396, 0, 0},
+    {10011, 397, 0, 0},
+    {10011, 398, 0, 0},
+    {114, 399, 0, 0},
+    {114, 400, 0, 0},
+    {8080, 401, 0, 0},
+    {107, 402, 0, 0},
+    {115, 403, 0, 0},
+    {115, 404, 0, 0},
+    {115, 405, 0, 0},
+    {114, 406, 0, 0},
+    {114, 407, 0, 0},
+    {114, 408, 0, 0},
+    {31, 409, 0, 0},
+    {31, 410, 0, 0},
+    {31, 411, 0, 0},
+    {10120, 412, 0, 0},
+    {10120, 413, 0, 0},
+    {10120, 414, 0, 0},
+    {10120, 415, 0, 0},
+    {122, 416, 0, 0},
+    {122, 417, 0, 0},
+    {122, 418, 0, 0},
+    {122, 419, 0, 0},
+    {122, 420, 0, 0},
+    {122, 421, 0, 0},
+    {122, 422, 0, 0},
+    {122, 423, 0, 0},
+    {122, 424, 0, 0},
+    {124, 425, 0, 0},
+    {124, 426, 0, 0},
+    {124, 427, 0, 0},
+    {124, 428, 0, 0},
+    {124, 429, 0, 0},
+    {124, 430, 0, 0},
+    {124, 431, 0, 0},
+    {124, 432, 0, 0},
+    {124, 433, 0, 0},
+    {124, 434, 0, 0},
+    {124, 435, 0, 0},
+    {124, 436, 0, 0},
+    {124, 437, 0, 0},
+    {122, 438, 0, 0},
+    {122, 439, 0, 0},
+    {122, 440, 0, 0},
+    {122, 441, 0, 0},
+    {2, 442, 0, 0},
+    {3, 443, 0, 0},
+    {4, 444, 0, 0},
+    {8004, 445, 0, 0},
+    {8004, 446, 0, 0},
+    {8004, 447, 0, 0},
+    {8004, 448, 0, 0},
+    {8004, 449, 0, 0},
+    {8004, 450, 0, 0},
+    {8004, 451, 0, 0},
+    {8004, 452, 0, 0},
+    {8004, 453, 0, 0},
+    {8004, 454, 0, 0},
+    {8004, 455, 0, 0},
+    {8004, 456, 0, 0},
+    {8004, 457, 0, 0},
+    {8004, 458, 0, 0},
+    {8004, 459, 0, 0},
+    {8004, 460, 0, 0},
+    {8004, 461, 0, 0},
+    {8004, 462, 0, 0},
+    {8004, 463, 0, 0},
+    {8004, 464, 0, 0},
+    {8004, 465, 0, 0},
+    {8004, 466, 0, 0},
+    {8004, 467, 0, 0},
+    {8004, 468, 0, 0},
+    {8004, 469, 0, 0},
+    {8004, 470, 0, 0},
+    {8004, 471, 0, 0},
+    {8004, 472, 0, 0},
+    {8004, 473, 0, 0},
+    {8004, 474, 0, 0},
+    {8004, 475, 0, 0},
+    {8004, 476, 0, 0},
+    {8004, 477, 0, 0},
+    {10, 478, 0, 0},
+    {8010, 479, 0, 0},
+    {53, 480, 0, 0},
+    {8040, 481, 0, 0},
+    {123, 482, 0, 0},
+    {8009, 483, 0, 0},
+    {11, 484, 0, 0},
+    {11, 485, 0, 0},
+    {11, 486, 0, 0},
+    {11, 487, 0, 0},
+    {9100, 488, 0, 0},
+    {9101, 489, 0, 0},
+    {9102, 490, 0, 0},
+    {9103, 491, 0, 0},
+    {9100, 492, 0, 0},
+    {9101, 493, 0, 0},
+    {9102, 494, 0, 0},
+    {9103, 495, 0, 0},
+    {9100, 496, 0, 0},
+    {9101, 497, 0, 0},
+    {9102, 498, 0, 0},
+    {9103, 499, 0, 0},
+    {9100, 500, 0, 0},
+    {9101, 501, 0, 0},
+    {9102, 502, 0, 0},
+    {9103, 503, 0, 0},
+    {9100, 504, 0, 0},
+    {9101, 505, 0, 0},
+    {9102, 506, 0, 0},
+    {9103, 507, 0, 0},
+    // Zedek's Tomb
+    {1, 0, 0, 0},
+    {3002, 1, 0, 0},
+    {3002, 2, 0, 0},
+    {3002, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {3002, 5, 0, 0},
+    {3002, 6, 0, 0},
+    {3002, 7, 0, 0},
+    {3002, 8, 0, 0},
+    {3002, 9, 0, 0},
+    {3002, 10, 0, 0},
+    {3000, 11, 0, 0},
+    {3000, 12, 0, 0},
+    {3000, 13, 0, 0},
+    {3000, 14, 0, 0},
+    {3000, 15, 0, 0},
+    {3000, 16, 0, 0},
+    {3000, 17, 0, 0},
+    {3000, 18, 0, 0},
+    {3000, 19, 0, 0},
+    {3000, 20, 0, 0},
+    {3002, 21, 0, 0},
+    {3000, 22, 0, 0},
+    {14, 23, 0, 0},
+    {3000, 24, 0, 0},
+    {3000, 25, 0, 0},
+    {3000, 26, 0, 0},
+    {3002, 27, 0, 0},
+    {3002, 28, 0, 0},
+    {3002, 29, 0, 0},
+    {3001, 30, 0, 0},
+    {3001, 31, 0, 0},
+    {3001, 32, 0, 0},
+    {3000, 33, 0, 0},
+    {3000, 34, 0, 0},
+    {3000, 35, 0, 0},
+    {10100, 36, 0, 0},
+    {54, 37, 0, 0},
+    {54, 38, 0, 0},
+    {54, 39, 0, 0},
+    {54, 40, 0, 0},
+    {54, 41, 0, 0},
+    {54, 42, 0, 0},
+    {54, 43, 0, 0},
+    {54, 44, 0, 0},
+    {54, 45, 0, 0},
+    {54, 46, 0, 0},
+    {54, 47, 0, 0},
+    {54, 48, 0, 0},
+    {54, 49, 0, 0},
+    {54, 50, 0, 0},
+    {54, 51, 0, 0},
+    {54, 52, 0, 0},
+    {54, 53, 0, 0},
+    {54, 54, 0, 0},
+    {54, 55, 0, 0},
+    {54, 56, 0, 0},
+    {54, 57, 0, 0},
+    {54, 58, 0, 0},
+    {54, 59, 0, 0},
+    {54, 60, 0, 0},
+    {54, 61, 0, 0},
+    {54, 62, 0, 0},
+    {54, 63, 0, 0},
+    {54, 64, 0, 0},
+    {54, 65, 0, 0},
+    {54, 66, 0, 0},
+    {54, 67, 0, 0},
+    {54, 68, 0, 0},
+    {54, 69, 0, 0},
+    {54, 70, 0, 0},
+    {54, 71, 0, 0},
+    {54, 72, 0, 0},
+    {54, 73, 0, 0},
+    {54, 74, 0, 0},
+    {54, 75, 0, 0},
+    {54, 76, 0, 0},
+    {54, 77, 0, 0},
+    {54, 78, 0, 0},
+    {54, 79, 0, 0},
+    {54, 80, 0, 0},
+    {54, 81, 0, 0},
+    {54, 82, 0, 0},
+    {54, 83, 0, 0},
+    {54, 84, 0, 0},
+    {54, 85, 0, 0},
+    {54, 86, 0, 0},
+    {8005, 87, 0, 0},
+    {30, 88, 0, 0},
+    {10040, 89, 0, 0},
+    {16, 90, 0, 0},
+    {13, 91, 0, 0},
+    {12, 92, 0, 0},
+    {107, 93, 0, 0},
+    {107, 94, 0, 0},
+    {115, 95, 0, 0},
+    {115, 96, 0, 0},
+    {115, 97, 0, 0},
+    {107, 98, 0, 0},
+    {107, 99, 0, 0},
+    {107, 100, 0, 0},
+    {107, 101, 0, 0},
+    {107, 102, 0, 0},
+    {107, 103, 0, 0},
+    {107, 104, 0, 0},
+    {107, 105, 0, 0},
+    {107, 106, 0, 0},
+    {107, 107, 0, 0},
+    {107, 108, 0, 0},
+    {107, 109, 0, 0},
+    {115, 110, 0, 0},
+    {115, 111, 0, 0},
+    {115, 112, 0, 0},
+    {115, 113, 0, 0},
+    {107, 114, 0, 0},
+    {107, 115, 0, 0},
+    {107, 116, 0, 0},
+    {107, 117, 0, 0},
+    {107, 118, 0, 0},
+    {107, 119, 0, 0},
+    {107, 120, 0, 0},
+    {107, 121, 0, 0},
+    {107, 122, 0, 0},
+    {107, 123, 0, 0},
+    {107, 124, 0, 0},
+    {107, 125, 0, 0},
+    {107, 126, 0, 0},
+    {107, 127, 0, 0},
+    {107, 128, 0, 0},
+    {107, 129, 0, 0},
+    {107, 130, 0, 0},
+    {107, 131, 0, 0},
+    {107, 132, 0, 0},
+    {107, 133, 0, 0},
+    {107, 134, 0, 0},
+    {107, 135, 0, 0},
+    {107, 136, 0, 0},
+    {107, 137, 0, 0},
+    {107, 138, 0, 0},
+    {107, 139, 0, 0},
+    {115, 140, 0, 0},
+    {115, 141, 0, 0},
+    {115, 142, 0, 0},
+    {115, 143, 0, 0},
+    {107, 144, 0, 0},
+    {107, 145, 0, 0},
+    {107, 146, 0, 0},
+    {107, 147, 0, 0},
+    {107, 148, 0, 0},
+    {107, 149, 0, 0},
+    {107, 150, 0, 0},
+    {107, 151, 0, 0},
+    {107, 152, 0, 0},
+    {107, 153, 0, 0},
+    {107, 154, 0, 0},
+    {107, 155, 0, 0},
+    {107, 156, 0, 0},
+    {122, 157, 0, 0},
+    {122, 158, 0, 0},
+    {122, 159, 0, 0},
+    {124, 160, 0, 0},
+    {124, 161, 0, 0},
+    {124, 162, 0, 0},
+    {124, 163, 0, 0},
+    {124, 164, 0, 0},
+    {124, 165, 0, 0},
+    {124, 166, 0, 0},
+    {124, 167, 0, 0},
+    {124, 168, 0, 0},
+    {124, 169, 0, 0},
+    {124, 170, 0, 0},
+    {122, 171, 0, 0},
+    {122, 172, 0, 0},
+    {122, 173, 0, 0},
+    {122, 174, 0, 0},
+    {122, 175, 0, 0},
+    {122, 176, 0, 0},
+    {122, 177, 0, 0},
+    {122, 178, 0, 0},
+    {122, 179, 0, 0},
+    {122, 180, 0, 0},
+    {122, 181, 0, 0},
+    {122, 182, 0, 0},
+    {122, 183, 0, 0},
+    {122, 184, 0, 0},
+    {122, 185, 0, 0},
+    {122, 186, 0, 0},
+    {8000, 187, 0, 0},
+    {8000, 188, 0, 0},
+    {8000, 189, 0, 0},
+    {8000, 190, 0, 0},
+    {8000, 191, 0, 0},
+    {8000, 192, 0, 0},
+    {81, 193, 0, 0},
+    {81, 194, 0, 0},
+    {81, 195, 0, 0},
+    {81, 196, 0, 0},
+    {81, 197, 0, 0},
+    {81, 198, 0, 0},
+    {81, 199, 0, 0},
+    {81, 200, 0, 0},
+    {10110, 201, 0, 0},
+    {10110, 202, 0, 0},
+    {10110, 203, 0, 0},
+    {10110, 204, 0, 0},
+    {10110, 205, 0, 0},
+    {10110, 206, 0, 0},
+    {10110, 207, 0, 0},
+    {10110, 208, 0, 0},
+    {10110, 209, 0, 0},
+    {10110, 210, 0, 0},
+    {10110, 211, 0, 0},
+    {10110, 212, 0, 0},
+    {8000, 213, 0, 0},
+    {8000, 214, 0, 0},
+    {8000, 215, 0, 0},
+    {8000, 216, 0, 0},
+    {8000, 217, 0, 0},
+    {8000, 218, 0, 0},
+    {8000, 219, 0, 0},
+    {8000, 220, 0, 0},
+    {81, 221, 0, 0},
+    {81, 222, 0, 0},
+    {81, 223, 0, 0},
+    {81, 224, 0, 0},
+    {81, 225, 0, 0},
+    {81, 226, 0, 0},
+    {81, 227, 0, 0},
+    {81, 228, 0, 0},
+    {81, 229, 0, 0},
+    {81, 230, 0, 0},
+    {124, 231, 0, 0},
+    {124, 232, 0, 0},
+    {124, 233, 0, 0},
+    {124, 234, 0, 0},
+    {124, 235, 0, 0},
+    {124, 236, 0, 0},
+    {124, 237, 0, 0},
+    {124, 238, 0, 0},
+    {2, 239, 0, 0},
+    {3, 240, 0, 0},
+    {4, 241, 0, 0},
+    {9015, 242, 0, 0},
+    {11, 243, 0, 0},
+    {11, 244, 0, 0},
+    {11, 245, 0, 0},
+    {11, 246, 0, 0},
+    {10, 247, 0, 0},
+    {8010, 248, 0, 0},
+    {53, 249, 0, 0},
+    {8009, 250, 0, 0},
+    {123, 251, 0, 0},
+    {8040, 252, 0, 0},
+    {20, 253, 0, 0},
+    {16, 254, 0, 0},
+    {23, 255, 0, 0},
+    {13, 256, 0, 0},
+    {12, 257, 0, 0},
+    {22, 258, 0, 0},
+    {21, 259, 0, 0},
+    {19, 260, 0, 0},
+    {18, 261, 0, 0},
+    {8008, 262, 0, 0},
+    {8005, 263, 0, 0},
+    {8041, 264, 0, 0},
+    {8006, 265, 0, 0},
+    {86, 266, 0, 0},
+    {36, 267, 0, 0},
+    {10040, 268, 0, 0},
+    {9001, 269, 0, 0},
+    {9001, 270, 0, 0},
+    {9001, 271, 0, 0},
+    {9001, 272, 0, 0},
+    {9001, 273, 0, 0},
+    {115, 274, 0, 0},
+    {115, 275, 0, 0},
+    {115, 276, 0, 0},
+    {115, 277, 0, 0},
+    {115, 278, 0, 0},
+    {115, 279, 0, 0},
+    {107, 280, 0, 0},
+    {84, 281, 0, 0},
+    {84, 282, 0, 0},
+    {10120, 283, 0, 0},
+    {10120, 284, 0, 0},
+    {10120, 285, 0, 0},
+    {11, 286, 0, 0},
+    {11, 287, 0, 0},
+    {11, 288, 0, 0},
+    {11, 289, 0, 0},
+    {9100, 290, 0, 0},
+    {9101, 291, 0, 0},
+    {9102, 292, 0, 0},
+    {9103, 293, 0, 0},
+    // Melenkir's Tomb
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {11, 4, 0, 0},
+    {11, 5, 0, 0},
+    {11, 6, 0, 0},
+    {11, 7, 0, 0},
+    {118, 8, 0, 0},
+    {118, 9, 0, 0},
+    {118, 10, 0, 0},
+    {118, 11, 0, 0},
+    {118, 12, 0, 0},
+    {118, 13, 0, 0},
+    {118, 14, 0, 0},
+    {118, 15, 0, 0},
+    {118, 16, 0, 0},
+    {118, 17, 0, 0},
+    {118, 18, 0, 0},
+    {118, 19, 0, 0},
+    {118, 20, 0, 0},
+    {10102, 21, 0, 0},
+    {9001, 22, 0, 0},
+    {9001, 23, 0, 0},
+    {9001, 24, 0, 0},
+    {9001, 25, 0, 0},
+    {9001, 26, 0, 0},
+    {9001, 27, 0, 0},
+    {9001, 28, 0, 0},
+    {9001, 29, 0, 0},
+    {9001, 30, 0, 0},
+    {9001, 31, 0, 0},
+    {9001, 32, 0, 0},
+    {9001, 33, 0, 0},
+    {9001, 34, 0, 0},
+    {9001, 35, 0, 0},
+    {9001, 36, 0, 0},
+    {9001, 37, 0, 0},
+    {9001, 38, 0, 0},
+    {9001, 39, 0, 0},
+    {9001, 40, 0, 0},
+    {9001, 41, 0, 0},
+    {9001, 42, 0, 0},
+    {9001, 43, 0, 0},
+    {9001, 44, 0, 0},
+    {9001, 45, 0, 0},
+    {9001, 46, 0, 0},
+    {9001, 47, 0, 0},
+    {9001, 48, 0, 0},
+    {9001, 49, 0, 0},
+    {9001, 50, 0, 0},
+    {9001, 51, 0, 0},
+    {9001, 52, 0, 0},
+    {9001, 53, 0, 0},
+    {9001, 54, 0, 0},
+    {9001, 55, 0, 0},
+    {9001, 56, 0, 0},
+    {9001, 57, 0, 0},
+    {23, 58, 0, 0},
+    {22, 59, 0, 0},
+    {21, 60, 0, 0},
+    {32, 61, 0, 0},
+    {8041, 62, 0, 0},
+    {121, 63, 0, 0},
+    {121, 64, 0, 0},
+    {121, 65, 0, 0},
+    {121, 66, 0, 0},
+    {120, 67, 0, 0},
+    {120, 68, 0, 0},
+    {114, 69, 0, 0},
+    {114, 70, 0, 0},
+    {114, 71, 0, 0},
+    {114, 72, 0, 0},
+    {114, 73, 0, 0},
+    {114, 74, 0, 0},
+    {114, 75, 0, 0},
+    {114, 76, 0, 0},
+    {114, 77, 0, 0},
+    {114, 78, 0, 0},
+    {114, 79, 0, 0},
+    {114, 80, 0, 0},
+    {8080, 81, 0, 0},
+    {8080, 82, 0, 0},
+    {8080, 83, 0, 0},
+    {8080, 84, 0, 0},
+    {8080, 85, 0, 0},
+    {8080, 86, 0, 0},
+    {8080, 87, 0, 0},
+    {8080, 88, 0, 0},
+    {10060, 89, 0, 0},
+    {10060, 90, 0, 0},
+    {10060, 91, 0, 0},
+    {10060, 92, 0, 0},
+    {10060, 93, 0, 0},
+    {10060, 94, 0, 0},
+    {10060, 95, 0, 0},
+    {10060, 96, 0, 0},
+    {8000, 97, 0, 0},
+    {8000, 98, 0, 0},
+    {8000, 99, 0, 0},
+    {8000, 100, 0, 0},
+    {8000, 101, 0, 0},
+    {8000, 102, 0, 0},
+    {8000, 103, 0, 0},
+    {8000, 104, 0, 0},
+    {8000, 105, 0, 0},
+    {8000, 106, 0, 0},
+    {8000, 107, 0, 0},
+    {8000, 108, 0, 0},
+    {10030, 109, 0, 0},
+    {10030, 110, 0, 0},
+    {10030, 111, 0, 0},
+    {10030, 112, 0, 0},
+    {10030, 113, 0, 0},
+    {10030, 114, 0, 0},
+    {10030, 115, 0, 0},
+    {10030, 116, 0, 0},
+    {10030, 117, 0, 0},
+    {10030, 118, 0, 0},
+    {10030, 119, 0, 0},
+    {10030, 120, 0, 0},
+    {10110, 121, 0, 0},
+    {10110, 122, 0, 0},
+    {10110, 123, 0, 0},
+    {10110, 124, 0, 0},
+    {10110, 125, 0, 0},
+    {10110, 126, 0, 0},
+    {122, 127, 0, 0},
+    {122, 128, 0, 0},
+    {122, 129, 0, 0},
+    {122, 130, 0, 0},
+    {122, 131, 0, 0},
+    {122, 132, 0, 0},
+    {122, 133, 0, 0},
+    {122, 134, 0, 0},
+    {81, 135, 0, 0},
+    {81, 136, 0, 0},
+    {81, 137, 0, 0},
+    {81, 138, 0, 0},
+    {81, 139, 0, 0},
+    {81, 140, 0, 0},
+    {82, 141, 0, 0},
+    {82, 142, 0, 0},
+    {82, 143, 0, 0},
+    {82, 144, 0, 0},
+    {81, 145, 0, 0},
+    {81, 146, 0, 0},
+    {81, 147, 0, 0},
+    {81, 148, 0, 0},
+    {81, 149, 0, 0},
+    {81, 150, 0, 0},
+    {82, 151, 0, 0},
+    {82, 152, 0, 0},
+    {82, 153, 0, 0},
+    {82, 154, 0, 0},
+    {82, 155, 0, 0},
+    {82, 156, 0, 0},
+    {82, 157, 0, 0},
+    {82, 158, 0, 0},
+    {10110, 159, 0, 0},
+    {10110, 160, 0, 0},
+    {10110, 161, 0, 0},
+    {10110, 162, 0, 0},
+    {10110, 163, 0, 0},
+    {10110, 164, 0, 0},
+    {10110, 165, 0, 0},
+    {10110, 166, 0, 0},
+    {8000, 167, 0, 0},
+    {8000, 168, 0, 0},
+    {8000, 169, 0, 0},
+    {8000, 170, 0, 0},
+    {8000, 171, 0, 0},
+    {8000, 172, 0, 0},
+    {8000, 173, 0, 0},
+    {8000, 174, 0, 0},
+    {8000, 175, 0, 0},
+    {8000, 176, 0, 0},
+    {8000, 177, 0, 0},
+    {8000, 178, 0, 0},
+    {81, 179, 0, 0},
+    {81, 180, 0, 0},
+    {81, 181, 0, 0},
+    {81, 182, 0, 0},
+    {81, 183, 0, 0},
+    {81, 184, 0, 0},
+    {81, 185, 0, 0},
+    {81, 186, 0, 0},
+    {81, 187, 0, 0},
+    {81, 188, 0, 0},
+    {81, 189, 0, 0},
+    {81, 190, 0, 0},
+    {81, 191, 0, 0},
+    {81, 192, 0, 0},
+    {81, 193, 0, 0},
+    {81, 194, 0, 0},
+    {81, 195, 0, 0},
+    {81, 196, 0, 0},
+    {81, 197, 0, 0},
+    {81, 198, 0, 0},
+    {81, 199, 0, 0},
+    {81, 200, 0, 0},
+    {81, 201, 0, 0},
+    {81, 202, 0, 0},
+    {9017, 203, 0, 0},
+    {20, 204, 0, 0},
+    {19, 205, 0, 0},
+    {18, 206, 0, 0},
+    {16, 207, 0, 0},
+    {13, 208, 0, 0},
+    {12, 209, 0, 0},
+    {23, 210, 0, 0},
+    {22, 211, 0, 0},
+    {21, 212, 0, 0},
+    {8008, 213, 0, 0},
+    {8005, 214, 0, 0},
+    {8006, 215, 0, 0},
+    {8007, 216, 0, 0},
+    {10040, 217, 0, 0},
+    {10, 218, 0, 0},
+    {8010, 219, 0, 0},
+    {53, 220, 0, 0},
+    {8009, 221, 0, 0},
+    {123, 222, 0, 0},
+    {8040, 223, 0, 0},
+    {20, 224, 0, 0},
+    {9001, 225, 0, 0},
+    {9001, 226, 0, 0},
+    {9001, 227, 0, 0},
+    {9001, 228, 0, 0},
+    {9001, 229, 0, 0},
+    {120, 230, 0, 0},
+    {120, 231, 0, 0},
+    {114, 232, 0, 0},
+    {114, 233, 0, 0},
+    {114, 234, 0, 0},
+    {114, 235, 0, 0},
+    {114, 236, 0, 0},
+    {114, 237, 0, 0},
+    {10060, 238, 0, 0},
+    {10060, 239, 0, 0},
+    {84, 240, 0, 0},
+    {84, 241, 0, 0},
+    {10120, 242, 0, 0},
+    {10120, 243, 0, 0},
+    {10120, 244, 0, 0},
+    {9100, 245, 0, 0},
+    {9101, 246, 0, 0},
+    {9102, 247, 0, 0},
+    {9103, 248, 0, 0},
+    {11, 249, 0, 0},
+    {11, 250, 0, 0},
+    {11, 251, 0, 0},
+    {11, 252, 0, 0},
+    // Traductus' Tomb
+    {1, 0, 0, 0},
+    {14, 1, 0, 0},
+    {10101, 2, 0, 0},
+    {10030, 3, 0, 0},
+    {10030, 4, 0, 0},
+    {10030, 5, 0, 0},
+    {8006, 6, 0, 0},
+    {84, 7, 0, 0},
+    {20, 8, 0, 0},
+    {19, 9, 0, 0},
+    {18, 10, 0, 0},
+    {114, 11, 0, 0},
+    {114, 12, 0, 0},
+    {114, 13, 0, 0},
+    {114, 14, 0, 0},
+    {114, 15, 0, 0},
+    {114, 16, 0, 0},
+    {114, 17, 0, 0},
+    {114, 18, 0, 0},
+    {114, 19, 0, 0},
+    {114, 20, 0, 0},
+    {114, 21, 0, 0},
+    {10030, 22, 0, 0},
+    {10030, 23, 0, 0},
+    {10030, 24, 0, 0},
+    {10030, 25, 0, 0},
+    {114, 26, 0, 0},
+    {114, 27, 0, 0},
+    {114, 28, 0, 0},
+    {114, 29, 0, 0},
+    {114, 30, 0, 0},
+    {114, 31, 0, 0},
+    {114, 32, 0, 0},
+    {114, 33, 0, 0},
+    {114, 34, 0, 0},
+    {114, 35, 0, 0},
+    {114, 36, 0, 0},
+    {114, 37, 0, 0},
+    {114, 38, 0, 0},
+    {114, 39, 0, 0},
+    {114, 40, 0, 0},
+    {114, 41, 0, 0},
+    {114, 42, 0, 0},
+    {114, 43, 0, 0},
+    {114, 44, 0, 0},
+    {114, 45, 0, 0},
+    {114, 46, 0, 0},
+    {114, 47, 0, 0},
+    {114, 48, 0, 0},
+    {114, 49, 0, 0},
+    {114, 50, 0, 0},
+    {114, 51, 0, 0},
+    {114, 52, 0, 0},
+    {114, 53, 0, 0},
+    {114, 54, 0, 0},
+    {114, 55, 0, 0},
+    {114, 56, 0, 0},
+    {8080, 57, 0, 0},
+    {8080, 58, 0, 0},
+    {8080, 59, 0, 0},
+    {8080, 60, 0, 0},
+    {8080, 61, 0, 0},
+    {8080, 62, 0, 0},
+    {114, 63, 0, 0},
+    {114, 64, 0, 0},
+    {114, 65, 0, 0},
+    {114, 66, 0, 0},
+    {81, 67, 0, 0},
+    {81, 68, 0, 0},
+    {81, 69, 0, 0},
+    {81, 70, 0, 0},
+    {81, 71, 0, 0},
+    {81, 72, 0, 0},
+    {81, 73, 0, 0},
+    {81, 74, 0, 0},
+    {81, 75, 0, 0},
+    {81, 76, 0, 0},
+    {81, 77, 0, 0},
+    {82, 78, 0, 0},
+    {82, 79, 0, 0},
+    {82, 80, 0, 0},
+    {82, 81, 0, 0},
+    {10110, 82, 0, 0},
+    {10110, 83, 0, 0},
+    {10110, 84, 0, 0},
+    {10110, 85, 0, 0},
+    {10110, 86, 0, 0},
+    {10110, 87, 0, 0},
+    {10110, 88, 0, 0},
+    {10110, 89, 0, 0},
+    {10110, 90, 0, 0},
+    {10110, 91, 0, 0},
+    {10110, 92, 0, 0},
+    {10110, 93, 0, 0},
+    {10110, 94, 0, 0},
+    {10110, 95, 0, 0},
+    {8000, 96, 0, 0},
+    {8000, 97, 0, 0},
+    {8000, 98, 0, 0},
+    {8000, 99, 0, 0},
+    {8000, 100, 0, 0},
+    {114, 101, 0, 0},
+    {114, 102, 0, 0},
+    {114, 103, 0, 0},
+    {114, 104, 0, 0},
+    {82, 105, 0, 0},
+    {82, 106, 0, 0},
+    {82, 107, 0, 0},
+    {82, 108, 0, 0},
+    {82, 109, 0, 0},
+    {82, 110, 0, 0},
+    {81, 111, 0, 0},
+    {81, 112, 0, 0},
+    {81, 113, 0, 0},
+    {81, 114, 0, 0},
+    {81, 115, 0, 0},
+    {81, 116, 0, 0},
+    {8000, 117, 0, 0},
+    {8000, 118, 0, 0},
+    {8000, 119, 0, 0},
+    {8000, 120, 0, 0},
+    {8000, 121, 0, 0},
+    {8000, 122, 0, 0},
+    {10110, 123, 0, 0},
+    {10110, 124, 0, 0},
+    {10110, 125, 0, 0},
+    {10110, 126, 0, 0},
+    {10110, 127, 0, 0},
+    {10110, 128, 0, 0},
+    {10110, 129, 0, 0},
+    {10110, 130, 0, 0},
+    {4, 131, 0, 0},
+    {3, 132, 0, 0},
+    {2, 133, 0, 0},
+    {9016, 134, 0, 0},
+    {11, 135, 0, 0},
+    {11, 136, 0, 0},
+    {11, 137, 0, 0},
+    {11, 138, 0, 0},
+    {10, 139, 0, 0},
+    {8010, 140, 0, 0},
+    {53, 141, 0, 0},
+    {8009, 142, 0, 0},
+    {123, 143, 0, 0},
+    {8040, 144, 0, 0},
+    {20, 145, 0, 0},
+    {19, 146, 0, 0},
+    {18, 147, 0, 0},
+    {16, 148, 0, 0},
+    {13, 149, 0, 0},
+    {12, 150, 0, 0},
+    {23, 151, 0, 0},
+    {22, 152, 0, 0},
+    {21, 153, 0, 0},
+    {9001, 154, 0, 0},
+    {9001, 155, 0, 0},
+    {9001, 156, 0, 0},
+    {9001, 157, 0, 0},
+    {9001, 158, 0, 0},
+    {114, 159, 0, 0},
+    {114, 160, 0, 0},
+    {8080, 161, 0, 0},
+    {8080, 162, 0, 0},
+    {114, 163, 0, 0},
+    {114, 164, 0, 0},
+    {114, 165, 0, 0},
+    {114, 166, 0, 0},
+    {84, 167, 0, 0},
+    {84, 168, 0, 0},
+    {10120, 169, 0, 0},
+    {10120, 170, 0, 0},
+    {10120, 171, 0, 0},
+    {11, 172, 0, 0},
+    {11, 173, 0, 0},
+    {11, 174, 0, 0},
+    {11, 175, 0, 0},
+    {9100, 176, 0, 0},
+    {9101, 177, 0, 0},
+    {9102, 178, 0, 0},
+    {9103, 179, 0, 0},
+    // Vivarium
+    {1, 0, 0, 0},
+    {3001, 1, 0, 0},
+    {3000, 2, 0, 0},
+    {3000, 3, 0, 0},
+    {3002, 4, 0, 0},
+    {3001, 5, 0, 0},
+    {9001, 6, 0, 0},
+    {9001, 7, 0, 0},
+    {9001, 8, 0, 0},
+    {9001, 9, 0, 0},
+    {11, 10, 0, 0},
+    {11, 11, 0, 0},
+    {11, 12, 0, 0},
+    {11, 13, 0, 0},
+    {10090, 14, 0, 0},
+    {10090, 15, 0, 0},
+    {10090, 16, 0, 0},
+    {10090, 17, 0, 0},
+    {10090, 18, 0, 0},
+    {10090, 19, 0, 0},
+    {1402, 20, 0, 0},
+    {1402, 21, 0, 0},
+    {1402, 22, 0, 0},
+    {1402, 23, 0, 0},
+    {1400, 24, 0, 0},
+    {8060, 25, 0, 0},
+    {8060, 26, 0, 0},
+    {8060, 27, 0, 0},
+    {8060, 28, 0, 0},
+    {8060, 29, 0, 0},
+    {8060, 30, 0, 0},
+    {8060, 31, 0, 0},
+    {8060, 32, 0, 0},
+    {8061, 33, 0, 0},
+    {8061, 34, 0, 0},
+    {8061, 35, 0, 0},
+    {8061, 36, 0, 0},
+    {8061, 37, 0, 0},
+    {8061, 38, 0, 0},
+    {8061, 39, 0, 0},
+    {8061, 40, 0, 0},
+    {8043, 41, 0, 0},
+    {1404, 42, 0, 0},
+    {55, 43, 0, 0},
+    {55, 44, 0, 0},
+    {55, 45, 0, 0},
+    {55, 46, 0, 0},
+    {55, 47, 0, 0},
+    {55, 48, 0, 0},
+    {55, 49, 0, 0},
+    {55, 50, 0, 0},
+    {8060, 51, 0, 0},
+    {8060, 52, 0, 0},
+    {8060, 53, 0, 0},
+    {8060, 54, 0, 0},
+    {8060, 55, 0, 0},
+    {8060, 56, 0, 0},
+    {8060, 57, 0, 0},
+    {8060, 58, 0, 0},
+    {8061, 59, 0, 0},
+    {8061, 60, 0, 0},
+    {8061, 61, 0, 0},
+    {8061, 62, 0, 0},
+    {8061, 63, 0, 0},
+    {8061, 64, 0, 0},
+    {8061, 65, 0, 0},
+    {8061, 66, 0, 0},
+    {8061, 67, 0, 0},
+    {8061, 68, 0, 0},
+    {8061, 69, 0, 0},
+    {8061, 70, 0, 0},
+    {8047, 71, 0, 0},
+    {8047, 72, 0, 0},
+    {8047, 73, 0, 0},
+    {8047, 74, 0, 0},
+    {8047, 75, 0, 0},
+    {8051, 76, 0, 0},
+    {8051, 77, 0, 0},
+    {8051, 78, 0, 0},
+    {8051, 79, 0, 0},
+    {8047, 80, 0, 0},
+    {8047, 81, 0, 0},
+    {8047, 82, 0, 0},
+    {8047, 83, 0, 0},
+    {8047, 84, 0, 0},
+    {8051, 85, 0, 0},
+    {8047, 86, 0, 0},
+    {8051, 87, 0, 0},
+    {8047, 88, 0, 0},
+    {8047, 89, 0, 0},
+    {3000, 90, 0, 0},
+    {116, 91, 0, 0},
+    {116, 92, 0, 0},
+    {116, 93, 0, 0},
+    {116, 94, 0, 0},
+    {116, 95, 0, 0},
+    {116, 96, 0, 0},
+    {116, 97, 0, 0},
+    {116, 98, 0, 0},
+    {116, 99, 0, 0},
+    {116, 100, 0, 0},
+    {116, 101, 0, 0},
+    {116, 102, 0, 0},
+    {8041, 103, 0, 0},
+    {32, 104, 0, 0},
+    {10110, 105, 0, 0},
+    {10110, 106, 0, 0},
+    {10110, 107, 0, 0},
+    {10110, 108, 0, 0},
+    {8008, 109, 0, 0},
+    {8005, 110, 0, 0},
+    {8007, 111, 0, 0},
+    {8006, 112, 0, 0},
+    {10040, 113, 0, 0},
+    {81, 114, 0, 0},
+    {81, 115, 0, 0},
+    {81, 116, 0, 0},
+    {81, 117, 0, 0},
+    {81, 118, 0, 0},
+    {81, 119, 0, 0},
+    {81, 120, 0, 0},
+    {81, 121, 0, 0},
+    {81, 122, 0, 0},
+    {81, 123, 0, 0},
+    {81, 124, 0, 0},
+    {81, 125, 0, 0},
+    {81, 126, 0, 0},
+    {81, 127, 0, 0},
+    {81, 128, 0, 0},
+    {81, 129, 0, 0},
+    {8004, 130, 0, 0},
+    {8004, 131, 0, 0},
+    {8004, 132, 0, 0},
+    {8004, 133, 0, 0},
+    {8004, 134, 0, 0},
+    {8004, 135, 0, 0},
+    {8004, 136, 0, 0},
+    {8004, 137, 0, 0},
+    {8000, 138, 0, 0},
+    {8000, 139, 0, 0},
+    {8000, 140, 0, 0},
+    {8000, 141, 0, 0},
+    {8000, 142, 0, 0},
+    {8000, 143, 0, 0},
+    {8000, 144, 0, 0},
+    {8000, 145, 0, 0},
+    {8000, 146, 0, 0},
+    {8000, 147, 0, 0},
+    {8000, 148, 0, 0},
+    {8000, 149, 0, 0},
+    {8000, 150, 0, 0},
+    {8000, 151, 0, 0},
+    {8000, 152, 0, 0},
+    {8000, 153, 0, 0},
+    {8000, 154, 0, 0},
+    {8000, 155, 0, 0},
+    {8000, 156, 0, 0},
+    {8000, 157, 0, 0},
+    {8000, 158, 0, 0},
+    {8000, 159, 0, 0},
+    {8000, 160, 0, 0},
+    {8000, 161, 0, 0},
+    {8000, 162, 0, 0},
+    {10, 163, 0, 0},
+    {8010, 164, 0, 0},
+    {53, 165, 0, 0},
+    {8009, 166, 0, 0},
+    {123, 167, 0, 0},
+    {8040, 168, 0, 0},
+    {20, 169, 0, 0},
+    {19, 170, 0, 0},
+    {18, 171, 0, 0},
+    {21, 172, 0, 0},
+    {22, 173, 0, 0},
+    {23, 174, 0, 0},
+    {16, 175, 0, 0},
+    {13, 176, 0, 0},
+    {12, 177, 0, 0},
+    {86, 178, 0, 0},
+    {30, 179, 0, 0},
+    {8047, 180, 0, 0},
+    {9001, 181, 0, 0},
+    {9001, 182, 0, 0},
+    {9001, 183, 0, 0},
+    {9001, 184, 0, 0},
+    {9001, 185, 0, 0},
+    {107, 186, 0, 0},
+    {107, 187, 0, 0},
+    {107, 188, 0, 0},
+    {107, 189, 0, 0},
+    {115, 190, 0, 0},
+    {115, 191, 0, 0},
+    {115, 192, 0, 0},
+    {107, 193, 0, 0},
+    {107, 194, 0, 0},
+    {107, 195, 0, 0},
+    {107, 196, 0, 0},
+    {115, 197, 0, 0},
+    {31, 198, 0, 0},
+    {31, 199, 0, 0},
+    {31, 200, 0, 0},
+    {31, 201, 0, 0},
+    {31, 202, 0, 0},
+    {31, 203, 0, 0},
+    {31, 204, 0, 0},
+    {31, 205, 0, 0},
+    {31, 206, 0, 0},
+    {31, 207, 0, 0},
+    {31, 208, 0, 0},
+    {31, 209, 0, 0},
+    {31, 210, 0, 0},
+    {31, 211, 0, 0},
+    {115, 212, 0, 0},
+    {115, 213, 0, 0},
+    {107, 214, 0, 0},
+    {107, 215, 0, 0},
+    {107, 216, 0, 0},
+    {107, 217, 0, 0},
+    {107, 218, 0, 0},
+    {107, 219, 0, 0},
+    {31, 220, 0, 0},
+    {31, 221, 0, 0},
+    {31, 222, 0, 0},
+    {31, 223, 0, 0},
+    {107, 224, 0, 0},
+    {107, 225, 0, 0},
+    {107, 226, 0, 0},
+    {115, 227, 0, 0},
+    {115, 228, 0, 0},
+    {114, 229, 0, 0},
+    {114, 230, 0, 0},
+    {114, 231, 0, 0},
+    {114, 232, 0, 0},
+    {114, 233, 0, 0},
+    {114, 234, 0, 0},
+    {114, 235, 0, 0},
+    {114, 236, 0, 0},
+    {114, 237, 0, 0},
+    {114, 238, 0, 0},
+    {8080, 239, 0, 0},
+    {8080, 240, 0, 0},
+    {8080, 241, 0, 0},
+    {8080, 242, 0, 0},
+    {8080, 243, 0, 0},
+    {8080, 244, 0, 0},
+    {8080, 245, 0, 0},
+    {8080, 246, 0, 0},
+    {8080, 247, 0, 0},
+    {8080, 248, 0, 0},
+    {8080, 249, 0, 0},
+    {10030, 250, 0, 0},
+    {10030, 251, 0, 0},
+    {10030, 252, 0, 0},
+    {10030, 253, 0, 0},
+    {10030, 254, 0, 0},
+    {10030, 255, 0, 0},
+    {10030, 256, 0, 0},
+    {10030, 257, 0, 0},
+    {10030, 258, 0, 0},
+    {10030, 259, 0, 0},
+    {10030, 260, 0, 0},
+    {10030, 261, 0, 0},
+    {10030, 262, 0, 0},
+    {10030, 263, 0, 0},
+    {10030, 264, 0, 0},
+    {8080, 265, 0, 0},
+    {8080, 266, 0, 0},
+    {8080, 267, 0, 0},
+    {10030, 268, 0, 0},
+    {10030, 269, 0, 0},
+    {10030, 270, 0, 0},
+    {10030, 271, 0, 0},
+    {8080, 272, 0, 0},
+    {8080, 273, 0, 0},
+    {8080, 274, 0, 0},
+    {8080, 275, 0, 0},
+    {8080, 276, 0, 0},
+    {8080, 277, 0, 0},
+    {34, 278, 0, 0},
+    {34, 279, 0, 0},
+    {34, 280, 0, 0},
+    {34, 281, 0, 0},
+    {34, 282, 0, 0},
+    {34, 283, 0, 0},
+    {34, 284, 0, 0},
+    {34, 285, 0, 0},
+    {34, 286, 0, 0},
+    {34, 287, 0, 0},
+    {34, 288, 0, 0},
+    {34, 289, 0, 0},
+    {34, 290, 0, 0},
+    {10060, 291, 0, 0},
+    {10060, 292, 0, 0},
+    {10060, 293, 0, 0},
+    {10060, 294, 0, 0},
+    {10060, 295, 0, 0},
+    {10060, 296, 0, 0},
+    {10060, 297, 0, 0},
+    {10060, 298, 0, 0},
+    {10060, 299, 0, 0},
+    {10060, 300, 0, 0},
+    {10060, 301, 0, 0},
+    {10060, 302, 0, 0},
+    {10060, 303, 0, 0},
+    {10060, 304, 0, 0},
+    {10060, 305, 0, 0},
+    {10060, 306, 0, 0},
+    {10060, 307, 0, 0},
+    {10060, 308, 0, 0},
+    {10060, 309, 0, 0},
+    {10060, 310, 0, 0},
+    {10060, 311, 0, 0},
+    {10060, 312, 0, 0},
+    {10060, 313, 0, 0},
+    {10060, 314, 0, 0},
+    {10060, 315, 0, 0},
+    {10060, 316, 0, 0},
+    {10060, 317, 0, 0},
+    {10060, 318, 0, 0},
+    {10060, 319, 0, 0},
+    {10060, 320, 0, 0},
+    {8020, 321, 0, 0},
+    {8020, 322, 0, 0},
+    {8020, 323, 0, 0},
+    {8020, 324, 0, 0},
+    {8020, 325, 0, 0},
+    {8020, 326, 0, 0},
+    {8020, 327, 0, 0},
+    {84, 328, 0, 0},
+    {84, 329, 0, 0},
+    {10120, 330, 0, 0},
+    {10120, 331, 0, 0},
+    {10120, 332, 0, 0},
+    {10120, 333, 0, 0},
+    {122, 334, 0, 0},
+    {122, 335, 0, 0},
+    {122, 336, 0, 0},
+    {122, 337, 0, 0},
+    {122, 338, 0, 0},
+    {124, 339, 0, 0},
+    {124, 340, 0, 0},
+    {124, 341, 0, 0},
+    {124, 342, 0, 0},
+    {124, 343, 0, 0},
+    {8004, 344, 0, 0},
+    {8004, 345, 0, 0},
+    {8004, 346, 0, 0},
+    {8004, 347, 0, 0},
+    {8004, 348, 0, 0},
+    {2, 349, 0, 0},
+    {3, 350, 0, 0},
+    {4, 351, 0, 0},
+    {11, 352, 0, 0},
+    {11, 353, 0, 0},
+    {11, 354, 0, 0},
+    {11, 355, 0, 0},
+    {9100, 356, 0, 0},
+    {9101, 357, 0, 0},
+    {9102, 358, 0, 0},
+    {9103, 359, 0, 0},
+    // Dark Crucible
+    {1, 0, 0, 0},
+    {2, 1, 0, 0},
+    {3, 2, 0, 0},
+    {4, 3, 0, 0},
+    {8060, 4, 0, 0},
+    {8060, 5, 0, 0},
+    {8060, 6, 0, 0},
+    {8060, 7, 0, 0},
+    {8060, 8, 0, 0},
+    {8060, 9, 0, 0},
+    {8060, 10, 0, 0},
+    {8060, 11, 0, 0},
+    {10503, 12, 0, 0},
+    {10503, 13, 0, 0},
+    {10503, 14, 0, 0},
+    {10503, 15, 0, 0},
+    {10503, 16, 0, 0},
+    {10503, 17, 0, 0},
+    {10503, 18, 0, 0},
+    {10503, 19, 0, 0},
+    {10503, 20, 0, 0},
+    {10503, 21, 0, 0},
+    {10503, 22, 0, 0},
+    {10503, 23, 0, 0},
+    {10503, 24, 0, 0},
+    {10503, 25, 0, 0},
+    {10503, 26, 0, 0},
+    {10503, 27, 0, 0},
+    {10503, 28, 0, 0},
+    {10503, 29, 0, 0},
+    {10503, 30, 0, 0},
+    {10503, 31, 0, 0},
+    {10503, 32, 0, 0},
+    {10503, 33, 0, 0},
+    {10503, 34, 0, 0},
+    {10503, 35, 0, 0},
+    {10503, 36, 0, 0},
+    {10503, 37, 0, 0},
+    {10503, 38, 0, 0},
+    {10503, 39, 0, 0},
+    {10503, 40, 0, 0},
+    {10503, 41, 0, 0},
+    {10503, 42, 0, 0},
+    {10503, 43, 0, 0},
+    {10503, 44, 0, 0},
+    {10503, 45, 0, 0},
+    {10503, 46, 0, 0},
+    {10503, 47, 0, 0},
+    {10503, 48, 0, 0},
+    {10503, 49, 0, 0},
+    {10503, 50, 0, 0},
+    {10503, 51, 0, 0},
+    {10503, 52, 0, 0},
+    {10503, 53, 0, 0},
+    {10503, 54, 0, 0},
+    {10503, 55, 0, 0},
+    {10503, 56, 0, 0},
+    {10503, 57, 0, 0},
+    {10503, 58, 0, 0},
+    {10503, 59, 0, 0},
+    {10503, 60, 0, 0},
+    {10503, 61, 0, 0},
+    {10503, 62, 0, 0},
+    {10503, 63, 0, 0},
+    {10503, 64, 0, 0},
+    {10503, 65, 0, 0},
+    {10503, 66, 0, 0},
+    {10503, 67, 0, 0},
+    {10503, 68, 0, 0},
+    {10503, 69, 0, 0},
+    {10503, 70, 0, 0},
+    {10503, 71, 0, 0},
+    {10503, 72, 0, 0},
+    {10503, 73, 0, 0},
+    {10503, 74, 0, 0},
+    {10503, 75, 0, 0},
+    {10503, 76, 0, 0},
+    {9001, 77, 0, 0},
+    {9001, 78, 0, 0},
+    {9001, 79, 0, 0},
+    {9001, 80, 0, 0},
+    {9001, 81, 0, 0},
+    {9001, 82, 0, 0},
+    {9001, 83, 0, 0},
+    {9001, 84, 0, 0},
+    {9001, 85, 0, 0},
+    {9001, 86, 0, 0},
+    {9001, 87, 0, 0},
+    {9001, 88, 0, 0},
+    {9001, 89, 0, 0},
+    {9001, 90, 0, 0},
+    {9001, 91, 0, 0},
+    {9001, 92, 0, 0},
+    {8060, 93, 0, 0},
+    {8060, 94, 0, 0},
+    {9001, 95, 0, 0},
+    {9001, 96, 0, 0},
+    {9001, 97, 0, 0},
+    {9001, 98, 0, 0},
+    {9001, 99, 0, 0},
+    {9001, 100, 0, 0},
+    {9001, 101, 0, 0},
+    {9001, 102, 0, 0},
+    {9001, 103, 0, 0},
+    {9001, 104, 0, 0},
+    {9001, 105, 0, 0},
+    {9001, 106, 0, 0},
+    {9001, 107, 0, 0},
+    {9001, 108, 0, 0},
+    {9001, 109, 0, 0},
+    {9001, 110, 0, 0},
+    {9001, 111, 0, 0},
+    {9001, 112, 0, 0},
+    {9001, 113, 0, 0},
+    {9001, 114, 0, 0},
+    {9001, 115, 0, 0},
+    {9001, 116, 0, 0},
+    {9001, 117, 0, 0},
+    {9001, 118, 0, 0},
+    {9001, 119, 0, 0},
+    {9001, 120, 0, 0},
+    {9001, 121, 0, 0},
+    {9001, 122, 0, 0},
+    {9001, 123, 0, 0},
+    {9001, 124, 0, 0},
+    {10090, 125, 0, 0},
+    {10090, 126, 0, 0},
+    {10090, 127, 0, 0},
+    {10090, 128, 0, 0},
+    {10090, 129, 0, 0},
+    {10090, 130, 0, 0},
+    {10090, 131, 0, 0},
+    {10090, 132, 0, 0},
+    {10090, 133, 0, 0},
+    {10090, 134, 0, 0},
+    {10090, 135, 0, 0},
+    {10090, 136, 0, 0},
+    {10090, 137, 0, 0},
+    {10090, 138, 0, 0},
+    {10090, 139, 0, 0},
+    {10090, 140, 0, 0},
+    {10090, 141, 0, 0},
+    {10030, 142, 0, 0},
+    {10200, 143, 0, 0},
+    {9001, 144, 0, 0},
+    {9001, 145, 0, 0},
+    {9013, 146, 0, 0},
+    {9013, 147, 0, 0},
+    {9013, 148, 0, 0},
+    {9013, 149, 0, 0},
+    {9013, 150, 0, 0},
+    {9013, 151, 0, 0},
+    {9013, 152, 0, 0},
+    {9013, 153, 0, 0},
+    {9013, 154, 0, 0},
+    {9013, 155, 0, 0},
+    {9013, 156, 0, 0},
+    {9013, 157, 0, 0},
+    {9013, 158, 0, 0},
+    {9013, 159, 0, 0},
+    {9013, 160, 0, 0},
+    {9013, 161, 0, 0},
+    {9013, 162, 0, 0},
+    {9013, 163, 0, 0},
+    {61, 164, 0, 0},
+    {61, 165, 0, 0},
+    {116, 166, 0, 0},
+    {116, 167, 0, 0},
+    {61, 168, 0, 0},
+    {61, 169, 0, 0},
+    {61, 170, 0, 0},
+    {61, 171, 0, 0},
+    {61, 172, 0, 0},
+    {61, 173, 0, 0},
+    {61, 174, 0, 0},
+    {61, 175, 0, 0},
+    {116, 176, 0, 0},
+    {116, 177, 0, 0},
+    {3002, 178, 0, 0},
+    {3002, 179, 0, 0},
+    {3000, 180, 0, 0},
+    {3000, 181, 0, 0},
+    {54, 182, 0, 0},
+    {54, 183, 0, 0},
+    {54, 184, 0, 0},
+    {54, 185, 0, 0},
+    {9001, 186, 0, 0},
+    {9001, 187, 0, 0},
+    {9001, 188, 0, 0},
+    {9001, 189, 0, 0},
+    {9001, 190, 0, 0},
+    {9001, 191, 0, 0},
+    {9001, 192, 0, 0},
+    {10030, 193, 0, 0},
+    {10030, 194, 0, 0},
+    {10030, 195, 0, 0},
+    {10030, 196, 0, 0},
+    {10030, 197, 0, 0},
+    {10030, 198, 0, 0},
+    {10030, 199, 0, 0},
+    {10030, 200, 0, 0},
+    {10030, 201, 0, 0},
+    {10030, 202, 0, 0},
+    {10030, 203, 0, 0},
+    {10030, 204, 0, 0},
+    {10030, 205, 0, 0},
+    {10030, 206, 0, 0},
+    {10030, 207, 0, 0},
+    {10030, 208, 0, 0},
+    {10030, 209, 0, 0},
+    {10030, 210, 0, 0},
+    {10030, 211, 0, 0},
+    {10030, 212, 0, 0},
+    {10030, 213, 0, 0},
+    {10030, 214, 0, 0},
+    {10030, 215, 0, 0},
+    {10030, 216, 0, 0},
+    {10030, 217, 0, 0},
+    {10030, 218, 0, 0},
+    {10030, 219, 0, 0},
+    {10030, 220, 0, 0},
+    {10030, 221, 0, 0},
+    {10030, 222, 0, 0},
+    {10030, 223, 0, 0},
+    {107, 224, 0, 0},
+    {107, 225, 0, 0},
+    {107, 226, 0, 0},
+    {107, 227, 0, 0},
+    {107, 228, 0, 0},
+    {107, 229, 0, 0},
+    {107, 230, 0, 0},
+    {107, 231, 0, 0},
+    {107, 232, 0, 0},
+    {107, 233, 0, 0},
+    {107, 234, 0, 0},
+    {107, 235, 0, 0},
+    {107, 236, 0, 0},
+    {107, 237, 0, 0},
+    {107, 238, 0, 0},
+    {107, 239, 0, 0},
+    {107, 240, 0, 0},
+    {107, 241, 0, 0},
+    {107, 242, 0, 0},
+    {107, 243, 0, 0},
+    {107, 244, 0, 0},
+    {107, 245, 0, 0},
+    {107, 246, 0, 0},
+    {107, 247, 0, 0},
+    {107, 248, 0, 0},
+    {107, 249, 0, 0},
+    {107, 250, 0, 0},
+    {107, 251, 0, 0},
+    {107, 252, 0, 0},
+    {107, 253, 0, 0},
+    {107, 254, 0, 0},
+    {107, 255, 0, 0},
+    {114, 256, 0, 0},
+    {114, 257, 0, 0},
+    {114, 258, 0, 0},
+    {114, 259, 0, 0},
+    {114, 260, 0, 0},
+    {114, 261, 0, 0},
+    {114, 262, 0, 0},
+    {114, 263, 0, 0},
+    {114, 264, 0, 0},
+    {114, 265, 0, 0},
+    {114, 266, 0, 0},
+    {114, 267, 0, 0},
+    {114, 268, 0, 0},
+    {114, 269, 0, 0},
+    {114, 270, 0, 0},
+    {114, 271, 0, 0},
+    {31, 272, 0, 0},
+    {31, 273, 0, 0},
+    {31, 274, 0, 0},
+    {31, 275, 0, 0},
+    {31, 276, 0, 0},
+    {31, 277, 0, 0},
+    {31, 278, 0, 0},
+    {31, 279, 0, 0},
+    {31, 280, 0, 0},
+    {31, 281, 0, 0},
+    {31, 282, 0, 0},
+    {31, 283, 0, 0},
+    {31, 284, 0, 0},
+    {31, 285, 0, 0},
+    {31, 286, 0, 0},
+    {31, 287, 0, 0},
+    {31, 288, 0, 0},
+    {31, 289, 0, 0},
+    {31, 290, 0, 0},
+    {31, 291, 0, 0},
+    {31, 292, 0, 0},
+    {31, 293, 0, 0},
+    {31, 294, 0, 0},
+    {31, 295, 0, 0},
+    {31, 296, 0, 0},
+    {31, 297, 0, 0},
+    {31, 298, 0, 0},
+    {31, 299, 0, 0},
+    {31, 300, 0, 0},
+    {31, 301, 0, 0},
+    {31, 302, 0, 0},
+    {31, 303, 0, 0},
+    {114, 304, 0, 0},
+    {114, 305, 0, 0},
+    {114, 306, 0, 0},
+    {114, 307, 0, 0},
+    {114, 308, 0, 0},
+    {114, 309, 0, 0},
+    {114, 310, 0, 0},
+    {114, 311, 0, 0},
+    {114, 312, 0, 0},
+    {114, 313, 0, 0},
+    {114, 314, 0, 0},
+    {114, 315, 0, 0},
+    {114, 316, 0, 0},
+    {114, 317, 0, 0},
+    {114, 318, 0, 0},
+    {114, 319, 0, 0},
+    {82, 320, 0, 0},
+    {82, 321, 0, 0},
+    {82, 322, 0, 0},
+    {82, 323, 0, 0},
+    {82, 324, 0, 0},
+    {82, 325, 0, 0},
+    {82, 326, 0, 0},
+    {10110, 327, 0, 0},
+    {10110, 328, 0, 0},
+    {10110, 329, 0, 0},
+    {10110, 330, 0, 0},
+    {10110, 331, 0, 0},
+    {10110, 332, 0, 0},
+    {10110, 333, 0, 0},
+    {10110, 334, 0, 0},
+    {10110, 335, 0, 0},
+    {10110, 336, 0, 0},
+    {10110, 337, 0, 0},
+    {10110, 338, 0, 0},
+    {81, 339, 0, 0},
+    {81, 340, 0, 0},
+    {81, 341, 0, 0},
+    {81, 342, 0, 0},
+    {81, 343, 0, 0},
+    {81, 344, 0, 0},
+    {81, 345, 0, 0},
+    {81, 346, 0, 0},
+    {8000, 347, 0, 0},
+    {8000, 348, 0, 0},
+    {8000, 349, 0, 0},
+    {8000, 350, 0, 0},
+    {8000, 351, 0, 0},
+    {8000, 352, 0, 0},
+    {8000, 353, 0, 0},
+    {8000, 354, 0, 0},
+    {8000, 355, 0, 0},
+    {8000, 356, 0, 0},
+    {8000, 357, 0, 0},
+    {8000, 358, 0, 0},
+    {81, 359, 0, 0},
+    {81, 360, 0, 0},
+    {81, 361, 0, 0},
+    {81, 362, 0, 0},
+    {81, 363, 0, 0},
+    {81, 364, 0, 0},
+    {81, 365, 0, 0},
+    {81, 366, 0, 0},
+    {81, 367, 0, 0},
+    {81, 368, 0, 0},
+    {81, 369, 0, 0},
+    {81, 370, 0, 0},
+    {81, 371, 0, 0},
+    {81, 372, 0, 0},
+    {81, 373, 0, 0},
+    {81, 374, 0, 0},
+    {8000, 375, 0, 0},
+    {8000, 376, 0, 0},
+    {8000, 377, 0, 0},
+    {8000, 378, 0, 0},
+    {8000, 379, 0, 0},
+    {8000, 380, 0, 0},
+    {8000, 381, 0, 0},
+    {8000, 382, 0, 0},
+    {8000, 383, 0, 0},
+    {8000, 384, 0, 0},
+    {8000, 385, 0, 0},
+    {8000, 386, 0, 0},
+    {8004, 387, 0, 0},
+    {8004, 388, 0, 0},
+    {8004, 389, 0, 0},
+    {8004, 390, 0, 0},
+    {8004, 391, 0, 0},
+    {8004, 392, 0, 0},
+    {8004, 393, 0, 0},
+    {8004, 394, 0, 0},
+    {8004, 395, 0, 0},
+    {8004, 396, 0, 0},
+    {8004, 397, 0, 0},
+    {8004, 398, 0, 0},
+    {8004, 399, 0, 0},
+    {8004, 400, 0, 0},
+    {8004, 401, 0, 0},
+    {8004, 402, 0, 0},
+    {8004, 403, 0, 0},
+    {8004, 404, 0, 0},
+    {84, 405, 0, 0},
+    {84, 406, 0, 0},
+    {11, 407, 0, 0},
+    {11, 408, 0, 0},
+    {11, 409, 0, 0},
+    {11, 410, 0, 0},
+    {84, 411, 0, 0},
+    {30, 412, 0, 0},
+    {83, 413, 0, 0},
+    {86, 414, 0, 0},
+    {10040, 415, 0, 0},
+    {33, 416, 0, 0},
+    {10040, 417, 0, 0},
+    {8008, 418, 0, 0},
+    {8005, 419, 0, 0},
+    {8007, 420, 0, 0},
+    {8006, 421, 0, 0},
+    {8004, 422, 0, 0},
+    {8004, 423, 0, 0},
+    {8004, 424, 0, 0},
+    {8004, 425, 0, 0},
+    {8040, 426, 0, 0},
+    {10, 427, 0, 0},
+    {8010, 428, 0, 0},
+    {53, 429, 0, 0},
+    {8009, 430, 0, 0},
+    {123, 431, 0, 0},
+    {20, 432, 0, 0},
+    {19, 433, 0, 0},
+    {18, 434, 0, 0},
+    {16, 435, 0, 0},
+    {13, 436, 0, 0},
+    {12, 437, 0, 0},
+    {23, 438, 0, 0},
+    {22, 439, 0, 0},
+    {21, 440, 0, 0},
+    {10120, 441, 0, 0},
+    {10120, 442, 0, 0},
+    {10120, 443, 0, 0},
+    {8004, 444, 0, 0},
+    {8004, 445, 0, 0},
+    {8004, 446, 0, 0},
+    {8004, 447, 0, 0},
+    {8004, 448, 0, 0},
+    {8004, 449, 0, 0},
+    {8004, 450, 0, 0},
+    {8004, 451, 0, 0},
+    {8004, 452, 0, 0},
+    {8004, 453, 0, 0},
+    {8004, 454, 0, 0},
+    {8004, 455, 0, 0},
+    {8004, 456, 0, 0},
+    {8004, 457, 0, 0},
+    {8004, 458, 0, 0},
+    {8004, 459, 0, 0},
+    {8004, 460, 0, 0},
+    {8004, 461, 0, 0},
+    {8004, 462, 0, 0},
+    {8004, 463, 0, 0},
+    {8004, 464, 0, 0},
+    {8004, 465, 0, 0},
+    {8004, 466, 0, 0},
+    {8004, 467, 0, 0},
+    {8004, 468, 0, 0},
+    {8004, 469, 0, 0},
+    {8004, 470, 0, 0},
+    {8004, 471, 0, 0},
+    {32, 472, 0, 0},
+    {32, 473, 0, 0},
+    {8003, 474, 0, 0},
+    {8003, 475, 0, 0},
+    {8003, 476, 0, 0},
+    {8003, 477, 0, 0},
+    {8003, 478, 0, 0},
+    {8003, 479, 0, 0},
+    {9100, 480, 0, 0},
+    {9101, 481, 0, 0},
+    {9102, 482, 0, 0},
+    {9103, 483, 0, 0},
+    {11, 484, 0, 0},
+    {11, 485, 0, 0},
+    {11, 486, 0, 0},
+    {11, 487, 0, 0},
 };
 
 
-const std::map<int, std::string> ap_hexen_type_sprites = {
-    {8010, "WFAXA0"},
-    {123, "WFHMA0"},
+constexpr ap_level_info_t ap_hexen_level_infos[] = {
+    {"Winnowing Hall", {false, false, false}, {0, 0, 0}, 3, 350, ap_hexen_thing_infos + 0, 0},
+    {"Seven Portals", {false, false, false}, {0, 0, 0}, 12, 712, ap_hexen_thing_infos + 350, 0},
+    {"Guardian of Ice", {false, false, false}, {0, 0, 0}, 8, 399, ap_hexen_thing_infos + 1062, 0},
+    {"Guardian of Fire", {false, false, false}, {0, 0, 0}, 7, 296, ap_hexen_thing_infos + 1461, 0},
+    {"Guardian of Steel", {false, false, false}, {0, 0, 0}, 9, 495, ap_hexen_thing_infos + 1757, 0},
+    {"Bright Crucible", {false, false, false}, {0, 0, 0}, 7, 386, ap_hexen_thing_infos + 2252, 0},
+    {"Darkmere", {false, false, false}, {0, 0, 0}, 12, 593, ap_hexen_thing_infos + 2638, 0},
+    {"Caves of Circe", {false, false, false}, {0, 0, 0}, 7, 379, ap_hexen_thing_infos + 3231, 0},
+    {"Wastelands", {false, false, false}, {0, 0, 0}, 10, 450, ap_hexen_thing_infos + 3610, 0},
+    {"Sacred Grove", {false, false, false}, {0, 0, 0}, 4, 116, ap_hexen_thing_infos + 4060, 0},
+    {"Hypostyle", {false, false, false}, {0, 0, 0}, 4, 278, ap_hexen_thing_infos + 4176, 0},
+    {"Shadow Wood", {false, false, false}, {0, 0, 0}, 8, 521, ap_hexen_thing_infos + 4454, 0},
+    {"Heresiarch's Seminary", {false, false, false}, {0, 0, 0}, 6, 853, ap_hexen_thing_infos + 4975, 0},
+    {"Dragon Chapel", {false, false, false}, {0, 0, 0}, 4, 331, ap_hexen_thing_infos + 5828, 0},
+    {"Griffin Chapel", {false, false, false}, {0, 0, 0}, 8, 300, ap_hexen_thing_infos + 6159, 0},
+    {"Deathwind Chapel", {false, false, false}, {0, 0, 0}, 8, 284, ap_hexen_thing_infos + 6459, 0},
+    {"Orchard of Lamentations", {false, false, false}, {0, 0, 0}, 7, 266, ap_hexen_thing_infos + 6743, 0},
+    {"Silent Refectory", {false, false, false}, {0, 0, 0}, 10, 292, ap_hexen_thing_infos + 7009, 0},
+    {"Wolf Chapel", {false, false, false}, {0, 0, 0}, 8, 383, ap_hexen_thing_infos + 7301, 0},
+    {"Forsaken Outpost", {false, false, false}, {0, 0, 0}, 8, 415, ap_hexen_thing_infos + 7684, 0},
+    {"Castle of Grief", {false, false, false}, {0, 0, 0}, 7, 523, ap_hexen_thing_infos + 8099, 0},
+    {"Gibbet", {false, false, false}, {0, 0, 0}, 8, 496, ap_hexen_thing_infos + 8622, 0},
+    {"Effluvium", {false, false, false}, {0, 0, 0}, 8, 306, ap_hexen_thing_infos + 9118, 0},
+    {"Dungeons", {false, false, false}, {0, 0, 0}, 3, 537, ap_hexen_thing_infos + 9424, 0},
+    {"Desolate Garden", {false, false, false}, {0, 0, 0}, 16, 230, ap_hexen_thing_infos + 9961, 0},
+    {"Necropolis", {false, false, false}, {0, 0, 0}, 3, 508, ap_hexen_thing_infos + 10191, 0},
+    {"Zedek's Tomb", {false, false, false}, {0, 0, 0}, 7, 294, ap_hexen_thing_infos + 10699, 0},
+    {"Melenkir's Tomb", {false, false, false}, {0, 0, 0}, 6, 253, ap_hexen_thing_infos + 10993, 0},
+    {"Traductus' Tomb", {false, false, false}, {0, 0, 0}, 6, 180, ap_hexen_thing_infos + 11246, 0},
+    {"Vivarium", {false, false, false}, {0, 0, 0}, 11, 360, ap_hexen_thing_infos + 11426, 0},
+    {"Dark Crucible", {false, false, false}, {0, 0, 0}, 8, 488, ap_hexen_thing_infos + 11786, 0},
+};
+
+
+// First level and level count of each episode
+constexpr ap_episode_def_t ap_hexen_episodes[] = {
+    {0, 6},
+    {6, 6},
+    {12, 7},
+    {19, 6},
+    {25, 6},
+};
+
+
+// Item sprites (Used by notification icons), sorted by doom type
+constexpr ap_type_sprite_t ap_hexen_type_sprites[] = {
+    {10, "WCSSA0"},
     {12, "WFR1A0"},
     {13, "WFR2A0"},
     {16, "WFR3A0"},
-    {10, "WCSSA0"},
-    {8009, "WCFMD0"},
     {18, "WCH1A0"},
     {19, "WCH2A0"},
     {20, "WCH3A0"},
-    {53, "WMCSA0"},
-    {8040, "WMLGG0"},
     {21, "WMS1A0"},
     {22, "WMS2A0"},
     {23, "WMS3A0"},
-    {8034, "KEY5A0"},
-    {8036, "KEY7A0"},
+    {30, "PORKC0"},
+    {32, "SPHLA0"},
+    {33, "TRCHA0"},
+    {36, "ATLPA0"},
+    {53, "WMCSA0"},
+    {82, "PTN2A0"},
+    {84, "INVUA0"},
+    {86, "SUMNA0"},
+    {122, "MAN1A0"},
+    {123, "WFHMA0"},
+    {124, "MAN2A0"},
+    {8000, "PSBGA0"},
+    {8002, "SPEDB0"},
+    {8003, "BMANA0"},
+    {8004, "MAN3A0"},
+    {8005, "ARM1A0"},
+    {8006, "ARM2A0"},
+    {8007, "ARM3A0"},
+    {8008, "ARM4A0"},
+    {8009, "WCFMD0"},
+    {8010, "WFAXA0"},
     {8030, "KEY1A0"},
+    {8031, "KEY2A0"},
+    {8032, "KEY3A0"},
     {8033, "KEY4A0"},
+    {8034, "KEY5A0"},
+    {8035, "KEY6A0"},
+    {8036, "KEY7A0"},
+    {8037, "KEY8A0"},
     {8038, "KEY9A0"},
-    {8031, "KEY2A0"},
     {8039, "KEYAA0"},
+    {8040, "WMLGG0"},
+    {8041, "BRACC0"},
     {8200, "KEYBA0"},
-    {8037, "KEY8A0"},
-    {8035, "KEY6A0"},
-    {8032, "KEY3A0"},
-    {9014, "ASK2A0"},
+    {9002, "ASKUA0"},
     {9003, "ABGMA0"},
     {9004, "AGMRA0"},
     {9005, "AGMGA0"},
-    {9009, "AGG2A0"},
     {9006, "AGMBA0"},
-    {9010, "AGB2A0"},
     {9007, "ABK1A0"},
     {9008, "ABK2A0"},
+    {9009, "AGG2A0"},
+    {9010, "AGB2A0"},
+    {9014, "ASK2A0"},
+    {9015, "AFWPA0"},
+    {9016, "ACWPA0"},
+    {9017, "AMWPA0"},
     {9018, "AGERA0"},
     {9019, "AGR2A0"},
     {9020, "AGR3A0"},
     {9021, "AGR4A0"},
-    {9002, "ASKUA0"},
-    {9015, "AFWPA0"},
-    {9016, "ACWPA0"},
-    {9017, "AMWPA0"},
-    {122, "MAN1A0"},
-    {124, "MAN2A0"},
-    {8004, "MAN3A0"},
-    {8008, "ARM4A0"},
-    {8006, "ARM2A0"},
-    {8005, "ARM1A0"},
-    {8007, "ARM3A0"},
-    {8041, "BRACC0"},
-    {32, "SPHLA0"},
     {10040, "TELOA0"},
-    {8002, "SPEDB0"},
-    {36, "ATLPA0"},
-    {86, "SUMNA0"},
-    {84, "INVUA0"},
-    {8003, "BMANA0"},
-    {30, "PORKC0"},
-    {33, "TRCHA0"},
     {10110, "BLSTA0"},
-    {8000, "PSBGA0"},
-    {82, "PTN2A0"},
 };
@@ -23,6 +23,7 @@
 #include "d_loop.h"
 #include "d_ticcmd.h"
 
+#include "i_prof.h"
 #include "i_system.h"
 #include "i_timer.h"
 #include "i_video.h"
@@ -218,6 +219,8 @@ void NetUpdate (void)
     if (singletics)
         return;
 
+    I_ProfStart(PROF_NETUPDATE);
+
     // Run network subsystems
 
     NET_CL_Run();
@@ -249,6 +252,8 @@ void NetUpdate (void)
             break;
         }
     }
+
+    I_ProfStop(PROF_NETUPDATE);
 }
 
 static void D_Disconnected(void)
@@ -795,7 +800,14 @@ void TryRunTics (void)
     // run the count * ticdup dics
     while (counts--)
     {
+        I_ProfStart(PROF_APUPDATE);
         apdoom_update();
+        I_ProfStop(PROF_APUPDATE);
+        if (apdoom_get_init_state() == AP_INIT_STATE_FAILED)
+        {
+            I_Error("Failed to initialize Archipelago.\n%s",
+                    apdoom_get_init_status_text());
+        }
 
         ticcmd_set_t *set;
 
@@ -57,6 +57,7 @@
 #include "i_endoom.h"
 #include "i_input.h"
 #include "i_joystick.h"
+#include "i_prof.h"
 #include "i_system.h"
 #include "i_timer.h"
 #include "i_video.h"
@@ -194,7 +195,7 @@ void on_ap_give_item(int doom_type, int ep, int map)
 {
     player_t* player = &players[consoleplayer];
     int sound = sfx_itemup;
-    ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
+    const ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
 
     switch (doom_type)
     {
@@ -778,6 +779,9 @@ void D_RunFrame()
     static boolean wipe;
     static int oldgametic;
 
+    // [AP] Previous frame ends here, wipe frames included
+    I_ProfFrame();
+
     if (wipe)
     {
         do
@@ -792,7 +796,9 @@ void D_RunFrame()
                                , 0, 0, SCREENWIDTH, SCREENHEIGHT, tics);
         I_UpdateNoBlit ();
         M_Drawer ();                            // menu is drawn even on top of wipes
+        I_ProfStart(PROF_FINISHUPDATE);
         I_FinishUpdate ();                      // page flip or blit buffer
+        I_ProfStop(PROF_FINISHUPDATE);
         return;
     }
 
@@ -803,7 +809,9 @@ void D_RunFrame()
 
     if (oldgametic < gametic)
     {
+        I_ProfStart(PROF_SOUND);
         S_UpdateSounds (players[displayplayer].mo);// move positional sounds
+        I_ProfStop(PROF_SOUND);
         oldgametic = gametic;
     }
 
@@ -818,7 +826,9 @@ void D_RunFrame()
             wipestart = I_GetTime () - 1;
         } else {
             // normal update
+            I_ProfStart(PROF_FINISHUPDATE);
             I_FinishUpdate ();              // page flip or blit buffer
+            I_ProfStop(PROF_FINISHUPDATE);
         }
     }
 
@@ -1774,6 +1784,10 @@ void D_DoomMain (void)
         ap_settings.reset_level_on_death = atoi(myargv[reset_level_on_death_id + 1]) ? 1 : 0;
     }
 
+    // Also dump AP state as apstate.json on exit, for debugging
+    if (M_CheckParm("-apjsonstate"))
+        ap_settings.export_json_state = 1;
+
     
     // Grab parameters for AP
     int apserver_arg_id = M_CheckParmWithArgs("-apserver", 1);
@@ -2474,6 +2488,7 @@ void D_DoomMain (void)
     DEH_printf("I_Init: Setting up machine state.\n");
     I_CheckIsScreensaver();
     I_InitTimer();
+    I_InitProfiling();
     I_InitJoystick();
     I_InitSound(true);
     I_InitMusic();
@@ -2728,6 +2743,7 @@ void D_DoomMain (void)
     {
 	    I_Error("Failed to initialize Archipelago.");
     }
+    ap_notif_init();
 
 
     DEH_printf("M_Init: Init miscellaneous info.\n");
@@ -2766,6 +2782,19 @@ void D_DoomMain (void)
         DEH_printf("External statistics registered.\n");
     }
 
+    // [AP] Everything below starts a game before the main loop gets to
+    // wait for the connection, so wait here instead.
+    if (autostart || netgame || startloadgame >= 0
+     || M_CheckParm("-record") || M_CheckParm("-playdemo")
+     || M_CheckParm("-timedemo"))
+    {
+        if (apdoom_wait_for_init() == AP_INIT_STATE_FAILED)
+        {
+            I_Error("Failed to initialize Archipelago.\n%s",
+                    apdoom_get_init_status_text());
+        }
+    }
+
     //!
     // @arg <x>
     // @category demo
@@ -1263,7 +1263,7 @@ void set_ap_player_states()
 
     // Cards
     ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(gameepisode, gamemap));
-    ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
+    const ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
 
     p->cards[0] = level_state->keys[0] && !level_info->use_skull[0];
     p->cards[1] = level_state->keys[1] && !level_info->use_skull[1];
@@ -26,6 +26,7 @@
 
 #include "deh_main.h"
 #include "i_input.h"
+#include "i_prof.h"
 #include "i_swap.h"
 #include "i_video.h"
 
@@ -101,6 +102,7 @@ static hu_textline_t	w_coordx;
 static hu_textline_t	w_coordy;
 static hu_textline_t	w_coorda;
 static hu_textline_t	w_fps;
+static hu_textline_t	w_prof[PROF_OVERLAYLINES]; // [AP]
 boolean			chat_on;
 static hu_itext_t	w_chat;
 static boolean		always_off = false;
@@ -692,6 +694,15 @@ void HU_Start(void)
 		       hu_font,
 		       HU_FONTSTART);
 
+    // [AP] profiling overlay, under the level stats
+    for (i = 0; i < PROF_OVERLAYLINES; i++)
+    {
+	HUlib_initTextLine(&w_prof[i],
+			   HU_TITLEX, HU_MSGY + (6 + i) * 8,
+			   hu_font,
+			   HU_FONTSTART);
+    }
+
     
     switch ( logical_gamemission )
     {
@@ -840,6 +851,7 @@ static void HU_DrawCrosshair (void)
 
 void HU_Drawer(void)
 {
+    int i;
 
     if (crispy->cleanscreenshot)
     {
@@ -912,6 +924,12 @@ void HU_Drawer(void)
 	HUlib_drawTextLine(&w_fps, false);
     }
 
+    if (I_ProfOverlayActive())
+    {
+	for (i = 0; i < PROF_OVERLAYLINES; i++)
+	    HUlib_drawTextLine(&w_prof[i], false);
+    }
+
     if (crispy->crosshair == CROSSHAIR_STATIC)
 	HU_DrawCrosshair();
 
@@ -938,6 +956,8 @@ void HU_Drawer(void)
 
 void HU_Erase(void)
 {
+    int i;
+
     //for (int i = 0; i < 4; ++i)
     //    HUlib_eraseSText(&w_ap_messages[i]); // [AP] Nah, we don't erase. When we go other screens, we still see them. They are global
     HUlib_eraseSText(&w_message);
@@ -952,6 +972,8 @@ void HU_Erase(void)
     HUlib_eraseTextLine(&w_coordy);
     HUlib_eraseTextLine(&w_coorda);
     HUlib_eraseTextLine(&w_fps);
+    for (i = 0; i < PROF_OVERLAYLINES; i++)
+	HUlib_eraseTextLine(&w_prof[i]);
 
 }
 
@@ -1465,6 +1487,18 @@ void HU_Ticker(void)
 	while (*s)
 	    HUlib_addCharToTextLine(&w_fps, *(s++));
     }
+
+    if (I_ProfOverlayActive())
+    {
+	for (i = 0; i < PROF_OVERLAYLINES; i++)
+	{
+	    const char *line = I_ProfOverlayLine(i);
+
+	    HUlib_clearTextLine(&w_prof[i]);
+	    while (line && *line)
+		HUlib_addCharToTextLine(&w_prof[i], *(line++));
+	}
+    }
 }
 
 #define QUEUESIZE		128
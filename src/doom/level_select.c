@@ -558,7 +558,7 @@ void DrawEpisodicLevelSelectStats()
     {
         const level_pos_t* level_pos = get_level_pos_info(selected_ep, i);
         ap_level_index_t idx = {selected_ep, i};
-        ap_level_info_t* ap_level_info = ap_get_level_info(idx);
+        const ap_level_info_t* ap_level_info = ap_get_level_info(idx);
         ap_level_state_t* ap_level_state = ap_get_level_state(idx);
 
         x = level_pos->x;
@@ -1360,6 +1360,10 @@ void M_APLevelSelect(int choice)
 
 void M_APPlay(int choice)
 {
+    // Still connecting, the status line tells the player what we're waiting on
+    if (apdoom_get_init_state() != AP_INIT_STATE_READY)
+        return;
+
     M_ClearMenus();
 
     // Was the game quit during a level?
@@ -284,7 +284,7 @@ EV_DoDoor
 	
 	// new door thinker
 	rtn = 1;
-	door = Z_Malloc (sizeof(*door), PU_LEVSPEC, 0);
+	door = P_AllocThinker (sizeof(*door));
 	P_AddThinker (&door->thinker);
 	sec->specialdata = door;
 
@@ -516,7 +516,7 @@ EV_VerticalDoor
 	
     
     // new door thinker
-    door = Z_Malloc (sizeof(*door), PU_LEVSPEC, 0);
+    door = P_AllocThinker (sizeof(*door));
     P_AddThinker (&door->thinker);
     sec->specialdata = door;
     door->thinker.function.acp1 = (actionf_p1) T_VerticalDoor;
@@ -566,7 +566,7 @@ void P_SpawnDoorCloseIn30 (sector_t* sec)
 {
     vldoor_t*	door;
 	
-    door = Z_Malloc ( sizeof(*door), PU_LEVSPEC, 0);
+    door = P_AllocThinker (sizeof(*door));
 
     P_AddThinker (&door->thinker);
 
@@ -591,7 +591,7 @@ P_SpawnDoorRaiseIn5Mins
 {
     vldoor_t*	door;
 	
-    door = Z_Malloc ( sizeof(*door), PU_LEVSPEC, 0);
+    door = P_AllocThinker (sizeof(*door));
     
     P_AddThinker (&door->thinker);
 
@@ -802,7 +802,7 @@ EV_SlidingDoor
     // Init sliding door vars
     if (!door)
     {
-	door = Z_Malloc (sizeof(*door), PU_LEVSPEC, 0);
+	door = P_AllocThinker (sizeof(*door));
 	P_AddThinker (&door->thinker);
 	sec->specialdata = door;
 		
@@ -154,7 +154,7 @@ static void P_ReadFireFlicker (const char *key)
 	{
 		fireflicker_t *flick;
 
-		flick = Z_Malloc(sizeof(*flick), PU_LEVEL, NULL);
+		flick = P_AllocThinker (sizeof(*flick));
 
 		flick->sector = &sectors[sector];
 		flick->count = count;
@@ -302,7 +302,7 @@ void EV_DoGoobers (void)
 	    sec->specialdata = NULL;
 	}
 
-	floor = Z_Malloc(sizeof(*floor), PU_LEVSPEC, 0);
+	floor = P_AllocThinker (sizeof(*floor));
 	P_AddThinker(&floor->thinker);
 	sec->specialdata = floor;
 	floor->thinker.function.acp1 = (actionf_p1) T_MoveGoobers;
@@ -345,7 +345,7 @@ EV_DoFloor
 	
 	// new floor thinker
 	rtn = 1;
-	floor = Z_Malloc (sizeof(*floor), PU_LEVSPEC, 0);
+	floor = P_AllocThinker (sizeof(*floor));
 	P_AddThinker (&floor->thinker);
 	sec->specialdata = floor;
 	floor->thinker.function.acp1 = (actionf_p1) T_MoveFloor;
@@ -549,7 +549,7 @@ EV_BuildStairs
 	
 	// new floor thinker
 	rtn = 1;
-	floor = Z_Malloc (sizeof(*floor), PU_LEVSPEC, 0);
+	floor = P_AllocThinker (sizeof(*floor));
 	P_AddThinker (&floor->thinker);
 	sec->specialdata = floor;
 	floor->thinker.function.acp1 = (actionf_p1) T_MoveFloor;
@@ -608,7 +608,7 @@ EV_BuildStairs
 					
 		sec = tsec;
 		secnum = newsecnum;
-		floor = Z_Malloc (sizeof(*floor), PU_LEVSPEC, 0);
+		floor = P_AllocThinker (sizeof(*floor));
 
 		P_AddThinker (&floor->thinker);
 
@@ -71,7 +71,7 @@ void P_SpawnFireFlicker (sector_t*	sector)
     // Nothing special about it during gameplay.
     sector->special = 0; 
 	
-    flick = Z_Malloc ( sizeof(*flick), PU_LEVSPEC, 0);
+    flick = P_AllocThinker (sizeof(*flick));
 
     P_AddThinker (&flick->thinker);
 
@@ -129,7 +129,7 @@ void P_SpawnLightFlash (sector_t*	sector)
     // nothing special about it during gameplay
     sector->special = 0;	
 	
-    flash = Z_Malloc ( sizeof(*flash), PU_LEVSPEC, 0);
+    flash = P_AllocThinker (sizeof(*flash));
 
     P_AddThinker (&flash->thinker);
 
@@ -189,7 +189,7 @@ P_SpawnStrobeFlash
 {
     strobe_t*	flash;
 	
-    flash = Z_Malloc ( sizeof(*flash), PU_LEVSPEC, 0);
+    flash = P_AllocThinker (sizeof(*flash));
 
     P_AddThinker (&flash->thinker);
 
@@ -354,7 +354,7 @@ void P_SpawnGlowingLight(sector_t*	sector)
 {
     glow_t*	g;
 	
-    g = Z_Malloc( sizeof(*g), PU_LEVSPEC, 0);
+    g = P_AllocThinker (sizeof(*g));
 
     P_AddThinker(&g->thinker);
 
@@ -70,6 +70,8 @@ extern	thinker_t	thinkercap;
 
 
 void P_InitThinkers (void);
+void* P_AllocThinker (int size);
+void P_FreeThinker (thinker_t* thinker);
 void P_AddThinker (thinker_t* thinker);
 void P_RemoveThinker (thinker_t* thinker);
 
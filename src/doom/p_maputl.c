@@ -25,6 +25,7 @@
 #include <stdlib.h>
 
 
+#include "i_prof.h"
 #include "i_system.h" // [crispy] I_Realloc()
 #include "m_bbox.h"
 
@@ -1031,6 +1032,8 @@ P_PathTraverse
 	}
 		
     }
+    I_ProfCount(PROF_INTERCEPTS, intercept_p - intercepts);
+
     // go through the sorted list
     return P_TraverseIntercepts ( trav, FRACUNIT );
 }
@@ -18,6 +18,8 @@
 //
 
 
+#include "i_prof.h"
+#include "i_system.h"
 #include "z_zone.h"
 #include "p_local.h"
 #include "s_musinfo.h" // [crispy] T_MAPMusic()
@@ -30,7 +32,7 @@ int leveltimesinceload;
 
 //
 // THINKERS
-// All thinkers should be allocated by Z_Malloc
+// All thinkers should be allocated by P_AllocThinker
 // so they can be operated on uniformly.
 // The actual structures will vary in size,
 // but the first element must be thinker_t.
@@ -42,12 +44,120 @@ int leveltimesinceload;
 thinker_t	thinkercap;
 
 
+//
+// [AP] Thinker slabs
+// One pool per thinker size (mobjs, doors, floors, lights...), carved out
+// of PU_LEVEL chunks. Thinkers spawned together sit together in memory,
+// and a removed thinker is reused by the next one of the same size instead
+// of going back to the zone. Every slot starts with a small header telling
+// which pool it came from.
+//
+#define THINKERS_PER_CHUNK 128
+#define MAX_THINKER_POOLS 32
+
+typedef union
+{
+    int pool;
+    void *align;
+} thinkerslot_t;
+
+typedef struct
+{
+    int size; // Object size, as asked by P_AllocThinker
+    int slotsize; // Header included, pointer aligned
+    thinker_t *freelist; // Linked through next
+    byte *chunk; // Where the next new slot is carved from
+    int chunkleft;
+} thinkerpool_t;
+
+static thinkerpool_t thinkerpools[MAX_THINKER_POOLS];
+static int numthinkerpools = 0;
+
+
 //
 // P_InitThinkers
 //
 void P_InitThinkers (void)
 {
+    int i;
+
     thinkercap.prev = thinkercap.next  = &thinkercap;
+
+    // [AP] The chunks went away with the PU_LEVEL tags
+    for (i = 0; i < numthinkerpools; ++i)
+    {
+        thinkerpools[i].freelist = NULL;
+        thinkerpools[i].chunk = NULL;
+        thinkerpools[i].chunkleft = 0;
+    }
+}
+
+
+//
+// P_AllocThinker
+// [AP] Returns uninitialized memory for a thinker of the given size,
+// valid until the level ends.
+//
+void *P_AllocThinker (int size)
+{
+    thinkerpool_t *pool;
+    thinkerslot_t *slot;
+    thinker_t *thinker;
+    int i;
+
+    for (i = 0; i < numthinkerpools; ++i)
+        if (thinkerpools[i].size == size)
+            break;
+
+    if (i == numthinkerpools)
+    {
+        if (numthinkerpools == MAX_THINKER_POOLS)
+            I_Error("P_AllocThinker: too many thinker sizes");
+
+        pool = &thinkerpools[numthinkerpools++];
+        pool->size = size;
+        pool->slotsize = sizeof(thinkerslot_t)
+                       + (size + sizeof(void *) - 1) / sizeof(void *) * sizeof(void *);
+        pool->freelist = NULL;
+        pool->chunk = NULL;
+        pool->chunkleft = 0;
+    }
+    pool = &thinkerpools[i];
+
+    if (pool->freelist)
+    {
+        thinker = pool->freelist;
+        pool->freelist = thinker->next;
+        return thinker;
+    }
+
+    if (!pool->chunkleft)
+    {
+        pool->chunk = Z_Malloc(pool->slotsize * THINKERS_PER_CHUNK, PU_LEVEL, NULL);
+        pool->chunkleft = THINKERS_PER_CHUNK;
+    }
+
+    slot = (thinkerslot_t *) pool->chunk;
+    slot->pool = i;
+    pool->chunk += pool->slotsize;
+    pool->chunkleft--;
+
+    return slot + 1;
+}
+
+
+//
+// P_FreeThinker
+// [AP] Gives a thinker allocated by P_AllocThinker back to its pool.
+// It must already be out of the thinker list.
+//
+void P_FreeThinker (thinker_t *thinker)
+{
+    thinkerslot_t *slot = (thinkerslot_t *) thinker - 1;
+    thinkerpool_t *pool = &thinkerpools[slot->pool];
+
+    thinker->next = pool->freelist;
+    pool->freelist = thinker;
 }
 
 
@@ -96,6 +206,7 @@ void P_AllocateThinker (thinker_t*	thinker)
 void P_RunThinkers (void)
 {
     thinker_t *currentthinker, *nextthinker;
+    thinker_t *removed = NULL;
 
     currentthinker = thinkercap.next;
     while (currentthinker != &thinkercap)
@@ -106,7 +217,10 @@ void P_RunThinkers (void)
             nextthinker = currentthinker->next;
 	    currentthinker->next->prev = currentthinker->prev;
 	    currentthinker->prev->next = currentthinker->next;
-	    Z_Free(currentthinker);
+
+            // [AP] Freed together once every thinker had its turn
+            currentthinker->next = removed;
+            removed = currentthinker;
 	}
 	else
 	{
@@ -117,6 +231,13 @@ void P_RunThinkers (void)
 	currentthinker = nextthinker;
     }
 
+    while (removed)
+    {
+        nextthinker = removed->next;
+        P_FreeThinker(removed);
+        removed = nextthinker;
+    }
+
     // [crispy] support MUSINFO lump (dynamic music changing)
     T_MusInfo();
 }
@@ -149,8 +270,12 @@ void P_Ticker (void)
 	if (playeringame[i])
 	    P_PlayerThink (&players[i]);
 			
+    I_ProfStart(PROF_THINKERS);
     P_RunThinkers ();
+    I_ProfStop(PROF_THINKERS);
+    I_ProfStart(PROF_SPECIALS);
     P_UpdateSpecials ();
+    I_ProfStop(PROF_SPECIALS);
     P_RespawnSpecials ();
 
     // for par times
@@ -0,0 +1,272 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Times the thinker slabs of p_tick.c against thinkers straight from
+//	the zone, freed one by one like vanilla did. Links the real p_tick.c
+//	and z_zone.c. Both run the same levels of spawning and removing
+//	thinkers, and have to run them in the same order: exits with 1 if
+//	the checksums differ.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+
+#include "doomtype.h"
+#include "i_prof.h"
+#include "i_system.h"
+#include "m_argv.h"
+#include "s_musinfo.h"
+#include "z_zone.h"
+
+#include "doomstat.h"
+#include "p_local.h"
+#include "p_spec.h"
+
+#define ZONESIZE (32 * 1024 * 1024)
+#define LEVELS 30
+#define LEVELTHINKERS 6000
+#define LEVELTICS 2000
+#define TICSPAWNS 40
+
+void P_RunThinkers (void);
+
+// What P_Ticker and the zone would have from the rest of the game
+
+boolean netgame;
+boolean menuactive;
+boolean paused;
+int consoleplayer;
+boolean demoplayback;
+player_t players[MAXPLAYERS];
+boolean playeringame[MAXPLAYERS];
+
+void I_Error (const char *error, ...)
+{
+    va_list argptr;
+
+    va_start(argptr, error);
+    vfprintf(stderr, error, argptr);
+    va_end(argptr);
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+byte *I_ZoneBase (int *size)
+{
+    *size = ZONESIZE;
+    return malloc(ZONESIZE);
+}
+
+boolean M_ParmExists (const char *check)
+{
+    return false;
+}
+
+void I_ProfStart (proftimer_t timer)
+{
+}
+
+void I_ProfStop (proftimer_t timer)
+{
+}
+
+void T_MusInfo (void)
+{
+}
+
+void P_PlayerThink (player_t *player)
+{
+}
+
+void P_UpdateSpecials (void)
+{
+}
+
+void P_RespawnSpecials (void)
+{
+}
+
+static boolean useslabs;
+static unsigned int randstate;
+static long checksum;
+static void *cacheuser;
+
+static unsigned int Random (void)
+{
+    randstate = randstate * 1103515245 + 12345;
+    return (randstate >> 8) & 0xffffff;
+}
+
+// A moving thing that goes away once in a while
+static void T_TestMobj (mobj_t *mobj)
+{
+    mobj->x += mobj->momx;
+    mobj->y += mobj->momy;
+    checksum += mobj->x;
+
+    if (--mobj->tics <= 0)
+    {
+	if (Random() % 4 == 0)
+	    P_RemoveThinker(&mobj->thinker);
+	else
+	    mobj->tics = 1 + Random() % 16;
+    }
+}
+
+// A light that stays for the whole level
+static void T_TestLight (lightflash_t *flash)
+{
+    if (--flash->count <= 0)
+    {
+	flash->count = Random() % 64;
+	flash->maxlight ^= 1;
+    }
+    checksum += flash->maxlight;
+}
+
+static void *AllocThinker (int size)
+{
+    if (useslabs)
+	return P_AllocThinker(size);
+
+    return Z_Malloc(size, PU_LEVEL, NULL);
+}
+
+static void SpawnThinker (boolean light)
+{
+    if (light)
+    {
+	lightflash_t *flash = AllocThinker(sizeof(*flash));
+
+	memset(flash, 0, sizeof(*flash));
+	flash->count = Random() % 64;
+	flash->thinker.function.acp1 = (actionf_p1) T_TestLight;
+	P_AddThinker(&flash->thinker);
+    }
+    else
+    {
+	mobj_t *mobj = AllocThinker(sizeof(*mobj));
+
+	memset(mobj, 0, sizeof(*mobj));
+	mobj->momx = FRACUNIT;
+	mobj->tics = 1 + Random() % 16;
+	mobj->thinker.function.acp1 = (actionf_p1) T_TestMobj;
+	P_AddThinker(&mobj->thinker);
+    }
+}
+
+// P_RunThinkers as it was, one Z_Free per removed thinker
+static void RunThinkersFromZone (void)
+{
+    thinker_t *currentthinker, *nextthinker;
+
+    currentthinker = thinkercap.next;
+    while (currentthinker != &thinkercap)
+    {
+	if (currentthinker->function.acv == (actionf_v)(-1))
+	{
+	    nextthinker = currentthinker->next;
+	    currentthinker->next->prev = currentthinker->prev;
+	    currentthinker->prev->next = currentthinker->next;
+	    Z_Free(currentthinker);
+	}
+	else
+	{
+	    if (currentthinker->function.acp1)
+		currentthinker->function.acp1(currentthinker);
+	    nextthinker = currentthinker->next;
+	}
+	currentthinker = nextthinker;
+    }
+}
+
+static double Now (void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Microseconds per tic
+static double RunLevels (boolean slabs)
+{
+    double elapsed = 0, start;
+    int level, tic, i;
+
+    useslabs = slabs;
+    randstate = 1;
+    checksum = 0;
+
+    for (level = 0; level < LEVELS; level++)
+    {
+	// Like P_SetupLevel, thinkers mixed in with the other level data
+	Z_FreeTags(PU_LEVEL, PU_PURGELEVEL - 1);
+	P_InitThinkers();
+
+	for (i = 0; i < LEVELTHINKERS; i++)
+	{
+	    SpawnThinker(i % 5 == 0);
+	    if (i % 7 == 0)
+		Z_Malloc(16 + Random() % 512, PU_LEVEL, NULL);
+	}
+
+	start = Now();
+	for (tic = 0; tic < LEVELTICS; tic++)
+	{
+	    if (slabs)
+		P_RunThinkers();
+	    else
+		RunThinkersFromZone();
+
+	    // New things, and the caches coming and going around them
+	    for (i = 0; i < TICSPAWNS; i++)
+	    {
+		SpawnThinker(false);
+		if (Random() % 3 == 0)
+		    Z_Malloc(16 + Random() % 512, PU_CACHE, &cacheuser);
+	    }
+	}
+	elapsed += Now() - start;
+    }
+
+    return elapsed / (LEVELS * LEVELTICS);
+}
+
+int main (int argc, char **argv)
+{
+    double zonetime, slabtime;
+    long zonechecksum, slabchecksum;
+
+    Z_Init();
+
+    zonetime = RunLevels(false);
+    zonechecksum = checksum;
+    slabtime = RunLevels(true);
+    slabchecksum = checksum;
+
+    printf("Z_Malloc/Z_Free: %7.2f us/tic, checksum %ld\n", zonetime, zonechecksum);
+    printf("Thinker slabs:   %7.2f us/tic, checksum %ld\n", slabtime, slabchecksum);
+
+    if (zonechecksum != slabchecksum)
+    {
+	printf("Thinkers ran in a different order.\n");
+	return 1;
+    }
+
+    return 0;
+}
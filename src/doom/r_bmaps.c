@@ -414,7 +414,7 @@ static const byte hacxlightning[256] =
 	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
 };
 
-const byte *dc_brightmap = nobrightmap;
+THREADLOCAL const byte *dc_brightmap = nobrightmap;
 
 // [crispy] brightmaps for textures
 
@@ -23,6 +23,7 @@
 #include "deh_main.h"
 #include "i_swap.h"
 #include "i_system.h"
+#include "i_thread.h"
 #include "z_zone.h"
 
 
@@ -38,6 +39,7 @@
 
 
 #include "r_data.h"
+#include "r_defer.h"
 #include "v_trans.h" // [crispy] tranmap, CRMAX
 #include "r_bmaps.h" // [crispy] R_BrightmapForTexName()
 
@@ -256,8 +258,36 @@ R_DrawColumnInCache
 //  and each column is cached.
 //
 // Rewritten by Lee Killough for performance and to fix Medusa bug
+//
+// [AP] Split in three so R_StartPrecache can composite on worker threads:
+// R_AllocComposite and R_FinishComposite touch the zone and must run on
+// the main thread, R_BuildComposite only writes into the allocated blocks.
+//
 
-void R_GenerateComposite (int texnum)
+static void R_AllocComposite (int texnum, patch_t **patches)
+{
+    texture_t*		texture;
+    int			i;
+
+    texture = textures[texnum];
+
+    Z_Malloc (texturecompositesize[texnum],
+	      PU_STATIC,
+	      &texturecomposite[texnum]);
+    // [crispy] memory block for opaque textures
+    Z_Malloc (texture->width * texture->height,
+	      PU_STATIC,
+	      &texturecomposite2[texnum]);
+
+    // Held until R_FinishComposite, caching the next patch could
+    // otherwise purge the previous one.
+    for (i=0 ; i<texture->patchcount ; i++)
+    {
+	patches[i] = W_CacheLumpNum (texture->patches[i].patch, PU_STATIC);
+    }
+}
+
+static void R_BuildComposite (int texnum, patch_t **patches)
 {
     byte*		block, *block2;
     texture_t*		texture;
@@ -274,14 +304,8 @@ void R_GenerateComposite (int texnum)
     byte*		source; // killough 4/9/98: temporary column
 	
     texture = textures[texnum];
-
-    block = Z_Malloc (texturecompositesize[texnum],
-		      PU_STATIC, 
-		      &texturecomposite[texnum]);	
-    // [crispy] memory block for opaque textures
-    block2 = Z_Malloc (texture->width * texture->height,
-		      PU_STATIC,
-		      &texturecomposite2[texnum]);
+    block = texturecomposite[texnum];
+    block2 = texturecomposite2[texnum];
 
     collump = texturecolumnlump[texnum];
     colofs = texturecolumnofs[texnum];
@@ -298,7 +322,7 @@ void R_GenerateComposite (int texnum)
 	 i<texture->patchcount;
 	 i++, patch++)
     {
-	realpatch = W_CacheLumpNum (patch->patch, PU_CACHE);
+	realpatch = patches[i];
 	x1 = patch->originx;
 	x2 = x1 + SHORT(realpatch->width);
 
@@ -393,11 +417,37 @@ void R_GenerateComposite (int texnum)
 
     free(source); // free temporary column
     free(marks); // free transparency marks
+}
+
+static void R_FinishComposite (int texnum)
+{
+    texture_t*		texture;
+    int			i;
+
+    texture = textures[texnum];
+
+    for (i=0 ; i<texture->patchcount ; i++)
+    {
+	W_ReleaseLumpNum (texture->patches[i].patch);
+    }
 
     // Now that the texture has been built in column cache,
     //  it is purgable from zone memory.
-    Z_ChangeTag (block, PU_CACHE);
-    Z_ChangeTag (block2, PU_CACHE);
+    Z_ChangeTag (texturecomposite[texnum], PU_CACHE);
+    Z_ChangeTag (texturecomposite2[texnum], PU_CACHE);
+}
+
+void R_GenerateComposite (int texnum)
+{
+    patch_t**		patches;
+
+    patches = I_Realloc(NULL, (textures[texnum]->patchcount + 1) * sizeof(*patches));
+
+    R_AllocComposite (texnum, patches);
+    R_BuildComposite (texnum, patches);
+    R_FinishComposite (texnum);
+
+    free(patches);
 }
 
 
@@ -607,6 +657,10 @@ R_GetColumn
     if (!texturecomposite2[tex])
 	R_GenerateComposite (tex);
 
+    // [AP] drawn at the flush
+    if (deferdraw)
+	R_PinComposite (tex);
+
     return texturecomposite2[tex] + ofs;
 }
 
@@ -627,6 +681,10 @@ R_GetColumnMod
     if (!texturecomposite[tex])
 	R_GenerateComposite (tex);
 
+    // [AP] drawn at the flush
+    if (deferdraw)
+	R_PinComposite (tex);
+
     return texturecomposite[tex] + ofs;
 }
 
@@ -1350,27 +1408,63 @@ int R_TextureNumForName(const char *name)
 // R_PrecacheLevel
 // Preloads all relevant graphics for the level.
 //
+// [AP] Split in two. R_StartPrecache runs as soon as the sectors and
+// sides are loaded: it caches flats and hands texture composites to the
+// worker threads. R_PrecacheLevel runs once things are spawned: it caches
+// the sprites meanwhile, then waits for the composites.
+//
 int		flatmemory;
 int		texturememory;
 int		spritememory;
 
-void R_PrecacheLevel (void)
+// Composites being built by the workers
+static int*		precachetextures;
+static patch_t**	precachepatches; // Each texture's patches, back to back
+static int*		precachepatchofs;
+static int		numprecachetextures;
+
+static void R_PrecacheTextureJob (int index, void *data)
+{
+    R_BuildComposite(precachetextures[index],
+                     precachepatches + precachepatchofs[index]);
+}
+
+static void R_FinishPrecache (void)
+{
+    int			i;
+
+    I_FinishJobs();
+
+    for (i=0 ; i<numprecachetextures ; i++)
+    {
+	R_FinishComposite(precachetextures[i]);
+    }
+
+    free(precachetextures);
+    free(precachepatches);
+    free(precachepatchofs);
+    precachetextures = NULL;
+    precachepatches = NULL;
+    precachepatchofs = NULL;
+    numprecachetextures = 0;
+}
+
+void R_StartPrecache (void)
 {
     char*		flatpresent;
     char*		texturepresent;
-    char*		spritepresent;
 
     int			i;
     int			j;
-    int			k;
     int			lump;
+    int			numpatches;
     
     texture_t*		texture;
-    thinker_t*		th;
-    spriteframe_t*	sf;
 
     if (demoplayback)
 	return;
+
+    R_FinishPrecache();
     
     // Precache flats.
     flatpresent = Z_Malloc(numflats, PU_STATIC, NULL);
@@ -1414,27 +1508,77 @@ void R_PrecacheLevel (void)
     //  a wall texture, with an episode dependend
     //  name.
     texturepresent[skytexture] = 1;
+
+    // [AP] Composites still cached from the previous level are kept, only
+    // missing ones are built, on the workers.
+    numpatches = 0;
+    for (i=0 ; i<numtextures ; i++)
+    {
+	if (texturepresent[i] && (!texturecomposite[i] || !texturecomposite2[i]))
+	{
+	    texturepresent[i] = 2;
+	    numprecachetextures++;
+	    numpatches += textures[i]->patchcount;
+	}
+    }
+
+    precachetextures = I_Realloc(NULL, (numprecachetextures + 1) * sizeof(*precachetextures));
+    precachepatchofs = I_Realloc(NULL, (numprecachetextures + 1) * sizeof(*precachepatchofs));
+    precachepatches = I_Realloc(NULL, (numpatches + 1) * sizeof(*precachepatches));
 	
     texturememory = 0;
+    numprecachetextures = 0;
+    numpatches = 0;
     for (i=0 ; i<numtextures ; i++)
     {
 	if (!texturepresent[i])
 	    continue;
 
-	// [crispy] precache composite textures
-	R_GenerateComposite(i);
-
 	texture = textures[i];
 	
 	for (j=0 ; j<texture->patchcount ; j++)
 	{
 	    lump = texture->patches[j].patch;
 	    texturememory += lumpinfo[lump]->size;
-	    W_CacheLumpNum(lump , PU_CACHE);
+	}
+
+	if (texturepresent[i] == 2)
+	{
+	    // [crispy] precache composite textures
+	    R_AllocComposite(i, precachepatches + numpatches);
+	    precachetextures[numprecachetextures] = i;
+	    precachepatchofs[numprecachetextures] = numpatches;
+	    numprecachetextures++;
+	    numpatches += texture->patchcount;
+	}
+	else
+	{
+	    for (j=0 ; j<texture->patchcount ; j++)
+	    {
+		W_CacheLumpNum(texture->patches[j].patch, PU_CACHE);
+	    }
 	}
     }
 
     Z_Free(texturepresent);
+
+    I_StartJobs(R_PrecacheTextureJob, NULL, numprecachetextures);
+}
+
+void R_PrecacheLevel (void)
+{
+    char*		spritepresent;
+
+    int			i;
+    int			j;
+    int			k;
+    int			lump;
+    
+    thinker_t*		th;
+    spriteframe_t*	sf;
+
+    if (demoplayback)
+	return;
     
     // Precache sprites.
     spritepresent = Z_Malloc(numsprites, PU_STATIC, NULL);
@@ -1465,6 +1609,9 @@ void R_PrecacheLevel (void)
     }
 
     Z_Free(spritepresent);
+
+    // The first frame needs every composite, wait for the workers.
+    R_FinishPrecache();
 }
 
 
@@ -43,6 +43,7 @@ R_GetColumnMod
 
 // I/O, setting up the stuff.
 void R_InitData (void);
+void R_StartPrecache (void); // [AP] Once sectors and sides are loaded
 void R_PrecacheLevel (void);
 
 
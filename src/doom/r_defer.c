@@ -0,0 +1,550 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Deferred drawing: columns and spans are recorded as commands and
+//	drawn later, sorted by texture, in strips of columns split between
+//	threads.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "doomdef.h"
+#include "i_prof.h"
+#include "i_system.h"
+#include "i_thread.h"
+#include "m_argv.h"
+#include "w_wad.h"
+#include "z_zone.h"
+
+#include "r_defer.h"
+#include "r_local.h"
+#include "v_trans.h"
+
+#define FLATSIZE (64 * 64)
+
+typedef struct
+{
+    void		(*func) (void);
+    byte*		source;
+    lighttable_t*	colormap[2];
+    const byte*		brightmap;
+    byte*		translation;
+#ifdef CRISPY_TRUECOLOR
+    const pixel_t	(*blend) (const pixel_t fg, const pixel_t bg);
+#endif
+    fixed_t		iscale;
+    fixed_t		texturemid;
+    int			texheight;
+    short		x;
+    short		yl;
+    short		yh;
+    short		fuzzpos; // Where the shadow starts in the fuzz table
+} colcmd_t;
+
+typedef struct
+{
+    void		(*func) (void);
+    byte*		source;
+    lighttable_t*	colormap[2];
+    const byte*		brightmap;
+    fixed_t		xfrac;
+    fixed_t		yfrac;
+    fixed_t		xstep;
+    fixed_t		ystep;
+    short		y;
+    short		x1;
+    short		x2;
+} spancmd_t;
+
+// What the view recorded. Reused frame after frame.
+typedef struct
+{
+    colcmd_t*		cols;
+    int			numcols;
+    int			maxcols;
+    spancmd_t*		spans;
+    int			numspans;
+    int			maxspans;
+    byte**		keptflats;
+    int			numkeptflats;
+    int			maxkeptflats;
+} drawcmds_t;
+
+boolean deferdraw = false;
+
+static drawcmds_t drawcmds;
+static int numdrawthreads = 1;
+
+// Cached lumps and composites the commands draw from, held until the
+// flush so caching the next one can't purge them. Marked with the
+// flush they were pinned for.
+static int *pinnedlumps;
+static int *pinnedcomposites;
+static int *pinlist;
+static int numpins;
+static int maxpins;
+static int pinflush = 1;
+
+extern byte** texturecomposite;
+extern byte** texturecomposite2;
+extern int numtextures;
+static FILE *drawlistfile;
+static int drawlistframe; // The one framecount written
+
+// The drawers R_ExecuteSetViewSize picked
+static void (*drawcolumn) (void);
+static void (*drawfuzzcolumn) (void);
+static void (*drawtranscolumn) (void);
+static void (*drawtlcolumn) (void);
+static void (*drawspan) (void);
+
+
+static void R_ShutdownDeferredDraw (void)
+{
+    if (drawlistfile != NULL)
+    {
+	fclose(drawlistfile);
+	drawlistfile = NULL;
+    }
+}
+
+void R_InitDeferredDraw (void)
+{
+    int p;
+
+    //!
+    // @category video
+    //
+    // Record walls, flats and sprites as draw commands, then draw walls
+    // and flats sorted by texture, split between the -threads.
+    //
+
+    deferdraw = M_CheckParm("-deferdraw") > 0;
+    numdrawthreads = I_NumThreads();
+
+    //!
+    // @arg <n>
+    // @category video
+    //
+    // Like -deferdraw, drawing the view in n strips of columns, each on
+    // its own thread. Limited by -threads.
+    //
+
+    p = M_CheckParmWithArgs("-renderthreads", 1);
+
+    if (p > 0)
+    {
+	deferdraw = true;
+	numdrawthreads = atoi(myargv[p + 1]);
+
+	if (numdrawthreads > I_NumThreads())
+	    numdrawthreads = I_NumThreads();
+	if (numdrawthreads < 1)
+	    numdrawthreads = 1;
+    }
+
+    //!
+    // @arg <file> <frame>
+    // @category obscure
+    //
+    // With -deferdraw, write the draw commands of one rendered frame to a
+    // CSV file, one line per command in the order they are drawn.
+    //
+
+    p = M_CheckParmWithArgs("-drawlist", 2);
+
+    if (p > 0 && deferdraw)
+    {
+	drawlistfile = fopen(myargv[p + 1], "w");
+
+	if (drawlistfile == NULL)
+	{
+	    I_Error("R_InitDeferredDraw: Can't open %s", myargv[p + 1]);
+	}
+
+	drawlistframe = atoi(myargv[p + 2]);
+	fputs("frame,pass,kind,x1,x2,y1,y2,source,colormap\n", drawlistfile);
+	I_AtExit(R_ShutdownDeferredDraw, true);
+    }
+}
+
+
+//
+// Recording
+//
+
+static void R_QueueColumn (void (*func) (void))
+{
+    colcmd_t *cmd;
+
+    // Drawers don't draw those
+    if (dc_yh < dc_yl)
+	return;
+
+    if (drawcmds.numcols == drawcmds.maxcols)
+    {
+	drawcmds.maxcols = drawcmds.maxcols ? 2 * drawcmds.maxcols : 4096;
+	drawcmds.cols = I_Realloc(drawcmds.cols, drawcmds.maxcols * sizeof(*drawcmds.cols));
+    }
+
+    cmd = &drawcmds.cols[drawcmds.numcols++];
+    cmd->func = func;
+    cmd->source = dc_source;
+    cmd->colormap[0] = dc_colormap[0];
+    cmd->colormap[1] = dc_colormap[1];
+    cmd->brightmap = dc_brightmap;
+    cmd->translation = dc_translation;
+#ifdef CRISPY_TRUECOLOR
+    cmd->blend = blendfunc;
+#endif
+    cmd->iscale = dc_iscale;
+    cmd->texturemid = dc_texturemid;
+    cmd->texheight = dc_texheight;
+    cmd->x = dc_x;
+    cmd->yl = dc_yl;
+    cmd->yh = dc_yh;
+    cmd->fuzzpos = fuzzpos;
+}
+
+static void R_QueueBaseColumn (void) { R_QueueColumn(drawcolumn); }
+static void R_QueueTransColumn (void) { R_QueueColumn(drawtranscolumn); }
+static void R_QueueTLColumn (void) { R_QueueColumn(drawtlcolumn); }
+
+// Strips draw their shadows apart, so each one starts where it would
+// have when drawing them one after the other
+static void R_QueueFuzzColumn (void)
+{
+    R_QueueColumn(drawfuzzcolumn);
+    R_SkipFuzzColumn();
+}
+
+static void R_QueueSpan (void)
+{
+    spancmd_t *cmd;
+
+    if (drawcmds.numspans == drawcmds.maxspans)
+    {
+	drawcmds.maxspans = drawcmds.maxspans ? 2 * drawcmds.maxspans : 4096;
+	drawcmds.spans = I_Realloc(drawcmds.spans, drawcmds.maxspans * sizeof(*drawcmds.spans));
+    }
+
+    cmd = &drawcmds.spans[drawcmds.numspans++];
+    cmd->func = drawspan;
+    cmd->source = ds_source;
+    cmd->colormap[0] = ds_colormap[0];
+    cmd->colormap[1] = ds_colormap[1];
+    cmd->brightmap = ds_brightmap;
+    cmd->xfrac = ds_xfrac;
+    cmd->yfrac = ds_yfrac;
+    cmd->xstep = ds_xstep;
+    cmd->ystep = ds_ystep;
+    cmd->y = ds_y;
+    cmd->x1 = ds_x1;
+    cmd->x2 = ds_x2;
+}
+
+void R_DeferDrawers (void)
+{
+    drawcolumn = basecolfunc;
+    drawfuzzcolumn = fuzzcolfunc;
+    drawtranscolumn = transcolfunc;
+    drawtlcolumn = tlcolfunc;
+    drawspan = spanfunc;
+
+    colfunc = basecolfunc = R_QueueBaseColumn;
+    fuzzcolfunc = R_QueueFuzzColumn;
+    transcolfunc = R_QueueTransColumn;
+    tlcolfunc = R_QueueTLColumn;
+    spanfunc = R_QueueSpan;
+}
+
+byte *R_KeepFlat (const byte *flat)
+{
+    byte *kept;
+
+    if (drawcmds.numkeptflats == drawcmds.maxkeptflats)
+    {
+	drawcmds.maxkeptflats = drawcmds.maxkeptflats ? 2 * drawcmds.maxkeptflats : 8;
+	drawcmds.keptflats = I_Realloc(drawcmds.keptflats, drawcmds.maxkeptflats * sizeof(*drawcmds.keptflats));
+	memset(drawcmds.keptflats + drawcmds.numkeptflats, 0,
+	       (drawcmds.maxkeptflats - drawcmds.numkeptflats) * sizeof(*drawcmds.keptflats));
+    }
+
+    // The copies stay allocated for the next frames
+    if (drawcmds.keptflats[drawcmds.numkeptflats] == NULL)
+	drawcmds.keptflats[drawcmds.numkeptflats] = I_Realloc(NULL, FLATSIZE);
+
+    kept = drawcmds.keptflats[drawcmds.numkeptflats++];
+    memcpy(kept, flat, FLATSIZE);
+
+    return kept;
+}
+
+
+//
+// Pinning
+//
+
+static int *R_PinMarks (int count)
+{
+    int *marks = I_Realloc(NULL, count * sizeof(*marks));
+
+    memset(marks, 0, count * sizeof(*marks));
+
+    return marks;
+}
+
+static void R_Pin (int *pinned, int index)
+{
+    pinned[index] = pinflush;
+
+    if (numpins == maxpins)
+    {
+	maxpins = maxpins ? 2 * maxpins : 256;
+	pinlist = I_Realloc(pinlist, maxpins * sizeof(*pinlist));
+    }
+
+    // Composites go in as -1 - tex
+    pinlist[numpins++] = pinned == pinnedlumps ? index : -1 - index;
+}
+
+void R_PinLump (int lump)
+{
+    if (pinnedlumps == NULL)
+	pinnedlumps = R_PinMarks(numlumps);
+
+    if (pinnedlumps[lump] != pinflush)
+    {
+	W_CacheLumpNum(lump, PU_STATIC);
+	R_Pin(pinnedlumps, lump);
+    }
+}
+
+// Either can be purged without the other
+static void R_ChangeCompositeTag (int tex, int tag)
+{
+    if (texturecomposite[tex] != NULL)
+	Z_ChangeTag(texturecomposite[tex], tag);
+    if (texturecomposite2[tex] != NULL)
+	Z_ChangeTag(texturecomposite2[tex], tag);
+}
+
+void R_PinComposite (int tex)
+{
+    if (pinnedcomposites == NULL)
+	pinnedcomposites = R_PinMarks(numtextures);
+
+    if (pinnedcomposites[tex] != pinflush)
+    {
+	R_ChangeCompositeTag(tex, PU_STATIC);
+	R_Pin(pinnedcomposites, tex);
+    }
+}
+
+// Back to PU_CACHE, like W_ReleaseLumpNum and R_FinishComposite leave
+// them
+static void R_ReleasePins (void)
+{
+    int i;
+
+    for (i = 0; i < numpins; i++)
+    {
+	if (pinlist[i] >= 0)
+	{
+	    W_ReleaseLumpNum(pinlist[i]);
+	}
+	else
+	{
+	    R_ChangeCompositeTag(-1 - pinlist[i], PU_CACHE);
+	}
+    }
+
+    numpins = 0;
+    pinflush++;
+}
+
+void R_ClearDrawCmds (void)
+{
+    drawcmds.numcols = 0;
+    drawcmds.numspans = 0;
+    drawcmds.numkeptflats = 0;
+
+    R_ReleasePins();
+}
+
+
+//
+// Drawing
+//
+
+static int R_CompareColumns (const void *a, const void *b)
+{
+    const colcmd_t *ca = a, *cb = b;
+
+    if (ca->source != cb->source)
+	return (uintptr_t) ca->source < (uintptr_t) cb->source ? -1 : 1;
+    if (ca->colormap[0] != cb->colormap[0])
+	return (uintptr_t) ca->colormap[0] < (uintptr_t) cb->colormap[0] ? -1 : 1;
+
+    return ca->x - cb->x;
+}
+
+static int R_CompareSpans (const void *a, const void *b)
+{
+    const spancmd_t *sa = a, *sb = b;
+
+    if (sa->source != sb->source)
+	return (uintptr_t) sa->source < (uintptr_t) sb->source ? -1 : 1;
+    if (sa->colormap[0] != sb->colormap[0])
+	return (uintptr_t) sa->colormap[0] < (uintptr_t) sb->colormap[0] ? -1 : 1;
+    if (sa->y != sb->y)
+	return sa->y - sb->y;
+
+    return sa->x1 - sb->x1;
+}
+
+static void R_DrawColumnCmd (const colcmd_t *cmd)
+{
+    dc_x = cmd->x;
+    dc_yl = cmd->yl;
+    dc_yh = cmd->yh;
+    dc_source = cmd->source;
+    dc_colormap[0] = cmd->colormap[0];
+    dc_colormap[1] = cmd->colormap[1];
+    dc_brightmap = cmd->brightmap;
+    dc_translation = cmd->translation;
+#ifdef CRISPY_TRUECOLOR
+    blendfunc = cmd->blend;
+#endif
+    dc_iscale = cmd->iscale;
+    dc_texturemid = cmd->texturemid;
+    dc_texheight = cmd->texheight;
+    fuzzpos = cmd->fuzzpos;
+
+    cmd->func ();
+}
+
+// Draws x1 to x2 of the span. The drawers step the fractions one pixel
+// at a time, so starting further in is the same as stepping there.
+static void R_DrawSpanCmd (const spancmd_t *cmd, int x1, int x2)
+{
+    const unsigned skip = x1 - cmd->x1;
+
+    ds_y = cmd->y;
+    ds_x1 = x1;
+    ds_x2 = x2;
+    ds_source = cmd->source;
+    ds_colormap[0] = cmd->colormap[0];
+    ds_colormap[1] = cmd->colormap[1];
+    ds_brightmap = cmd->brightmap;
+    ds_xfrac = (fixed_t) ((unsigned) cmd->xfrac + skip * (unsigned) cmd->xstep);
+    ds_yfrac = (fixed_t) ((unsigned) cmd->yfrac + skip * (unsigned) cmd->ystep);
+    ds_xstep = cmd->xstep;
+    ds_ystep = cmd->ystep;
+
+    cmd->func ();
+}
+
+// Walls and flats never draw over each other. Sprites and masked
+// textures do, back to front, but only ever draw over and read from
+// their own column. So each strip of columns can draw its part of the
+// commands on its own, in the order they're in.
+static void R_DrawCmdsIn (const drawcmds_t *cmds, int x1, int x2)
+{
+    int i;
+
+    for (i = 0; i < cmds->numcols; i++)
+    {
+	const colcmd_t *cmd = &cmds->cols[i];
+
+	if (cmd->x >= x1 && cmd->x <= x2)
+	    R_DrawColumnCmd(cmd);
+    }
+
+    for (i = 0; i < cmds->numspans; i++)
+    {
+	const spancmd_t *cmd = &cmds->spans[i];
+
+	if (cmd->x2 >= x1 && cmd->x1 <= x2)
+	    R_DrawSpanCmd(cmd, MAX(cmd->x1, x1), MIN(cmd->x2, x2));
+    }
+}
+
+static void R_DrawStrip (int strip, void *data)
+{
+    R_DrawCmdsIn(data, viewwidth * strip / numdrawthreads,
+                 viewwidth * (strip + 1) / numdrawthreads - 1);
+}
+
+// Fuzz columns have no colormap
+static int R_ColormapIndex (const lighttable_t *colormap)
+{
+    return colormap != NULL ? (int) (colormap - colormaps) : -1;
+}
+
+static void R_WriteDrawList (boolean sorted)
+{
+    const char *pass = sorted ? "sorted" : "inorder";
+    int i;
+
+    if (framecount != drawlistframe)
+	return;
+
+    for (i = 0; i < drawcmds.numcols; i++)
+    {
+	const colcmd_t *cmd = &drawcmds.cols[i];
+
+	fprintf(drawlistfile, "%d,%s,column,%d,%d,%d,%d,%p,%d\n", framecount, pass,
+	        cmd->x, cmd->x, cmd->yl, cmd->yh, (void *) cmd->source,
+	        R_ColormapIndex(cmd->colormap[0]));
+    }
+
+    for (i = 0; i < drawcmds.numspans; i++)
+    {
+	const spancmd_t *cmd = &drawcmds.spans[i];
+
+	fprintf(drawlistfile, "%d,%s,span,%d,%d,%d,%d,%p,%d\n", framecount, pass,
+	        cmd->x1, cmd->x2, cmd->y, cmd->y, (void *) cmd->source,
+	        R_ColormapIndex(cmd->colormap[0]));
+    }
+
+    fflush(drawlistfile);
+}
+
+void R_FlushDrawCmds (boolean sorted)
+{
+    // The main thread draws a strip too, and keeps on from the last
+    // shadow recorded
+    const int lastfuzzpos = fuzzpos;
+
+    I_ProfStart(PROF_DRAWCMDS);
+
+    if (sorted)
+    {
+	qsort(drawcmds.cols, drawcmds.numcols, sizeof(*drawcmds.cols), R_CompareColumns);
+	qsort(drawcmds.spans, drawcmds.numspans, sizeof(*drawcmds.spans), R_CompareSpans);
+    }
+
+    if (drawlistfile != NULL)
+	R_WriteDrawList(sorted);
+
+    I_RunJobs(R_DrawStrip, &drawcmds, numdrawthreads);
+
+    I_ProfStop(PROF_DRAWCMDS);
+
+    fuzzpos = lastfuzzpos;
+    R_ClearDrawCmds();
+}
@@ -0,0 +1,50 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Deferred drawing: columns and spans are recorded as commands and
+//	drawn later, sorted by texture.
+//
+
+#ifndef __R_DEFER__
+#define __R_DEFER__
+
+#include "doomtype.h"
+
+// Set by -deferdraw
+extern boolean deferdraw;
+
+void R_InitDeferredDraw (void);
+
+// Swaps the drawers R_ExecuteSetViewSize picked for ones recording
+// commands.
+void R_DeferDrawers (void);
+
+// Drops what's recorded, at the start of a frame.
+void R_ClearDrawCmds (void);
+
+// Draws what was recorded, in strips of columns split over threads.
+// Sorted by texture and colormap for walls and flats, which never draw
+// over each other. In order for sprites and masked textures.
+void R_FlushDrawCmds (boolean sorted);
+
+// The distorted flat buffer is reused for the next one, so the commands
+// get a copy that lasts until the flush.
+byte *R_KeepFlat (const byte *flat);
+
+// Keeps a cached lump or texture composite the commands draw from until
+// the flush, instead of leaving it purgable.
+void R_PinLump (int lump);
+void R_PinComposite (int tex);
+
+#endif
@@ -472,8 +472,9 @@ typedef struct
 //
 // Now what is a visplane, anyway?
 // 
-typedef struct
+typedef struct visplane_s
 {
+  struct visplane_s	*next; // [AP] hash chain, or free list
   fixed_t		height;
   int			picnum;
   int			lightlevel;
@@ -80,19 +80,19 @@ static pixel_t *background_buffer = NULL;
 // R_DrawColumn
 // Source is the top of the column to scale.
 //
-lighttable_t*		dc_colormap[2]; // [crispy] brightmaps
-int			dc_x; 
-int			dc_yl; 
-int			dc_yh; 
-fixed_t			dc_iscale; 
-fixed_t			dc_texturemid;
-int			dc_texheight; // [crispy] Tutti-Frutti fix
+THREADLOCAL lighttable_t*		dc_colormap[2]; // [crispy] brightmaps
+THREADLOCAL int			dc_x; 
+THREADLOCAL int			dc_yl; 
+THREADLOCAL int			dc_yh; 
+THREADLOCAL fixed_t			dc_iscale; 
+THREADLOCAL fixed_t			dc_texturemid;
+THREADLOCAL int			dc_texheight; // [crispy] Tutti-Frutti fix
 
 // first pixel in a column (possibly virtual) 
-byte*			dc_source;		
+THREADLOCAL byte*			dc_source;		
 
 // just for profiling 
-int			dccount;
+THREADLOCAL int			dccount;
 
 //
 // A column is a vertical slice/span from a wall texture that,
@@ -336,7 +336,7 @@ int	fuzzoffset[FUZZTABLE] =
     FUZZOFF,FUZZOFF,-FUZZOFF,FUZZOFF,FUZZOFF,-FUZZOFF,FUZZOFF 
 }; 
 
-int	fuzzpos = 0; 
+THREADLOCAL int	fuzzpos = 0; 
 
 // [crispy] draw fuzz effect independent of rendering frame rate
 static int fuzzpos_tic;
@@ -354,6 +354,17 @@ void R_SetFuzzPosDraw (void)
 	fuzzpos = fuzzpos_tic;
 }
 
+// [AP] Steps fuzzpos over the column like R_DrawFuzzColumn and
+// R_DrawFuzzColumnLow would, without drawing it
+void R_SkipFuzzColumn (void)
+{
+    const int yl = dc_yl ? dc_yl : 1;
+    const int yh = dc_yh == viewheight-1 ? viewheight - 2 : dc_yh;
+
+    if (yh >= yl)
+	fuzzpos = (fuzzpos + yh - yl + 1) % FUZZTABLE;
+}
+
 //
 // Framebuffer postprocessing.
 // Creates a fuzzy image by copying pixels
@@ -525,7 +536,7 @@ void R_DrawFuzzColumnLow (void)
 //  of the BaronOfHell, the HellKnight, uses
 //  identical sprites, kinda brightened up.
 //
-byte*	dc_translation;
+THREADLOCAL byte*	dc_translation;
 byte*	translationtables;
 
 void R_DrawTranslatedColumn (void) 
@@ -761,23 +772,23 @@ void R_InitTranslationTables (void)
 // In consequence, flats are not stored by column (like walls),
 //  and the inner loop has to step in texture space u and v.
 //
-int			ds_y; 
-int			ds_x1; 
-int			ds_x2;
+THREADLOCAL int			ds_y; 
+THREADLOCAL int			ds_x1; 
+THREADLOCAL int			ds_x2;
 
-lighttable_t*		ds_colormap[2];
-const byte*			ds_brightmap;
+THREADLOCAL lighttable_t*		ds_colormap[2];
+THREADLOCAL const byte*			ds_brightmap;
 
-fixed_t			ds_xfrac; 
-fixed_t			ds_yfrac; 
-fixed_t			ds_xstep; 
-fixed_t			ds_ystep;
+THREADLOCAL fixed_t			ds_xfrac; 
+THREADLOCAL fixed_t			ds_yfrac; 
+THREADLOCAL fixed_t			ds_xstep; 
+THREADLOCAL fixed_t			ds_ystep;
 
 // start of a 64*64 tile image 
-byte*			ds_source;	
+THREADLOCAL byte*			ds_source;	
 
 // just for profiling
-int			dscount;
+THREADLOCAL int			dscount;
 
 
 //
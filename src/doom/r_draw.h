@@ -23,17 +23,17 @@
 
 
 
-extern lighttable_t*	dc_colormap[2];
-extern int		dc_x;
-extern int		dc_yl;
-extern int		dc_yh;
-extern fixed_t		dc_iscale;
-extern fixed_t		dc_texturemid;
-extern int		dc_texheight;
-extern const byte*		dc_brightmap;
+extern THREADLOCAL lighttable_t*	dc_colormap[2];
+extern THREADLOCAL int		dc_x;
+extern THREADLOCAL int		dc_yl;
+extern THREADLOCAL int		dc_yh;
+extern THREADLOCAL fixed_t		dc_iscale;
+extern THREADLOCAL fixed_t		dc_texturemid;
+extern THREADLOCAL int		dc_texheight;
+extern THREADLOCAL const byte*		dc_brightmap;
 
 // first pixel in a column
-extern byte*		dc_source;		
+extern THREADLOCAL byte*		dc_source;		
 
 
 // The span blitting interface.
@@ -49,6 +49,8 @@ void 	R_DrawFuzzColumnLow (void);
 // [crispy] draw fuzz effect independent of rendering frame rate
 void R_SetFuzzPosTic (void);
 void R_SetFuzzPosDraw (void);
+void R_SkipFuzzColumn (void);
+extern THREADLOCAL int	fuzzpos;
 
 // Draw with color translation tables,
 //  for player sprite rendering,
@@ -64,23 +66,23 @@ R_VideoErase
 ( unsigned	ofs,
   int		count );
 
-extern int		ds_y;
-extern int		ds_x1;
-extern int		ds_x2;
+extern THREADLOCAL int		ds_y;
+extern THREADLOCAL int		ds_x1;
+extern THREADLOCAL int		ds_x2;
 
-extern lighttable_t*	ds_colormap[2];
-extern const byte*		ds_brightmap;
+extern THREADLOCAL lighttable_t*	ds_colormap[2];
+extern THREADLOCAL const byte*		ds_brightmap;
 
-extern fixed_t		ds_xfrac;
-extern fixed_t		ds_yfrac;
-extern fixed_t		ds_xstep;
-extern fixed_t		ds_ystep;
+extern THREADLOCAL fixed_t		ds_xfrac;
+extern THREADLOCAL fixed_t		ds_yfrac;
+extern THREADLOCAL fixed_t		ds_xstep;
+extern THREADLOCAL fixed_t		ds_ystep;
 
 // start of a 64*64 tile image
-extern byte*		ds_source;		
+extern THREADLOCAL byte*		ds_source;		
 
 extern byte*		translationtables;
-extern byte*		dc_translation;
+extern THREADLOCAL byte*		dc_translation;
 
 
 // Span blitting for rows, floor/ceiling.
@@ -33,9 +33,12 @@
 #include "m_bbox.h"
 #include "m_menu.h"
 
+#include "i_prof.h"
 #include "i_system.h" // [crispy] I_Realloc()
 #include "p_local.h" // [crispy] MLOOKUNIT
+#include "r_defer.h"
 #include "r_local.h"
+#include "r_simd.h"
 #include "r_sky.h"
 #include "st_stuff.h" // [crispy] ST_refreshBackground()
 #include "a11y.h" // [crispy] A11Y
@@ -858,7 +861,7 @@ void R_ExecuteSetViewSize (void)
 	fuzzcolfunc = R_DrawFuzzColumn;
 	transcolfunc = R_DrawTranslatedColumn;
 	tlcolfunc = R_DrawTLColumn;
-	spanfunc = goobers_mode ? R_DrawSpanSolid : R_DrawSpan;
+	spanfunc = goobers_mode ? R_DrawSpanSolid : simdspanfunc;
     }
     else
     {
@@ -869,6 +872,10 @@ void R_ExecuteSetViewSize (void)
 	spanfunc = goobers_mode ? R_DrawSpanSolidLow : R_DrawSpanLow;
     }
 
+    // [AP] record them, to draw once the view is done
+    if (deferdraw)
+	R_DeferDrawers ();
+
     R_InitBuffer (scaledviewwidth, viewheight);
 	
     R_InitTextureMapping ();
@@ -962,6 +969,8 @@ void R_Init (void)
     R_InitPointToAngle ();
     printf (".");
     R_InitTables ();
+    R_InitSIMD ();
+    R_InitDeferredDraw ();
     // viewwidth / viewheight / detailLevel are set by the defaults
     printf (".");
 
@@ -1114,6 +1123,7 @@ void R_RenderPlayerView (player_t* player)
     R_ClearDrawSegs ();
     R_ClearPlanes ();
     R_ClearSprites ();
+    R_ClearDrawCmds ();
     if (automapactive && !crispy->automapoverlay)
     {
         R_RenderBSPNode (numnodes-1);
@@ -1138,19 +1148,33 @@ void R_RenderPlayerView (player_t* player)
     // [crispy] smooth texture scrolling
     R_InterpolateTextureOffsets();
     // The head node is the last node output.
+    I_ProfStart(PROF_BSP);
     R_RenderBSPNode (numnodes-1);
+    I_ProfStop(PROF_BSP);
+    I_ProfCount(PROF_DRAWSEGS, ds_p - drawsegs);
+    I_ProfCount(PROF_VISSPRITES, vissprite_p - vissprites);
     
     // Check for new console commands.
     NetUpdate ();
     
+    I_ProfStart(PROF_PLANES);
     R_DrawPlanes ();
+    I_ProfStop(PROF_PLANES);
+
+    if (deferdraw)
+	R_FlushDrawCmds (true);
     
     // Check for new console commands.
     NetUpdate ();
     
     // [crispy] draw fuzz effect independent of rendering frame rate
     R_SetFuzzPosDraw();
+    I_ProfStart(PROF_MASKED);
     R_DrawMasked ();
+    I_ProfStop(PROF_MASKED);
+
+    if (deferdraw)
+	R_FlushDrawCmds (false);
 
     // Check for new console commands.
     NetUpdate ();				
@@ -45,6 +45,7 @@ extern fixed_t		centeryfrac;
 extern fixed_t		projection;
 
 extern int		validcount;
+extern int		framecount;
 
 extern int		linecount;
 extern int		loopcount;
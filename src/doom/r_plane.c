@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 
+#include "i_prof.h"
 #include "i_system.h"
 #include "z_zone.h"
 #include "w_wad.h"
@@ -29,6 +30,7 @@
 #include "doomdef.h"
 #include "doomstat.h"
 
+#include "r_defer.h"
 #include "r_local.h"
 #include "r_sky.h"
 #include "r_bmaps.h" // [crispy] R_BrightmapForTexName()
@@ -44,12 +46,18 @@ planefunction_t		ceilingfunc;
 //
 
 // Here comes the obnoxious "visplane".
+// [AP] Kept in hash chains like MBF, so MAXVISPLANES is the number of
+// chains now and must be a power of 2. A frame's planes go back to a free
+// list when the next one starts.
 #define MAXVISPLANES	128
-visplane_t*		visplanes = NULL;
-visplane_t*		lastvisplane;
+static visplane_t*	visplanes[MAXVISPLANES];
+static visplane_t*	freevisplanes;
+static int		numvisplanes; // In this frame
 visplane_t*		floorplane;
 visplane_t*		ceilingplane;
-static int		numvisplanes;
+
+#define visplane_hash(picnum,lightlevel,height) \
+  ((unsigned)((picnum)*3+(lightlevel)+(height)*7) & (MAXVISPLANES-1))
 
 // ?
 #define MAXOPENINGS	MAXWIDTH*64*4
@@ -202,7 +210,20 @@ void R_ClearPlanes (void)
 	ceilingclip[i] = -1;
     }
 
-    lastvisplane = visplanes;
+    // [AP] last frame's planes are reused
+    for (i = 0 ; i < MAXVISPLANES ; i++)
+    {
+	while (visplanes[i])
+	{
+	    visplane_t *pl = visplanes[i];
+
+	    visplanes[i] = pl->next;
+	    pl->next = freevisplanes;
+	    freevisplanes = pl;
+	}
+    }
+    numvisplanes = 0;
+
     lastopening = openings;
     
     // texture calculation
@@ -218,29 +239,29 @@ void R_ClearPlanes (void)
 
 
 
-// [crispy] remove MAXVISPLANES Vanilla limit
-static void R_RaiseVisplanes (visplane_t** vp)
+// [AP] Takes a plane from the free list, or allocates one, and links it
+// in its chain. Its top[] is left dirty, R_CheckPlane clears the columns
+// the plane grows over. No limit like vanilla MAXVISPLANES.
+static visplane_t *R_NewVisplane (unsigned hash)
 {
-    if (lastvisplane - visplanes == numvisplanes)
-    {
-	int numvisplanes_old = numvisplanes;
-	visplane_t* visplanes_old = visplanes;
+    visplane_t *check = freevisplanes;
 
-	numvisplanes = numvisplanes ? 2 * numvisplanes : MAXVISPLANES;
-	visplanes = I_Realloc(visplanes, numvisplanes * sizeof(*visplanes));
-	memset(visplanes + numvisplanes_old, 0, (numvisplanes - numvisplanes_old) * sizeof(*visplanes));
+    if (check)
+	freevisplanes = check->next;
+    else
+	check = I_Realloc(NULL, sizeof(*check));
 
-	lastvisplane = visplanes + numvisplanes_old;
-	floorplane = visplanes + (floorplane - visplanes_old);
-	ceilingplane = visplanes + (ceilingplane - visplanes_old);
+    check->next = visplanes[hash];
+    visplanes[hash] = check;
+    numvisplanes++;
 
-	if (numvisplanes_old)
-	    fprintf(stderr, "R_FindPlane: Hit MAXVISPLANES limit at %d, raised to %d.\n", numvisplanes_old, numvisplanes);
+    return check;
+}
 
-	// keep the pointer passed as argument in relation to the visplanes pointer
-	if (vp)
-	    *vp = visplanes + (*vp - visplanes_old);
-    }
+static void R_ClearPlaneTop (visplane_t *pl, int start, int stop)
+{
+    if (start <= stop)
+	memset(pl->top + start, 0xff, (stop - start + 1) * sizeof(*pl->top));
 }
 
 //
@@ -253,6 +274,7 @@ R_FindPlane
   int		lightlevel )
 {
     visplane_t*	check;
+    unsigned	hash;
 	
     // [crispy] add support for MBF sky tranfers
     if (picnum == skyflatnum || picnum & PL_SKYFLAT)
@@ -261,25 +283,19 @@ R_FindPlane
 	lightlevel = 0;
     }
 	
-    for (check=visplanes; check<lastvisplane; check++)
+    hash = visplane_hash(picnum, lightlevel, height);
+
+    for (check=visplanes[hash]; check; check=check->next)
     {
 	if (height == check->height
 	    && picnum == check->picnum
 	    && lightlevel == check->lightlevel)
 	{
-	    break;
+	    return check;
 	}
     }
     
-			
-    if (check < lastvisplane)
-	return check;
-		
-    R_RaiseVisplanes(&check); // [crispy] remove VISPLANES limit
-    if (lastvisplane - visplanes == MAXVISPLANES && false)
-	I_Error ("R_FindPlane: no more visplanes");
-		
-    lastvisplane++;
+    check = R_NewVisplane(hash);
 
     check->height = height;
     check->picnum = picnum;
@@ -287,8 +303,6 @@ R_FindPlane
     check->minx = SCREENWIDTH;
     check->maxx = -1;
     
-    memset (check->top,0xff,sizeof(check->top));
-		
     return check;
 }
 
@@ -307,6 +321,7 @@ R_CheckPlane
     int		unionl;
     int		unionh;
     int		x;
+    visplane_t*	new_pl;
 	
     if (start < pl->minx)
     {
@@ -340,6 +355,17 @@ R_CheckPlane
   {
     if (x > intrh)
     {
+	// [AP] clear top[] only where the plane grows
+	if (pl->minx > pl->maxx)
+	{
+	    R_ClearPlaneTop(pl, unionl, unionh);
+	}
+	else
+	{
+	    R_ClearPlaneTop(pl, unionl, pl->minx - 1);
+	    R_ClearPlaneTop(pl, pl->maxx + 1, unionh);
+	}
+
 	pl->minx = unionl;
 	pl->maxx = unionh;
 
@@ -349,19 +375,16 @@ R_CheckPlane
   }
 	
     // make a new visplane
-    R_RaiseVisplanes(&pl); // [crispy] remove VISPLANES limit
-    lastvisplane->height = pl->height;
-    lastvisplane->picnum = pl->picnum;
-    lastvisplane->lightlevel = pl->lightlevel;
+    new_pl = R_NewVisplane(visplane_hash(pl->picnum, pl->lightlevel, pl->height));
+    new_pl->height = pl->height;
+    new_pl->picnum = pl->picnum;
+    new_pl->lightlevel = pl->lightlevel;
     
-    if (lastvisplane - visplanes == MAXVISPLANES && false) // [crispy] remove VISPLANES limit
-	I_Error ("R_CheckPlane: no more visplanes");
-
-    pl = lastvisplane++;
+    pl = new_pl;
     pl->minx = start;
     pl->maxx = stop;
 
-    memset (pl->top,0xff,sizeof(pl->top));
+    R_ClearPlaneTop(pl, start, stop);
 		
     return pl;
 }
@@ -415,22 +438,22 @@ void R_DrawPlanes (void)
     int			stop;
     int			angle;
     int                 lumpnum;
+    int			i;
 				
 #ifdef RANGECHECK
     if (ds_p - drawsegs > numdrawsegs)
 	I_Error ("R_DrawPlanes: drawsegs overflow (%td)",
 		 ds_p - drawsegs);
     
-    if (lastvisplane - visplanes > numvisplanes)
-	I_Error ("R_DrawPlanes: visplane overflow (%td)",
-		 lastvisplane - visplanes);
-    
     if (lastopening - openings > MAXOPENINGS)
 	I_Error ("R_DrawPlanes: opening overflow (%td)",
 		 lastopening - openings);
 #endif
 
-    for (pl = visplanes ; pl < lastvisplane ; pl++)
+    I_ProfCount(PROF_VISPLANES, numvisplanes);
+
+    for (i = 0 ; i < MAXVISPLANES ; i++)
+    for (pl = visplanes[i] ; pl ; pl = pl->next)
     {
 	boolean swirling;
 
@@ -498,6 +521,9 @@ void R_DrawPlanes (void)
         lumpnum = firstflat + (swirling ? pl->picnum : flattranslation[pl->picnum]);
 	// [crispy] add support for SMMU swirling flats
 	ds_source = swirling ? R_DistortedFlat(lumpnum) : W_CacheLumpNum(lumpnum, PU_STATIC);
+	// [AP] the next swirling flat is distorted into the same buffer
+	if (swirling && deferdraw)
+	    ds_source = R_KeepFlat(ds_source);
 	ds_brightmap = R_BrightmapForFlatNum(lumpnum-firstflat);
 	
 	planeheight = abs(pl->height-viewz);
@@ -524,6 +550,10 @@ void R_DrawPlanes (void)
 			pl->bottom[x]);
 	}
 	
-        W_ReleaseLumpNum(lumpnum);
+	// [AP] drawn at the flush, the swirling ones were copied
+	if (deferdraw && !swirling)
+	    R_PinLump(lumpnum);
+	else
+	    W_ReleaseLumpNum(lumpnum);
     }
 }
@@ -0,0 +1,160 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Vectorized span drawer for SSE2. It draws the same pixels as
+//	R_DrawSpan in r_draw.c, and hands the cases it doesn't cover over
+//	to it.
+//
+
+#include <stdint.h>
+
+#include "doomdef.h"
+#include "doomstat.h"
+#include "m_argv.h"
+
+#include "r_local.h"
+#include "r_simd.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC takes any intrinsic as is, gcc and clang want the functions using
+// them marked with the instruction set.
+#if defined(__GNUC__)
+#define TARGET(isa) __attribute__((target(isa)))
+#else
+#define TARGET(isa)
+#endif
+
+// The view buffer lookups from r_draw.c
+extern pixel_t *ylookup[MAXHEIGHT];
+extern int columnofs[MAXWIDTH];
+
+void (*simdspanfunc) (void) = R_DrawSpan;
+
+
+#ifdef SIMD_X86
+
+//
+// R_FinishSpan
+// Leaves the pixels of the span past the first done ones to R_DrawSpan.
+//
+static void R_FinishSpan (int done)
+{
+    if (ds_x1 + done > ds_x2)
+	return;
+
+    ds_x1 += done;
+    ds_xfrac = (fixed_t) ((unsigned) ds_xfrac + done * (unsigned) ds_xstep);
+    ds_yfrac = (fixed_t) ((unsigned) ds_yfrac + done * (unsigned) ds_ystep);
+    R_DrawSpan ();
+}
+
+
+//
+// SSE2
+// No gathers, so only the texel indices of 4 pixels at once.
+//
+TARGET("sse2") static void R_DrawSpanSSE2 (void)
+{
+    const __m128i xmask = _mm_set1_epi32(0x3f);
+    const __m128i ymask = _mm_set1_epi32(0x0fc0);
+    const byte *source = ds_source;
+    const byte *brightmap = ds_brightmap;
+    lighttable_t *colormap0 = ds_colormap[0];
+    lighttable_t *colormap1 = ds_colormap[1];
+    unsigned xfrac = ds_xfrac, xstep = ds_xstep;
+    unsigned yfrac = ds_yfrac, ystep = ds_ystep;
+    __m128i vxfrac, vyfrac, vxstep, vystep;
+    pixel_t *dest;
+    int count, done, i;
+
+    // Flipped levels map the span right to left
+    if (crispy->fliplevels)
+    {
+	R_DrawSpan ();
+	return;
+    }
+
+    dest = ylookup[ds_y] + columnofs[ds_x1];
+    count = (ds_x2 - ds_x1 + 1) & ~3;
+
+    vxfrac = _mm_setr_epi32(xfrac, xfrac + xstep, xfrac + 2 * xstep, xfrac + 3 * xstep);
+    vyfrac = _mm_setr_epi32(yfrac, yfrac + ystep, yfrac + 2 * ystep, yfrac + 3 * ystep);
+    vxstep = _mm_set1_epi32(4 * xstep);
+    vystep = _mm_set1_epi32(4 * ystep);
+
+    for (done = 0; done < count; done += 4)
+    {
+	int spot[4];
+	const __m128i vspot = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(vyfrac, 10), ymask),
+	                                   _mm_and_si128(_mm_srli_epi32(vxfrac, 16), xmask));
+
+	_mm_storeu_si128((__m128i *) spot, vspot);
+	for (i = 0; i < 4; i++)
+	{
+	    const byte s = source[spot[i]];
+	    dest[done + i] = (brightmap[s] ? colormap1 : colormap0)[s];
+	}
+
+	vxfrac = _mm_add_epi32(vxfrac, vxstep);
+	vyfrac = _mm_add_epi32(vyfrac, vystep);
+    }
+
+    R_FinishSpan (done);
+}
+
+static boolean CPUHasSSE2 (void)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    return true;
+#elif defined(_MSC_VER)
+    int info[4];
+
+    __cpuid(info, 1);
+    return (info[3] & (1 << 26)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+
+#endif // SIMD_X86
+
+
+//
+// R_InitSIMD
+//
+void R_InitSIMD (void)
+{
+    //!
+    // @category video
+    //
+    // Only use the plain C span drawer, not the one for the CPU's vector
+    // instructions.
+    //
+
+    if (M_CheckParm("-nosimd"))
+	return;
+
+#if defined(SIMD_X86)
+    if (CPUHasSSE2())
+	simdspanfunc = R_DrawSpanSSE2;
+#endif
+}
@@ -0,0 +1,27 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Vectorized span drawers.
+//
+
+#ifndef __R_SIMD__
+#define __R_SIMD__
+
+// Picks the drawer below for what the CPU supports.
+void R_InitSIMD (void);
+
+// Same pixels as R_DrawSpan, which it is when the CPU has nothing better.
+extern void (*simdspanfunc) (void);
+
+#endif
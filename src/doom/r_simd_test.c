@@ -0,0 +1,343 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Checks the r_simd.c drawers against their plain versions in
+//	r_draw.c on random input, pixel for pixel, then times both.
+//	Links the real drawers, everything else they touch is here.
+//	Exits with 1 if any pixel differs.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "doomtype.h"
+#include "deh_str.h"
+#include "i_system.h"
+#include "i_video.h"
+#include "m_argv.h"
+#include "v_trans.h"
+#include "v_video.h"
+#include "w_wad.h"
+#include "z_zone.h"
+
+#include "r_local.h"
+#include "r_simd.h"
+
+#define TESTWIDTH 640
+#define TESTHEIGHT 400
+#define CHECKRUNS 3000
+#define TIMERUNS 200000
+
+// What the renderer and the video code would have set up
+
+int SCREENWIDTH = TESTWIDTH, SCREENHEIGHT = TESTHEIGHT;
+int WIDESCREENDELTA;
+pixel_t *I_VideoBuffer;
+int centery = TESTHEIGHT / 2;
+int *flipviewwidth;
+THREADLOCAL const byte *dc_brightmap;
+lighttable_t *colormaps;
+
+#ifndef CRISPY_TRUECOLOR
+byte *tranmap;
+#else
+// I_BlendAdd and I_BlendOver from i_video.c, for a fixed ARGB8888 format
+static const uint32_t rmask = 0xff0000, gmask = 0xff00, bmask = 0xff, amask = 0xff000000;
+static const uint8_t blend_alpha = 0xa8;
+
+const pixel_t I_BlendAdd (const pixel_t bg, const pixel_t fg)
+{
+    uint32_t r, g, b;
+
+    if ((r = (fg & rmask) + (bg & rmask)) > rmask) r = rmask;
+    if ((g = (fg & gmask) + (bg & gmask)) > gmask) g = gmask;
+    if ((b = (fg & bmask) + (bg & bmask)) > bmask) b = bmask;
+
+    return amask | r | g | b;
+}
+
+const pixel_t I_BlendDark (const pixel_t bg, const int d)
+{
+    I_Error("I_BlendDark: not in this test");
+}
+
+const pixel_t I_BlendOver (const pixel_t bg, const pixel_t fg)
+{
+    const uint32_t r = ((blend_alpha * (fg & rmask) + (0xff - blend_alpha) * (bg & rmask)) >> 8) & rmask;
+    const uint32_t g = ((blend_alpha * (fg & gmask) + (0xff - blend_alpha) * (bg & gmask)) >> 8) & gmask;
+    const uint32_t b = ((blend_alpha * (fg & bmask) + (0xff - blend_alpha) * (bg & bmask)) >> 8) & bmask;
+
+    return amask | r | g | b;
+}
+
+THREADLOCAL const pixel_t (*blendfunc) (const pixel_t fg, const pixel_t bg) = I_BlendOver;
+#endif
+
+// r_draw.c's border and background code, never called here
+
+void I_Error (const char *error, ...)
+{
+    va_list argptr;
+
+    va_start(argptr, error);
+    vfprintf(stderr, error, argptr);
+    va_end(argptr);
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+int M_CheckParm (const char *check)
+{
+    return 0;
+}
+
+#ifndef DEH_String
+const char *DEH_String (const char *s)
+{
+    return s;
+}
+#endif
+
+void V_DrawPatch (int x, int y, patch_t *patch)
+{
+    I_Error("V_DrawPatch: not in this test");
+}
+
+void V_MarkRect (int x, int y, int width, int height)
+{
+    I_Error("V_MarkRect: not in this test");
+}
+
+void V_UseBuffer (pixel_t *buffer)
+{
+    I_Error("V_UseBuffer: not in this test");
+}
+
+void V_RestoreBuffer (void)
+{
+    I_Error("V_RestoreBuffer: not in this test");
+}
+
+void *W_CacheLumpName (const char *name, int tag)
+{
+    I_Error("W_CacheLumpName: not in this test");
+}
+
+void *Z_Malloc (int size, int tag, void *user)
+{
+    I_Error("Z_Malloc: not in this test");
+}
+
+void Z_Free (void *ptr)
+{
+    I_Error("Z_Free: not in this test");
+}
+
+extern pixel_t *ylookup[MAXHEIGHT];
+extern int columnofs[MAXWIDTH];
+
+static pixel_t screen[2][TESTWIDTH * TESTHEIGHT];
+static lighttable_t testcolormaps[34][256];
+static byte brightmap[256];
+static byte texture[1 << 20];
+static byte flat[64 * 64];
+static int flip[TESTWIDTH];
+#ifndef CRISPY_TRUECOLOR
+static byte testtranmap[256 * 256];
+#endif
+
+static uint32_t randstate = 12345;
+
+static uint32_t Random (void)
+{
+    randstate ^= randstate << 13;
+    randstate ^= randstate >> 17;
+    randstate ^= randstate << 5;
+    return randstate;
+}
+
+static void Setup (void)
+{
+    int i, j;
+
+    for (i = 0; i < TESTWIDTH; i++)
+    {
+	columnofs[i] = i;
+	flip[i] = i;
+    }
+    flipviewwidth = flip;
+
+    for (i = 0; i < 34; i++)
+	for (j = 0; j < 256; j++)
+	    testcolormaps[i][j] = (pixel_t) Random();
+    colormaps = testcolormaps[0];
+
+    for (i = 0; i < 256; i++)
+	brightmap[i] = Random() & 1;
+    dc_brightmap = brightmap;
+    ds_brightmap = brightmap;
+
+    for (i = 0; i < (int) sizeof(texture); i++)
+	texture[i] = Random();
+    for (i = 0; i < (int) sizeof(flat); i++)
+	flat[i] = Random();
+
+#ifndef CRISPY_TRUECOLOR
+    for (i = 0; i < (int) sizeof(testtranmap); i++)
+	testtranmap[i] = Random();
+    tranmap = testtranmap;
+#endif
+}
+
+static void UseScreen (pixel_t *buffer)
+{
+    int i;
+
+    for (i = 0; i < TESTHEIGHT; i++)
+	ylookup[i] = buffer + i * TESTWIDTH;
+}
+
+// Anything the drawer has to get right, including odd steps and
+// misaligned sources
+static void RandomSpan (void)
+{
+    int a = Random() % TESTWIDTH, b = Random() % TESTWIDTH;
+
+    ds_x1 = a < b ? a : b;
+    ds_x2 = a < b ? b : a;
+    ds_y = Random() % TESTHEIGHT;
+    ds_xfrac = Random();
+    ds_yfrac = Random();
+    ds_xstep = (int) (Random() % 0x40000) - 0x20000;
+    ds_ystep = (int) (Random() % 0x40000) - 0x20000;
+    ds_source = Random() & 1 ? flat : texture + 1 + Random() % 3; // Misaligned too
+    ds_colormap[0] = testcolormaps[Random() % 34];
+    ds_colormap[1] = Random() % 4 ? colormaps : ds_colormap[0];
+}
+
+// What a frame is mostly made of: spans of 16 to 440 pixels
+static void TypicalSpan (void)
+{
+    ds_x1 = Random() % 200;
+    ds_x2 = ds_x1 + 16 + Random() % (TESTWIDTH - 216);
+    ds_y = Random() % TESTHEIGHT;
+    ds_xfrac = Random();
+    ds_yfrac = Random();
+    ds_xstep = (int) (Random() % 0x40000) - 0x20000;
+    ds_ystep = (int) (Random() % 0x40000) - 0x20000;
+    ds_source = flat;
+    ds_colormap[0] = testcolormaps[Random() % 32];
+    ds_colormap[1] = colormaps;
+}
+
+typedef struct
+{
+    const char *name;
+    void (*plain) (void);
+    void (**simd) (void);
+    void (*random) (void);
+    void (*typical) (void);
+    boolean span;
+} drawertest_t;
+
+// Both draw the same random input over the same random screen
+static long CountMismatches (const drawertest_t *test)
+{
+    long mismatches = 0;
+    uint32_t seed;
+    int i, j;
+
+    for (i = 0; i < CHECKRUNS; i++)
+    {
+	for (j = 0; j < TESTWIDTH * TESTHEIGHT; j++)
+	    screen[0][j] = screen[1][j] = (pixel_t) Random();
+
+	seed = randstate;
+	test->random();
+	UseScreen(screen[0]);
+	test->plain();
+
+	randstate = seed;
+	test->random();
+	UseScreen(screen[1]);
+	(*test->simd)();
+
+	for (j = 0; j < TESTWIDTH * TESTHEIGHT; j++)
+	    mismatches += screen[0][j] != screen[1][j];
+    }
+
+    return mismatches;
+}
+
+static double Now (void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Nanoseconds per pixel
+static double TimeDrawer (const drawertest_t *test, void (*drawer) (void))
+{
+    double elapsed = 0, start;
+    long pixels = 0;
+    int i;
+
+    UseScreen(screen[0]);
+    randstate = 777;
+
+    for (i = 0; i < TIMERUNS; i++)
+    {
+	test->typical();
+	pixels += test->span ? ds_x2 - ds_x1 + 1 : dc_yh - dc_yl + 1;
+	start = Now();
+	drawer();
+	elapsed += Now() - start;
+    }
+
+    return elapsed / pixels;
+}
+
+int main (int argc, char **argv)
+{
+    static const drawertest_t tests[] = {
+	{ "R_DrawSpan", R_DrawSpan, &simdspanfunc, RandomSpan, TypicalSpan, true },
+    };
+    boolean failed = false;
+    int i;
+
+    Setup();
+    R_InitSIMD();
+
+    for (i = 0; i < arrlen(tests); i++)
+    {
+	const drawertest_t *test = &tests[i];
+	const long mismatches = CountMismatches(test);
+	const double plain = TimeDrawer(test, test->plain);
+	const double simd = TimeDrawer(test, *test->simd);
+
+	printf("%-16s %6.2f ns/px -> %6.2f ns/px (%.2fx), %ld pixels differ%s\n",
+	       test->name, plain, simd, plain / simd, mismatches,
+	       *test->simd == test->plain ? " (no vector version here)" : "");
+
+	if (mismatches)
+	    failed = true;
+    }
+
+    return failed ? 1 : 0;
+}
@@ -31,6 +31,7 @@
 #include "z_zone.h"
 #include "w_wad.h"
 
+#include "r_defer.h"
 #include "r_local.h"
 
 #include "doomstat.h"
@@ -479,6 +480,10 @@ R_DrawVisSprite
 	
     patch = W_CacheLumpNum (vis->patch+firstspritelump, PU_CACHE);
 
+    // [AP] drawn at the flush
+    if (deferdraw)
+	R_PinLump (vis->patch+firstspritelump);
+
     // [crispy] brightmaps for select sprites
     dc_colormap[0] = vis->colormap[0];
     dc_colormap[1] = vis->colormap[1];
@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include <ctype.h>
 
+#include "i_prof.h"
 #include "i_swap.h" // [crispy] SHORT()
 #include "i_system.h"
 #include "i_video.h"
@@ -448,6 +449,7 @@ cheatseq_t cheat_spechits = CHEAT("spechits", 0);
 cheatseq_t cheat_nomomentum = CHEAT("nomomentum", 0);
 cheatseq_t cheat_showfps = CHEAT("showfps", 0);
 cheatseq_t cheat_showfps2 = CHEAT("idrate", 0); // [crispy] PrBoom+
+cheatseq_t cheat_showprof = CHEAT("showprof", 0); // [AP] engine stage timings
 cheatseq_t cheat_goobers = CHEAT("goobers", 0);
 cheatseq_t cheat_version = CHEAT("version", 0); // [crispy] Russian Doom
 cheatseq_t cheat_skill = CHEAT("skill", 0);
@@ -1178,6 +1180,11 @@ ST_Responder (event_t* ev)
     {
 	plyr->powers[pw_showfps] ^= 1;
     }
+    // [AP] per stage frame timings, see i_prof.c
+    else if (cht_CheckCheat(&cheat_showprof, ev->data2))
+    {
+	I_ProfToggleOverlay();
+    }
     // [crispy] implement Boom's "tnthom" cheat
     else if (cht_CheckCheat(&cheat_hom, ev->data2))
     {
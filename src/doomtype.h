@@ -90,6 +90,16 @@
 
 #define PACKED_STRUCT(...) PACKEDPREFIX struct __VA_ARGS__ PACKEDATTR
 
+// [AP] One copy of the variable per thread, for the drawer state each
+// thread drawing commands keeps to itself.
+#if defined(_MSC_VER)
+#define THREADLOCAL __declspec(thread)
+#elif defined(__GNUC__)
+#define THREADLOCAL __thread
+#else
+#define THREADLOCAL _Thread_local
+#endif
+
 // C99 integer types; with gcc we just use this.  Other compilers
 // should add conditional statements that define the C99 types.
 
@@ -124,7 +124,7 @@ void on_ap_give_item(int doom_type, int ep, int map)
 {
     player_t* player = &players[consoleplayer];
     int sound = sfx_itemup;
-    ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
+    const ap_level_info_t* level_info = ap_get_level_info(ap_make_level_index(gameepisode, gamemap));
 
     switch (doom_type)
     {
@@ -1398,6 +1398,10 @@ void D_DoomMain(void)
         ap_settings.reset_level_on_death = atoi(myargv[reset_level_on_death_id + 1]) ? 1 : 0;
     }
 
+    // Also dump AP state as apstate.json on exit, for debugging
+    if (M_CheckParm("-apjsonstate"))
+        ap_settings.export_json_state = 1;
+
     // Initialize AP
     ap_settings.ip = myargv[apserver_arg_id + 1];
     if (mission == heretic)
@@ -1608,6 +1612,9 @@ void D_DoomMain(void)
     // Generate the WAD hash table.  Speed things up a bit.
     W_GenerateHashTable();
 
+    // [AP] Build notification icons
+    ap_notif_init();
+
     // [crispy] process .deh files from PWADs autoload directories
 
     if (!M_ParmExists("-noautoload") && gamemode != shareware)
@@ -1751,6 +1758,19 @@ void D_DoomMain(void)
 // start the appropriate game based on params
 //
 
+    // [AP] Everything below starts a game before the main loop gets to
+    // wait for the connection, so wait here instead.
+    if (autostart || netgame || M_CheckParm("-loadgame")
+     || M_CheckParm("-recordfrom") || M_CheckParm("-record")
+     || M_CheckParm("-playdemo") || M_CheckParm("-timedemo"))
+    {
+        if (apdoom_wait_for_init() == AP_INIT_STATE_FAILED)
+        {
+            I_Error("Failed to initialize Archipelago.\n%s",
+                    apdoom_get_init_status_text());
+        }
+    }
+
     D_CheckRecordFrom();
 
     //!
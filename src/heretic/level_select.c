@@ -513,7 +513,7 @@ void DrawEpisodicLevelSelectStats()
     for (int i = 0; i < map_count; ++i)
     {
         level_pos_t* level_pos = &level_pos_infos[selected_ep][i];
-        ap_level_info_t* ap_level_info = ap_get_level_info(ap_make_level_index(selected_ep + 1, i + 1));
+        const ap_level_info_t* ap_level_info = ap_get_level_info(ap_make_level_index(selected_ep + 1, i + 1));
         ap_level_state_t* ap_level_state = ap_get_level_state(ap_make_level_index(selected_ep + 1, i + 1));
 
         x = level_pos->x;
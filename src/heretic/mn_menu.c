@@ -1268,6 +1268,10 @@ static boolean SCKill(int option)
 
 static boolean SCLevelSelect(int option)
 {
+    // Still connecting, the status line tells the player what we're waiting on
+    if (apdoom_get_init_state() != AP_INIT_STATE_READY)
+        return false;
+
     MenuActive = false;
 
     // Was the game quit during a level?
@@ -565,7 +565,7 @@ void get_fit_dimensions(fixed_t x, fixed_t y, fixed_t* fit_radius, fixed_t* fit_
 void P_LoadThings(int lump)
 {
     byte *data;
-    int i, j;
+    int i;
     mapthing_t spawnthing;
     mapthing_t spawnthing_player1_start;
     mapthing_t *mt;
@@ -1003,17 +1003,7 @@ void P_LoadThings(int lump)
                     spawnthing.type = 20001;
                 else
                     spawnthing.type = 20000;
-                int skip = 0;
-                ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(gameepisode, gamemap));
-                for (j = 0; j < level_state->check_count; ++j)
-                {
-                    if (level_state->checks[j] == i)
-                    {
-                        skip = 1;
-                        break;
-                    }
-                }
-                if (skip)
+                if (ap_is_location_checked(ap_make_level_index(gameepisode, gamemap), i))
                     continue;
             }
         }
@@ -1030,6 +1030,10 @@ void D_DoomMain(void)
         ap_settings.reset_level_on_death = atoi(myargv[reset_level_on_death_id + 1]) ? 1 : 0;
     }
 
+    // Also dump AP state as apstate.json on exit, for debugging
+    if (M_CheckParm("-apjsonstate"))
+        ap_settings.export_json_state = 1;
+
     // Initialize AP
     ap_settings.ip = myargv[apserver_arg_id + 1];
     if (mission == hexen)
@@ -1053,13 +1057,12 @@ void D_DoomMain(void)
     ap_settings.message_callback = on_ap_message;
     ap_settings.give_item_callback = on_ap_give_item;
     ap_settings.victory_callback = on_ap_victory;
+    ap_settings.ready_callback = SetApSavePath; // Save dir depends on the seed
     if (!apdoom_init(&ap_settings))
     {
 	    I_Error("Failed to initialize Archipelago.");
     }
 
-    SetApSavePath();
-
     // haleyjd: removed WATCOMC
 
     ST_Message("W_Init: Init WADfiles.\n");
@@ -1129,6 +1132,9 @@ void D_DoomMain(void)
     // Generate the WAD hash table.  Speed things up a bit.
     W_GenerateHashTable();
 
+    // [AP] Build notification icons
+    ap_notif_init();
+
     I_PrintStartupBanner(gamedescription);
 
     ST_Message("MN_Init: Init menu system.\n");
@@ -1190,6 +1196,20 @@ void D_DoomMain(void)
                    WarpMap, P_GetMapName(startmap), startmap, startskill + 1);
     }
 
+    // [AP] Everything below starts a game before the main loop gets to
+    // wait for the connection, so wait here instead. This also sets
+    // SavePath through the ready callback.
+    if (autostart || netgame || M_CheckParm("-loadgame")
+     || M_CheckParm("-recordfrom") || M_CheckParm("-record")
+     || M_CheckParm("-playdemo") || M_CheckParm("-timedemo"))
+    {
+        if (apdoom_wait_for_init() == AP_INIT_STATE_FAILED)
+        {
+            I_Error("Failed to initialize Archipelago.\n%s",
+                    apdoom_get_init_status_text());
+        }
+    }
+
     CheckRecordFrom();
 
     //!
@@ -385,7 +385,7 @@ void DrawEpisodicLevelSelectStats()
         level_pos_t* level_pos = &level_pos_infos[i];
 
 	for (int map = 0; map < ap_get_map_count(hub_for_slot[i] + 1); map++) {
-	        ap_level_info_t* ap_level_info = ap_get_level_info(ap_make_level_index(hub_for_slot[i] + 1, map + 1));
+	        const ap_level_info_t* ap_level_info = ap_get_level_info(ap_make_level_index(hub_for_slot[i] + 1, map + 1));
         	ap_level_state_t* ap_level_state = ap_get_level_state(ap_make_level_index(hub_for_slot[i] + 1, map + 1));
 		if (map == 0) {
 			completed = ap_level_state->completed;
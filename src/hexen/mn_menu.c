@@ -129,6 +129,7 @@ static void SCSfxVolume(int option);
 static void SCMusicVolume(int option);
 static void SCScreenSize(int option);
 static boolean SCNetCheck(int option);
+static boolean SavePathReady(void);
 static void CrispyHires(int option);
 static void CrispyToggleWidescreen(int option);
 static void CrispySmoothing(int option);
@@ -1277,6 +1278,10 @@ static void SCKill(int option)
 
 static void SCLevelSelect(int option)
 {
+    // Still connecting, the status line tells the player what we're waiting on
+    if (apdoom_get_init_state() != AP_INIT_STATE_READY)
+        return;
+
     MenuActive = false;
 
     // Was the game quit during a level?
@@ -1323,6 +1328,20 @@ static boolean SCNetCheck(int option)
     return false;
 }
 
+//===========================================================================
+//
+// SavePathReady
+//
+// [AP] SavePath is the seed's directory once Archipelago is ready. Until
+// then, slots would be read from and written to the default one.
+//
+//===========================================================================
+
+static boolean SavePathReady(void)
+{
+    return apdoom_get_init_state() == AP_INIT_STATE_READY;
+}
+
 //===========================================================================
 //
 // SCNetCheck2
@@ -1343,6 +1362,10 @@ static void SCNetCheck2(int option)
 
 static void SCLoadGame(int option)
 {
+    if (!SavePathReady())
+    {
+        return;
+    }
     if (demoplayback)
     {
         // deactivate playback, return control to player
@@ -1393,6 +1416,11 @@ static void SCSaveGame(int option)
 {
     char *ptr;
 
+    if (!SavePathReady())
+    {
+        return;
+    }
+
     if (!FileMenuKeySteal)
     {
         int x, y;
@@ -2115,7 +2143,7 @@ boolean MN_Responder(event_t * event)
         else if (key == key_menu_load)           // F3 (load game)
         {
 #if 0 // [AP] Disable manual saves in AP
-            if (SCNetCheck(2))
+            if (SCNetCheck(2) && SavePathReady())
             {
                 MenuActive = true;
                 FileMenuKeySteal = false;
@@ -2210,7 +2238,7 @@ boolean MN_Responder(event_t * event)
         else if (key == key_menu_qload)          // F9 (quickload)
         {
 #if 0 // [AP] Disable manual saves in AP
-            if (SCNetCheck(2))
+            if (SCNetCheck(2) && SavePathReady())
             {
                 if (!quickload || quickload == -1)
                 {
@@ -2707,6 +2735,12 @@ void MN_DrawInfo(void)
 
 static void SetMenu(MenuType_t menu)
 {
+    if ((menu == MENU_FILES || menu == MENU_LOAD || menu == MENU_SAVE)
+     && !SavePathReady())
+    {
+        return;
+    }
+
     CurrentMenu->oldItPos = CurrentItPos;
     CurrentMenu = Menus[menu];
     CurrentItPos = CurrentMenu->oldItPos;
@@ -652,7 +652,7 @@ boolean dont_shuffle_for_map(int doom_type) {
 void P_LoadThings(int lump)
 {
     byte *data;
-    int i, j;
+    int i;
     mapthing_t spawnthing;
     mapthing_t spawnthing_player1_start;
     mapthing_t *mt;
@@ -1027,17 +1027,7 @@ void P_LoadThings(int lump)
                 else
                     spawnthing.type = 20000;
 		if (spawnthing.special == 0) { // anything that triggers something needs to be kept
-                    int skip = 0;
-                    ap_level_state_t* level_state = ap_get_level_state(ap_make_level_index(gameepisode, gamemap));
-                    for (j = 0; j < level_state->check_count; ++j)
-                    {
-                        if (level_state->checks[j] == i)
-                        {
-                            skip = 1;
-                            break;
-                        }
-                    }
-                    if (skip)
+                    if (ap_is_location_checked(ap_make_level_index(gameepisode, gamemap), i))
                         continue;
 		}
             }
@@ -0,0 +1,386 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//      Per frame timers and counters for the hot paths, written to a
+//      CSV file, a Chrome trace and an on-screen overlay.
+//
+
+#include <stdio.h>
+#include <string.h>
+
+#include "doomtype.h"
+#include "i_system.h"
+#include "i_timer.h"
+#include "m_argv.h"
+#include "m_misc.h"
+
+#include "i_prof.h"
+
+#define MAX_TRACE_EVENTS 256 // Per frame, the rest are dropped
+#define OVERLAY_FRAMES 35    // Overlay shows average and peak over that many frames
+
+static const char *timernames[NUMPROFTIMERS] =
+{
+    "bsp",
+    "planes",
+    "masked",
+    "drawcmds",
+    "thinkers",
+    "specials",
+    "netupdate",
+    "finishupdate",
+    "apupdate",
+    "sound",
+};
+
+static const char *counternames[NUMPROFCOUNTERS] =
+{
+    "visplanes",
+    "drawsegs",
+    "vissprites",
+    "intercepts",
+};
+
+typedef struct
+{
+    proftimer_t timer;
+    uint64_t start;
+    uint64_t duration;
+} traceevent_t;
+
+boolean profiling = false;
+
+static FILE *csvfile;
+static FILE *tracefile;
+static boolean traceempty = true;
+static boolean overlay;
+
+// Current frame
+static uint64_t framestart;
+static int framenum;
+static boolean timerrunning[NUMPROFTIMERS];
+static uint64_t timerstart[NUMPROFTIMERS];
+static uint64_t timertotal[NUMPROFTIMERS];
+static int countertotal[NUMPROFCOUNTERS];
+static traceevent_t traceevents[MAX_TRACE_EVENTS];
+static int numtraceevents;
+
+// Overlay window. Timers are followed by the whole frame.
+static int windowframes;
+static uint64_t windowtime[NUMPROFTIMERS + 1];
+static uint64_t windowtimepeak[NUMPROFTIMERS + 1];
+static uint64_t windowcount[NUMPROFCOUNTERS];
+static int windowcountpeak[NUMPROFCOUNTERS];
+static char overlaylines[PROF_OVERLAYLINES][40];
+
+static void ResetFrame(void)
+{
+    memset(timerrunning, 0, sizeof(timerrunning));
+    memset(timertotal, 0, sizeof(timertotal));
+    memset(countertotal, 0, sizeof(countertotal));
+    numtraceevents = 0;
+}
+
+static void ResetWindow(void)
+{
+    windowframes = 0;
+    memset(windowtime, 0, sizeof(windowtime));
+    memset(windowtimepeak, 0, sizeof(windowtimepeak));
+    memset(windowcount, 0, sizeof(windowcount));
+    memset(windowcountpeak, 0, sizeof(windowcountpeak));
+}
+
+static void TraceEvent(const char *fmt, const char *name, uint64_t ts, uint64_t arg)
+{
+    fputs(traceempty ? "\n" : ",\n", tracefile);
+    fprintf(tracefile, fmt, name, (unsigned long long) ts, (unsigned long long) arg);
+    traceempty = false;
+}
+
+static void I_ShutdownProfiling(void)
+{
+    if (csvfile != NULL)
+    {
+        fclose(csvfile);
+        csvfile = NULL;
+    }
+
+    if (tracefile != NULL)
+    {
+        fputs("\n]\n", tracefile);
+        fclose(tracefile);
+        tracefile = NULL;
+    }
+
+    profiling = overlay;
+}
+
+void I_InitProfiling(void)
+{
+    int i, p;
+
+    //!
+    // @arg <file>
+    // @category obscure
+    //
+    // Write how long each engine stage took, and the visplane, drawseg,
+    // vissprite and intercept counts, to a CSV file. One line per frame.
+    //
+
+    p = M_CheckParmWithArgs("-profcsv", 1);
+
+    if (p > 0)
+    {
+        csvfile = fopen(myargv[p + 1], "w");
+
+        if (csvfile == NULL)
+        {
+            I_Error("I_InitProfiling: Can't open %s", myargv[p + 1]);
+        }
+
+        fputs("frame,frame_us", csvfile);
+        for (i = 0; i < NUMPROFTIMERS; ++i)
+        {
+            fprintf(csvfile, ",%s_us", timernames[i]);
+        }
+        for (i = 0; i < NUMPROFCOUNTERS; ++i)
+        {
+            fprintf(csvfile, ",%s", counternames[i]);
+        }
+        fputs("\n", csvfile);
+    }
+
+    //!
+    // @arg <file>
+    // @category obscure
+    //
+    // Write the same timings as -profcsv as a Chrome trace, to open in
+    // chrome://tracing or Perfetto.
+    //
+
+    p = M_CheckParmWithArgs("-proftrace", 1);
+
+    if (p > 0)
+    {
+        tracefile = fopen(myargv[p + 1], "w");
+
+        if (tracefile == NULL)
+        {
+            I_Error("I_InitProfiling: Can't open %s", myargv[p + 1]);
+        }
+
+        fputs("[", tracefile);
+    }
+
+    profiling = csvfile != NULL || tracefile != NULL;
+
+    if (profiling)
+    {
+        I_AtExit(I_ShutdownProfiling, true);
+    }
+}
+
+void I_ProfStart(proftimer_t timer)
+{
+    if (!profiling)
+    {
+        return;
+    }
+
+    timerrunning[timer] = true;
+    timerstart[timer] = I_GetTimeUS();
+}
+
+void I_ProfStop(proftimer_t timer)
+{
+    uint64_t duration;
+
+    // Not running if profiling was turned on in the middle
+    if (!profiling || !timerrunning[timer])
+    {
+        return;
+    }
+
+    duration = I_GetTimeUS() - timerstart[timer];
+    timerrunning[timer] = false;
+    timertotal[timer] += duration;
+
+    if (tracefile != NULL && numtraceevents < MAX_TRACE_EVENTS)
+    {
+        traceevents[numtraceevents].timer = timer;
+        traceevents[numtraceevents].start = timerstart[timer];
+        traceevents[numtraceevents].duration = duration;
+        ++numtraceevents;
+    }
+}
+
+void I_ProfCount(profcounter_t counter, int amount)
+{
+    if (profiling)
+    {
+        countertotal[counter] += amount;
+    }
+}
+
+static void WriteFrame(uint64_t now)
+{
+    int i;
+
+    if (csvfile != NULL)
+    {
+        fprintf(csvfile, "%d,%llu", framenum,
+                (unsigned long long) (now - framestart));
+        for (i = 0; i < NUMPROFTIMERS; ++i)
+        {
+            fprintf(csvfile, ",%llu", (unsigned long long) timertotal[i]);
+        }
+        for (i = 0; i < NUMPROFCOUNTERS; ++i)
+        {
+            fprintf(csvfile, ",%d", countertotal[i]);
+        }
+        fputs("\n", csvfile);
+    }
+
+    if (tracefile != NULL)
+    {
+        const char *complete = "{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":%llu,\"dur\":%llu}";
+
+        TraceEvent(complete, "frame", framestart, now - framestart);
+        for (i = 0; i < numtraceevents; ++i)
+        {
+            TraceEvent(complete, timernames[traceevents[i].timer],
+                       traceevents[i].start, traceevents[i].duration);
+        }
+
+        fputs(",\n{\"name\":\"counters\",\"ph\":\"C\",\"pid\":1,\"ts\":", tracefile);
+        fprintf(tracefile, "%llu,\"args\":{", (unsigned long long) framestart);
+        for (i = 0; i < NUMPROFCOUNTERS; ++i)
+        {
+            fprintf(tracefile, "%s\"%s\":%d", i ? "," : "", counternames[i],
+                    countertotal[i]);
+        }
+        fputs("}}", tracefile);
+    }
+}
+
+static void UpdateOverlay(uint64_t frametime)
+{
+    int i;
+
+    for (i = 0; i <= NUMPROFTIMERS; ++i)
+    {
+        uint64_t t = i < NUMPROFTIMERS ? timertotal[i] : frametime;
+
+        windowtime[i] += t;
+        if (t > windowtimepeak[i])
+        {
+            windowtimepeak[i] = t;
+        }
+    }
+
+    for (i = 0; i < NUMPROFCOUNTERS; ++i)
+    {
+        windowcount[i] += countertotal[i];
+        if (countertotal[i] > windowcountpeak[i])
+        {
+            windowcountpeak[i] = countertotal[i];
+        }
+    }
+
+    if (++windowframes < OVERLAY_FRAMES)
+    {
+        return;
+    }
+
+    // ms, average and peak
+    M_snprintf(overlaylines[0], sizeof(overlaylines[0]), "%-12s %6.2f %6.2f",
+               "frame", windowtime[NUMPROFTIMERS] / (windowframes * 1000.0),
+               windowtimepeak[NUMPROFTIMERS] / 1000.0);
+    for (i = 0; i < NUMPROFTIMERS; ++i)
+    {
+        M_snprintf(overlaylines[1 + i], sizeof(overlaylines[0]), "%-12s %6.2f %6.2f",
+                   timernames[i], windowtime[i] / (windowframes * 1000.0),
+                   windowtimepeak[i] / 1000.0);
+    }
+    for (i = 0; i < NUMPROFCOUNTERS; ++i)
+    {
+        M_snprintf(overlaylines[1 + NUMPROFTIMERS + i], sizeof(overlaylines[0]),
+                   "%-12s %6d %6d", counternames[i],
+                   (int) (windowcount[i] / windowframes), windowcountpeak[i]);
+    }
+
+    ResetWindow();
+}
+
+void I_ProfFrame(void)
+{
+    uint64_t now;
+
+    if (!profiling)
+    {
+        framestart = 0;
+        return;
+    }
+
+    now = I_GetTimeUS();
+
+    // First frame since recording started is only partly timed
+    if (framestart != 0)
+    {
+        WriteFrame(now);
+
+        if (overlay)
+        {
+            UpdateOverlay(now - framestart);
+        }
+
+        ++framenum;
+    }
+
+    framestart = now;
+    ResetFrame();
+}
+
+void I_ProfToggleOverlay(void)
+{
+    int i;
+
+    overlay = !overlay;
+    profiling = overlay || csvfile != NULL || tracefile != NULL;
+
+    framestart = 0;
+    ResetFrame();
+    ResetWindow();
+
+    M_StringCopy(overlaylines[0], "profiling...", sizeof(overlaylines[0]));
+    for (i = 1; i < PROF_OVERLAYLINES; ++i)
+    {
+        overlaylines[i][0] = '\0';
+    }
+}
+
+boolean I_ProfOverlayActive(void)
+{
+    return overlay;
+}
+
+const char *I_ProfOverlayLine(int i)
+{
+    if (!overlay || i < 0 || i >= PROF_OVERLAYLINES)
+    {
+        return NULL;
+    }
+
+    return overlaylines[i];
+}
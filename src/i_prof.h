@@ -0,0 +1,76 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//      Per frame timers and counters for the hot paths, written to a
+//      CSV file, a Chrome trace and an on-screen overlay.
+//
+
+
+#ifndef __I_PROF__
+#define __I_PROF__
+
+#include "doomtype.h"
+
+typedef enum
+{
+    PROF_BSP,           // R_RenderBSPNode
+    PROF_PLANES,        // R_DrawPlanes
+    PROF_MASKED,        // R_DrawMasked
+    PROF_DRAWCMDS,      // R_FlushDrawCmds, with -deferdraw
+    PROF_THINKERS,      // P_RunThinkers
+    PROF_SPECIALS,      // P_UpdateSpecials
+    PROF_NETUPDATE,     // NetUpdate
+    PROF_FINISHUPDATE,  // I_FinishUpdate
+    PROF_APUPDATE,      // apdoom_update
+    PROF_SOUND,         // S_UpdateSounds
+    NUMPROFTIMERS
+} proftimer_t;
+
+typedef enum
+{
+    PROF_VISPLANES,
+    PROF_DRAWSEGS,
+    PROF_VISSPRITES,
+    PROF_INTERCEPTS,
+    NUMPROFCOUNTERS
+} profcounter_t;
+
+// True while anything is recording. The functions below return right
+// away when it isn't.
+extern boolean profiling;
+
+// Opens the files asked for on the command line.
+void I_InitProfiling(void);
+
+// A timer adds up every start/stop pair of a frame. Main thread only, and
+// a timer can't be started again before it's stopped.
+void I_ProfStart(proftimer_t timer);
+void I_ProfStop(proftimer_t timer);
+
+// Counters add up over a frame.
+void I_ProfCount(profcounter_t counter, int amount);
+
+// Ends the current frame: writes it out and feeds the overlay.
+void I_ProfFrame(void);
+
+// The overlay turns recording on while it's shown.
+void I_ProfToggleOverlay(void);
+boolean I_ProfOverlayActive(void);
+
+// Text of overlay line i, NULL past the last line. The first line is the
+// whole frame, then one per timer and one per counter.
+#define PROF_OVERLAYLINES (1 + NUMPROFTIMERS + NUMPROFCOUNTERS)
+const char *I_ProfOverlayLine(int i);
+
+#endif
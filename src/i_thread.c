@@ -0,0 +1,232 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//      Worker threads for splitting loops across cores.
+//
+
+#include <stdlib.h>
+
+#include "SDL.h"
+
+#include "doomtype.h"
+#include "i_system.h"
+#include "m_argv.h"
+
+#include "i_thread.h"
+
+#define MAX_WORKERS 15
+
+static SDL_Thread *workers[MAX_WORKERS];
+static int numworkers = -1;
+
+static SDL_mutex *job_mutex;
+static SDL_cond *job_cond;  // Workers wait on it for a new batch
+static SDL_cond *done_cond; // I_FinishJobs waits on it for busy workers
+
+// Current batch. Written under job_mutex, bumping job_generation.
+static jobfunc_t job_func;
+static void *job_data;
+static int job_count;
+static int job_generation;
+static SDL_atomic_t job_next;
+static int workers_busy;
+static boolean job_started;
+
+static void RunJobs(jobfunc_t func, void *data, int count)
+{
+    int i;
+
+    while ((i = SDL_AtomicAdd(&job_next, 1)) < count)
+    {
+        func(i, data);
+    }
+}
+
+static int WorkerThread(void *unused)
+{
+    int generation = 0;
+
+    SDL_LockMutex(job_mutex);
+
+    for (;;)
+    {
+        jobfunc_t func;
+        void *data;
+        int count;
+
+        while (job_generation == generation)
+        {
+            SDL_CondWait(job_cond, job_mutex);
+        }
+
+        // Copied under the lock: if this worker wakes up late it sees
+        // the batch that is current now, not a stale mix of two.
+        generation = job_generation;
+        func = job_func;
+        data = job_data;
+        count = job_count;
+        ++workers_busy;
+        SDL_UnlockMutex(job_mutex);
+
+        RunJobs(func, data, count);
+
+        SDL_LockMutex(job_mutex);
+        if (--workers_busy == 0)
+        {
+            SDL_CondSignal(done_cond);
+        }
+    }
+
+    return 0;
+}
+
+static void I_ShutdownThreads(void)
+{
+    // Workers are blocked waiting for a batch, they go away with the
+    // process. Just make sure none is still running one.
+    I_FinishJobs();
+}
+
+static void I_InitThreads(void)
+{
+    int i, p;
+
+    numworkers = SDL_GetCPUCount() - 1;
+
+    //!
+    // @arg <n>
+    // @category obscure
+    //
+    // Split level loading and drawing across at most n threads. 1
+    // keeps everything on the main thread.
+    //
+
+    p = M_CheckParmWithArgs("-threads", 1);
+
+    if (p > 0)
+    {
+        numworkers = atoi(myargv[p + 1]) - 1;
+    }
+
+    if (numworkers > MAX_WORKERS)
+    {
+        numworkers = MAX_WORKERS;
+    }
+
+    if (numworkers <= 0)
+    {
+        numworkers = 0;
+        return;
+    }
+
+    job_mutex = SDL_CreateMutex();
+    job_cond = SDL_CreateCond();
+    done_cond = SDL_CreateCond();
+
+    for (i = 0; i < numworkers; ++i)
+    {
+        workers[i] = SDL_CreateThread(WorkerThread, "worker", NULL);
+
+        if (workers[i] == NULL)
+        {
+            numworkers = i;
+            break;
+        }
+
+        SDL_DetachThread(workers[i]);
+    }
+
+    I_AtExit(I_ShutdownThreads, true);
+}
+
+int I_NumThreads(void)
+{
+    if (numworkers < 0)
+    {
+        I_InitThreads();
+    }
+
+    return numworkers + 1;
+}
+
+void I_StartJobs(jobfunc_t func, void *data, int count)
+{
+    if (numworkers < 0)
+    {
+        I_InitThreads();
+    }
+
+    if (job_started)
+    {
+        I_Error("I_StartJobs: a batch is already running");
+    }
+
+    job_started = true;
+
+    if (numworkers == 0)
+    {
+        // Nothing runs until I_FinishJobs
+        job_func = func;
+        job_data = data;
+        job_count = count;
+        SDL_AtomicSet(&job_next, 0);
+        return;
+    }
+
+    SDL_LockMutex(job_mutex);
+
+    // A worker that woke up too late for the previous batch may still be
+    // in RunJobs, finding nothing left. It must be out before job_next
+    // is reset under it.
+    while (workers_busy > 0)
+    {
+        SDL_CondWait(done_cond, job_mutex);
+    }
+
+    job_func = func;
+    job_data = data;
+    job_count = count;
+    SDL_AtomicSet(&job_next, 0);
+    ++job_generation;
+    SDL_CondBroadcast(job_cond);
+    SDL_UnlockMutex(job_mutex);
+}
+
+void I_FinishJobs(void)
+{
+    if (!job_started)
+    {
+        return;
+    }
+
+    RunJobs(job_func, job_data, job_count);
+
+    if (numworkers > 0)
+    {
+        SDL_LockMutex(job_mutex);
+        while (workers_busy > 0)
+        {
+            SDL_CondWait(done_cond, job_mutex);
+        }
+        SDL_UnlockMutex(job_mutex);
+    }
+
+    job_started = false;
+}
+
+void I_RunJobs(jobfunc_t func, void *data, int count)
+{
+    I_StartJobs(func, data, count);
+    I_FinishJobs();
+}
@@ -0,0 +1,42 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//      Worker threads for splitting loops across cores.
+//
+
+
+#ifndef __I_THREAD__
+#define __I_THREAD__
+
+// Called once for each index of a batch, from any thread. Jobs must not
+// touch the zone allocator, lump cache or anything else that isn't
+// thread safe: allocate on the main thread before starting the batch.
+typedef void (*jobfunc_t)(int index, void *data);
+
+// Number of threads jobs are split across, including the main thread.
+int I_NumThreads(void);
+
+// Hands func(0..count-1) to the workers and returns right away, so the
+// main thread can do other work in the meantime. Only one batch can be
+// in flight.
+void I_StartJobs(jobfunc_t func, void *data, int count);
+
+// Helps with the remaining jobs of the batch and returns when all of
+// them are done. Does nothing if no batch was started.
+void I_FinishJobs(void);
+
+// I_StartJobs + I_FinishJobs.
+void I_RunJobs(jobfunc_t func, void *data, int count);
+
+#endif
@@ -60,7 +60,7 @@ extern char **crstr;
 #ifndef CRISPY_TRUECOLOR
 extern byte *tranmap;
 #else
-extern const pixel_t (*blendfunc) (const pixel_t fg, const pixel_t bg);
+extern THREADLOCAL const pixel_t (*blendfunc) (const pixel_t fg, const pixel_t bg);
 extern const pixel_t I_BlendAdd (const pixel_t bg, const pixel_t fg);
 extern const pixel_t I_BlendDark (const pixel_t bg, const int d);
 extern const pixel_t I_BlendOver (const pixel_t bg, const pixel_t fg);
@@ -808,6 +808,49 @@ void V_DrawScaledBlockTransparency(int x, int y, int width, int height, pixel_t
     }
 }
 
+// [AP] Same, but transparency comes from mask (0 = transparent), so
+// palette index 0 can be drawn. src holds palette indices, like patches.
+void V_DrawScaledBlockMasked(int x, int y, int width, int height, pixel_t *src, byte *mask)
+{
+    pixel_t *dest;
+    int i, j;
+
+    x += WIDESCREENDELTA; // [crispy] horizontal widescreen offset
+
+#ifdef RANGECHECK
+    if (x < -width
+     || x + width > SCREENWIDTH
+     || y < 0
+     || y + height > SCREENWIDTH)
+    {
+        return; // [AP] We don't mind, just dont render it
+    }
+#endif
+
+    int offscreen_x = 0;
+    if (x < 0) offscreen_x = -x;
+
+    V_MarkRect (x + offscreen_x, y, width - offscreen_x, height);
+
+    dest = dest_screen + (y << crispy->hires) * SCREENWIDTH + ((x + offscreen_x) << crispy->hires);
+
+    for (i = 0; i < (height << crispy->hires); i++)
+    {
+        int row = (i >> crispy->hires) * width;
+
+        for (j = (offscreen_x << crispy->hires); j < (width << crispy->hires); j++)
+        {
+            int k = row + (j >> crispy->hires);
+            if (!mask[k]) continue;
+#ifndef CRISPY_TRUECOLOR
+            *(dest + i * SCREENWIDTH + (j - (offscreen_x << crispy->hires))) = src[k];
+#else
+            *(dest + i * SCREENWIDTH + (j - (offscreen_x << crispy->hires))) = colormaps[src[k]];
+#endif
+        }
+    }
+}
+
 void V_DrawFilledBox(int x, int y, int w, int h, int c)
 {
     pixel_t *buf, *buf1;
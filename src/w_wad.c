@@ -59,8 +59,17 @@ typedef PACKED_STRUCT (
 lumpinfo_t **lumpinfo;
 unsigned int numlumps = 0;
 
-// Hash table for fast lookups
-static lumpindex_t *lumphash;
+// Hash table for fast lookups. Open addressing on the lump name keys,
+// each slot holds the last lump with that name; older lumps with the same
+// name are chained through lumpinfo[]->next.
+typedef struct
+{
+    uint64_t key;
+    lumpindex_t index; // -1 if the slot is empty
+} lumphash_t;
+
+static lumphash_t *lumphash;
+static unsigned int lumphash_bits;
 
 // Variables for the reload hack: filename of the PWAD to reload, and the
 // lumps from WADs before the reload file, so we can resent numlumps and
@@ -103,6 +112,48 @@ unsigned int W_LumpNameHash(const char *s)
     return result;
 }
 
+// Lump names as a single integer: the name upper cased and zero padded to
+// 8 bytes, so comparing two keys is the same as strncasecmp(a, b, 8).
+uint64_t W_LumpNameKey(const char *s)
+{
+    uint64_t result = 0;
+    unsigned int i;
+
+    for (i=0; i < 8 && s[i] != '\0'; ++i)
+    {
+        uint64_t c = (byte) s[i];
+
+        if (c >= 'a' && c <= 'z')
+        {
+            c -= 'a' - 'A';
+        }
+
+        result |= c << (i * 8);
+    }
+
+    return result;
+}
+
+static unsigned int LumpKeySlot(uint64_t key)
+{
+    // Fibonacci hashing, the top bits are the best mixed
+    return (unsigned int) ((key * 0x9e3779b97f4a7c15ULL) >> (64 - lumphash_bits));
+}
+
+// Slot of the given key, or of the empty slot where it would go.
+static lumphash_t *LumpHashFind(uint64_t key)
+{
+    unsigned int mask = (1u << lumphash_bits) - 1;
+    unsigned int slot = LumpKeySlot(key);
+
+    while (lumphash[slot].index != -1 && lumphash[slot].key != key)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    return &lumphash[slot];
+}
+
 //
 // LUMP BASED ROUTINES.
 //
@@ -234,6 +285,8 @@ wad_file_t *W_AddFile (const char *filename)
         lump_p->size = LONG(filerover->size);
         lump_p->cache = NULL;
         strncpy(lump_p->name, filerover->name, 8);
+        lump_p->key = W_LumpNameKey(lump_p->name);
+        lump_p->next = -1;
         lumpinfo[i] = lump_p;
 
         ++filerover;
@@ -285,19 +338,9 @@ lumpindex_t W_CheckNumForName(const char *name)
 
     if (lumphash != NULL)
     {
-        int hash;
-
         // We do! Excellent.
 
-        hash = W_LumpNameHash(name) % numlumps;
-
-        for (i = lumphash[hash]; i != -1; i = lumpinfo[i]->next)
-        {
-            if (!strncasecmp(lumpinfo[i]->name, name, 8))
-            {
-                return i;
-            }
-        }
+        return LumpHashFind(W_LumpNameKey(name))->index;
     }
     else
     {
@@ -344,6 +387,16 @@ lumpindex_t W_CheckNumForNameFromTo(const char *name, int from, int to)
 {
     lumpindex_t i;
 
+    // Walk down the lumps sharing that name instead of the whole range,
+    // flat and sprite namespace lookups only visit their own duplicates
+
+    if (lumphash != NULL)
+    {
+        for (i = LumpHashFind(W_LumpNameKey(name))->index; i > from; i = lumpinfo[i]->next);
+
+        return i >= to ? i : -1;
+    }
+
     for (i = from; i >= to; i--)
     {
         if (!strncasecmp(lumpinfo[i]->name, name, 8))
@@ -573,33 +626,48 @@ void W_Profile (void)
 void W_GenerateHashTable(void)
 {
     lumpindex_t i;
+    unsigned int size;
 
     // Free the old hash table, if there is one:
     if (lumphash != NULL)
     {
         Z_Free(lumphash);
+        lumphash = NULL;
     }
 
     // Generate hash table
     if (numlumps > 0)
     {
-        lumphash = Z_Malloc(sizeof(lumpindex_t) * numlumps, PU_STATIC, NULL);
+        // At most half full, so probe sequences stay short
+        lumphash_bits = 1;
+        while ((1u << lumphash_bits) < numlumps * 2)
+        {
+            ++lumphash_bits;
+        }
+        size = 1u << lumphash_bits;
 
-        for (i = 0; i < numlumps; ++i)
+        lumphash = Z_Malloc(sizeof(lumphash_t) * size, PU_STATIC, NULL);
+
+        for (i = 0; i < size; ++i)
         {
-            lumphash[i] = -1;
+            lumphash[i].key = 0;
+            lumphash[i].index = -1;
         }
 
         for (i = 0; i < numlumps; ++i)
         {
-            unsigned int hash;
+            lumphash_t *slot;
 
-            hash = W_LumpNameHash(lumpinfo[i]->name) % numlumps;
+            // Names may have been changed since loading (i.e. SIGIL lumps
+            // renamed out of the way)
+            lumpinfo[i]->key = W_LumpNameKey(lumpinfo[i]->name);
 
-            // Hook into the hash table
+            // Hook into the hash table, later lumps take precedence
 
-            lumpinfo[i]->next = lumphash[hash];
-            lumphash[hash] = i;
+            slot = LumpHashFind(lumpinfo[i]->key);
+            lumpinfo[i]->next = slot->index;
+            slot->key = lumpinfo[i]->key;
+            slot->index = i;
         }
     }
 
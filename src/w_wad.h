@@ -45,7 +45,9 @@ struct lumpinfo_s
     int		size;
     void       *cache;
 
-    // Used for hash table lookups
+    // Used for hash table lookups: name normalized by W_LumpNameKey, and
+    // the next lower lump with the same name (-1 if none)
+    uint64_t    key;
     lumpindex_t next;
 };
 
@@ -69,6 +71,7 @@ void *W_CacheLumpName(const char *name, int tag);
 void W_GenerateHashTable(void);
 
 extern unsigned int W_LumpNameHash(const char *s);
+extern uint64_t W_LumpNameKey(const char *s);
 
 void W_ReleaseLumpNum(lumpindex_t lump);
 void W_ReleaseLumpName(const char *name);
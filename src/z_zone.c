@@ -34,6 +34,12 @@
 //
 // It is of no value to free a cachable block,
 //  because it will get overwritten automatically if needed.
+//
+// [AP] By default free blocks are also kept in segregated lists by size
+// class (bins), so Z_Malloc finds a fit without walking the heap, and
+// purgable blocks are kept on their own least recently used list. When
+// nothing fits, a run of old cache blocks next to each other is purged.
+// The original first-fit rover is still there behind -zonerover.
 // 
  
 #define MEM_ALIGN sizeof(void *)
@@ -47,6 +53,10 @@ typedef struct memblock_s
     int			id;	// should be ZONEID
     struct memblock_s*	next;
     struct memblock_s*	prev;
+
+    // [AP] Bin list if this is free, LRU list if purgable
+    struct memblock_s*	lnext;
+    struct memblock_s*	lprev;
 } memblock_t;
 
 
@@ -63,10 +73,31 @@ typedef struct
 } memzone_t;
 
 
+// [AP] Size classes. Below SMALL_BIN_LIMIT, one class per 16 bytes so
+// same sized blocks (thinkers, mobjs) come back to the next allocation
+// of that size. Above, 8 classes per power of two.
+#define SMALL_BIN_LIMIT		1024
+#define SMALL_BIN_SHIFT		4
+#define NUM_SMALL_BINS		(SMALL_BIN_LIMIT >> SMALL_BIN_SHIFT)
+#define BIN_SUBDIVISIONS	8
+#define NUM_BINS		256
+
+// [crispy] zones are added when the heap is full
+#define MAX_ZONES		16
+
 
 static memzone_t *mainzone;
+static memzone_t *zones[MAX_ZONES];
+static int numzones;
 static boolean zero_on_free;
 static boolean scan_on_free;
+static boolean zone_rover;
+
+static memblock_t *bins[NUM_BINS];
+static uint64_t binmask[NUM_BINS / 64]; // Which bins have blocks
+
+// Purgable blocks, most recently used at the head
+static memblock_t lru;
 
 
 //
@@ -96,15 +127,139 @@ void Z_ClearZone (memzone_t* zone)
 
 
 //
-// Z_Init
+// Bins
 //
-void Z_Init (void)
+
+static int BinForSize(int size)
+{
+    int log2;
+
+    if (size < SMALL_BIN_LIMIT)
+    {
+        return size >> SMALL_BIN_SHIFT;
+    }
+
+    for (log2 = 10; (size >> log2) > 1; ++log2);
+
+    return NUM_SMALL_BINS + (log2 - 10) * BIN_SUBDIVISIONS
+         + ((size >> (log2 - 3)) & (BIN_SUBDIVISIONS - 1));
+}
+
+// Smallest size a block in the given bin can have
+static int BinMinSize(int bin)
+{
+    int log2;
+
+    if (bin < NUM_SMALL_BINS)
+    {
+        return bin << SMALL_BIN_SHIFT;
+    }
+
+    bin -= NUM_SMALL_BINS;
+    log2 = 10 + bin / BIN_SUBDIVISIONS;
+
+    return (BIN_SUBDIVISIONS + bin % BIN_SUBDIVISIONS) << (log2 - 3);
+}
+
+static void BinInsert(memblock_t *block)
+{
+    int bin = BinForSize(block->size);
+
+    block->lprev = NULL;
+    block->lnext = bins[bin];
+    if (block->lnext)
+        block->lnext->lprev = block;
+    bins[bin] = block;
+    binmask[bin >> 6] |= 1ull << (bin & 63);
+}
+
+static void BinRemove(memblock_t *block)
+{
+    int bin = BinForSize(block->size);
+
+    if (block->lprev)
+        block->lprev->lnext = block->lnext;
+    else
+        bins[bin] = block->lnext;
+    if (block->lnext)
+        block->lnext->lprev = block->lprev;
+
+    if (!bins[bin])
+        binmask[bin >> 6] &= ~(1ull << (bin & 63));
+}
+
+// Any block from the first non empty bin whose blocks are all big enough,
+// otherwise a fit from the bin the size itself falls in.
+static memblock_t *BinFind(int size)
+{
+    memblock_t *block;
+    int bin = BinForSize(size);
+    int first = BinMinSize(bin) == size ? bin : bin + 1;
+    int i;
+
+    for (i = first >> 6; i < NUM_BINS / 64; ++i)
+    {
+        uint64_t mask = binmask[i];
+
+        if (i == first >> 6)
+            mask &= ~0ull << (first & 63);
+
+        if (mask)
+        {
+            int b = i << 6;
+
+            while (!(mask & 1))
+            {
+                mask >>= 1;
+                ++b;
+            }
+
+            return bins[b];
+        }
+    }
+
+    for (block = bins[bin]; block; block = block->lnext)
+    {
+        if (block->size >= size)
+            return block;
+    }
+
+    return NULL;
+}
+
+static void LRUInsert(memblock_t *block)
+{
+    block->lprev = &lru;
+    block->lnext = lru.lnext;
+    block->lnext->lprev = block;
+    lru.lnext = block;
+}
+
+static void LRURemove(memblock_t *block)
+{
+    block->lprev->lnext = block->lnext;
+    block->lnext->lprev = block->lprev;
+}
+
+
+//
+// Z_AddZone
+// [crispy] called again when the heap is full, allocates another zone
+//  twice as big
+//
+static void Z_AddZone (void)
 {
     memblock_t*	block;
     int		size;
 
+    if (numzones == MAX_ZONES)
+    {
+        I_Error("Z_Malloc: out of zone memory");
+    }
+
     mainzone = (memzone_t *)I_ZoneBase (&size);
     mainzone->size = size;
+    zones[numzones++] = mainzone;
 
     // set the entire zone to one free block
     mainzone->blocklist.next =
@@ -119,9 +274,22 @@ void Z_Init (void)
 
     // free block
     block->tag = PU_FREE;
+    block->user = NULL;
+    block->id = 0;
 
     block->size = mainzone->size - sizeof(memzone_t);
 
+    if (!zone_rover)
+    {
+        BinInsert(block);
+    }
+}
+
+//
+// Z_Init
+//
+void Z_Init (void)
+{
     // [Deliberately undocumented]
     // Zone memory debugging flag. If set, memory is zeroed after it is freed
     // to deliberately break any code that attempts to use it after free.
@@ -133,6 +301,18 @@ void Z_Init (void)
     // heap is scanned to look for remaining pointers to the freed block.
     //
     scan_on_free = M_ParmExists("-zonescan");
+
+    //!
+    // @category obscure
+    //
+    // Use the original first-fit zone allocator instead of the size class
+    // bins.
+    //
+    zone_rover = M_ParmExists("-zonerover");
+
+    lru.lnext = lru.lprev = &lru;
+
+    Z_AddZone();
 }
 
 // Scan the zone heap for pointers within the specified range, and warn about
@@ -141,11 +321,13 @@ static void ScanForBlock(void *start, void *end)
 {
     memblock_t *block;
     void **mem;
-    int i, len, tag;
+    int i, len, tag, z;
 
-    block = mainzone->blocklist.next;
+    for (z = 0; z < numzones; ++z)
+    {
+    block = zones[z]->blocklist.next;
 
-    while (block->next != &mainzone->blocklist)
+    while (block->next != &zones[z]->blocklist)
     {
         tag = block->tag;
 
@@ -170,6 +352,7 @@ static void ScanForBlock(void *start, void *end)
 
         block = block->next;
     }
+    }
 }
 
 //
@@ -191,6 +374,11 @@ void Z_Free (void* ptr)
 	    *block->user = 0;
     }
 
+    if (!zone_rover && block->tag >= PU_PURGELEVEL)
+    {
+        LRURemove(block);
+    }
+
     // mark as free
     block->tag = PU_FREE;
     block->user = NULL;
@@ -212,6 +400,9 @@ void Z_Free (void* ptr)
 
     if (other->tag == PU_FREE)
     {
+        if (!zone_rover)
+            BinRemove(other);
+
         // merge with previous free block
         other->size += block->size;
         other->next = block->next;
@@ -226,6 +417,9 @@ void Z_Free (void* ptr)
     other = block->next;
     if (other->tag == PU_FREE)
     {
+        if (!zone_rover)
+            BinRemove(other);
+
         // merge the next free block onto the end
         block->size += other->size;
         block->next = other->next;
@@ -234,6 +428,9 @@ void Z_Free (void* ptr)
         if (other == mainzone->rover)
             mainzone->rover = block;
     }
+
+    if (!zone_rover)
+        BinInsert(block);
 }
 
 
@@ -245,29 +442,143 @@ void Z_Free (void* ptr)
 #define MINFRAGMENT		64
 
 
-void*
-Z_Malloc
-( int		size,
-  int		tag,
-  void*		user )
+// Takes size bytes (header included) from the start of a free block,
+// leaving the rest as a free fragment.
+static void SplitBlock (memblock_t *base, int size)
 {
+    memblock_t*	newblock;
     int		extra;
+
+    extra = base->size - size;
+    
+    if (extra >  MINFRAGMENT)
+    {
+        // there will be a free fragment after the allocated block
+        newblock = (memblock_t *) ((byte *)base + size );
+        newblock->size = extra;
+	
+        newblock->tag = PU_FREE;
+        newblock->user = NULL;	
+        newblock->id = 0;
+        newblock->prev = base;
+        newblock->next = base->next;
+        newblock->next->prev = newblock;
+
+        base->next = newblock;
+        base->size = size;
+
+        if (!zone_rover)
+            BinInsert(newblock);
+    }
+}
+
+// How many of the least recently used cache blocks are tried as the
+// start of a run to purge
+#define PURGE_CANDIDATES	64
+
+// [AP] Purges a run of neighbouring free and purgable blocks big enough
+// for size. The run starts at one of the least recently used cache blocks,
+// and of those the one that throws out the fewest bytes is taken. Purging
+// the oldest blocks one by one wherever they are would throw out much of
+// the cache before any of them happen to merge into a fit.
+static boolean PurgeRun (int size)
+{
+    memblock_t*	candidate;
     memblock_t*	start;
-    memblock_t* rover;
-    memblock_t* newblock;
+    memblock_t*	end;
+    memblock_t*	best = NULL;
+    memblock_t*	bestend = NULL;
+    memblock_t*	block;
+    memblock_t*	next;
+    int		total;
+    int		purged;
+    int		bestpurged = 0;
+    int		tries;
+
+    for (candidate = lru.lprev, tries = 0;
+         candidate != &lru && tries < PURGE_CANDIDATES;
+         candidate = candidate->lprev, ++tries)
+    {
+        start = candidate;
+        total = purged = start->size;
+
+        if (start->prev->tag == PU_FREE)
+        {
+            start = start->prev;
+            total += start->size;
+        }
+
+        for (end = candidate->next; total < size; end = end->next)
+        {
+            if (end->tag != PU_FREE && end->tag < PU_PURGELEVEL)
+                break;
+
+            total += end->size;
+            if (end->tag != PU_FREE)
+                purged += end->size;
+        }
+
+        if (total >= size && (best == NULL || purged < bestpurged))
+        {
+            best = start;
+            bestend = end;
+            bestpurged = purged;
+        }
+    }
+
+    if (best == NULL)
+        return false;
+
+    // Free blocks in the run merge with the purged ones around them
+    for (block = best; block != bestend; block = next)
+    {
+        next = block->next;
+
+        if (next != bestend && next->tag == PU_FREE)
+            next = next->next;
+
+        if (block->tag != PU_FREE)
+            Z_Free ((byte *)block + sizeof(memblock_t));
+    }
+
+    return true;
+}
+
+// [AP] Same as the rover below, but the free block comes from the bins and
+// purging starts with the least recently used cache instead of whatever
+// sits after the rover.
+static memblock_t *Z_MallocBins (int size)
+{
     memblock_t*	base;
-    void *result;
 
-    size = (size + MEM_ALIGN - 1) & ~(MEM_ALIGN - 1);
-    
-    // scan through the block list,
-    // looking for the first free block
-    // of sufficient size,
-    // throwing out any purgable blocks along the way.
+    while ((base = BinFind(size)) == NULL)
+    {
+        if (lru.lprev != &lru)
+        {
+            if (!PurgeRun(size))
+                Z_Free ((byte *)lru.lprev + sizeof(memblock_t));
+        }
+        else
+        {
+            // [crispy] allocate another zone twice as big
+            Z_AddZone();
+        }
+    }
+
+    BinRemove(base);
+    SplitBlock(base, size);
+
+    return base;
+}
+
+// The original allocator: first fit from the rover, throwing out any
+// purgable blocks along the way.
+static memblock_t *Z_MallocRover (int size)
+{
+    memblock_t*	start;
+    memblock_t* rover;
+    memblock_t*	base;
 
-    // account for size of block header
-    size += sizeof(memblock_t);
-    
     // if there is a free block behind the rover,
     //  back up over them
     base = mainzone->rover;
@@ -286,7 +597,7 @@ Z_Malloc
 //          I_Error ("Z_Malloc: failed on allocation of %i bytes", size);
 
             // [crispy] allocate another zone twice as big
-            Z_Init();
+            Z_AddZone();
 
             base = mainzone->rover;
             rover = base;
@@ -321,30 +632,44 @@ Z_Malloc
 
     
     // found a block big enough
-    extra = base->size - size;
+    SplitBlock(base, size);
+
+    // next allocation will start looking here
+    mainzone->rover = base->next;	
+
+    return base;
+}
+
+void*
+Z_Malloc
+( int		size,
+  int		tag,
+  void*		user )
+{
+    memblock_t*	base;
+    void *result;
+
+    size = (size + MEM_ALIGN - 1) & ~(MEM_ALIGN - 1);
     
-    if (extra >  MINFRAGMENT)
-    {
-        // there will be a free fragment after the allocated block
-        newblock = (memblock_t *) ((byte *)base + size );
-        newblock->size = extra;
-	
-        newblock->tag = PU_FREE;
-        newblock->user = NULL;	
-        newblock->prev = base;
-        newblock->next = base->next;
-        newblock->next->prev = newblock;
+    // account for size of block header
+    size += sizeof(memblock_t);
 
-        base->next = newblock;
-        base->size = size;
-    }
-	
-	if (user == NULL && tag >= PU_PURGELEVEL)
-	    I_Error ("Z_Malloc: an owner is required for purgable blocks");
+    if (zone_rover)
+        base = Z_MallocRover(size);
+    else
+        base = Z_MallocBins(size);
+
+    if (user == NULL && tag >= PU_PURGELEVEL)
+        I_Error ("Z_Malloc: an owner is required for purgable blocks");
 
     base->user = user;
     base->tag = tag;
 
+    if (!zone_rover && tag >= PU_PURGELEVEL)
+    {
+        LRUInsert(base);
+    }
+
     result  = (void *) ((byte *)base + sizeof(memblock_t));
 
     if (base->user)
@@ -352,9 +677,6 @@ Z_Malloc
         *base->user = result;
     }
 
-    // next allocation will start looking here
-    mainzone->rover = base->next;	
-	
     base->id = ZONEID;
    
     return result;
@@ -372,9 +694,13 @@ Z_FreeTags
 {
     memblock_t*	block;
     memblock_t*	next;
+    int		z;
 	
-    for (block = mainzone->blocklist.next ;
-	 block != &mainzone->blocklist ;
+    // [AP] every zone, not only the last one added
+    for (z = 0; z < numzones; ++z)
+    {
+    for (block = zones[z]->blocklist.next ;
+	 block != &zones[z]->blocklist ;
 	 block = next)
     {
 	// get link before freeing
@@ -387,6 +713,7 @@ Z_FreeTags
 	if (block->tag >= lowtag && block->tag <= hightag)
 	    Z_Free ( (byte *)block+sizeof(memblock_t));
     }
+    }
 }
 
 
@@ -471,10 +798,13 @@ void Z_FileDumpHeap (FILE* f)
 void Z_CheckHeap (void)
 {
     memblock_t*	block;
+    int		z;
 	
-    for (block = mainzone->blocklist.next ; ; block = block->next)
+    for (z = 0; z < numzones; ++z)
     {
-	if (block->next == &mainzone->blocklist)
+    for (block = zones[z]->blocklist.next ; ; block = block->next)
+    {
+	if (block->next == &zones[z]->blocklist)
 	{
 	    // all blocks have been hit
 	    break;
@@ -489,6 +819,7 @@ void Z_CheckHeap (void)
 	if (block->tag == PU_FREE && block->next->tag == PU_FREE)
 	    I_Error ("Z_CheckHeap: two consecutive free blocks\n");
     }
+    }
 }
 
 
@@ -511,6 +842,15 @@ void Z_ChangeTag2(void *ptr, int tag, const char *file, int line)
         I_Error("%s:%i: Z_ChangeTag: an owner is required "
                 "for purgable blocks", file, line);
 
+    // [AP] (re)caching a block makes it the most recently used
+    if (!zone_rover)
+    {
+        if (block->tag >= PU_PURGELEVEL)
+            LRURemove(block);
+        if (tag >= PU_PURGELEVEL)
+            LRUInsert(block);
+    }
+
     block->tag = tag;
 }
 
@@ -538,15 +878,19 @@ int Z_FreeMemory (void)
 {
     memblock_t*		block;
     int			free;
+    int			z;
 	
     free = 0;
     
-    for (block = mainzone->blocklist.next ;
-         block != &mainzone->blocklist;
-         block = block->next)
+    for (z = 0; z < numzones; ++z)
     {
-        if (block->tag == PU_FREE || block->tag >= PU_PURGELEVEL)
-            free += block->size;
+        for (block = zones[z]->blocklist.next ;
+             block != &zones[z]->blocklist;
+             block = block->next)
+        {
+            if (block->tag == PU_FREE || block->tag >= PU_PURGELEVEL)
+                free += block->size;
+        }
     }
 
     return free;
@@ -554,6 +898,12 @@ int Z_FreeMemory (void)
 
 unsigned int Z_ZoneSize(void)
 {
-    return mainzone->size;
+    unsigned int size = 0;
+    int z;
+
+    for (z = 0; z < numzones; ++z)
+        size += zones[z]->size;
+
+    return size;
 }
 
@@ -0,0 +1,329 @@
+//
+// Copyright(C) 2023 David St-Louis
+//
+// This program is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 2
+// of the License, or (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// DESCRIPTION:
+//	Stresses the zone allocator the way a long session does. Links the
+//	real z_zone.c, so it runs the size class bins by default and the
+//	original rover with -zonerover, like the game. Run it both ways
+//	and compare. The heap starts at -mb MiB (default 8) and grows like
+//	I_ZoneBase does. -seed <n> picks another session. Every block carries a stamp that is checked before
+//	it is freed or reused, and Z_CheckHeap runs after every level:
+//	exits with 1 if anything was overwritten.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+
+#include "doomtype.h"
+#include "i_system.h"
+#include "m_argv.h"
+#include "z_zone.h"
+
+// A long session: levels loaded one after the other, with thinkers
+// coming and going and a hot set of lumps in the cache
+#define SESSIONLEVELS 300
+#define SESSIONTICS 700
+#define MAXTHINKERS 40000
+
+// A slaughter map: many small level blocks freed and spawned again in
+// random order, so the holes end up all over the heap
+#define SLAUGHTERBLOCKS 50000
+#define SLAUGHTERROUNDS 2000000
+
+#define NUMLUMPS 4000
+
+static int zonemb = 8;
+static unsigned int seed = 1;
+static int zonesadded;
+static int badstamps;
+static unsigned int randstate;
+static double zonetime;
+static long allocs;
+static int misses;
+
+static int *things[SLAUGHTERBLOCKS];
+static int numthings;
+static void *cache[NUMLUMPS];
+static int lumpsize[NUMLUMPS];
+
+void I_Error (const char *error, ...)
+{
+    va_list argptr;
+
+    va_start(argptr, error);
+    vfprintf(stderr, error, argptr);
+    va_end(argptr);
+    fprintf(stderr, "\n");
+    exit(1);
+}
+
+// Another zone twice as big each time, like I_ZoneBase
+byte *I_ZoneBase (int *size)
+{
+    static int i = 1;
+    byte *zonemem;
+
+    *size = zonemb * i * 1024 * 1024;
+    zonemem = malloc(*size);
+    if (zonemem == NULL)
+	I_Error("I_ZoneBase: can't allocate %d bytes", *size);
+
+    i *= 2;
+    zonesadded++;
+
+    return zonemem;
+}
+
+static int testargc;
+static char **testargv;
+
+boolean M_ParmExists (const char *check)
+{
+    int i;
+
+    for (i = 1; i < testargc; i++)
+    {
+	if (!strcasecmp(check, testargv[i]))
+	    return true;
+    }
+
+    return false;
+}
+
+static unsigned int Random (void)
+{
+    randstate = randstate * 1103515245 + 12345;
+    return (randstate >> 8) & 0xffffff;
+}
+
+static double Now (void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Only the zone calls are timed, not the test around them
+static void *TimedMalloc (int size, int tag, void *user)
+{
+    double start = Now();
+    void *ptr = Z_Malloc(size, tag, user);
+
+    zonetime += Now() - start;
+    allocs++;
+
+    return ptr;
+}
+
+static void TimedFree (void *ptr)
+{
+    double start = Now();
+
+    Z_Free(ptr);
+    zonetime += Now() - start;
+}
+
+static int ThingSize (void)
+{
+    // mobjs, and the smaller thinkers around them
+    if (Random() % 3 == 0)
+	return sizeof(int) * 58;
+
+    return 48 + (Random() % 6) * 16;
+}
+
+static void SpawnThing (int i, int size)
+{
+    things[i] = TimedMalloc(size, PU_LEVEL, NULL);
+    things[i][0] = i ^ 0x5a5a;
+}
+
+static void RemoveThing (int i)
+{
+    if (things[i][0] != (i ^ 0x5a5a))
+	badstamps++;
+
+    TimedFree(things[i]);
+}
+
+// W_CacheLumpNum: a miss allocates the lump again, a hit moves it to
+// the front of the purge order
+static void CacheLump (int lump)
+{
+    double start;
+
+    if (cache[lump] == NULL)
+    {
+	misses++;
+	TimedMalloc(lumpsize[lump], PU_CACHE, &cache[lump]);
+	((int *) cache[lump])[0] = lump;
+    }
+    else
+    {
+	if (((int *) cache[lump])[0] != lump)
+	    badstamps++;
+
+	start = Now();
+	Z_ChangeTag(cache[lump], PU_CACHE);
+	zonetime += Now() - start;
+    }
+}
+
+static void StartRun (unsigned int runseed)
+{
+    randstate = runseed;
+    zonetime = 0;
+    allocs = 0;
+    misses = 0;
+}
+
+static void PrintRun (const char *name)
+{
+    printf("%-10s %8.1f ms in the zone, %9ld allocs, %5.0f ns/alloc, "
+	   "%7d cache misses, %d zones\n",
+	   name, zonetime / 1e6, allocs, zonetime / allocs, misses,
+	   zonesadded);
+}
+
+static void RunSession (void)
+{
+    int level, tic, i, k, count;
+
+    StartRun(seed);
+
+    for (level = 0; level < SESSIONLEVELS; level++)
+    {
+	// Like P_SetupLevel, the old level goes away at once
+	Z_FreeTags(PU_LEVEL, PU_PURGELEVEL - 1);
+	numthings = 0;
+
+	// A few big arrays for the map, then the things
+	for (i = 0; i < 8; i++)
+	    TimedMalloc(20000 + Random() % 200000, PU_LEVEL, NULL);
+
+	count = 500 + Random() % (MAXTHINKERS / 2);
+	for (i = 0; i < count; i++)
+	    SpawnThing(numthings++, ThingSize());
+
+	for (tic = 0; tic < SESSIONTICS; tic++)
+	{
+	    for (i = 0; i < 6; i++)
+	    {
+		if (numthings > 0 && Random() % 2)
+		{
+		    k = Random() % numthings;
+		    RemoveThing(k);
+		    things[k] = things[--numthings];
+		    if (k < numthings)
+			things[k][0] = k ^ 0x5a5a;
+		}
+		else if (numthings < MAXTHINKERS)
+		{
+		    SpawnThing(numthings++, ThingSize());
+		}
+	    }
+
+	    // Mostly the lumps of this level, sometimes any of them
+	    for (i = 0; i < 12; i++)
+	    {
+		if (Random() % 4)
+		    CacheLump((level * 37 + Random() % 300) % NUMLUMPS);
+		else
+		    CacheLump(Random() % NUMLUMPS);
+	    }
+	}
+
+	Z_CheckHeap();
+    }
+
+    PrintRun("session:");
+}
+
+static void RunSlaughter (void)
+{
+    int round, i, k;
+
+    StartRun(seed + 6);
+
+    Z_FreeTags(PU_LEVEL, PU_PURGELEVEL - 1);
+
+    for (i = 0; i < SLAUGHTERBLOCKS; i++)
+	SpawnThing(i, 120 + (Random() % 8) * 32);
+
+    for (round = 0; round < SLAUGHTERROUNDS; round++)
+    {
+	// Monsters die and spawn in random order
+	k = Random() % SLAUGHTERBLOCKS;
+	RemoveThing(k);
+	SpawnThing(k, 120 + (Random() % 8) * 32);
+
+	if (round % 4 == 0)
+	{
+	    if (Random() % 5)
+		CacheLump(Random() % 600);
+	    else
+		CacheLump(Random() % NUMLUMPS);
+	}
+    }
+
+    Z_CheckHeap();
+
+    PrintRun("slaughter:");
+}
+
+int main (int argc, char **argv)
+{
+    int i;
+
+    testargc = argc;
+    testargv = argv;
+
+    for (i = 1; i < argc - 1; i++)
+    {
+	if (!strcasecmp(argv[i], "-mb"))
+	    zonemb = atoi(argv[i + 1]);
+	if (!strcasecmp(argv[i], "-seed"))
+	    seed = atoi(argv[i + 1]);
+    }
+
+    Z_Init();
+
+    printf("%s, %d MiB to start with, seed %u\n",
+	   M_ParmExists("-zonerover") ? "Rover" : "Bins", zonemb, seed);
+
+    // Same lump sizes for both runs: mostly sprites and flats, some
+    // patches and sounds
+    randstate = seed + 2;
+    for (i = 0; i < NUMLUMPS; i++)
+    {
+	if (Random() % 8 == 0)
+	    lumpsize[i] = 8192 + Random() % 65536;
+	else
+	    lumpsize[i] = 64 + Random() % 4096;
+    }
+
+    RunSession();
+    RunSlaughter();
+
+    if (badstamps > 0)
+    {
+	printf("%d blocks were overwritten.\n", badstamps);
+	return 1;
+    }
+
+    return 0;
+}